@@ -0,0 +1,479 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_bench.c
+*
+* Description:  Benchmark and accuracy suite for the host build of the
+*               library
+*
+* Target Processor: Host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup HostBench Host Benchmark and Accuracy Suite
+ *
+ * \par Description:
+ * \par
+ * Runs the kernels of every function group of the library over a sweep of
+ * block sizes on the host, with the library built for the host by defining
+ * ARM_MATH_HOST. For every kernel and block size the suite reports the time
+ * per sample in ns and the SNR of the output against a double precision
+ * reference computed from the same quantized input. A kernel fails when its
+ * SNR drops below the limit given in its test case, which makes the suite
+ * usable to catch numerical regressions before running on the target. The
+ * times are those of the C code paths on the host and only compare between
+ * runs on the same machine.
+ *
+ * \par Building:
+ * \par
+ * From the <code>CMSIS/DSP_Lib/Host</code> folder, for the Cortex-M3 code paths:
+ * <pre>
+ * cc -O2 -fno-strict-aliasing -fwrapv -DARM_MATH_HOST -I../../Include -o arm_host_bench \
+ *    arm_host_bench.c arm_host_bench_cases.c `find ../Source -name "*.c"` -lm
+ * </pre>
+ * Add <code>-DARM_MATH_CM0</code> for the Cortex-M0 code paths. The library
+ * casts q15_t and q7_t pointers to 32 bit pointers, so strict aliasing must be off,
+ * and it relies on signed arithmetic wrapping around as it does on the target.
+ *
+ * \par Usage:
+ * \par
+ * <pre>
+ * arm_host_bench [-f family] [-k kernel] [-t ms] [-c] [-l]
+ * </pre>
+ * \li \c -f runs only the kernels of a family, e.g. Filtering
+ * \li \c -k runs only the kernels whose name contains the given text
+ * \li \c -t sets the minimum time in ms each kernel is timed for, default 2
+ * \li \c -c prints comma separated values, to compare runs with a diff tool
+ * \li \c -l lists the kernels and their SNR limits
+ *
+ * \par
+ * The exit status is 0 when all kernels pass and 1 when one fails.
+ *
+ * <b> Refer  </b>
+ * \link arm_host_bench.c \endlink
+ *
+ */
+
+/** \example arm_host_bench.c
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "arm_math.h"
+#include "arm_host_bench.h"
+
+/* ----------------------------------------------------------------------
+* Shared buffers
+* ------------------------------------------------------------------- */
+float64_t benchInA[BENCH_MAX_VALUES];
+float64_t benchInB[BENCH_MAX_VALUES];
+float64_t benchRef[BENCH_MAX_VALUES];
+float64_t benchOut[BENCH_MAX_VALUES];
+
+float32_t benchSrcA_f32[BENCH_MAX_VALUES];
+float32_t benchSrcB_f32[BENCH_MAX_VALUES];
+float32_t benchDst_f32[BENCH_MAX_VALUES];
+q31_t benchSrcA_q31[BENCH_MAX_VALUES];
+q31_t benchSrcB_q31[BENCH_MAX_VALUES];
+q31_t benchDst_q31[BENCH_MAX_VALUES];
+q15_t benchSrcA_q15[BENCH_MAX_VALUES];
+q15_t benchSrcB_q15[BENCH_MAX_VALUES];
+q15_t benchDst_q15[BENCH_MAX_VALUES];
+q7_t benchSrcA_q7[BENCH_MAX_VALUES];
+q7_t benchSrcB_q7[BENCH_MAX_VALUES];
+q7_t benchDst_q7[BENCH_MAX_VALUES];
+
+/* ----------------------------------------------------------------------
+* State of the random generator, reset for every test so the inputs are
+* the same from run to run
+* ------------------------------------------------------------------- */
+#define BENCH_SEED          0x12345678u
+
+static uint32_t benchSeed = BENCH_SEED;
+
+/* ----------------------------------------------------------------------
+* Input generation
+* ------------------------------------------------------------------- */
+
+/*
+ * @brief  Uniform random value in [-1, 1), from a 32 bit LCG.
+ */
+float64_t arm_bench_random(
+  void)
+{
+  benchSeed = benchSeed * 1664525u + 1013904223u;
+
+  return ((float64_t) (int32_t) benchSeed / 2147483648.0);
+}
+
+void arm_bench_random_f32(
+  float32_t * pDst,
+  float64_t * pRef,
+  float64_t amplitude,
+  uint32_t blockSize)
+{
+  uint32_t i;
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pDst[i] = (float32_t) (amplitude * arm_bench_random());
+    pRef[i] = (float64_t) pDst[i];
+  }
+}
+
+void arm_bench_random_q31(
+  q31_t * pDst,
+  float64_t * pRef,
+  float64_t amplitude,
+  uint32_t blockSize)
+{
+  uint32_t i;
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pDst[i] = arm_bench_to_q31(amplitude * arm_bench_random());
+    pRef[i] = (float64_t) pDst[i] / 2147483648.0;
+  }
+}
+
+void arm_bench_random_q15(
+  q15_t * pDst,
+  float64_t * pRef,
+  float64_t amplitude,
+  uint32_t blockSize)
+{
+  uint32_t i;
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pDst[i] = arm_bench_to_q15(amplitude * arm_bench_random());
+    pRef[i] = (float64_t) pDst[i] / 32768.0;
+  }
+}
+
+void arm_bench_random_q7(
+  q7_t * pDst,
+  float64_t * pRef,
+  float64_t amplitude,
+  uint32_t blockSize)
+{
+  uint32_t i;
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pDst[i] = arm_bench_to_q7(amplitude * arm_bench_random());
+    pRef[i] = (float64_t) pDst[i] / 128.0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Quantization of single values
+* ------------------------------------------------------------------- */
+q31_t arm_bench_to_q31(
+  float64_t in)
+{
+  float64_t out = floor(in * 2147483648.0 + 0.5);
+
+  return ((out >= 2147483647.0) ? 0x7FFFFFFF :
+          ((out <= -2147483648.0) ? (q31_t) 0x80000000 : (q31_t) out));
+}
+
+q15_t arm_bench_to_q15(
+  float64_t in)
+{
+  float64_t out = floor(in * 32768.0 + 0.5);
+
+  return ((out >= 32767.0) ? 0x7FFF : ((out <= -32768.0) ? (q15_t) 0x8000 : (q15_t) out));
+}
+
+q7_t arm_bench_to_q7(
+  float64_t in)
+{
+  float64_t out = floor(in * 128.0 + 0.5);
+
+  return ((out >= 127.0) ? 0x7F : ((out <= -128.0) ? (q7_t) 0x80 : (q7_t) out));
+}
+
+/* ----------------------------------------------------------------------
+* Output conversion
+* ------------------------------------------------------------------- */
+void arm_bench_result_f32(
+  const float32_t * pSrc,
+  float64_t scale,
+  uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0u; i < count; i++)
+  {
+    benchOut[i] = (float64_t) pSrc[i] * scale;
+  }
+}
+
+void arm_bench_result_q31(
+  const q31_t * pSrc,
+  float64_t scale,
+  uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0u; i < count; i++)
+  {
+    benchOut[i] = (float64_t) pSrc[i] * scale / 2147483648.0;
+  }
+}
+
+void arm_bench_result_q15(
+  const q15_t * pSrc,
+  float64_t scale,
+  uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0u; i < count; i++)
+  {
+    benchOut[i] = (float64_t) pSrc[i] * scale / 32768.0;
+  }
+}
+
+void arm_bench_result_q7(
+  const q7_t * pSrc,
+  float64_t scale,
+  uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0u; i < count; i++)
+  {
+    benchOut[i] = (float64_t) pSrc[i] * scale / 128.0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Measurements
+* ------------------------------------------------------------------- */
+
+/*
+ * @brief  SNR in dB of benchOut against benchRef.
+ */
+static float64_t arm_bench_snr(
+  uint32_t count)
+{
+  float64_t signal = 0.0, noise = 0.0, err;
+  uint32_t i;
+
+  for (i = 0u; i < count; i++)
+  {
+    err = benchRef[i] - benchOut[i];
+    signal += benchRef[i] * benchRef[i];
+    noise += err * err;
+  }
+
+  /* NaN and Inf outputs fail */
+  if(noise != noise || noise > 1e300)
+  {
+    return (-BENCH_SNR_EXACT);
+  }
+
+  if(noise == 0.0)
+  {
+    return (BENCH_SNR_EXACT);
+  }
+
+  return (10.0 * log10(signal / noise));
+}
+
+static float64_t arm_bench_now(
+  void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((float64_t) ts.tv_sec * 1e9 + (float64_t) ts.tv_nsec);
+}
+
+/*
+ * @brief  Time per sample in ns of the kernel, run for at least minTime ns.
+ */
+static float64_t arm_bench_time(
+  const arm_bench_case * pCase,
+  uint32_t blockSize,
+  float64_t minTime)
+{
+  float64_t start, elapsed;
+  uint32_t reps = 1u, i;
+
+  for (;;)
+  {
+    start = arm_bench_now();
+
+    for (i = 0u; i < reps; i++)
+    {
+      pCase->run(blockSize);
+    }
+
+    elapsed = arm_bench_now() - start;
+
+    if(elapsed >= minTime || reps >= 0x40000000u)
+    {
+      break;
+    }
+
+    /* Aim just above the minimum time on the next round */
+    if(elapsed < minTime / 64.0)
+    {
+      reps *= 64u;
+    }
+    else
+    {
+      reps = (uint32_t) ((float64_t) reps * minTime * 1.2 / elapsed) + 1u;
+    }
+  }
+
+  return (elapsed / ((float64_t) reps * (float64_t) blockSize));
+}
+
+/* ----------------------------------------------------------------------
+* Suite
+* ------------------------------------------------------------------- */
+
+static void arm_bench_usage(
+  const char *pName)
+{
+  fprintf(stderr, "usage: %s [-f family] [-k kernel] [-t ms] [-c] [-l]\n", pName);
+}
+
+int main(
+  int argc,
+  char *argv[])
+{
+  const arm_bench_case *pCase;
+  const char *pFamily = NULL;
+  const char *pKernel = NULL;
+  float64_t minTime = 2e6;
+  float64_t snr, ns;
+  uint32_t csv = 0u, list = 0u, failed = 0u, count;
+  uint32_t i, j;
+  int k;
+
+  for (k = 1; k < argc; k++)
+  {
+    if(strcmp(argv[k], "-f") == 0 && k + 1 < argc)
+    {
+      pFamily = argv[++k];
+    }
+    else if(strcmp(argv[k], "-k") == 0 && k + 1 < argc)
+    {
+      pKernel = argv[++k];
+    }
+    else if(strcmp(argv[k], "-t") == 0 && k + 1 < argc)
+    {
+      minTime = atof(argv[++k]) * 1e6;
+    }
+    else if(strcmp(argv[k], "-c") == 0)
+    {
+      csv = 1u;
+    }
+    else if(strcmp(argv[k], "-l") == 0)
+    {
+      list = 1u;
+    }
+    else
+    {
+      arm_bench_usage(argv[0]);
+      return (2);
+    }
+  }
+
+  if(csv)
+  {
+    printf("family,kernel,blockSize,nsPerSample,snrDb,minSnrDb,status\n");
+  }
+  else if(!list)
+  {
+    printf("%-12s %-32s %6s %12s %8s %8s\n", "family", "kernel", "block", "ns/sample", "SNR dB", "min dB");
+  }
+
+  for (i = 0u; i < benchNumCases; i++)
+  {
+    pCase = &benchCases[i];
+
+    if((pFamily != NULL && strcmp(pFamily, pCase->pFamily) != 0) ||
+       (pKernel != NULL && strstr(pCase->pName, pKernel) == NULL))
+    {
+      continue;
+    }
+
+    if(list)
+    {
+      printf("%-12s %-32s %8.1f\n", pCase->pFamily, pCase->pName, pCase->minSnr);
+      continue;
+    }
+
+    for (j = 0u; pCase->pSizes[j] != 0u; j++)
+    {
+      /* Same input on every run */
+      benchSeed = BENCH_SEED;
+
+      /* Accuracy on a single run, then the time of repeated runs */
+      count = pCase->prepare(pCase->pSizes[j]);
+      pCase->run(pCase->pSizes[j]);
+      pCase->result(pCase->pSizes[j]);
+      snr = arm_bench_snr(count);
+      ns = arm_bench_time(pCase, pCase->pSizes[j], minTime);
+
+      if(snr < pCase->minSnr)
+      {
+        failed++;
+      }
+
+      printf(csv ? "%s,%s,%lu,%.3f,%.1f,%.1f,%s\n" : "%-12s %-32s %6lu %12.3f %8.1f %8.1f %s\n",
+             pCase->pFamily, pCase->pName, (unsigned long) pCase->pSizes[j], ns, snr,
+             pCase->minSnr, (snr < pCase->minSnr) ? "FAIL" : (csv ? "ok" : ""));
+    }
+  }
+
+  if(!list && !csv)
+  {
+    printf("%lu failed\n", (unsigned long) failed);
+  }
+
+  return ((failed != 0u) ? 1 : 0);
+}
@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_bench.h
+*
+* Description:  Declarations shared by the host benchmark and accuracy
+*               suite and its test cases
+*
+* Target Processor: Host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_HOST_BENCH_H
+#define _ARM_HOST_BENCH_H
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+* Size of the shared buffers, in values. Complex buffers hold half as
+* many samples.
+* ------------------------------------------------------------------- */
+#define BENCH_MAX_VALUES    8192u
+
+/* ----------------------------------------------------------------------
+* SNR reported when the output matches the reference exactly
+* ------------------------------------------------------------------- */
+#define BENCH_SNR_EXACT     999.0
+
+/**
+ * @brief A kernel under test.
+ *
+ * For every block size in pSizes the suite calls prepare(), runs the
+ * kernel once through run() and compares what result() leaves in
+ * benchOut with what prepare() left in benchRef. It then calls run()
+ * repeatedly to time it. run() must be safe to repeat on its own output.
+ * The ns per sample are reported per block size value, i.e. per input
+ * sample, or per matrix element.
+ */
+typedef struct
+{
+  const char *pFamily;                    /**< kernel family, e.g. "Filtering". */
+  const char *pName;                      /**< name of the function under test. */
+  const uint32_t *pSizes;                 /**< block sizes to sweep, ends with 0. */
+  float64_t minSnr;                       /**< lowest SNR in dB that passes. */
+  uint32_t (*prepare) (uint32_t blockSize); /**< makes input and reference, returns the number of output values. */
+  void (*run) (uint32_t blockSize);       /**< runs the kernel. */
+  void (*result) (uint32_t blockSize);    /**< converts the output to benchOut. */
+} arm_bench_case;
+
+/* ----------------------------------------------------------------------
+* Test cases, in arm_host_bench_cases.c
+* ------------------------------------------------------------------- */
+extern const arm_bench_case benchCases[];
+extern const uint32_t benchNumCases;
+
+/* ----------------------------------------------------------------------
+* Buffers shared by the test cases. benchInA and benchInB hold the
+* value of the quantized inputs, benchRef the double precision result
+* and benchOut the result of the kernel under test.
+* ------------------------------------------------------------------- */
+extern float64_t benchInA[BENCH_MAX_VALUES];
+extern float64_t benchInB[BENCH_MAX_VALUES];
+extern float64_t benchRef[BENCH_MAX_VALUES];
+extern float64_t benchOut[BENCH_MAX_VALUES];
+
+extern float32_t benchSrcA_f32[BENCH_MAX_VALUES];
+extern float32_t benchSrcB_f32[BENCH_MAX_VALUES];
+extern float32_t benchDst_f32[BENCH_MAX_VALUES];
+extern q31_t benchSrcA_q31[BENCH_MAX_VALUES];
+extern q31_t benchSrcB_q31[BENCH_MAX_VALUES];
+extern q31_t benchDst_q31[BENCH_MAX_VALUES];
+extern q15_t benchSrcA_q15[BENCH_MAX_VALUES];
+extern q15_t benchSrcB_q15[BENCH_MAX_VALUES];
+extern q15_t benchDst_q15[BENCH_MAX_VALUES];
+extern q7_t benchSrcA_q7[BENCH_MAX_VALUES];
+extern q7_t benchSrcB_q7[BENCH_MAX_VALUES];
+extern q7_t benchDst_q7[BENCH_MAX_VALUES];
+
+/* ----------------------------------------------------------------------
+* Input generation. Fills pDst with uniform random values in
+* [-amplitude, amplitude) and pRef with their quantized value.
+* ------------------------------------------------------------------- */
+float64_t arm_bench_random(
+  void);
+
+void arm_bench_random_f32(
+  float32_t * pDst,
+  float64_t * pRef,
+  float64_t amplitude,
+  uint32_t blockSize);
+
+void arm_bench_random_q31(
+  q31_t * pDst,
+  float64_t * pRef,
+  float64_t amplitude,
+  uint32_t blockSize);
+
+void arm_bench_random_q15(
+  q15_t * pDst,
+  float64_t * pRef,
+  float64_t amplitude,
+  uint32_t blockSize);
+
+void arm_bench_random_q7(
+  q7_t * pDst,
+  float64_t * pRef,
+  float64_t amplitude,
+  uint32_t blockSize);
+
+/* ----------------------------------------------------------------------
+* Quantization of single values, rounded and saturated
+* ------------------------------------------------------------------- */
+q31_t arm_bench_to_q31(
+  float64_t in);
+
+q15_t arm_bench_to_q15(
+  float64_t in);
+
+q7_t arm_bench_to_q7(
+  float64_t in);
+
+/* ----------------------------------------------------------------------
+* Output conversion. Writes the value of count outputs times scale to
+* benchOut. The scale undoes the format of the kernel output, e.g. 4.0
+* for a 3.29 result.
+* ------------------------------------------------------------------- */
+void arm_bench_result_f32(
+  const float32_t * pSrc,
+  float64_t scale,
+  uint32_t count);
+
+void arm_bench_result_q31(
+  const q31_t * pSrc,
+  float64_t scale,
+  uint32_t count);
+
+void arm_bench_result_q15(
+  const q15_t * pSrc,
+  float64_t scale,
+  uint32_t count);
+
+void arm_bench_result_q7(
+  const q7_t * pSrc,
+  float64_t scale,
+  uint32_t count);
+
+#endif /* _ARM_HOST_BENCH_H */
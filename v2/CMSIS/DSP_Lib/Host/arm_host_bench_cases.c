@@ -0,0 +1,5460 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_bench_cases.c
+*
+* Description:  Test cases of the host benchmark and accuracy suite, with
+*               their double precision references
+*
+* Target Processor: Host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include <string.h>
+#include <math.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "arm_host_bench.h"
+
+/* ----------------------------------------------------------------------
+* Block size sweeps
+* ------------------------------------------------------------------- */
+static const uint32_t sizesBlock[] = { 16u, 64u, 256u, 1024u, 4096u, 0u };
+static const uint32_t sizesFilter[] = { 64u, 256u, 1024u, 4096u, 0u };
+static const uint32_t sizesInterp[] = { 64u, 256u, 1024u, 0u };
+static const uint32_t sizesConv[] = { 16u, 64u, 256u, 1024u, 0u };
+static const uint32_t sizesMatrix[] = { 16u, 64u, 256u, 1024u, 0u };
+static const uint32_t sizesCfft[] = { 16u, 64u, 256u, 1024u, 4096u, 0u };
+static const uint32_t sizesRfftFast[] = { 64u, 256u, 1024u, 4096u, 0u };
+static const uint32_t sizesCfftFixed[] = { 16u, 32u, 64u, 128u, 256u, 512u, 1024u, 2048u, 4096u, 0u };
+static const uint32_t sizesRfftFixed[] = { 32u, 128u, 512u, 2048u, 4096u, 0u };
+static const uint32_t sizesFirFft[] = { 64u, 256u, 1024u, 4096u, 0u };
+static const uint32_t sizesResample[] = { 441u, 1764u, 4410u, 0u };
+static const uint32_t sizesMoving[] = { 256u, 1024u, 4096u, 0u };
+static const uint32_t sizesGoertzel[] = { 256u, 1000u, 4096u, 0u };
+static const uint32_t sizesRfft[] = { 128u, 512u, 2048u, 0u };
+static const uint32_t sizesKalman[] = { 4u, 8u, 16u, 0u };
+static const uint32_t sizesMfcc[] = { 1024u, 4096u, 0u };
+static const uint32_t sizesNNVector[] = { 64u, 256u, 1024u, 0u };
+static const uint32_t sizesNNImage[] = { 7u, 16u, 20u, 0u };
+static const uint32_t sizesSoftmax[] = { 10u, 64u, 256u, 0u };
+
+/* ----------------------------------------------------------------------
+* Output of the last prepared case, used by the shared result functions
+* ------------------------------------------------------------------- */
+static uint32_t outCount;
+static float64_t outScale;
+
+static void result_dst_f32(
+  uint32_t blockSize)
+{
+  arm_bench_result_f32(benchDst_f32, outScale, outCount);
+}
+
+static void result_dst_q31(
+  uint32_t blockSize)
+{
+  arm_bench_result_q31(benchDst_q31, outScale, outCount);
+}
+
+static void result_dst_q15(
+  uint32_t blockSize)
+{
+  arm_bench_result_q15(benchDst_q15, outScale, outCount);
+}
+
+static void result_dst_q7(
+  uint32_t blockSize)
+{
+  arm_bench_result_q7(benchDst_q7, outScale, outCount);
+}
+
+/*
+ * @brief  Sets the output of the prepared case and returns its count.
+ */
+static uint32_t output(
+  uint32_t count,
+  float64_t scale)
+{
+  outCount = count;
+  outScale = scale;
+
+  return (count);
+}
+
+/* ----------------------------------------------------------------------
+* Scalar results of the reduction kernels
+* ------------------------------------------------------------------- */
+static float32_t resultF32[2];
+static q63_t resultQ63;
+static q31_t resultQ31;
+static q15_t resultQ15;
+static q7_t resultQ7;
+static uint32_t resultIndex;
+
+/* ----------------------------------------------------------------------
+* Double precision references
+* ------------------------------------------------------------------- */
+static float64_t refTwiddle[2u * BENCH_MAX_VALUES];
+
+/*
+ * @brief  Solves A * X = B in place by Gauss-Jordan elimination with
+ *         partial pivoting, A of dim x dim, B and X of dim x numCols.
+ */
+static void ref_solve(
+  float64_t * pA,
+  float64_t * pB,
+  uint32_t dim,
+  uint32_t numCols)
+{
+  float64_t pivot, factor, temp;
+  uint32_t r, c, k, p;
+
+  for (k = 0u; k < dim; k++)
+  {
+    p = k;
+
+    for (r = k + 1u; r < dim; r++)
+    {
+      if(fabs(pA[r * dim + k]) > fabs(pA[p * dim + k]))
+      {
+        p = r;
+      }
+    }
+
+    for (c = 0u; c < dim; c++)
+    {
+      temp = pA[k * dim + c];
+      pA[k * dim + c] = pA[p * dim + c];
+      pA[p * dim + c] = temp;
+    }
+
+    for (c = 0u; c < numCols; c++)
+    {
+      temp = pB[k * numCols + c];
+      pB[k * numCols + c] = pB[p * numCols + c];
+      pB[p * numCols + c] = temp;
+    }
+
+    pivot = pA[k * dim + k];
+
+    for (r = 0u; r < dim; r++)
+    {
+      if(r != k)
+      {
+        factor = pA[r * dim + k] / pivot;
+
+        for (c = 0u; c < dim; c++)
+        {
+          pA[r * dim + c] -= factor * pA[k * dim + c];
+        }
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pB[r * numCols + c] -= factor * pB[k * numCols + c];
+        }
+      }
+    }
+  }
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < numCols; c++)
+    {
+      pB[r * numCols + c] /= pA[r * dim + r];
+    }
+  }
+}
+
+/*
+ * @brief  DFT of N interleaved complex values, divided by N for the inverse.
+ */
+static void ref_dft(
+  const float64_t * pIn,
+  float64_t * pOut,
+  uint32_t N,
+  uint32_t inverse)
+{
+  float64_t sign = inverse ? 1.0 : -1.0;
+  float64_t re, im;
+  uint32_t k, n, t;
+
+  for (k = 0u; k < N; k++)
+  {
+    refTwiddle[2u * k] = cos(2.0 * PI * k / N);
+    refTwiddle[2u * k + 1u] = sign * sin(2.0 * PI * k / N);
+  }
+
+  for (k = 0u; k < N; k++)
+  {
+    re = 0.0;
+    im = 0.0;
+
+    for (n = 0u, t = 0u; n < N; n++, t = (t + k) % N)
+    {
+      re += pIn[2u * n] * refTwiddle[2u * t] - pIn[2u * n + 1u] * refTwiddle[2u * t + 1u];
+      im += pIn[2u * n] * refTwiddle[2u * t + 1u] + pIn[2u * n + 1u] * refTwiddle[2u * t];
+    }
+
+    pOut[2u * k] = inverse ? re / N : re;
+    pOut[2u * k + 1u] = inverse ? im / N : im;
+  }
+}
+
+/*
+ * @brief  y[n] = sum of h[k] x[n - k], with x[n] = 0 for n < 0.
+ */
+static void ref_fir(
+  const float64_t * pCoeffs,
+  uint32_t numTaps,
+  const float64_t * pIn,
+  float64_t * pOut,
+  uint32_t blockSize)
+{
+  float64_t acc;
+  uint32_t n, k;
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    acc = 0.0;
+
+    for (k = 0u; k < numTaps && k <= n; k++)
+    {
+      acc += pCoeffs[k] * pIn[n - k];
+    }
+
+    pOut[n] = acc;
+  }
+}
+
+/*
+ * @brief  Convolution, of length srcALen + srcBLen - 1.
+ */
+static void ref_conv(
+  const float64_t * pA,
+  uint32_t srcALen,
+  const float64_t * pB,
+  uint32_t srcBLen,
+  float64_t * pOut)
+{
+  uint32_t n, k;
+
+  for (n = 0u; n < srcALen + srcBLen - 1u; n++)
+  {
+    pOut[n] = 0.0;
+
+    for (k = 0u; k < srcBLen; k++)
+    {
+      if(n >= k && n - k < srcALen)
+      {
+        pOut[n] += pA[n - k] * pB[k];
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Filter designs
+* ------------------------------------------------------------------- */
+#define FIR_TAPS            32u
+#define BIQUAD_STAGES       2u
+#define BIQUAD_CHANNELS     4u
+#define CONV_LENGTH         16u
+#define LMS_TAPS            16u
+#define MULTIRATE_FACTOR    4u
+#define RESAMPLE_L          160u
+#define RESAMPLE_M          441u
+#define RESAMPLE_TAPS       (16u * RESAMPLE_L)
+#define FARROW_TAPS         4u
+#define FARROW_ORDER        3u
+#define FARROW_STEP         46242202u
+#define FIR_FFT_TAPS        500u
+#define FIR_FFT_PART        64u
+#define FIR_FFT_PARTS       ((FIR_FFT_TAPS + FIR_FFT_PART - 1u) / FIR_FFT_PART)
+
+static float64_t firCoeffs[FIR_TAPS];
+static float64_t biquadCoeffs[5u * BIQUAD_STAGES];
+
+/*
+ * @brief  Hamming windowed low pass, unit gain at DC, symmetric so the
+ *         time reversed order the library uses is the same.
+ */
+static void design_fir(
+  float64_t cutoff)
+{
+  float64_t sum = 0.0, t;
+  uint32_t i;
+
+  for (i = 0u; i < FIR_TAPS; i++)
+  {
+    t = (float64_t) i - (FIR_TAPS - 1u) / 2.0;
+    firCoeffs[i] = (t == 0.0) ? 2.0 * cutoff : sin(2.0 * PI * cutoff * t) / (PI * t);
+    firCoeffs[i] *= 0.54 - 0.46 * cos(2.0 * PI * i / (FIR_TAPS - 1u));
+    sum += firCoeffs[i];
+  }
+
+  for (i = 0u; i < FIR_TAPS; i++)
+  {
+    firCoeffs[i] /= sum;
+  }
+}
+
+/*
+ * @brief  4th order Butterworth low pass at 0.1 fs in two sections, as
+ *         {b0, b1, b2, a1, a2} with the feedback signs of the library.
+ */
+static void design_biquad(
+  void)
+{
+  static const float64_t q[BIQUAD_STAGES] = { 0.54119610, 1.30656296 };
+  float64_t k = tan(PI * 0.1), norm;
+  uint32_t i;
+
+  for (i = 0u; i < BIQUAD_STAGES; i++)
+  {
+    norm = 1.0 / (1.0 + k / q[i] + k * k);
+    biquadCoeffs[5u * i] = k * k * norm;
+    biquadCoeffs[5u * i + 1u] = 2.0 * k * k * norm;
+    biquadCoeffs[5u * i + 2u] = k * k * norm;
+    biquadCoeffs[5u * i + 3u] = -2.0 * (k * k - 1.0) * norm;
+    biquadCoeffs[5u * i + 4u] = -(1.0 - k / q[i] + k * k) * norm;
+  }
+}
+
+/*
+ * @brief  Direct form I cascade on numChannels channels interleaved in
+ *         benchInA, coefficients as in biquadCoeffs.
+ */
+static void ref_biquad(
+  const float64_t * pCoeffs,
+  uint32_t blockSize,
+  uint32_t numChannels)
+{
+  float64_t x1, x2, y1, y2, x, y;
+  uint32_t n, s, c;
+
+  memcpy(benchRef, benchInA, blockSize * numChannels * sizeof(float64_t));
+
+  for (c = 0u; c < numChannels; c++)
+  {
+    for (s = 0u; s < BIQUAD_STAGES; s++)
+    {
+      x1 = x2 = y1 = y2 = 0.0;
+
+      for (n = c; n < blockSize * numChannels; n += numChannels)
+      {
+        x = benchRef[n];
+        y = pCoeffs[5u * s] * x + pCoeffs[5u * s + 1u] * x1 + pCoeffs[5u * s + 2u] * x2 +
+          pCoeffs[5u * s + 3u] * y1 + pCoeffs[5u * s + 4u] * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        benchRef[n] = y;
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Basic math
+* ------------------------------------------------------------------- */
+static uint32_t add_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 0.5, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] + benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void add_f32_run(
+  uint32_t n)
+{
+  arm_add_f32(benchSrcA_f32, benchSrcB_f32, benchDst_f32, n);
+}
+
+static uint32_t add_q31_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 0.5, n);
+  arm_bench_random_q31(benchSrcB_q31, benchInB, 0.5, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] + benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void add_q31_run(
+  uint32_t n)
+{
+  arm_add_q31(benchSrcA_q31, benchSrcB_q31, benchDst_q31, n);
+}
+
+static uint32_t add_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n);
+  arm_bench_random_q15(benchSrcB_q15, benchInB, 0.5, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] + benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void add_q15_run(
+  uint32_t n)
+{
+  arm_add_q15(benchSrcA_q15, benchSrcB_q15, benchDst_q15, n);
+}
+
+static uint32_t add_q7_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q7(benchSrcA_q7, benchInA, 0.5, n);
+  arm_bench_random_q7(benchSrcB_q7, benchInB, 0.5, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] + benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void add_q7_run(
+  uint32_t n)
+{
+  arm_add_q7(benchSrcA_q7, benchSrcB_q7, benchDst_q7, n);
+}
+
+static uint32_t mult_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void mult_f32_run(
+  uint32_t n)
+{
+  arm_mult_f32(benchSrcA_f32, benchSrcB_f32, benchDst_f32, n);
+}
+
+static uint32_t mult_q31_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+  arm_bench_random_q31(benchSrcB_q31, benchInB, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void mult_q31_run(
+  uint32_t n)
+{
+  arm_mult_q31(benchSrcA_q31, benchSrcB_q31, benchDst_q31, n);
+}
+
+static uint32_t mult_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+  arm_bench_random_q15(benchSrcB_q15, benchInB, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void mult_q15_run(
+  uint32_t n)
+{
+  arm_mult_q15(benchSrcA_q15, benchSrcB_q15, benchDst_q15, n);
+}
+
+static uint32_t mult_q7_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q7(benchSrcA_q7, benchInA, 1.0, n);
+  arm_bench_random_q7(benchSrcB_q7, benchInB, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void mult_q7_run(
+  uint32_t n)
+{
+  arm_mult_q7(benchSrcA_q7, benchSrcB_q7, benchDst_q7, n);
+}
+
+static uint32_t scale_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * 0.75;
+  }
+
+  return (output(n, 1.0));
+}
+
+static void scale_f32_run(
+  uint32_t n)
+{
+  arm_scale_f32(benchSrcA_f32, 0.75f, benchDst_f32, n);
+}
+
+static uint32_t scale_q31_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 0.5, n);
+
+  /* 0.75 as 0.375 shifted left by one */
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * 0.75;
+  }
+
+  return (output(n, 1.0));
+}
+
+static void scale_q31_run(
+  uint32_t n)
+{
+  arm_scale_q31(benchSrcA_q31, 0x30000000, 1, benchDst_q31, n);
+}
+
+static uint32_t scale_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * 0.75;
+  }
+
+  return (output(n, 1.0));
+}
+
+static void scale_q15_run(
+  uint32_t n)
+{
+  arm_scale_q15(benchSrcA_q15, 0x6000, 0, benchDst_q15, n);
+}
+
+static uint32_t shift_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.25, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * 4.0;
+  }
+
+  return (output(n, 1.0));
+}
+
+static void shift_q15_run(
+  uint32_t n)
+{
+  arm_shift_q15(benchSrcA_q15, 2, benchDst_q15, n);
+}
+
+static uint32_t abs_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = fabs(benchInA[i]);
+  }
+
+  return (output(n, 1.0));
+}
+
+static void abs_q15_run(
+  uint32_t n)
+{
+  arm_abs_q15(benchSrcA_q15, benchDst_q15, n);
+}
+
+static uint32_t negate_q31_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = -benchInA[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void negate_q31_run(
+  uint32_t n)
+{
+  arm_negate_q31(benchSrcA_q31, benchDst_q31, n);
+}
+
+static uint32_t offset_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] + 0.25;
+  }
+
+  return (output(n, 1.0));
+}
+
+static void offset_f32_run(
+  uint32_t n)
+{
+  arm_offset_f32(benchSrcA_f32, 0.25f, benchDst_f32, n);
+}
+
+/*
+ * @brief  Reference of the dot products, on the inputs left in benchInA and benchInB.
+ */
+static uint32_t dot_prod_ref(
+  uint32_t n)
+{
+  uint32_t i;
+
+  benchRef[0] = 0.0;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[0] += benchInA[i] * benchInB[i];
+  }
+
+  return (1u);
+}
+
+static uint32_t dot_prod_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 1.0, n);
+
+  return (dot_prod_ref(n));
+}
+
+static void dot_prod_f32_run(
+  uint32_t n)
+{
+  arm_dot_prod_f32(benchSrcA_f32, benchSrcB_f32, n, &resultF32[0]);
+}
+
+static void dot_prod_f32_result(
+  uint32_t n)
+{
+  benchOut[0] = resultF32[0];
+}
+
+static uint32_t dot_prod_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+  arm_bench_random_q31(benchSrcB_q31, benchInB, 1.0, n);
+
+  return (dot_prod_ref(n));
+}
+
+static void dot_prod_q31_run(
+  uint32_t n)
+{
+  arm_dot_prod_q31(benchSrcA_q31, benchSrcB_q31, n, &resultQ63);
+}
+
+static void dot_prod_q31_result(
+  uint32_t n)
+{
+  /* 16.48 */
+  benchOut[0] = (float64_t) resultQ63 / 281474976710656.0;
+}
+
+static uint32_t dot_prod_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+  arm_bench_random_q15(benchSrcB_q15, benchInB, 1.0, n);
+
+  return (dot_prod_ref(n));
+}
+
+static void dot_prod_q15_run(
+  uint32_t n)
+{
+  arm_dot_prod_q15(benchSrcA_q15, benchSrcB_q15, n, &resultQ63);
+}
+
+static void dot_prod_q15_result(
+  uint32_t n)
+{
+  /* 34.30 */
+  benchOut[0] = (float64_t) resultQ63 / 1073741824.0;
+}
+
+static uint32_t dot_prod_q7_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q7(benchSrcA_q7, benchInA, 1.0, n);
+  arm_bench_random_q7(benchSrcB_q7, benchInB, 1.0, n);
+
+  return (dot_prod_ref(n));
+}
+
+static void dot_prod_q7_run(
+  uint32_t n)
+{
+  arm_dot_prod_q7(benchSrcA_q7, benchSrcB_q7, n, &resultQ31);
+}
+
+static void dot_prod_q7_result(
+  uint32_t n)
+{
+  /* 18.14 */
+  benchOut[0] = (float64_t) resultQ31 / 16384.0;
+}
+
+/* ----------------------------------------------------------------------
+* Complex math, block sizes in complex samples
+* ------------------------------------------------------------------- */
+
+/*
+ * @brief  Reference of the complex products, on the inputs left in benchInA and benchInB.
+ */
+static uint32_t cmplx_mult_ref(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[2u * i] = benchInA[2u * i] * benchInB[2u * i] - benchInA[2u * i + 1u] * benchInB[2u * i + 1u];
+    benchRef[2u * i + 1u] = benchInA[2u * i] * benchInB[2u * i + 1u] + benchInA[2u * i + 1u] * benchInB[2u * i];
+  }
+
+  return (2u * n);
+}
+
+static uint32_t cmplx_mult_cmplx_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, 2u * n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 1.0, 2u * n);
+
+  return (output(cmplx_mult_ref(n), 1.0));
+}
+
+static void cmplx_mult_cmplx_f32_run(
+  uint32_t n)
+{
+  arm_cmplx_mult_cmplx_f32(benchSrcA_f32, benchSrcB_f32, benchDst_f32, n);
+}
+
+static uint32_t cmplx_mult_cmplx_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, 2u * n);
+  arm_bench_random_q31(benchSrcB_q31, benchInB, 1.0, 2u * n);
+
+  /* 3.29 */
+  return (output(cmplx_mult_ref(n), 4.0));
+}
+
+static void cmplx_mult_cmplx_q31_run(
+  uint32_t n)
+{
+  arm_cmplx_mult_cmplx_q31(benchSrcA_q31, benchSrcB_q31, benchDst_q31, n);
+}
+
+static uint32_t cmplx_mult_cmplx_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, 2u * n);
+  arm_bench_random_q15(benchSrcB_q15, benchInB, 1.0, 2u * n);
+
+  /* 3.13 */
+  return (output(cmplx_mult_ref(n), 4.0));
+}
+
+static void cmplx_mult_cmplx_q15_run(
+  uint32_t n)
+{
+  arm_cmplx_mult_cmplx_q15(benchSrcA_q15, benchSrcB_q15, benchDst_q15, n);
+}
+
+/*
+ * @brief  Reference of the magnitudes, on the input left in benchInA.
+ */
+static uint32_t cmplx_mag_ref(
+  uint32_t n,
+  uint32_t squared)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[2u * i] * benchInA[2u * i] + benchInA[2u * i + 1u] * benchInA[2u * i + 1u];
+
+    if(!squared)
+    {
+      benchRef[i] = sqrt(benchRef[i]);
+    }
+  }
+
+  return (n);
+}
+
+static uint32_t cmplx_mag_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, 2u * n);
+
+  return (output(cmplx_mag_ref(n, 0u), 1.0));
+}
+
+static void cmplx_mag_f32_run(
+  uint32_t n)
+{
+  arm_cmplx_mag_f32(benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t cmplx_mag_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, 2u * n);
+
+  /* 2.30 */
+  return (output(cmplx_mag_ref(n, 0u), 2.0));
+}
+
+static void cmplx_mag_q31_run(
+  uint32_t n)
+{
+  arm_cmplx_mag_q31(benchSrcA_q31, benchDst_q31, n);
+}
+
+static uint32_t cmplx_mag_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, 2u * n);
+
+  /* 2.14 */
+  return (output(cmplx_mag_ref(n, 0u), 2.0));
+}
+
+static void cmplx_mag_q15_run(
+  uint32_t n)
+{
+  arm_cmplx_mag_q15(benchSrcA_q15, benchDst_q15, n);
+}
+
+static uint32_t cmplx_mag_squared_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, 2u * n);
+
+  /* 3.13 */
+  return (output(cmplx_mag_ref(n, 1u), 4.0));
+}
+
+static void cmplx_mag_squared_q15_run(
+  uint32_t n)
+{
+  arm_cmplx_mag_squared_q15(benchSrcA_q15, benchDst_q15, n);
+}
+
+static uint32_t cmplx_conj_q31_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, 2u * n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[2u * i] = benchInA[2u * i];
+    benchRef[2u * i + 1u] = -benchInA[2u * i + 1u];
+  }
+
+  return (output(2u * n, 1.0));
+}
+
+static void cmplx_conj_q31_run(
+  uint32_t n)
+{
+  arm_cmplx_conj_q31(benchSrcA_q31, benchDst_q31, n);
+}
+
+static uint32_t cmplx_dot_prod_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, 2u * n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 1.0, 2u * n);
+
+  benchRef[0] = 0.0;
+  benchRef[1] = 0.0;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[0] += benchInA[2u * i] * benchInB[2u * i] - benchInA[2u * i + 1u] * benchInB[2u * i + 1u];
+    benchRef[1] += benchInA[2u * i] * benchInB[2u * i + 1u] + benchInA[2u * i + 1u] * benchInB[2u * i];
+  }
+
+  return (2u);
+}
+
+static void cmplx_dot_prod_f32_run(
+  uint32_t n)
+{
+  arm_cmplx_dot_prod_f32(benchSrcA_f32, benchSrcB_f32, n, &resultF32[0], &resultF32[1]);
+}
+
+static void cmplx_dot_prod_f32_result(
+  uint32_t n)
+{
+  benchOut[0] = resultF32[0];
+  benchOut[1] = resultF32[1];
+}
+
+/* ----------------------------------------------------------------------
+* Controller
+* ------------------------------------------------------------------- */
+static uint32_t sin_cos_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  /* Angles in degrees. The table starts at -179 degrees, so angles in
+   * [-180, -179) are not interpolated and are left out. */
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 179.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[2u * i] = sin(benchInA[i] * PI / 180.0);
+    benchRef[2u * i + 1u] = cos(benchInA[i] * PI / 180.0);
+  }
+
+  return (output(2u * n, 1.0));
+}
+
+static void sin_cos_f32_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    arm_sin_cos_f32(benchSrcA_f32[i], &benchDst_f32[2u * i], &benchDst_f32[2u * i + 1u]);
+  }
+}
+
+static uint32_t sin_cos_q31_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  /* [-1, 1) maps to [-180, 180) degrees */
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[2u * i] = sin(benchInA[i] * PI);
+    benchRef[2u * i + 1u] = cos(benchInA[i] * PI);
+  }
+
+  return (output(2u * n, 1.0));
+}
+
+static void sin_cos_q31_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    arm_sin_cos_q31(benchSrcA_q31[i], &benchDst_q31[2u * i], &benchDst_q31[2u * i + 1u]);
+  }
+}
+
+#define PID_KP              0.5
+#define PID_KI              0.01
+#define PID_KD              0.05
+
+static arm_pid_instance_f32 pidF32;
+static arm_pid_instance_q31 pidQ31;
+
+/*
+ * @brief  y[n] = y[n-1] + A0 x[n] + A1 x[n-1] + A2 x[n-2] on benchInA.
+ */
+static void ref_pid(
+  uint32_t n)
+{
+  float64_t a0 = PID_KP + PID_KI + PID_KD, a1 = -PID_KP - 2.0 * PID_KD, a2 = PID_KD;
+  float64_t x1 = 0.0, x2 = 0.0, y = 0.0;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    y += a0 * benchInA[i] + a1 * x1 + a2 * x2;
+    x2 = x1;
+    x1 = benchInA[i];
+    benchRef[i] = y;
+  }
+}
+
+static uint32_t pid_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  ref_pid(n);
+
+  pidF32.Kp = (float32_t) PID_KP;
+  pidF32.Ki = (float32_t) PID_KI;
+  pidF32.Kd = (float32_t) PID_KD;
+
+  return (output(n, 1.0));
+}
+
+static void pid_f32_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_pid_init_f32(&pidF32, 1);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchDst_f32[i] = arm_pid_f32(&pidF32, benchSrcA_f32[i]);
+  }
+}
+
+static uint32_t pid_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 0.05, n);
+  ref_pid(n);
+
+  pidQ31.Kp = arm_bench_to_q31(PID_KP);
+  pidQ31.Ki = arm_bench_to_q31(PID_KI);
+  pidQ31.Kd = arm_bench_to_q31(PID_KD);
+
+  return (output(n, 1.0));
+}
+
+static void pid_q31_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_pid_init_q31(&pidQ31, 1);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchDst_q31[i] = arm_pid_q31(&pidQ31, benchSrcA_q31[i]);
+  }
+}
+
+#define KALMAN_MAX_STATES   16u
+#define KALMAN_MAX_MEAS     (KALMAN_MAX_STATES / 2u)
+#define KALMAN_SIZE         (KALMAN_MAX_STATES * KALMAN_MAX_STATES)
+
+static arm_kalman_instance_f32 kalmanF32;
+static arm_kalman_instance_q31 kalmanQ31;
+static float64_t kalmanF[KALMAN_SIZE], kalmanH[KALMAN_SIZE];
+static float64_t kalmanX[KALMAN_MAX_STATES], kalmanZ[KALMAN_MAX_MEAS];
+static float32_t kalmanMatF32[5u * KALMAN_SIZE];
+static float32_t kalmanVecF32[KALMAN_MAX_STATES + KALMAN_MAX_MEAS];
+static float32_t kalmanWorkF32[ARM_KALMAN_WORK_SIZE(KALMAN_MAX_STATES, KALMAN_MAX_MEAS)];
+static q31_t kalmanMatQ31[5u * KALMAN_SIZE];
+static q31_t kalmanVecQ31[KALMAN_MAX_STATES + KALMAN_MAX_MEAS];
+static q31_t kalmanWorkQ31[ARM_KALMAN_WORK_SIZE(KALMAN_MAX_STATES, KALMAN_MAX_MEAS)];
+
+#define KALMAN_Q            0.001
+#define KALMAN_R            0.01
+#define KALMAN_P0           0.1
+
+/*
+ * @brief  One predict and update step of a filter with n states and
+ *         n / 2 measurements, with x followed by P in benchRef.
+ */
+static void ref_kalman(
+  uint32_t n)
+{
+  static float64_t P[KALMAN_SIZE], T[KALMAN_SIZE], S[KALMAN_SIZE], K[KALMAN_SIZE];
+  float64_t x[KALMAN_MAX_STATES], y[KALMAN_MAX_MEAS], sum;
+  uint32_t m = n / 2u;
+  uint32_t i, j, k;
+
+  /* x = F * x, P = F * P0 * F' + Q */
+  for (i = 0u; i < n; i++)
+  {
+    sum = 0.0;
+
+    for (k = 0u; k < n; k++)
+    {
+      sum += kalmanF[i * n + k] * kalmanX[k];
+    }
+
+    x[i] = sum;
+  }
+
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      sum = (i == j) ? KALMAN_Q : 0.0;
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += KALMAN_P0 * kalmanF[i * n + k] * kalmanF[j * n + k];
+      }
+
+      P[i * n + j] = sum;
+    }
+  }
+
+  /* T = H * P, S = T * H' + R, y = z - H * x */
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      sum = 0.0;
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += kalmanH[i * n + k] * P[k * n + j];
+      }
+
+      T[i * n + j] = sum;
+    }
+  }
+
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < m; j++)
+    {
+      sum = (i == j) ? KALMAN_R : 0.0;
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += T[i * n + k] * kalmanH[j * n + k];
+      }
+
+      S[i * m + j] = sum;
+    }
+
+    sum = kalmanZ[i];
+
+    for (k = 0u; k < n; k++)
+    {
+      sum -= kalmanH[i * n + k] * x[k];
+    }
+
+    y[i] = sum;
+  }
+
+  /* S * K' = T */
+  memcpy(K, T, m * n * sizeof(float64_t));
+  ref_solve(S, K, m, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    sum = x[i];
+
+    for (k = 0u; k < m; k++)
+    {
+      sum += K[k * n + i] * y[k];
+    }
+
+    benchRef[i] = sum;
+
+    for (j = 0u; j < n; j++)
+    {
+      sum = P[i * n + j];
+
+      for (k = 0u; k < m; k++)
+      {
+        sum -= K[k * n + i] * T[k * n + j];
+      }
+
+      benchRef[n + i * n + j] = sum;
+    }
+  }
+}
+
+/*
+ * @brief  F close to the identity, H in [-0.5, 0.5), diagonal noise and
+ *         initial covariance, and x and z in [-0.1, 0.1).
+ */
+static void kalman_model(
+  uint32_t n)
+{
+  uint32_t m = n / 2u;
+  uint32_t i;
+
+  for (i = 0u; i < n * n; i++)
+  {
+    kalmanF[i] = ((i % (n + 1u)) == 0u ? 0.95 : 0.0) + arm_bench_random() * 0.1 / n;
+    kalmanH[i] = arm_bench_random() * 0.5;
+  }
+
+  for (i = 0u; i < n; i++)
+  {
+    kalmanX[i] = arm_bench_random() * 0.1;
+  }
+
+  for (i = 0u; i < m; i++)
+  {
+    kalmanZ[i] = arm_bench_random() * 0.1;
+  }
+
+  ref_kalman(n);
+}
+
+/*
+ * @brief  F, Q, H, R and P0 follow each other in kalmanMatF32, the initial
+ *         x and z in kalmanVecF32. The filter keeps x and P in benchDst_f32
+ *         so they are compared as one output.
+ */
+static uint32_t kalman_f32_prepare(
+  uint32_t n)
+{
+  float32_t *pMat = kalmanMatF32;
+  float32_t *pVec = kalmanVecF32;
+  uint32_t m = n / 2u;
+  uint32_t i;
+
+  kalman_model(n);
+
+  for (i = 0u; i < n * n; i++)
+  {
+    pMat[i] = (float32_t) kalmanF[i];
+    pMat[n * n + i] = ((i % (n + 1u)) == 0u) ? (float32_t) KALMAN_Q : 0.0f;
+    pMat[4u * n * n + i] = ((i % (n + 1u)) == 0u) ? (float32_t) KALMAN_P0 : 0.0f;
+  }
+
+  for (i = 0u; i < m * n; i++)
+  {
+    pMat[2u * n * n + i] = (float32_t) kalmanH[i];
+  }
+
+  for (i = 0u; i < m * m; i++)
+  {
+    pMat[3u * n * n + i] = ((i % (m + 1u)) == 0u) ? (float32_t) KALMAN_R : 0.0f;
+  }
+
+  for (i = 0u; i < n; i++)
+  {
+    pVec[i] = (float32_t) kalmanX[i];
+  }
+
+  for (i = 0u; i < m; i++)
+  {
+    pVec[n + i] = (float32_t) kalmanZ[i];
+  }
+
+  arm_kalman_init_f32(&kalmanF32, (uint16_t) n, (uint16_t) m, pMat, pMat + n * n,
+                      pMat + 2u * n * n, pMat + 3u * n * n, benchDst_f32, benchDst_f32 + n,
+                      kalmanWorkF32);
+
+  return (output(n + n * n, 1.0));
+}
+
+static void kalman_f32_run(
+  uint32_t n)
+{
+  /* The filter updates x and P in place, so each run starts again */
+  memcpy(benchDst_f32, kalmanVecF32, n * sizeof(float32_t));
+  memcpy(benchDst_f32 + n, kalmanMatF32 + 4u * n * n, n * n * sizeof(float32_t));
+
+  arm_kalman_predict_f32(&kalmanF32);
+  arm_kalman_update_f32(&kalmanF32, kalmanVecF32 + n);
+}
+
+/*
+ * @brief  F, Q, H, R and P0 follow each other in kalmanMatQ31, the initial
+ *         x and z in kalmanVecQ31. The filter keeps x and P in benchDst_q31
+ *         so they are compared as one output.
+ */
+static uint32_t kalman_q31_prepare(
+  uint32_t n)
+{
+  q31_t *pMat = kalmanMatQ31;
+  q31_t *pVec = kalmanVecQ31;
+  uint32_t m = n / 2u;
+  uint32_t i;
+
+  kalman_model(n);
+
+  for (i = 0u; i < n * n; i++)
+  {
+    pMat[i] = arm_bench_to_q31(kalmanF[i] / 2.0);
+    pMat[n * n + i] = ((i % (n + 1u)) == 0u) ? arm_bench_to_q31(KALMAN_Q) : 0;
+    pMat[4u * n * n + i] = ((i % (n + 1u)) == 0u) ? arm_bench_to_q31(KALMAN_P0) : 0;
+  }
+
+  for (i = 0u; i < m * n; i++)
+  {
+    pMat[2u * n * n + i] = arm_bench_to_q31(kalmanH[i] / 2.0);
+  }
+
+  for (i = 0u; i < m * m; i++)
+  {
+    pMat[3u * n * n + i] = ((i % (m + 1u)) == 0u) ? arm_bench_to_q31(KALMAN_R) : 0;
+  }
+
+  for (i = 0u; i < n; i++)
+  {
+    pVec[i] = arm_bench_to_q31(kalmanX[i]);
+  }
+
+  for (i = 0u; i < m; i++)
+  {
+    pVec[n + i] = arm_bench_to_q31(kalmanZ[i]);
+  }
+
+  arm_kalman_init_q31(&kalmanQ31, (uint16_t) n, (uint16_t) m, pMat, pMat + n * n,
+                      pMat + 2u * n * n, pMat + 3u * n * n, benchDst_q31, benchDst_q31 + n,
+                      kalmanWorkQ31, 1u);
+
+  return (output(n + n * n, 1.0));
+}
+
+static void kalman_q31_run(
+  uint32_t n)
+{
+  /* The filter updates x and P in place, so each run starts again */
+  memcpy(benchDst_q31, kalmanVecQ31, n * sizeof(q31_t));
+  memcpy(benchDst_q31 + n, kalmanMatQ31 + 4u * n * n, n * n * sizeof(q31_t));
+
+  arm_kalman_predict_q31(&kalmanQ31);
+  arm_kalman_update_q31(&kalmanQ31, kalmanVecQ31 + n);
+}
+
+/* ----------------------------------------------------------------------
+* Fast math
+* ------------------------------------------------------------------- */
+static uint32_t sin_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, PI, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = sin(benchInA[i]);
+  }
+
+  return (output(n, 1.0));
+}
+
+static void sin_f32_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchDst_f32[i] = arm_sin_f32(benchSrcA_f32[i]);
+  }
+}
+
+static uint32_t cos_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, PI, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = cos(benchInA[i]);
+  }
+
+  return (output(n, 1.0));
+}
+
+static void cos_f32_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchDst_f32[i] = arm_cos_f32(benchSrcA_f32[i]);
+  }
+}
+
+static uint32_t sin_q31_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  /* [0, 1) maps to [0, 2 pi) */
+  for (i = 0u; i < n; i++)
+  {
+    benchSrcA_q31[i] = arm_bench_to_q31(0.5 + 0.5 * arm_bench_random());
+    benchInA[i] = (float64_t) benchSrcA_q31[i] / 2147483648.0;
+    benchRef[i] = sin(2.0 * PI * benchInA[i]);
+  }
+
+  return (output(n, 1.0));
+}
+
+static void sin_q31_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchDst_q31[i] = arm_sin_q31(benchSrcA_q31[i]);
+  }
+}
+
+static uint32_t cos_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchSrcA_q15[i] = arm_bench_to_q15(0.5 + 0.5 * arm_bench_random());
+    benchInA[i] = (float64_t) benchSrcA_q15[i] / 32768.0;
+    benchRef[i] = cos(2.0 * PI * benchInA[i]);
+  }
+
+  return (output(n, 1.0));
+}
+
+static void cos_q15_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchDst_q15[i] = arm_cos_q15(benchSrcA_q15[i]);
+  }
+}
+
+static uint32_t sqrt_q31_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchSrcA_q31[i] = arm_bench_to_q31(0.5 + 0.5 * arm_bench_random());
+    benchInA[i] = (float64_t) benchSrcA_q31[i] / 2147483648.0;
+    benchRef[i] = sqrt(benchInA[i]);
+  }
+
+  return (output(n, 1.0));
+}
+
+static void sqrt_q31_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    arm_sqrt_q31(benchSrcA_q31[i], &benchDst_q31[i]);
+  }
+}
+
+static uint32_t sqrt_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchSrcA_q15[i] = arm_bench_to_q15(0.5 + 0.5 * arm_bench_random());
+    benchInA[i] = (float64_t) benchSrcA_q15[i] / 32768.0;
+    benchRef[i] = sqrt(benchInA[i]);
+  }
+
+  return (output(n, 1.0));
+}
+
+static void sqrt_q15_run(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    arm_sqrt_q15(benchSrcA_q15[i], &benchDst_q15[i]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Filtering. The instances are set up in prepare so the accuracy run
+* starts from a cleared state, the timed runs carry the state on.
+* ------------------------------------------------------------------- */
+static float32_t stateF32[BENCH_MAX_VALUES + FIR_TAPS];
+static q31_t stateQ31[BENCH_MAX_VALUES + FIR_TAPS];
+static q15_t stateQ15[BENCH_MAX_VALUES + FIR_TAPS];
+static q7_t stateQ7[BENCH_MAX_VALUES + FIR_TAPS];
+static q63_t stateQ63[4u * BIQUAD_CHANNELS * BIQUAD_STAGES];
+
+static float32_t coeffsF32[FIR_TAPS];
+static q31_t coeffsQ31[FIR_TAPS];
+static q15_t coeffsQ15[FIR_TAPS];
+static q7_t coeffsQ7[FIR_TAPS];
+
+static arm_fir_instance_f32 firF32;
+static arm_fir_instance_q31 firQ31;
+static arm_fir_instance_q15 firQ15;
+static arm_fir_instance_q7 firQ7;
+
+/*
+ * @brief  Quantizes firCoeffs to the coefficient arrays, replaces firCoeffs
+ *         by the value of the coefficients of the given type.
+ */
+static void fir_quantize(
+  char type)
+{
+  uint32_t i;
+
+  for (i = 0u; i < FIR_TAPS; i++)
+  {
+    switch (type)
+    {
+    case 'f':
+      coeffsF32[i] = (float32_t) firCoeffs[i];
+      firCoeffs[i] = coeffsF32[i];
+      break;
+    case 'l':
+      coeffsQ31[i] = arm_bench_to_q31(firCoeffs[i]);
+      firCoeffs[i] = (float64_t) coeffsQ31[i] / 2147483648.0;
+      break;
+    case 's':
+      coeffsQ15[i] = arm_bench_to_q15(firCoeffs[i]);
+      firCoeffs[i] = (float64_t) coeffsQ15[i] / 32768.0;
+      break;
+    default:
+      coeffsQ7[i] = arm_bench_to_q7(firCoeffs[i]);
+      firCoeffs[i] = (float64_t) coeffsQ7[i] / 128.0;
+      break;
+    }
+  }
+}
+
+static uint32_t fir_f32_prepare(
+  uint32_t n)
+{
+  design_fir(0.2);
+  fir_quantize('f');
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  ref_fir(firCoeffs, FIR_TAPS, benchInA, benchRef, n);
+  arm_fir_init_f32(&firF32, FIR_TAPS, coeffsF32, stateF32, n);
+
+  return (output(n, 1.0));
+}
+
+static void fir_f32_run(
+  uint32_t n)
+{
+  arm_fir_f32(&firF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t fir_q31_prepare(
+  uint32_t n)
+{
+  design_fir(0.2);
+  fir_quantize('l');
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 0.5, n);
+  ref_fir(firCoeffs, FIR_TAPS, benchInA, benchRef, n);
+  arm_fir_init_q31(&firQ31, FIR_TAPS, coeffsQ31, stateQ31, n);
+
+  return (output(n, 1.0));
+}
+
+static void fir_q31_run(
+  uint32_t n)
+{
+  arm_fir_q31(&firQ31, benchSrcA_q31, benchDst_q31, n);
+}
+
+static void fir_fast_q31_run(
+  uint32_t n)
+{
+  arm_fir_fast_q31(&firQ31, benchSrcA_q31, benchDst_q31, n);
+}
+
+static uint32_t fir_q15_prepare(
+  uint32_t n)
+{
+  design_fir(0.2);
+  fir_quantize('s');
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n);
+  ref_fir(firCoeffs, FIR_TAPS, benchInA, benchRef, n);
+  arm_fir_init_q15(&firQ15, FIR_TAPS, coeffsQ15, stateQ15, n);
+
+  return (output(n, 1.0));
+}
+
+static void fir_q15_run(
+  uint32_t n)
+{
+  arm_fir_q15(&firQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+static void fir_fast_q15_run(
+  uint32_t n)
+{
+  arm_fir_fast_q15(&firQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+static uint32_t fir_q7_prepare(
+  uint32_t n)
+{
+  design_fir(0.2);
+  fir_quantize('b');
+  arm_bench_random_q7(benchSrcA_q7, benchInA, 0.5, n);
+  ref_fir(firCoeffs, FIR_TAPS, benchInA, benchRef, n);
+  arm_fir_init_q7(&firQ7, FIR_TAPS, coeffsQ7, stateQ7, n);
+
+  return (output(n, 1.0));
+}
+
+static void fir_q7_run(
+  uint32_t n)
+{
+  arm_fir_q7(&firQ7, benchSrcA_q7, benchDst_q7, n);
+}
+
+static float64_t firFftCoeffs[FIR_FFT_TAPS];
+static float32_t firFftStateF32[BENCH_MAX_VALUES + FIR_FFT_TAPS];
+static float32_t firFftF32[(FIR_FFT_PARTS + 3u) * 2u * FIR_FFT_PART];
+static q31_t firFftQ31[(FIR_FFT_PARTS + 3u) * 2u * FIR_FFT_PART];
+static q31_t firFftQ15[(FIR_FFT_PARTS + 3u) * 2u * FIR_FFT_PART];
+static float32_t firFftSpectraF32[FIR_FFT_PARTS * 2u * FIR_FFT_PART];
+static q31_t firFftSpectraQ31[FIR_FFT_PARTS * 2u * FIR_FFT_PART];
+static q31_t firFftSpectraQ15[FIR_FFT_PARTS * 2u * FIR_FFT_PART];
+static float32_t firFftCoeffsF32[FIR_FFT_TAPS];
+static q31_t firFftCoeffsQ31[FIR_FFT_TAPS];
+static q15_t firFftCoeffsQ15[FIR_FFT_TAPS];
+
+static arm_fir_instance_f32 firLongF32;
+static arm_fir_fft_instance_f32 firFftInstF32;
+static arm_fir_fft_instance_q31 firFftInstQ31;
+static arm_fir_fft_instance_q15 firFftInstQ15;
+
+/*
+ * @brief  Long filter in the manner of a room response, a decaying random
+ *         impulse response, quantized to the coefficient arrays in the time
+ *         reversed order the library uses. firFftCoeffs gets the value of
+ *         the coefficients of the given type, in natural order.
+ */
+static void design_fir_fft(
+  char type)
+{
+  float64_t energy = 0.0, scale;
+  uint32_t i;
+
+  for (i = 0u; i < FIR_FFT_TAPS; i++)
+  {
+    firFftCoeffs[i] = arm_bench_random() * exp(-4.0 * i / FIR_FFT_TAPS);
+    energy += firFftCoeffs[i] * firFftCoeffs[i];
+  }
+
+  scale = 0.5 / sqrt(energy);
+
+  for (i = 0u; i < FIR_FFT_TAPS; i++)
+  {
+    firFftCoeffs[i] *= scale;
+
+    switch (type)
+    {
+    case 'f':
+      firFftCoeffsF32[FIR_FFT_TAPS - 1u - i] = (float32_t) firFftCoeffs[i];
+      firFftCoeffs[i] = firFftCoeffsF32[FIR_FFT_TAPS - 1u - i];
+      break;
+    case 'l':
+      firFftCoeffsQ31[FIR_FFT_TAPS - 1u - i] = arm_bench_to_q31(firFftCoeffs[i]);
+      firFftCoeffs[i] = (float64_t) firFftCoeffsQ31[FIR_FFT_TAPS - 1u - i] / 2147483648.0;
+      break;
+    default:
+      firFftCoeffsQ15[FIR_FFT_TAPS - 1u - i] = arm_bench_to_q15(firFftCoeffs[i]);
+      firFftCoeffs[i] = (float64_t) firFftCoeffsQ15[FIR_FFT_TAPS - 1u - i] / 32768.0;
+      break;
+    }
+  }
+}
+
+/*
+ * @brief  Direct form filter with the taps of the FFT FIR cases, to compare
+ *         their speed with.
+ */
+static uint32_t fir_long_f32_prepare(
+  uint32_t n)
+{
+  design_fir_fft('f');
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  ref_fir(firFftCoeffs, FIR_FFT_TAPS, benchInA, benchRef, n);
+  arm_fir_init_f32(&firLongF32, FIR_FFT_TAPS, firFftCoeffsF32, firFftStateF32, n);
+
+  return (output(n, 1.0));
+}
+
+static void fir_long_f32_run(
+  uint32_t n)
+{
+  arm_fir_f32(&firLongF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t fir_fft_f32_prepare(
+  uint32_t n)
+{
+  design_fir_fft('f');
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  ref_fir(firFftCoeffs, FIR_FFT_TAPS, benchInA, benchRef, n);
+  arm_fir_fft_init_f32(&firFftInstF32, FIR_FFT_TAPS, firFftCoeffsF32, FIR_FFT_PART, firFftSpectraF32, firFftF32);
+
+  return (output(n, 1.0));
+}
+
+static void fir_fft_f32_run(
+  uint32_t n)
+{
+  arm_fir_fft_f32(&firFftInstF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t fir_fft_q31_prepare(
+  uint32_t n)
+{
+  design_fir_fft('l');
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 0.5, n);
+  ref_fir(firFftCoeffs, FIR_FFT_TAPS, benchInA, benchRef, n);
+  arm_fir_fft_init_q31(&firFftInstQ31, FIR_FFT_TAPS, firFftCoeffsQ31, FIR_FFT_PART, firFftSpectraQ31, firFftQ31);
+
+  return (output(n, 1.0));
+}
+
+static void fir_fft_q31_run(
+  uint32_t n)
+{
+  arm_fir_fft_q31(&firFftInstQ31, benchSrcA_q31, benchDst_q31, n);
+}
+
+static uint32_t fir_fft_q15_prepare(
+  uint32_t n)
+{
+  design_fir_fft('s');
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n);
+  ref_fir(firFftCoeffs, FIR_FFT_TAPS, benchInA, benchRef, n);
+  arm_fir_fft_init_q15(&firFftInstQ15, FIR_FFT_TAPS, firFftCoeffsQ15, FIR_FFT_PART, firFftSpectraQ15, firFftQ15);
+
+  return (output(n, 1.0));
+}
+
+static void fir_fft_q15_run(
+  uint32_t n)
+{
+  arm_fir_fft_q15(&firFftInstQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+static arm_fir_decimate_instance_f32 decimateF32;
+static arm_fir_decimate_instance_q15 decimateQ15;
+static arm_fir_interpolate_instance_f32 interpolateF32;
+
+/*
+ * @brief  Keeps every Mth output of the full rate FIR in benchRef, the
+ *         one at the first of each group of M input samples.
+ */
+static uint32_t decimate_ref(
+  uint32_t n)
+{
+  uint32_t i;
+
+  ref_fir(firCoeffs, FIR_TAPS, benchInA, benchOut, n);
+
+  for (i = 0u; i < n / MULTIRATE_FACTOR; i++)
+  {
+    benchRef[i] = benchOut[i * MULTIRATE_FACTOR];
+  }
+
+  return (n / MULTIRATE_FACTOR);
+}
+
+static uint32_t fir_decimate_f32_prepare(
+  uint32_t n)
+{
+  design_fir(0.5 / MULTIRATE_FACTOR);
+  fir_quantize('f');
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  arm_fir_decimate_init_f32(&decimateF32, FIR_TAPS, MULTIRATE_FACTOR, coeffsF32, stateF32, n);
+
+  return (output(decimate_ref(n), 1.0));
+}
+
+static void fir_decimate_f32_run(
+  uint32_t n)
+{
+  arm_fir_decimate_f32(&decimateF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t fir_decimate_q15_prepare(
+  uint32_t n)
+{
+  design_fir(0.5 / MULTIRATE_FACTOR);
+  fir_quantize('s');
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n);
+  arm_fir_decimate_init_q15(&decimateQ15, FIR_TAPS, MULTIRATE_FACTOR, coeffsQ15, stateQ15, n);
+
+  return (output(decimate_ref(n), 1.0));
+}
+
+static void fir_decimate_q15_run(
+  uint32_t n)
+{
+  arm_fir_decimate_q15(&decimateQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+static uint32_t fir_interpolate_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  /* Zero stuffed input through the FIR */
+  design_fir(0.5 / MULTIRATE_FACTOR);
+  fir_quantize('f');
+  arm_bench_random_f32(benchSrcA_f32, benchInB, 0.5, n);
+  memset(benchInA, 0, n * MULTIRATE_FACTOR * sizeof(float64_t));
+
+  for (i = 0u; i < n; i++)
+  {
+    benchInA[i * MULTIRATE_FACTOR] = benchInB[i];
+  }
+
+  ref_fir(firCoeffs, FIR_TAPS, benchInA, benchRef, n * MULTIRATE_FACTOR);
+  arm_fir_interpolate_init_f32(&interpolateF32, MULTIRATE_FACTOR, FIR_TAPS, coeffsF32, stateF32, n);
+
+  return (output(n * MULTIRATE_FACTOR, 1.0));
+}
+
+static void fir_interpolate_f32_run(
+  uint32_t n)
+{
+  arm_fir_interpolate_f32(&interpolateF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static float64_t resampleCoeffs[RESAMPLE_TAPS];
+static float32_t resampleCoeffsF32[RESAMPLE_TAPS];
+static q15_t resampleCoeffsQ15[RESAMPLE_TAPS];
+static arm_fir_resample_instance_f32 resampleF32;
+static arm_fir_resample_instance_q15 resampleQ15;
+
+/* Cubic Lagrange interpolator, in the order the library stores it */
+static const float64_t farrowCubic[(FARROW_ORDER + 1u) * FARROW_TAPS] =
+{
+  0.0, 1.0, 0.0, 0.0,
+  -1.0 / 3.0, -0.5, 1.0, -1.0 / 6.0,
+  0.5, -1.0, 0.5, 0.0,
+  -1.0 / 6.0, 0.5, -0.5, 1.0 / 6.0
+};
+
+static float64_t farrowCoeffs[(FARROW_ORDER + 1u) * FARROW_TAPS];
+static float32_t farrowCoeffsF32[(FARROW_ORDER + 1u) * FARROW_TAPS];
+static q15_t farrowCoeffsQ15[(FARROW_ORDER + 1u) * FARROW_TAPS];
+static arm_fir_farrow_instance_f32 farrowF32;
+static arm_fir_farrow_instance_q15 farrowQ15;
+
+/*
+ * @brief  44.1 kHz to 16 kHz low pass, Hamming windowed with the gain of
+ *         the upsample factor, quantized to the coefficient arrays in time
+ *         reversed order. resampleCoeffs gets the value of the
+ *         coefficients of the given type, in natural order.
+ */
+static void design_resample(
+  char type)
+{
+  float64_t cutoff = 0.5 / RESAMPLE_M, t;
+  uint32_t i;
+
+  for (i = 0u; i < RESAMPLE_TAPS; i++)
+  {
+    t = (float64_t) i - (RESAMPLE_TAPS - 1u) / 2.0;
+    resampleCoeffs[i] = (t == 0.0) ? 2.0 * cutoff : sin(2.0 * PI * cutoff * t) / (PI * t);
+    resampleCoeffs[i] *= RESAMPLE_L * (0.54 - 0.46 * cos(2.0 * PI * i / (RESAMPLE_TAPS - 1u)));
+
+    if(type == 'f')
+    {
+      resampleCoeffsF32[RESAMPLE_TAPS - 1u - i] = (float32_t) resampleCoeffs[i];
+      resampleCoeffs[i] = resampleCoeffsF32[RESAMPLE_TAPS - 1u - i];
+    }
+    else
+    {
+      resampleCoeffsQ15[RESAMPLE_TAPS - 1u - i] = arm_bench_to_q15(resampleCoeffs[i]);
+      resampleCoeffs[i] = (float64_t) resampleCoeffsQ15[RESAMPLE_TAPS - 1u - i] / 32768.0;
+    }
+  }
+}
+
+/*
+ * @brief  Output j of the rational resampler is sample j*M of the
+ *         upsampled and filtered input.
+ */
+static uint32_t ref_resample(
+  uint32_t n)
+{
+  float64_t acc;
+  uint32_t j, i, p, k;
+
+  for (j = 0u; (j * RESAMPLE_M) / RESAMPLE_L < n; j++)
+  {
+    i = (j * RESAMPLE_M) / RESAMPLE_L;
+    p = (j * RESAMPLE_M) % RESAMPLE_L;
+    acc = 0.0;
+
+    for (k = 0u; (p + k * RESAMPLE_L < RESAMPLE_TAPS) && (k <= i); k++)
+    {
+      acc += resampleCoeffs[p + k * RESAMPLE_L] * benchInA[i - k];
+    }
+
+    benchRef[j] = acc;
+  }
+
+  return (j);
+}
+
+static uint32_t fir_resample_f32_prepare(
+  uint32_t n)
+{
+  design_resample('f');
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  arm_fir_resample_init_f32(&resampleF32, RESAMPLE_L, RESAMPLE_M, RESAMPLE_TAPS, resampleCoeffsF32, stateF32, n);
+
+  return (output(ref_resample(n), 1.0));
+}
+
+static void fir_resample_f32_run(
+  uint32_t n)
+{
+  arm_fir_resample_f32(&resampleF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t fir_resample_q15_prepare(
+  uint32_t n)
+{
+  design_resample('s');
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n);
+  arm_fir_resample_init_q15(&resampleQ15, RESAMPLE_L, RESAMPLE_M, RESAMPLE_TAPS, resampleCoeffsQ15, stateQ15, n);
+
+  return (output(ref_resample(n), 1.0));
+}
+
+static void fir_resample_q15_run(
+  uint32_t n)
+{
+  arm_fir_resample_q15(&resampleQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+/*
+ * @brief  Farrow resampler at the positions j*step, with the fractional
+ *         position quantized to fracBits bits.
+ */
+static uint32_t ref_farrow(
+  uint32_t n,
+  uint32_t fracBits)
+{
+  float64_t mu, v, acc;
+  uint64_t pos;
+  uint32_t j, i, k, m;
+  int32_t idx;
+
+  for (j = 0u; ((uint64_t) j * FARROW_STEP >> 24u) < n; j++)
+  {
+    pos = (uint64_t) j * FARROW_STEP;
+    i = (uint32_t) (pos >> 24u);
+    mu = (float64_t) ((uint32_t) (pos & 0x00FFFFFFu) >> (24u - fracBits)) / (float64_t) (1u << fracBits);
+    acc = 0.0;
+
+    for (m = FARROW_ORDER + 1u; m > 0u; m--)
+    {
+      v = 0.0;
+
+      for (k = 0u; k < FARROW_TAPS; k++)
+      {
+        idx = (int32_t) i - (int32_t) (FARROW_TAPS - 1u) + (int32_t) k;
+        v += (idx < 0) ? 0.0 : farrowCoeffs[(m - 1u) * FARROW_TAPS + k] * benchInA[idx];
+      }
+
+      acc = acc * mu + v;
+    }
+
+    benchRef[j] = acc;
+  }
+
+  return (j);
+}
+
+static uint32_t fir_farrow_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < (FARROW_ORDER + 1u) * FARROW_TAPS; i++)
+  {
+    farrowCoeffsF32[i] = (float32_t) farrowCubic[i];
+    farrowCoeffs[i] = farrowCoeffsF32[i];
+  }
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  arm_fir_farrow_init_f32(&farrowF32, FARROW_TAPS, FARROW_ORDER, farrowCoeffsF32, FARROW_STEP, stateF32, n);
+
+  return (output(ref_farrow(n, 24u), 1.0));
+}
+
+static void fir_farrow_f32_run(
+  uint32_t n)
+{
+  arm_fir_farrow_f32(&farrowF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t fir_farrow_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  /* The coefficients reach 1, so they are scaled down by postShift = 1 */
+  for (i = 0u; i < (FARROW_ORDER + 1u) * FARROW_TAPS; i++)
+  {
+    farrowCoeffsQ15[i] = arm_bench_to_q15(farrowCubic[i] / 2.0);
+    farrowCoeffs[i] = (float64_t) farrowCoeffsQ15[i] / 16384.0;
+  }
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n);
+  arm_fir_farrow_init_q15(&farrowQ15, FARROW_TAPS, FARROW_ORDER, farrowCoeffsQ15, 1, FARROW_STEP, stateQ15, n);
+
+  return (output(ref_farrow(n, 15u), 1.0));
+}
+
+static void fir_farrow_q15_run(
+  uint32_t n)
+{
+  arm_fir_farrow_q15(&farrowQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+static arm_biquad_casd_df1_inst_f32 biquadF32;
+static arm_biquad_cascade_df2T_instance_f32 biquadDf2TF32;
+static arm_biquad_casd_df1_inst_q31 biquadQ31;
+static arm_biquad_cas_df1_32x64_ins_q31 biquad32x64Q31;
+static arm_biquad_casd_df1_inst_q15 biquadQ15;
+static arm_biquad_cascade_df2T_instance_q31 biquadDf2TQ31;
+static arm_biquad_cascade_df2T_instance_q15 biquadDf2TQ15;
+static arm_biquad_cascade_mc_df2T_instance_f32 biquadMcF32;
+static arm_biquad_cascade_mc_df2T_instance_q31 biquadMcQ31;
+static arm_biquad_cascade_mc_df2T_instance_q15 biquadMcQ15;
+static float32_t biquadCoeffsF32[5u * BIQUAD_STAGES];
+static q31_t biquadCoeffsQ31[5u * BIQUAD_STAGES];
+static q15_t biquadCoeffsQ15[6u * BIQUAD_STAGES];
+
+/*
+ * @brief  Input of numChannels interleaved channels of n samples each.
+ */
+static uint32_t biquad_f32_prepare(
+  uint32_t n,
+  uint32_t numChannels)
+{
+  uint32_t i;
+
+  design_biquad();
+
+  for (i = 0u; i < 5u * BIQUAD_STAGES; i++)
+  {
+    biquadCoeffsF32[i] = (float32_t) biquadCoeffs[i];
+    biquadCoeffs[i] = biquadCoeffsF32[i];
+  }
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n * numChannels);
+  ref_biquad(biquadCoeffs, n, numChannels);
+
+  return (output(n * numChannels, 1.0));
+}
+
+static void biquad_cascade_df1_f32_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_df1_f32(&biquadF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t biquad_cascade_df1_f32_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_f32_prepare(n, 1u);
+
+  arm_biquad_cascade_df1_init_f32(&biquadF32, BIQUAD_STAGES, biquadCoeffsF32, stateF32);
+
+  return (count);
+}
+
+static uint32_t biquad_cascade_df2T_f32_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_f32_prepare(n, 1u);
+
+  arm_biquad_cascade_df2T_init_f32(&biquadDf2TF32, BIQUAD_STAGES, biquadCoeffsF32, stateF32);
+
+  return (count);
+}
+
+static void biquad_cascade_df2T_f32_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_df2T_f32(&biquadDf2TF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+static uint32_t biquad_cascade_mc_df2T_f32_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_f32_prepare(n, BIQUAD_CHANNELS);
+
+  arm_biquad_cascade_mc_df2T_init_f32(&biquadMcF32, BIQUAD_STAGES, BIQUAD_CHANNELS, biquadCoeffsF32, stateF32);
+
+  return (count);
+}
+
+static void biquad_cascade_mc_df2T_f32_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_mc_df2T_f32(&biquadMcF32, benchSrcA_f32, benchDst_f32, n);
+}
+
+/*
+ * @brief  Coefficients halved for a post shift of 1, as the feedback
+ *         coefficients are above 1.
+ */
+static uint32_t biquad_q31_prepare(
+  uint32_t n,
+  uint32_t numChannels)
+{
+  uint32_t i;
+
+  design_biquad();
+
+  for (i = 0u; i < 5u * BIQUAD_STAGES; i++)
+  {
+    biquadCoeffsQ31[i] = arm_bench_to_q31(biquadCoeffs[i] / 2.0);
+    biquadCoeffs[i] = 2.0 * biquadCoeffsQ31[i] / 2147483648.0;
+  }
+
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 0.5, n * numChannels);
+  ref_biquad(biquadCoeffs, n, numChannels);
+
+  return (output(n * numChannels, 1.0));
+}
+
+static uint32_t biquad_cascade_df1_q31_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_q31_prepare(n, 1u);
+
+  arm_biquad_cascade_df1_init_q31(&biquadQ31, BIQUAD_STAGES, biquadCoeffsQ31, stateQ31, 1);
+
+  return (count);
+}
+
+static void biquad_cascade_df1_q31_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_df1_q31(&biquadQ31, benchSrcA_q31, benchDst_q31, n);
+}
+
+static void biquad_cascade_df1_fast_q31_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_df1_fast_q31(&biquadQ31, benchSrcA_q31, benchDst_q31, n);
+}
+
+static uint32_t biquad_cas_df1_32x64_q31_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_q31_prepare(n, 1u);
+
+  arm_biquad_cas_df1_32x64_init_q31(&biquad32x64Q31, BIQUAD_STAGES, biquadCoeffsQ31, stateQ63, 1);
+
+  return (count);
+}
+
+static void biquad_cas_df1_32x64_q31_run(
+  uint32_t n)
+{
+  arm_biquad_cas_df1_32x64_q31(&biquad32x64Q31, benchSrcA_q31, benchDst_q31, n);
+}
+
+static uint32_t biquad_cascade_df2T_q31_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_q31_prepare(n, 1u);
+
+  arm_biquad_cascade_df2T_init_q31(&biquadDf2TQ31, BIQUAD_STAGES, biquadCoeffsQ31, stateQ63, 1);
+
+  return (count);
+}
+
+static void biquad_cascade_df2T_q31_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_df2T_q31(&biquadDf2TQ31, benchSrcA_q31, benchDst_q31, n);
+}
+
+static uint32_t biquad_cascade_mc_df2T_q31_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_q31_prepare(n, BIQUAD_CHANNELS);
+
+  arm_biquad_cascade_mc_df2T_init_q31(&biquadMcQ31, BIQUAD_STAGES, BIQUAD_CHANNELS, biquadCoeffsQ31, stateQ63, 1);
+
+  return (count);
+}
+
+static void biquad_cascade_mc_df2T_q31_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_mc_df2T_q31(&biquadMcQ31, benchSrcA_q31, benchDst_q31, n);
+}
+
+/*
+ * @brief  Q15 coefficients are {b0, 0, b1, b2, a1, a2} per stage.
+ */
+static uint32_t biquad_q15_prepare(
+  uint32_t n,
+  uint32_t numChannels)
+{
+  uint32_t i, s;
+
+  design_biquad();
+
+  for (s = 0u; s < BIQUAD_STAGES; s++)
+  {
+    for (i = 0u; i < 5u; i++)
+    {
+      biquadCoeffsQ15[6u * s + i + ((i > 0u) ? 1u : 0u)] = arm_bench_to_q15(biquadCoeffs[5u * s + i] / 2.0);
+      biquadCoeffs[5u * s + i] = 2.0 * biquadCoeffsQ15[6u * s + i + ((i > 0u) ? 1u : 0u)] / 32768.0;
+    }
+
+    biquadCoeffsQ15[6u * s + 1u] = 0;
+  }
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n * numChannels);
+  ref_biquad(biquadCoeffs, n, numChannels);
+
+  return (output(n * numChannels, 1.0));
+}
+
+static uint32_t biquad_cascade_df1_q15_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_q15_prepare(n, 1u);
+
+  arm_biquad_cascade_df1_init_q15(&biquadQ15, BIQUAD_STAGES, biquadCoeffsQ15, stateQ15, 1);
+
+  return (count);
+}
+
+static void biquad_cascade_df1_q15_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_df1_q15(&biquadQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+static void biquad_cascade_df1_fast_q15_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_df1_fast_q15(&biquadQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+static uint32_t biquad_cascade_df2T_q15_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_q15_prepare(n, 1u);
+
+  arm_biquad_cascade_df2T_init_q15(&biquadDf2TQ15, BIQUAD_STAGES, biquadCoeffsQ15, stateQ63, 1);
+
+  return (count);
+}
+
+static void biquad_cascade_df2T_q15_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_df2T_q15(&biquadDf2TQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+static uint32_t biquad_cascade_mc_df2T_q15_prepare(
+  uint32_t n)
+{
+  uint32_t count = biquad_q15_prepare(n, BIQUAD_CHANNELS);
+
+  arm_biquad_cascade_mc_df2T_init_q15(&biquadMcQ15, BIQUAD_STAGES, BIQUAD_CHANNELS, biquadCoeffsQ15, stateQ63, 1);
+
+  return (count);
+}
+
+static void biquad_cascade_mc_df2T_q15_run(
+  uint32_t n)
+{
+  arm_biquad_cascade_mc_df2T_q15(&biquadMcQ15, benchSrcA_q15, benchDst_q15, n);
+}
+
+/* Convolutions of the block with a CONV_LENGTH sample sequence */
+static q15_t convScratch1[BENCH_MAX_VALUES + 2u * CONV_LENGTH];
+static q15_t convScratch2[CONV_LENGTH];
+
+static uint32_t conv_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 1.0, CONV_LENGTH);
+  ref_conv(benchInA, n, benchInB, CONV_LENGTH, benchRef);
+
+  return (output(n + CONV_LENGTH - 1u, 1.0));
+}
+
+static void conv_f32_run(
+  uint32_t n)
+{
+  arm_conv_f32(benchSrcA_f32, n, benchSrcB_f32, CONV_LENGTH, benchDst_f32);
+}
+
+static uint32_t conv_q31_prepare(
+  uint32_t n)
+{
+  /* Scaled down by log2(CONV_LENGTH) bits against overflow */
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+  arm_bench_random_q31(benchSrcB_q31, benchInB, 1.0 / CONV_LENGTH, CONV_LENGTH);
+  ref_conv(benchInA, n, benchInB, CONV_LENGTH, benchRef);
+
+  return (output(n + CONV_LENGTH - 1u, 1.0));
+}
+
+static void conv_q31_run(
+  uint32_t n)
+{
+  arm_conv_q31(benchSrcA_q31, n, benchSrcB_q31, CONV_LENGTH, benchDst_q31);
+}
+
+static void conv_fast_q31_run(
+  uint32_t n)
+{
+  arm_conv_fast_q31(benchSrcA_q31, n, benchSrcB_q31, CONV_LENGTH, benchDst_q31);
+}
+
+static uint32_t conv_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+  arm_bench_random_q15(benchSrcB_q15, benchInB, 1.0 / CONV_LENGTH, CONV_LENGTH);
+  ref_conv(benchInA, n, benchInB, CONV_LENGTH, benchRef);
+
+  return (output(n + CONV_LENGTH - 1u, 1.0));
+}
+
+static void conv_q15_run(
+  uint32_t n)
+{
+  arm_conv_q15(benchSrcA_q15, n, benchSrcB_q15, CONV_LENGTH, benchDst_q15);
+}
+
+static void conv_fast_q15_run(
+  uint32_t n)
+{
+  arm_conv_fast_q15(benchSrcA_q15, n, benchSrcB_q15, CONV_LENGTH, benchDst_q15);
+}
+
+static void conv_opt_q15_run(
+  uint32_t n)
+{
+  arm_conv_opt_q15(benchSrcA_q15, n, benchSrcB_q15, CONV_LENGTH, benchDst_q15, convScratch1, convScratch2);
+}
+
+static uint32_t conv_q7_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q7(benchSrcA_q7, benchInA, 1.0, n);
+  arm_bench_random_q7(benchSrcB_q7, benchInB, 1.0 / CONV_LENGTH, CONV_LENGTH);
+  ref_conv(benchInA, n, benchInB, CONV_LENGTH, benchRef);
+
+  return (output(n + CONV_LENGTH - 1u, 1.0));
+}
+
+static void conv_q7_run(
+  uint32_t n)
+{
+  arm_conv_q7(benchSrcA_q7, n, benchSrcB_q7, CONV_LENGTH, benchDst_q7);
+}
+
+/*
+ * @brief  Correlation of the block with a CONV_LENGTH sample sequence,
+ *         c[k] = sum of a[n] b[n - k + N - 1] for k = 0 .. 2N - 2.
+ */
+static uint32_t correlate_f32_prepare(
+  uint32_t n)
+{
+  uint32_t k, i;
+  int32_t j;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 1.0, CONV_LENGTH);
+
+  for (k = 0u; k < 2u * n - 1u; k++)
+  {
+    benchRef[k] = 0.0;
+
+    for (i = 0u; i < n; i++)
+    {
+      j = (int32_t) i - (int32_t) k + (int32_t) n - 1;
+
+      if(j >= 0 && j < (int32_t) CONV_LENGTH)
+      {
+        benchRef[k] += benchInA[i] * benchInB[j];
+      }
+    }
+  }
+
+  return (output(2u * n - 1u, 1.0));
+}
+
+static void correlate_f32_run(
+  uint32_t n)
+{
+  memset(benchDst_f32, 0, (2u * n - 1u) * sizeof(float32_t));
+  arm_correlate_f32(benchSrcA_f32, n, benchSrcB_f32, CONV_LENGTH, benchDst_f32);
+}
+
+static arm_lms_instance_f32 lmsF32;
+static float32_t lmsErrF32[BENCH_MAX_VALUES];
+
+/*
+ * @brief  Identifies the FIR low pass from its noisy output, the output
+ *         compared is the filter output of the adaptive filter.
+ */
+static uint32_t lms_f32_prepare(
+  uint32_t n)
+{
+  float64_t w[LMS_TAPS], y, e, mu = 0.05;
+  uint32_t i, k;
+
+  design_fir(0.2);
+  fir_quantize('f');
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  ref_fir(firCoeffs, LMS_TAPS, benchInA, benchInB, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchSrcB_f32[i] = (float32_t) benchInB[i];
+    benchInB[i] = benchSrcB_f32[i];
+  }
+
+  memset(w, 0, sizeof(w));
+  memset(coeffsF32, 0, sizeof(coeffsF32));
+
+  for (i = 0u; i < n; i++)
+  {
+    y = 0.0;
+
+    for (k = 0u; k < LMS_TAPS && k <= i; k++)
+    {
+      y += w[k] * benchInA[i - k];
+    }
+
+    e = benchInB[i] - y;
+
+    for (k = 0u; k < LMS_TAPS && k <= i; k++)
+    {
+      w[k] += mu * e * benchInA[i - k];
+    }
+
+    benchRef[i] = y;
+  }
+
+  arm_lms_init_f32(&lmsF32, LMS_TAPS, coeffsF32, stateF32, (float32_t) mu, n);
+
+  return (output(n, 1.0));
+}
+
+static void lms_f32_run(
+  uint32_t n)
+{
+  arm_lms_f32(&lmsF32, benchSrcA_f32, benchSrcB_f32, benchDst_f32, lmsErrF32, n);
+}
+
+/* ----------------------------------------------------------------------
+* Matrix, block sizes in elements of square matrices
+* ------------------------------------------------------------------- */
+static arm_matrix_instance_f32 matAF32, matBF32, matDstF32;
+static arm_matrix_instance_q31 matAQ31, matBQ31, matDstQ31;
+static arm_matrix_instance_q15 matAQ15, matBQ15, matDstQ15;
+static q15_t matStateQ15[BENCH_MAX_VALUES];
+static float32_t matWorkF32[BENCH_MAX_VALUES];
+
+static uint16_t mat_dim(
+  uint32_t n)
+{
+  return ((uint16_t) (sqrt((float64_t) n) + 0.5));
+}
+
+/*
+ * @brief  Reference of the product of the matrices in benchInA and benchInB.
+ */
+static uint32_t mat_mult_ref(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  uint32_t r, c, k;
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < dim; c++)
+    {
+      benchRef[r * dim + c] = 0.0;
+
+      for (k = 0u; k < dim; k++)
+      {
+        benchRef[r * dim + c] += benchInA[r * dim + k] * benchInB[k * dim + c];
+      }
+    }
+  }
+
+  return (n);
+}
+
+static uint32_t mat_mult_f32_prepare(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 1.0, n);
+  arm_mat_init_f32(&matAF32, dim, dim, benchSrcA_f32);
+  arm_mat_init_f32(&matBF32, dim, dim, benchSrcB_f32);
+  arm_mat_init_f32(&matDstF32, dim, dim, benchDst_f32);
+
+  return (output(mat_mult_ref(n), 1.0));
+}
+
+static void mat_mult_f32_run(
+  uint32_t n)
+{
+  arm_mat_mult_f32(&matAF32, &matBF32, &matDstF32);
+}
+
+static uint32_t mat_mult_q31_prepare(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+
+  /* Scaled so the sums of dim products stay below 1 */
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0 / sqrt((float64_t) dim), n);
+  arm_bench_random_q31(benchSrcB_q31, benchInB, 1.0 / sqrt((float64_t) dim), n);
+  arm_mat_init_q31(&matAQ31, dim, dim, benchSrcA_q31);
+  arm_mat_init_q31(&matBQ31, dim, dim, benchSrcB_q31);
+  arm_mat_init_q31(&matDstQ31, dim, dim, benchDst_q31);
+
+  return (output(mat_mult_ref(n), 1.0));
+}
+
+static void mat_mult_q31_run(
+  uint32_t n)
+{
+  arm_mat_mult_q31(&matAQ31, &matBQ31, &matDstQ31);
+}
+
+static void mat_mult_fast_q31_run(
+  uint32_t n)
+{
+  arm_mat_mult_fast_q31(&matAQ31, &matBQ31, &matDstQ31);
+}
+
+static uint32_t mat_mult_q15_prepare(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0 / sqrt((float64_t) dim), n);
+  arm_bench_random_q15(benchSrcB_q15, benchInB, 1.0 / sqrt((float64_t) dim), n);
+  arm_mat_init_q15(&matAQ15, dim, dim, benchSrcA_q15);
+  arm_mat_init_q15(&matBQ15, dim, dim, benchSrcB_q15);
+  arm_mat_init_q15(&matDstQ15, dim, dim, benchDst_q15);
+
+  return (output(mat_mult_ref(n), 1.0));
+}
+
+static void mat_mult_q15_run(
+  uint32_t n)
+{
+  arm_mat_mult_q15(&matAQ15, &matBQ15, &matDstQ15, matStateQ15);
+}
+
+static void mat_mult_fast_q15_run(
+  uint32_t n)
+{
+  arm_mat_mult_fast_q15(&matAQ15, &matBQ15, &matDstQ15, matStateQ15);
+}
+
+static uint32_t mat_add_f32_prepare(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  uint32_t i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+  arm_bench_random_f32(benchSrcB_f32, benchInB, 1.0, n);
+  arm_mat_init_f32(&matAF32, dim, dim, benchSrcA_f32);
+  arm_mat_init_f32(&matBF32, dim, dim, benchSrcB_f32);
+  arm_mat_init_f32(&matDstF32, dim, dim, benchDst_f32);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] + benchInB[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void mat_add_f32_run(
+  uint32_t n)
+{
+  arm_mat_add_f32(&matAF32, &matBF32, &matDstF32);
+}
+
+static uint32_t mat_scale_q31_prepare(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  uint32_t i;
+
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+  arm_mat_init_q31(&matAQ31, dim, dim, benchSrcA_q31);
+  arm_mat_init_q31(&matDstQ31, dim, dim, benchDst_q31);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = benchInA[i] * 0.75;
+  }
+
+  return (output(n, 1.0));
+}
+
+static void mat_scale_q31_run(
+  uint32_t n)
+{
+  arm_mat_scale_q31(&matAQ31, 0x60000000, 0, &matDstQ31);
+}
+
+static uint32_t mat_trans_q15_prepare(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  uint32_t r, c;
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+  arm_mat_init_q15(&matAQ15, dim, dim, benchSrcA_q15);
+  arm_mat_init_q15(&matDstQ15, dim, dim, benchDst_q15);
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < dim; c++)
+    {
+      benchRef[c * dim + r] = benchInA[r * dim + c];
+    }
+  }
+
+  return (output(n, 1.0));
+}
+
+static void mat_trans_q15_run(
+  uint32_t n)
+{
+  arm_mat_trans_q15(&matAQ15, &matDstQ15);
+}
+
+/*
+ * @brief  Inverse of a diagonally dominant matrix, by Gauss-Jordan
+ *         elimination in double precision.
+ */
+static uint32_t mat_inverse_f32_prepare(
+  uint32_t n)
+{
+  static float64_t work[BENCH_MAX_VALUES];
+  uint16_t dim = mat_dim(n);
+  float64_t pivot, factor;
+  uint32_t r, c, k;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+
+  for (r = 0u; r < dim; r++)
+  {
+    benchSrcA_f32[r * dim + r] += (float32_t) dim;
+    benchInA[r * dim + r] = benchSrcA_f32[r * dim + r];
+  }
+
+  memcpy(work, benchInA, n * sizeof(float64_t));
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < dim; c++)
+    {
+      benchRef[r * dim + c] = (r == c) ? 1.0 : 0.0;
+    }
+  }
+
+  for (k = 0u; k < dim; k++)
+  {
+    pivot = work[k * dim + k];
+
+    for (c = 0u; c < dim; c++)
+    {
+      work[k * dim + c] /= pivot;
+      benchRef[k * dim + c] /= pivot;
+    }
+
+    for (r = 0u; r < dim; r++)
+    {
+      if(r != k)
+      {
+        factor = work[r * dim + k];
+
+        for (c = 0u; c < dim; c++)
+        {
+          work[r * dim + c] -= factor * work[k * dim + c];
+          benchRef[r * dim + c] -= factor * benchRef[k * dim + c];
+        }
+      }
+    }
+  }
+
+  arm_mat_init_f32(&matAF32, dim, dim, matWorkF32);
+  arm_mat_init_f32(&matDstF32, dim, dim, benchDst_f32);
+
+  return (output(n, 1.0));
+}
+
+static void mat_inverse_f32_run(
+  uint32_t n)
+{
+  /* The inverse overwrites its source */
+  memcpy(matWorkF32, benchSrcA_f32, n * sizeof(float32_t));
+  arm_mat_inverse_f32(&matAF32, &matDstF32);
+}
+
+/* Decompositions and solves of a well conditioned matrix in benchInA,
+ * symmetric for Cholesky and LDL', with dim right hand sides in benchInB */
+static q31_t matWorkQ31[BENCH_MAX_VALUES];
+static uint16_t matPivot[BENCH_MAX_VALUES];
+static float32_t matTauF32[BENCH_MAX_VALUES];
+static q31_t matTauQ31[BENCH_MAX_VALUES];
+static float64_t matFactor[BENCH_MAX_VALUES];
+static float64_t matTau[BENCH_MAX_VALUES];
+static arm_matrix_instance_f32 matWorkMatF32;
+static arm_matrix_instance_q31 matWorkMatQ31;
+
+/*
+ * @brief  0.75 on the diagonal and at most 0.5 / dim elsewhere, so the
+ *         eigenvalues are in [0.25, 1.25] and the column norms below 1,
+ *         and right hand sides that keep the solution below 1.
+ */
+static void mat_system_ref(
+  uint32_t n,
+  uint32_t symmetric)
+{
+  static float64_t work[BENCH_MAX_VALUES];
+  uint16_t dim = mat_dim(n);
+  uint32_t r, c;
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < dim; c++)
+    {
+      if(r == c)
+      {
+        benchInA[r * dim + c] = 0.75;
+      }
+      else if((symmetric == 0u) || (c > r))
+      {
+        benchInA[r * dim + c] = arm_bench_random() * 0.5 / dim;
+      }
+      else
+      {
+        benchInA[r * dim + c] = benchInA[c * dim + r];
+      }
+
+      benchInB[r * dim + c] = arm_bench_random() * 0.2 / dim;
+    }
+  }
+
+  memcpy(work, benchInA, n * sizeof(float64_t));
+  memcpy(benchRef, benchInB, n * sizeof(float64_t));
+  ref_solve(work, benchRef, dim, dim);
+}
+
+static void mat_system_f32(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchSrcA_f32[i] = (float32_t) benchInA[i];
+    benchSrcB_f32[i] = (float32_t) benchInB[i];
+  }
+
+  arm_mat_init_f32(&matAF32, dim, dim, benchSrcA_f32);
+  arm_mat_init_f32(&matBF32, dim, dim, benchSrcB_f32);
+  arm_mat_init_f32(&matDstF32, dim, dim, benchDst_f32);
+  arm_mat_init_f32(&matWorkMatF32, dim, dim, matWorkF32);
+}
+
+static void mat_system_q31(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchSrcA_q31[i] = arm_bench_to_q31(benchInA[i]);
+    benchSrcB_q31[i] = arm_bench_to_q31(benchInB[i]);
+  }
+
+  arm_mat_init_q31(&matAQ31, dim, dim, benchSrcA_q31);
+  arm_mat_init_q31(&matBQ31, dim, dim, benchSrcB_q31);
+  arm_mat_init_q31(&matDstQ31, dim, dim, benchDst_q31);
+  arm_mat_init_q31(&matWorkMatQ31, dim, dim, matWorkQ31);
+}
+
+/*
+ * @brief  The reference of a decomposition is the input, which result
+ *         rebuilds from the factors.
+ */
+static uint32_t mat_decomp_f32_prepare(
+  uint32_t n,
+  uint32_t symmetric)
+{
+  mat_system_ref(n, symmetric);
+  mat_system_f32(n);
+  memcpy(benchRef, benchInA, n * sizeof(float64_t));
+
+  return (output(n, 1.0));
+}
+
+static uint32_t mat_decomp_q31_prepare(
+  uint32_t n,
+  uint32_t symmetric)
+{
+  mat_system_ref(n, symmetric);
+  mat_system_q31(n);
+  memcpy(benchRef, benchInA, n * sizeof(float64_t));
+
+  return (output(n, 1.0));
+}
+
+static void mat_factor_f32(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    matFactor[i] = benchDst_f32[i];
+    matTau[i] = matTauF32[i];
+  }
+}
+
+static void mat_factor_q31(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    matFactor[i] = benchDst_q31[i] / 2147483648.0;
+    matTau[i] = matTauQ31[i] / 1073741824.0;
+  }
+}
+
+/*
+ * @brief  L * L' from the factor in matFactor.
+ */
+static void mat_cholesky_rebuild(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  float64_t sum;
+  uint32_t r, c, k;
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < dim; c++)
+    {
+      sum = 0.0;
+
+      for (k = 0u; (k <= r) && (k <= c); k++)
+      {
+        sum += matFactor[r * dim + k] * matFactor[c * dim + k];
+      }
+
+      benchOut[r * dim + c] = sum;
+    }
+  }
+}
+
+/*
+ * @brief  P' * L * D * L' * P from the factors in matFactor and matPivot.
+ */
+static void mat_ldlt_rebuild(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  float64_t sum, lr, lc, temp;
+  uint32_t r, c, k, p;
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < dim; c++)
+    {
+      sum = 0.0;
+
+      for (k = 0u; (k <= r) && (k <= c); k++)
+      {
+        lr = (k == r) ? 1.0 : matFactor[r * dim + k];
+        lc = (k == c) ? 1.0 : matFactor[c * dim + k];
+        sum += lr * matFactor[k * dim + k] * lc;
+      }
+
+      benchOut[r * dim + c] = sum;
+    }
+  }
+
+  k = dim;
+
+  while(k > 0u)
+  {
+    k--;
+    p = matPivot[k];
+
+    for (c = 0u; c < dim; c++)
+    {
+      temp = benchOut[k * dim + c];
+      benchOut[k * dim + c] = benchOut[p * dim + c];
+      benchOut[p * dim + c] = temp;
+    }
+
+    for (r = 0u; r < dim; r++)
+    {
+      temp = benchOut[r * dim + k];
+      benchOut[r * dim + k] = benchOut[r * dim + p];
+      benchOut[r * dim + p] = temp;
+    }
+  }
+}
+
+/*
+ * @brief  P' * L * U from the factors in matFactor and matPivot.
+ */
+static void mat_lu_rebuild(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  float64_t sum, temp;
+  uint32_t r, c, k, p;
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < dim; c++)
+    {
+      sum = 0.0;
+
+      for (k = 0u; (k <= r) && (k <= c); k++)
+      {
+        sum += ((k == r) ? 1.0 : matFactor[r * dim + k]) * matFactor[k * dim + c];
+      }
+
+      benchOut[r * dim + c] = sum;
+    }
+  }
+
+  k = dim;
+
+  while(k > 0u)
+  {
+    k--;
+    p = matPivot[k];
+
+    for (c = 0u; c < dim; c++)
+    {
+      temp = benchOut[k * dim + c];
+      benchOut[k * dim + c] = benchOut[p * dim + c];
+      benchOut[p * dim + c] = temp;
+    }
+  }
+}
+
+/*
+ * @brief  Q * R from the factors in matFactor and matTau, applying the
+ *         reflections to R from the last one on.
+ */
+static void mat_qr_rebuild(
+  uint32_t n)
+{
+  uint16_t dim = mat_dim(n);
+  float64_t sum;
+  uint32_t r, c, k;
+
+  for (r = 0u; r < dim; r++)
+  {
+    for (c = 0u; c < dim; c++)
+    {
+      benchOut[r * dim + c] = (c >= r) ? matFactor[r * dim + c] : 0.0;
+    }
+  }
+
+  k = dim;
+
+  while(k > 0u)
+  {
+    k--;
+
+    for (c = 0u; c < dim; c++)
+    {
+      sum = benchOut[k * dim + c];
+
+      for (r = k + 1u; r < dim; r++)
+      {
+        sum += matFactor[r * dim + k] * benchOut[r * dim + c];
+      }
+
+      sum *= matTau[k];
+      benchOut[k * dim + c] -= sum;
+
+      for (r = k + 1u; r < dim; r++)
+      {
+        benchOut[r * dim + c] -= sum * matFactor[r * dim + k];
+      }
+    }
+  }
+}
+
+static uint32_t mat_cholesky_f32_prepare(
+  uint32_t n)
+{
+  return (mat_decomp_f32_prepare(n, 1u));
+}
+
+static void mat_cholesky_f32_run(
+  uint32_t n)
+{
+  arm_mat_cholesky_f32(&matAF32, &matDstF32);
+}
+
+static void mat_cholesky_f32_result(
+  uint32_t n)
+{
+  mat_factor_f32(n);
+  mat_cholesky_rebuild(n);
+}
+
+static uint32_t mat_cholesky_q31_prepare(
+  uint32_t n)
+{
+  return (mat_decomp_q31_prepare(n, 1u));
+}
+
+static void mat_cholesky_q31_run(
+  uint32_t n)
+{
+  arm_mat_cholesky_q31(&matAQ31, &matDstQ31);
+}
+
+static void mat_cholesky_q31_result(
+  uint32_t n)
+{
+  mat_factor_q31(n);
+  mat_cholesky_rebuild(n);
+}
+
+static void mat_ldlt_f32_run(
+  uint32_t n)
+{
+  arm_mat_ldlt_f32(&matAF32, &matDstF32, matPivot);
+}
+
+static void mat_ldlt_f32_result(
+  uint32_t n)
+{
+  mat_factor_f32(n);
+  mat_ldlt_rebuild(n);
+}
+
+static void mat_ldlt_q31_run(
+  uint32_t n)
+{
+  arm_mat_ldlt_q31(&matAQ31, &matDstQ31, matPivot);
+}
+
+static void mat_ldlt_q31_result(
+  uint32_t n)
+{
+  mat_factor_q31(n);
+  mat_ldlt_rebuild(n);
+}
+
+static uint32_t mat_lu_f32_prepare(
+  uint32_t n)
+{
+  return (mat_decomp_f32_prepare(n, 0u));
+}
+
+static void mat_lu_f32_run(
+  uint32_t n)
+{
+  arm_mat_lu_f32(&matAF32, &matDstF32, matPivot);
+}
+
+static void mat_lu_f32_result(
+  uint32_t n)
+{
+  mat_factor_f32(n);
+  mat_lu_rebuild(n);
+}
+
+static uint32_t mat_lu_q31_prepare(
+  uint32_t n)
+{
+  return (mat_decomp_q31_prepare(n, 0u));
+}
+
+static void mat_lu_q31_run(
+  uint32_t n)
+{
+  arm_mat_lu_q31(&matAQ31, &matDstQ31, matPivot);
+}
+
+static void mat_lu_q31_result(
+  uint32_t n)
+{
+  mat_factor_q31(n);
+  mat_lu_rebuild(n);
+}
+
+static void mat_qr_f32_run(
+  uint32_t n)
+{
+  arm_mat_qr_f32(&matAF32, &matDstF32, matTauF32);
+}
+
+static void mat_qr_f32_result(
+  uint32_t n)
+{
+  mat_factor_f32(n);
+  mat_qr_rebuild(n);
+}
+
+static void mat_qr_q31_run(
+  uint32_t n)
+{
+  arm_mat_qr_q31(&matAQ31, &matDstQ31, matTauQ31);
+}
+
+static void mat_qr_q31_result(
+  uint32_t n)
+{
+  mat_factor_q31(n);
+  mat_qr_rebuild(n);
+}
+
+/*
+ * @brief  The solves start from factors made in prepare; the reference
+ *         is the solution of the system.
+ */
+static uint32_t mat_cholesky_solve_f32_prepare(
+  uint32_t n)
+{
+  mat_system_ref(n, 1u);
+  mat_system_f32(n);
+  arm_mat_cholesky_f32(&matAF32, &matWorkMatF32);
+
+  return (output(n, 1.0));
+}
+
+static void mat_cholesky_solve_f32_run(
+  uint32_t n)
+{
+  arm_mat_cholesky_solve_f32(&matWorkMatF32, &matBF32, &matDstF32);
+}
+
+static uint32_t mat_cholesky_solve_q31_prepare(
+  uint32_t n)
+{
+  mat_system_ref(n, 1u);
+  mat_system_q31(n);
+  arm_mat_cholesky_q31(&matAQ31, &matWorkMatQ31);
+
+  return (output(n, 1.0));
+}
+
+static void mat_cholesky_solve_q31_run(
+  uint32_t n)
+{
+  arm_mat_cholesky_solve_q31(&matWorkMatQ31, &matBQ31, &matDstQ31);
+}
+
+static uint32_t mat_ldlt_solve_f32_prepare(
+  uint32_t n)
+{
+  mat_system_ref(n, 1u);
+  mat_system_f32(n);
+  arm_mat_ldlt_f32(&matAF32, &matWorkMatF32, matPivot);
+
+  return (output(n, 1.0));
+}
+
+static void mat_ldlt_solve_f32_run(
+  uint32_t n)
+{
+  arm_mat_ldlt_solve_f32(&matWorkMatF32, matPivot, &matBF32, &matDstF32);
+}
+
+static uint32_t mat_ldlt_solve_q31_prepare(
+  uint32_t n)
+{
+  mat_system_ref(n, 1u);
+  mat_system_q31(n);
+  arm_mat_ldlt_q31(&matAQ31, &matWorkMatQ31, matPivot);
+
+  return (output(n, 1.0));
+}
+
+static void mat_ldlt_solve_q31_run(
+  uint32_t n)
+{
+  arm_mat_ldlt_solve_q31(&matWorkMatQ31, matPivot, &matBQ31, &matDstQ31);
+}
+
+static uint32_t mat_lu_solve_f32_prepare(
+  uint32_t n)
+{
+  mat_system_ref(n, 0u);
+  mat_system_f32(n);
+  arm_mat_lu_f32(&matAF32, &matWorkMatF32, matPivot);
+
+  return (output(n, 1.0));
+}
+
+static void mat_lu_solve_f32_run(
+  uint32_t n)
+{
+  arm_mat_lu_solve_f32(&matWorkMatF32, matPivot, &matBF32, &matDstF32);
+}
+
+static uint32_t mat_lu_solve_q31_prepare(
+  uint32_t n)
+{
+  mat_system_ref(n, 0u);
+  mat_system_q31(n);
+  arm_mat_lu_q31(&matAQ31, &matWorkMatQ31, matPivot);
+
+  return (output(n, 1.0));
+}
+
+static void mat_lu_solve_q31_run(
+  uint32_t n)
+{
+  arm_mat_lu_solve_q31(&matWorkMatQ31, matPivot, &matBQ31, &matDstQ31);
+}
+
+static uint32_t mat_qr_solve_f32_prepare(
+  uint32_t n)
+{
+  mat_system_ref(n, 0u);
+  mat_system_f32(n);
+  arm_mat_qr_f32(&matAF32, &matWorkMatF32, matTauF32);
+
+  return (output(n, 1.0));
+}
+
+static void mat_qr_solve_f32_run(
+  uint32_t n)
+{
+  /* The solve overwrites B, so it runs in place on a copy */
+  memcpy(benchDst_f32, benchSrcB_f32, n * sizeof(float32_t));
+  arm_mat_qr_solve_f32(&matWorkMatF32, matTauF32, &matDstF32, &matDstF32);
+}
+
+static uint32_t mat_qr_solve_q31_prepare(
+  uint32_t n)
+{
+  mat_system_ref(n, 0u);
+  mat_system_q31(n);
+  arm_mat_qr_q31(&matAQ31, &matWorkMatQ31, matTauQ31);
+
+  return (output(n, 1.0));
+}
+
+static void mat_qr_solve_q31_run(
+  uint32_t n)
+{
+  /* The solve overwrites B, so it runs in place on a copy */
+  memcpy(benchDst_q31, benchSrcB_q31, n * sizeof(q31_t));
+  arm_mat_qr_solve_q31(&matWorkMatQ31, matTauQ31, &matDstQ31, &matDstQ31);
+}
+
+/* ----------------------------------------------------------------------
+* Statistics
+* ------------------------------------------------------------------- */
+
+/*
+ * @brief  Mean, variance, RMS and sum of squares of benchInA in
+ *         benchRef[0..3], the variance with n - 1 as the library does.
+ */
+static void stats_ref(
+  uint32_t n)
+{
+  float64_t sum = 0.0, squares = 0.0;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    sum += benchInA[i];
+    squares += benchInA[i] * benchInA[i];
+  }
+
+  benchRef[0] = sum / n;
+  benchRef[1] = (squares - sum * sum / n) / (n - 1u);
+  benchRef[2] = sqrt(squares / n);
+  benchRef[3] = squares;
+}
+
+/*
+ * @brief  Keeps only benchRef[index] as the single output.
+ */
+static uint32_t stats_output(
+  uint32_t n,
+  uint32_t index)
+{
+  stats_ref(n);
+  benchRef[0] = benchRef[index];
+
+  return (1u);
+}
+
+/*
+ * @brief  Moves the inputs of a mean up by 0.25, so that the mean is
+ *         well away from zero and the SNR measures the kernel rather
+ *         than the cancellation in the reference.
+ */
+static void stats_offset(
+  char type,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchInA[i] += 0.25;
+
+    switch (type)
+    {
+    case 'f':
+      benchSrcA_f32[i] += 0.25f;
+      break;
+    case 'l':
+      benchSrcA_q31[i] += 0x20000000;
+      break;
+    case 's':
+      benchSrcA_q15[i] += 0x2000;
+      break;
+    default:
+      benchSrcA_q7[i] += 0x20;
+      break;
+    }
+  }
+}
+
+static uint32_t mean_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  stats_offset('f', n);
+
+  return (stats_output(n, 0u));
+}
+
+static void mean_f32_run(
+  uint32_t n)
+{
+  arm_mean_f32(benchSrcA_f32, n, &resultF32[0]);
+}
+
+static uint32_t mean_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n);
+  stats_offset('s', n);
+
+  return (stats_output(n, 0u));
+}
+
+static void mean_q15_run(
+  uint32_t n)
+{
+  arm_mean_q15(benchSrcA_q15, n, &resultQ15);
+}
+
+static uint32_t mean_q7_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q7(benchSrcA_q7, benchInA, 0.5, n);
+  stats_offset('b', n);
+
+  return (stats_output(n, 0u));
+}
+
+static void mean_q7_run(
+  uint32_t n)
+{
+  arm_mean_q7(benchSrcA_q7, n, &resultQ7);
+}
+
+static uint32_t var_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+
+  return (stats_output(n, 1u));
+}
+
+static void var_f32_run(
+  uint32_t n)
+{
+  arm_var_f32(benchSrcA_f32, n, &resultF32[0]);
+}
+
+static uint32_t var_q31_prepare(
+  uint32_t n)
+{
+  /* The sum of squares saturates unless the input is scaled down by the block size */
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0 / sqrt(n), n);
+
+  return (stats_output(n, 1u));
+}
+
+static void var_q31_run(
+  uint32_t n)
+{
+  arm_var_q31(benchSrcA_q31, n, &resultQ63);
+}
+
+static uint32_t var_q15_prepare(
+  uint32_t n)
+{
+  /* The sum of squares saturates unless the input is scaled down by the
+   * block size. It is also cut to 1.15 before the division by the block
+   * size, so the result loses about 5 dB per doubling of the block size. */
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0 / sqrt(n), n);
+
+  return (stats_output(n, 1u));
+}
+
+static void var_q15_run(
+  uint32_t n)
+{
+  arm_var_q15(benchSrcA_q15, n, &resultQ31);
+}
+
+static uint32_t rms_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+
+  return (stats_output(n, 2u));
+}
+
+static void rms_f32_run(
+  uint32_t n)
+{
+  arm_rms_f32(benchSrcA_f32, n, &resultF32[0]);
+}
+
+static uint32_t rms_q31_prepare(
+  uint32_t n)
+{
+  /* The sum of squares saturates unless the input is scaled down by the block size */
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0 / sqrt(n), n);
+
+  return (stats_output(n, 2u));
+}
+
+static void rms_q31_run(
+  uint32_t n)
+{
+  arm_rms_q31(benchSrcA_q31, n, &resultQ31);
+}
+
+static uint32_t std_q15_prepare(
+  uint32_t n)
+{
+  /* The sum of squares saturates unless the input is scaled down by the block size */
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0 / sqrt(n), n);
+  stats_ref(n);
+  benchRef[0] = sqrt(benchRef[1]);
+
+  return (1u);
+}
+
+static void std_q15_run(
+  uint32_t n)
+{
+  arm_std_q15(benchSrcA_q15, n, &resultQ15);
+}
+
+static uint32_t power_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+
+  return (stats_output(n, 3u));
+}
+
+static void power_q15_run(
+  uint32_t n)
+{
+  arm_power_q15(benchSrcA_q15, n, &resultQ63);
+}
+
+static void power_q15_result(
+  uint32_t n)
+{
+  /* 34.30 */
+  benchOut[0] = (float64_t) resultQ63 / 1073741824.0;
+}
+
+static void var_q31_result(
+  uint32_t n)
+{
+  /* 1.31 in a q63_t */
+  benchOut[0] = (float64_t) resultQ63 / 2147483648.0;
+}
+
+static void var_q15_result(
+  uint32_t n)
+{
+  /* 1.15 in a q31_t */
+  benchOut[0] = (float64_t) resultQ31 / 32768.0;
+}
+
+static void scalar_f32_result(
+  uint32_t n)
+{
+  benchOut[0] = resultF32[0];
+}
+
+static void scalar_q31_result(
+  uint32_t n)
+{
+  benchOut[0] = (float64_t) resultQ31 / 2147483648.0;
+}
+
+static void scalar_q15_result(
+  uint32_t n)
+{
+  benchOut[0] = (float64_t) resultQ15 / 32768.0;
+}
+
+static void scalar_q7_result(
+  uint32_t n)
+{
+  benchOut[0] = (float64_t) resultQ7 / 128.0;
+}
+
+/*
+ * @brief  Value and index of the largest or smallest value of benchInA.
+ */
+static uint32_t extremum_ref(
+  uint32_t n,
+  uint32_t largest)
+{
+  uint32_t i, index = 0u;
+
+  for (i = 1u; i < n; i++)
+  {
+    if(largest ? (benchInA[i] > benchInA[index]) : (benchInA[i] < benchInA[index]))
+    {
+      index = i;
+    }
+  }
+
+  benchRef[0] = benchInA[index];
+  benchRef[1] = (float64_t) index;
+
+  return (2u);
+}
+
+static uint32_t max_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+
+  return (extremum_ref(n, 1u));
+}
+
+static void max_f32_run(
+  uint32_t n)
+{
+  arm_max_f32(benchSrcA_f32, n, &resultF32[0], &resultIndex);
+}
+
+static void max_f32_result(
+  uint32_t n)
+{
+  benchOut[0] = resultF32[0];
+  benchOut[1] = (float64_t) resultIndex;
+}
+
+static uint32_t min_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+
+  return (extremum_ref(n, 0u));
+}
+
+static void min_q15_run(
+  uint32_t n)
+{
+  arm_min_q15(benchSrcA_q15, n, &resultQ15, &resultIndex);
+}
+
+static void min_q15_result(
+  uint32_t n)
+{
+  benchOut[0] = (float64_t) resultQ15 / 32768.0;
+  benchOut[1] = (float64_t) resultIndex;
+}
+
+/*
+ * The moving statistics run over a window of MOVING_LEN samples. Every
+ * run starts a new window and feeds it the whole block, so the results
+ * are over the last MOVING_LEN inputs.
+ */
+#define MOVING_LEN  200u
+
+static arm_moving_stats_instance_f32 movingF32;
+static arm_moving_stats_instance_q31 movingQ31;
+static arm_moving_stats_instance_q15 movingQ15;
+static float32_t movingStateF32[MOVING_LEN];
+static q31_t movingStateQ31[MOVING_LEN];
+static q15_t movingStateQ15[MOVING_LEN];
+static uint16_t movingDeque[2u * MOVING_LEN];
+
+/*
+ * @brief  Mean, variance, RMS, maximum and minimum of the last
+ *         MOVING_LEN values of benchInA in benchRef[0..4].
+ */
+static uint32_t moving_ref(
+  uint32_t n)
+{
+  const float64_t *pIn = benchInA + n - MOVING_LEN;
+  float64_t sum = 0.0, squares = 0.0, dev = 0.0;
+  float64_t maxVal = pIn[0], minVal = pIn[0];
+  uint32_t i;
+
+  for (i = 0u; i < MOVING_LEN; i++)
+  {
+    sum += pIn[i];
+    squares += pIn[i] * pIn[i];
+    maxVal = (pIn[i] > maxVal) ? pIn[i] : maxVal;
+    minVal = (pIn[i] < minVal) ? pIn[i] : minVal;
+  }
+
+  for (i = 0u; i < MOVING_LEN; i++)
+  {
+    dev += (pIn[i] - sum / MOVING_LEN) * (pIn[i] - sum / MOVING_LEN);
+  }
+
+  benchRef[0] = sum / MOVING_LEN;
+  benchRef[1] = dev / (MOVING_LEN - 1u);
+  benchRef[2] = sqrt(squares / MOVING_LEN);
+  benchRef[3] = maxVal;
+  benchRef[4] = minVal;
+
+  return (5u);
+}
+
+static uint32_t moving_stats_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 0.5, n);
+  stats_offset('f', n);
+
+  return (moving_ref(n));
+}
+
+static void moving_stats_f32_run(
+  uint32_t n)
+{
+  arm_moving_stats_init_f32(&movingF32, MOVING_LEN, movingStateF32, movingDeque);
+  arm_moving_stats_update_f32(&movingF32, benchSrcA_f32, n);
+}
+
+static void moving_stats_f32_result(
+  uint32_t n)
+{
+  arm_moving_mean_f32(&movingF32, &benchDst_f32[0]);
+  arm_moving_var_f32(&movingF32, &benchDst_f32[1]);
+  arm_moving_rms_f32(&movingF32, &benchDst_f32[2]);
+  arm_moving_max_f32(&movingF32, &benchDst_f32[3], &resultIndex);
+  arm_moving_min_f32(&movingF32, &benchDst_f32[4], &resultIndex);
+  arm_bench_result_f32(benchDst_f32, 1.0, 5u);
+}
+
+static uint32_t moving_stats_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 0.5, n);
+  stats_offset('l', n);
+
+  return (moving_ref(n));
+}
+
+static void moving_stats_q31_run(
+  uint32_t n)
+{
+  arm_moving_stats_init_q31(&movingQ31, MOVING_LEN, movingStateQ31, movingDeque);
+  arm_moving_stats_update_q31(&movingQ31, benchSrcA_q31, n);
+}
+
+static void moving_stats_q31_result(
+  uint32_t n)
+{
+  arm_moving_mean_q31(&movingQ31, &benchDst_q31[0]);
+  arm_moving_var_q31(&movingQ31, &benchDst_q31[1]);
+  arm_moving_rms_q31(&movingQ31, &benchDst_q31[2]);
+  arm_moving_max_q31(&movingQ31, &benchDst_q31[3], &resultIndex);
+  arm_moving_min_q31(&movingQ31, &benchDst_q31[4], &resultIndex);
+  arm_bench_result_q31(benchDst_q31, 1.0, 5u);
+}
+
+static uint32_t moving_stats_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 0.5, n);
+  stats_offset('s', n);
+
+  return (moving_ref(n));
+}
+
+static void moving_stats_q15_run(
+  uint32_t n)
+{
+  arm_moving_stats_init_q15(&movingQ15, MOVING_LEN, movingStateQ15, movingDeque);
+  arm_moving_stats_update_q15(&movingQ15, benchSrcA_q15, n);
+}
+
+static void moving_stats_q15_result(
+  uint32_t n)
+{
+  arm_moving_mean_q15(&movingQ15, &benchDst_q15[0]);
+  arm_moving_var_q15(&movingQ15, &benchDst_q15[1]);
+  arm_moving_rms_q15(&movingQ15, &benchDst_q15[2]);
+  arm_moving_max_q15(&movingQ15, &benchDst_q15[3], &resultIndex);
+  arm_moving_min_q15(&movingQ15, &benchDst_q15[4], &resultIndex);
+  arm_bench_result_q15(benchDst_q15, 1.0, 5u);
+}
+
+/* ----------------------------------------------------------------------
+* Support
+* ------------------------------------------------------------------- */
+static uint32_t float_to_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+  memcpy(benchRef, benchInA, n * sizeof(float64_t));
+
+  return (output(n, 1.0));
+}
+
+static void float_to_q15_run(
+  uint32_t n)
+{
+  arm_float_to_q15(benchSrcA_f32, benchDst_q15, n);
+}
+
+static void float_to_q31_run(
+  uint32_t n)
+{
+  arm_float_to_q31(benchSrcA_f32, benchDst_q31, n);
+}
+
+static void float_to_q7_run(
+  uint32_t n)
+{
+  arm_float_to_q7(benchSrcA_f32, benchDst_q7, n);
+}
+
+static uint32_t q15_to_float_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+  memcpy(benchRef, benchInA, n * sizeof(float64_t));
+
+  return (output(n, 1.0));
+}
+
+static void q15_to_float_run(
+  uint32_t n)
+{
+  arm_q15_to_float(benchSrcA_q15, benchDst_f32, n);
+}
+
+static void q15_to_q31_run(
+  uint32_t n)
+{
+  arm_q15_to_q31(benchSrcA_q15, benchDst_q31, n);
+}
+
+static void copy_q15_run(
+  uint32_t n)
+{
+  arm_copy_q15(benchSrcA_q15, benchDst_q15, n);
+}
+
+static uint32_t q31_to_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+  memcpy(benchRef, benchInA, n * sizeof(float64_t));
+
+  return (output(n, 1.0));
+}
+
+static void q31_to_q15_run(
+  uint32_t n)
+{
+  arm_q31_to_q15(benchSrcA_q31, benchDst_q15, n);
+}
+
+static uint32_t fill_f32_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = 0.25;
+  }
+
+  return (output(n, 1.0));
+}
+
+static void fill_f32_run(
+  uint32_t n)
+{
+  arm_fill_f32(0.25f, benchDst_f32, n);
+}
+
+/* ----------------------------------------------------------------------
+* Transform, complex block sizes in complex samples
+* ------------------------------------------------------------------- */
+static arm_cfft_radix4_instance_q31 cfftQ31;
+static arm_cfft_radix4_instance_q15 cfftQ15;
+static arm_rfft_fast_instance_f32 rfftFastF32;
+static arm_rfft_fast_instance_q31 rfftFastQ31;
+static arm_rfft_fast_instance_q15 rfftFastQ15;
+static arm_rfft_instance_q31 rfftQ31;
+static arm_rfft_instance_f32 rfftF32;
+static arm_dct4_instance_f32 dct4F32;
+
+static const arm_cfft_instance_f32 *cfft_f32_instance(
+  uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:
+    return (&arm_cfft_sR_f32_len16);
+  case 32u:
+    return (&arm_cfft_sR_f32_len32);
+  case 64u:
+    return (&arm_cfft_sR_f32_len64);
+  case 128u:
+    return (&arm_cfft_sR_f32_len128);
+  case 256u:
+    return (&arm_cfft_sR_f32_len256);
+  case 512u:
+    return (&arm_cfft_sR_f32_len512);
+  case 1024u:
+    return (&arm_cfft_sR_f32_len1024);
+  case 2048u:
+    return (&arm_cfft_sR_f32_len2048);
+  default:
+    return (&arm_cfft_sR_f32_len4096);
+  }
+}
+
+static uint32_t cfft_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, 2u * n);
+  ref_dft(benchInA, benchRef, n, 0u);
+
+  return (output(2u * n, 1.0));
+}
+
+static void cfft_f32_run(
+  uint32_t n)
+{
+  memcpy(benchDst_f32, benchSrcA_f32, 2u * n * sizeof(float32_t));
+  arm_cfft_f32(cfft_f32_instance(n), benchDst_f32, 0u, 1u);
+}
+
+static uint32_t cifft_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, 2u * n);
+  ref_dft(benchInA, benchRef, n, 1u);
+
+  return (output(2u * n, 1.0));
+}
+
+static void cifft_f32_run(
+  uint32_t n)
+{
+  memcpy(benchDst_f32, benchSrcA_f32, 2u * n * sizeof(float32_t));
+  arm_cfft_f32(cfft_f32_instance(n), benchDst_f32, 1u, 1u);
+}
+
+static const arm_cfft_instance_q31 *cfft_q31_instance(
+  uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:
+    return (&arm_cfft_sR_q31_len16);
+  case 32u:
+    return (&arm_cfft_sR_q31_len32);
+  case 64u:
+    return (&arm_cfft_sR_q31_len64);
+  case 128u:
+    return (&arm_cfft_sR_q31_len128);
+  case 256u:
+    return (&arm_cfft_sR_q31_len256);
+  case 512u:
+    return (&arm_cfft_sR_q31_len512);
+  case 1024u:
+    return (&arm_cfft_sR_q31_len1024);
+  case 2048u:
+    return (&arm_cfft_sR_q31_len2048);
+  default:
+    return (&arm_cfft_sR_q31_len4096);
+  }
+}
+
+static const arm_cfft_instance_q15 *cfft_q15_instance(
+  uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:
+    return (&arm_cfft_sR_q15_len16);
+  case 32u:
+    return (&arm_cfft_sR_q15_len32);
+  case 64u:
+    return (&arm_cfft_sR_q15_len64);
+  case 128u:
+    return (&arm_cfft_sR_q15_len128);
+  case 256u:
+    return (&arm_cfft_sR_q15_len256);
+  case 512u:
+    return (&arm_cfft_sR_q15_len512);
+  case 1024u:
+    return (&arm_cfft_sR_q15_len1024);
+  case 2048u:
+    return (&arm_cfft_sR_q15_len2048);
+  default:
+    return (&arm_cfft_sR_q15_len4096);
+  }
+}
+
+static uint32_t cfft_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, 2u * n);
+  ref_dft(benchInA, benchRef, n, 0u);
+
+  /* Scaled down by the FFT length */
+  return (output(2u * n, (float64_t) n));
+}
+
+static void cfft_q31_run(
+  uint32_t n)
+{
+  memcpy(benchDst_q31, benchSrcA_q31, 2u * n * sizeof(q31_t));
+  arm_cfft_q31(cfft_q31_instance(n), benchDst_q31, 0u, 1u);
+}
+
+static uint32_t cifft_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, 2u * n);
+  ref_dft(benchInA, benchRef, n, 1u);
+
+  return (output(2u * n, 1.0));
+}
+
+static void cifft_q31_run(
+  uint32_t n)
+{
+  memcpy(benchDst_q31, benchSrcA_q31, 2u * n * sizeof(q31_t));
+  arm_cfft_q31(cfft_q31_instance(n), benchDst_q31, 1u, 1u);
+}
+
+static uint32_t cfft_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, 2u * n);
+  ref_dft(benchInA, benchRef, n, 0u);
+
+  return (output(2u * n, (float64_t) n));
+}
+
+static void cfft_q15_run(
+  uint32_t n)
+{
+  memcpy(benchDst_q15, benchSrcA_q15, 2u * n * sizeof(q15_t));
+  arm_cfft_q15(cfft_q15_instance(n), benchDst_q15, 0u, 1u);
+}
+
+static uint32_t cifft_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, 2u * n);
+  ref_dft(benchInA, benchRef, n, 1u);
+
+  return (output(2u * n, 1.0));
+}
+
+static void cifft_q15_run(
+  uint32_t n)
+{
+  memcpy(benchDst_q15, benchSrcA_q15, 2u * n * sizeof(q15_t));
+  arm_cfft_q15(cfft_q15_instance(n), benchDst_q15, 1u, 1u);
+}
+
+static uint32_t cfft_radix4_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, 2u * n);
+  ref_dft(benchInA, benchRef, n, 0u);
+  arm_cfft_radix4_init_q31(&cfftQ31, (uint16_t) n, 0u, 1u);
+
+  /* Scaled down by the FFT length */
+  return (output(2u * n, (float64_t) n));
+}
+
+static void cfft_radix4_q31_run(
+  uint32_t n)
+{
+  memcpy(benchDst_q31, benchSrcA_q31, 2u * n * sizeof(q31_t));
+  arm_cfft_radix4_q31(&cfftQ31, benchDst_q31);
+}
+
+static uint32_t cfft_radix4_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, 2u * n);
+  ref_dft(benchInA, benchRef, n, 0u);
+  arm_cfft_radix4_init_q15(&cfftQ15, (uint16_t) n, 0u, 1u);
+
+  return (output(2u * n, (float64_t) n));
+}
+
+static void cfft_radix4_q15_run(
+  uint32_t n)
+{
+  memcpy(benchDst_q15, benchSrcA_q15, 2u * n * sizeof(q15_t));
+  arm_cfft_radix4_q15(&cfftQ15, benchDst_q15);
+}
+
+/*
+ * @brief  Spectrum of the real input in benchInA, bins 0 to N/2 - 1 as
+ *         interleaved complex values.
+ */
+static void ref_rfft(
+  uint32_t n)
+{
+  static float64_t full[2u * BENCH_MAX_VALUES];
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchInB[2u * i] = benchInA[i];
+    benchInB[2u * i + 1u] = 0.0;
+  }
+
+  ref_dft(benchInB, full, n, 0u);
+  memcpy(benchRef, full, n * sizeof(float64_t));
+}
+
+/*
+ * @brief  Packs the real bin at N/2 into the imaginary part of bin 0 of
+ *         the reference, as the fast real FFTs do.
+ */
+static void ref_rfft_packed(
+  uint32_t n)
+{
+  uint32_t i;
+
+  ref_rfft(n);
+  benchRef[1] = 0.0;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[1] += (i & 1u) ? -benchInA[i] : benchInA[i];
+  }
+}
+
+static uint32_t rfft_fast_f32_prepare(
+  uint32_t n)
+{
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+  ref_rfft_packed(n);
+  arm_rfft_fast_init_f32(&rfftFastF32, (uint16_t) n);
+
+  return (output(n, 1.0));
+}
+
+static void rfft_fast_f32_run(
+  uint32_t n)
+{
+  /* The transform uses its input as scratch */
+  memcpy(benchSrcB_f32, benchSrcA_f32, n * sizeof(float32_t));
+  arm_rfft_fast_f32(&rfftFastF32, benchSrcB_f32, benchDst_f32, 0u);
+}
+
+static uint32_t rfft_fast_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+  ref_rfft_packed(n);
+  arm_rfft_fast_init_q31(&rfftFastQ31, (uint16_t) n);
+
+  return (output(n, (float64_t) n));
+}
+
+static void rfft_fast_q31_run(
+  uint32_t n)
+{
+  memcpy(benchSrcB_q31, benchSrcA_q31, n * sizeof(q31_t));
+  arm_rfft_fast_q31(&rfftFastQ31, benchSrcB_q31, benchDst_q31, 0u);
+}
+
+static uint32_t rfft_fast_q15_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+  ref_rfft_packed(n);
+  arm_rfft_fast_init_q15(&rfftFastQ15, (uint16_t) n);
+
+  return (output(n, (float64_t) n));
+}
+
+static void rfft_fast_q15_run(
+  uint32_t n)
+{
+  memcpy(benchSrcB_q15, benchSrcA_q15, n * sizeof(q15_t));
+  arm_rfft_fast_q15(&rfftFastQ15, benchSrcB_q15, benchDst_q15, 0u);
+}
+
+static uint32_t rfft_q31_prepare(
+  uint32_t n)
+{
+  arm_bench_random_q31(benchSrcA_q31, benchInA, 1.0, n);
+  ref_rfft(n);
+  arm_rfft_init_q31(&rfftQ31, &cfftQ31, n, 0u, 1u);
+
+  /* The output is downscaled by 2 in each of the log2(n) - 1 stages */
+  return (output(n, (float64_t) n / 2.0));
+}
+
+static void rfft_q31_run(
+  uint32_t n)
+{
+  memcpy(benchSrcB_q31, benchSrcA_q31, n * sizeof(q31_t));
+  arm_rfft_q31(&rfftQ31, benchSrcB_q31, benchDst_q31);
+}
+
+static arm_cfft_radix4_instance_f32 dct4CfftF32;
+
+static uint32_t dct4_f32_prepare(
+  uint32_t n)
+{
+  float64_t norm = sqrt(2.0 / n);
+  uint32_t k, i;
+
+  arm_bench_random_f32(benchSrcA_f32, benchInA, 1.0, n);
+
+  for (k = 0u; k < n; k++)
+  {
+    benchRef[k] = 0.0;
+
+    for (i = 0u; i < n; i++)
+    {
+      benchRef[k] += benchInA[i] * cos(PI / n * (i + 0.5) * (k + 0.5));
+    }
+
+    benchRef[k] *= norm;
+  }
+
+  arm_dct4_init_f32(&dct4F32, &rfftF32, &dct4CfftF32, (uint16_t) n, (uint16_t) (n / 2u), (float32_t) norm);
+
+  return (output(n, 1.0));
+}
+
+static void dct4_f32_run(
+  uint32_t n)
+{
+  memcpy(benchDst_f32, benchSrcA_f32, n * sizeof(float32_t));
+  arm_dct4_f32(&dct4F32, stateF32, benchDst_f32);
+}
+
+/*
+ * The Goertzel filter banks look for GOERTZEL_TONES tones in a signal of
+ * one of them plus noise. The sliding banks run over a window of
+ * GOERTZEL_WINDOW samples.
+ */
+#define GOERTZEL_TONES   8u
+#define GOERTZEL_WINDOW  256u
+
+static const float64_t goertzelFreqs[GOERTZEL_TONES] = {
+  0.0175, 0.053, 0.0871, 0.125, 0.2, 0.31, 0.4, 0.477
+};
+
+static arm_goertzel_instance_f32 goertzelF32;
+static arm_goertzel_instance_q31 goertzelQ31;
+static arm_goertzel_instance_q15 goertzelQ15;
+static arm_goertzel_sliding_instance_f32 slidingF32;
+static arm_goertzel_sliding_instance_q31 slidingQ31;
+static arm_goertzel_sliding_instance_q15 slidingQ15;
+static float32_t goertzelFreqF32[GOERTZEL_TONES];
+static q31_t goertzelFreqQ31[GOERTZEL_TONES];
+static q15_t goertzelFreqQ15[GOERTZEL_TONES];
+static float64_t goertzelFreqRef[GOERTZEL_TONES];
+static float32_t goertzelCoeffF32[4u * GOERTZEL_TONES];
+static float32_t goertzelStateF32[2u * GOERTZEL_TONES];
+static q31_t goertzelCoeffQ31[4u * GOERTZEL_TONES];
+static q31_t goertzelStateQ31[2u * GOERTZEL_TONES];
+static float32_t goertzelDelayF32[GOERTZEL_WINDOW];
+static q31_t goertzelDelayQ31[GOERTZEL_WINDOW];
+static q15_t goertzelDelayQ15[GOERTZEL_WINDOW];
+
+/*
+ * @brief  Makes n inputs of a tone at a quarter of full scale plus noise
+ *         in benchInA and the source buffer of the type, and quantizes
+ *         the frequencies into goertzelFreqRef.
+ */
+static void goertzel_input(
+  char type,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < GOERTZEL_TONES; i++)
+  {
+    goertzelFreqF32[i] = (float32_t) goertzelFreqs[i];
+    goertzelFreqQ31[i] = arm_bench_to_q31(goertzelFreqs[i]);
+    goertzelFreqQ15[i] = arm_bench_to_q15(goertzelFreqs[i]);
+
+    switch (type)
+    {
+    case 'f':
+      goertzelFreqRef[i] = goertzelFreqF32[i];
+      break;
+    case 'l':
+      goertzelFreqRef[i] = goertzelFreqQ31[i] / 2147483648.0;
+      break;
+    default:
+      goertzelFreqRef[i] = goertzelFreqQ15[i] / 32768.0;
+      break;
+    }
+  }
+
+  for (i = 0u; i < n; i++)
+  {
+    benchInA[i] = (0.25 * sin(2.0 * PI * goertzelFreqs[3] * i + 0.3)) + (0.25 * arm_bench_random());
+
+    switch (type)
+    {
+    case 'f':
+      benchSrcA_f32[i] = (float32_t) benchInA[i];
+      benchInA[i] = benchSrcA_f32[i];
+      break;
+    case 'l':
+      benchSrcA_q31[i] = arm_bench_to_q31(benchInA[i]);
+      benchInA[i] = benchSrcA_q31[i] / 2147483648.0;
+      break;
+    default:
+      benchSrcA_q15[i] = arm_bench_to_q15(benchInA[i]);
+      benchInA[i] = benchSrcA_q15[i] / 32768.0;
+      break;
+    }
+  }
+}
+
+/*
+ * @brief  DFT of the last len of n inputs at the goertzelFreqRef tones,
+ *         sum(x[i] * exp(j*w*(len-i))) with i = 0 for the oldest.
+ */
+static void goertzel_ref(
+  uint32_t n,
+  uint32_t len)
+{
+  const float64_t *pIn = benchInA + n - len;
+  float64_t w;
+  uint32_t i, k;
+
+  for (k = 0u; k < GOERTZEL_TONES; k++)
+  {
+    w = 2.0 * PI * goertzelFreqRef[k];
+    benchRef[2u * k] = 0.0;
+    benchRef[(2u * k) + 1u] = 0.0;
+
+    for (i = 0u; i < len; i++)
+    {
+      benchRef[2u * k] += pIn[i] * cos(w * (len - i));
+      benchRef[(2u * k) + 1u] += pIn[i] * sin(w * (len - i));
+    }
+  }
+}
+
+static uint32_t goertzel_f32_prepare(
+  uint32_t n)
+{
+  goertzel_input('f', n);
+  goertzel_ref(n, n);
+  arm_goertzel_init_f32(&goertzelF32, GOERTZEL_TONES, goertzelFreqF32, goertzelCoeffF32, goertzelStateF32);
+
+  return (output(2u * GOERTZEL_TONES, 1.0));
+}
+
+static void goertzel_f32_run(
+  uint32_t n)
+{
+  arm_goertzel_reset_f32(&goertzelF32);
+  arm_goertzel_f32(&goertzelF32, benchSrcA_f32, n);
+  arm_goertzel_dft_f32(&goertzelF32, benchDst_f32);
+}
+
+static uint32_t goertzel_q31_prepare(
+  uint32_t n)
+{
+  goertzel_input('l', n);
+  goertzel_ref(n, n);
+  arm_goertzel_init_q31(&goertzelQ31, GOERTZEL_TONES, goertzelFreqQ31, (uint16_t) n, goertzelCoeffQ31, goertzelStateQ31);
+
+  return (output(2u * GOERTZEL_TONES, ldexp(1.0, goertzelQ31.shift)));
+}
+
+static void goertzel_q31_run(
+  uint32_t n)
+{
+  arm_goertzel_reset_q31(&goertzelQ31);
+  arm_goertzel_q31(&goertzelQ31, benchSrcA_q31, n);
+  arm_goertzel_dft_q31(&goertzelQ31, benchDst_q31);
+}
+
+static uint32_t goertzel_q15_prepare(
+  uint32_t n)
+{
+  goertzel_input('s', n);
+  goertzel_ref(n, n);
+  arm_goertzel_init_q15(&goertzelQ15, GOERTZEL_TONES, goertzelFreqQ15, (uint16_t) n, goertzelCoeffQ31, goertzelStateQ31);
+
+  return (output(2u * GOERTZEL_TONES, ldexp(1.0, goertzelQ15.shift)));
+}
+
+static void goertzel_q15_run(
+  uint32_t n)
+{
+  arm_goertzel_reset_q15(&goertzelQ15);
+  arm_goertzel_q15(&goertzelQ15, benchSrcA_q15, n);
+  arm_goertzel_dft_q15(&goertzelQ15, benchDst_q15);
+}
+
+static uint32_t goertzel_sliding_f32_prepare(
+  uint32_t n)
+{
+  goertzel_input('f', n);
+  goertzel_ref(n, GOERTZEL_WINDOW);
+
+  return (output(2u * GOERTZEL_TONES, 1.0));
+}
+
+static void goertzel_sliding_f32_run(
+  uint32_t n)
+{
+  arm_goertzel_sliding_init_f32(&slidingF32, GOERTZEL_TONES, goertzelFreqF32, GOERTZEL_WINDOW,
+                                goertzelCoeffF32, goertzelStateF32, goertzelDelayF32);
+  arm_goertzel_sliding_f32(&slidingF32, benchSrcA_f32, n);
+  arm_goertzel_sliding_dft_f32(&slidingF32, benchDst_f32);
+}
+
+static uint32_t goertzel_sliding_q31_prepare(
+  uint32_t n)
+{
+  goertzel_input('l', n);
+  goertzel_ref(n, GOERTZEL_WINDOW);
+  arm_goertzel_sliding_init_q31(&slidingQ31, GOERTZEL_TONES, goertzelFreqQ31, GOERTZEL_WINDOW,
+                                goertzelCoeffQ31, goertzelStateQ31, goertzelDelayQ31);
+
+  return (output(2u * GOERTZEL_TONES, ldexp(1.0, slidingQ31.bank.shift)));
+}
+
+static void goertzel_sliding_q31_run(
+  uint32_t n)
+{
+  arm_goertzel_sliding_init_q31(&slidingQ31, GOERTZEL_TONES, goertzelFreqQ31, GOERTZEL_WINDOW,
+                                goertzelCoeffQ31, goertzelStateQ31, goertzelDelayQ31);
+  arm_goertzel_sliding_q31(&slidingQ31, benchSrcA_q31, n);
+  arm_goertzel_sliding_dft_q31(&slidingQ31, benchDst_q31);
+}
+
+static uint32_t goertzel_sliding_q15_prepare(
+  uint32_t n)
+{
+  goertzel_input('s', n);
+  goertzel_ref(n, GOERTZEL_WINDOW);
+  arm_goertzel_sliding_init_q15(&slidingQ15, GOERTZEL_TONES, goertzelFreqQ15, GOERTZEL_WINDOW,
+                                goertzelCoeffQ31, goertzelStateQ31, goertzelDelayQ15);
+
+  return (output(2u * GOERTZEL_TONES, ldexp(1.0, slidingQ15.bank.shift)));
+}
+
+static void goertzel_sliding_q15_run(
+  uint32_t n)
+{
+  arm_goertzel_sliding_init_q15(&slidingQ15, GOERTZEL_TONES, goertzelFreqQ15, GOERTZEL_WINDOW,
+                                goertzelCoeffQ31, goertzelStateQ31, goertzelDelayQ15);
+  arm_goertzel_sliding_q15(&slidingQ15, benchSrcA_q15, n);
+  arm_goertzel_sliding_dft_q15(&slidingQ15, benchDst_q15);
+}
+
+/*
+ * The MFCC cases run 13 cepstra from 24 mel bands of 256 point frames and
+ * the log-mel cases 40 bands of 512 point frames, both at 16 kHz, on two
+ * tones plus noise. n is the number of input samples.
+ */
+#define MFCC_MAX_FFT     512u
+#define MFCC_MAX_MELS    40u
+#define MFCC_FS          16000u
+
+typedef struct
+{
+  uint16_t fftLen;
+  uint16_t hopLen;
+  uint16_t numMels;
+  uint16_t numCeps;
+  float32_t fMin;
+  float32_t fMax;
+} mfcc_config;
+
+static const mfcc_config mfccCeps = { 256u, 128u, 24u, 13u, 0.0f, 8000.0f };
+static const mfcc_config mfccLogMel = { 512u, 160u, 40u, 0u, 20.0f, 7600.0f };
+
+static arm_mfcc_instance_f32 mfccF32;
+static arm_mfcc_instance_q15 mfccQ15;
+static float32_t mfccWindowF32[MFCC_MAX_FFT];
+static float32_t mfccWeightsF32[MFCC_MAX_FFT];
+static float32_t mfccDctF32[MFCC_MAX_MELS * MFCC_MAX_MELS];
+static float32_t mfccStateF32[MFCC_MAX_FFT];
+static float32_t mfccScratchF32[MFCC_MAX_FFT];
+static q15_t mfccWindowQ15[MFCC_MAX_FFT];
+static q15_t mfccWeightsQ15[MFCC_MAX_FFT];
+static q15_t mfccDctQ15[MFCC_MAX_MELS * MFCC_MAX_MELS];
+static q15_t mfccStateQ15[MFCC_MAX_FFT];
+static q31_t mfccScratchQ15[MFCC_MAX_FFT];
+static uint16_t mfccFilterPos[2u * MFCC_MAX_MELS];
+
+/*
+ * @brief  Makes n inputs of two tones plus noise in benchInA and the source
+ *         buffer of the type, and the features of each hop in benchRef.
+ * @return the number of outputs.
+ */
+static uint32_t mfcc_ref(
+  const mfcc_config * C,
+  char type,
+  uint32_t n)
+{
+  static float64_t frame[2u * MFCC_MAX_FFT], spectrum[2u * MFCC_MAX_FFT];
+  float64_t power[MFCC_MAX_FFT / 2u], logMel[MFCC_MAX_MELS];
+  float64_t melMin, melStep, mel, weight, sum;
+  uint32_t numOut = (C->numCeps == 0u) ? C->numMels : C->numCeps;
+  uint32_t numFrames = n / C->hopLen;
+  uint32_t f, i, k, m;
+  int32_t t;
+
+  for (i = 0u; i < n; i++)
+  {
+    benchInA[i] = (0.3 * sin(2.0 * PI * 440.0 * i / MFCC_FS)) + (0.2 * sin(2.0 * PI * 2730.0 * i / MFCC_FS + 1.0))
+      + (0.05 * arm_bench_random());
+
+    if(type == 'f')
+    {
+      benchSrcA_f32[i] = (float32_t) benchInA[i];
+      benchInA[i] = benchSrcA_f32[i];
+    }
+    else
+    {
+      benchSrcA_q15[i] = arm_bench_to_q15(benchInA[i]);
+      benchInA[i] = benchSrcA_q15[i] / 32768.0;
+    }
+  }
+
+  melMin = 1127.0 * log(1.0 + (C->fMin / 700.0));
+  melStep = ((1127.0 * log(1.0 + (C->fMax / 700.0))) - melMin) / (C->numMels + 1u);
+
+  for (f = 0u; f < numFrames; f++)
+  {
+    /* The last fftLen samples after f + 1 hops, zeros before the first */
+    for (i = 0u; i < C->fftLen; i++)
+    {
+      t = (int32_t) ((f + 1u) * C->hopLen) - (int32_t) C->fftLen + (int32_t) i;
+      frame[2u * i] = (t < 0) ? 0.0 : benchInA[t] * (0.5 - 0.5 * cos(2.0 * PI * i / C->fftLen));
+      frame[(2u * i) + 1u] = 0.0;
+    }
+
+    ref_dft(frame, spectrum, C->fftLen, 0);
+
+    for (k = 0u; k < C->fftLen / 2u; k++)
+    {
+      power[k] = (spectrum[2u * k] * spectrum[2u * k]) + (spectrum[(2u * k) + 1u] * spectrum[(2u * k) + 1u]);
+    }
+
+    for (m = 0u; m < C->numMels; m++)
+    {
+      sum = 0.0;
+
+      for (k = 0u; k < C->fftLen / 2u; k++)
+      {
+        mel = 1127.0 * log(1.0 + ((float64_t) k * MFCC_FS / (700.0 * C->fftLen)));
+        weight = (mel <= melMin + (m + 1u) * melStep) ? ((mel - melMin) / melStep - m)
+          : (m + 2u - (mel - melMin) / melStep);
+
+        if(weight > 0.0)
+        {
+          sum += weight * power[k];
+        }
+      }
+
+      logMel[m] = log((sum > 1e-12) ? sum : 1e-12);
+    }
+
+    for (k = 0u; k < numOut; k++)
+    {
+      if(C->numCeps == 0u)
+      {
+        benchRef[(f * numOut) + k] = logMel[k];
+        continue;
+      }
+
+      sum = 0.0;
+
+      for (m = 0u; m < C->numMels; m++)
+      {
+        sum += logMel[m] * cos(PI * k * (m + 0.5) / C->numMels);
+      }
+
+      benchRef[(f * numOut) + k] = sum * sqrt(((k == 0u) ? 1.0 : 2.0) / C->numMels);
+    }
+  }
+
+  return (numFrames * numOut);
+}
+
+static const mfcc_config *mfccConfig;
+
+static uint32_t mfcc_f32_prepare_config(
+  const mfcc_config * C,
+  uint32_t n)
+{
+  mfccConfig = C;
+  arm_mfcc_init_f32(&mfccF32, C->fftLen, C->hopLen, C->numMels, C->numCeps, MFCC_FS, C->fMin, C->fMax,
+                    mfccWindowF32, mfccWeightsF32, mfccFilterPos, mfccDctF32, mfccStateF32, mfccScratchF32);
+
+  return (output(mfcc_ref(C, 'f', n), 1.0));
+}
+
+static uint32_t mfcc_f32_prepare(
+  uint32_t n)
+{
+  return (mfcc_f32_prepare_config(&mfccCeps, n));
+}
+
+static uint32_t logmel_f32_prepare(
+  uint32_t n)
+{
+  return (mfcc_f32_prepare_config(&mfccLogMel, n));
+}
+
+static void mfcc_f32_run(
+  uint32_t n)
+{
+  uint32_t numOut = (mfccConfig->numCeps == 0u) ? mfccConfig->numMels : mfccConfig->numCeps;
+  uint32_t f;
+
+  arm_mfcc_reset_f32(&mfccF32);
+
+  for (f = 0u; f < n / mfccConfig->hopLen; f++)
+  {
+    arm_mfcc_f32(&mfccF32, benchSrcA_f32 + (f * mfccConfig->hopLen), benchDst_f32 + (f * numOut));
+  }
+}
+
+/*
+ * The Q15 features are in 8.8 format.
+ */
+static uint32_t mfcc_q15_prepare_config(
+  const mfcc_config * C,
+  uint32_t n)
+{
+  mfccConfig = C;
+  arm_mfcc_init_q15(&mfccQ15, C->fftLen, C->hopLen, C->numMels, C->numCeps, MFCC_FS, C->fMin, C->fMax,
+                    mfccWindowQ15, mfccWeightsQ15, mfccFilterPos, mfccDctQ15, mfccStateQ15, mfccScratchQ15);
+
+  return (output(mfcc_ref(C, 's', n), 128.0));
+}
+
+static uint32_t mfcc_q15_prepare(
+  uint32_t n)
+{
+  return (mfcc_q15_prepare_config(&mfccCeps, n));
+}
+
+static uint32_t logmel_q15_prepare(
+  uint32_t n)
+{
+  return (mfcc_q15_prepare_config(&mfccLogMel, n));
+}
+
+static void mfcc_q15_run(
+  uint32_t n)
+{
+  uint32_t numOut = (mfccConfig->numCeps == 0u) ? mfccConfig->numMels : mfccConfig->numCeps;
+  uint32_t f;
+
+  arm_mfcc_reset_q15(&mfccQ15);
+
+  for (f = 0u; f < n / mfccConfig->hopLen; f++)
+  {
+    arm_mfcc_q15(&mfccQ15, benchSrcA_q15 + (f * mfccConfig->hopLen), benchDst_q15 + (f * numOut));
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Neural network. The references requantise in double precision with the
+* rounding and saturation of the layers, so the layers are bit exact.
+* ------------------------------------------------------------------- */
+#define NN_MAX_WEIGHTS   (33u * 1024u)
+#define NN_MAX_CH        16u
+#define NN_FC_ROWS       33u
+#define NN_CONV_CH_IN    8u
+#define NN_CONV_CH_OUT   16u
+#define NN_PW_CH_IN      13u
+#define NN_DW_CH         10u
+
+static q7_t nnWeightsQ7[NN_MAX_WEIGHTS];
+static q15_t nnWeightsQ15[NN_MAX_WEIGHTS];
+static q7_t nnBiasQ7[NN_MAX_CH * 4u];
+static q15_t nnBiasQ15[NN_MAX_CH * 4u];
+static float64_t nnWeights[NN_MAX_WEIGHTS];
+static float64_t nnBias[NN_MAX_CH * 4u];
+static q15_t nnBuffer[1024u];
+static char nnType;
+static uint16_t nnBiasShift, nnOutShift;
+
+/*
+ * @brief  Random Q7 or Q15 values of the type over their full range, with
+ *         their integer values in pRef.
+ */
+static void nn_values(
+  char type,
+  float64_t * pRef,
+  q7_t * pQ7,
+  q15_t * pQ15,
+  uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    if(type == 'b')
+    {
+      pQ7[i] = arm_bench_to_q7(arm_bench_random());
+      pRef[i] = pQ7[i];
+    }
+    else
+    {
+      pQ15[i] = arm_bench_to_q15(arm_bench_random());
+      pRef[i] = pQ15[i];
+    }
+  }
+}
+
+/*
+ * @brief  Inputs of the type in benchInA and the source buffer, weights
+ *         and bias, and shifts that keep sums of numProducts products in
+ *         range of the output.
+ */
+static void nn_layer(
+  char type,
+  uint32_t numIn,
+  uint32_t numWeights,
+  uint32_t numBias,
+  uint32_t numProducts)
+{
+  float64_t fullScale = (type == 'b') ? 128.0 : 32768.0;
+  float64_t rms = fullScale / sqrt(3.0);
+
+  nnType = type;
+  nn_values(type, benchInA, benchSrcA_q7, benchSrcA_q15, numIn);
+  nn_values(type, nnWeights, nnWeightsQ7, nnWeightsQ15, numWeights);
+  nn_values(type, nnBias, nnBiasQ7, nnBiasQ15, numBias);
+
+  /* The sums have a standard deviation of sqrt(numProducts) * rms^2, scaled to a third of full scale */
+  nnOutShift = (uint16_t) ceil(log2(3.0 * sqrt((float64_t) numProducts) * rms * rms / fullScale));
+  nnBiasShift = (uint16_t) (nnOutShift - 1u);
+}
+
+/*
+ * @brief  Sum of a layer requantised as the layers do, as a fraction.
+ */
+static float64_t nn_requantize(
+  float64_t sum)
+{
+  float64_t fullScale = (nnType == 'b') ? 128.0 : 32768.0;
+  float64_t out;
+
+  out = floor((sum / ldexp(1.0, nnOutShift)) + 0.5);
+  out = (out > fullScale - 1.0) ? (fullScale - 1.0) : ((out < -fullScale) ? -fullScale : out);
+
+  return (out / fullScale);
+}
+
+/*
+ * @brief  Output size of an image layer.
+ */
+static uint32_t nn_dim_out(
+  uint32_t dimIn,
+  uint32_t dimKernel,
+  uint32_t padding,
+  uint32_t stride)
+{
+  return (((dimIn + (2u * padding) - dimKernel) / stride) + 1u);
+}
+
+/*
+ * @brief  Convolution of the image in benchInA with the kernels in
+ *         nnWeights. A depthwise convolution has one input channel per
+ *         output channel.
+ * @return the number of outputs.
+ */
+static uint32_t nn_conv_ref(
+  uint32_t dimIn,
+  uint32_t chIn,
+  uint32_t chOut,
+  uint32_t dimKernel,
+  uint32_t padding,
+  uint32_t stride,
+  uint32_t depthwise)
+{
+  uint32_t dimOut = nn_dim_out(dimIn, dimKernel, padding, stride);
+  uint32_t outX, outY, o, ky, kx, c;
+  int32_t x, y;
+  float64_t sum;
+
+  for (outY = 0u; outY < dimOut; outY++)
+  {
+    for (outX = 0u; outX < dimOut; outX++)
+    {
+      for (o = 0u; o < chOut; o++)
+      {
+        sum = ldexp(nnBias[o], nnBiasShift);
+
+        for (ky = 0u; ky < dimKernel; ky++)
+        {
+          for (kx = 0u; kx < dimKernel; kx++)
+          {
+            y = (int32_t) (outY * stride + ky) - (int32_t) padding;
+            x = (int32_t) (outX * stride + kx) - (int32_t) padding;
+
+            if((y < 0) || (y >= (int32_t) dimIn) || (x < 0) || (x >= (int32_t) dimIn))
+            {
+              continue;
+            }
+
+            if(depthwise)
+            {
+              sum += benchInA[(y * dimIn + x) * chIn + o] * nnWeights[(ky * dimKernel + kx) * chIn + o];
+              continue;
+            }
+
+            for (c = 0u; c < chIn; c++)
+            {
+              sum += benchInA[(y * dimIn + x) * chIn + c]
+                * nnWeights[((o * dimKernel + ky) * dimKernel + kx) * chIn + c];
+            }
+          }
+        }
+
+        benchRef[(outY * dimOut + outX) * chOut + o] = nn_requantize(sum);
+      }
+    }
+  }
+
+  return (dimOut * dimOut * chOut);
+}
+
+static uint32_t nn_fc_prepare(
+  char type,
+  uint32_t n)
+{
+  uint32_t r, c;
+  float64_t sum;
+
+  nn_layer(type, n, NN_FC_ROWS * n, NN_FC_ROWS, n);
+
+  for (r = 0u; r < NN_FC_ROWS; r++)
+  {
+    sum = ldexp(nnBias[r], nnBiasShift);
+
+    for (c = 0u; c < n; c++)
+    {
+      sum += nnWeights[r * n + c] * benchInA[c];
+    }
+
+    benchRef[r] = nn_requantize(sum);
+  }
+
+  return (output(NN_FC_ROWS, 1.0));
+}
+
+static uint32_t nn_fc_q7_prepare(
+  uint32_t n)
+{
+  return (nn_fc_prepare('b', n));
+}
+
+static void nn_fc_q7_run(
+  uint32_t n)
+{
+  arm_nn_fully_connected_q7(benchSrcA_q7, nnWeightsQ7, (uint16_t) n, NN_FC_ROWS, nnBiasShift, nnOutShift,
+                            nnBiasQ7, benchDst_q7, nnBuffer);
+}
+
+static uint32_t nn_fc_q15_prepare(
+  uint32_t n)
+{
+  return (nn_fc_prepare('h', n));
+}
+
+static void nn_fc_q15_run(
+  uint32_t n)
+{
+  arm_nn_fully_connected_q15(benchSrcA_q15, nnWeightsQ15, (uint16_t) n, NN_FC_ROWS, nnBiasShift, nnOutShift,
+                             nnBiasQ15, benchDst_q15);
+}
+
+/*
+ * The convolutions take images of n x n pixels: a 3 x 3 convolution with
+ * padding 1, a pointwise convolution and a 3 x 3 depthwise convolution
+ * with stride 2. The channel counts are not all multiples of four.
+ */
+static uint32_t nn_conv_prepare(
+  char type,
+  uint32_t n)
+{
+  nn_layer(type, n * n * NN_CONV_CH_IN, NN_CONV_CH_OUT * 9u * NN_CONV_CH_IN, NN_CONV_CH_OUT, 9u * NN_CONV_CH_IN);
+
+  return (output(nn_conv_ref(n, NN_CONV_CH_IN, NN_CONV_CH_OUT, 3u, 1u, 1u, 0u), 1.0));
+}
+
+static uint32_t nn_conv_q7_prepare(
+  uint32_t n)
+{
+  return (nn_conv_prepare('b', n));
+}
+
+static void nn_conv_q7_run(
+  uint32_t n)
+{
+  arm_nn_conv_hwc_q7(benchSrcA_q7, (uint16_t) n, NN_CONV_CH_IN, nnWeightsQ7, NN_CONV_CH_OUT, 3u, 1u, 1u,
+                     nnBiasQ7, nnBiasShift, nnOutShift, benchDst_q7, nnBuffer);
+}
+
+static uint32_t nn_conv_q15_prepare(
+  uint32_t n)
+{
+  return (nn_conv_prepare('h', n));
+}
+
+static void nn_conv_q15_run(
+  uint32_t n)
+{
+  arm_nn_conv_hwc_q15(benchSrcA_q15, (uint16_t) n, NN_CONV_CH_IN, nnWeightsQ15, NN_CONV_CH_OUT, 3u, 1u, 1u,
+                      nnBiasQ15, nnBiasShift, nnOutShift, benchDst_q15, nnBuffer);
+}
+
+static uint32_t nn_conv_1x1_prepare(
+  char type,
+  uint32_t n)
+{
+  nn_layer(type, n * n * NN_PW_CH_IN, NN_CONV_CH_OUT * NN_PW_CH_IN, NN_CONV_CH_OUT, NN_PW_CH_IN);
+
+  return (output(nn_conv_ref(n, NN_PW_CH_IN, NN_CONV_CH_OUT, 1u, 0u, 1u, 0u), 1.0));
+}
+
+static uint32_t nn_conv_1x1_q7_prepare(
+  uint32_t n)
+{
+  return (nn_conv_1x1_prepare('b', n));
+}
+
+static void nn_conv_1x1_q7_run(
+  uint32_t n)
+{
+  arm_nn_conv_1x1_hwc_q7(benchSrcA_q7, (uint16_t) n, NN_PW_CH_IN, nnWeightsQ7, NN_CONV_CH_OUT,
+                         nnBiasQ7, nnBiasShift, nnOutShift, benchDst_q7, nnBuffer);
+}
+
+static uint32_t nn_conv_1x1_q15_prepare(
+  uint32_t n)
+{
+  return (nn_conv_1x1_prepare('h', n));
+}
+
+static void nn_conv_1x1_q15_run(
+  uint32_t n)
+{
+  arm_nn_conv_1x1_hwc_q15(benchSrcA_q15, (uint16_t) n, NN_PW_CH_IN, nnWeightsQ15, NN_CONV_CH_OUT,
+                          nnBiasQ15, nnBiasShift, nnOutShift, benchDst_q15);
+}
+
+static uint32_t nn_depthwise_prepare(
+  char type,
+  uint32_t n)
+{
+  nn_layer(type, n * n * NN_DW_CH, 9u * NN_DW_CH, NN_DW_CH, 9u);
+
+  return (output(nn_conv_ref(n, NN_DW_CH, NN_DW_CH, 3u, 1u, 2u, 1u), 1.0));
+}
+
+static uint32_t nn_depthwise_q7_prepare(
+  uint32_t n)
+{
+  return (nn_depthwise_prepare('b', n));
+}
+
+static void nn_depthwise_q7_run(
+  uint32_t n)
+{
+  arm_nn_depthwise_conv_hwc_q7(benchSrcA_q7, (uint16_t) n, NN_DW_CH, nnWeightsQ7, 3u, 1u, 2u,
+                               nnBiasQ7, nnBiasShift, nnOutShift, benchDst_q7);
+}
+
+static uint32_t nn_depthwise_q15_prepare(
+  uint32_t n)
+{
+  return (nn_depthwise_prepare('h', n));
+}
+
+static void nn_depthwise_q15_run(
+  uint32_t n)
+{
+  arm_nn_depthwise_conv_hwc_q15(benchSrcA_q15, (uint16_t) n, NN_DW_CH, nnWeightsQ15, 3u, 1u, 2u,
+                                nnBiasQ15, nnBiasShift, nnOutShift, benchDst_q15);
+}
+
+/*
+ * @brief  3 x 3 pooling with stride 2 and padding 1 of the n x n image in
+ *         benchInA, the padding left out of the windows.
+ */
+static uint32_t nn_pool_prepare(
+  char type,
+  uint32_t n,
+  uint32_t average)
+{
+  float64_t fullScale = (type == 'b') ? 128.0 : 32768.0;
+  uint32_t dimOut = nn_dim_out(n, 3u, 1u, 2u);
+  uint32_t outX, outY, c, count;
+  int32_t x, y;
+  float64_t sum, max;
+
+  nn_values(type, benchInA, benchSrcA_q7, benchSrcA_q15, n * n * NN_DW_CH);
+
+  for (outY = 0u; outY < dimOut; outY++)
+  {
+    for (outX = 0u; outX < dimOut; outX++)
+    {
+      for (c = 0u; c < NN_DW_CH; c++)
+      {
+        sum = 0.0;
+        max = -fullScale;
+        count = 0u;
+
+        for (y = (int32_t) (2u * outY) - 1; y < (int32_t) (2u * outY) + 2; y++)
+        {
+          for (x = (int32_t) (2u * outX) - 1; x < (int32_t) (2u * outX) + 2; x++)
+          {
+            if((y >= 0) && (y < (int32_t) n) && (x >= 0) && (x < (int32_t) n))
+            {
+              sum += benchInA[(y * n + x) * NN_DW_CH + c];
+              max = (benchInA[(y * n + x) * NN_DW_CH + c] > max) ? benchInA[(y * n + x) * NN_DW_CH + c] : max;
+              count++;
+            }
+          }
+        }
+
+        /* Rounded away from zero at one half */
+        sum = (sum < 0.0) ? -floor((-sum / count) + 0.5) : floor((sum / count) + 0.5);
+        benchRef[(outY * dimOut + outX) * NN_DW_CH + c] = (average ? sum : max) / fullScale;
+      }
+    }
+  }
+
+  return (output(dimOut * dimOut * NN_DW_CH, 1.0));
+}
+
+static uint32_t nn_maxpool_q7_prepare(
+  uint32_t n)
+{
+  return (nn_pool_prepare('b', n, 0u));
+}
+
+static void nn_maxpool_q7_run(
+  uint32_t n)
+{
+  arm_nn_maxpool_hwc_q7(benchSrcA_q7, (uint16_t) n, NN_DW_CH, 3u, 1u, 2u, benchDst_q7);
+}
+
+static uint32_t nn_maxpool_q15_prepare(
+  uint32_t n)
+{
+  return (nn_pool_prepare('h', n, 0u));
+}
+
+static void nn_maxpool_q15_run(
+  uint32_t n)
+{
+  arm_nn_maxpool_hwc_q15(benchSrcA_q15, (uint16_t) n, NN_DW_CH, 3u, 1u, 2u, benchDst_q15);
+}
+
+static uint32_t nn_avgpool_q7_prepare(
+  uint32_t n)
+{
+  return (nn_pool_prepare('b', n, 1u));
+}
+
+static void nn_avgpool_q7_run(
+  uint32_t n)
+{
+  arm_nn_avgpool_hwc_q7(benchSrcA_q7, (uint16_t) n, NN_DW_CH, 3u, 1u, 2u, benchDst_q7);
+}
+
+static uint32_t nn_avgpool_q15_prepare(
+  uint32_t n)
+{
+  return (nn_pool_prepare('h', n, 1u));
+}
+
+static void nn_avgpool_q15_run(
+  uint32_t n)
+{
+  arm_nn_avgpool_hwc_q15(benchSrcA_q15, (uint16_t) n, NN_DW_CH, 3u, 1u, 2u, benchDst_q15);
+}
+
+static uint32_t nn_relu_q7_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q7(benchSrcA_q7, benchInA, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = (benchInA[i] < 0.0) ? 0.0 : benchInA[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void nn_relu_q7_run(
+  uint32_t n)
+{
+  arm_nn_relu_q7(benchSrcA_q7, benchDst_q7, n);
+}
+
+static uint32_t nn_relu_q15_prepare(
+  uint32_t n)
+{
+  uint32_t i;
+
+  arm_bench_random_q15(benchSrcA_q15, benchInA, 1.0, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = (benchInA[i] < 0.0) ? 0.0 : benchInA[i];
+  }
+
+  return (output(n, 1.0));
+}
+
+static void nn_relu_q15_run(
+  uint32_t n)
+{
+  arm_nn_relu_q15(benchSrcA_q15, benchDst_q15, n);
+}
+
+/*
+ * The softmax inputs have NN_SOFTMAX_FRAC fractional bits in Q7 and
+ * NN_SOFTMAX_FRAC + 8 in Q15, and span 8 powers of two.
+ */
+#define NN_SOFTMAX_FRAC  4u
+
+static uint32_t nn_softmax_prepare(
+  char type,
+  uint32_t n)
+{
+  uint32_t fracBits = (type == 'b') ? NN_SOFTMAX_FRAC : (NN_SOFTMAX_FRAC + 8u);
+  float64_t sum = 0.0;
+  uint32_t i;
+
+  nn_values(type, benchInA, benchSrcA_q7, benchSrcA_q15, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    sum += pow(2.0, benchInA[i] / ldexp(1.0, fracBits));
+  }
+
+  for (i = 0u; i < n; i++)
+  {
+    benchRef[i] = pow(2.0, benchInA[i] / ldexp(1.0, fracBits)) / sum;
+  }
+
+  return (output(n, 1.0));
+}
+
+static uint32_t nn_softmax_q7_prepare(
+  uint32_t n)
+{
+  return (nn_softmax_prepare('b', n));
+}
+
+static void nn_softmax_q7_run(
+  uint32_t n)
+{
+  arm_nn_softmax_q7(benchSrcA_q7, benchDst_q7, n, NN_SOFTMAX_FRAC);
+}
+
+static uint32_t nn_softmax_q15_prepare(
+  uint32_t n)
+{
+  return (nn_softmax_prepare('h', n));
+}
+
+static void nn_softmax_q15_run(
+  uint32_t n)
+{
+  arm_nn_softmax_q15(benchSrcA_q15, benchDst_q15, n, NN_SOFTMAX_FRAC + 8u);
+}
+
+/* ----------------------------------------------------------------------
+* Test cases
+* ------------------------------------------------------------------- */
+const arm_bench_case benchCases[] = {
+  { "Basic", "arm_add_f32", sizesBlock, 140.0, add_f32_prepare, add_f32_run, result_dst_f32 },
+  { "Basic", "arm_add_q31", sizesBlock, 180.0, add_q31_prepare, add_q31_run, result_dst_q31 },
+  { "Basic", "arm_add_q15", sizesBlock, 90.0, add_q15_prepare, add_q15_run, result_dst_q15 },
+  { "Basic", "arm_add_q7", sizesBlock, 40.0, add_q7_prepare, add_q7_run, result_dst_q7 },
+  { "Basic", "arm_mult_f32", sizesBlock, 140.0, mult_f32_prepare, mult_f32_run, result_dst_f32 },
+  { "Basic", "arm_mult_q31", sizesBlock, 170.0, mult_q31_prepare, mult_q31_run, result_dst_q31 },
+  { "Basic", "arm_mult_q15", sizesBlock, 80.0, mult_q15_prepare, mult_q15_run, result_dst_q15 },
+  { "Basic", "arm_mult_q7", sizesBlock, 30.0, mult_q7_prepare, mult_q7_run, result_dst_q7 },
+  { "Basic", "arm_scale_f32", sizesBlock, 140.0, scale_f32_prepare, scale_f32_run, result_dst_f32 },
+  { "Basic", "arm_scale_q31", sizesBlock, 160.0, scale_q31_prepare, scale_q31_run, result_dst_q31 },
+  { "Basic", "arm_scale_q15", sizesBlock, 80.0, scale_q15_prepare, scale_q15_run, result_dst_q15 },
+  { "Basic", "arm_shift_q15", sizesBlock, 90.0, shift_q15_prepare, shift_q15_run, result_dst_q15 },
+  { "Basic", "arm_abs_q15", sizesBlock, 90.0, abs_q15_prepare, abs_q15_run, result_dst_q15 },
+  { "Basic", "arm_negate_q31", sizesBlock, 170.0, negate_q31_prepare, negate_q31_run, result_dst_q31 },
+  { "Basic", "arm_offset_f32", sizesBlock, 140.0, offset_f32_prepare, offset_f32_run, result_dst_f32 },
+  { "Basic", "arm_dot_prod_f32", sizesBlock, 100.0, dot_prod_f32_prepare, dot_prod_f32_run, dot_prod_f32_result },
+  { "Basic", "arm_dot_prod_q31", sizesBlock, 120.0, dot_prod_q31_prepare, dot_prod_q31_run, dot_prod_q31_result },
+  { "Basic", "arm_dot_prod_q15", sizesBlock, 120.0, dot_prod_q15_prepare, dot_prod_q15_run, dot_prod_q15_result },
+  { "Basic", "arm_dot_prod_q7", sizesBlock, 120.0, dot_prod_q7_prepare, dot_prod_q7_run, dot_prod_q7_result },
+
+  { "Complex", "arm_cmplx_mult_cmplx_f32", sizesBlock, 140.0, cmplx_mult_cmplx_f32_prepare, cmplx_mult_cmplx_f32_run, result_dst_f32 },
+  { "Complex", "arm_cmplx_mult_cmplx_q31", sizesBlock, 150.0, cmplx_mult_cmplx_q31_prepare, cmplx_mult_cmplx_q31_run, result_dst_q31 },
+  { "Complex", "arm_cmplx_mult_cmplx_q15", sizesBlock, 70.0, cmplx_mult_cmplx_q15_prepare, cmplx_mult_cmplx_q15_run, result_dst_q15 },
+  { "Complex", "arm_cmplx_mag_f32", sizesBlock, 140.0, cmplx_mag_f32_prepare, cmplx_mag_f32_run, result_dst_f32 },
+  { "Complex", "arm_cmplx_mag_q31", sizesBlock, 150.0, cmplx_mag_q31_prepare, cmplx_mag_q31_run, result_dst_q31 },
+  { "Complex", "arm_cmplx_mag_q15", sizesBlock, 70.0, cmplx_mag_q15_prepare, cmplx_mag_q15_run, result_dst_q15 },
+  { "Complex", "arm_cmplx_mag_squared_q15", sizesBlock, 70.0, cmplx_mag_squared_q15_prepare, cmplx_mag_squared_q15_run, result_dst_q15 },
+  { "Complex", "arm_cmplx_conj_q31", sizesBlock, 170.0, cmplx_conj_q31_prepare, cmplx_conj_q31_run, result_dst_q31 },
+  { "Complex", "arm_cmplx_dot_prod_f32", sizesBlock, 100.0, cmplx_dot_prod_f32_prepare, cmplx_dot_prod_f32_run, cmplx_dot_prod_f32_result },
+
+  { "Controller", "arm_sin_cos_f32", sizesBlock, 80.0, sin_cos_f32_prepare, sin_cos_f32_run, result_dst_f32 },
+  { "Controller", "arm_sin_cos_q31", sizesBlock, 80.0, sin_cos_q31_prepare, sin_cos_q31_run, result_dst_q31 },
+  { "Controller", "arm_pid_f32", sizesBlock, 100.0, pid_f32_prepare, pid_f32_run, result_dst_f32 },
+  { "Controller", "arm_pid_q31", sizesBlock, 80.0, pid_q31_prepare, pid_q31_run, result_dst_q31 },
+  { "Controller", "arm_kalman_f32", sizesKalman, 120.0, kalman_f32_prepare, kalman_f32_run, result_dst_f32 },
+  { "Controller", "arm_kalman_q31", sizesKalman, 130.0, kalman_q31_prepare, kalman_q31_run, result_dst_q31 },
+
+  { "FastMath", "arm_sin_f32", sizesBlock, 80.0, sin_f32_prepare, sin_f32_run, result_dst_f32 },
+  { "FastMath", "arm_cos_f32", sizesBlock, 80.0, cos_f32_prepare, cos_f32_run, result_dst_f32 },
+  { "FastMath", "arm_sin_q31", sizesBlock, 80.0, sin_q31_prepare, sin_q31_run, result_dst_q31 },
+  { "FastMath", "arm_cos_q15", sizesBlock, 70.0, cos_q15_prepare, cos_q15_run, result_dst_q15 },
+  { "FastMath", "arm_sqrt_q31", sizesBlock, 120.0, sqrt_q31_prepare, sqrt_q31_run, result_dst_q31 },
+  { "FastMath", "arm_sqrt_q15", sizesBlock, 80.0, sqrt_q15_prepare, sqrt_q15_run, result_dst_q15 },
+
+  { "Filtering", "arm_fir_f32", sizesFilter, 130.0, fir_f32_prepare, fir_f32_run, result_dst_f32 },
+  { "Filtering", "arm_fir_q31", sizesFilter, 150.0, fir_q31_prepare, fir_q31_run, result_dst_q31 },
+  { "Filtering", "arm_fir_fast_q31", sizesFilter, 130.0, fir_q31_prepare, fir_fast_q31_run, result_dst_q31 },
+  { "Filtering", "arm_fir_q15", sizesFilter, 80.0, fir_q15_prepare, fir_q15_run, result_dst_q15 },
+  { "Filtering", "arm_fir_fast_q15", sizesFilter, 80.0, fir_q15_prepare, fir_fast_q15_run, result_dst_q15 },
+  { "Filtering", "arm_fir_q7", sizesFilter, 30.0, fir_q7_prepare, fir_q7_run, result_dst_q7 },
+  { "Filtering", "arm_fir_f32 500 taps", sizesFirFft, 120.0, fir_long_f32_prepare, fir_long_f32_run, result_dst_f32 },
+  { "Filtering", "arm_fir_fft_f32", sizesFirFft, 120.0, fir_fft_f32_prepare, fir_fft_f32_run, result_dst_f32 },
+  { "Filtering", "arm_fir_fft_q31", sizesFirFft, 105.0, fir_fft_q31_prepare, fir_fft_q31_run, result_dst_q31 },
+  { "Filtering", "arm_fir_fft_q15", sizesFirFft, 65.0, fir_fft_q15_prepare, fir_fft_q15_run, result_dst_q15 },
+  { "Filtering", "arm_fir_decimate_f32", sizesFilter, 130.0, fir_decimate_f32_prepare, fir_decimate_f32_run, result_dst_f32 },
+  { "Filtering", "arm_fir_decimate_q15", sizesFilter, 70.0, fir_decimate_q15_prepare, fir_decimate_q15_run, result_dst_q15 },
+  { "Filtering", "arm_fir_interpolate_f32", sizesInterp, 130.0, fir_interpolate_f32_prepare, fir_interpolate_f32_run, result_dst_f32 },
+  { "Filtering", "arm_fir_resample_f32 160/441", sizesResample, 120.0, fir_resample_f32_prepare, fir_resample_f32_run, result_dst_f32 },
+  { "Filtering", "arm_fir_resample_q15 160/441", sizesResample, 70.0, fir_resample_q15_prepare, fir_resample_q15_run, result_dst_q15 },
+  { "Filtering", "arm_fir_farrow_f32", sizesResample, 120.0, fir_farrow_f32_prepare, fir_farrow_f32_run, result_dst_f32 },
+  { "Filtering", "arm_fir_farrow_q15", sizesResample, 70.0, fir_farrow_q15_prepare, fir_farrow_q15_run, result_dst_q15 },
+  { "Filtering", "arm_biquad_cascade_df1_f32", sizesFilter, 120.0, biquad_cascade_df1_f32_prepare, biquad_cascade_df1_f32_run, result_dst_f32 },
+  { "Filtering", "arm_biquad_cascade_df2T_f32", sizesFilter, 120.0, biquad_cascade_df2T_f32_prepare, biquad_cascade_df2T_f32_run, result_dst_f32 },
+  { "Filtering", "arm_biquad_cascade_df1_q31", sizesFilter, 120.0, biquad_cascade_df1_q31_prepare, biquad_cascade_df1_q31_run, result_dst_q31 },
+  { "Filtering", "arm_biquad_cascade_df1_fast_q31", sizesFilter, 120.0, biquad_cascade_df1_q31_prepare, biquad_cascade_df1_fast_q31_run, result_dst_q31 },
+  { "Filtering", "arm_biquad_cas_df1_32x64_q31", sizesFilter, 120.0, biquad_cas_df1_32x64_q31_prepare, biquad_cas_df1_32x64_q31_run, result_dst_q31 },
+  { "Filtering", "arm_biquad_cascade_df1_q15", sizesFilter, 60.0, biquad_cascade_df1_q15_prepare, biquad_cascade_df1_q15_run, result_dst_q15 },
+  { "Filtering", "arm_biquad_cascade_df1_fast_q15", sizesFilter, 60.0, biquad_cascade_df1_q15_prepare, biquad_cascade_df1_fast_q15_run, result_dst_q15 },
+  { "Filtering", "arm_biquad_cascade_df2T_q31", sizesFilter, 120.0, biquad_cascade_df2T_q31_prepare, biquad_cascade_df2T_q31_run, result_dst_q31 },
+  { "Filtering", "arm_biquad_cascade_df2T_q15", sizesFilter, 60.0, biquad_cascade_df2T_q15_prepare, biquad_cascade_df2T_q15_run, result_dst_q15 },
+  { "Filtering", "arm_biquad_cascade_mc_df2T_f32", sizesInterp, 120.0, biquad_cascade_mc_df2T_f32_prepare, biquad_cascade_mc_df2T_f32_run, result_dst_f32 },
+  { "Filtering", "arm_biquad_cascade_mc_df2T_q31", sizesInterp, 120.0, biquad_cascade_mc_df2T_q31_prepare, biquad_cascade_mc_df2T_q31_run, result_dst_q31 },
+  { "Filtering", "arm_biquad_cascade_mc_df2T_q15", sizesInterp, 55.0, biquad_cascade_mc_df2T_q15_prepare, biquad_cascade_mc_df2T_q15_run, result_dst_q15 },
+  { "Filtering", "arm_conv_f32", sizesConv, 130.0, conv_f32_prepare, conv_f32_run, result_dst_f32 },
+  { "Filtering", "arm_conv_q31", sizesConv, 150.0, conv_q31_prepare, conv_q31_run, result_dst_q31 },
+  { "Filtering", "arm_conv_fast_q31", sizesConv, 130.0, conv_q31_prepare, conv_fast_q31_run, result_dst_q31 },
+  { "Filtering", "arm_conv_q15", sizesConv, 70.0, conv_q15_prepare, conv_q15_run, result_dst_q15 },
+  { "Filtering", "arm_conv_fast_q15", sizesConv, 70.0, conv_q15_prepare, conv_fast_q15_run, result_dst_q15 },
+  { "Filtering", "arm_conv_opt_q15", sizesConv, 70.0, conv_q15_prepare, conv_opt_q15_run, result_dst_q15 },
+  { "Filtering", "arm_conv_q7", sizesConv, 20.0, conv_q7_prepare, conv_q7_run, result_dst_q7 },
+  { "Filtering", "arm_correlate_f32", sizesConv, 130.0, correlate_f32_prepare, correlate_f32_run, result_dst_f32 },
+  { "Filtering", "arm_lms_f32", sizesFilter, 100.0, lms_f32_prepare, lms_f32_run, result_dst_f32 },
+
+  { "Matrix", "arm_mat_mult_f32", sizesMatrix, 130.0, mat_mult_f32_prepare, mat_mult_f32_run, result_dst_f32 },
+  { "Matrix", "arm_mat_mult_q31", sizesMatrix, 150.0, mat_mult_q31_prepare, mat_mult_q31_run, result_dst_q31 },
+  { "Matrix", "arm_mat_mult_fast_q31", sizesMatrix, 120.0, mat_mult_q31_prepare, mat_mult_fast_q31_run, result_dst_q31 },
+  { "Matrix", "arm_mat_mult_q15", sizesMatrix, 70.0, mat_mult_q15_prepare, mat_mult_q15_run, result_dst_q15 },
+  { "Matrix", "arm_mat_mult_fast_q15", sizesMatrix, 70.0, mat_mult_q15_prepare, mat_mult_fast_q15_run, result_dst_q15 },
+  { "Matrix", "arm_mat_add_f32", sizesMatrix, 140.0, mat_add_f32_prepare, mat_add_f32_run, result_dst_f32 },
+  { "Matrix", "arm_mat_scale_q31", sizesMatrix, 170.0, mat_scale_q31_prepare, mat_scale_q31_run, result_dst_q31 },
+  { "Matrix", "arm_mat_trans_q15", sizesMatrix, 90.0, mat_trans_q15_prepare, mat_trans_q15_run, result_dst_q15 },
+  { "Matrix", "arm_mat_inverse_f32", sizesMatrix, 110.0, mat_inverse_f32_prepare, mat_inverse_f32_run, result_dst_f32 },
+  { "Matrix", "arm_mat_cholesky_f32", sizesMatrix, 120.0, mat_cholesky_f32_prepare, mat_cholesky_f32_run, mat_cholesky_f32_result },
+  { "Matrix", "arm_mat_cholesky_q31", sizesMatrix, 140.0, mat_cholesky_q31_prepare, mat_cholesky_q31_run, mat_cholesky_q31_result },
+  { "Matrix", "arm_mat_cholesky_solve_f32", sizesMatrix, 120.0, mat_cholesky_solve_f32_prepare, mat_cholesky_solve_f32_run, result_dst_f32 },
+  { "Matrix", "arm_mat_cholesky_solve_q31", sizesMatrix, 110.0, mat_cholesky_solve_q31_prepare, mat_cholesky_solve_q31_run, result_dst_q31 },
+  { "Matrix", "arm_mat_ldlt_f32", sizesMatrix, 120.0, mat_cholesky_f32_prepare, mat_ldlt_f32_run, mat_ldlt_f32_result },
+  { "Matrix", "arm_mat_ldlt_q31", sizesMatrix, 140.0, mat_cholesky_q31_prepare, mat_ldlt_q31_run, mat_ldlt_q31_result },
+  { "Matrix", "arm_mat_ldlt_solve_f32", sizesMatrix, 120.0, mat_ldlt_solve_f32_prepare, mat_ldlt_solve_f32_run, result_dst_f32 },
+  { "Matrix", "arm_mat_ldlt_solve_q31", sizesMatrix, 110.0, mat_ldlt_solve_q31_prepare, mat_ldlt_solve_q31_run, result_dst_q31 },
+  { "Matrix", "arm_mat_lu_f32", sizesMatrix, 120.0, mat_lu_f32_prepare, mat_lu_f32_run, mat_lu_f32_result },
+  { "Matrix", "arm_mat_lu_q31", sizesMatrix, 140.0, mat_lu_q31_prepare, mat_lu_q31_run, mat_lu_q31_result },
+  { "Matrix", "arm_mat_lu_solve_f32", sizesMatrix, 120.0, mat_lu_solve_f32_prepare, mat_lu_solve_f32_run, result_dst_f32 },
+  { "Matrix", "arm_mat_lu_solve_q31", sizesMatrix, 110.0, mat_lu_solve_q31_prepare, mat_lu_solve_q31_run, result_dst_q31 },
+  { "Matrix", "arm_mat_qr_f32", sizesMatrix, 120.0, mat_lu_f32_prepare, mat_qr_f32_run, mat_qr_f32_result },
+  { "Matrix", "arm_mat_qr_q31", sizesMatrix, 140.0, mat_lu_q31_prepare, mat_qr_q31_run, mat_qr_q31_result },
+  { "Matrix", "arm_mat_qr_solve_f32", sizesMatrix, 120.0, mat_qr_solve_f32_prepare, mat_qr_solve_f32_run, result_dst_f32 },
+  { "Matrix", "arm_mat_qr_solve_q31", sizesMatrix, 110.0, mat_qr_solve_q31_prepare, mat_qr_solve_q31_run, result_dst_q31 },
+
+  { "Statistics", "arm_mean_f32", sizesBlock, 100.0, mean_f32_prepare, mean_f32_run, scalar_f32_result },
+  { "Statistics", "arm_mean_q15", sizesBlock, 60.0, mean_q15_prepare, mean_q15_run, scalar_q15_result },
+  { "Statistics", "arm_mean_q7", sizesBlock, 20.0, mean_q7_prepare, mean_q7_run, scalar_q7_result },
+  { "Statistics", "arm_var_f32", sizesBlock, 100.0, var_f32_prepare, var_f32_run, scalar_f32_result },
+  { "Statistics", "arm_var_q31", sizesBlock, 100.0, var_q31_prepare, var_q31_run, var_q31_result },
+  { "Statistics", "arm_var_q15", sizesBlock, 10.0, var_q15_prepare, var_q15_run, var_q15_result },
+  { "Statistics", "arm_rms_f32", sizesBlock, 120.0, rms_f32_prepare, rms_f32_run, scalar_f32_result },
+  { "Statistics", "arm_rms_q31", sizesBlock, 100.0, rms_q31_prepare, rms_q31_run, scalar_q31_result },
+  { "Statistics", "arm_std_q15", sizesBlock, 10.0, std_q15_prepare, std_q15_run, scalar_q15_result },
+  { "Statistics", "arm_power_q15", sizesBlock, 120.0, power_q15_prepare, power_q15_run, power_q15_result },
+  { "Statistics", "arm_max_f32", sizesBlock, 140.0, max_f32_prepare, max_f32_run, max_f32_result },
+  { "Statistics", "arm_min_q15", sizesBlock, 140.0, min_q15_prepare, min_q15_run, min_q15_result },
+  { "Statistics", "arm_moving_stats_f32", sizesMoving, 120.0, moving_stats_f32_prepare, moving_stats_f32_run, moving_stats_f32_result },
+  { "Statistics", "arm_moving_stats_q31", sizesMoving, 120.0, moving_stats_q31_prepare, moving_stats_q31_run, moving_stats_q31_result },
+  { "Statistics", "arm_moving_stats_q15", sizesMoving, 70.0, moving_stats_q15_prepare, moving_stats_q15_run, moving_stats_q15_result },
+
+  { "Support", "arm_float_to_q31", sizesBlock, 140.0, float_to_q15_prepare, float_to_q31_run, result_dst_q31 },
+  { "Support", "arm_float_to_q15", sizesBlock, 80.0, float_to_q15_prepare, float_to_q15_run, result_dst_q15 },
+  { "Support", "arm_float_to_q7", sizesBlock, 30.0, float_to_q15_prepare, float_to_q7_run, result_dst_q7 },
+  { "Support", "arm_q15_to_float", sizesBlock, 140.0, q15_to_float_prepare, q15_to_float_run, result_dst_f32 },
+  { "Support", "arm_q15_to_q31", sizesBlock, 140.0, q15_to_float_prepare, q15_to_q31_run, result_dst_q31 },
+  { "Support", "arm_q31_to_q15", sizesBlock, 80.0, q31_to_q15_prepare, q31_to_q15_run, result_dst_q15 },
+  { "Support", "arm_copy_q15", sizesBlock, 140.0, q15_to_float_prepare, copy_q15_run, result_dst_q15 },
+  { "Support", "arm_fill_f32", sizesBlock, 140.0, fill_f32_prepare, fill_f32_run, result_dst_f32 },
+
+  { "Transform", "arm_cfft_f32", sizesCfft, 110.0, cfft_f32_prepare, cfft_f32_run, result_dst_f32 },
+  { "Transform", "arm_cfft_f32 inverse", sizesCfft, 110.0, cifft_f32_prepare, cifft_f32_run, result_dst_f32 },
+  { "Transform", "arm_cfft_radix4_q31", sizesCfft, 100.0, cfft_radix4_q31_prepare, cfft_radix4_q31_run, result_dst_q31 },
+  { "Transform", "arm_cfft_radix4_q15", sizesCfft, 40.0, cfft_radix4_q15_prepare, cfft_radix4_q15_run, result_dst_q15 },
+  { "Transform", "arm_cfft_q31", sizesCfftFixed, 100.0, cfft_q31_prepare, cfft_q31_run, result_dst_q31 },
+  { "Transform", "arm_cfft_q31 inverse", sizesCfftFixed, 100.0, cifft_q31_prepare, cifft_q31_run, result_dst_q31 },
+  { "Transform", "arm_cfft_q15", sizesCfftFixed, 40.0, cfft_q15_prepare, cfft_q15_run, result_dst_q15 },
+  { "Transform", "arm_cfft_q15 inverse", sizesCfftFixed, 40.0, cifft_q15_prepare, cifft_q15_run, result_dst_q15 },
+  { "Transform", "arm_rfft_fast_f32", sizesRfftFast, 110.0, rfft_fast_f32_prepare, rfft_fast_f32_run, result_dst_f32 },
+  { "Transform", "arm_rfft_fast_q31", sizesRfftFixed, 100.0, rfft_fast_q31_prepare, rfft_fast_q31_run, result_dst_q31 },
+  { "Transform", "arm_rfft_fast_q15", sizesRfftFixed, 40.0, rfft_fast_q15_prepare, rfft_fast_q15_run, result_dst_q15 },
+  { "Transform", "arm_rfft_q31", sizesRfft, 100.0, rfft_q31_prepare, rfft_q31_run, result_dst_q31 },
+  { "Transform", "arm_dct4_f32", sizesRfft, 75.0, dct4_f32_prepare, dct4_f32_run, result_dst_f32 },
+  { "Transform", "arm_goertzel_f32", sizesFilter, 80.0, goertzel_f32_prepare, goertzel_f32_run, result_dst_f32 },
+  { "Transform", "arm_goertzel_q31", sizesFilter, 80.0, goertzel_q31_prepare, goertzel_q31_run, result_dst_q31 },
+  { "Transform", "arm_goertzel_q15", sizesFilter, 35.0, goertzel_q15_prepare, goertzel_q15_run, result_dst_q15 },
+  { "Transform", "arm_goertzel_sliding_f32", sizesGoertzel, 95.0, goertzel_sliding_f32_prepare, goertzel_sliding_f32_run, result_dst_f32 },
+  { "Transform", "arm_goertzel_sliding_q31", sizesGoertzel, 100.0, goertzel_sliding_q31_prepare, goertzel_sliding_q31_run, result_dst_q31 },
+  { "Transform", "arm_goertzel_sliding_q15", sizesGoertzel, 35.0, goertzel_sliding_q15_prepare, goertzel_sliding_q15_run, result_dst_q15 },
+  { "Transform", "arm_mfcc_f32", sizesMfcc, 100.0, mfcc_f32_prepare, mfcc_f32_run, result_dst_f32 },
+  { "Transform", "arm_mfcc_f32 log-mel", sizesMfcc, 100.0, logmel_f32_prepare, mfcc_f32_run, result_dst_f32 },
+  { "Transform", "arm_mfcc_q15", sizesMfcc, 28.0, mfcc_q15_prepare, mfcc_q15_run, result_dst_q15 },
+  { "Transform", "arm_mfcc_q15 log-mel", sizesMfcc, 28.0, logmel_q15_prepare, mfcc_q15_run, result_dst_q15 },
+
+  { "NN", "arm_nn_fully_connected_q7", sizesNNVector, 100.0, nn_fc_q7_prepare, nn_fc_q7_run, result_dst_q7 },
+  { "NN", "arm_nn_fully_connected_q15", sizesNNVector, 100.0, nn_fc_q15_prepare, nn_fc_q15_run, result_dst_q15 },
+  { "NN", "arm_nn_conv_hwc_q7", sizesNNImage, 100.0, nn_conv_q7_prepare, nn_conv_q7_run, result_dst_q7 },
+  { "NN", "arm_nn_conv_hwc_q15", sizesNNImage, 100.0, nn_conv_q15_prepare, nn_conv_q15_run, result_dst_q15 },
+  { "NN", "arm_nn_conv_1x1_hwc_q7", sizesNNImage, 100.0, nn_conv_1x1_q7_prepare, nn_conv_1x1_q7_run, result_dst_q7 },
+  { "NN", "arm_nn_conv_1x1_hwc_q15", sizesNNImage, 100.0, nn_conv_1x1_q15_prepare, nn_conv_1x1_q15_run, result_dst_q15 },
+  { "NN", "arm_nn_depthwise_conv_hwc_q7", sizesNNImage, 100.0, nn_depthwise_q7_prepare, nn_depthwise_q7_run, result_dst_q7 },
+  { "NN", "arm_nn_depthwise_conv_hwc_q15", sizesNNImage, 100.0, nn_depthwise_q15_prepare, nn_depthwise_q15_run, result_dst_q15 },
+  { "NN", "arm_nn_maxpool_hwc_q7", sizesNNImage, 100.0, nn_maxpool_q7_prepare, nn_maxpool_q7_run, result_dst_q7 },
+  { "NN", "arm_nn_maxpool_hwc_q15", sizesNNImage, 100.0, nn_maxpool_q15_prepare, nn_maxpool_q15_run, result_dst_q15 },
+  { "NN", "arm_nn_avgpool_hwc_q7", sizesNNImage, 100.0, nn_avgpool_q7_prepare, nn_avgpool_q7_run, result_dst_q7 },
+  { "NN", "arm_nn_avgpool_hwc_q15", sizesNNImage, 100.0, nn_avgpool_q15_prepare, nn_avgpool_q15_run, result_dst_q15 },
+  { "NN", "arm_nn_relu_q7", sizesBlock, 100.0, nn_relu_q7_prepare, nn_relu_q7_run, result_dst_q7 },
+  { "NN", "arm_nn_relu_q15", sizesBlock, 100.0, nn_relu_q15_prepare, nn_relu_q15_run, result_dst_q15 },
+  { "NN", "arm_nn_softmax_q7", sizesSoftmax, 14.0, nn_softmax_q7_prepare, nn_softmax_q7_run, result_dst_q7 },
+  { "NN", "arm_nn_softmax_q15", sizesSoftmax, 58.0, nn_softmax_q15_prepare, nn_softmax_q15_run, result_dst_q15 },
+};
+
+const uint32_t benchNumCases = sizeof(benchCases) / sizeof(benchCases[0]);
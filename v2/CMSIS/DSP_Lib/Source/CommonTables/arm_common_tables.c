@@ -16063,3 +16063,2448 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
     0.003067957f, -0.999995294f,
     0.001533980f, -0.999998823f
 };
+
+
+/**    
+ * @addtogroup CFFT_CIFFT Complex FFT Tables  
+ * @{    
+ */
+
+/*    
+* @brief  Q31 Twiddle factors Tables of the arm_cfft_q31 lengths    
+*/
+
+/**    
+* \par    
+* Example code for Q31 Twiddle factors Generation::    
+* \par    
+* <pre>for(i = 0; i< 3N/4; i++)    
+* {    
+*    twiddleCoef_N_q31[2*i]= cos(i * 2*PI/(float)N);    
+*    twiddleCoef_N_q31[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 16, 32, ..., 2048 and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are interleaved fashion    
+* \par    
+* Convert Floating point to Q31(Fixed point 1.31):    
+*	round(twiddleCoef_N_q31(i) * pow(2, 31))    
+* \par    
+* The 4096 point table is twiddleCoefQ31.    
+*/
+
+const q31_t twiddleCoef_16_q31[24] = {
+  0x7fffffff, 0x0, 0x7641af3d, 0x30fbc54d, 0x5a82799a, 0x5a82799a,
+  0x30fbc54d, 0x7641af3d, 0x0, 0x7fffffff, 0xcf043ab3, 0x7641af3d,
+  0xa57d8666, 0x5a82799a, 0x89be50c3, 0x30fbc54d, 0x80000000, 0x0,
+  0x89be50c3, 0xcf043ab3, 0xa57d8666, 0xa57d8666, 0xcf043ab3, 0x89be50c3
+};
+
+const q31_t twiddleCoef_32_q31[48] = {
+  0x7fffffff, 0x0, 0x7d8a5f40, 0x18f8b83c, 0x7641af3d, 0x30fbc54d,
+  0x6a6d98a4, 0x471cece7, 0x5a82799a, 0x5a82799a, 0x471cece7, 0x6a6d98a4,
+  0x30fbc54d, 0x7641af3d, 0x18f8b83c, 0x7d8a5f40, 0x0, 0x7fffffff,
+  0xe70747c4, 0x7d8a5f40, 0xcf043ab3, 0x7641af3d, 0xb8e31319, 0x6a6d98a4,
+  0xa57d8666, 0x5a82799a, 0x9592675c, 0x471cece7, 0x89be50c3, 0x30fbc54d,
+  0x8275a0c0, 0x18f8b83c, 0x80000000, 0x0, 0x8275a0c0, 0xe70747c4,
+  0x89be50c3, 0xcf043ab3, 0x9592675c, 0xb8e31319, 0xa57d8666, 0xa57d8666,
+  0xb8e31319, 0x9592675c, 0xcf043ab3, 0x89be50c3, 0xe70747c4, 0x8275a0c0
+};
+
+const q31_t twiddleCoef_64_q31[96] = {
+  0x7fffffff, 0x0, 0x7f62368f, 0xc8bd35e, 0x7d8a5f40, 0x18f8b83c,
+  0x7a7d055b, 0x25280c5e, 0x7641af3d, 0x30fbc54d, 0x70e2cbc6, 0x3c56ba70,
+  0x6a6d98a4, 0x471cece7, 0x62f201ac, 0x5133cc94, 0x5a82799a, 0x5a82799a,
+  0x5133cc94, 0x62f201ac, 0x471cece7, 0x6a6d98a4, 0x3c56ba70, 0x70e2cbc6,
+  0x30fbc54d, 0x7641af3d, 0x25280c5e, 0x7a7d055b, 0x18f8b83c, 0x7d8a5f40,
+  0xc8bd35e, 0x7f62368f, 0x0, 0x7fffffff, 0xf3742ca2, 0x7f62368f,
+  0xe70747c4, 0x7d8a5f40, 0xdad7f3a2, 0x7a7d055b, 0xcf043ab3, 0x7641af3d,
+  0xc3a94590, 0x70e2cbc6, 0xb8e31319, 0x6a6d98a4, 0xaecc336c, 0x62f201ac,
+  0xa57d8666, 0x5a82799a, 0x9d0dfe54, 0x5133cc94, 0x9592675c, 0x471cece7,
+  0x8f1d343a, 0x3c56ba70, 0x89be50c3, 0x30fbc54d, 0x8582faa5, 0x25280c5e,
+  0x8275a0c0, 0x18f8b83c, 0x809dc971, 0xc8bd35e, 0x80000000, 0x0,
+  0x809dc971, 0xf3742ca2, 0x8275a0c0, 0xe70747c4, 0x8582faa5, 0xdad7f3a2,
+  0x89be50c3, 0xcf043ab3, 0x8f1d343a, 0xc3a94590, 0x9592675c, 0xb8e31319,
+  0x9d0dfe54, 0xaecc336c, 0xa57d8666, 0xa57d8666, 0xaecc336c, 0x9d0dfe54,
+  0xb8e31319, 0x9592675c, 0xc3a94590, 0x8f1d343a, 0xcf043ab3, 0x89be50c3,
+  0xdad7f3a2, 0x8582faa5, 0xe70747c4, 0x8275a0c0, 0xf3742ca2, 0x809dc971
+};
+
+const q31_t twiddleCoef_128_q31[192] = {
+  0x7fffffff, 0x0, 0x7fd8878e, 0x647d97c, 0x7f62368f, 0xc8bd35e,
+  0x7e9d55fc, 0x12c8106f, 0x7d8a5f40, 0x18f8b83c, 0x7c29fbee, 0x1f19f97b,
+  0x7a7d055b, 0x25280c5e, 0x78848414, 0x2b1f34eb, 0x7641af3d, 0x30fbc54d,
+  0x73b5ebd1, 0x36ba2014, 0x70e2cbc6, 0x3c56ba70, 0x6dca0d14, 0x41ce1e65,
+  0x6a6d98a4, 0x471cece7, 0x66cf8120, 0x4c3fdff4, 0x62f201ac, 0x5133cc94,
+  0x5ed77c8a, 0x55f5a4d2, 0x5a82799a, 0x5a82799a, 0x55f5a4d2, 0x5ed77c8a,
+  0x5133cc94, 0x62f201ac, 0x4c3fdff4, 0x66cf8120, 0x471cece7, 0x6a6d98a4,
+  0x41ce1e65, 0x6dca0d14, 0x3c56ba70, 0x70e2cbc6, 0x36ba2014, 0x73b5ebd1,
+  0x30fbc54d, 0x7641af3d, 0x2b1f34eb, 0x78848414, 0x25280c5e, 0x7a7d055b,
+  0x1f19f97b, 0x7c29fbee, 0x18f8b83c, 0x7d8a5f40, 0x12c8106f, 0x7e9d55fc,
+  0xc8bd35e, 0x7f62368f, 0x647d97c, 0x7fd8878e, 0x0, 0x7fffffff,
+  0xf9b82684, 0x7fd8878e, 0xf3742ca2, 0x7f62368f, 0xed37ef91, 0x7e9d55fc,
+  0xe70747c4, 0x7d8a5f40, 0xe0e60685, 0x7c29fbee, 0xdad7f3a2, 0x7a7d055b,
+  0xd4e0cb15, 0x78848414, 0xcf043ab3, 0x7641af3d, 0xc945dfec, 0x73b5ebd1,
+  0xc3a94590, 0x70e2cbc6, 0xbe31e19b, 0x6dca0d14, 0xb8e31319, 0x6a6d98a4,
+  0xb3c0200c, 0x66cf8120, 0xaecc336c, 0x62f201ac, 0xaa0a5b2e, 0x5ed77c8a,
+  0xa57d8666, 0x5a82799a, 0xa1288376, 0x55f5a4d2, 0x9d0dfe54, 0x5133cc94,
+  0x99307ee0, 0x4c3fdff4, 0x9592675c, 0x471cece7, 0x9235f2ec, 0x41ce1e65,
+  0x8f1d343a, 0x3c56ba70, 0x8c4a142f, 0x36ba2014, 0x89be50c3, 0x30fbc54d,
+  0x877b7bec, 0x2b1f34eb, 0x8582faa5, 0x25280c5e, 0x83d60412, 0x1f19f97b,
+  0x8275a0c0, 0x18f8b83c, 0x8162aa04, 0x12c8106f, 0x809dc971, 0xc8bd35e,
+  0x80277872, 0x647d97c, 0x80000000, 0x0, 0x80277872, 0xf9b82684,
+  0x809dc971, 0xf3742ca2, 0x8162aa04, 0xed37ef91, 0x8275a0c0, 0xe70747c4,
+  0x83d60412, 0xe0e60685, 0x8582faa5, 0xdad7f3a2, 0x877b7bec, 0xd4e0cb15,
+  0x89be50c3, 0xcf043ab3, 0x8c4a142f, 0xc945dfec, 0x8f1d343a, 0xc3a94590,
+  0x9235f2ec, 0xbe31e19b, 0x9592675c, 0xb8e31319, 0x99307ee0, 0xb3c0200c,
+  0x9d0dfe54, 0xaecc336c, 0xa1288376, 0xaa0a5b2e, 0xa57d8666, 0xa57d8666,
+  0xaa0a5b2e, 0xa1288376, 0xaecc336c, 0x9d0dfe54, 0xb3c0200c, 0x99307ee0,
+  0xb8e31319, 0x9592675c, 0xbe31e19b, 0x9235f2ec, 0xc3a94590, 0x8f1d343a,
+  0xc945dfec, 0x8c4a142f, 0xcf043ab3, 0x89be50c3, 0xd4e0cb15, 0x877b7bec,
+  0xdad7f3a2, 0x8582faa5, 0xe0e60685, 0x83d60412, 0xe70747c4, 0x8275a0c0,
+  0xed37ef91, 0x8162aa04, 0xf3742ca2, 0x809dc971, 0xf9b82684, 0x80277872
+};
+
+const q31_t twiddleCoef_256_q31[384] = {
+  0x7fffffff, 0x0, 0x7ff62182, 0x3242abf, 0x7fd8878e, 0x647d97c,
+  0x7fa736b4, 0x96a9049, 0x7f62368f, 0xc8bd35e, 0x7f0991c4, 0xfab272b,
+  0x7e9d55fc, 0x12c8106f, 0x7e1d93ea, 0x15e21445, 0x7d8a5f40, 0x18f8b83c,
+  0x7ce3ceb2, 0x1c0b826a, 0x7c29fbee, 0x1f19f97b, 0x7b5d039e, 0x2223a4c5,
+  0x7a7d055b, 0x25280c5e, 0x798a23b1, 0x2826b928, 0x78848414, 0x2b1f34eb,
+  0x776c4edb, 0x2e110a62, 0x7641af3d, 0x30fbc54d, 0x7504d345, 0x33def287,
+  0x73b5ebd1, 0x36ba2014, 0x72552c85, 0x398cdd32, 0x70e2cbc6, 0x3c56ba70,
+  0x6f5f02b2, 0x3f1749b8, 0x6dca0d14, 0x41ce1e65, 0x6c242960, 0x447acd50,
+  0x6a6d98a4, 0x471cece7, 0x68a69e81, 0x49b41533, 0x66cf8120, 0x4c3fdff4,
+  0x64e88926, 0x4ebfe8a5, 0x62f201ac, 0x5133cc94, 0x60ec3830, 0x539b2af0,
+  0x5ed77c8a, 0x55f5a4d2, 0x5cb420e0, 0x5842dd54, 0x5a82799a, 0x5a82799a,
+  0x5842dd54, 0x5cb420e0, 0x55f5a4d2, 0x5ed77c8a, 0x539b2af0, 0x60ec3830,
+  0x5133cc94, 0x62f201ac, 0x4ebfe8a5, 0x64e88926, 0x4c3fdff4, 0x66cf8120,
+  0x49b41533, 0x68a69e81, 0x471cece7, 0x6a6d98a4, 0x447acd50, 0x6c242960,
+  0x41ce1e65, 0x6dca0d14, 0x3f1749b8, 0x6f5f02b2, 0x3c56ba70, 0x70e2cbc6,
+  0x398cdd32, 0x72552c85, 0x36ba2014, 0x73b5ebd1, 0x33def287, 0x7504d345,
+  0x30fbc54d, 0x7641af3d, 0x2e110a62, 0x776c4edb, 0x2b1f34eb, 0x78848414,
+  0x2826b928, 0x798a23b1, 0x25280c5e, 0x7a7d055b, 0x2223a4c5, 0x7b5d039e,
+  0x1f19f97b, 0x7c29fbee, 0x1c0b826a, 0x7ce3ceb2, 0x18f8b83c, 0x7d8a5f40,
+  0x15e21445, 0x7e1d93ea, 0x12c8106f, 0x7e9d55fc, 0xfab272b, 0x7f0991c4,
+  0xc8bd35e, 0x7f62368f, 0x96a9049, 0x7fa736b4, 0x647d97c, 0x7fd8878e,
+  0x3242abf, 0x7ff62182, 0x0, 0x7fffffff, 0xfcdbd541, 0x7ff62182,
+  0xf9b82684, 0x7fd8878e, 0xf6956fb7, 0x7fa736b4, 0xf3742ca2, 0x7f62368f,
+  0xf054d8d5, 0x7f0991c4, 0xed37ef91, 0x7e9d55fc, 0xea1debbb, 0x7e1d93ea,
+  0xe70747c4, 0x7d8a5f40, 0xe3f47d96, 0x7ce3ceb2, 0xe0e60685, 0x7c29fbee,
+  0xdddc5b3b, 0x7b5d039e, 0xdad7f3a2, 0x7a7d055b, 0xd7d946d8, 0x798a23b1,
+  0xd4e0cb15, 0x78848414, 0xd1eef59e, 0x776c4edb, 0xcf043ab3, 0x7641af3d,
+  0xcc210d79, 0x7504d345, 0xc945dfec, 0x73b5ebd1, 0xc67322ce, 0x72552c85,
+  0xc3a94590, 0x70e2cbc6, 0xc0e8b648, 0x6f5f02b2, 0xbe31e19b, 0x6dca0d14,
+  0xbb8532b0, 0x6c242960, 0xb8e31319, 0x6a6d98a4, 0xb64beacd, 0x68a69e81,
+  0xb3c0200c, 0x66cf8120, 0xb140175b, 0x64e88926, 0xaecc336c, 0x62f201ac,
+  0xac64d510, 0x60ec3830, 0xaa0a5b2e, 0x5ed77c8a, 0xa7bd22ac, 0x5cb420e0,
+  0xa57d8666, 0x5a82799a, 0xa34bdf20, 0x5842dd54, 0xa1288376, 0x55f5a4d2,
+  0x9f13c7d0, 0x539b2af0, 0x9d0dfe54, 0x5133cc94, 0x9b1776da, 0x4ebfe8a5,
+  0x99307ee0, 0x4c3fdff4, 0x9759617f, 0x49b41533, 0x9592675c, 0x471cece7,
+  0x93dbd6a0, 0x447acd50, 0x9235f2ec, 0x41ce1e65, 0x90a0fd4e, 0x3f1749b8,
+  0x8f1d343a, 0x3c56ba70, 0x8daad37b, 0x398cdd32, 0x8c4a142f, 0x36ba2014,
+  0x8afb2cbb, 0x33def287, 0x89be50c3, 0x30fbc54d, 0x8893b125, 0x2e110a62,
+  0x877b7bec, 0x2b1f34eb, 0x8675dc4f, 0x2826b928, 0x8582faa5, 0x25280c5e,
+  0x84a2fc62, 0x2223a4c5, 0x83d60412, 0x1f19f97b, 0x831c314e, 0x1c0b826a,
+  0x8275a0c0, 0x18f8b83c, 0x81e26c16, 0x15e21445, 0x8162aa04, 0x12c8106f,
+  0x80f66e3c, 0xfab272b, 0x809dc971, 0xc8bd35e, 0x8058c94c, 0x96a9049,
+  0x80277872, 0x647d97c, 0x8009de7e, 0x3242abf, 0x80000000, 0x0,
+  0x8009de7e, 0xfcdbd541, 0x80277872, 0xf9b82684, 0x8058c94c, 0xf6956fb7,
+  0x809dc971, 0xf3742ca2, 0x80f66e3c, 0xf054d8d5, 0x8162aa04, 0xed37ef91,
+  0x81e26c16, 0xea1debbb, 0x8275a0c0, 0xe70747c4, 0x831c314e, 0xe3f47d96,
+  0x83d60412, 0xe0e60685, 0x84a2fc62, 0xdddc5b3b, 0x8582faa5, 0xdad7f3a2,
+  0x8675dc4f, 0xd7d946d8, 0x877b7bec, 0xd4e0cb15, 0x8893b125, 0xd1eef59e,
+  0x89be50c3, 0xcf043ab3, 0x8afb2cbb, 0xcc210d79, 0x8c4a142f, 0xc945dfec,
+  0x8daad37b, 0xc67322ce, 0x8f1d343a, 0xc3a94590, 0x90a0fd4e, 0xc0e8b648,
+  0x9235f2ec, 0xbe31e19b, 0x93dbd6a0, 0xbb8532b0, 0x9592675c, 0xb8e31319,
+  0x9759617f, 0xb64beacd, 0x99307ee0, 0xb3c0200c, 0x9b1776da, 0xb140175b,
+  0x9d0dfe54, 0xaecc336c, 0x9f13c7d0, 0xac64d510, 0xa1288376, 0xaa0a5b2e,
+  0xa34bdf20, 0xa7bd22ac, 0xa57d8666, 0xa57d8666, 0xa7bd22ac, 0xa34bdf20,
+  0xaa0a5b2e, 0xa1288376, 0xac64d510, 0x9f13c7d0, 0xaecc336c, 0x9d0dfe54,
+  0xb140175b, 0x9b1776da, 0xb3c0200c, 0x99307ee0, 0xb64beacd, 0x9759617f,
+  0xb8e31319, 0x9592675c, 0xbb8532b0, 0x93dbd6a0, 0xbe31e19b, 0x9235f2ec,
+  0xc0e8b648, 0x90a0fd4e, 0xc3a94590, 0x8f1d343a, 0xc67322ce, 0x8daad37b,
+  0xc945dfec, 0x8c4a142f, 0xcc210d79, 0x8afb2cbb, 0xcf043ab3, 0x89be50c3,
+  0xd1eef59e, 0x8893b125, 0xd4e0cb15, 0x877b7bec, 0xd7d946d8, 0x8675dc4f,
+  0xdad7f3a2, 0x8582faa5, 0xdddc5b3b, 0x84a2fc62, 0xe0e60685, 0x83d60412,
+  0xe3f47d96, 0x831c314e, 0xe70747c4, 0x8275a0c0, 0xea1debbb, 0x81e26c16,
+  0xed37ef91, 0x8162aa04, 0xf054d8d5, 0x80f66e3c, 0xf3742ca2, 0x809dc971,
+  0xf6956fb7, 0x8058c94c, 0xf9b82684, 0x80277872, 0xfcdbd541, 0x8009de7e
+};
+
+const q31_t twiddleCoef_512_q31[768] = {
+  0x7fffffff, 0x0, 0x7ffd885a, 0x1921d20, 0x7ff62182, 0x3242abf,
+  0x7fe9cbc0, 0x4b6195d, 0x7fd8878e, 0x647d97c, 0x7fc25596, 0x7d95b9e,
+  0x7fa736b4, 0x96a9049, 0x7f872bf3, 0xafb6805, 0x7f62368f, 0xc8bd35e,
+  0x7f3857f6, 0xe1bc2e4, 0x7f0991c4, 0xfab272b, 0x7ed5e5c6, 0x1139f0cf,
+  0x7e9d55fc, 0x12c8106f, 0x7e5fe493, 0x145576b1, 0x7e1d93ea, 0x15e21445,
+  0x7dd6668f, 0x176dd9de, 0x7d8a5f40, 0x18f8b83c, 0x7d3980ec, 0x1a82a026,
+  0x7ce3ceb2, 0x1c0b826a, 0x7c894bde, 0x1d934fe5, 0x7c29fbee, 0x1f19f97b,
+  0x7bc5e290, 0x209f701c, 0x7b5d039e, 0x2223a4c5, 0x7aef6323, 0x23a6887f,
+  0x7a7d055b, 0x25280c5e, 0x7a05eead, 0x26a82186, 0x798a23b1, 0x2826b928,
+  0x7909a92d, 0x29a3c485, 0x78848414, 0x2b1f34eb, 0x77fab989, 0x2c98fbba,
+  0x776c4edb, 0x2e110a62, 0x76d94989, 0x2f875262, 0x7641af3d, 0x30fbc54d,
+  0x75a585cf, 0x326e54c7, 0x7504d345, 0x33def287, 0x745f9dd1, 0x354d9057,
+  0x73b5ebd1, 0x36ba2014, 0x7307c3d0, 0x382493b0, 0x72552c85, 0x398cdd32,
+  0x719e2cd2, 0x3af2eeb7, 0x70e2cbc6, 0x3c56ba70, 0x7023109a, 0x3db832a6,
+  0x6f5f02b2, 0x3f1749b8, 0x6e96a99d, 0x4073f21d, 0x6dca0d14, 0x41ce1e65,
+  0x6cf934fc, 0x4325c135, 0x6c242960, 0x447acd50, 0x6b4af279, 0x45cd358f,
+  0x6a6d98a4, 0x471cece7, 0x698c246c, 0x4869e665, 0x68a69e81, 0x49b41533,
+  0x67bd0fbd, 0x4afb6c98, 0x66cf8120, 0x4c3fdff4, 0x65ddfbd3, 0x4d8162c4,
+  0x64e88926, 0x4ebfe8a5, 0x63ef3290, 0x4ffb654d, 0x62f201ac, 0x5133cc94,
+  0x61f1003f, 0x5269126e, 0x60ec3830, 0x539b2af0, 0x5fe3b38d, 0x54ca0a4b,
+  0x5ed77c8a, 0x55f5a4d2, 0x5dc79d7c, 0x571deefa, 0x5cb420e0, 0x5842dd54,
+  0x5b9d1154, 0x59646498, 0x5a82799a, 0x5a82799a, 0x59646498, 0x5b9d1154,
+  0x5842dd54, 0x5cb420e0, 0x571deefa, 0x5dc79d7c, 0x55f5a4d2, 0x5ed77c8a,
+  0x54ca0a4b, 0x5fe3b38d, 0x539b2af0, 0x60ec3830, 0x5269126e, 0x61f1003f,
+  0x5133cc94, 0x62f201ac, 0x4ffb654d, 0x63ef3290, 0x4ebfe8a5, 0x64e88926,
+  0x4d8162c4, 0x65ddfbd3, 0x4c3fdff4, 0x66cf8120, 0x4afb6c98, 0x67bd0fbd,
+  0x49b41533, 0x68a69e81, 0x4869e665, 0x698c246c, 0x471cece7, 0x6a6d98a4,
+  0x45cd358f, 0x6b4af279, 0x447acd50, 0x6c242960, 0x4325c135, 0x6cf934fc,
+  0x41ce1e65, 0x6dca0d14, 0x4073f21d, 0x6e96a99d, 0x3f1749b8, 0x6f5f02b2,
+  0x3db832a6, 0x7023109a, 0x3c56ba70, 0x70e2cbc6, 0x3af2eeb7, 0x719e2cd2,
+  0x398cdd32, 0x72552c85, 0x382493b0, 0x7307c3d0, 0x36ba2014, 0x73b5ebd1,
+  0x354d9057, 0x745f9dd1, 0x33def287, 0x7504d345, 0x326e54c7, 0x75a585cf,
+  0x30fbc54d, 0x7641af3d, 0x2f875262, 0x76d94989, 0x2e110a62, 0x776c4edb,
+  0x2c98fbba, 0x77fab989, 0x2b1f34eb, 0x78848414, 0x29a3c485, 0x7909a92d,
+  0x2826b928, 0x798a23b1, 0x26a82186, 0x7a05eead, 0x25280c5e, 0x7a7d055b,
+  0x23a6887f, 0x7aef6323, 0x2223a4c5, 0x7b5d039e, 0x209f701c, 0x7bc5e290,
+  0x1f19f97b, 0x7c29fbee, 0x1d934fe5, 0x7c894bde, 0x1c0b826a, 0x7ce3ceb2,
+  0x1a82a026, 0x7d3980ec, 0x18f8b83c, 0x7d8a5f40, 0x176dd9de, 0x7dd6668f,
+  0x15e21445, 0x7e1d93ea, 0x145576b1, 0x7e5fe493, 0x12c8106f, 0x7e9d55fc,
+  0x1139f0cf, 0x7ed5e5c6, 0xfab272b, 0x7f0991c4, 0xe1bc2e4, 0x7f3857f6,
+  0xc8bd35e, 0x7f62368f, 0xafb6805, 0x7f872bf3, 0x96a9049, 0x7fa736b4,
+  0x7d95b9e, 0x7fc25596, 0x647d97c, 0x7fd8878e, 0x4b6195d, 0x7fe9cbc0,
+  0x3242abf, 0x7ff62182, 0x1921d20, 0x7ffd885a, 0x0, 0x7fffffff,
+  0xfe6de2e0, 0x7ffd885a, 0xfcdbd541, 0x7ff62182, 0xfb49e6a3, 0x7fe9cbc0,
+  0xf9b82684, 0x7fd8878e, 0xf826a462, 0x7fc25596, 0xf6956fb7, 0x7fa736b4,
+  0xf50497fb, 0x7f872bf3, 0xf3742ca2, 0x7f62368f, 0xf1e43d1c, 0x7f3857f6,
+  0xf054d8d5, 0x7f0991c4, 0xeec60f31, 0x7ed5e5c6, 0xed37ef91, 0x7e9d55fc,
+  0xebaa894f, 0x7e5fe493, 0xea1debbb, 0x7e1d93ea, 0xe8922622, 0x7dd6668f,
+  0xe70747c4, 0x7d8a5f40, 0xe57d5fda, 0x7d3980ec, 0xe3f47d96, 0x7ce3ceb2,
+  0xe26cb01b, 0x7c894bde, 0xe0e60685, 0x7c29fbee, 0xdf608fe4, 0x7bc5e290,
+  0xdddc5b3b, 0x7b5d039e, 0xdc597781, 0x7aef6323, 0xdad7f3a2, 0x7a7d055b,
+  0xd957de7a, 0x7a05eead, 0xd7d946d8, 0x798a23b1, 0xd65c3b7b, 0x7909a92d,
+  0xd4e0cb15, 0x78848414, 0xd3670446, 0x77fab989, 0xd1eef59e, 0x776c4edb,
+  0xd078ad9e, 0x76d94989, 0xcf043ab3, 0x7641af3d, 0xcd91ab39, 0x75a585cf,
+  0xcc210d79, 0x7504d345, 0xcab26fa9, 0x745f9dd1, 0xc945dfec, 0x73b5ebd1,
+  0xc7db6c50, 0x7307c3d0, 0xc67322ce, 0x72552c85, 0xc50d1149, 0x719e2cd2,
+  0xc3a94590, 0x70e2cbc6, 0xc247cd5a, 0x7023109a, 0xc0e8b648, 0x6f5f02b2,
+  0xbf8c0de3, 0x6e96a99d, 0xbe31e19b, 0x6dca0d14, 0xbcda3ecb, 0x6cf934fc,
+  0xbb8532b0, 0x6c242960, 0xba32ca71, 0x6b4af279, 0xb8e31319, 0x6a6d98a4,
+  0xb796199b, 0x698c246c, 0xb64beacd, 0x68a69e81, 0xb5049368, 0x67bd0fbd,
+  0xb3c0200c, 0x66cf8120, 0xb27e9d3c, 0x65ddfbd3, 0xb140175b, 0x64e88926,
+  0xb0049ab3, 0x63ef3290, 0xaecc336c, 0x62f201ac, 0xad96ed92, 0x61f1003f,
+  0xac64d510, 0x60ec3830, 0xab35f5b5, 0x5fe3b38d, 0xaa0a5b2e, 0x5ed77c8a,
+  0xa8e21106, 0x5dc79d7c, 0xa7bd22ac, 0x5cb420e0, 0xa69b9b68, 0x5b9d1154,
+  0xa57d8666, 0x5a82799a, 0xa462eeac, 0x59646498, 0xa34bdf20, 0x5842dd54,
+  0xa2386284, 0x571deefa, 0xa1288376, 0x55f5a4d2, 0xa01c4c73, 0x54ca0a4b,
+  0x9f13c7d0, 0x539b2af0, 0x9e0effc1, 0x5269126e, 0x9d0dfe54, 0x5133cc94,
+  0x9c10cd70, 0x4ffb654d, 0x9b1776da, 0x4ebfe8a5, 0x9a22042d, 0x4d8162c4,
+  0x99307ee0, 0x4c3fdff4, 0x9842f043, 0x4afb6c98, 0x9759617f, 0x49b41533,
+  0x9673db94, 0x4869e665, 0x9592675c, 0x471cece7, 0x94b50d87, 0x45cd358f,
+  0x93dbd6a0, 0x447acd50, 0x9306cb04, 0x4325c135, 0x9235f2ec, 0x41ce1e65,
+  0x91695663, 0x4073f21d, 0x90a0fd4e, 0x3f1749b8, 0x8fdcef66, 0x3db832a6,
+  0x8f1d343a, 0x3c56ba70, 0x8e61d32e, 0x3af2eeb7, 0x8daad37b, 0x398cdd32,
+  0x8cf83c30, 0x382493b0, 0x8c4a142f, 0x36ba2014, 0x8ba0622f, 0x354d9057,
+  0x8afb2cbb, 0x33def287, 0x8a5a7a31, 0x326e54c7, 0x89be50c3, 0x30fbc54d,
+  0x8926b677, 0x2f875262, 0x8893b125, 0x2e110a62, 0x88054677, 0x2c98fbba,
+  0x877b7bec, 0x2b1f34eb, 0x86f656d3, 0x29a3c485, 0x8675dc4f, 0x2826b928,
+  0x85fa1153, 0x26a82186, 0x8582faa5, 0x25280c5e, 0x85109cdd, 0x23a6887f,
+  0x84a2fc62, 0x2223a4c5, 0x843a1d70, 0x209f701c, 0x83d60412, 0x1f19f97b,
+  0x8376b422, 0x1d934fe5, 0x831c314e, 0x1c0b826a, 0x82c67f14, 0x1a82a026,
+  0x8275a0c0, 0x18f8b83c, 0x82299971, 0x176dd9de, 0x81e26c16, 0x15e21445,
+  0x81a01b6d, 0x145576b1, 0x8162aa04, 0x12c8106f, 0x812a1a3a, 0x1139f0cf,
+  0x80f66e3c, 0xfab272b, 0x80c7a80a, 0xe1bc2e4, 0x809dc971, 0xc8bd35e,
+  0x8078d40d, 0xafb6805, 0x8058c94c, 0x96a9049, 0x803daa6a, 0x7d95b9e,
+  0x80277872, 0x647d97c, 0x80163440, 0x4b6195d, 0x8009de7e, 0x3242abf,
+  0x800277a6, 0x1921d20, 0x80000000, 0x0, 0x800277a6, 0xfe6de2e0,
+  0x8009de7e, 0xfcdbd541, 0x80163440, 0xfb49e6a3, 0x80277872, 0xf9b82684,
+  0x803daa6a, 0xf826a462, 0x8058c94c, 0xf6956fb7, 0x8078d40d, 0xf50497fb,
+  0x809dc971, 0xf3742ca2, 0x80c7a80a, 0xf1e43d1c, 0x80f66e3c, 0xf054d8d5,
+  0x812a1a3a, 0xeec60f31, 0x8162aa04, 0xed37ef91, 0x81a01b6d, 0xebaa894f,
+  0x81e26c16, 0xea1debbb, 0x82299971, 0xe8922622, 0x8275a0c0, 0xe70747c4,
+  0x82c67f14, 0xe57d5fda, 0x831c314e, 0xe3f47d96, 0x8376b422, 0xe26cb01b,
+  0x83d60412, 0xe0e60685, 0x843a1d70, 0xdf608fe4, 0x84a2fc62, 0xdddc5b3b,
+  0x85109cdd, 0xdc597781, 0x8582faa5, 0xdad7f3a2, 0x85fa1153, 0xd957de7a,
+  0x8675dc4f, 0xd7d946d8, 0x86f656d3, 0xd65c3b7b, 0x877b7bec, 0xd4e0cb15,
+  0x88054677, 0xd3670446, 0x8893b125, 0xd1eef59e, 0x8926b677, 0xd078ad9e,
+  0x89be50c3, 0xcf043ab3, 0x8a5a7a31, 0xcd91ab39, 0x8afb2cbb, 0xcc210d79,
+  0x8ba0622f, 0xcab26fa9, 0x8c4a142f, 0xc945dfec, 0x8cf83c30, 0xc7db6c50,
+  0x8daad37b, 0xc67322ce, 0x8e61d32e, 0xc50d1149, 0x8f1d343a, 0xc3a94590,
+  0x8fdcef66, 0xc247cd5a, 0x90a0fd4e, 0xc0e8b648, 0x91695663, 0xbf8c0de3,
+  0x9235f2ec, 0xbe31e19b, 0x9306cb04, 0xbcda3ecb, 0x93dbd6a0, 0xbb8532b0,
+  0x94b50d87, 0xba32ca71, 0x9592675c, 0xb8e31319, 0x9673db94, 0xb796199b,
+  0x9759617f, 0xb64beacd, 0x9842f043, 0xb5049368, 0x99307ee0, 0xb3c0200c,
+  0x9a22042d, 0xb27e9d3c, 0x9b1776da, 0xb140175b, 0x9c10cd70, 0xb0049ab3,
+  0x9d0dfe54, 0xaecc336c, 0x9e0effc1, 0xad96ed92, 0x9f13c7d0, 0xac64d510,
+  0xa01c4c73, 0xab35f5b5, 0xa1288376, 0xaa0a5b2e, 0xa2386284, 0xa8e21106,
+  0xa34bdf20, 0xa7bd22ac, 0xa462eeac, 0xa69b9b68, 0xa57d8666, 0xa57d8666,
+  0xa69b9b68, 0xa462eeac, 0xa7bd22ac, 0xa34bdf20, 0xa8e21106, 0xa2386284,
+  0xaa0a5b2e, 0xa1288376, 0xab35f5b5, 0xa01c4c73, 0xac64d510, 0x9f13c7d0,
+  0xad96ed92, 0x9e0effc1, 0xaecc336c, 0x9d0dfe54, 0xb0049ab3, 0x9c10cd70,
+  0xb140175b, 0x9b1776da, 0xb27e9d3c, 0x9a22042d, 0xb3c0200c, 0x99307ee0,
+  0xb5049368, 0x9842f043, 0xb64beacd, 0x9759617f, 0xb796199b, 0x9673db94,
+  0xb8e31319, 0x9592675c, 0xba32ca71, 0x94b50d87, 0xbb8532b0, 0x93dbd6a0,
+  0xbcda3ecb, 0x9306cb04, 0xbe31e19b, 0x9235f2ec, 0xbf8c0de3, 0x91695663,
+  0xc0e8b648, 0x90a0fd4e, 0xc247cd5a, 0x8fdcef66, 0xc3a94590, 0x8f1d343a,
+  0xc50d1149, 0x8e61d32e, 0xc67322ce, 0x8daad37b, 0xc7db6c50, 0x8cf83c30,
+  0xc945dfec, 0x8c4a142f, 0xcab26fa9, 0x8ba0622f, 0xcc210d79, 0x8afb2cbb,
+  0xcd91ab39, 0x8a5a7a31, 0xcf043ab3, 0x89be50c3, 0xd078ad9e, 0x8926b677,
+  0xd1eef59e, 0x8893b125, 0xd3670446, 0x88054677, 0xd4e0cb15, 0x877b7bec,
+  0xd65c3b7b, 0x86f656d3, 0xd7d946d8, 0x8675dc4f, 0xd957de7a, 0x85fa1153,
+  0xdad7f3a2, 0x8582faa5, 0xdc597781, 0x85109cdd, 0xdddc5b3b, 0x84a2fc62,
+  0xdf608fe4, 0x843a1d70, 0xe0e60685, 0x83d60412, 0xe26cb01b, 0x8376b422,
+  0xe3f47d96, 0x831c314e, 0xe57d5fda, 0x82c67f14, 0xe70747c4, 0x8275a0c0,
+  0xe8922622, 0x82299971, 0xea1debbb, 0x81e26c16, 0xebaa894f, 0x81a01b6d,
+  0xed37ef91, 0x8162aa04, 0xeec60f31, 0x812a1a3a, 0xf054d8d5, 0x80f66e3c,
+  0xf1e43d1c, 0x80c7a80a, 0xf3742ca2, 0x809dc971, 0xf50497fb, 0x8078d40d,
+  0xf6956fb7, 0x8058c94c, 0xf826a462, 0x803daa6a, 0xf9b82684, 0x80277872,
+  0xfb49e6a3, 0x80163440, 0xfcdbd541, 0x8009de7e, 0xfe6de2e0, 0x800277a6
+};
+
+const q31_t twiddleCoef_1024_q31[1536] = {
+  0x7fffffff, 0x0, 0x7fff6216, 0xc90f88, 0x7ffd885a, 0x1921d20,
+  0x7ffa72d1, 0x25b26d7, 0x7ff62182, 0x3242abf, 0x7ff09478, 0x3ed26e6,
+  0x7fe9cbc0, 0x4b6195d, 0x7fe1c76b, 0x57f0035, 0x7fd8878e, 0x647d97c,
+  0x7fce0c3e, 0x710a345, 0x7fc25596, 0x7d95b9e, 0x7fb563b3, 0x8a2009a,
+  0x7fa736b4, 0x96a9049, 0x7f97cebd, 0xa3308bd, 0x7f872bf3, 0xafb6805,
+  0x7f754e80, 0xbc3ac35, 0x7f62368f, 0xc8bd35e, 0x7f4de451, 0xd53db92,
+  0x7f3857f6, 0xe1bc2e4, 0x7f2191b4, 0xee38766, 0x7f0991c4, 0xfab272b,
+  0x7ef05860, 0x1072a048, 0x7ed5e5c6, 0x1139f0cf, 0x7eba3a39, 0x120116d5,
+  0x7e9d55fc, 0x12c8106f, 0x7e7f3957, 0x138edbb1, 0x7e5fe493, 0x145576b1,
+  0x7e3f57ff, 0x151bdf86, 0x7e1d93ea, 0x15e21445, 0x7dfa98a8, 0x16a81305,
+  0x7dd6668f, 0x176dd9de, 0x7db0fdf8, 0x183366e9, 0x7d8a5f40, 0x18f8b83c,
+  0x7d628ac6, 0x19bdcbf3, 0x7d3980ec, 0x1a82a026, 0x7d0f4218, 0x1b4732ef,
+  0x7ce3ceb2, 0x1c0b826a, 0x7cb72724, 0x1ccf8cb3, 0x7c894bde, 0x1d934fe5,
+  0x7c5a3d50, 0x1e56ca1e, 0x7c29fbee, 0x1f19f97b, 0x7bf88830, 0x1fdcdc1b,
+  0x7bc5e290, 0x209f701c, 0x7b920b89, 0x2161b3a0, 0x7b5d039e, 0x2223a4c5,
+  0x7b26cb4f, 0x22e541af, 0x7aef6323, 0x23a6887f, 0x7ab6cba4, 0x24677758,
+  0x7a7d055b, 0x25280c5e, 0x7a4210d8, 0x25e845b6, 0x7a05eead, 0x26a82186,
+  0x79c89f6e, 0x27679df4, 0x798a23b1, 0x2826b928, 0x794a7c12, 0x28e5714b,
+  0x7909a92d, 0x29a3c485, 0x78c7aba2, 0x2a61b101, 0x78848414, 0x2b1f34eb,
+  0x78403329, 0x2bdc4e6f, 0x77fab989, 0x2c98fbba, 0x77b417df, 0x2d553afc,
+  0x776c4edb, 0x2e110a62, 0x77235f2d, 0x2ecc681e, 0x76d94989, 0x2f875262,
+  0x768e0ea6, 0x3041c761, 0x7641af3d, 0x30fbc54d, 0x75f42c0b, 0x31b54a5e,
+  0x75a585cf, 0x326e54c7, 0x7555bd4c, 0x3326e2c3, 0x7504d345, 0x33def287,
+  0x74b2c884, 0x34968250, 0x745f9dd1, 0x354d9057, 0x740b53fb, 0x36041ad9,
+  0x73b5ebd1, 0x36ba2014, 0x735f6626, 0x376f9e46, 0x7307c3d0, 0x382493b0,
+  0x72af05a7, 0x38d8fe93, 0x72552c85, 0x398cdd32, 0x71fa3949, 0x3a402dd2,
+  0x719e2cd2, 0x3af2eeb7, 0x71410805, 0x3ba51e29, 0x70e2cbc6, 0x3c56ba70,
+  0x708378ff, 0x3d07c1d6, 0x7023109a, 0x3db832a6, 0x6fc19385, 0x3e680b2c,
+  0x6f5f02b2, 0x3f1749b8, 0x6efb5f12, 0x3fc5ec98, 0x6e96a99d, 0x4073f21d,
+  0x6e30e34a, 0x4121589b, 0x6dca0d14, 0x41ce1e65, 0x6d6227fa, 0x427a41d0,
+  0x6cf934fc, 0x4325c135, 0x6c8f351c, 0x43d09aed, 0x6c242960, 0x447acd50,
+  0x6bb812d1, 0x452456bd, 0x6b4af279, 0x45cd358f, 0x6adcc964, 0x46756828,
+  0x6a6d98a4, 0x471cece7, 0x69fd614a, 0x47c3c22f, 0x698c246c, 0x4869e665,
+  0x6919e320, 0x490f57ee, 0x68a69e81, 0x49b41533, 0x683257ab, 0x4a581c9e,
+  0x67bd0fbd, 0x4afb6c98, 0x6746c7d8, 0x4b9e0390, 0x66cf8120, 0x4c3fdff4,
+  0x66573cbb, 0x4ce10034, 0x65ddfbd3, 0x4d8162c4, 0x6563bf92, 0x4e210617,
+  0x64e88926, 0x4ebfe8a5, 0x646c59bf, 0x4f5e08e3, 0x63ef3290, 0x4ffb654d,
+  0x637114cc, 0x5097fc5e, 0x62f201ac, 0x5133cc94, 0x6271fa69, 0x51ced46e,
+  0x61f1003f, 0x5269126e, 0x616f146c, 0x53028518, 0x60ec3830, 0x539b2af0,
+  0x60686ccf, 0x5433027d, 0x5fe3b38d, 0x54ca0a4b, 0x5f5e0db3, 0x556040e2,
+  0x5ed77c8a, 0x55f5a4d2, 0x5e50015d, 0x568a34a9, 0x5dc79d7c, 0x571deefa,
+  0x5d3e5237, 0x57b0d256, 0x5cb420e0, 0x5842dd54, 0x5c290acc, 0x58d40e8c,
+  0x5b9d1154, 0x59646498, 0x5b1035cf, 0x59f3de12, 0x5a82799a, 0x5a82799a,
+  0x59f3de12, 0x5b1035cf, 0x59646498, 0x5b9d1154, 0x58d40e8c, 0x5c290acc,
+  0x5842dd54, 0x5cb420e0, 0x57b0d256, 0x5d3e5237, 0x571deefa, 0x5dc79d7c,
+  0x568a34a9, 0x5e50015d, 0x55f5a4d2, 0x5ed77c8a, 0x556040e2, 0x5f5e0db3,
+  0x54ca0a4b, 0x5fe3b38d, 0x5433027d, 0x60686ccf, 0x539b2af0, 0x60ec3830,
+  0x53028518, 0x616f146c, 0x5269126e, 0x61f1003f, 0x51ced46e, 0x6271fa69,
+  0x5133cc94, 0x62f201ac, 0x5097fc5e, 0x637114cc, 0x4ffb654d, 0x63ef3290,
+  0x4f5e08e3, 0x646c59bf, 0x4ebfe8a5, 0x64e88926, 0x4e210617, 0x6563bf92,
+  0x4d8162c4, 0x65ddfbd3, 0x4ce10034, 0x66573cbb, 0x4c3fdff4, 0x66cf8120,
+  0x4b9e0390, 0x6746c7d8, 0x4afb6c98, 0x67bd0fbd, 0x4a581c9e, 0x683257ab,
+  0x49b41533, 0x68a69e81, 0x490f57ee, 0x6919e320, 0x4869e665, 0x698c246c,
+  0x47c3c22f, 0x69fd614a, 0x471cece7, 0x6a6d98a4, 0x46756828, 0x6adcc964,
+  0x45cd358f, 0x6b4af279, 0x452456bd, 0x6bb812d1, 0x447acd50, 0x6c242960,
+  0x43d09aed, 0x6c8f351c, 0x4325c135, 0x6cf934fc, 0x427a41d0, 0x6d6227fa,
+  0x41ce1e65, 0x6dca0d14, 0x4121589b, 0x6e30e34a, 0x4073f21d, 0x6e96a99d,
+  0x3fc5ec98, 0x6efb5f12, 0x3f1749b8, 0x6f5f02b2, 0x3e680b2c, 0x6fc19385,
+  0x3db832a6, 0x7023109a, 0x3d07c1d6, 0x708378ff, 0x3c56ba70, 0x70e2cbc6,
+  0x3ba51e29, 0x71410805, 0x3af2eeb7, 0x719e2cd2, 0x3a402dd2, 0x71fa3949,
+  0x398cdd32, 0x72552c85, 0x38d8fe93, 0x72af05a7, 0x382493b0, 0x7307c3d0,
+  0x376f9e46, 0x735f6626, 0x36ba2014, 0x73b5ebd1, 0x36041ad9, 0x740b53fb,
+  0x354d9057, 0x745f9dd1, 0x34968250, 0x74b2c884, 0x33def287, 0x7504d345,
+  0x3326e2c3, 0x7555bd4c, 0x326e54c7, 0x75a585cf, 0x31b54a5e, 0x75f42c0b,
+  0x30fbc54d, 0x7641af3d, 0x3041c761, 0x768e0ea6, 0x2f875262, 0x76d94989,
+  0x2ecc681e, 0x77235f2d, 0x2e110a62, 0x776c4edb, 0x2d553afc, 0x77b417df,
+  0x2c98fbba, 0x77fab989, 0x2bdc4e6f, 0x78403329, 0x2b1f34eb, 0x78848414,
+  0x2a61b101, 0x78c7aba2, 0x29a3c485, 0x7909a92d, 0x28e5714b, 0x794a7c12,
+  0x2826b928, 0x798a23b1, 0x27679df4, 0x79c89f6e, 0x26a82186, 0x7a05eead,
+  0x25e845b6, 0x7a4210d8, 0x25280c5e, 0x7a7d055b, 0x24677758, 0x7ab6cba4,
+  0x23a6887f, 0x7aef6323, 0x22e541af, 0x7b26cb4f, 0x2223a4c5, 0x7b5d039e,
+  0x2161b3a0, 0x7b920b89, 0x209f701c, 0x7bc5e290, 0x1fdcdc1b, 0x7bf88830,
+  0x1f19f97b, 0x7c29fbee, 0x1e56ca1e, 0x7c5a3d50, 0x1d934fe5, 0x7c894bde,
+  0x1ccf8cb3, 0x7cb72724, 0x1c0b826a, 0x7ce3ceb2, 0x1b4732ef, 0x7d0f4218,
+  0x1a82a026, 0x7d3980ec, 0x19bdcbf3, 0x7d628ac6, 0x18f8b83c, 0x7d8a5f40,
+  0x183366e9, 0x7db0fdf8, 0x176dd9de, 0x7dd6668f, 0x16a81305, 0x7dfa98a8,
+  0x15e21445, 0x7e1d93ea, 0x151bdf86, 0x7e3f57ff, 0x145576b1, 0x7e5fe493,
+  0x138edbb1, 0x7e7f3957, 0x12c8106f, 0x7e9d55fc, 0x120116d5, 0x7eba3a39,
+  0x1139f0cf, 0x7ed5e5c6, 0x1072a048, 0x7ef05860, 0xfab272b, 0x7f0991c4,
+  0xee38766, 0x7f2191b4, 0xe1bc2e4, 0x7f3857f6, 0xd53db92, 0x7f4de451,
+  0xc8bd35e, 0x7f62368f, 0xbc3ac35, 0x7f754e80, 0xafb6805, 0x7f872bf3,
+  0xa3308bd, 0x7f97cebd, 0x96a9049, 0x7fa736b4, 0x8a2009a, 0x7fb563b3,
+  0x7d95b9e, 0x7fc25596, 0x710a345, 0x7fce0c3e, 0x647d97c, 0x7fd8878e,
+  0x57f0035, 0x7fe1c76b, 0x4b6195d, 0x7fe9cbc0, 0x3ed26e6, 0x7ff09478,
+  0x3242abf, 0x7ff62182, 0x25b26d7, 0x7ffa72d1, 0x1921d20, 0x7ffd885a,
+  0xc90f88, 0x7fff6216, 0x0, 0x7fffffff, 0xff36f078, 0x7fff6216,
+  0xfe6de2e0, 0x7ffd885a, 0xfda4d929, 0x7ffa72d1, 0xfcdbd541, 0x7ff62182,
+  0xfc12d91a, 0x7ff09478, 0xfb49e6a3, 0x7fe9cbc0, 0xfa80ffcb, 0x7fe1c76b,
+  0xf9b82684, 0x7fd8878e, 0xf8ef5cbb, 0x7fce0c3e, 0xf826a462, 0x7fc25596,
+  0xf75dff66, 0x7fb563b3, 0xf6956fb7, 0x7fa736b4, 0xf5ccf743, 0x7f97cebd,
+  0xf50497fb, 0x7f872bf3, 0xf43c53cb, 0x7f754e80, 0xf3742ca2, 0x7f62368f,
+  0xf2ac246e, 0x7f4de451, 0xf1e43d1c, 0x7f3857f6, 0xf11c789a, 0x7f2191b4,
+  0xf054d8d5, 0x7f0991c4, 0xef8d5fb8, 0x7ef05860, 0xeec60f31, 0x7ed5e5c6,
+  0xedfee92b, 0x7eba3a39, 0xed37ef91, 0x7e9d55fc, 0xec71244f, 0x7e7f3957,
+  0xebaa894f, 0x7e5fe493, 0xeae4207a, 0x7e3f57ff, 0xea1debbb, 0x7e1d93ea,
+  0xe957ecfb, 0x7dfa98a8, 0xe8922622, 0x7dd6668f, 0xe7cc9917, 0x7db0fdf8,
+  0xe70747c4, 0x7d8a5f40, 0xe642340d, 0x7d628ac6, 0xe57d5fda, 0x7d3980ec,
+  0xe4b8cd11, 0x7d0f4218, 0xe3f47d96, 0x7ce3ceb2, 0xe330734d, 0x7cb72724,
+  0xe26cb01b, 0x7c894bde, 0xe1a935e2, 0x7c5a3d50, 0xe0e60685, 0x7c29fbee,
+  0xe02323e5, 0x7bf88830, 0xdf608fe4, 0x7bc5e290, 0xde9e4c60, 0x7b920b89,
+  0xdddc5b3b, 0x7b5d039e, 0xdd1abe51, 0x7b26cb4f, 0xdc597781, 0x7aef6323,
+  0xdb9888a8, 0x7ab6cba4, 0xdad7f3a2, 0x7a7d055b, 0xda17ba4a, 0x7a4210d8,
+  0xd957de7a, 0x7a05eead, 0xd898620c, 0x79c89f6e, 0xd7d946d8, 0x798a23b1,
+  0xd71a8eb5, 0x794a7c12, 0xd65c3b7b, 0x7909a92d, 0xd59e4eff, 0x78c7aba2,
+  0xd4e0cb15, 0x78848414, 0xd423b191, 0x78403329, 0xd3670446, 0x77fab989,
+  0xd2aac504, 0x77b417df, 0xd1eef59e, 0x776c4edb, 0xd13397e2, 0x77235f2d,
+  0xd078ad9e, 0x76d94989, 0xcfbe389f, 0x768e0ea6, 0xcf043ab3, 0x7641af3d,
+  0xce4ab5a2, 0x75f42c0b, 0xcd91ab39, 0x75a585cf, 0xccd91d3d, 0x7555bd4c,
+  0xcc210d79, 0x7504d345, 0xcb697db0, 0x74b2c884, 0xcab26fa9, 0x745f9dd1,
+  0xc9fbe527, 0x740b53fb, 0xc945dfec, 0x73b5ebd1, 0xc89061ba, 0x735f6626,
+  0xc7db6c50, 0x7307c3d0, 0xc727016d, 0x72af05a7, 0xc67322ce, 0x72552c85,
+  0xc5bfd22e, 0x71fa3949, 0xc50d1149, 0x719e2cd2, 0xc45ae1d7, 0x71410805,
+  0xc3a94590, 0x70e2cbc6, 0xc2f83e2a, 0x708378ff, 0xc247cd5a, 0x7023109a,
+  0xc197f4d4, 0x6fc19385, 0xc0e8b648, 0x6f5f02b2, 0xc03a1368, 0x6efb5f12,
+  0xbf8c0de3, 0x6e96a99d, 0xbedea765, 0x6e30e34a, 0xbe31e19b, 0x6dca0d14,
+  0xbd85be30, 0x6d6227fa, 0xbcda3ecb, 0x6cf934fc, 0xbc2f6513, 0x6c8f351c,
+  0xbb8532b0, 0x6c242960, 0xbadba943, 0x6bb812d1, 0xba32ca71, 0x6b4af279,
+  0xb98a97d8, 0x6adcc964, 0xb8e31319, 0x6a6d98a4, 0xb83c3dd1, 0x69fd614a,
+  0xb796199b, 0x698c246c, 0xb6f0a812, 0x6919e320, 0xb64beacd, 0x68a69e81,
+  0xb5a7e362, 0x683257ab, 0xb5049368, 0x67bd0fbd, 0xb461fc70, 0x6746c7d8,
+  0xb3c0200c, 0x66cf8120, 0xb31effcc, 0x66573cbb, 0xb27e9d3c, 0x65ddfbd3,
+  0xb1def9e9, 0x6563bf92, 0xb140175b, 0x64e88926, 0xb0a1f71d, 0x646c59bf,
+  0xb0049ab3, 0x63ef3290, 0xaf6803a2, 0x637114cc, 0xaecc336c, 0x62f201ac,
+  0xae312b92, 0x6271fa69, 0xad96ed92, 0x61f1003f, 0xacfd7ae8, 0x616f146c,
+  0xac64d510, 0x60ec3830, 0xabccfd83, 0x60686ccf, 0xab35f5b5, 0x5fe3b38d,
+  0xaa9fbf1e, 0x5f5e0db3, 0xaa0a5b2e, 0x5ed77c8a, 0xa975cb57, 0x5e50015d,
+  0xa8e21106, 0x5dc79d7c, 0xa84f2daa, 0x5d3e5237, 0xa7bd22ac, 0x5cb420e0,
+  0xa72bf174, 0x5c290acc, 0xa69b9b68, 0x5b9d1154, 0xa60c21ee, 0x5b1035cf,
+  0xa57d8666, 0x5a82799a, 0xa4efca31, 0x59f3de12, 0xa462eeac, 0x59646498,
+  0xa3d6f534, 0x58d40e8c, 0xa34bdf20, 0x5842dd54, 0xa2c1adc9, 0x57b0d256,
+  0xa2386284, 0x571deefa, 0xa1affea3, 0x568a34a9, 0xa1288376, 0x55f5a4d2,
+  0xa0a1f24d, 0x556040e2, 0xa01c4c73, 0x54ca0a4b, 0x9f979331, 0x5433027d,
+  0x9f13c7d0, 0x539b2af0, 0x9e90eb94, 0x53028518, 0x9e0effc1, 0x5269126e,
+  0x9d8e0597, 0x51ced46e, 0x9d0dfe54, 0x5133cc94, 0x9c8eeb34, 0x5097fc5e,
+  0x9c10cd70, 0x4ffb654d, 0x9b93a641, 0x4f5e08e3, 0x9b1776da, 0x4ebfe8a5,
+  0x9a9c406e, 0x4e210617, 0x9a22042d, 0x4d8162c4, 0x99a8c345, 0x4ce10034,
+  0x99307ee0, 0x4c3fdff4, 0x98b93828, 0x4b9e0390, 0x9842f043, 0x4afb6c98,
+  0x97cda855, 0x4a581c9e, 0x9759617f, 0x49b41533, 0x96e61ce0, 0x490f57ee,
+  0x9673db94, 0x4869e665, 0x96029eb6, 0x47c3c22f, 0x9592675c, 0x471cece7,
+  0x9523369c, 0x46756828, 0x94b50d87, 0x45cd358f, 0x9447ed2f, 0x452456bd,
+  0x93dbd6a0, 0x447acd50, 0x9370cae4, 0x43d09aed, 0x9306cb04, 0x4325c135,
+  0x929dd806, 0x427a41d0, 0x9235f2ec, 0x41ce1e65, 0x91cf1cb6, 0x4121589b,
+  0x91695663, 0x4073f21d, 0x9104a0ee, 0x3fc5ec98, 0x90a0fd4e, 0x3f1749b8,
+  0x903e6c7b, 0x3e680b2c, 0x8fdcef66, 0x3db832a6, 0x8f7c8701, 0x3d07c1d6,
+  0x8f1d343a, 0x3c56ba70, 0x8ebef7fb, 0x3ba51e29, 0x8e61d32e, 0x3af2eeb7,
+  0x8e05c6b7, 0x3a402dd2, 0x8daad37b, 0x398cdd32, 0x8d50fa59, 0x38d8fe93,
+  0x8cf83c30, 0x382493b0, 0x8ca099da, 0x376f9e46, 0x8c4a142f, 0x36ba2014,
+  0x8bf4ac05, 0x36041ad9, 0x8ba0622f, 0x354d9057, 0x8b4d377c, 0x34968250,
+  0x8afb2cbb, 0x33def287, 0x8aaa42b4, 0x3326e2c3, 0x8a5a7a31, 0x326e54c7,
+  0x8a0bd3f5, 0x31b54a5e, 0x89be50c3, 0x30fbc54d, 0x8971f15a, 0x3041c761,
+  0x8926b677, 0x2f875262, 0x88dca0d3, 0x2ecc681e, 0x8893b125, 0x2e110a62,
+  0x884be821, 0x2d553afc, 0x88054677, 0x2c98fbba, 0x87bfccd7, 0x2bdc4e6f,
+  0x877b7bec, 0x2b1f34eb, 0x8738545e, 0x2a61b101, 0x86f656d3, 0x29a3c485,
+  0x86b583ee, 0x28e5714b, 0x8675dc4f, 0x2826b928, 0x86376092, 0x27679df4,
+  0x85fa1153, 0x26a82186, 0x85bdef28, 0x25e845b6, 0x8582faa5, 0x25280c5e,
+  0x8549345c, 0x24677758, 0x85109cdd, 0x23a6887f, 0x84d934b1, 0x22e541af,
+  0x84a2fc62, 0x2223a4c5, 0x846df477, 0x2161b3a0, 0x843a1d70, 0x209f701c,
+  0x840777d0, 0x1fdcdc1b, 0x83d60412, 0x1f19f97b, 0x83a5c2b0, 0x1e56ca1e,
+  0x8376b422, 0x1d934fe5, 0x8348d8dc, 0x1ccf8cb3, 0x831c314e, 0x1c0b826a,
+  0x82f0bde8, 0x1b4732ef, 0x82c67f14, 0x1a82a026, 0x829d753a, 0x19bdcbf3,
+  0x8275a0c0, 0x18f8b83c, 0x824f0208, 0x183366e9, 0x82299971, 0x176dd9de,
+  0x82056758, 0x16a81305, 0x81e26c16, 0x15e21445, 0x81c0a801, 0x151bdf86,
+  0x81a01b6d, 0x145576b1, 0x8180c6a9, 0x138edbb1, 0x8162aa04, 0x12c8106f,
+  0x8145c5c7, 0x120116d5, 0x812a1a3a, 0x1139f0cf, 0x810fa7a0, 0x1072a048,
+  0x80f66e3c, 0xfab272b, 0x80de6e4c, 0xee38766, 0x80c7a80a, 0xe1bc2e4,
+  0x80b21baf, 0xd53db92, 0x809dc971, 0xc8bd35e, 0x808ab180, 0xbc3ac35,
+  0x8078d40d, 0xafb6805, 0x80683143, 0xa3308bd, 0x8058c94c, 0x96a9049,
+  0x804a9c4d, 0x8a2009a, 0x803daa6a, 0x7d95b9e, 0x8031f3c2, 0x710a345,
+  0x80277872, 0x647d97c, 0x801e3895, 0x57f0035, 0x80163440, 0x4b6195d,
+  0x800f6b88, 0x3ed26e6, 0x8009de7e, 0x3242abf, 0x80058d2f, 0x25b26d7,
+  0x800277a6, 0x1921d20, 0x80009dea, 0xc90f88, 0x80000000, 0x0,
+  0x80009dea, 0xff36f078, 0x800277a6, 0xfe6de2e0, 0x80058d2f, 0xfda4d929,
+  0x8009de7e, 0xfcdbd541, 0x800f6b88, 0xfc12d91a, 0x80163440, 0xfb49e6a3,
+  0x801e3895, 0xfa80ffcb, 0x80277872, 0xf9b82684, 0x8031f3c2, 0xf8ef5cbb,
+  0x803daa6a, 0xf826a462, 0x804a9c4d, 0xf75dff66, 0x8058c94c, 0xf6956fb7,
+  0x80683143, 0xf5ccf743, 0x8078d40d, 0xf50497fb, 0x808ab180, 0xf43c53cb,
+  0x809dc971, 0xf3742ca2, 0x80b21baf, 0xf2ac246e, 0x80c7a80a, 0xf1e43d1c,
+  0x80de6e4c, 0xf11c789a, 0x80f66e3c, 0xf054d8d5, 0x810fa7a0, 0xef8d5fb8,
+  0x812a1a3a, 0xeec60f31, 0x8145c5c7, 0xedfee92b, 0x8162aa04, 0xed37ef91,
+  0x8180c6a9, 0xec71244f, 0x81a01b6d, 0xebaa894f, 0x81c0a801, 0xeae4207a,
+  0x81e26c16, 0xea1debbb, 0x82056758, 0xe957ecfb, 0x82299971, 0xe8922622,
+  0x824f0208, 0xe7cc9917, 0x8275a0c0, 0xe70747c4, 0x829d753a, 0xe642340d,
+  0x82c67f14, 0xe57d5fda, 0x82f0bde8, 0xe4b8cd11, 0x831c314e, 0xe3f47d96,
+  0x8348d8dc, 0xe330734d, 0x8376b422, 0xe26cb01b, 0x83a5c2b0, 0xe1a935e2,
+  0x83d60412, 0xe0e60685, 0x840777d0, 0xe02323e5, 0x843a1d70, 0xdf608fe4,
+  0x846df477, 0xde9e4c60, 0x84a2fc62, 0xdddc5b3b, 0x84d934b1, 0xdd1abe51,
+  0x85109cdd, 0xdc597781, 0x8549345c, 0xdb9888a8, 0x8582faa5, 0xdad7f3a2,
+  0x85bdef28, 0xda17ba4a, 0x85fa1153, 0xd957de7a, 0x86376092, 0xd898620c,
+  0x8675dc4f, 0xd7d946d8, 0x86b583ee, 0xd71a8eb5, 0x86f656d3, 0xd65c3b7b,
+  0x8738545e, 0xd59e4eff, 0x877b7bec, 0xd4e0cb15, 0x87bfccd7, 0xd423b191,
+  0x88054677, 0xd3670446, 0x884be821, 0xd2aac504, 0x8893b125, 0xd1eef59e,
+  0x88dca0d3, 0xd13397e2, 0x8926b677, 0xd078ad9e, 0x8971f15a, 0xcfbe389f,
+  0x89be50c3, 0xcf043ab3, 0x8a0bd3f5, 0xce4ab5a2, 0x8a5a7a31, 0xcd91ab39,
+  0x8aaa42b4, 0xccd91d3d, 0x8afb2cbb, 0xcc210d79, 0x8b4d377c, 0xcb697db0,
+  0x8ba0622f, 0xcab26fa9, 0x8bf4ac05, 0xc9fbe527, 0x8c4a142f, 0xc945dfec,
+  0x8ca099da, 0xc89061ba, 0x8cf83c30, 0xc7db6c50, 0x8d50fa59, 0xc727016d,
+  0x8daad37b, 0xc67322ce, 0x8e05c6b7, 0xc5bfd22e, 0x8e61d32e, 0xc50d1149,
+  0x8ebef7fb, 0xc45ae1d7, 0x8f1d343a, 0xc3a94590, 0x8f7c8701, 0xc2f83e2a,
+  0x8fdcef66, 0xc247cd5a, 0x903e6c7b, 0xc197f4d4, 0x90a0fd4e, 0xc0e8b648,
+  0x9104a0ee, 0xc03a1368, 0x91695663, 0xbf8c0de3, 0x91cf1cb6, 0xbedea765,
+  0x9235f2ec, 0xbe31e19b, 0x929dd806, 0xbd85be30, 0x9306cb04, 0xbcda3ecb,
+  0x9370cae4, 0xbc2f6513, 0x93dbd6a0, 0xbb8532b0, 0x9447ed2f, 0xbadba943,
+  0x94b50d87, 0xba32ca71, 0x9523369c, 0xb98a97d8, 0x9592675c, 0xb8e31319,
+  0x96029eb6, 0xb83c3dd1, 0x9673db94, 0xb796199b, 0x96e61ce0, 0xb6f0a812,
+  0x9759617f, 0xb64beacd, 0x97cda855, 0xb5a7e362, 0x9842f043, 0xb5049368,
+  0x98b93828, 0xb461fc70, 0x99307ee0, 0xb3c0200c, 0x99a8c345, 0xb31effcc,
+  0x9a22042d, 0xb27e9d3c, 0x9a9c406e, 0xb1def9e9, 0x9b1776da, 0xb140175b,
+  0x9b93a641, 0xb0a1f71d, 0x9c10cd70, 0xb0049ab3, 0x9c8eeb34, 0xaf6803a2,
+  0x9d0dfe54, 0xaecc336c, 0x9d8e0597, 0xae312b92, 0x9e0effc1, 0xad96ed92,
+  0x9e90eb94, 0xacfd7ae8, 0x9f13c7d0, 0xac64d510, 0x9f979331, 0xabccfd83,
+  0xa01c4c73, 0xab35f5b5, 0xa0a1f24d, 0xaa9fbf1e, 0xa1288376, 0xaa0a5b2e,
+  0xa1affea3, 0xa975cb57, 0xa2386284, 0xa8e21106, 0xa2c1adc9, 0xa84f2daa,
+  0xa34bdf20, 0xa7bd22ac, 0xa3d6f534, 0xa72bf174, 0xa462eeac, 0xa69b9b68,
+  0xa4efca31, 0xa60c21ee, 0xa57d8666, 0xa57d8666, 0xa60c21ee, 0xa4efca31,
+  0xa69b9b68, 0xa462eeac, 0xa72bf174, 0xa3d6f534, 0xa7bd22ac, 0xa34bdf20,
+  0xa84f2daa, 0xa2c1adc9, 0xa8e21106, 0xa2386284, 0xa975cb57, 0xa1affea3,
+  0xaa0a5b2e, 0xa1288376, 0xaa9fbf1e, 0xa0a1f24d, 0xab35f5b5, 0xa01c4c73,
+  0xabccfd83, 0x9f979331, 0xac64d510, 0x9f13c7d0, 0xacfd7ae8, 0x9e90eb94,
+  0xad96ed92, 0x9e0effc1, 0xae312b92, 0x9d8e0597, 0xaecc336c, 0x9d0dfe54,
+  0xaf6803a2, 0x9c8eeb34, 0xb0049ab3, 0x9c10cd70, 0xb0a1f71d, 0x9b93a641,
+  0xb140175b, 0x9b1776da, 0xb1def9e9, 0x9a9c406e, 0xb27e9d3c, 0x9a22042d,
+  0xb31effcc, 0x99a8c345, 0xb3c0200c, 0x99307ee0, 0xb461fc70, 0x98b93828,
+  0xb5049368, 0x9842f043, 0xb5a7e362, 0x97cda855, 0xb64beacd, 0x9759617f,
+  0xb6f0a812, 0x96e61ce0, 0xb796199b, 0x9673db94, 0xb83c3dd1, 0x96029eb6,
+  0xb8e31319, 0x9592675c, 0xb98a97d8, 0x9523369c, 0xba32ca71, 0x94b50d87,
+  0xbadba943, 0x9447ed2f, 0xbb8532b0, 0x93dbd6a0, 0xbc2f6513, 0x9370cae4,
+  0xbcda3ecb, 0x9306cb04, 0xbd85be30, 0x929dd806, 0xbe31e19b, 0x9235f2ec,
+  0xbedea765, 0x91cf1cb6, 0xbf8c0de3, 0x91695663, 0xc03a1368, 0x9104a0ee,
+  0xc0e8b648, 0x90a0fd4e, 0xc197f4d4, 0x903e6c7b, 0xc247cd5a, 0x8fdcef66,
+  0xc2f83e2a, 0x8f7c8701, 0xc3a94590, 0x8f1d343a, 0xc45ae1d7, 0x8ebef7fb,
+  0xc50d1149, 0x8e61d32e, 0xc5bfd22e, 0x8e05c6b7, 0xc67322ce, 0x8daad37b,
+  0xc727016d, 0x8d50fa59, 0xc7db6c50, 0x8cf83c30, 0xc89061ba, 0x8ca099da,
+  0xc945dfec, 0x8c4a142f, 0xc9fbe527, 0x8bf4ac05, 0xcab26fa9, 0x8ba0622f,
+  0xcb697db0, 0x8b4d377c, 0xcc210d79, 0x8afb2cbb, 0xccd91d3d, 0x8aaa42b4,
+  0xcd91ab39, 0x8a5a7a31, 0xce4ab5a2, 0x8a0bd3f5, 0xcf043ab3, 0x89be50c3,
+  0xcfbe389f, 0x8971f15a, 0xd078ad9e, 0x8926b677, 0xd13397e2, 0x88dca0d3,
+  0xd1eef59e, 0x8893b125, 0xd2aac504, 0x884be821, 0xd3670446, 0x88054677,
+  0xd423b191, 0x87bfccd7, 0xd4e0cb15, 0x877b7bec, 0xd59e4eff, 0x8738545e,
+  0xd65c3b7b, 0x86f656d3, 0xd71a8eb5, 0x86b583ee, 0xd7d946d8, 0x8675dc4f,
+  0xd898620c, 0x86376092, 0xd957de7a, 0x85fa1153, 0xda17ba4a, 0x85bdef28,
+  0xdad7f3a2, 0x8582faa5, 0xdb9888a8, 0x8549345c, 0xdc597781, 0x85109cdd,
+  0xdd1abe51, 0x84d934b1, 0xdddc5b3b, 0x84a2fc62, 0xde9e4c60, 0x846df477,
+  0xdf608fe4, 0x843a1d70, 0xe02323e5, 0x840777d0, 0xe0e60685, 0x83d60412,
+  0xe1a935e2, 0x83a5c2b0, 0xe26cb01b, 0x8376b422, 0xe330734d, 0x8348d8dc,
+  0xe3f47d96, 0x831c314e, 0xe4b8cd11, 0x82f0bde8, 0xe57d5fda, 0x82c67f14,
+  0xe642340d, 0x829d753a, 0xe70747c4, 0x8275a0c0, 0xe7cc9917, 0x824f0208,
+  0xe8922622, 0x82299971, 0xe957ecfb, 0x82056758, 0xea1debbb, 0x81e26c16,
+  0xeae4207a, 0x81c0a801, 0xebaa894f, 0x81a01b6d, 0xec71244f, 0x8180c6a9,
+  0xed37ef91, 0x8162aa04, 0xedfee92b, 0x8145c5c7, 0xeec60f31, 0x812a1a3a,
+  0xef8d5fb8, 0x810fa7a0, 0xf054d8d5, 0x80f66e3c, 0xf11c789a, 0x80de6e4c,
+  0xf1e43d1c, 0x80c7a80a, 0xf2ac246e, 0x80b21baf, 0xf3742ca2, 0x809dc971,
+  0xf43c53cb, 0x808ab180, 0xf50497fb, 0x8078d40d, 0xf5ccf743, 0x80683143,
+  0xf6956fb7, 0x8058c94c, 0xf75dff66, 0x804a9c4d, 0xf826a462, 0x803daa6a,
+  0xf8ef5cbb, 0x8031f3c2, 0xf9b82684, 0x80277872, 0xfa80ffcb, 0x801e3895,
+  0xfb49e6a3, 0x80163440, 0xfc12d91a, 0x800f6b88, 0xfcdbd541, 0x8009de7e,
+  0xfda4d929, 0x80058d2f, 0xfe6de2e0, 0x800277a6, 0xff36f078, 0x80009dea
+};
+
+const q31_t twiddleCoef_2048_q31[3072] = {
+  0x7fffffff, 0x0, 0x7fffd886, 0x6487e3, 0x7fff6216, 0xc90f88,
+  0x7ffe9cb2, 0x12d96b1, 0x7ffd885a, 0x1921d20, 0x7ffc250f, 0x1f6a297,
+  0x7ffa72d1, 0x25b26d7, 0x7ff871a2, 0x2bfa9a4, 0x7ff62182, 0x3242abf,
+  0x7ff38274, 0x388a9ea, 0x7ff09478, 0x3ed26e6, 0x7fed5791, 0x451a177,
+  0x7fe9cbc0, 0x4b6195d, 0x7fe5f108, 0x51a8e5c, 0x7fe1c76b, 0x57f0035,
+  0x7fdd4eec, 0x5e36ea9, 0x7fd8878e, 0x647d97c, 0x7fd37153, 0x6ac406f,
+  0x7fce0c3e, 0x710a345, 0x7fc85854, 0x77501be, 0x7fc25596, 0x7d95b9e,
+  0x7fbc040a, 0x83db0a7, 0x7fb563b3, 0x8a2009a, 0x7fae7495, 0x9064b3a,
+  0x7fa736b4, 0x96a9049, 0x7f9faa15, 0x9cecf89, 0x7f97cebd, 0xa3308bd,
+  0x7f8fa4b0, 0xa973ba5, 0x7f872bf3, 0xafb6805, 0x7f7e648c, 0xb5f8d9f,
+  0x7f754e80, 0xbc3ac35, 0x7f6be9d4, 0xc27c389, 0x7f62368f, 0xc8bd35e,
+  0x7f5834b7, 0xcefdb76, 0x7f4de451, 0xd53db92, 0x7f434563, 0xdb7d376,
+  0x7f3857f6, 0xe1bc2e4, 0x7f2d1c0e, 0xe7fa99e, 0x7f2191b4, 0xee38766,
+  0x7f15b8ee, 0xf475bff, 0x7f0991c4, 0xfab272b, 0x7efd1c3c, 0x100ee8ad,
+  0x7ef05860, 0x1072a048, 0x7ee34636, 0x10d64dbd, 0x7ed5e5c6, 0x1139f0cf,
+  0x7ec8371a, 0x119d8941, 0x7eba3a39, 0x120116d5, 0x7eabef2c, 0x1264994e,
+  0x7e9d55fc, 0x12c8106f, 0x7e8e6eb2, 0x132b7bf9, 0x7e7f3957, 0x138edbb1,
+  0x7e6fb5f4, 0x13f22f58, 0x7e5fe493, 0x145576b1, 0x7e4fc53e, 0x14b8b17f,
+  0x7e3f57ff, 0x151bdf86, 0x7e2e9cdf, 0x157f0086, 0x7e1d93ea, 0x15e21445,
+  0x7e0c3d29, 0x16451a83, 0x7dfa98a8, 0x16a81305, 0x7de8a670, 0x170afd8d,
+  0x7dd6668f, 0x176dd9de, 0x7dc3d90d, 0x17d0a7bc, 0x7db0fdf8, 0x183366e9,
+  0x7d9dd55a, 0x18961728, 0x7d8a5f40, 0x18f8b83c, 0x7d769bb5, 0x195b49ea,
+  0x7d628ac6, 0x19bdcbf3, 0x7d4e2c7f, 0x1a203e1b, 0x7d3980ec, 0x1a82a026,
+  0x7d24881b, 0x1ae4f1d6, 0x7d0f4218, 0x1b4732ef, 0x7cf9aef0, 0x1ba96335,
+  0x7ce3ceb2, 0x1c0b826a, 0x7ccda169, 0x1c6d9053, 0x7cb72724, 0x1ccf8cb3,
+  0x7ca05ff1, 0x1d31774d, 0x7c894bde, 0x1d934fe5, 0x7c71eaf9, 0x1df5163f,
+  0x7c5a3d50, 0x1e56ca1e, 0x7c4242f2, 0x1eb86b46, 0x7c29fbee, 0x1f19f97b,
+  0x7c116853, 0x1f7b7481, 0x7bf88830, 0x1fdcdc1b, 0x7bdf5b94, 0x203e300d,
+  0x7bc5e290, 0x209f701c, 0x7bac1d31, 0x21009c0c, 0x7b920b89, 0x2161b3a0,
+  0x7b77ada8, 0x21c2b69c, 0x7b5d039e, 0x2223a4c5, 0x7b420d7a, 0x22847de0,
+  0x7b26cb4f, 0x22e541af, 0x7b0b3d2c, 0x2345eff8, 0x7aef6323, 0x23a6887f,
+  0x7ad33d45, 0x24070b08, 0x7ab6cba4, 0x24677758, 0x7a9a0e50, 0x24c7cd33,
+  0x7a7d055b, 0x25280c5e, 0x7a5fb0d8, 0x2588349d, 0x7a4210d8, 0x25e845b6,
+  0x7a24256f, 0x26483f6c, 0x7a05eead, 0x26a82186, 0x79e76ca7, 0x2707ebc7,
+  0x79c89f6e, 0x27679df4, 0x79a98715, 0x27c737d3, 0x798a23b1, 0x2826b928,
+  0x796a7554, 0x288621b9, 0x794a7c12, 0x28e5714b, 0x792a37fe, 0x2944a7a2,
+  0x7909a92d, 0x29a3c485, 0x78e8cfb2, 0x2a02c7b8, 0x78c7aba2, 0x2a61b101,
+  0x78a63d11, 0x2ac08026, 0x78848414, 0x2b1f34eb, 0x786280bf, 0x2b7dcf17,
+  0x78403329, 0x2bdc4e6f, 0x781d9b65, 0x2c3ab2b9, 0x77fab989, 0x2c98fbba,
+  0x77d78daa, 0x2cf72939, 0x77b417df, 0x2d553afc, 0x7790583e, 0x2db330c7,
+  0x776c4edb, 0x2e110a62, 0x7747fbce, 0x2e6ec792, 0x77235f2d, 0x2ecc681e,
+  0x76fe790e, 0x2f29ebcc, 0x76d94989, 0x2f875262, 0x76b3d0b4, 0x2fe49ba7,
+  0x768e0ea6, 0x3041c761, 0x76680376, 0x309ed556, 0x7641af3d, 0x30fbc54d,
+  0x761b1211, 0x3158970e, 0x75f42c0b, 0x31b54a5e, 0x75ccfd42, 0x3211df04,
+  0x75a585cf, 0x326e54c7, 0x757dc5ca, 0x32caab6f, 0x7555bd4c, 0x3326e2c3,
+  0x752d6c6c, 0x3382fa88, 0x7504d345, 0x33def287, 0x74dbf1ef, 0x343aca87,
+  0x74b2c884, 0x34968250, 0x7489571c, 0x34f219a8, 0x745f9dd1, 0x354d9057,
+  0x74359cbd, 0x35a8e625, 0x740b53fb, 0x36041ad9, 0x73e0c3a3, 0x365f2e3b,
+  0x73b5ebd1, 0x36ba2014, 0x738acc9e, 0x3714f02a, 0x735f6626, 0x376f9e46,
+  0x7333b883, 0x37ca2a30, 0x7307c3d0, 0x382493b0, 0x72db8828, 0x387eda8e,
+  0x72af05a7, 0x38d8fe93, 0x72823c67, 0x3932ff87, 0x72552c85, 0x398cdd32,
+  0x7227d61c, 0x39e6975e, 0x71fa3949, 0x3a402dd2, 0x71cc5626, 0x3a99a057,
+  0x719e2cd2, 0x3af2eeb7, 0x716fbd68, 0x3b4c18ba, 0x71410805, 0x3ba51e29,
+  0x71120cc5, 0x3bfdfecd, 0x70e2cbc6, 0x3c56ba70, 0x70b34525, 0x3caf50da,
+  0x708378ff, 0x3d07c1d6, 0x70536771, 0x3d600d2c, 0x7023109a, 0x3db832a6,
+  0x6ff27497, 0x3e10320d, 0x6fc19385, 0x3e680b2c, 0x6f906d84, 0x3ebfbdcd,
+  0x6f5f02b2, 0x3f1749b8, 0x6f2d532c, 0x3f6eaeb8, 0x6efb5f12, 0x3fc5ec98,
+  0x6ec92683, 0x401d0321, 0x6e96a99d, 0x4073f21d, 0x6e63e87f, 0x40cab958,
+  0x6e30e34a, 0x4121589b, 0x6dfd9a1c, 0x4177cfb1, 0x6dca0d14, 0x41ce1e65,
+  0x6d963c54, 0x42244481, 0x6d6227fa, 0x427a41d0, 0x6d2dd027, 0x42d0161e,
+  0x6cf934fc, 0x4325c135, 0x6cc45698, 0x437b42e1, 0x6c8f351c, 0x43d09aed,
+  0x6c59d0a9, 0x4425c923, 0x6c242960, 0x447acd50, 0x6bee3f62, 0x44cfa740,
+  0x6bb812d1, 0x452456bd, 0x6b81a3cd, 0x4578db93, 0x6b4af279, 0x45cd358f,
+  0x6b13fef5, 0x4621647d, 0x6adcc964, 0x46756828, 0x6aa551e9, 0x46c9405c,
+  0x6a6d98a4, 0x471cece7, 0x6a359db9, 0x47706d93, 0x69fd614a, 0x47c3c22f,
+  0x69c4e37a, 0x4816ea86, 0x698c246c, 0x4869e665, 0x69532442, 0x48bcb599,
+  0x6919e320, 0x490f57ee, 0x68e06129, 0x4961cd33, 0x68a69e81, 0x49b41533,
+  0x686c9b4b, 0x4a062fbd, 0x683257ab, 0x4a581c9e, 0x67f7d3c5, 0x4aa9dba2,
+  0x67bd0fbd, 0x4afb6c98, 0x67820bb7, 0x4b4ccf4d, 0x6746c7d8, 0x4b9e0390,
+  0x670b4444, 0x4bef092d, 0x66cf8120, 0x4c3fdff4, 0x66937e91, 0x4c9087b1,
+  0x66573cbb, 0x4ce10034, 0x661abbc5, 0x4d31494b, 0x65ddfbd3, 0x4d8162c4,
+  0x65a0fd0b, 0x4dd14c6e, 0x6563bf92, 0x4e210617, 0x6526438f, 0x4e708f8f,
+  0x64e88926, 0x4ebfe8a5, 0x64aa907f, 0x4f0f1126, 0x646c59bf, 0x4f5e08e3,
+  0x642de50d, 0x4faccfab, 0x63ef3290, 0x4ffb654d, 0x63b0426d, 0x5049c999,
+  0x637114cc, 0x5097fc5e, 0x6331a9d4, 0x50e5fd6d, 0x62f201ac, 0x5133cc94,
+  0x62b21c7b, 0x518169a5, 0x6271fa69, 0x51ced46e, 0x62319b9d, 0x521c0cc2,
+  0x61f1003f, 0x5269126e, 0x61b02876, 0x52b5e546, 0x616f146c, 0x53028518,
+  0x612dc447, 0x534ef1b5, 0x60ec3830, 0x539b2af0, 0x60aa7050, 0x53e73097,
+  0x60686ccf, 0x5433027d, 0x60262dd6, 0x547ea073, 0x5fe3b38d, 0x54ca0a4b,
+  0x5fa0fe1f, 0x55153fd4, 0x5f5e0db3, 0x556040e2, 0x5f1ae274, 0x55ab0d46,
+  0x5ed77c8a, 0x55f5a4d2, 0x5e93dc1f, 0x56400758, 0x5e50015d, 0x568a34a9,
+  0x5e0bec6e, 0x56d42c99, 0x5dc79d7c, 0x571deefa, 0x5d8314b1, 0x57677b9d,
+  0x5d3e5237, 0x57b0d256, 0x5cf95638, 0x57f9f2f8, 0x5cb420e0, 0x5842dd54,
+  0x5c6eb258, 0x588b9140, 0x5c290acc, 0x58d40e8c, 0x5be32a67, 0x591c550e,
+  0x5b9d1154, 0x59646498, 0x5b56bfbd, 0x59ac3cfd, 0x5b1035cf, 0x59f3de12,
+  0x5ac973b5, 0x5a3b47ab, 0x5a82799a, 0x5a82799a, 0x5a3b47ab, 0x5ac973b5,
+  0x59f3de12, 0x5b1035cf, 0x59ac3cfd, 0x5b56bfbd, 0x59646498, 0x5b9d1154,
+  0x591c550e, 0x5be32a67, 0x58d40e8c, 0x5c290acc, 0x588b9140, 0x5c6eb258,
+  0x5842dd54, 0x5cb420e0, 0x57f9f2f8, 0x5cf95638, 0x57b0d256, 0x5d3e5237,
+  0x57677b9d, 0x5d8314b1, 0x571deefa, 0x5dc79d7c, 0x56d42c99, 0x5e0bec6e,
+  0x568a34a9, 0x5e50015d, 0x56400758, 0x5e93dc1f, 0x55f5a4d2, 0x5ed77c8a,
+  0x55ab0d46, 0x5f1ae274, 0x556040e2, 0x5f5e0db3, 0x55153fd4, 0x5fa0fe1f,
+  0x54ca0a4b, 0x5fe3b38d, 0x547ea073, 0x60262dd6, 0x5433027d, 0x60686ccf,
+  0x53e73097, 0x60aa7050, 0x539b2af0, 0x60ec3830, 0x534ef1b5, 0x612dc447,
+  0x53028518, 0x616f146c, 0x52b5e546, 0x61b02876, 0x5269126e, 0x61f1003f,
+  0x521c0cc2, 0x62319b9d, 0x51ced46e, 0x6271fa69, 0x518169a5, 0x62b21c7b,
+  0x5133cc94, 0x62f201ac, 0x50e5fd6d, 0x6331a9d4, 0x5097fc5e, 0x637114cc,
+  0x5049c999, 0x63b0426d, 0x4ffb654d, 0x63ef3290, 0x4faccfab, 0x642de50d,
+  0x4f5e08e3, 0x646c59bf, 0x4f0f1126, 0x64aa907f, 0x4ebfe8a5, 0x64e88926,
+  0x4e708f8f, 0x6526438f, 0x4e210617, 0x6563bf92, 0x4dd14c6e, 0x65a0fd0b,
+  0x4d8162c4, 0x65ddfbd3, 0x4d31494b, 0x661abbc5, 0x4ce10034, 0x66573cbb,
+  0x4c9087b1, 0x66937e91, 0x4c3fdff4, 0x66cf8120, 0x4bef092d, 0x670b4444,
+  0x4b9e0390, 0x6746c7d8, 0x4b4ccf4d, 0x67820bb7, 0x4afb6c98, 0x67bd0fbd,
+  0x4aa9dba2, 0x67f7d3c5, 0x4a581c9e, 0x683257ab, 0x4a062fbd, 0x686c9b4b,
+  0x49b41533, 0x68a69e81, 0x4961cd33, 0x68e06129, 0x490f57ee, 0x6919e320,
+  0x48bcb599, 0x69532442, 0x4869e665, 0x698c246c, 0x4816ea86, 0x69c4e37a,
+  0x47c3c22f, 0x69fd614a, 0x47706d93, 0x6a359db9, 0x471cece7, 0x6a6d98a4,
+  0x46c9405c, 0x6aa551e9, 0x46756828, 0x6adcc964, 0x4621647d, 0x6b13fef5,
+  0x45cd358f, 0x6b4af279, 0x4578db93, 0x6b81a3cd, 0x452456bd, 0x6bb812d1,
+  0x44cfa740, 0x6bee3f62, 0x447acd50, 0x6c242960, 0x4425c923, 0x6c59d0a9,
+  0x43d09aed, 0x6c8f351c, 0x437b42e1, 0x6cc45698, 0x4325c135, 0x6cf934fc,
+  0x42d0161e, 0x6d2dd027, 0x427a41d0, 0x6d6227fa, 0x42244481, 0x6d963c54,
+  0x41ce1e65, 0x6dca0d14, 0x4177cfb1, 0x6dfd9a1c, 0x4121589b, 0x6e30e34a,
+  0x40cab958, 0x6e63e87f, 0x4073f21d, 0x6e96a99d, 0x401d0321, 0x6ec92683,
+  0x3fc5ec98, 0x6efb5f12, 0x3f6eaeb8, 0x6f2d532c, 0x3f1749b8, 0x6f5f02b2,
+  0x3ebfbdcd, 0x6f906d84, 0x3e680b2c, 0x6fc19385, 0x3e10320d, 0x6ff27497,
+  0x3db832a6, 0x7023109a, 0x3d600d2c, 0x70536771, 0x3d07c1d6, 0x708378ff,
+  0x3caf50da, 0x70b34525, 0x3c56ba70, 0x70e2cbc6, 0x3bfdfecd, 0x71120cc5,
+  0x3ba51e29, 0x71410805, 0x3b4c18ba, 0x716fbd68, 0x3af2eeb7, 0x719e2cd2,
+  0x3a99a057, 0x71cc5626, 0x3a402dd2, 0x71fa3949, 0x39e6975e, 0x7227d61c,
+  0x398cdd32, 0x72552c85, 0x3932ff87, 0x72823c67, 0x38d8fe93, 0x72af05a7,
+  0x387eda8e, 0x72db8828, 0x382493b0, 0x7307c3d0, 0x37ca2a30, 0x7333b883,
+  0x376f9e46, 0x735f6626, 0x3714f02a, 0x738acc9e, 0x36ba2014, 0x73b5ebd1,
+  0x365f2e3b, 0x73e0c3a3, 0x36041ad9, 0x740b53fb, 0x35a8e625, 0x74359cbd,
+  0x354d9057, 0x745f9dd1, 0x34f219a8, 0x7489571c, 0x34968250, 0x74b2c884,
+  0x343aca87, 0x74dbf1ef, 0x33def287, 0x7504d345, 0x3382fa88, 0x752d6c6c,
+  0x3326e2c3, 0x7555bd4c, 0x32caab6f, 0x757dc5ca, 0x326e54c7, 0x75a585cf,
+  0x3211df04, 0x75ccfd42, 0x31b54a5e, 0x75f42c0b, 0x3158970e, 0x761b1211,
+  0x30fbc54d, 0x7641af3d, 0x309ed556, 0x76680376, 0x3041c761, 0x768e0ea6,
+  0x2fe49ba7, 0x76b3d0b4, 0x2f875262, 0x76d94989, 0x2f29ebcc, 0x76fe790e,
+  0x2ecc681e, 0x77235f2d, 0x2e6ec792, 0x7747fbce, 0x2e110a62, 0x776c4edb,
+  0x2db330c7, 0x7790583e, 0x2d553afc, 0x77b417df, 0x2cf72939, 0x77d78daa,
+  0x2c98fbba, 0x77fab989, 0x2c3ab2b9, 0x781d9b65, 0x2bdc4e6f, 0x78403329,
+  0x2b7dcf17, 0x786280bf, 0x2b1f34eb, 0x78848414, 0x2ac08026, 0x78a63d11,
+  0x2a61b101, 0x78c7aba2, 0x2a02c7b8, 0x78e8cfb2, 0x29a3c485, 0x7909a92d,
+  0x2944a7a2, 0x792a37fe, 0x28e5714b, 0x794a7c12, 0x288621b9, 0x796a7554,
+  0x2826b928, 0x798a23b1, 0x27c737d3, 0x79a98715, 0x27679df4, 0x79c89f6e,
+  0x2707ebc7, 0x79e76ca7, 0x26a82186, 0x7a05eead, 0x26483f6c, 0x7a24256f,
+  0x25e845b6, 0x7a4210d8, 0x2588349d, 0x7a5fb0d8, 0x25280c5e, 0x7a7d055b,
+  0x24c7cd33, 0x7a9a0e50, 0x24677758, 0x7ab6cba4, 0x24070b08, 0x7ad33d45,
+  0x23a6887f, 0x7aef6323, 0x2345eff8, 0x7b0b3d2c, 0x22e541af, 0x7b26cb4f,
+  0x22847de0, 0x7b420d7a, 0x2223a4c5, 0x7b5d039e, 0x21c2b69c, 0x7b77ada8,
+  0x2161b3a0, 0x7b920b89, 0x21009c0c, 0x7bac1d31, 0x209f701c, 0x7bc5e290,
+  0x203e300d, 0x7bdf5b94, 0x1fdcdc1b, 0x7bf88830, 0x1f7b7481, 0x7c116853,
+  0x1f19f97b, 0x7c29fbee, 0x1eb86b46, 0x7c4242f2, 0x1e56ca1e, 0x7c5a3d50,
+  0x1df5163f, 0x7c71eaf9, 0x1d934fe5, 0x7c894bde, 0x1d31774d, 0x7ca05ff1,
+  0x1ccf8cb3, 0x7cb72724, 0x1c6d9053, 0x7ccda169, 0x1c0b826a, 0x7ce3ceb2,
+  0x1ba96335, 0x7cf9aef0, 0x1b4732ef, 0x7d0f4218, 0x1ae4f1d6, 0x7d24881b,
+  0x1a82a026, 0x7d3980ec, 0x1a203e1b, 0x7d4e2c7f, 0x19bdcbf3, 0x7d628ac6,
+  0x195b49ea, 0x7d769bb5, 0x18f8b83c, 0x7d8a5f40, 0x18961728, 0x7d9dd55a,
+  0x183366e9, 0x7db0fdf8, 0x17d0a7bc, 0x7dc3d90d, 0x176dd9de, 0x7dd6668f,
+  0x170afd8d, 0x7de8a670, 0x16a81305, 0x7dfa98a8, 0x16451a83, 0x7e0c3d29,
+  0x15e21445, 0x7e1d93ea, 0x157f0086, 0x7e2e9cdf, 0x151bdf86, 0x7e3f57ff,
+  0x14b8b17f, 0x7e4fc53e, 0x145576b1, 0x7e5fe493, 0x13f22f58, 0x7e6fb5f4,
+  0x138edbb1, 0x7e7f3957, 0x132b7bf9, 0x7e8e6eb2, 0x12c8106f, 0x7e9d55fc,
+  0x1264994e, 0x7eabef2c, 0x120116d5, 0x7eba3a39, 0x119d8941, 0x7ec8371a,
+  0x1139f0cf, 0x7ed5e5c6, 0x10d64dbd, 0x7ee34636, 0x1072a048, 0x7ef05860,
+  0x100ee8ad, 0x7efd1c3c, 0xfab272b, 0x7f0991c4, 0xf475bff, 0x7f15b8ee,
+  0xee38766, 0x7f2191b4, 0xe7fa99e, 0x7f2d1c0e, 0xe1bc2e4, 0x7f3857f6,
+  0xdb7d376, 0x7f434563, 0xd53db92, 0x7f4de451, 0xcefdb76, 0x7f5834b7,
+  0xc8bd35e, 0x7f62368f, 0xc27c389, 0x7f6be9d4, 0xbc3ac35, 0x7f754e80,
+  0xb5f8d9f, 0x7f7e648c, 0xafb6805, 0x7f872bf3, 0xa973ba5, 0x7f8fa4b0,
+  0xa3308bd, 0x7f97cebd, 0x9cecf89, 0x7f9faa15, 0x96a9049, 0x7fa736b4,
+  0x9064b3a, 0x7fae7495, 0x8a2009a, 0x7fb563b3, 0x83db0a7, 0x7fbc040a,
+  0x7d95b9e, 0x7fc25596, 0x77501be, 0x7fc85854, 0x710a345, 0x7fce0c3e,
+  0x6ac406f, 0x7fd37153, 0x647d97c, 0x7fd8878e, 0x5e36ea9, 0x7fdd4eec,
+  0x57f0035, 0x7fe1c76b, 0x51a8e5c, 0x7fe5f108, 0x4b6195d, 0x7fe9cbc0,
+  0x451a177, 0x7fed5791, 0x3ed26e6, 0x7ff09478, 0x388a9ea, 0x7ff38274,
+  0x3242abf, 0x7ff62182, 0x2bfa9a4, 0x7ff871a2, 0x25b26d7, 0x7ffa72d1,
+  0x1f6a297, 0x7ffc250f, 0x1921d20, 0x7ffd885a, 0x12d96b1, 0x7ffe9cb2,
+  0xc90f88, 0x7fff6216, 0x6487e3, 0x7fffd886, 0x0, 0x7fffffff,
+  0xff9b781d, 0x7fffd886, 0xff36f078, 0x7fff6216, 0xfed2694f, 0x7ffe9cb2,
+  0xfe6de2e0, 0x7ffd885a, 0xfe095d69, 0x7ffc250f, 0xfda4d929, 0x7ffa72d1,
+  0xfd40565c, 0x7ff871a2, 0xfcdbd541, 0x7ff62182, 0xfc775616, 0x7ff38274,
+  0xfc12d91a, 0x7ff09478, 0xfbae5e89, 0x7fed5791, 0xfb49e6a3, 0x7fe9cbc0,
+  0xfae571a4, 0x7fe5f108, 0xfa80ffcb, 0x7fe1c76b, 0xfa1c9157, 0x7fdd4eec,
+  0xf9b82684, 0x7fd8878e, 0xf953bf91, 0x7fd37153, 0xf8ef5cbb, 0x7fce0c3e,
+  0xf88afe42, 0x7fc85854, 0xf826a462, 0x7fc25596, 0xf7c24f59, 0x7fbc040a,
+  0xf75dff66, 0x7fb563b3, 0xf6f9b4c6, 0x7fae7495, 0xf6956fb7, 0x7fa736b4,
+  0xf6313077, 0x7f9faa15, 0xf5ccf743, 0x7f97cebd, 0xf568c45b, 0x7f8fa4b0,
+  0xf50497fb, 0x7f872bf3, 0xf4a07261, 0x7f7e648c, 0xf43c53cb, 0x7f754e80,
+  0xf3d83c77, 0x7f6be9d4, 0xf3742ca2, 0x7f62368f, 0xf310248a, 0x7f5834b7,
+  0xf2ac246e, 0x7f4de451, 0xf2482c8a, 0x7f434563, 0xf1e43d1c, 0x7f3857f6,
+  0xf1805662, 0x7f2d1c0e, 0xf11c789a, 0x7f2191b4, 0xf0b8a401, 0x7f15b8ee,
+  0xf054d8d5, 0x7f0991c4, 0xeff11753, 0x7efd1c3c, 0xef8d5fb8, 0x7ef05860,
+  0xef29b243, 0x7ee34636, 0xeec60f31, 0x7ed5e5c6, 0xee6276bf, 0x7ec8371a,
+  0xedfee92b, 0x7eba3a39, 0xed9b66b2, 0x7eabef2c, 0xed37ef91, 0x7e9d55fc,
+  0xecd48407, 0x7e8e6eb2, 0xec71244f, 0x7e7f3957, 0xec0dd0a8, 0x7e6fb5f4,
+  0xebaa894f, 0x7e5fe493, 0xeb474e81, 0x7e4fc53e, 0xeae4207a, 0x7e3f57ff,
+  0xea80ff7a, 0x7e2e9cdf, 0xea1debbb, 0x7e1d93ea, 0xe9bae57d, 0x7e0c3d29,
+  0xe957ecfb, 0x7dfa98a8, 0xe8f50273, 0x7de8a670, 0xe8922622, 0x7dd6668f,
+  0xe82f5844, 0x7dc3d90d, 0xe7cc9917, 0x7db0fdf8, 0xe769e8d8, 0x7d9dd55a,
+  0xe70747c4, 0x7d8a5f40, 0xe6a4b616, 0x7d769bb5, 0xe642340d, 0x7d628ac6,
+  0xe5dfc1e5, 0x7d4e2c7f, 0xe57d5fda, 0x7d3980ec, 0xe51b0e2a, 0x7d24881b,
+  0xe4b8cd11, 0x7d0f4218, 0xe4569ccb, 0x7cf9aef0, 0xe3f47d96, 0x7ce3ceb2,
+  0xe3926fad, 0x7ccda169, 0xe330734d, 0x7cb72724, 0xe2ce88b3, 0x7ca05ff1,
+  0xe26cb01b, 0x7c894bde, 0xe20ae9c1, 0x7c71eaf9, 0xe1a935e2, 0x7c5a3d50,
+  0xe14794ba, 0x7c4242f2, 0xe0e60685, 0x7c29fbee, 0xe0848b7f, 0x7c116853,
+  0xe02323e5, 0x7bf88830, 0xdfc1cff3, 0x7bdf5b94, 0xdf608fe4, 0x7bc5e290,
+  0xdeff63f4, 0x7bac1d31, 0xde9e4c60, 0x7b920b89, 0xde3d4964, 0x7b77ada8,
+  0xdddc5b3b, 0x7b5d039e, 0xdd7b8220, 0x7b420d7a, 0xdd1abe51, 0x7b26cb4f,
+  0xdcba1008, 0x7b0b3d2c, 0xdc597781, 0x7aef6323, 0xdbf8f4f8, 0x7ad33d45,
+  0xdb9888a8, 0x7ab6cba4, 0xdb3832cd, 0x7a9a0e50, 0xdad7f3a2, 0x7a7d055b,
+  0xda77cb63, 0x7a5fb0d8, 0xda17ba4a, 0x7a4210d8, 0xd9b7c094, 0x7a24256f,
+  0xd957de7a, 0x7a05eead, 0xd8f81439, 0x79e76ca7, 0xd898620c, 0x79c89f6e,
+  0xd838c82d, 0x79a98715, 0xd7d946d8, 0x798a23b1, 0xd779de47, 0x796a7554,
+  0xd71a8eb5, 0x794a7c12, 0xd6bb585e, 0x792a37fe, 0xd65c3b7b, 0x7909a92d,
+  0xd5fd3848, 0x78e8cfb2, 0xd59e4eff, 0x78c7aba2, 0xd53f7fda, 0x78a63d11,
+  0xd4e0cb15, 0x78848414, 0xd48230e9, 0x786280bf, 0xd423b191, 0x78403329,
+  0xd3c54d47, 0x781d9b65, 0xd3670446, 0x77fab989, 0xd308d6c7, 0x77d78daa,
+  0xd2aac504, 0x77b417df, 0xd24ccf39, 0x7790583e, 0xd1eef59e, 0x776c4edb,
+  0xd191386e, 0x7747fbce, 0xd13397e2, 0x77235f2d, 0xd0d61434, 0x76fe790e,
+  0xd078ad9e, 0x76d94989, 0xd01b6459, 0x76b3d0b4, 0xcfbe389f, 0x768e0ea6,
+  0xcf612aaa, 0x76680376, 0xcf043ab3, 0x7641af3d, 0xcea768f2, 0x761b1211,
+  0xce4ab5a2, 0x75f42c0b, 0xcdee20fc, 0x75ccfd42, 0xcd91ab39, 0x75a585cf,
+  0xcd355491, 0x757dc5ca, 0xccd91d3d, 0x7555bd4c, 0xcc7d0578, 0x752d6c6c,
+  0xcc210d79, 0x7504d345, 0xcbc53579, 0x74dbf1ef, 0xcb697db0, 0x74b2c884,
+  0xcb0de658, 0x7489571c, 0xcab26fa9, 0x745f9dd1, 0xca5719db, 0x74359cbd,
+  0xc9fbe527, 0x740b53fb, 0xc9a0d1c5, 0x73e0c3a3, 0xc945dfec, 0x73b5ebd1,
+  0xc8eb0fd6, 0x738acc9e, 0xc89061ba, 0x735f6626, 0xc835d5d0, 0x7333b883,
+  0xc7db6c50, 0x7307c3d0, 0xc7812572, 0x72db8828, 0xc727016d, 0x72af05a7,
+  0xc6cd0079, 0x72823c67, 0xc67322ce, 0x72552c85, 0xc61968a2, 0x7227d61c,
+  0xc5bfd22e, 0x71fa3949, 0xc5665fa9, 0x71cc5626, 0xc50d1149, 0x719e2cd2,
+  0xc4b3e746, 0x716fbd68, 0xc45ae1d7, 0x71410805, 0xc4020133, 0x71120cc5,
+  0xc3a94590, 0x70e2cbc6, 0xc350af26, 0x70b34525, 0xc2f83e2a, 0x708378ff,
+  0xc29ff2d4, 0x70536771, 0xc247cd5a, 0x7023109a, 0xc1efcdf3, 0x6ff27497,
+  0xc197f4d4, 0x6fc19385, 0xc1404233, 0x6f906d84, 0xc0e8b648, 0x6f5f02b2,
+  0xc0915148, 0x6f2d532c, 0xc03a1368, 0x6efb5f12, 0xbfe2fcdf, 0x6ec92683,
+  0xbf8c0de3, 0x6e96a99d, 0xbf3546a8, 0x6e63e87f, 0xbedea765, 0x6e30e34a,
+  0xbe88304f, 0x6dfd9a1c, 0xbe31e19b, 0x6dca0d14, 0xbddbbb7f, 0x6d963c54,
+  0xbd85be30, 0x6d6227fa, 0xbd2fe9e2, 0x6d2dd027, 0xbcda3ecb, 0x6cf934fc,
+  0xbc84bd1f, 0x6cc45698, 0xbc2f6513, 0x6c8f351c, 0xbbda36dd, 0x6c59d0a9,
+  0xbb8532b0, 0x6c242960, 0xbb3058c0, 0x6bee3f62, 0xbadba943, 0x6bb812d1,
+  0xba87246d, 0x6b81a3cd, 0xba32ca71, 0x6b4af279, 0xb9de9b83, 0x6b13fef5,
+  0xb98a97d8, 0x6adcc964, 0xb936bfa4, 0x6aa551e9, 0xb8e31319, 0x6a6d98a4,
+  0xb88f926d, 0x6a359db9, 0xb83c3dd1, 0x69fd614a, 0xb7e9157a, 0x69c4e37a,
+  0xb796199b, 0x698c246c, 0xb7434a67, 0x69532442, 0xb6f0a812, 0x6919e320,
+  0xb69e32cd, 0x68e06129, 0xb64beacd, 0x68a69e81, 0xb5f9d043, 0x686c9b4b,
+  0xb5a7e362, 0x683257ab, 0xb556245e, 0x67f7d3c5, 0xb5049368, 0x67bd0fbd,
+  0xb4b330b3, 0x67820bb7, 0xb461fc70, 0x6746c7d8, 0xb410f6d3, 0x670b4444,
+  0xb3c0200c, 0x66cf8120, 0xb36f784f, 0x66937e91, 0xb31effcc, 0x66573cbb,
+  0xb2ceb6b5, 0x661abbc5, 0xb27e9d3c, 0x65ddfbd3, 0xb22eb392, 0x65a0fd0b,
+  0xb1def9e9, 0x6563bf92, 0xb18f7071, 0x6526438f, 0xb140175b, 0x64e88926,
+  0xb0f0eeda, 0x64aa907f, 0xb0a1f71d, 0x646c59bf, 0xb0533055, 0x642de50d,
+  0xb0049ab3, 0x63ef3290, 0xafb63667, 0x63b0426d, 0xaf6803a2, 0x637114cc,
+  0xaf1a0293, 0x6331a9d4, 0xaecc336c, 0x62f201ac, 0xae7e965b, 0x62b21c7b,
+  0xae312b92, 0x6271fa69, 0xade3f33e, 0x62319b9d, 0xad96ed92, 0x61f1003f,
+  0xad4a1aba, 0x61b02876, 0xacfd7ae8, 0x616f146c, 0xacb10e4b, 0x612dc447,
+  0xac64d510, 0x60ec3830, 0xac18cf69, 0x60aa7050, 0xabccfd83, 0x60686ccf,
+  0xab815f8d, 0x60262dd6, 0xab35f5b5, 0x5fe3b38d, 0xaaeac02c, 0x5fa0fe1f,
+  0xaa9fbf1e, 0x5f5e0db3, 0xaa54f2ba, 0x5f1ae274, 0xaa0a5b2e, 0x5ed77c8a,
+  0xa9bff8a8, 0x5e93dc1f, 0xa975cb57, 0x5e50015d, 0xa92bd367, 0x5e0bec6e,
+  0xa8e21106, 0x5dc79d7c, 0xa8988463, 0x5d8314b1, 0xa84f2daa, 0x5d3e5237,
+  0xa8060d08, 0x5cf95638, 0xa7bd22ac, 0x5cb420e0, 0xa7746ec0, 0x5c6eb258,
+  0xa72bf174, 0x5c290acc, 0xa6e3aaf2, 0x5be32a67, 0xa69b9b68, 0x5b9d1154,
+  0xa653c303, 0x5b56bfbd, 0xa60c21ee, 0x5b1035cf, 0xa5c4b855, 0x5ac973b5,
+  0xa57d8666, 0x5a82799a, 0xa5368c4b, 0x5a3b47ab, 0xa4efca31, 0x59f3de12,
+  0xa4a94043, 0x59ac3cfd, 0xa462eeac, 0x59646498, 0xa41cd599, 0x591c550e,
+  0xa3d6f534, 0x58d40e8c, 0xa3914da8, 0x588b9140, 0xa34bdf20, 0x5842dd54,
+  0xa306a9c8, 0x57f9f2f8, 0xa2c1adc9, 0x57b0d256, 0xa27ceb4f, 0x57677b9d,
+  0xa2386284, 0x571deefa, 0xa1f41392, 0x56d42c99, 0xa1affea3, 0x568a34a9,
+  0xa16c23e1, 0x56400758, 0xa1288376, 0x55f5a4d2, 0xa0e51d8c, 0x55ab0d46,
+  0xa0a1f24d, 0x556040e2, 0xa05f01e1, 0x55153fd4, 0xa01c4c73, 0x54ca0a4b,
+  0x9fd9d22a, 0x547ea073, 0x9f979331, 0x5433027d, 0x9f558fb0, 0x53e73097,
+  0x9f13c7d0, 0x539b2af0, 0x9ed23bb9, 0x534ef1b5, 0x9e90eb94, 0x53028518,
+  0x9e4fd78a, 0x52b5e546, 0x9e0effc1, 0x5269126e, 0x9dce6463, 0x521c0cc2,
+  0x9d8e0597, 0x51ced46e, 0x9d4de385, 0x518169a5, 0x9d0dfe54, 0x5133cc94,
+  0x9cce562c, 0x50e5fd6d, 0x9c8eeb34, 0x5097fc5e, 0x9c4fbd93, 0x5049c999,
+  0x9c10cd70, 0x4ffb654d, 0x9bd21af3, 0x4faccfab, 0x9b93a641, 0x4f5e08e3,
+  0x9b556f81, 0x4f0f1126, 0x9b1776da, 0x4ebfe8a5, 0x9ad9bc71, 0x4e708f8f,
+  0x9a9c406e, 0x4e210617, 0x9a5f02f5, 0x4dd14c6e, 0x9a22042d, 0x4d8162c4,
+  0x99e5443b, 0x4d31494b, 0x99a8c345, 0x4ce10034, 0x996c816f, 0x4c9087b1,
+  0x99307ee0, 0x4c3fdff4, 0x98f4bbbc, 0x4bef092d, 0x98b93828, 0x4b9e0390,
+  0x987df449, 0x4b4ccf4d, 0x9842f043, 0x4afb6c98, 0x98082c3b, 0x4aa9dba2,
+  0x97cda855, 0x4a581c9e, 0x979364b5, 0x4a062fbd, 0x9759617f, 0x49b41533,
+  0x971f9ed7, 0x4961cd33, 0x96e61ce0, 0x490f57ee, 0x96acdbbe, 0x48bcb599,
+  0x9673db94, 0x4869e665, 0x963b1c86, 0x4816ea86, 0x96029eb6, 0x47c3c22f,
+  0x95ca6247, 0x47706d93, 0x9592675c, 0x471cece7, 0x955aae17, 0x46c9405c,
+  0x9523369c, 0x46756828, 0x94ec010b, 0x4621647d, 0x94b50d87, 0x45cd358f,
+  0x947e5c33, 0x4578db93, 0x9447ed2f, 0x452456bd, 0x9411c09e, 0x44cfa740,
+  0x93dbd6a0, 0x447acd50, 0x93a62f57, 0x4425c923, 0x9370cae4, 0x43d09aed,
+  0x933ba968, 0x437b42e1, 0x9306cb04, 0x4325c135, 0x92d22fd9, 0x42d0161e,
+  0x929dd806, 0x427a41d0, 0x9269c3ac, 0x42244481, 0x9235f2ec, 0x41ce1e65,
+  0x920265e4, 0x4177cfb1, 0x91cf1cb6, 0x4121589b, 0x919c1781, 0x40cab958,
+  0x91695663, 0x4073f21d, 0x9136d97d, 0x401d0321, 0x9104a0ee, 0x3fc5ec98,
+  0x90d2acd4, 0x3f6eaeb8, 0x90a0fd4e, 0x3f1749b8, 0x906f927c, 0x3ebfbdcd,
+  0x903e6c7b, 0x3e680b2c, 0x900d8b69, 0x3e10320d, 0x8fdcef66, 0x3db832a6,
+  0x8fac988f, 0x3d600d2c, 0x8f7c8701, 0x3d07c1d6, 0x8f4cbadb, 0x3caf50da,
+  0x8f1d343a, 0x3c56ba70, 0x8eedf33b, 0x3bfdfecd, 0x8ebef7fb, 0x3ba51e29,
+  0x8e904298, 0x3b4c18ba, 0x8e61d32e, 0x3af2eeb7, 0x8e33a9da, 0x3a99a057,
+  0x8e05c6b7, 0x3a402dd2, 0x8dd829e4, 0x39e6975e, 0x8daad37b, 0x398cdd32,
+  0x8d7dc399, 0x3932ff87, 0x8d50fa59, 0x38d8fe93, 0x8d2477d8, 0x387eda8e,
+  0x8cf83c30, 0x382493b0, 0x8ccc477d, 0x37ca2a30, 0x8ca099da, 0x376f9e46,
+  0x8c753362, 0x3714f02a, 0x8c4a142f, 0x36ba2014, 0x8c1f3c5d, 0x365f2e3b,
+  0x8bf4ac05, 0x36041ad9, 0x8bca6343, 0x35a8e625, 0x8ba0622f, 0x354d9057,
+  0x8b76a8e4, 0x34f219a8, 0x8b4d377c, 0x34968250, 0x8b240e11, 0x343aca87,
+  0x8afb2cbb, 0x33def287, 0x8ad29394, 0x3382fa88, 0x8aaa42b4, 0x3326e2c3,
+  0x8a823a36, 0x32caab6f, 0x8a5a7a31, 0x326e54c7, 0x8a3302be, 0x3211df04,
+  0x8a0bd3f5, 0x31b54a5e, 0x89e4edef, 0x3158970e, 0x89be50c3, 0x30fbc54d,
+  0x8997fc8a, 0x309ed556, 0x8971f15a, 0x3041c761, 0x894c2f4c, 0x2fe49ba7,
+  0x8926b677, 0x2f875262, 0x890186f2, 0x2f29ebcc, 0x88dca0d3, 0x2ecc681e,
+  0x88b80432, 0x2e6ec792, 0x8893b125, 0x2e110a62, 0x886fa7c2, 0x2db330c7,
+  0x884be821, 0x2d553afc, 0x88287256, 0x2cf72939, 0x88054677, 0x2c98fbba,
+  0x87e2649b, 0x2c3ab2b9, 0x87bfccd7, 0x2bdc4e6f, 0x879d7f41, 0x2b7dcf17,
+  0x877b7bec, 0x2b1f34eb, 0x8759c2ef, 0x2ac08026, 0x8738545e, 0x2a61b101,
+  0x8717304e, 0x2a02c7b8, 0x86f656d3, 0x29a3c485, 0x86d5c802, 0x2944a7a2,
+  0x86b583ee, 0x28e5714b, 0x86958aac, 0x288621b9, 0x8675dc4f, 0x2826b928,
+  0x865678eb, 0x27c737d3, 0x86376092, 0x27679df4, 0x86189359, 0x2707ebc7,
+  0x85fa1153, 0x26a82186, 0x85dbda91, 0x26483f6c, 0x85bdef28, 0x25e845b6,
+  0x85a04f28, 0x2588349d, 0x8582faa5, 0x25280c5e, 0x8565f1b0, 0x24c7cd33,
+  0x8549345c, 0x24677758, 0x852cc2bb, 0x24070b08, 0x85109cdd, 0x23a6887f,
+  0x84f4c2d4, 0x2345eff8, 0x84d934b1, 0x22e541af, 0x84bdf286, 0x22847de0,
+  0x84a2fc62, 0x2223a4c5, 0x84885258, 0x21c2b69c, 0x846df477, 0x2161b3a0,
+  0x8453e2cf, 0x21009c0c, 0x843a1d70, 0x209f701c, 0x8420a46c, 0x203e300d,
+  0x840777d0, 0x1fdcdc1b, 0x83ee97ad, 0x1f7b7481, 0x83d60412, 0x1f19f97b,
+  0x83bdbd0e, 0x1eb86b46, 0x83a5c2b0, 0x1e56ca1e, 0x838e1507, 0x1df5163f,
+  0x8376b422, 0x1d934fe5, 0x835fa00f, 0x1d31774d, 0x8348d8dc, 0x1ccf8cb3,
+  0x83325e97, 0x1c6d9053, 0x831c314e, 0x1c0b826a, 0x83065110, 0x1ba96335,
+  0x82f0bde8, 0x1b4732ef, 0x82db77e5, 0x1ae4f1d6, 0x82c67f14, 0x1a82a026,
+  0x82b1d381, 0x1a203e1b, 0x829d753a, 0x19bdcbf3, 0x8289644b, 0x195b49ea,
+  0x8275a0c0, 0x18f8b83c, 0x82622aa6, 0x18961728, 0x824f0208, 0x183366e9,
+  0x823c26f3, 0x17d0a7bc, 0x82299971, 0x176dd9de, 0x82175990, 0x170afd8d,
+  0x82056758, 0x16a81305, 0x81f3c2d7, 0x16451a83, 0x81e26c16, 0x15e21445,
+  0x81d16321, 0x157f0086, 0x81c0a801, 0x151bdf86, 0x81b03ac2, 0x14b8b17f,
+  0x81a01b6d, 0x145576b1, 0x81904a0c, 0x13f22f58, 0x8180c6a9, 0x138edbb1,
+  0x8171914e, 0x132b7bf9, 0x8162aa04, 0x12c8106f, 0x815410d4, 0x1264994e,
+  0x8145c5c7, 0x120116d5, 0x8137c8e6, 0x119d8941, 0x812a1a3a, 0x1139f0cf,
+  0x811cb9ca, 0x10d64dbd, 0x810fa7a0, 0x1072a048, 0x8102e3c4, 0x100ee8ad,
+  0x80f66e3c, 0xfab272b, 0x80ea4712, 0xf475bff, 0x80de6e4c, 0xee38766,
+  0x80d2e3f2, 0xe7fa99e, 0x80c7a80a, 0xe1bc2e4, 0x80bcba9d, 0xdb7d376,
+  0x80b21baf, 0xd53db92, 0x80a7cb49, 0xcefdb76, 0x809dc971, 0xc8bd35e,
+  0x8094162c, 0xc27c389, 0x808ab180, 0xbc3ac35, 0x80819b74, 0xb5f8d9f,
+  0x8078d40d, 0xafb6805, 0x80705b50, 0xa973ba5, 0x80683143, 0xa3308bd,
+  0x806055eb, 0x9cecf89, 0x8058c94c, 0x96a9049, 0x80518b6b, 0x9064b3a,
+  0x804a9c4d, 0x8a2009a, 0x8043fbf6, 0x83db0a7, 0x803daa6a, 0x7d95b9e,
+  0x8037a7ac, 0x77501be, 0x8031f3c2, 0x710a345, 0x802c8ead, 0x6ac406f,
+  0x80277872, 0x647d97c, 0x8022b114, 0x5e36ea9, 0x801e3895, 0x57f0035,
+  0x801a0ef8, 0x51a8e5c, 0x80163440, 0x4b6195d, 0x8012a86f, 0x451a177,
+  0x800f6b88, 0x3ed26e6, 0x800c7d8c, 0x388a9ea, 0x8009de7e, 0x3242abf,
+  0x80078e5e, 0x2bfa9a4, 0x80058d2f, 0x25b26d7, 0x8003daf1, 0x1f6a297,
+  0x800277a6, 0x1921d20, 0x8001634e, 0x12d96b1, 0x80009dea, 0xc90f88,
+  0x8000277a, 0x6487e3, 0x80000000, 0x0, 0x8000277a, 0xff9b781d,
+  0x80009dea, 0xff36f078, 0x8001634e, 0xfed2694f, 0x800277a6, 0xfe6de2e0,
+  0x8003daf1, 0xfe095d69, 0x80058d2f, 0xfda4d929, 0x80078e5e, 0xfd40565c,
+  0x8009de7e, 0xfcdbd541, 0x800c7d8c, 0xfc775616, 0x800f6b88, 0xfc12d91a,
+  0x8012a86f, 0xfbae5e89, 0x80163440, 0xfb49e6a3, 0x801a0ef8, 0xfae571a4,
+  0x801e3895, 0xfa80ffcb, 0x8022b114, 0xfa1c9157, 0x80277872, 0xf9b82684,
+  0x802c8ead, 0xf953bf91, 0x8031f3c2, 0xf8ef5cbb, 0x8037a7ac, 0xf88afe42,
+  0x803daa6a, 0xf826a462, 0x8043fbf6, 0xf7c24f59, 0x804a9c4d, 0xf75dff66,
+  0x80518b6b, 0xf6f9b4c6, 0x8058c94c, 0xf6956fb7, 0x806055eb, 0xf6313077,
+  0x80683143, 0xf5ccf743, 0x80705b50, 0xf568c45b, 0x8078d40d, 0xf50497fb,
+  0x80819b74, 0xf4a07261, 0x808ab180, 0xf43c53cb, 0x8094162c, 0xf3d83c77,
+  0x809dc971, 0xf3742ca2, 0x80a7cb49, 0xf310248a, 0x80b21baf, 0xf2ac246e,
+  0x80bcba9d, 0xf2482c8a, 0x80c7a80a, 0xf1e43d1c, 0x80d2e3f2, 0xf1805662,
+  0x80de6e4c, 0xf11c789a, 0x80ea4712, 0xf0b8a401, 0x80f66e3c, 0xf054d8d5,
+  0x8102e3c4, 0xeff11753, 0x810fa7a0, 0xef8d5fb8, 0x811cb9ca, 0xef29b243,
+  0x812a1a3a, 0xeec60f31, 0x8137c8e6, 0xee6276bf, 0x8145c5c7, 0xedfee92b,
+  0x815410d4, 0xed9b66b2, 0x8162aa04, 0xed37ef91, 0x8171914e, 0xecd48407,
+  0x8180c6a9, 0xec71244f, 0x81904a0c, 0xec0dd0a8, 0x81a01b6d, 0xebaa894f,
+  0x81b03ac2, 0xeb474e81, 0x81c0a801, 0xeae4207a, 0x81d16321, 0xea80ff7a,
+  0x81e26c16, 0xea1debbb, 0x81f3c2d7, 0xe9bae57d, 0x82056758, 0xe957ecfb,
+  0x82175990, 0xe8f50273, 0x82299971, 0xe8922622, 0x823c26f3, 0xe82f5844,
+  0x824f0208, 0xe7cc9917, 0x82622aa6, 0xe769e8d8, 0x8275a0c0, 0xe70747c4,
+  0x8289644b, 0xe6a4b616, 0x829d753a, 0xe642340d, 0x82b1d381, 0xe5dfc1e5,
+  0x82c67f14, 0xe57d5fda, 0x82db77e5, 0xe51b0e2a, 0x82f0bde8, 0xe4b8cd11,
+  0x83065110, 0xe4569ccb, 0x831c314e, 0xe3f47d96, 0x83325e97, 0xe3926fad,
+  0x8348d8dc, 0xe330734d, 0x835fa00f, 0xe2ce88b3, 0x8376b422, 0xe26cb01b,
+  0x838e1507, 0xe20ae9c1, 0x83a5c2b0, 0xe1a935e2, 0x83bdbd0e, 0xe14794ba,
+  0x83d60412, 0xe0e60685, 0x83ee97ad, 0xe0848b7f, 0x840777d0, 0xe02323e5,
+  0x8420a46c, 0xdfc1cff3, 0x843a1d70, 0xdf608fe4, 0x8453e2cf, 0xdeff63f4,
+  0x846df477, 0xde9e4c60, 0x84885258, 0xde3d4964, 0x84a2fc62, 0xdddc5b3b,
+  0x84bdf286, 0xdd7b8220, 0x84d934b1, 0xdd1abe51, 0x84f4c2d4, 0xdcba1008,
+  0x85109cdd, 0xdc597781, 0x852cc2bb, 0xdbf8f4f8, 0x8549345c, 0xdb9888a8,
+  0x8565f1b0, 0xdb3832cd, 0x8582faa5, 0xdad7f3a2, 0x85a04f28, 0xda77cb63,
+  0x85bdef28, 0xda17ba4a, 0x85dbda91, 0xd9b7c094, 0x85fa1153, 0xd957de7a,
+  0x86189359, 0xd8f81439, 0x86376092, 0xd898620c, 0x865678eb, 0xd838c82d,
+  0x8675dc4f, 0xd7d946d8, 0x86958aac, 0xd779de47, 0x86b583ee, 0xd71a8eb5,
+  0x86d5c802, 0xd6bb585e, 0x86f656d3, 0xd65c3b7b, 0x8717304e, 0xd5fd3848,
+  0x8738545e, 0xd59e4eff, 0x8759c2ef, 0xd53f7fda, 0x877b7bec, 0xd4e0cb15,
+  0x879d7f41, 0xd48230e9, 0x87bfccd7, 0xd423b191, 0x87e2649b, 0xd3c54d47,
+  0x88054677, 0xd3670446, 0x88287256, 0xd308d6c7, 0x884be821, 0xd2aac504,
+  0x886fa7c2, 0xd24ccf39, 0x8893b125, 0xd1eef59e, 0x88b80432, 0xd191386e,
+  0x88dca0d3, 0xd13397e2, 0x890186f2, 0xd0d61434, 0x8926b677, 0xd078ad9e,
+  0x894c2f4c, 0xd01b6459, 0x8971f15a, 0xcfbe389f, 0x8997fc8a, 0xcf612aaa,
+  0x89be50c3, 0xcf043ab3, 0x89e4edef, 0xcea768f2, 0x8a0bd3f5, 0xce4ab5a2,
+  0x8a3302be, 0xcdee20fc, 0x8a5a7a31, 0xcd91ab39, 0x8a823a36, 0xcd355491,
+  0x8aaa42b4, 0xccd91d3d, 0x8ad29394, 0xcc7d0578, 0x8afb2cbb, 0xcc210d79,
+  0x8b240e11, 0xcbc53579, 0x8b4d377c, 0xcb697db0, 0x8b76a8e4, 0xcb0de658,
+  0x8ba0622f, 0xcab26fa9, 0x8bca6343, 0xca5719db, 0x8bf4ac05, 0xc9fbe527,
+  0x8c1f3c5d, 0xc9a0d1c5, 0x8c4a142f, 0xc945dfec, 0x8c753362, 0xc8eb0fd6,
+  0x8ca099da, 0xc89061ba, 0x8ccc477d, 0xc835d5d0, 0x8cf83c30, 0xc7db6c50,
+  0x8d2477d8, 0xc7812572, 0x8d50fa59, 0xc727016d, 0x8d7dc399, 0xc6cd0079,
+  0x8daad37b, 0xc67322ce, 0x8dd829e4, 0xc61968a2, 0x8e05c6b7, 0xc5bfd22e,
+  0x8e33a9da, 0xc5665fa9, 0x8e61d32e, 0xc50d1149, 0x8e904298, 0xc4b3e746,
+  0x8ebef7fb, 0xc45ae1d7, 0x8eedf33b, 0xc4020133, 0x8f1d343a, 0xc3a94590,
+  0x8f4cbadb, 0xc350af26, 0x8f7c8701, 0xc2f83e2a, 0x8fac988f, 0xc29ff2d4,
+  0x8fdcef66, 0xc247cd5a, 0x900d8b69, 0xc1efcdf3, 0x903e6c7b, 0xc197f4d4,
+  0x906f927c, 0xc1404233, 0x90a0fd4e, 0xc0e8b648, 0x90d2acd4, 0xc0915148,
+  0x9104a0ee, 0xc03a1368, 0x9136d97d, 0xbfe2fcdf, 0x91695663, 0xbf8c0de3,
+  0x919c1781, 0xbf3546a8, 0x91cf1cb6, 0xbedea765, 0x920265e4, 0xbe88304f,
+  0x9235f2ec, 0xbe31e19b, 0x9269c3ac, 0xbddbbb7f, 0x929dd806, 0xbd85be30,
+  0x92d22fd9, 0xbd2fe9e2, 0x9306cb04, 0xbcda3ecb, 0x933ba968, 0xbc84bd1f,
+  0x9370cae4, 0xbc2f6513, 0x93a62f57, 0xbbda36dd, 0x93dbd6a0, 0xbb8532b0,
+  0x9411c09e, 0xbb3058c0, 0x9447ed2f, 0xbadba943, 0x947e5c33, 0xba87246d,
+  0x94b50d87, 0xba32ca71, 0x94ec010b, 0xb9de9b83, 0x9523369c, 0xb98a97d8,
+  0x955aae17, 0xb936bfa4, 0x9592675c, 0xb8e31319, 0x95ca6247, 0xb88f926d,
+  0x96029eb6, 0xb83c3dd1, 0x963b1c86, 0xb7e9157a, 0x9673db94, 0xb796199b,
+  0x96acdbbe, 0xb7434a67, 0x96e61ce0, 0xb6f0a812, 0x971f9ed7, 0xb69e32cd,
+  0x9759617f, 0xb64beacd, 0x979364b5, 0xb5f9d043, 0x97cda855, 0xb5a7e362,
+  0x98082c3b, 0xb556245e, 0x9842f043, 0xb5049368, 0x987df449, 0xb4b330b3,
+  0x98b93828, 0xb461fc70, 0x98f4bbbc, 0xb410f6d3, 0x99307ee0, 0xb3c0200c,
+  0x996c816f, 0xb36f784f, 0x99a8c345, 0xb31effcc, 0x99e5443b, 0xb2ceb6b5,
+  0x9a22042d, 0xb27e9d3c, 0x9a5f02f5, 0xb22eb392, 0x9a9c406e, 0xb1def9e9,
+  0x9ad9bc71, 0xb18f7071, 0x9b1776da, 0xb140175b, 0x9b556f81, 0xb0f0eeda,
+  0x9b93a641, 0xb0a1f71d, 0x9bd21af3, 0xb0533055, 0x9c10cd70, 0xb0049ab3,
+  0x9c4fbd93, 0xafb63667, 0x9c8eeb34, 0xaf6803a2, 0x9cce562c, 0xaf1a0293,
+  0x9d0dfe54, 0xaecc336c, 0x9d4de385, 0xae7e965b, 0x9d8e0597, 0xae312b92,
+  0x9dce6463, 0xade3f33e, 0x9e0effc1, 0xad96ed92, 0x9e4fd78a, 0xad4a1aba,
+  0x9e90eb94, 0xacfd7ae8, 0x9ed23bb9, 0xacb10e4b, 0x9f13c7d0, 0xac64d510,
+  0x9f558fb0, 0xac18cf69, 0x9f979331, 0xabccfd83, 0x9fd9d22a, 0xab815f8d,
+  0xa01c4c73, 0xab35f5b5, 0xa05f01e1, 0xaaeac02c, 0xa0a1f24d, 0xaa9fbf1e,
+  0xa0e51d8c, 0xaa54f2ba, 0xa1288376, 0xaa0a5b2e, 0xa16c23e1, 0xa9bff8a8,
+  0xa1affea3, 0xa975cb57, 0xa1f41392, 0xa92bd367, 0xa2386284, 0xa8e21106,
+  0xa27ceb4f, 0xa8988463, 0xa2c1adc9, 0xa84f2daa, 0xa306a9c8, 0xa8060d08,
+  0xa34bdf20, 0xa7bd22ac, 0xa3914da8, 0xa7746ec0, 0xa3d6f534, 0xa72bf174,
+  0xa41cd599, 0xa6e3aaf2, 0xa462eeac, 0xa69b9b68, 0xa4a94043, 0xa653c303,
+  0xa4efca31, 0xa60c21ee, 0xa5368c4b, 0xa5c4b855, 0xa57d8666, 0xa57d8666,
+  0xa5c4b855, 0xa5368c4b, 0xa60c21ee, 0xa4efca31, 0xa653c303, 0xa4a94043,
+  0xa69b9b68, 0xa462eeac, 0xa6e3aaf2, 0xa41cd599, 0xa72bf174, 0xa3d6f534,
+  0xa7746ec0, 0xa3914da8, 0xa7bd22ac, 0xa34bdf20, 0xa8060d08, 0xa306a9c8,
+  0xa84f2daa, 0xa2c1adc9, 0xa8988463, 0xa27ceb4f, 0xa8e21106, 0xa2386284,
+  0xa92bd367, 0xa1f41392, 0xa975cb57, 0xa1affea3, 0xa9bff8a8, 0xa16c23e1,
+  0xaa0a5b2e, 0xa1288376, 0xaa54f2ba, 0xa0e51d8c, 0xaa9fbf1e, 0xa0a1f24d,
+  0xaaeac02c, 0xa05f01e1, 0xab35f5b5, 0xa01c4c73, 0xab815f8d, 0x9fd9d22a,
+  0xabccfd83, 0x9f979331, 0xac18cf69, 0x9f558fb0, 0xac64d510, 0x9f13c7d0,
+  0xacb10e4b, 0x9ed23bb9, 0xacfd7ae8, 0x9e90eb94, 0xad4a1aba, 0x9e4fd78a,
+  0xad96ed92, 0x9e0effc1, 0xade3f33e, 0x9dce6463, 0xae312b92, 0x9d8e0597,
+  0xae7e965b, 0x9d4de385, 0xaecc336c, 0x9d0dfe54, 0xaf1a0293, 0x9cce562c,
+  0xaf6803a2, 0x9c8eeb34, 0xafb63667, 0x9c4fbd93, 0xb0049ab3, 0x9c10cd70,
+  0xb0533055, 0x9bd21af3, 0xb0a1f71d, 0x9b93a641, 0xb0f0eeda, 0x9b556f81,
+  0xb140175b, 0x9b1776da, 0xb18f7071, 0x9ad9bc71, 0xb1def9e9, 0x9a9c406e,
+  0xb22eb392, 0x9a5f02f5, 0xb27e9d3c, 0x9a22042d, 0xb2ceb6b5, 0x99e5443b,
+  0xb31effcc, 0x99a8c345, 0xb36f784f, 0x996c816f, 0xb3c0200c, 0x99307ee0,
+  0xb410f6d3, 0x98f4bbbc, 0xb461fc70, 0x98b93828, 0xb4b330b3, 0x987df449,
+  0xb5049368, 0x9842f043, 0xb556245e, 0x98082c3b, 0xb5a7e362, 0x97cda855,
+  0xb5f9d043, 0x979364b5, 0xb64beacd, 0x9759617f, 0xb69e32cd, 0x971f9ed7,
+  0xb6f0a812, 0x96e61ce0, 0xb7434a67, 0x96acdbbe, 0xb796199b, 0x9673db94,
+  0xb7e9157a, 0x963b1c86, 0xb83c3dd1, 0x96029eb6, 0xb88f926d, 0x95ca6247,
+  0xb8e31319, 0x9592675c, 0xb936bfa4, 0x955aae17, 0xb98a97d8, 0x9523369c,
+  0xb9de9b83, 0x94ec010b, 0xba32ca71, 0x94b50d87, 0xba87246d, 0x947e5c33,
+  0xbadba943, 0x9447ed2f, 0xbb3058c0, 0x9411c09e, 0xbb8532b0, 0x93dbd6a0,
+  0xbbda36dd, 0x93a62f57, 0xbc2f6513, 0x9370cae4, 0xbc84bd1f, 0x933ba968,
+  0xbcda3ecb, 0x9306cb04, 0xbd2fe9e2, 0x92d22fd9, 0xbd85be30, 0x929dd806,
+  0xbddbbb7f, 0x9269c3ac, 0xbe31e19b, 0x9235f2ec, 0xbe88304f, 0x920265e4,
+  0xbedea765, 0x91cf1cb6, 0xbf3546a8, 0x919c1781, 0xbf8c0de3, 0x91695663,
+  0xbfe2fcdf, 0x9136d97d, 0xc03a1368, 0x9104a0ee, 0xc0915148, 0x90d2acd4,
+  0xc0e8b648, 0x90a0fd4e, 0xc1404233, 0x906f927c, 0xc197f4d4, 0x903e6c7b,
+  0xc1efcdf3, 0x900d8b69, 0xc247cd5a, 0x8fdcef66, 0xc29ff2d4, 0x8fac988f,
+  0xc2f83e2a, 0x8f7c8701, 0xc350af26, 0x8f4cbadb, 0xc3a94590, 0x8f1d343a,
+  0xc4020133, 0x8eedf33b, 0xc45ae1d7, 0x8ebef7fb, 0xc4b3e746, 0x8e904298,
+  0xc50d1149, 0x8e61d32e, 0xc5665fa9, 0x8e33a9da, 0xc5bfd22e, 0x8e05c6b7,
+  0xc61968a2, 0x8dd829e4, 0xc67322ce, 0x8daad37b, 0xc6cd0079, 0x8d7dc399,
+  0xc727016d, 0x8d50fa59, 0xc7812572, 0x8d2477d8, 0xc7db6c50, 0x8cf83c30,
+  0xc835d5d0, 0x8ccc477d, 0xc89061ba, 0x8ca099da, 0xc8eb0fd6, 0x8c753362,
+  0xc945dfec, 0x8c4a142f, 0xc9a0d1c5, 0x8c1f3c5d, 0xc9fbe527, 0x8bf4ac05,
+  0xca5719db, 0x8bca6343, 0xcab26fa9, 0x8ba0622f, 0xcb0de658, 0x8b76a8e4,
+  0xcb697db0, 0x8b4d377c, 0xcbc53579, 0x8b240e11, 0xcc210d79, 0x8afb2cbb,
+  0xcc7d0578, 0x8ad29394, 0xccd91d3d, 0x8aaa42b4, 0xcd355491, 0x8a823a36,
+  0xcd91ab39, 0x8a5a7a31, 0xcdee20fc, 0x8a3302be, 0xce4ab5a2, 0x8a0bd3f5,
+  0xcea768f2, 0x89e4edef, 0xcf043ab3, 0x89be50c3, 0xcf612aaa, 0x8997fc8a,
+  0xcfbe389f, 0x8971f15a, 0xd01b6459, 0x894c2f4c, 0xd078ad9e, 0x8926b677,
+  0xd0d61434, 0x890186f2, 0xd13397e2, 0x88dca0d3, 0xd191386e, 0x88b80432,
+  0xd1eef59e, 0x8893b125, 0xd24ccf39, 0x886fa7c2, 0xd2aac504, 0x884be821,
+  0xd308d6c7, 0x88287256, 0xd3670446, 0x88054677, 0xd3c54d47, 0x87e2649b,
+  0xd423b191, 0x87bfccd7, 0xd48230e9, 0x879d7f41, 0xd4e0cb15, 0x877b7bec,
+  0xd53f7fda, 0x8759c2ef, 0xd59e4eff, 0x8738545e, 0xd5fd3848, 0x8717304e,
+  0xd65c3b7b, 0x86f656d3, 0xd6bb585e, 0x86d5c802, 0xd71a8eb5, 0x86b583ee,
+  0xd779de47, 0x86958aac, 0xd7d946d8, 0x8675dc4f, 0xd838c82d, 0x865678eb,
+  0xd898620c, 0x86376092, 0xd8f81439, 0x86189359, 0xd957de7a, 0x85fa1153,
+  0xd9b7c094, 0x85dbda91, 0xda17ba4a, 0x85bdef28, 0xda77cb63, 0x85a04f28,
+  0xdad7f3a2, 0x8582faa5, 0xdb3832cd, 0x8565f1b0, 0xdb9888a8, 0x8549345c,
+  0xdbf8f4f8, 0x852cc2bb, 0xdc597781, 0x85109cdd, 0xdcba1008, 0x84f4c2d4,
+  0xdd1abe51, 0x84d934b1, 0xdd7b8220, 0x84bdf286, 0xdddc5b3b, 0x84a2fc62,
+  0xde3d4964, 0x84885258, 0xde9e4c60, 0x846df477, 0xdeff63f4, 0x8453e2cf,
+  0xdf608fe4, 0x843a1d70, 0xdfc1cff3, 0x8420a46c, 0xe02323e5, 0x840777d0,
+  0xe0848b7f, 0x83ee97ad, 0xe0e60685, 0x83d60412, 0xe14794ba, 0x83bdbd0e,
+  0xe1a935e2, 0x83a5c2b0, 0xe20ae9c1, 0x838e1507, 0xe26cb01b, 0x8376b422,
+  0xe2ce88b3, 0x835fa00f, 0xe330734d, 0x8348d8dc, 0xe3926fad, 0x83325e97,
+  0xe3f47d96, 0x831c314e, 0xe4569ccb, 0x83065110, 0xe4b8cd11, 0x82f0bde8,
+  0xe51b0e2a, 0x82db77e5, 0xe57d5fda, 0x82c67f14, 0xe5dfc1e5, 0x82b1d381,
+  0xe642340d, 0x829d753a, 0xe6a4b616, 0x8289644b, 0xe70747c4, 0x8275a0c0,
+  0xe769e8d8, 0x82622aa6, 0xe7cc9917, 0x824f0208, 0xe82f5844, 0x823c26f3,
+  0xe8922622, 0x82299971, 0xe8f50273, 0x82175990, 0xe957ecfb, 0x82056758,
+  0xe9bae57d, 0x81f3c2d7, 0xea1debbb, 0x81e26c16, 0xea80ff7a, 0x81d16321,
+  0xeae4207a, 0x81c0a801, 0xeb474e81, 0x81b03ac2, 0xebaa894f, 0x81a01b6d,
+  0xec0dd0a8, 0x81904a0c, 0xec71244f, 0x8180c6a9, 0xecd48407, 0x8171914e,
+  0xed37ef91, 0x8162aa04, 0xed9b66b2, 0x815410d4, 0xedfee92b, 0x8145c5c7,
+  0xee6276bf, 0x8137c8e6, 0xeec60f31, 0x812a1a3a, 0xef29b243, 0x811cb9ca,
+  0xef8d5fb8, 0x810fa7a0, 0xeff11753, 0x8102e3c4, 0xf054d8d5, 0x80f66e3c,
+  0xf0b8a401, 0x80ea4712, 0xf11c789a, 0x80de6e4c, 0xf1805662, 0x80d2e3f2,
+  0xf1e43d1c, 0x80c7a80a, 0xf2482c8a, 0x80bcba9d, 0xf2ac246e, 0x80b21baf,
+  0xf310248a, 0x80a7cb49, 0xf3742ca2, 0x809dc971, 0xf3d83c77, 0x8094162c,
+  0xf43c53cb, 0x808ab180, 0xf4a07261, 0x80819b74, 0xf50497fb, 0x8078d40d,
+  0xf568c45b, 0x80705b50, 0xf5ccf743, 0x80683143, 0xf6313077, 0x806055eb,
+  0xf6956fb7, 0x8058c94c, 0xf6f9b4c6, 0x80518b6b, 0xf75dff66, 0x804a9c4d,
+  0xf7c24f59, 0x8043fbf6, 0xf826a462, 0x803daa6a, 0xf88afe42, 0x8037a7ac,
+  0xf8ef5cbb, 0x8031f3c2, 0xf953bf91, 0x802c8ead, 0xf9b82684, 0x80277872,
+  0xfa1c9157, 0x8022b114, 0xfa80ffcb, 0x801e3895, 0xfae571a4, 0x801a0ef8,
+  0xfb49e6a3, 0x80163440, 0xfbae5e89, 0x8012a86f, 0xfc12d91a, 0x800f6b88,
+  0xfc775616, 0x800c7d8c, 0xfcdbd541, 0x8009de7e, 0xfd40565c, 0x80078e5e,
+  0xfda4d929, 0x80058d2f, 0xfe095d69, 0x8003daf1, 0xfe6de2e0, 0x800277a6,
+  0xfed2694f, 0x8001634e, 0xff36f078, 0x80009dea, 0xff9b781d, 0x8000277a
+};
+
+
+/*    
+* @brief  Q15 Twiddle factors Tables of the arm_cfft_q15 lengths    
+*/
+
+/**    
+* \par    
+* Example code for Q15 Twiddle factors Generation::    
+* \par    
+* <pre>for(i = 0; i< 3N/4; i++)    
+* {    
+*    twiddleCoef_N_q15[2*i]= cos(i * 2*PI/(float)N);    
+*    twiddleCoef_N_q15[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 16, 32, ..., 2048 and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are interleaved fashion    
+* \par    
+* Convert Floating point to Q15(Fixed point 1.15):    
+*	round(twiddleCoef_N_q15(i) * pow(2, 15))    
+* \par    
+* The 4096 point table is twiddleCoefQ15.    
+*/
+
+const q15_t ALIGN4 twiddleCoef_16_q15[24] = {
+  0x7fff, 0x0, 0x7642, 0x30fc, 0x5a82, 0x5a82, 0x30fc, 0x7642,
+  0x0, 0x7fff, 0xcf04, 0x7642, 0xa57e, 0x5a82, 0x89be, 0x30fc,
+  0x8000, 0x0, 0x89be, 0xcf04, 0xa57e, 0xa57e, 0xcf04, 0x89be
+};
+
+const q15_t ALIGN4 twiddleCoef_32_q15[48] = {
+  0x7fff, 0x0, 0x7d8a, 0x18f9, 0x7642, 0x30fc, 0x6a6e, 0x471d,
+  0x5a82, 0x5a82, 0x471d, 0x6a6e, 0x30fc, 0x7642, 0x18f9, 0x7d8a,
+  0x0, 0x7fff, 0xe707, 0x7d8a, 0xcf04, 0x7642, 0xb8e3, 0x6a6e,
+  0xa57e, 0x5a82, 0x9592, 0x471d, 0x89be, 0x30fc, 0x8276, 0x18f9,
+  0x8000, 0x0, 0x8276, 0xe707, 0x89be, 0xcf04, 0x9592, 0xb8e3,
+  0xa57e, 0xa57e, 0xb8e3, 0x9592, 0xcf04, 0x89be, 0xe707, 0x8276
+};
+
+const q15_t ALIGN4 twiddleCoef_64_q15[96] = {
+  0x7fff, 0x0, 0x7f62, 0xc8c, 0x7d8a, 0x18f9, 0x7a7d, 0x2528,
+  0x7642, 0x30fc, 0x70e3, 0x3c57, 0x6a6e, 0x471d, 0x62f2, 0x5134,
+  0x5a82, 0x5a82, 0x5134, 0x62f2, 0x471d, 0x6a6e, 0x3c57, 0x70e3,
+  0x30fc, 0x7642, 0x2528, 0x7a7d, 0x18f9, 0x7d8a, 0xc8c, 0x7f62,
+  0x0, 0x7fff, 0xf374, 0x7f62, 0xe707, 0x7d8a, 0xdad8, 0x7a7d,
+  0xcf04, 0x7642, 0xc3a9, 0x70e3, 0xb8e3, 0x6a6e, 0xaecc, 0x62f2,
+  0xa57e, 0x5a82, 0x9d0e, 0x5134, 0x9592, 0x471d, 0x8f1d, 0x3c57,
+  0x89be, 0x30fc, 0x8583, 0x2528, 0x8276, 0x18f9, 0x809e, 0xc8c,
+  0x8000, 0x0, 0x809e, 0xf374, 0x8276, 0xe707, 0x8583, 0xdad8,
+  0x89be, 0xcf04, 0x8f1d, 0xc3a9, 0x9592, 0xb8e3, 0x9d0e, 0xaecc,
+  0xa57e, 0xa57e, 0xaecc, 0x9d0e, 0xb8e3, 0x9592, 0xc3a9, 0x8f1d,
+  0xcf04, 0x89be, 0xdad8, 0x8583, 0xe707, 0x8276, 0xf374, 0x809e
+};
+
+const q15_t ALIGN4 twiddleCoef_128_q15[192] = {
+  0x7fff, 0x0, 0x7fd9, 0x648, 0x7f62, 0xc8c, 0x7e9d, 0x12c8,
+  0x7d8a, 0x18f9, 0x7c2a, 0x1f1a, 0x7a7d, 0x2528, 0x7885, 0x2b1f,
+  0x7642, 0x30fc, 0x73b6, 0x36ba, 0x70e3, 0x3c57, 0x6dca, 0x41ce,
+  0x6a6e, 0x471d, 0x66d0, 0x4c40, 0x62f2, 0x5134, 0x5ed7, 0x55f6,
+  0x5a82, 0x5a82, 0x55f6, 0x5ed7, 0x5134, 0x62f2, 0x4c40, 0x66d0,
+  0x471d, 0x6a6e, 0x41ce, 0x6dca, 0x3c57, 0x70e3, 0x36ba, 0x73b6,
+  0x30fc, 0x7642, 0x2b1f, 0x7885, 0x2528, 0x7a7d, 0x1f1a, 0x7c2a,
+  0x18f9, 0x7d8a, 0x12c8, 0x7e9d, 0xc8c, 0x7f62, 0x648, 0x7fd9,
+  0x0, 0x7fff, 0xf9b8, 0x7fd9, 0xf374, 0x7f62, 0xed38, 0x7e9d,
+  0xe707, 0x7d8a, 0xe0e6, 0x7c2a, 0xdad8, 0x7a7d, 0xd4e1, 0x7885,
+  0xcf04, 0x7642, 0xc946, 0x73b6, 0xc3a9, 0x70e3, 0xbe32, 0x6dca,
+  0xb8e3, 0x6a6e, 0xb3c0, 0x66d0, 0xaecc, 0x62f2, 0xaa0a, 0x5ed7,
+  0xa57e, 0x5a82, 0xa129, 0x55f6, 0x9d0e, 0x5134, 0x9930, 0x4c40,
+  0x9592, 0x471d, 0x9236, 0x41ce, 0x8f1d, 0x3c57, 0x8c4a, 0x36ba,
+  0x89be, 0x30fc, 0x877b, 0x2b1f, 0x8583, 0x2528, 0x83d6, 0x1f1a,
+  0x8276, 0x18f9, 0x8163, 0x12c8, 0x809e, 0xc8c, 0x8027, 0x648,
+  0x8000, 0x0, 0x8027, 0xf9b8, 0x809e, 0xf374, 0x8163, 0xed38,
+  0x8276, 0xe707, 0x83d6, 0xe0e6, 0x8583, 0xdad8, 0x877b, 0xd4e1,
+  0x89be, 0xcf04, 0x8c4a, 0xc946, 0x8f1d, 0xc3a9, 0x9236, 0xbe32,
+  0x9592, 0xb8e3, 0x9930, 0xb3c0, 0x9d0e, 0xaecc, 0xa129, 0xaa0a,
+  0xa57e, 0xa57e, 0xaa0a, 0xa129, 0xaecc, 0x9d0e, 0xb3c0, 0x9930,
+  0xb8e3, 0x9592, 0xbe32, 0x9236, 0xc3a9, 0x8f1d, 0xc946, 0x8c4a,
+  0xcf04, 0x89be, 0xd4e1, 0x877b, 0xdad8, 0x8583, 0xe0e6, 0x83d6,
+  0xe707, 0x8276, 0xed38, 0x8163, 0xf374, 0x809e, 0xf9b8, 0x8027
+};
+
+const q15_t ALIGN4 twiddleCoef_256_q15[384] = {
+  0x7fff, 0x0, 0x7ff6, 0x324, 0x7fd9, 0x648, 0x7fa7, 0x96b,
+  0x7f62, 0xc8c, 0x7f0a, 0xfab, 0x7e9d, 0x12c8, 0x7e1e, 0x15e2,
+  0x7d8a, 0x18f9, 0x7ce4, 0x1c0c, 0x7c2a, 0x1f1a, 0x7b5d, 0x2224,
+  0x7a7d, 0x2528, 0x798a, 0x2827, 0x7885, 0x2b1f, 0x776c, 0x2e11,
+  0x7642, 0x30fc, 0x7505, 0x33df, 0x73b6, 0x36ba, 0x7255, 0x398d,
+  0x70e3, 0x3c57, 0x6f5f, 0x3f17, 0x6dca, 0x41ce, 0x6c24, 0x447b,
+  0x6a6e, 0x471d, 0x68a7, 0x49b4, 0x66d0, 0x4c40, 0x64e9, 0x4ec0,
+  0x62f2, 0x5134, 0x60ec, 0x539b, 0x5ed7, 0x55f6, 0x5cb4, 0x5843,
+  0x5a82, 0x5a82, 0x5843, 0x5cb4, 0x55f6, 0x5ed7, 0x539b, 0x60ec,
+  0x5134, 0x62f2, 0x4ec0, 0x64e9, 0x4c40, 0x66d0, 0x49b4, 0x68a7,
+  0x471d, 0x6a6e, 0x447b, 0x6c24, 0x41ce, 0x6dca, 0x3f17, 0x6f5f,
+  0x3c57, 0x70e3, 0x398d, 0x7255, 0x36ba, 0x73b6, 0x33df, 0x7505,
+  0x30fc, 0x7642, 0x2e11, 0x776c, 0x2b1f, 0x7885, 0x2827, 0x798a,
+  0x2528, 0x7a7d, 0x2224, 0x7b5d, 0x1f1a, 0x7c2a, 0x1c0c, 0x7ce4,
+  0x18f9, 0x7d8a, 0x15e2, 0x7e1e, 0x12c8, 0x7e9d, 0xfab, 0x7f0a,
+  0xc8c, 0x7f62, 0x96b, 0x7fa7, 0x648, 0x7fd9, 0x324, 0x7ff6,
+  0x0, 0x7fff, 0xfcdc, 0x7ff6, 0xf9b8, 0x7fd9, 0xf695, 0x7fa7,
+  0xf374, 0x7f62, 0xf055, 0x7f0a, 0xed38, 0x7e9d, 0xea1e, 0x7e1e,
+  0xe707, 0x7d8a, 0xe3f4, 0x7ce4, 0xe0e6, 0x7c2a, 0xdddc, 0x7b5d,
+  0xdad8, 0x7a7d, 0xd7d9, 0x798a, 0xd4e1, 0x7885, 0xd1ef, 0x776c,
+  0xcf04, 0x7642, 0xcc21, 0x7505, 0xc946, 0x73b6, 0xc673, 0x7255,
+  0xc3a9, 0x70e3, 0xc0e9, 0x6f5f, 0xbe32, 0x6dca, 0xbb85, 0x6c24,
+  0xb8e3, 0x6a6e, 0xb64c, 0x68a7, 0xb3c0, 0x66d0, 0xb140, 0x64e9,
+  0xaecc, 0x62f2, 0xac65, 0x60ec, 0xaa0a, 0x5ed7, 0xa7bd, 0x5cb4,
+  0xa57e, 0x5a82, 0xa34c, 0x5843, 0xa129, 0x55f6, 0x9f14, 0x539b,
+  0x9d0e, 0x5134, 0x9b17, 0x4ec0, 0x9930, 0x4c40, 0x9759, 0x49b4,
+  0x9592, 0x471d, 0x93dc, 0x447b, 0x9236, 0x41ce, 0x90a1, 0x3f17,
+  0x8f1d, 0x3c57, 0x8dab, 0x398d, 0x8c4a, 0x36ba, 0x8afb, 0x33df,
+  0x89be, 0x30fc, 0x8894, 0x2e11, 0x877b, 0x2b1f, 0x8676, 0x2827,
+  0x8583, 0x2528, 0x84a3, 0x2224, 0x83d6, 0x1f1a, 0x831c, 0x1c0c,
+  0x8276, 0x18f9, 0x81e2, 0x15e2, 0x8163, 0x12c8, 0x80f6, 0xfab,
+  0x809e, 0xc8c, 0x8059, 0x96b, 0x8027, 0x648, 0x800a, 0x324,
+  0x8000, 0x0, 0x800a, 0xfcdc, 0x8027, 0xf9b8, 0x8059, 0xf695,
+  0x809e, 0xf374, 0x80f6, 0xf055, 0x8163, 0xed38, 0x81e2, 0xea1e,
+  0x8276, 0xe707, 0x831c, 0xe3f4, 0x83d6, 0xe0e6, 0x84a3, 0xdddc,
+  0x8583, 0xdad8, 0x8676, 0xd7d9, 0x877b, 0xd4e1, 0x8894, 0xd1ef,
+  0x89be, 0xcf04, 0x8afb, 0xcc21, 0x8c4a, 0xc946, 0x8dab, 0xc673,
+  0x8f1d, 0xc3a9, 0x90a1, 0xc0e9, 0x9236, 0xbe32, 0x93dc, 0xbb85,
+  0x9592, 0xb8e3, 0x9759, 0xb64c, 0x9930, 0xb3c0, 0x9b17, 0xb140,
+  0x9d0e, 0xaecc, 0x9f14, 0xac65, 0xa129, 0xaa0a, 0xa34c, 0xa7bd,
+  0xa57e, 0xa57e, 0xa7bd, 0xa34c, 0xaa0a, 0xa129, 0xac65, 0x9f14,
+  0xaecc, 0x9d0e, 0xb140, 0x9b17, 0xb3c0, 0x9930, 0xb64c, 0x9759,
+  0xb8e3, 0x9592, 0xbb85, 0x93dc, 0xbe32, 0x9236, 0xc0e9, 0x90a1,
+  0xc3a9, 0x8f1d, 0xc673, 0x8dab, 0xc946, 0x8c4a, 0xcc21, 0x8afb,
+  0xcf04, 0x89be, 0xd1ef, 0x8894, 0xd4e1, 0x877b, 0xd7d9, 0x8676,
+  0xdad8, 0x8583, 0xdddc, 0x84a3, 0xe0e6, 0x83d6, 0xe3f4, 0x831c,
+  0xe707, 0x8276, 0xea1e, 0x81e2, 0xed38, 0x8163, 0xf055, 0x80f6,
+  0xf374, 0x809e, 0xf695, 0x8059, 0xf9b8, 0x8027, 0xfcdc, 0x800a
+};
+
+const q15_t ALIGN4 twiddleCoef_512_q15[768] = {
+  0x7fff, 0x0, 0x7ffe, 0x192, 0x7ff6, 0x324, 0x7fea, 0x4b6,
+  0x7fd9, 0x648, 0x7fc2, 0x7d9, 0x7fa7, 0x96b, 0x7f87, 0xafb,
+  0x7f62, 0xc8c, 0x7f38, 0xe1c, 0x7f0a, 0xfab, 0x7ed6, 0x113a,
+  0x7e9d, 0x12c8, 0x7e60, 0x1455, 0x7e1e, 0x15e2, 0x7dd6, 0x176e,
+  0x7d8a, 0x18f9, 0x7d3a, 0x1a83, 0x7ce4, 0x1c0c, 0x7c89, 0x1d93,
+  0x7c2a, 0x1f1a, 0x7bc6, 0x209f, 0x7b5d, 0x2224, 0x7aef, 0x23a7,
+  0x7a7d, 0x2528, 0x7a06, 0x26a8, 0x798a, 0x2827, 0x790a, 0x29a4,
+  0x7885, 0x2b1f, 0x77fb, 0x2c99, 0x776c, 0x2e11, 0x76d9, 0x2f87,
+  0x7642, 0x30fc, 0x75a6, 0x326e, 0x7505, 0x33df, 0x7460, 0x354e,
+  0x73b6, 0x36ba, 0x7308, 0x3825, 0x7255, 0x398d, 0x719e, 0x3af3,
+  0x70e3, 0x3c57, 0x7023, 0x3db8, 0x6f5f, 0x3f17, 0x6e97, 0x4074,
+  0x6dca, 0x41ce, 0x6cf9, 0x4326, 0x6c24, 0x447b, 0x6b4b, 0x45cd,
+  0x6a6e, 0x471d, 0x698c, 0x486a, 0x68a7, 0x49b4, 0x67bd, 0x4afb,
+  0x66d0, 0x4c40, 0x65de, 0x4d81, 0x64e9, 0x4ec0, 0x63ef, 0x4ffb,
+  0x62f2, 0x5134, 0x61f1, 0x5269, 0x60ec, 0x539b, 0x5fe4, 0x54ca,
+  0x5ed7, 0x55f6, 0x5dc8, 0x571e, 0x5cb4, 0x5843, 0x5b9d, 0x5964,
+  0x5a82, 0x5a82, 0x5964, 0x5b9d, 0x5843, 0x5cb4, 0x571e, 0x5dc8,
+  0x55f6, 0x5ed7, 0x54ca, 0x5fe4, 0x539b, 0x60ec, 0x5269, 0x61f1,
+  0x5134, 0x62f2, 0x4ffb, 0x63ef, 0x4ec0, 0x64e9, 0x4d81, 0x65de,
+  0x4c40, 0x66d0, 0x4afb, 0x67bd, 0x49b4, 0x68a7, 0x486a, 0x698c,
+  0x471d, 0x6a6e, 0x45cd, 0x6b4b, 0x447b, 0x6c24, 0x4326, 0x6cf9,
+  0x41ce, 0x6dca, 0x4074, 0x6e97, 0x3f17, 0x6f5f, 0x3db8, 0x7023,
+  0x3c57, 0x70e3, 0x3af3, 0x719e, 0x398d, 0x7255, 0x3825, 0x7308,
+  0x36ba, 0x73b6, 0x354e, 0x7460, 0x33df, 0x7505, 0x326e, 0x75a6,
+  0x30fc, 0x7642, 0x2f87, 0x76d9, 0x2e11, 0x776c, 0x2c99, 0x77fb,
+  0x2b1f, 0x7885, 0x29a4, 0x790a, 0x2827, 0x798a, 0x26a8, 0x7a06,
+  0x2528, 0x7a7d, 0x23a7, 0x7aef, 0x2224, 0x7b5d, 0x209f, 0x7bc6,
+  0x1f1a, 0x7c2a, 0x1d93, 0x7c89, 0x1c0c, 0x7ce4, 0x1a83, 0x7d3a,
+  0x18f9, 0x7d8a, 0x176e, 0x7dd6, 0x15e2, 0x7e1e, 0x1455, 0x7e60,
+  0x12c8, 0x7e9d, 0x113a, 0x7ed6, 0xfab, 0x7f0a, 0xe1c, 0x7f38,
+  0xc8c, 0x7f62, 0xafb, 0x7f87, 0x96b, 0x7fa7, 0x7d9, 0x7fc2,
+  0x648, 0x7fd9, 0x4b6, 0x7fea, 0x324, 0x7ff6, 0x192, 0x7ffe,
+  0x0, 0x7fff, 0xfe6e, 0x7ffe, 0xfcdc, 0x7ff6, 0xfb4a, 0x7fea,
+  0xf9b8, 0x7fd9, 0xf827, 0x7fc2, 0xf695, 0x7fa7, 0xf505, 0x7f87,
+  0xf374, 0x7f62, 0xf1e4, 0x7f38, 0xf055, 0x7f0a, 0xeec6, 0x7ed6,
+  0xed38, 0x7e9d, 0xebab, 0x7e60, 0xea1e, 0x7e1e, 0xe892, 0x7dd6,
+  0xe707, 0x7d8a, 0xe57d, 0x7d3a, 0xe3f4, 0x7ce4, 0xe26d, 0x7c89,
+  0xe0e6, 0x7c2a, 0xdf61, 0x7bc6, 0xdddc, 0x7b5d, 0xdc59, 0x7aef,
+  0xdad8, 0x7a7d, 0xd958, 0x7a06, 0xd7d9, 0x798a, 0xd65c, 0x790a,
+  0xd4e1, 0x7885, 0xd367, 0x77fb, 0xd1ef, 0x776c, 0xd079, 0x76d9,
+  0xcf04, 0x7642, 0xcd92, 0x75a6, 0xcc21, 0x7505, 0xcab2, 0x7460,
+  0xc946, 0x73b6, 0xc7db, 0x7308, 0xc673, 0x7255, 0xc50d, 0x719e,
+  0xc3a9, 0x70e3, 0xc248, 0x7023, 0xc0e9, 0x6f5f, 0xbf8c, 0x6e97,
+  0xbe32, 0x6dca, 0xbcda, 0x6cf9, 0xbb85, 0x6c24, 0xba33, 0x6b4b,
+  0xb8e3, 0x6a6e, 0xb796, 0x698c, 0xb64c, 0x68a7, 0xb505, 0x67bd,
+  0xb3c0, 0x66d0, 0xb27f, 0x65de, 0xb140, 0x64e9, 0xb005, 0x63ef,
+  0xaecc, 0x62f2, 0xad97, 0x61f1, 0xac65, 0x60ec, 0xab36, 0x5fe4,
+  0xaa0a, 0x5ed7, 0xa8e2, 0x5dc8, 0xa7bd, 0x5cb4, 0xa69c, 0x5b9d,
+  0xa57e, 0x5a82, 0xa463, 0x5964, 0xa34c, 0x5843, 0xa238, 0x571e,
+  0xa129, 0x55f6, 0xa01c, 0x54ca, 0x9f14, 0x539b, 0x9e0f, 0x5269,
+  0x9d0e, 0x5134, 0x9c11, 0x4ffb, 0x9b17, 0x4ec0, 0x9a22, 0x4d81,
+  0x9930, 0x4c40, 0x9843, 0x4afb, 0x9759, 0x49b4, 0x9674, 0x486a,
+  0x9592, 0x471d, 0x94b5, 0x45cd, 0x93dc, 0x447b, 0x9307, 0x4326,
+  0x9236, 0x41ce, 0x9169, 0x4074, 0x90a1, 0x3f17, 0x8fdd, 0x3db8,
+  0x8f1d, 0x3c57, 0x8e62, 0x3af3, 0x8dab, 0x398d, 0x8cf8, 0x3825,
+  0x8c4a, 0x36ba, 0x8ba0, 0x354e, 0x8afb, 0x33df, 0x8a5a, 0x326e,
+  0x89be, 0x30fc, 0x8927, 0x2f87, 0x8894, 0x2e11, 0x8805, 0x2c99,
+  0x877b, 0x2b1f, 0x86f6, 0x29a4, 0x8676, 0x2827, 0x85fa, 0x26a8,
+  0x8583, 0x2528, 0x8511, 0x23a7, 0x84a3, 0x2224, 0x843a, 0x209f,
+  0x83d6, 0x1f1a, 0x8377, 0x1d93, 0x831c, 0x1c0c, 0x82c6, 0x1a83,
+  0x8276, 0x18f9, 0x822a, 0x176e, 0x81e2, 0x15e2, 0x81a0, 0x1455,
+  0x8163, 0x12c8, 0x812a, 0x113a, 0x80f6, 0xfab, 0x80c8, 0xe1c,
+  0x809e, 0xc8c, 0x8079, 0xafb, 0x8059, 0x96b, 0x803e, 0x7d9,
+  0x8027, 0x648, 0x8016, 0x4b6, 0x800a, 0x324, 0x8002, 0x192,
+  0x8000, 0x0, 0x8002, 0xfe6e, 0x800a, 0xfcdc, 0x8016, 0xfb4a,
+  0x8027, 0xf9b8, 0x803e, 0xf827, 0x8059, 0xf695, 0x8079, 0xf505,
+  0x809e, 0xf374, 0x80c8, 0xf1e4, 0x80f6, 0xf055, 0x812a, 0xeec6,
+  0x8163, 0xed38, 0x81a0, 0xebab, 0x81e2, 0xea1e, 0x822a, 0xe892,
+  0x8276, 0xe707, 0x82c6, 0xe57d, 0x831c, 0xe3f4, 0x8377, 0xe26d,
+  0x83d6, 0xe0e6, 0x843a, 0xdf61, 0x84a3, 0xdddc, 0x8511, 0xdc59,
+  0x8583, 0xdad8, 0x85fa, 0xd958, 0x8676, 0xd7d9, 0x86f6, 0xd65c,
+  0x877b, 0xd4e1, 0x8805, 0xd367, 0x8894, 0xd1ef, 0x8927, 0xd079,
+  0x89be, 0xcf04, 0x8a5a, 0xcd92, 0x8afb, 0xcc21, 0x8ba0, 0xcab2,
+  0x8c4a, 0xc946, 0x8cf8, 0xc7db, 0x8dab, 0xc673, 0x8e62, 0xc50d,
+  0x8f1d, 0xc3a9, 0x8fdd, 0xc248, 0x90a1, 0xc0e9, 0x9169, 0xbf8c,
+  0x9236, 0xbe32, 0x9307, 0xbcda, 0x93dc, 0xbb85, 0x94b5, 0xba33,
+  0x9592, 0xb8e3, 0x9674, 0xb796, 0x9759, 0xb64c, 0x9843, 0xb505,
+  0x9930, 0xb3c0, 0x9a22, 0xb27f, 0x9b17, 0xb140, 0x9c11, 0xb005,
+  0x9d0e, 0xaecc, 0x9e0f, 0xad97, 0x9f14, 0xac65, 0xa01c, 0xab36,
+  0xa129, 0xaa0a, 0xa238, 0xa8e2, 0xa34c, 0xa7bd, 0xa463, 0xa69c,
+  0xa57e, 0xa57e, 0xa69c, 0xa463, 0xa7bd, 0xa34c, 0xa8e2, 0xa238,
+  0xaa0a, 0xa129, 0xab36, 0xa01c, 0xac65, 0x9f14, 0xad97, 0x9e0f,
+  0xaecc, 0x9d0e, 0xb005, 0x9c11, 0xb140, 0x9b17, 0xb27f, 0x9a22,
+  0xb3c0, 0x9930, 0xb505, 0x9843, 0xb64c, 0x9759, 0xb796, 0x9674,
+  0xb8e3, 0x9592, 0xba33, 0x94b5, 0xbb85, 0x93dc, 0xbcda, 0x9307,
+  0xbe32, 0x9236, 0xbf8c, 0x9169, 0xc0e9, 0x90a1, 0xc248, 0x8fdd,
+  0xc3a9, 0x8f1d, 0xc50d, 0x8e62, 0xc673, 0x8dab, 0xc7db, 0x8cf8,
+  0xc946, 0x8c4a, 0xcab2, 0x8ba0, 0xcc21, 0x8afb, 0xcd92, 0x8a5a,
+  0xcf04, 0x89be, 0xd079, 0x8927, 0xd1ef, 0x8894, 0xd367, 0x8805,
+  0xd4e1, 0x877b, 0xd65c, 0x86f6, 0xd7d9, 0x8676, 0xd958, 0x85fa,
+  0xdad8, 0x8583, 0xdc59, 0x8511, 0xdddc, 0x84a3, 0xdf61, 0x843a,
+  0xe0e6, 0x83d6, 0xe26d, 0x8377, 0xe3f4, 0x831c, 0xe57d, 0x82c6,
+  0xe707, 0x8276, 0xe892, 0x822a, 0xea1e, 0x81e2, 0xebab, 0x81a0,
+  0xed38, 0x8163, 0xeec6, 0x812a, 0xf055, 0x80f6, 0xf1e4, 0x80c8,
+  0xf374, 0x809e, 0xf505, 0x8079, 0xf695, 0x8059, 0xf827, 0x803e,
+  0xf9b8, 0x8027, 0xfb4a, 0x8016, 0xfcdc, 0x800a, 0xfe6e, 0x8002
+};
+
+const q15_t ALIGN4 twiddleCoef_1024_q15[1536] = {
+  0x7fff, 0x0, 0x7fff, 0xc9, 0x7ffe, 0x192, 0x7ffa, 0x25b,
+  0x7ff6, 0x324, 0x7ff1, 0x3ed, 0x7fea, 0x4b6, 0x7fe2, 0x57f,
+  0x7fd9, 0x648, 0x7fce, 0x711, 0x7fc2, 0x7d9, 0x7fb5, 0x8a2,
+  0x7fa7, 0x96b, 0x7f98, 0xa33, 0x7f87, 0xafb, 0x7f75, 0xbc4,
+  0x7f62, 0xc8c, 0x7f4e, 0xd54, 0x7f38, 0xe1c, 0x7f22, 0xee4,
+  0x7f0a, 0xfab, 0x7ef0, 0x1073, 0x7ed6, 0x113a, 0x7eba, 0x1201,
+  0x7e9d, 0x12c8, 0x7e7f, 0x138f, 0x7e60, 0x1455, 0x7e3f, 0x151c,
+  0x7e1e, 0x15e2, 0x7dfb, 0x16a8, 0x7dd6, 0x176e, 0x7db1, 0x1833,
+  0x7d8a, 0x18f9, 0x7d63, 0x19be, 0x7d3a, 0x1a83, 0x7d0f, 0x1b47,
+  0x7ce4, 0x1c0c, 0x7cb7, 0x1cd0, 0x7c89, 0x1d93, 0x7c5a, 0x1e57,
+  0x7c2a, 0x1f1a, 0x7bf9, 0x1fdd, 0x7bc6, 0x209f, 0x7b92, 0x2162,
+  0x7b5d, 0x2224, 0x7b27, 0x22e5, 0x7aef, 0x23a7, 0x7ab7, 0x2467,
+  0x7a7d, 0x2528, 0x7a42, 0x25e8, 0x7a06, 0x26a8, 0x79c9, 0x2768,
+  0x798a, 0x2827, 0x794a, 0x28e5, 0x790a, 0x29a4, 0x78c8, 0x2a62,
+  0x7885, 0x2b1f, 0x7840, 0x2bdc, 0x77fb, 0x2c99, 0x77b4, 0x2d55,
+  0x776c, 0x2e11, 0x7723, 0x2ecc, 0x76d9, 0x2f87, 0x768e, 0x3042,
+  0x7642, 0x30fc, 0x75f4, 0x31b5, 0x75a6, 0x326e, 0x7556, 0x3327,
+  0x7505, 0x33df, 0x74b3, 0x3497, 0x7460, 0x354e, 0x740b, 0x3604,
+  0x73b6, 0x36ba, 0x735f, 0x3770, 0x7308, 0x3825, 0x72af, 0x38d9,
+  0x7255, 0x398d, 0x71fa, 0x3a40, 0x719e, 0x3af3, 0x7141, 0x3ba5,
+  0x70e3, 0x3c57, 0x7083, 0x3d08, 0x7023, 0x3db8, 0x6fc2, 0x3e68,
+  0x6f5f, 0x3f17, 0x6efb, 0x3fc6, 0x6e97, 0x4074, 0x6e31, 0x4121,
+  0x6dca, 0x41ce, 0x6d62, 0x427a, 0x6cf9, 0x4326, 0x6c8f, 0x43d1,
+  0x6c24, 0x447b, 0x6bb8, 0x4524, 0x6b4b, 0x45cd, 0x6add, 0x4675,
+  0x6a6e, 0x471d, 0x69fd, 0x47c4, 0x698c, 0x486a, 0x691a, 0x490f,
+  0x68a7, 0x49b4, 0x6832, 0x4a58, 0x67bd, 0x4afb, 0x6747, 0x4b9e,
+  0x66d0, 0x4c40, 0x6657, 0x4ce1, 0x65de, 0x4d81, 0x6564, 0x4e21,
+  0x64e9, 0x4ec0, 0x646c, 0x4f5e, 0x63ef, 0x4ffb, 0x6371, 0x5098,
+  0x62f2, 0x5134, 0x6272, 0x51cf, 0x61f1, 0x5269, 0x616f, 0x5303,
+  0x60ec, 0x539b, 0x6068, 0x5433, 0x5fe4, 0x54ca, 0x5f5e, 0x5560,
+  0x5ed7, 0x55f6, 0x5e50, 0x568a, 0x5dc8, 0x571e, 0x5d3e, 0x57b1,
+  0x5cb4, 0x5843, 0x5c29, 0x58d4, 0x5b9d, 0x5964, 0x5b10, 0x59f4,
+  0x5a82, 0x5a82, 0x59f4, 0x5b10, 0x5964, 0x5b9d, 0x58d4, 0x5c29,
+  0x5843, 0x5cb4, 0x57b1, 0x5d3e, 0x571e, 0x5dc8, 0x568a, 0x5e50,
+  0x55f6, 0x5ed7, 0x5560, 0x5f5e, 0x54ca, 0x5fe4, 0x5433, 0x6068,
+  0x539b, 0x60ec, 0x5303, 0x616f, 0x5269, 0x61f1, 0x51cf, 0x6272,
+  0x5134, 0x62f2, 0x5098, 0x6371, 0x4ffb, 0x63ef, 0x4f5e, 0x646c,
+  0x4ec0, 0x64e9, 0x4e21, 0x6564, 0x4d81, 0x65de, 0x4ce1, 0x6657,
+  0x4c40, 0x66d0, 0x4b9e, 0x6747, 0x4afb, 0x67bd, 0x4a58, 0x6832,
+  0x49b4, 0x68a7, 0x490f, 0x691a, 0x486a, 0x698c, 0x47c4, 0x69fd,
+  0x471d, 0x6a6e, 0x4675, 0x6add, 0x45cd, 0x6b4b, 0x4524, 0x6bb8,
+  0x447b, 0x6c24, 0x43d1, 0x6c8f, 0x4326, 0x6cf9, 0x427a, 0x6d62,
+  0x41ce, 0x6dca, 0x4121, 0x6e31, 0x4074, 0x6e97, 0x3fc6, 0x6efb,
+  0x3f17, 0x6f5f, 0x3e68, 0x6fc2, 0x3db8, 0x7023, 0x3d08, 0x7083,
+  0x3c57, 0x70e3, 0x3ba5, 0x7141, 0x3af3, 0x719e, 0x3a40, 0x71fa,
+  0x398d, 0x7255, 0x38d9, 0x72af, 0x3825, 0x7308, 0x3770, 0x735f,
+  0x36ba, 0x73b6, 0x3604, 0x740b, 0x354e, 0x7460, 0x3497, 0x74b3,
+  0x33df, 0x7505, 0x3327, 0x7556, 0x326e, 0x75a6, 0x31b5, 0x75f4,
+  0x30fc, 0x7642, 0x3042, 0x768e, 0x2f87, 0x76d9, 0x2ecc, 0x7723,
+  0x2e11, 0x776c, 0x2d55, 0x77b4, 0x2c99, 0x77fb, 0x2bdc, 0x7840,
+  0x2b1f, 0x7885, 0x2a62, 0x78c8, 0x29a4, 0x790a, 0x28e5, 0x794a,
+  0x2827, 0x798a, 0x2768, 0x79c9, 0x26a8, 0x7a06, 0x25e8, 0x7a42,
+  0x2528, 0x7a7d, 0x2467, 0x7ab7, 0x23a7, 0x7aef, 0x22e5, 0x7b27,
+  0x2224, 0x7b5d, 0x2162, 0x7b92, 0x209f, 0x7bc6, 0x1fdd, 0x7bf9,
+  0x1f1a, 0x7c2a, 0x1e57, 0x7c5a, 0x1d93, 0x7c89, 0x1cd0, 0x7cb7,
+  0x1c0c, 0x7ce4, 0x1b47, 0x7d0f, 0x1a83, 0x7d3a, 0x19be, 0x7d63,
+  0x18f9, 0x7d8a, 0x1833, 0x7db1, 0x176e, 0x7dd6, 0x16a8, 0x7dfb,
+  0x15e2, 0x7e1e, 0x151c, 0x7e3f, 0x1455, 0x7e60, 0x138f, 0x7e7f,
+  0x12c8, 0x7e9d, 0x1201, 0x7eba, 0x113a, 0x7ed6, 0x1073, 0x7ef0,
+  0xfab, 0x7f0a, 0xee4, 0x7f22, 0xe1c, 0x7f38, 0xd54, 0x7f4e,
+  0xc8c, 0x7f62, 0xbc4, 0x7f75, 0xafb, 0x7f87, 0xa33, 0x7f98,
+  0x96b, 0x7fa7, 0x8a2, 0x7fb5, 0x7d9, 0x7fc2, 0x711, 0x7fce,
+  0x648, 0x7fd9, 0x57f, 0x7fe2, 0x4b6, 0x7fea, 0x3ed, 0x7ff1,
+  0x324, 0x7ff6, 0x25b, 0x7ffa, 0x192, 0x7ffe, 0xc9, 0x7fff,
+  0x0, 0x7fff, 0xff37, 0x7fff, 0xfe6e, 0x7ffe, 0xfda5, 0x7ffa,
+  0xfcdc, 0x7ff6, 0xfc13, 0x7ff1, 0xfb4a, 0x7fea, 0xfa81, 0x7fe2,
+  0xf9b8, 0x7fd9, 0xf8ef, 0x7fce, 0xf827, 0x7fc2, 0xf75e, 0x7fb5,
+  0xf695, 0x7fa7, 0xf5cd, 0x7f98, 0xf505, 0x7f87, 0xf43c, 0x7f75,
+  0xf374, 0x7f62, 0xf2ac, 0x7f4e, 0xf1e4, 0x7f38, 0xf11c, 0x7f22,
+  0xf055, 0x7f0a, 0xef8d, 0x7ef0, 0xeec6, 0x7ed6, 0xedff, 0x7eba,
+  0xed38, 0x7e9d, 0xec71, 0x7e7f, 0xebab, 0x7e60, 0xeae4, 0x7e3f,
+  0xea1e, 0x7e1e, 0xe958, 0x7dfb, 0xe892, 0x7dd6, 0xe7cd, 0x7db1,
+  0xe707, 0x7d8a, 0xe642, 0x7d63, 0xe57d, 0x7d3a, 0xe4b9, 0x7d0f,
+  0xe3f4, 0x7ce4, 0xe330, 0x7cb7, 0xe26d, 0x7c89, 0xe1a9, 0x7c5a,
+  0xe0e6, 0x7c2a, 0xe023, 0x7bf9, 0xdf61, 0x7bc6, 0xde9e, 0x7b92,
+  0xdddc, 0x7b5d, 0xdd1b, 0x7b27, 0xdc59, 0x7aef, 0xdb99, 0x7ab7,
+  0xdad8, 0x7a7d, 0xda18, 0x7a42, 0xd958, 0x7a06, 0xd898, 0x79c9,
+  0xd7d9, 0x798a, 0xd71b, 0x794a, 0xd65c, 0x790a, 0xd59e, 0x78c8,
+  0xd4e1, 0x7885, 0xd424, 0x7840, 0xd367, 0x77fb, 0xd2ab, 0x77b4,
+  0xd1ef, 0x776c, 0xd134, 0x7723, 0xd079, 0x76d9, 0xcfbe, 0x768e,
+  0xcf04, 0x7642, 0xce4b, 0x75f4, 0xcd92, 0x75a6, 0xccd9, 0x7556,
+  0xcc21, 0x7505, 0xcb69, 0x74b3, 0xcab2, 0x7460, 0xc9fc, 0x740b,
+  0xc946, 0x73b6, 0xc890, 0x735f, 0xc7db, 0x7308, 0xc727, 0x72af,
+  0xc673, 0x7255, 0xc5c0, 0x71fa, 0xc50d, 0x719e, 0xc45b, 0x7141,
+  0xc3a9, 0x70e3, 0xc2f8, 0x7083, 0xc248, 0x7023, 0xc198, 0x6fc2,
+  0xc0e9, 0x6f5f, 0xc03a, 0x6efb, 0xbf8c, 0x6e97, 0xbedf, 0x6e31,
+  0xbe32, 0x6dca, 0xbd86, 0x6d62, 0xbcda, 0x6cf9, 0xbc2f, 0x6c8f,
+  0xbb85, 0x6c24, 0xbadc, 0x6bb8, 0xba33, 0x6b4b, 0xb98b, 0x6add,
+  0xb8e3, 0x6a6e, 0xb83c, 0x69fd, 0xb796, 0x698c, 0xb6f1, 0x691a,
+  0xb64c, 0x68a7, 0xb5a8, 0x6832, 0xb505, 0x67bd, 0xb462, 0x6747,
+  0xb3c0, 0x66d0, 0xb31f, 0x6657, 0xb27f, 0x65de, 0xb1df, 0x6564,
+  0xb140, 0x64e9, 0xb0a2, 0x646c, 0xb005, 0x63ef, 0xaf68, 0x6371,
+  0xaecc, 0x62f2, 0xae31, 0x6272, 0xad97, 0x61f1, 0xacfd, 0x616f,
+  0xac65, 0x60ec, 0xabcd, 0x6068, 0xab36, 0x5fe4, 0xaaa0, 0x5f5e,
+  0xaa0a, 0x5ed7, 0xa976, 0x5e50, 0xa8e2, 0x5dc8, 0xa84f, 0x5d3e,
+  0xa7bd, 0x5cb4, 0xa72c, 0x5c29, 0xa69c, 0x5b9d, 0xa60c, 0x5b10,
+  0xa57e, 0x5a82, 0xa4f0, 0x59f4, 0xa463, 0x5964, 0xa3d7, 0x58d4,
+  0xa34c, 0x5843, 0xa2c2, 0x57b1, 0xa238, 0x571e, 0xa1b0, 0x568a,
+  0xa129, 0x55f6, 0xa0a2, 0x5560, 0xa01c, 0x54ca, 0x9f98, 0x5433,
+  0x9f14, 0x539b, 0x9e91, 0x5303, 0x9e0f, 0x5269, 0x9d8e, 0x51cf,
+  0x9d0e, 0x5134, 0x9c8f, 0x5098, 0x9c11, 0x4ffb, 0x9b94, 0x4f5e,
+  0x9b17, 0x4ec0, 0x9a9c, 0x4e21, 0x9a22, 0x4d81, 0x99a9, 0x4ce1,
+  0x9930, 0x4c40, 0x98b9, 0x4b9e, 0x9843, 0x4afb, 0x97ce, 0x4a58,
+  0x9759, 0x49b4, 0x96e6, 0x490f, 0x9674, 0x486a, 0x9603, 0x47c4,
+  0x9592, 0x471d, 0x9523, 0x4675, 0x94b5, 0x45cd, 0x9448, 0x4524,
+  0x93dc, 0x447b, 0x9371, 0x43d1, 0x9307, 0x4326, 0x929e, 0x427a,
+  0x9236, 0x41ce, 0x91cf, 0x4121, 0x9169, 0x4074, 0x9105, 0x3fc6,
+  0x90a1, 0x3f17, 0x903e, 0x3e68, 0x8fdd, 0x3db8, 0x8f7d, 0x3d08,
+  0x8f1d, 0x3c57, 0x8ebf, 0x3ba5, 0x8e62, 0x3af3, 0x8e06, 0x3a40,
+  0x8dab, 0x398d, 0x8d51, 0x38d9, 0x8cf8, 0x3825, 0x8ca1, 0x3770,
+  0x8c4a, 0x36ba, 0x8bf5, 0x3604, 0x8ba0, 0x354e, 0x8b4d, 0x3497,
+  0x8afb, 0x33df, 0x8aaa, 0x3327, 0x8a5a, 0x326e, 0x8a0c, 0x31b5,
+  0x89be, 0x30fc, 0x8972, 0x3042, 0x8927, 0x2f87, 0x88dd, 0x2ecc,
+  0x8894, 0x2e11, 0x884c, 0x2d55, 0x8805, 0x2c99, 0x87c0, 0x2bdc,
+  0x877b, 0x2b1f, 0x8738, 0x2a62, 0x86f6, 0x29a4, 0x86b6, 0x28e5,
+  0x8676, 0x2827, 0x8637, 0x2768, 0x85fa, 0x26a8, 0x85be, 0x25e8,
+  0x8583, 0x2528, 0x8549, 0x2467, 0x8511, 0x23a7, 0x84d9, 0x22e5,
+  0x84a3, 0x2224, 0x846e, 0x2162, 0x843a, 0x209f, 0x8407, 0x1fdd,
+  0x83d6, 0x1f1a, 0x83a6, 0x1e57, 0x8377, 0x1d93, 0x8349, 0x1cd0,
+  0x831c, 0x1c0c, 0x82f1, 0x1b47, 0x82c6, 0x1a83, 0x829d, 0x19be,
+  0x8276, 0x18f9, 0x824f, 0x1833, 0x822a, 0x176e, 0x8205, 0x16a8,
+  0x81e2, 0x15e2, 0x81c1, 0x151c, 0x81a0, 0x1455, 0x8181, 0x138f,
+  0x8163, 0x12c8, 0x8146, 0x1201, 0x812a, 0x113a, 0x8110, 0x1073,
+  0x80f6, 0xfab, 0x80de, 0xee4, 0x80c8, 0xe1c, 0x80b2, 0xd54,
+  0x809e, 0xc8c, 0x808b, 0xbc4, 0x8079, 0xafb, 0x8068, 0xa33,
+  0x8059, 0x96b, 0x804b, 0x8a2, 0x803e, 0x7d9, 0x8032, 0x711,
+  0x8027, 0x648, 0x801e, 0x57f, 0x8016, 0x4b6, 0x800f, 0x3ed,
+  0x800a, 0x324, 0x8006, 0x25b, 0x8002, 0x192, 0x8001, 0xc9,
+  0x8000, 0x0, 0x8001, 0xff37, 0x8002, 0xfe6e, 0x8006, 0xfda5,
+  0x800a, 0xfcdc, 0x800f, 0xfc13, 0x8016, 0xfb4a, 0x801e, 0xfa81,
+  0x8027, 0xf9b8, 0x8032, 0xf8ef, 0x803e, 0xf827, 0x804b, 0xf75e,
+  0x8059, 0xf695, 0x8068, 0xf5cd, 0x8079, 0xf505, 0x808b, 0xf43c,
+  0x809e, 0xf374, 0x80b2, 0xf2ac, 0x80c8, 0xf1e4, 0x80de, 0xf11c,
+  0x80f6, 0xf055, 0x8110, 0xef8d, 0x812a, 0xeec6, 0x8146, 0xedff,
+  0x8163, 0xed38, 0x8181, 0xec71, 0x81a0, 0xebab, 0x81c1, 0xeae4,
+  0x81e2, 0xea1e, 0x8205, 0xe958, 0x822a, 0xe892, 0x824f, 0xe7cd,
+  0x8276, 0xe707, 0x829d, 0xe642, 0x82c6, 0xe57d, 0x82f1, 0xe4b9,
+  0x831c, 0xe3f4, 0x8349, 0xe330, 0x8377, 0xe26d, 0x83a6, 0xe1a9,
+  0x83d6, 0xe0e6, 0x8407, 0xe023, 0x843a, 0xdf61, 0x846e, 0xde9e,
+  0x84a3, 0xdddc, 0x84d9, 0xdd1b, 0x8511, 0xdc59, 0x8549, 0xdb99,
+  0x8583, 0xdad8, 0x85be, 0xda18, 0x85fa, 0xd958, 0x8637, 0xd898,
+  0x8676, 0xd7d9, 0x86b6, 0xd71b, 0x86f6, 0xd65c, 0x8738, 0xd59e,
+  0x877b, 0xd4e1, 0x87c0, 0xd424, 0x8805, 0xd367, 0x884c, 0xd2ab,
+  0x8894, 0xd1ef, 0x88dd, 0xd134, 0x8927, 0xd079, 0x8972, 0xcfbe,
+  0x89be, 0xcf04, 0x8a0c, 0xce4b, 0x8a5a, 0xcd92, 0x8aaa, 0xccd9,
+  0x8afb, 0xcc21, 0x8b4d, 0xcb69, 0x8ba0, 0xcab2, 0x8bf5, 0xc9fc,
+  0x8c4a, 0xc946, 0x8ca1, 0xc890, 0x8cf8, 0xc7db, 0x8d51, 0xc727,
+  0x8dab, 0xc673, 0x8e06, 0xc5c0, 0x8e62, 0xc50d, 0x8ebf, 0xc45b,
+  0x8f1d, 0xc3a9, 0x8f7d, 0xc2f8, 0x8fdd, 0xc248, 0x903e, 0xc198,
+  0x90a1, 0xc0e9, 0x9105, 0xc03a, 0x9169, 0xbf8c, 0x91cf, 0xbedf,
+  0x9236, 0xbe32, 0x929e, 0xbd86, 0x9307, 0xbcda, 0x9371, 0xbc2f,
+  0x93dc, 0xbb85, 0x9448, 0xbadc, 0x94b5, 0xba33, 0x9523, 0xb98b,
+  0x9592, 0xb8e3, 0x9603, 0xb83c, 0x9674, 0xb796, 0x96e6, 0xb6f1,
+  0x9759, 0xb64c, 0x97ce, 0xb5a8, 0x9843, 0xb505, 0x98b9, 0xb462,
+  0x9930, 0xb3c0, 0x99a9, 0xb31f, 0x9a22, 0xb27f, 0x9a9c, 0xb1df,
+  0x9b17, 0xb140, 0x9b94, 0xb0a2, 0x9c11, 0xb005, 0x9c8f, 0xaf68,
+  0x9d0e, 0xaecc, 0x9d8e, 0xae31, 0x9e0f, 0xad97, 0x9e91, 0xacfd,
+  0x9f14, 0xac65, 0x9f98, 0xabcd, 0xa01c, 0xab36, 0xa0a2, 0xaaa0,
+  0xa129, 0xaa0a, 0xa1b0, 0xa976, 0xa238, 0xa8e2, 0xa2c2, 0xa84f,
+  0xa34c, 0xa7bd, 0xa3d7, 0xa72c, 0xa463, 0xa69c, 0xa4f0, 0xa60c,
+  0xa57e, 0xa57e, 0xa60c, 0xa4f0, 0xa69c, 0xa463, 0xa72c, 0xa3d7,
+  0xa7bd, 0xa34c, 0xa84f, 0xa2c2, 0xa8e2, 0xa238, 0xa976, 0xa1b0,
+  0xaa0a, 0xa129, 0xaaa0, 0xa0a2, 0xab36, 0xa01c, 0xabcd, 0x9f98,
+  0xac65, 0x9f14, 0xacfd, 0x9e91, 0xad97, 0x9e0f, 0xae31, 0x9d8e,
+  0xaecc, 0x9d0e, 0xaf68, 0x9c8f, 0xb005, 0x9c11, 0xb0a2, 0x9b94,
+  0xb140, 0x9b17, 0xb1df, 0x9a9c, 0xb27f, 0x9a22, 0xb31f, 0x99a9,
+  0xb3c0, 0x9930, 0xb462, 0x98b9, 0xb505, 0x9843, 0xb5a8, 0x97ce,
+  0xb64c, 0x9759, 0xb6f1, 0x96e6, 0xb796, 0x9674, 0xb83c, 0x9603,
+  0xb8e3, 0x9592, 0xb98b, 0x9523, 0xba33, 0x94b5, 0xbadc, 0x9448,
+  0xbb85, 0x93dc, 0xbc2f, 0x9371, 0xbcda, 0x9307, 0xbd86, 0x929e,
+  0xbe32, 0x9236, 0xbedf, 0x91cf, 0xbf8c, 0x9169, 0xc03a, 0x9105,
+  0xc0e9, 0x90a1, 0xc198, 0x903e, 0xc248, 0x8fdd, 0xc2f8, 0x8f7d,
+  0xc3a9, 0x8f1d, 0xc45b, 0x8ebf, 0xc50d, 0x8e62, 0xc5c0, 0x8e06,
+  0xc673, 0x8dab, 0xc727, 0x8d51, 0xc7db, 0x8cf8, 0xc890, 0x8ca1,
+  0xc946, 0x8c4a, 0xc9fc, 0x8bf5, 0xcab2, 0x8ba0, 0xcb69, 0x8b4d,
+  0xcc21, 0x8afb, 0xccd9, 0x8aaa, 0xcd92, 0x8a5a, 0xce4b, 0x8a0c,
+  0xcf04, 0x89be, 0xcfbe, 0x8972, 0xd079, 0x8927, 0xd134, 0x88dd,
+  0xd1ef, 0x8894, 0xd2ab, 0x884c, 0xd367, 0x8805, 0xd424, 0x87c0,
+  0xd4e1, 0x877b, 0xd59e, 0x8738, 0xd65c, 0x86f6, 0xd71b, 0x86b6,
+  0xd7d9, 0x8676, 0xd898, 0x8637, 0xd958, 0x85fa, 0xda18, 0x85be,
+  0xdad8, 0x8583, 0xdb99, 0x8549, 0xdc59, 0x8511, 0xdd1b, 0x84d9,
+  0xdddc, 0x84a3, 0xde9e, 0x846e, 0xdf61, 0x843a, 0xe023, 0x8407,
+  0xe0e6, 0x83d6, 0xe1a9, 0x83a6, 0xe26d, 0x8377, 0xe330, 0x8349,
+  0xe3f4, 0x831c, 0xe4b9, 0x82f1, 0xe57d, 0x82c6, 0xe642, 0x829d,
+  0xe707, 0x8276, 0xe7cd, 0x824f, 0xe892, 0x822a, 0xe958, 0x8205,
+  0xea1e, 0x81e2, 0xeae4, 0x81c1, 0xebab, 0x81a0, 0xec71, 0x8181,
+  0xed38, 0x8163, 0xedff, 0x8146, 0xeec6, 0x812a, 0xef8d, 0x8110,
+  0xf055, 0x80f6, 0xf11c, 0x80de, 0xf1e4, 0x80c8, 0xf2ac, 0x80b2,
+  0xf374, 0x809e, 0xf43c, 0x808b, 0xf505, 0x8079, 0xf5cd, 0x8068,
+  0xf695, 0x8059, 0xf75e, 0x804b, 0xf827, 0x803e, 0xf8ef, 0x8032,
+  0xf9b8, 0x8027, 0xfa81, 0x801e, 0xfb4a, 0x8016, 0xfc13, 0x800f,
+  0xfcdc, 0x800a, 0xfda5, 0x8006, 0xfe6e, 0x8002, 0xff37, 0x8001
+};
+
+const q15_t ALIGN4 twiddleCoef_2048_q15[3072] = {
+  0x7fff, 0x0, 0x7fff, 0x65, 0x7fff, 0xc9, 0x7fff, 0x12e,
+  0x7ffe, 0x192, 0x7ffc, 0x1f7, 0x7ffa, 0x25b, 0x7ff8, 0x2c0,
+  0x7ff6, 0x324, 0x7ff4, 0x389, 0x7ff1, 0x3ed, 0x7fed, 0x452,
+  0x7fea, 0x4b6, 0x7fe6, 0x51b, 0x7fe2, 0x57f, 0x7fdd, 0x5e3,
+  0x7fd9, 0x648, 0x7fd3, 0x6ac, 0x7fce, 0x711, 0x7fc8, 0x775,
+  0x7fc2, 0x7d9, 0x7fbc, 0x83e, 0x7fb5, 0x8a2, 0x7fae, 0x906,
+  0x7fa7, 0x96b, 0x7fa0, 0x9cf, 0x7f98, 0xa33, 0x7f90, 0xa97,
+  0x7f87, 0xafb, 0x7f7e, 0xb60, 0x7f75, 0xbc4, 0x7f6c, 0xc28,
+  0x7f62, 0xc8c, 0x7f58, 0xcf0, 0x7f4e, 0xd54, 0x7f43, 0xdb8,
+  0x7f38, 0xe1c, 0x7f2d, 0xe80, 0x7f22, 0xee4, 0x7f16, 0xf47,
+  0x7f0a, 0xfab, 0x7efd, 0x100f, 0x7ef0, 0x1073, 0x7ee3, 0x10d6,
+  0x7ed6, 0x113a, 0x7ec8, 0x119e, 0x7eba, 0x1201, 0x7eac, 0x1265,
+  0x7e9d, 0x12c8, 0x7e8e, 0x132b, 0x7e7f, 0x138f, 0x7e70, 0x13f2,
+  0x7e60, 0x1455, 0x7e50, 0x14b9, 0x7e3f, 0x151c, 0x7e2f, 0x157f,
+  0x7e1e, 0x15e2, 0x7e0c, 0x1645, 0x7dfb, 0x16a8, 0x7de9, 0x170b,
+  0x7dd6, 0x176e, 0x7dc4, 0x17d1, 0x7db1, 0x1833, 0x7d9e, 0x1896,
+  0x7d8a, 0x18f9, 0x7d77, 0x195b, 0x7d63, 0x19be, 0x7d4e, 0x1a20,
+  0x7d3a, 0x1a83, 0x7d25, 0x1ae5, 0x7d0f, 0x1b47, 0x7cfa, 0x1ba9,
+  0x7ce4, 0x1c0c, 0x7cce, 0x1c6e, 0x7cb7, 0x1cd0, 0x7ca0, 0x1d31,
+  0x7c89, 0x1d93, 0x7c72, 0x1df5, 0x7c5a, 0x1e57, 0x7c42, 0x1eb8,
+  0x7c2a, 0x1f1a, 0x7c11, 0x1f7b, 0x7bf9, 0x1fdd, 0x7bdf, 0x203e,
+  0x7bc6, 0x209f, 0x7bac, 0x2101, 0x7b92, 0x2162, 0x7b78, 0x21c3,
+  0x7b5d, 0x2224, 0x7b42, 0x2284, 0x7b27, 0x22e5, 0x7b0b, 0x2346,
+  0x7aef, 0x23a7, 0x7ad3, 0x2407, 0x7ab7, 0x2467, 0x7a9a, 0x24c8,
+  0x7a7d, 0x2528, 0x7a60, 0x2588, 0x7a42, 0x25e8, 0x7a24, 0x2648,
+  0x7a06, 0x26a8, 0x79e7, 0x2708, 0x79c9, 0x2768, 0x79aa, 0x27c7,
+  0x798a, 0x2827, 0x796a, 0x2886, 0x794a, 0x28e5, 0x792a, 0x2945,
+  0x790a, 0x29a4, 0x78e9, 0x2a03, 0x78c8, 0x2a62, 0x78a6, 0x2ac1,
+  0x7885, 0x2b1f, 0x7863, 0x2b7e, 0x7840, 0x2bdc, 0x781e, 0x2c3b,
+  0x77fb, 0x2c99, 0x77d8, 0x2cf7, 0x77b4, 0x2d55, 0x7790, 0x2db3,
+  0x776c, 0x2e11, 0x7748, 0x2e6f, 0x7723, 0x2ecc, 0x76fe, 0x2f2a,
+  0x76d9, 0x2f87, 0x76b4, 0x2fe5, 0x768e, 0x3042, 0x7668, 0x309f,
+  0x7642, 0x30fc, 0x761b, 0x3159, 0x75f4, 0x31b5, 0x75cd, 0x3212,
+  0x75a6, 0x326e, 0x757e, 0x32cb, 0x7556, 0x3327, 0x752d, 0x3383,
+  0x7505, 0x33df, 0x74dc, 0x343b, 0x74b3, 0x3497, 0x7489, 0x34f2,
+  0x7460, 0x354e, 0x7436, 0x35a9, 0x740b, 0x3604, 0x73e1, 0x365f,
+  0x73b6, 0x36ba, 0x738b, 0x3715, 0x735f, 0x3770, 0x7334, 0x37ca,
+  0x7308, 0x3825, 0x72dc, 0x387f, 0x72af, 0x38d9, 0x7282, 0x3933,
+  0x7255, 0x398d, 0x7228, 0x39e7, 0x71fa, 0x3a40, 0x71cc, 0x3a9a,
+  0x719e, 0x3af3, 0x7170, 0x3b4c, 0x7141, 0x3ba5, 0x7112, 0x3bfe,
+  0x70e3, 0x3c57, 0x70b3, 0x3caf, 0x7083, 0x3d08, 0x7053, 0x3d60,
+  0x7023, 0x3db8, 0x6ff2, 0x3e10, 0x6fc2, 0x3e68, 0x6f90, 0x3ec0,
+  0x6f5f, 0x3f17, 0x6f2d, 0x3f6f, 0x6efb, 0x3fc6, 0x6ec9, 0x401d,
+  0x6e97, 0x4074, 0x6e64, 0x40cb, 0x6e31, 0x4121, 0x6dfe, 0x4178,
+  0x6dca, 0x41ce, 0x6d96, 0x4224, 0x6d62, 0x427a, 0x6d2e, 0x42d0,
+  0x6cf9, 0x4326, 0x6cc4, 0x437b, 0x6c8f, 0x43d1, 0x6c5a, 0x4426,
+  0x6c24, 0x447b, 0x6bee, 0x44d0, 0x6bb8, 0x4524, 0x6b82, 0x4579,
+  0x6b4b, 0x45cd, 0x6b14, 0x4621, 0x6add, 0x4675, 0x6aa5, 0x46c9,
+  0x6a6e, 0x471d, 0x6a36, 0x4770, 0x69fd, 0x47c4, 0x69c5, 0x4817,
+  0x698c, 0x486a, 0x6953, 0x48bd, 0x691a, 0x490f, 0x68e0, 0x4962,
+  0x68a7, 0x49b4, 0x686d, 0x4a06, 0x6832, 0x4a58, 0x67f8, 0x4aaa,
+  0x67bd, 0x4afb, 0x6782, 0x4b4d, 0x6747, 0x4b9e, 0x670b, 0x4bef,
+  0x66d0, 0x4c40, 0x6693, 0x4c91, 0x6657, 0x4ce1, 0x661b, 0x4d31,
+  0x65de, 0x4d81, 0x65a1, 0x4dd1, 0x6564, 0x4e21, 0x6526, 0x4e71,
+  0x64e9, 0x4ec0, 0x64ab, 0x4f0f, 0x646c, 0x4f5e, 0x642e, 0x4fad,
+  0x63ef, 0x4ffb, 0x63b0, 0x504a, 0x6371, 0x5098, 0x6332, 0x50e6,
+  0x62f2, 0x5134, 0x62b2, 0x5181, 0x6272, 0x51cf, 0x6232, 0x521c,
+  0x61f1, 0x5269, 0x61b0, 0x52b6, 0x616f, 0x5303, 0x612e, 0x534f,
+  0x60ec, 0x539b, 0x60aa, 0x53e7, 0x6068, 0x5433, 0x6026, 0x547f,
+  0x5fe4, 0x54ca, 0x5fa1, 0x5515, 0x5f5e, 0x5560, 0x5f1b, 0x55ab,
+  0x5ed7, 0x55f6, 0x5e94, 0x5640, 0x5e50, 0x568a, 0x5e0c, 0x56d4,
+  0x5dc8, 0x571e, 0x5d83, 0x5767, 0x5d3e, 0x57b1, 0x5cf9, 0x57fa,
+  0x5cb4, 0x5843, 0x5c6f, 0x588c, 0x5c29, 0x58d4, 0x5be3, 0x591c,
+  0x5b9d, 0x5964, 0x5b57, 0x59ac, 0x5b10, 0x59f4, 0x5ac9, 0x5a3b,
+  0x5a82, 0x5a82, 0x5a3b, 0x5ac9, 0x59f4, 0x5b10, 0x59ac, 0x5b57,
+  0x5964, 0x5b9d, 0x591c, 0x5be3, 0x58d4, 0x5c29, 0x588c, 0x5c6f,
+  0x5843, 0x5cb4, 0x57fa, 0x5cf9, 0x57b1, 0x5d3e, 0x5767, 0x5d83,
+  0x571e, 0x5dc8, 0x56d4, 0x5e0c, 0x568a, 0x5e50, 0x5640, 0x5e94,
+  0x55f6, 0x5ed7, 0x55ab, 0x5f1b, 0x5560, 0x5f5e, 0x5515, 0x5fa1,
+  0x54ca, 0x5fe4, 0x547f, 0x6026, 0x5433, 0x6068, 0x53e7, 0x60aa,
+  0x539b, 0x60ec, 0x534f, 0x612e, 0x5303, 0x616f, 0x52b6, 0x61b0,
+  0x5269, 0x61f1, 0x521c, 0x6232, 0x51cf, 0x6272, 0x5181, 0x62b2,
+  0x5134, 0x62f2, 0x50e6, 0x6332, 0x5098, 0x6371, 0x504a, 0x63b0,
+  0x4ffb, 0x63ef, 0x4fad, 0x642e, 0x4f5e, 0x646c, 0x4f0f, 0x64ab,
+  0x4ec0, 0x64e9, 0x4e71, 0x6526, 0x4e21, 0x6564, 0x4dd1, 0x65a1,
+  0x4d81, 0x65de, 0x4d31, 0x661b, 0x4ce1, 0x6657, 0x4c91, 0x6693,
+  0x4c40, 0x66d0, 0x4bef, 0x670b, 0x4b9e, 0x6747, 0x4b4d, 0x6782,
+  0x4afb, 0x67bd, 0x4aaa, 0x67f8, 0x4a58, 0x6832, 0x4a06, 0x686d,
+  0x49b4, 0x68a7, 0x4962, 0x68e0, 0x490f, 0x691a, 0x48bd, 0x6953,
+  0x486a, 0x698c, 0x4817, 0x69c5, 0x47c4, 0x69fd, 0x4770, 0x6a36,
+  0x471d, 0x6a6e, 0x46c9, 0x6aa5, 0x4675, 0x6add, 0x4621, 0x6b14,
+  0x45cd, 0x6b4b, 0x4579, 0x6b82, 0x4524, 0x6bb8, 0x44d0, 0x6bee,
+  0x447b, 0x6c24, 0x4426, 0x6c5a, 0x43d1, 0x6c8f, 0x437b, 0x6cc4,
+  0x4326, 0x6cf9, 0x42d0, 0x6d2e, 0x427a, 0x6d62, 0x4224, 0x6d96,
+  0x41ce, 0x6dca, 0x4178, 0x6dfe, 0x4121, 0x6e31, 0x40cb, 0x6e64,
+  0x4074, 0x6e97, 0x401d, 0x6ec9, 0x3fc6, 0x6efb, 0x3f6f, 0x6f2d,
+  0x3f17, 0x6f5f, 0x3ec0, 0x6f90, 0x3e68, 0x6fc2, 0x3e10, 0x6ff2,
+  0x3db8, 0x7023, 0x3d60, 0x7053, 0x3d08, 0x7083, 0x3caf, 0x70b3,
+  0x3c57, 0x70e3, 0x3bfe, 0x7112, 0x3ba5, 0x7141, 0x3b4c, 0x7170,
+  0x3af3, 0x719e, 0x3a9a, 0x71cc, 0x3a40, 0x71fa, 0x39e7, 0x7228,
+  0x398d, 0x7255, 0x3933, 0x7282, 0x38d9, 0x72af, 0x387f, 0x72dc,
+  0x3825, 0x7308, 0x37ca, 0x7334, 0x3770, 0x735f, 0x3715, 0x738b,
+  0x36ba, 0x73b6, 0x365f, 0x73e1, 0x3604, 0x740b, 0x35a9, 0x7436,
+  0x354e, 0x7460, 0x34f2, 0x7489, 0x3497, 0x74b3, 0x343b, 0x74dc,
+  0x33df, 0x7505, 0x3383, 0x752d, 0x3327, 0x7556, 0x32cb, 0x757e,
+  0x326e, 0x75a6, 0x3212, 0x75cd, 0x31b5, 0x75f4, 0x3159, 0x761b,
+  0x30fc, 0x7642, 0x309f, 0x7668, 0x3042, 0x768e, 0x2fe5, 0x76b4,
+  0x2f87, 0x76d9, 0x2f2a, 0x76fe, 0x2ecc, 0x7723, 0x2e6f, 0x7748,
+  0x2e11, 0x776c, 0x2db3, 0x7790, 0x2d55, 0x77b4, 0x2cf7, 0x77d8,
+  0x2c99, 0x77fb, 0x2c3b, 0x781e, 0x2bdc, 0x7840, 0x2b7e, 0x7863,
+  0x2b1f, 0x7885, 0x2ac1, 0x78a6, 0x2a62, 0x78c8, 0x2a03, 0x78e9,
+  0x29a4, 0x790a, 0x2945, 0x792a, 0x28e5, 0x794a, 0x2886, 0x796a,
+  0x2827, 0x798a, 0x27c7, 0x79aa, 0x2768, 0x79c9, 0x2708, 0x79e7,
+  0x26a8, 0x7a06, 0x2648, 0x7a24, 0x25e8, 0x7a42, 0x2588, 0x7a60,
+  0x2528, 0x7a7d, 0x24c8, 0x7a9a, 0x2467, 0x7ab7, 0x2407, 0x7ad3,
+  0x23a7, 0x7aef, 0x2346, 0x7b0b, 0x22e5, 0x7b27, 0x2284, 0x7b42,
+  0x2224, 0x7b5d, 0x21c3, 0x7b78, 0x2162, 0x7b92, 0x2101, 0x7bac,
+  0x209f, 0x7bc6, 0x203e, 0x7bdf, 0x1fdd, 0x7bf9, 0x1f7b, 0x7c11,
+  0x1f1a, 0x7c2a, 0x1eb8, 0x7c42, 0x1e57, 0x7c5a, 0x1df5, 0x7c72,
+  0x1d93, 0x7c89, 0x1d31, 0x7ca0, 0x1cd0, 0x7cb7, 0x1c6e, 0x7cce,
+  0x1c0c, 0x7ce4, 0x1ba9, 0x7cfa, 0x1b47, 0x7d0f, 0x1ae5, 0x7d25,
+  0x1a83, 0x7d3a, 0x1a20, 0x7d4e, 0x19be, 0x7d63, 0x195b, 0x7d77,
+  0x18f9, 0x7d8a, 0x1896, 0x7d9e, 0x1833, 0x7db1, 0x17d1, 0x7dc4,
+  0x176e, 0x7dd6, 0x170b, 0x7de9, 0x16a8, 0x7dfb, 0x1645, 0x7e0c,
+  0x15e2, 0x7e1e, 0x157f, 0x7e2f, 0x151c, 0x7e3f, 0x14b9, 0x7e50,
+  0x1455, 0x7e60, 0x13f2, 0x7e70, 0x138f, 0x7e7f, 0x132b, 0x7e8e,
+  0x12c8, 0x7e9d, 0x1265, 0x7eac, 0x1201, 0x7eba, 0x119e, 0x7ec8,
+  0x113a, 0x7ed6, 0x10d6, 0x7ee3, 0x1073, 0x7ef0, 0x100f, 0x7efd,
+  0xfab, 0x7f0a, 0xf47, 0x7f16, 0xee4, 0x7f22, 0xe80, 0x7f2d,
+  0xe1c, 0x7f38, 0xdb8, 0x7f43, 0xd54, 0x7f4e, 0xcf0, 0x7f58,
+  0xc8c, 0x7f62, 0xc28, 0x7f6c, 0xbc4, 0x7f75, 0xb60, 0x7f7e,
+  0xafb, 0x7f87, 0xa97, 0x7f90, 0xa33, 0x7f98, 0x9cf, 0x7fa0,
+  0x96b, 0x7fa7, 0x906, 0x7fae, 0x8a2, 0x7fb5, 0x83e, 0x7fbc,
+  0x7d9, 0x7fc2, 0x775, 0x7fc8, 0x711, 0x7fce, 0x6ac, 0x7fd3,
+  0x648, 0x7fd9, 0x5e3, 0x7fdd, 0x57f, 0x7fe2, 0x51b, 0x7fe6,
+  0x4b6, 0x7fea, 0x452, 0x7fed, 0x3ed, 0x7ff1, 0x389, 0x7ff4,
+  0x324, 0x7ff6, 0x2c0, 0x7ff8, 0x25b, 0x7ffa, 0x1f7, 0x7ffc,
+  0x192, 0x7ffe, 0x12e, 0x7fff, 0xc9, 0x7fff, 0x65, 0x7fff,
+  0x0, 0x7fff, 0xff9b, 0x7fff, 0xff37, 0x7fff, 0xfed2, 0x7fff,
+  0xfe6e, 0x7ffe, 0xfe09, 0x7ffc, 0xfda5, 0x7ffa, 0xfd40, 0x7ff8,
+  0xfcdc, 0x7ff6, 0xfc77, 0x7ff4, 0xfc13, 0x7ff1, 0xfbae, 0x7fed,
+  0xfb4a, 0x7fea, 0xfae5, 0x7fe6, 0xfa81, 0x7fe2, 0xfa1d, 0x7fdd,
+  0xf9b8, 0x7fd9, 0xf954, 0x7fd3, 0xf8ef, 0x7fce, 0xf88b, 0x7fc8,
+  0xf827, 0x7fc2, 0xf7c2, 0x7fbc, 0xf75e, 0x7fb5, 0xf6fa, 0x7fae,
+  0xf695, 0x7fa7, 0xf631, 0x7fa0, 0xf5cd, 0x7f98, 0xf569, 0x7f90,
+  0xf505, 0x7f87, 0xf4a0, 0x7f7e, 0xf43c, 0x7f75, 0xf3d8, 0x7f6c,
+  0xf374, 0x7f62, 0xf310, 0x7f58, 0xf2ac, 0x7f4e, 0xf248, 0x7f43,
+  0xf1e4, 0x7f38, 0xf180, 0x7f2d, 0xf11c, 0x7f22, 0xf0b9, 0x7f16,
+  0xf055, 0x7f0a, 0xeff1, 0x7efd, 0xef8d, 0x7ef0, 0xef2a, 0x7ee3,
+  0xeec6, 0x7ed6, 0xee62, 0x7ec8, 0xedff, 0x7eba, 0xed9b, 0x7eac,
+  0xed38, 0x7e9d, 0xecd5, 0x7e8e, 0xec71, 0x7e7f, 0xec0e, 0x7e70,
+  0xebab, 0x7e60, 0xeb47, 0x7e50, 0xeae4, 0x7e3f, 0xea81, 0x7e2f,
+  0xea1e, 0x7e1e, 0xe9bb, 0x7e0c, 0xe958, 0x7dfb, 0xe8f5, 0x7de9,
+  0xe892, 0x7dd6, 0xe82f, 0x7dc4, 0xe7cd, 0x7db1, 0xe76a, 0x7d9e,
+  0xe707, 0x7d8a, 0xe6a5, 0x7d77, 0xe642, 0x7d63, 0xe5e0, 0x7d4e,
+  0xe57d, 0x7d3a, 0xe51b, 0x7d25, 0xe4b9, 0x7d0f, 0xe457, 0x7cfa,
+  0xe3f4, 0x7ce4, 0xe392, 0x7cce, 0xe330, 0x7cb7, 0xe2cf, 0x7ca0,
+  0xe26d, 0x7c89, 0xe20b, 0x7c72, 0xe1a9, 0x7c5a, 0xe148, 0x7c42,
+  0xe0e6, 0x7c2a, 0xe085, 0x7c11, 0xe023, 0x7bf9, 0xdfc2, 0x7bdf,
+  0xdf61, 0x7bc6, 0xdeff, 0x7bac, 0xde9e, 0x7b92, 0xde3d, 0x7b78,
+  0xdddc, 0x7b5d, 0xdd7c, 0x7b42, 0xdd1b, 0x7b27, 0xdcba, 0x7b0b,
+  0xdc59, 0x7aef, 0xdbf9, 0x7ad3, 0xdb99, 0x7ab7, 0xdb38, 0x7a9a,
+  0xdad8, 0x7a7d, 0xda78, 0x7a60, 0xda18, 0x7a42, 0xd9b8, 0x7a24,
+  0xd958, 0x7a06, 0xd8f8, 0x79e7, 0xd898, 0x79c9, 0xd839, 0x79aa,
+  0xd7d9, 0x798a, 0xd77a, 0x796a, 0xd71b, 0x794a, 0xd6bb, 0x792a,
+  0xd65c, 0x790a, 0xd5fd, 0x78e9, 0xd59e, 0x78c8, 0xd53f, 0x78a6,
+  0xd4e1, 0x7885, 0xd482, 0x7863, 0xd424, 0x7840, 0xd3c5, 0x781e,
+  0xd367, 0x77fb, 0xd309, 0x77d8, 0xd2ab, 0x77b4, 0xd24d, 0x7790,
+  0xd1ef, 0x776c, 0xd191, 0x7748, 0xd134, 0x7723, 0xd0d6, 0x76fe,
+  0xd079, 0x76d9, 0xd01b, 0x76b4, 0xcfbe, 0x768e, 0xcf61, 0x7668,
+  0xcf04, 0x7642, 0xcea7, 0x761b, 0xce4b, 0x75f4, 0xcdee, 0x75cd,
+  0xcd92, 0x75a6, 0xcd35, 0x757e, 0xccd9, 0x7556, 0xcc7d, 0x752d,
+  0xcc21, 0x7505, 0xcbc5, 0x74dc, 0xcb69, 0x74b3, 0xcb0e, 0x7489,
+  0xcab2, 0x7460, 0xca57, 0x7436, 0xc9fc, 0x740b, 0xc9a1, 0x73e1,
+  0xc946, 0x73b6, 0xc8eb, 0x738b, 0xc890, 0x735f, 0xc836, 0x7334,
+  0xc7db, 0x7308, 0xc781, 0x72dc, 0xc727, 0x72af, 0xc6cd, 0x7282,
+  0xc673, 0x7255, 0xc619, 0x7228, 0xc5c0, 0x71fa, 0xc566, 0x71cc,
+  0xc50d, 0x719e, 0xc4b4, 0x7170, 0xc45b, 0x7141, 0xc402, 0x7112,
+  0xc3a9, 0x70e3, 0xc351, 0x70b3, 0xc2f8, 0x7083, 0xc2a0, 0x7053,
+  0xc248, 0x7023, 0xc1f0, 0x6ff2, 0xc198, 0x6fc2, 0xc140, 0x6f90,
+  0xc0e9, 0x6f5f, 0xc091, 0x6f2d, 0xc03a, 0x6efb, 0xbfe3, 0x6ec9,
+  0xbf8c, 0x6e97, 0xbf35, 0x6e64, 0xbedf, 0x6e31, 0xbe88, 0x6dfe,
+  0xbe32, 0x6dca, 0xbddc, 0x6d96, 0xbd86, 0x6d62, 0xbd30, 0x6d2e,
+  0xbcda, 0x6cf9, 0xbc85, 0x6cc4, 0xbc2f, 0x6c8f, 0xbbda, 0x6c5a,
+  0xbb85, 0x6c24, 0xbb30, 0x6bee, 0xbadc, 0x6bb8, 0xba87, 0x6b82,
+  0xba33, 0x6b4b, 0xb9df, 0x6b14, 0xb98b, 0x6add, 0xb937, 0x6aa5,
+  0xb8e3, 0x6a6e, 0xb890, 0x6a36, 0xb83c, 0x69fd, 0xb7e9, 0x69c5,
+  0xb796, 0x698c, 0xb743, 0x6953, 0xb6f1, 0x691a, 0xb69e, 0x68e0,
+  0xb64c, 0x68a7, 0xb5fa, 0x686d, 0xb5a8, 0x6832, 0xb556, 0x67f8,
+  0xb505, 0x67bd, 0xb4b3, 0x6782, 0xb462, 0x6747, 0xb411, 0x670b,
+  0xb3c0, 0x66d0, 0xb36f, 0x6693, 0xb31f, 0x6657, 0xb2cf, 0x661b,
+  0xb27f, 0x65de, 0xb22f, 0x65a1, 0xb1df, 0x6564, 0xb18f, 0x6526,
+  0xb140, 0x64e9, 0xb0f1, 0x64ab, 0xb0a2, 0x646c, 0xb053, 0x642e,
+  0xb005, 0x63ef, 0xafb6, 0x63b0, 0xaf68, 0x6371, 0xaf1a, 0x6332,
+  0xaecc, 0x62f2, 0xae7f, 0x62b2, 0xae31, 0x6272, 0xade4, 0x6232,
+  0xad97, 0x61f1, 0xad4a, 0x61b0, 0xacfd, 0x616f, 0xacb1, 0x612e,
+  0xac65, 0x60ec, 0xac19, 0x60aa, 0xabcd, 0x6068, 0xab81, 0x6026,
+  0xab36, 0x5fe4, 0xaaeb, 0x5fa1, 0xaaa0, 0x5f5e, 0xaa55, 0x5f1b,
+  0xaa0a, 0x5ed7, 0xa9c0, 0x5e94, 0xa976, 0x5e50, 0xa92c, 0x5e0c,
+  0xa8e2, 0x5dc8, 0xa899, 0x5d83, 0xa84f, 0x5d3e, 0xa806, 0x5cf9,
+  0xa7bd, 0x5cb4, 0xa774, 0x5c6f, 0xa72c, 0x5c29, 0xa6e4, 0x5be3,
+  0xa69c, 0x5b9d, 0xa654, 0x5b57, 0xa60c, 0x5b10, 0xa5c5, 0x5ac9,
+  0xa57e, 0x5a82, 0xa537, 0x5a3b, 0xa4f0, 0x59f4, 0xa4a9, 0x59ac,
+  0xa463, 0x5964, 0xa41d, 0x591c, 0xa3d7, 0x58d4, 0xa391, 0x588c,
+  0xa34c, 0x5843, 0xa307, 0x57fa, 0xa2c2, 0x57b1, 0xa27d, 0x5767,
+  0xa238, 0x571e, 0xa1f4, 0x56d4, 0xa1b0, 0x568a, 0xa16c, 0x5640,
+  0xa129, 0x55f6, 0xa0e5, 0x55ab, 0xa0a2, 0x5560, 0xa05f, 0x5515,
+  0xa01c, 0x54ca, 0x9fda, 0x547f, 0x9f98, 0x5433, 0x9f56, 0x53e7,
+  0x9f14, 0x539b, 0x9ed2, 0x534f, 0x9e91, 0x5303, 0x9e50, 0x52b6,
+  0x9e0f, 0x5269, 0x9dce, 0x521c, 0x9d8e, 0x51cf, 0x9d4e, 0x5181,
+  0x9d0e, 0x5134, 0x9cce, 0x50e6, 0x9c8f, 0x5098, 0x9c50, 0x504a,
+  0x9c11, 0x4ffb, 0x9bd2, 0x4fad, 0x9b94, 0x4f5e, 0x9b55, 0x4f0f,
+  0x9b17, 0x4ec0, 0x9ada, 0x4e71, 0x9a9c, 0x4e21, 0x9a5f, 0x4dd1,
+  0x9a22, 0x4d81, 0x99e5, 0x4d31, 0x99a9, 0x4ce1, 0x996d, 0x4c91,
+  0x9930, 0x4c40, 0x98f5, 0x4bef, 0x98b9, 0x4b9e, 0x987e, 0x4b4d,
+  0x9843, 0x4afb, 0x9808, 0x4aaa, 0x97ce, 0x4a58, 0x9793, 0x4a06,
+  0x9759, 0x49b4, 0x9720, 0x4962, 0x96e6, 0x490f, 0x96ad, 0x48bd,
+  0x9674, 0x486a, 0x963b, 0x4817, 0x9603, 0x47c4, 0x95ca, 0x4770,
+  0x9592, 0x471d, 0x955b, 0x46c9, 0x9523, 0x4675, 0x94ec, 0x4621,
+  0x94b5, 0x45cd, 0x947e, 0x4579, 0x9448, 0x4524, 0x9412, 0x44d0,
+  0x93dc, 0x447b, 0x93a6, 0x4426, 0x9371, 0x43d1, 0x933c, 0x437b,
+  0x9307, 0x4326, 0x92d2, 0x42d0, 0x929e, 0x427a, 0x926a, 0x4224,
+  0x9236, 0x41ce, 0x9202, 0x4178, 0x91cf, 0x4121, 0x919c, 0x40cb,
+  0x9169, 0x4074, 0x9137, 0x401d, 0x9105, 0x3fc6, 0x90d3, 0x3f6f,
+  0x90a1, 0x3f17, 0x9070, 0x3ec0, 0x903e, 0x3e68, 0x900e, 0x3e10,
+  0x8fdd, 0x3db8, 0x8fad, 0x3d60, 0x8f7d, 0x3d08, 0x8f4d, 0x3caf,
+  0x8f1d, 0x3c57, 0x8eee, 0x3bfe, 0x8ebf, 0x3ba5, 0x8e90, 0x3b4c,
+  0x8e62, 0x3af3, 0x8e34, 0x3a9a, 0x8e06, 0x3a40, 0x8dd8, 0x39e7,
+  0x8dab, 0x398d, 0x8d7e, 0x3933, 0x8d51, 0x38d9, 0x8d24, 0x387f,
+  0x8cf8, 0x3825, 0x8ccc, 0x37ca, 0x8ca1, 0x3770, 0x8c75, 0x3715,
+  0x8c4a, 0x36ba, 0x8c1f, 0x365f, 0x8bf5, 0x3604, 0x8bca, 0x35a9,
+  0x8ba0, 0x354e, 0x8b77, 0x34f2, 0x8b4d, 0x3497, 0x8b24, 0x343b,
+  0x8afb, 0x33df, 0x8ad3, 0x3383, 0x8aaa, 0x3327, 0x8a82, 0x32cb,
+  0x8a5a, 0x326e, 0x8a33, 0x3212, 0x8a0c, 0x31b5, 0x89e5, 0x3159,
+  0x89be, 0x30fc, 0x8998, 0x309f, 0x8972, 0x3042, 0x894c, 0x2fe5,
+  0x8927, 0x2f87, 0x8902, 0x2f2a, 0x88dd, 0x2ecc, 0x88b8, 0x2e6f,
+  0x8894, 0x2e11, 0x8870, 0x2db3, 0x884c, 0x2d55, 0x8828, 0x2cf7,
+  0x8805, 0x2c99, 0x87e2, 0x2c3b, 0x87c0, 0x2bdc, 0x879d, 0x2b7e,
+  0x877b, 0x2b1f, 0x875a, 0x2ac1, 0x8738, 0x2a62, 0x8717, 0x2a03,
+  0x86f6, 0x29a4, 0x86d6, 0x2945, 0x86b6, 0x28e5, 0x8696, 0x2886,
+  0x8676, 0x2827, 0x8656, 0x27c7, 0x8637, 0x2768, 0x8619, 0x2708,
+  0x85fa, 0x26a8, 0x85dc, 0x2648, 0x85be, 0x25e8, 0x85a0, 0x2588,
+  0x8583, 0x2528, 0x8566, 0x24c8, 0x8549, 0x2467, 0x852d, 0x2407,
+  0x8511, 0x23a7, 0x84f5, 0x2346, 0x84d9, 0x22e5, 0x84be, 0x2284,
+  0x84a3, 0x2224, 0x8488, 0x21c3, 0x846e, 0x2162, 0x8454, 0x2101,
+  0x843a, 0x209f, 0x8421, 0x203e, 0x8407, 0x1fdd, 0x83ef, 0x1f7b,
+  0x83d6, 0x1f1a, 0x83be, 0x1eb8, 0x83a6, 0x1e57, 0x838e, 0x1df5,
+  0x8377, 0x1d93, 0x8360, 0x1d31, 0x8349, 0x1cd0, 0x8332, 0x1c6e,
+  0x831c, 0x1c0c, 0x8306, 0x1ba9, 0x82f1, 0x1b47, 0x82db, 0x1ae5,
+  0x82c6, 0x1a83, 0x82b2, 0x1a20, 0x829d, 0x19be, 0x8289, 0x195b,
+  0x8276, 0x18f9, 0x8262, 0x1896, 0x824f, 0x1833, 0x823c, 0x17d1,
+  0x822a, 0x176e, 0x8217, 0x170b, 0x8205, 0x16a8, 0x81f4, 0x1645,
+  0x81e2, 0x15e2, 0x81d1, 0x157f, 0x81c1, 0x151c, 0x81b0, 0x14b9,
+  0x81a0, 0x1455, 0x8190, 0x13f2, 0x8181, 0x138f, 0x8172, 0x132b,
+  0x8163, 0x12c8, 0x8154, 0x1265, 0x8146, 0x1201, 0x8138, 0x119e,
+  0x812a, 0x113a, 0x811d, 0x10d6, 0x8110, 0x1073, 0x8103, 0x100f,
+  0x80f6, 0xfab, 0x80ea, 0xf47, 0x80de, 0xee4, 0x80d3, 0xe80,
+  0x80c8, 0xe1c, 0x80bd, 0xdb8, 0x80b2, 0xd54, 0x80a8, 0xcf0,
+  0x809e, 0xc8c, 0x8094, 0xc28, 0x808b, 0xbc4, 0x8082, 0xb60,
+  0x8079, 0xafb, 0x8070, 0xa97, 0x8068, 0xa33, 0x8060, 0x9cf,
+  0x8059, 0x96b, 0x8052, 0x906, 0x804b, 0x8a2, 0x8044, 0x83e,
+  0x803e, 0x7d9, 0x8038, 0x775, 0x8032, 0x711, 0x802d, 0x6ac,
+  0x8027, 0x648, 0x8023, 0x5e3, 0x801e, 0x57f, 0x801a, 0x51b,
+  0x8016, 0x4b6, 0x8013, 0x452, 0x800f, 0x3ed, 0x800c, 0x389,
+  0x800a, 0x324, 0x8008, 0x2c0, 0x8006, 0x25b, 0x8004, 0x1f7,
+  0x8002, 0x192, 0x8001, 0x12e, 0x8001, 0xc9, 0x8000, 0x65,
+  0x8000, 0x0, 0x8000, 0xff9b, 0x8001, 0xff37, 0x8001, 0xfed2,
+  0x8002, 0xfe6e, 0x8004, 0xfe09, 0x8006, 0xfda5, 0x8008, 0xfd40,
+  0x800a, 0xfcdc, 0x800c, 0xfc77, 0x800f, 0xfc13, 0x8013, 0xfbae,
+  0x8016, 0xfb4a, 0x801a, 0xfae5, 0x801e, 0xfa81, 0x8023, 0xfa1d,
+  0x8027, 0xf9b8, 0x802d, 0xf954, 0x8032, 0xf8ef, 0x8038, 0xf88b,
+  0x803e, 0xf827, 0x8044, 0xf7c2, 0x804b, 0xf75e, 0x8052, 0xf6fa,
+  0x8059, 0xf695, 0x8060, 0xf631, 0x8068, 0xf5cd, 0x8070, 0xf569,
+  0x8079, 0xf505, 0x8082, 0xf4a0, 0x808b, 0xf43c, 0x8094, 0xf3d8,
+  0x809e, 0xf374, 0x80a8, 0xf310, 0x80b2, 0xf2ac, 0x80bd, 0xf248,
+  0x80c8, 0xf1e4, 0x80d3, 0xf180, 0x80de, 0xf11c, 0x80ea, 0xf0b9,
+  0x80f6, 0xf055, 0x8103, 0xeff1, 0x8110, 0xef8d, 0x811d, 0xef2a,
+  0x812a, 0xeec6, 0x8138, 0xee62, 0x8146, 0xedff, 0x8154, 0xed9b,
+  0x8163, 0xed38, 0x8172, 0xecd5, 0x8181, 0xec71, 0x8190, 0xec0e,
+  0x81a0, 0xebab, 0x81b0, 0xeb47, 0x81c1, 0xeae4, 0x81d1, 0xea81,
+  0x81e2, 0xea1e, 0x81f4, 0xe9bb, 0x8205, 0xe958, 0x8217, 0xe8f5,
+  0x822a, 0xe892, 0x823c, 0xe82f, 0x824f, 0xe7cd, 0x8262, 0xe76a,
+  0x8276, 0xe707, 0x8289, 0xe6a5, 0x829d, 0xe642, 0x82b2, 0xe5e0,
+  0x82c6, 0xe57d, 0x82db, 0xe51b, 0x82f1, 0xe4b9, 0x8306, 0xe457,
+  0x831c, 0xe3f4, 0x8332, 0xe392, 0x8349, 0xe330, 0x8360, 0xe2cf,
+  0x8377, 0xe26d, 0x838e, 0xe20b, 0x83a6, 0xe1a9, 0x83be, 0xe148,
+  0x83d6, 0xe0e6, 0x83ef, 0xe085, 0x8407, 0xe023, 0x8421, 0xdfc2,
+  0x843a, 0xdf61, 0x8454, 0xdeff, 0x846e, 0xde9e, 0x8488, 0xde3d,
+  0x84a3, 0xdddc, 0x84be, 0xdd7c, 0x84d9, 0xdd1b, 0x84f5, 0xdcba,
+  0x8511, 0xdc59, 0x852d, 0xdbf9, 0x8549, 0xdb99, 0x8566, 0xdb38,
+  0x8583, 0xdad8, 0x85a0, 0xda78, 0x85be, 0xda18, 0x85dc, 0xd9b8,
+  0x85fa, 0xd958, 0x8619, 0xd8f8, 0x8637, 0xd898, 0x8656, 0xd839,
+  0x8676, 0xd7d9, 0x8696, 0xd77a, 0x86b6, 0xd71b, 0x86d6, 0xd6bb,
+  0x86f6, 0xd65c, 0x8717, 0xd5fd, 0x8738, 0xd59e, 0x875a, 0xd53f,
+  0x877b, 0xd4e1, 0x879d, 0xd482, 0x87c0, 0xd424, 0x87e2, 0xd3c5,
+  0x8805, 0xd367, 0x8828, 0xd309, 0x884c, 0xd2ab, 0x8870, 0xd24d,
+  0x8894, 0xd1ef, 0x88b8, 0xd191, 0x88dd, 0xd134, 0x8902, 0xd0d6,
+  0x8927, 0xd079, 0x894c, 0xd01b, 0x8972, 0xcfbe, 0x8998, 0xcf61,
+  0x89be, 0xcf04, 0x89e5, 0xcea7, 0x8a0c, 0xce4b, 0x8a33, 0xcdee,
+  0x8a5a, 0xcd92, 0x8a82, 0xcd35, 0x8aaa, 0xccd9, 0x8ad3, 0xcc7d,
+  0x8afb, 0xcc21, 0x8b24, 0xcbc5, 0x8b4d, 0xcb69, 0x8b77, 0xcb0e,
+  0x8ba0, 0xcab2, 0x8bca, 0xca57, 0x8bf5, 0xc9fc, 0x8c1f, 0xc9a1,
+  0x8c4a, 0xc946, 0x8c75, 0xc8eb, 0x8ca1, 0xc890, 0x8ccc, 0xc836,
+  0x8cf8, 0xc7db, 0x8d24, 0xc781, 0x8d51, 0xc727, 0x8d7e, 0xc6cd,
+  0x8dab, 0xc673, 0x8dd8, 0xc619, 0x8e06, 0xc5c0, 0x8e34, 0xc566,
+  0x8e62, 0xc50d, 0x8e90, 0xc4b4, 0x8ebf, 0xc45b, 0x8eee, 0xc402,
+  0x8f1d, 0xc3a9, 0x8f4d, 0xc351, 0x8f7d, 0xc2f8, 0x8fad, 0xc2a0,
+  0x8fdd, 0xc248, 0x900e, 0xc1f0, 0x903e, 0xc198, 0x9070, 0xc140,
+  0x90a1, 0xc0e9, 0x90d3, 0xc091, 0x9105, 0xc03a, 0x9137, 0xbfe3,
+  0x9169, 0xbf8c, 0x919c, 0xbf35, 0x91cf, 0xbedf, 0x9202, 0xbe88,
+  0x9236, 0xbe32, 0x926a, 0xbddc, 0x929e, 0xbd86, 0x92d2, 0xbd30,
+  0x9307, 0xbcda, 0x933c, 0xbc85, 0x9371, 0xbc2f, 0x93a6, 0xbbda,
+  0x93dc, 0xbb85, 0x9412, 0xbb30, 0x9448, 0xbadc, 0x947e, 0xba87,
+  0x94b5, 0xba33, 0x94ec, 0xb9df, 0x9523, 0xb98b, 0x955b, 0xb937,
+  0x9592, 0xb8e3, 0x95ca, 0xb890, 0x9603, 0xb83c, 0x963b, 0xb7e9,
+  0x9674, 0xb796, 0x96ad, 0xb743, 0x96e6, 0xb6f1, 0x9720, 0xb69e,
+  0x9759, 0xb64c, 0x9793, 0xb5fa, 0x97ce, 0xb5a8, 0x9808, 0xb556,
+  0x9843, 0xb505, 0x987e, 0xb4b3, 0x98b9, 0xb462, 0x98f5, 0xb411,
+  0x9930, 0xb3c0, 0x996d, 0xb36f, 0x99a9, 0xb31f, 0x99e5, 0xb2cf,
+  0x9a22, 0xb27f, 0x9a5f, 0xb22f, 0x9a9c, 0xb1df, 0x9ada, 0xb18f,
+  0x9b17, 0xb140, 0x9b55, 0xb0f1, 0x9b94, 0xb0a2, 0x9bd2, 0xb053,
+  0x9c11, 0xb005, 0x9c50, 0xafb6, 0x9c8f, 0xaf68, 0x9cce, 0xaf1a,
+  0x9d0e, 0xaecc, 0x9d4e, 0xae7f, 0x9d8e, 0xae31, 0x9dce, 0xade4,
+  0x9e0f, 0xad97, 0x9e50, 0xad4a, 0x9e91, 0xacfd, 0x9ed2, 0xacb1,
+  0x9f14, 0xac65, 0x9f56, 0xac19, 0x9f98, 0xabcd, 0x9fda, 0xab81,
+  0xa01c, 0xab36, 0xa05f, 0xaaeb, 0xa0a2, 0xaaa0, 0xa0e5, 0xaa55,
+  0xa129, 0xaa0a, 0xa16c, 0xa9c0, 0xa1b0, 0xa976, 0xa1f4, 0xa92c,
+  0xa238, 0xa8e2, 0xa27d, 0xa899, 0xa2c2, 0xa84f, 0xa307, 0xa806,
+  0xa34c, 0xa7bd, 0xa391, 0xa774, 0xa3d7, 0xa72c, 0xa41d, 0xa6e4,
+  0xa463, 0xa69c, 0xa4a9, 0xa654, 0xa4f0, 0xa60c, 0xa537, 0xa5c5,
+  0xa57e, 0xa57e, 0xa5c5, 0xa537, 0xa60c, 0xa4f0, 0xa654, 0xa4a9,
+  0xa69c, 0xa463, 0xa6e4, 0xa41d, 0xa72c, 0xa3d7, 0xa774, 0xa391,
+  0xa7bd, 0xa34c, 0xa806, 0xa307, 0xa84f, 0xa2c2, 0xa899, 0xa27d,
+  0xa8e2, 0xa238, 0xa92c, 0xa1f4, 0xa976, 0xa1b0, 0xa9c0, 0xa16c,
+  0xaa0a, 0xa129, 0xaa55, 0xa0e5, 0xaaa0, 0xa0a2, 0xaaeb, 0xa05f,
+  0xab36, 0xa01c, 0xab81, 0x9fda, 0xabcd, 0x9f98, 0xac19, 0x9f56,
+  0xac65, 0x9f14, 0xacb1, 0x9ed2, 0xacfd, 0x9e91, 0xad4a, 0x9e50,
+  0xad97, 0x9e0f, 0xade4, 0x9dce, 0xae31, 0x9d8e, 0xae7f, 0x9d4e,
+  0xaecc, 0x9d0e, 0xaf1a, 0x9cce, 0xaf68, 0x9c8f, 0xafb6, 0x9c50,
+  0xb005, 0x9c11, 0xb053, 0x9bd2, 0xb0a2, 0x9b94, 0xb0f1, 0x9b55,
+  0xb140, 0x9b17, 0xb18f, 0x9ada, 0xb1df, 0x9a9c, 0xb22f, 0x9a5f,
+  0xb27f, 0x9a22, 0xb2cf, 0x99e5, 0xb31f, 0x99a9, 0xb36f, 0x996d,
+  0xb3c0, 0x9930, 0xb411, 0x98f5, 0xb462, 0x98b9, 0xb4b3, 0x987e,
+  0xb505, 0x9843, 0xb556, 0x9808, 0xb5a8, 0x97ce, 0xb5fa, 0x9793,
+  0xb64c, 0x9759, 0xb69e, 0x9720, 0xb6f1, 0x96e6, 0xb743, 0x96ad,
+  0xb796, 0x9674, 0xb7e9, 0x963b, 0xb83c, 0x9603, 0xb890, 0x95ca,
+  0xb8e3, 0x9592, 0xb937, 0x955b, 0xb98b, 0x9523, 0xb9df, 0x94ec,
+  0xba33, 0x94b5, 0xba87, 0x947e, 0xbadc, 0x9448, 0xbb30, 0x9412,
+  0xbb85, 0x93dc, 0xbbda, 0x93a6, 0xbc2f, 0x9371, 0xbc85, 0x933c,
+  0xbcda, 0x9307, 0xbd30, 0x92d2, 0xbd86, 0x929e, 0xbddc, 0x926a,
+  0xbe32, 0x9236, 0xbe88, 0x9202, 0xbedf, 0x91cf, 0xbf35, 0x919c,
+  0xbf8c, 0x9169, 0xbfe3, 0x9137, 0xc03a, 0x9105, 0xc091, 0x90d3,
+  0xc0e9, 0x90a1, 0xc140, 0x9070, 0xc198, 0x903e, 0xc1f0, 0x900e,
+  0xc248, 0x8fdd, 0xc2a0, 0x8fad, 0xc2f8, 0x8f7d, 0xc351, 0x8f4d,
+  0xc3a9, 0x8f1d, 0xc402, 0x8eee, 0xc45b, 0x8ebf, 0xc4b4, 0x8e90,
+  0xc50d, 0x8e62, 0xc566, 0x8e34, 0xc5c0, 0x8e06, 0xc619, 0x8dd8,
+  0xc673, 0x8dab, 0xc6cd, 0x8d7e, 0xc727, 0x8d51, 0xc781, 0x8d24,
+  0xc7db, 0x8cf8, 0xc836, 0x8ccc, 0xc890, 0x8ca1, 0xc8eb, 0x8c75,
+  0xc946, 0x8c4a, 0xc9a1, 0x8c1f, 0xc9fc, 0x8bf5, 0xca57, 0x8bca,
+  0xcab2, 0x8ba0, 0xcb0e, 0x8b77, 0xcb69, 0x8b4d, 0xcbc5, 0x8b24,
+  0xcc21, 0x8afb, 0xcc7d, 0x8ad3, 0xccd9, 0x8aaa, 0xcd35, 0x8a82,
+  0xcd92, 0x8a5a, 0xcdee, 0x8a33, 0xce4b, 0x8a0c, 0xcea7, 0x89e5,
+  0xcf04, 0x89be, 0xcf61, 0x8998, 0xcfbe, 0x8972, 0xd01b, 0x894c,
+  0xd079, 0x8927, 0xd0d6, 0x8902, 0xd134, 0x88dd, 0xd191, 0x88b8,
+  0xd1ef, 0x8894, 0xd24d, 0x8870, 0xd2ab, 0x884c, 0xd309, 0x8828,
+  0xd367, 0x8805, 0xd3c5, 0x87e2, 0xd424, 0x87c0, 0xd482, 0x879d,
+  0xd4e1, 0x877b, 0xd53f, 0x875a, 0xd59e, 0x8738, 0xd5fd, 0x8717,
+  0xd65c, 0x86f6, 0xd6bb, 0x86d6, 0xd71b, 0x86b6, 0xd77a, 0x8696,
+  0xd7d9, 0x8676, 0xd839, 0x8656, 0xd898, 0x8637, 0xd8f8, 0x8619,
+  0xd958, 0x85fa, 0xd9b8, 0x85dc, 0xda18, 0x85be, 0xda78, 0x85a0,
+  0xdad8, 0x8583, 0xdb38, 0x8566, 0xdb99, 0x8549, 0xdbf9, 0x852d,
+  0xdc59, 0x8511, 0xdcba, 0x84f5, 0xdd1b, 0x84d9, 0xdd7c, 0x84be,
+  0xdddc, 0x84a3, 0xde3d, 0x8488, 0xde9e, 0x846e, 0xdeff, 0x8454,
+  0xdf61, 0x843a, 0xdfc2, 0x8421, 0xe023, 0x8407, 0xe085, 0x83ef,
+  0xe0e6, 0x83d6, 0xe148, 0x83be, 0xe1a9, 0x83a6, 0xe20b, 0x838e,
+  0xe26d, 0x8377, 0xe2cf, 0x8360, 0xe330, 0x8349, 0xe392, 0x8332,
+  0xe3f4, 0x831c, 0xe457, 0x8306, 0xe4b9, 0x82f1, 0xe51b, 0x82db,
+  0xe57d, 0x82c6, 0xe5e0, 0x82b2, 0xe642, 0x829d, 0xe6a5, 0x8289,
+  0xe707, 0x8276, 0xe76a, 0x8262, 0xe7cd, 0x824f, 0xe82f, 0x823c,
+  0xe892, 0x822a, 0xe8f5, 0x8217, 0xe958, 0x8205, 0xe9bb, 0x81f4,
+  0xea1e, 0x81e2, 0xea81, 0x81d1, 0xeae4, 0x81c1, 0xeb47, 0x81b0,
+  0xebab, 0x81a0, 0xec0e, 0x8190, 0xec71, 0x8181, 0xecd5, 0x8172,
+  0xed38, 0x8163, 0xed9b, 0x8154, 0xedff, 0x8146, 0xee62, 0x8138,
+  0xeec6, 0x812a, 0xef2a, 0x811d, 0xef8d, 0x8110, 0xeff1, 0x8103,
+  0xf055, 0x80f6, 0xf0b9, 0x80ea, 0xf11c, 0x80de, 0xf180, 0x80d3,
+  0xf1e4, 0x80c8, 0xf248, 0x80bd, 0xf2ac, 0x80b2, 0xf310, 0x80a8,
+  0xf374, 0x809e, 0xf3d8, 0x8094, 0xf43c, 0x808b, 0xf4a0, 0x8082,
+  0xf505, 0x8079, 0xf569, 0x8070, 0xf5cd, 0x8068, 0xf631, 0x8060,
+  0xf695, 0x8059, 0xf6fa, 0x8052, 0xf75e, 0x804b, 0xf7c2, 0x8044,
+  0xf827, 0x803e, 0xf88b, 0x8038, 0xf8ef, 0x8032, 0xf954, 0x802d,
+  0xf9b8, 0x8027, 0xfa1d, 0x8023, 0xfa81, 0x801e, 0xfae5, 0x801a,
+  0xfb4a, 0x8016, 0xfbae, 0x8013, 0xfc13, 0x800f, 0xfc77, 0x800c,
+  0xfcdc, 0x800a, 0xfd40, 0x8008, 0xfda5, 0x8006, 0xfe09, 0x8004,
+  0xfe6e, 0x8002, 0xfed2, 0x8001, 0xff37, 0x8001, 0xff9b, 0x8000
+};
+
+
+/*    
+* @brief  Bit reversal tables of the arm_cfft_q15 and arm_cfft_q31 lengths    
+*/
+
+/**    
+* \par    
+* The radix-4 stages of the fixed-point transforms leave their output in    
+* plain bit reversed order. Each table holds the pairs of entries to swap,    
+* as byte offsets of 8 byte complex values:    
+* \par    
+* <pre>for(i = 0; i < N; i++)    
+* {    
+*   j = bitrev(i, log2(N));    
+*   if(i < j) { table[k++] = 8 * i; table[k++] = 8 * j; }    
+* } </pre>    
+* \par    
+* arm_bitreversal_16 halves the offsets for the 4 byte q15 complex values.    
+*/
+
+const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH] = 
+{
+   8,64, 16,32, 24,96, 40,80, 56,112, 88,104
+};
+
+const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH] = 
+{
+   8,128, 16,64, 24,192, 40,160, 48,96, 56,224, 72,144, 88,208,
+   104,176, 120,240, 152,200, 184,232
+};
+
+const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH] = 
+{
+   8,256, 16,128, 24,384, 32,64, 40,320, 48,192, 56,448, 72,288,
+   80,160, 88,416, 104,352, 112,224, 120,480, 136,272, 152,400, 168,336,
+   176,208, 184,464, 200,304, 216,432, 232,368, 248,496, 280,392, 296,328,
+   312,456, 344,424, 376,488, 440,472
+};
+
+const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH] = 
+{
+   8,512, 16,256, 24,768, 32,128, 40,640, 48,384, 56,896, 72,576,
+   80,320, 88,832, 96,192, 104,704, 112,448, 120,960, 136,544, 144,288,
+   152,800, 168,672, 176,416, 184,928, 200,608, 208,352, 216,864, 232,736,
+   240,480, 248,992, 264,528, 280,784, 296,656, 304,400, 312,912, 328,592,
+   344,848, 360,720, 368,464, 376,976, 392,560, 408,816, 424,688, 440,944,
+   456,624, 472,880, 488,752, 504,1008, 536,776, 552,648, 568,904, 600,840,
+   616,712, 632,968, 664,808, 696,936, 728,872, 760,1000, 824,920, 888,984
+};
+
+const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH] = 
+{
+   8,1024, 16,512, 24,1536, 32,256, 40,1280, 48,768, 56,1792, 64,128,
+   72,1152, 80,640, 88,1664, 96,384, 104,1408, 112,896, 120,1920, 136,1088,
+   144,576, 152,1600, 160,320, 168,1344, 176,832, 184,1856, 200,1216, 208,704,
+   216,1728, 224,448, 232,1472, 240,960, 248,1984, 264,1056, 272,544, 280,1568,
+   296,1312, 304,800, 312,1824, 328,1184, 336,672, 344,1696, 352,416, 360,1440,
+   368,928, 376,1952, 392,1120, 400,608, 408,1632, 424,1376, 432,864, 440,1888,
+   456,1248, 464,736, 472,1760, 488,1504, 496,992, 504,2016, 520,1040, 536,1552,
+   552,1296, 560,784, 568,1808, 584,1168, 592,656, 600,1680, 616,1424, 624,912,
+   632,1936, 648,1104, 664,1616, 680,1360, 688,848, 696,1872, 712,1232, 728,1744,
+   744,1488, 752,976, 760,2000, 776,1072, 792,1584, 808,1328, 824,1840, 840,1200,
+   856,1712, 872,1456, 880,944, 888,1968, 904,1136, 920,1648, 936,1392, 952,1904,
+   968,1264, 984,1776, 1000,1520, 1016,2032, 1048,1544, 1064,1288, 1080,1800, 1096,1160,
+   1112,1672, 1128,1416, 1144,1928, 1176,1608, 1192,1352, 1208,1864, 1240,1736, 1256,1480,
+   1272,1992, 1304,1576, 1336,1832, 1368,1704, 1384,1448, 1400,1960, 1432,1640, 1464,1896,
+   1496,1768, 1528,2024, 1592,1816, 1624,1688, 1656,1944, 1720,1880, 1784,2008, 1912,1976
+};
+
+const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH] = 
+{
+   8,2048, 16,1024, 24,3072, 32,512, 40,2560, 48,1536, 56,3584, 64,256,
+   72,2304, 80,1280, 88,3328, 96,768, 104,2816, 112,1792, 120,3840, 136,2176,
+   144,1152, 152,3200, 160,640, 168,2688, 176,1664, 184,3712, 192,384, 200,2432,
+   208,1408, 216,3456, 224,896, 232,2944, 240,1920, 248,3968, 264,2112, 272,1088,
+   280,3136, 288,576, 296,2624, 304,1600, 312,3648, 328,2368, 336,1344, 344,3392,
+   352,832, 360,2880, 368,1856, 376,3904, 392,2240, 400,1216, 408,3264, 416,704,
+   424,2752, 432,1728, 440,3776, 456,2496, 464,1472, 472,3520, 480,960, 488,3008,
+   496,1984, 504,4032, 520,2080, 528,1056, 536,3104, 552,2592, 560,1568, 568,3616,
+   584,2336, 592,1312, 600,3360, 608,800, 616,2848, 624,1824, 632,3872, 648,2208,
+   656,1184, 664,3232, 680,2720, 688,1696, 696,3744, 712,2464, 720,1440, 728,3488,
+   736,928, 744,2976, 752,1952, 760,4000, 776,2144, 784,1120, 792,3168, 808,2656,
+   816,1632, 824,3680, 840,2400, 848,1376, 856,3424, 872,2912, 880,1888, 888,3936,
+   904,2272, 912,1248, 920,3296, 936,2784, 944,1760, 952,3808, 968,2528, 976,1504,
+   984,3552, 1000,3040, 1008,2016, 1016,4064, 1032,2064, 1048,3088, 1064,2576, 1072,1552,
+   1080,3600, 1096,2320, 1104,1296, 1112,3344, 1128,2832, 1136,1808, 1144,3856, 1160,2192,
+   1176,3216, 1192,2704, 1200,1680, 1208,3728, 1224,2448, 1232,1424, 1240,3472, 1256,2960,
+   1264,1936, 1272,3984, 1288,2128, 1304,3152, 1320,2640, 1328,1616, 1336,3664, 1352,2384,
+   1368,3408, 1384,2896, 1392,1872, 1400,3920, 1416,2256, 1432,3280, 1448,2768, 1456,1744,
+   1464,3792, 1480,2512, 1496,3536, 1512,3024, 1520,2000, 1528,4048, 1544,2096, 1560,3120,
+   1576,2608, 1592,3632, 1608,2352, 1624,3376, 1640,2864, 1648,1840, 1656,3888, 1672,2224,
+   1688,3248, 1704,2736, 1720,3760, 1736,2480, 1752,3504, 1768,2992, 1776,1968, 1784,4016,
+   1800,2160, 1816,3184, 1832,2672, 1848,3696, 1864,2416, 1880,3440, 1896,2928, 1912,3952,
+   1928,2288, 1944,3312, 1960,2800, 1976,3824, 1992,2544, 2008,3568, 2024,3056, 2040,4080,
+   2072,3080, 2088,2568, 2104,3592, 2120,2312, 2136,3336, 2152,2824, 2168,3848, 2200,3208,
+   2216,2696, 2232,3720, 2248,2440, 2264,3464, 2280,2952, 2296,3976, 2328,3144, 2344,2632,
+   2360,3656, 2392,3400, 2408,2888, 2424,3912, 2456,3272, 2472,2760, 2488,3784, 2520,3528,
+   2536,3016, 2552,4040, 2584,3112, 2616,3624, 2648,3368, 2664,2856, 2680,3880, 2712,3240,
+   2744,3752, 2776,3496, 2792,2984, 2808,4008, 2840,3176, 2872,3688, 2904,3432, 2936,3944,
+   2968,3304, 3000,3816, 3032,3560, 3064,4072, 3128,3608, 3160,3352, 3192,3864, 3256,3736,
+   3288,3480, 3320,3992, 3384,3672, 3448,3928, 3512,3800, 3576,4056, 3704,3896, 3832,4024
+};
+
+const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] = 
+{
+   8,4096, 16,2048, 24,6144, 32,1024, 40,5120, 48,3072, 56,7168, 64,512,
+   72,4608, 80,2560, 88,6656, 96,1536, 104,5632, 112,3584, 120,7680, 128,256,
+   136,4352, 144,2304, 152,6400, 160,1280, 168,5376, 176,3328, 184,7424, 192,768,
+   200,4864, 208,2816, 216,6912, 224,1792, 232,5888, 240,3840, 248,7936, 264,4224,
+   272,2176, 280,6272, 288,1152, 296,5248, 304,3200, 312,7296, 320,640, 328,4736,
+   336,2688, 344,6784, 352,1664, 360,5760, 368,3712, 376,7808, 392,4480, 400,2432,
+   408,6528, 416,1408, 424,5504, 432,3456, 440,7552, 448,896, 456,4992, 464,2944,
+   472,7040, 480,1920, 488,6016, 496,3968, 504,8064, 520,4160, 528,2112, 536,6208,
+   544,1088, 552,5184, 560,3136, 568,7232, 584,4672, 592,2624, 600,6720, 608,1600,
+   616,5696, 624,3648, 632,7744, 648,4416, 656,2368, 664,6464, 672,1344, 680,5440,
+   688,3392, 696,7488, 704,832, 712,4928, 720,2880, 728,6976, 736,1856, 744,5952,
+   752,3904, 760,8000, 776,4288, 784,2240, 792,6336, 800,1216, 808,5312, 816,3264,
+   824,7360, 840,4800, 848,2752, 856,6848, 864,1728, 872,5824, 880,3776, 888,7872,
+   904,4544, 912,2496, 920,6592, 928,1472, 936,5568, 944,3520, 952,7616, 968,5056,
+   976,3008, 984,7104, 992,1984, 1000,6080, 1008,4032, 1016,8128, 1032,4128, 1040,2080,
+   1048,6176, 1064,5152, 1072,3104, 1080,7200, 1096,4640, 1104,2592, 1112,6688, 1120,1568,
+   1128,5664, 1136,3616, 1144,7712, 1160,4384, 1168,2336, 1176,6432, 1184,1312, 1192,5408,
+   1200,3360, 1208,7456, 1224,4896, 1232,2848, 1240,6944, 1248,1824, 1256,5920, 1264,3872,
+   1272,7968, 1288,4256, 1296,2208, 1304,6304, 1320,5280, 1328,3232, 1336,7328, 1352,4768,
+   1360,2720, 1368,6816, 1376,1696, 1384,5792, 1392,3744, 1400,7840, 1416,4512, 1424,2464,
+   1432,6560, 1448,5536, 1456,3488, 1464,7584, 1480,5024, 1488,2976, 1496,7072, 1504,1952,
+   1512,6048, 1520,4000, 1528,8096, 1544,4192, 1552,2144, 1560,6240, 1576,5216, 1584,3168,
+   1592,7264, 1608,4704, 1616,2656, 1624,6752, 1640,5728, 1648,3680, 1656,7776, 1672,4448,
+   1680,2400, 1688,6496, 1704,5472, 1712,3424, 1720,7520, 1736,4960, 1744,2912, 1752,7008,
+   1760,1888, 1768,5984, 1776,3936, 1784,8032, 1800,4320, 1808,2272, 1816,6368, 1832,5344,
+   1840,3296, 1848,7392, 1864,4832, 1872,2784, 1880,6880, 1896,5856, 1904,3808, 1912,7904,
+   1928,4576, 1936,2528, 1944,6624, 1960,5600, 1968,3552, 1976,7648, 1992,5088, 2000,3040,
+   2008,7136, 2024,6112, 2032,4064, 2040,8160, 2056,4112, 2072,6160, 2088,5136, 2096,3088,
+   2104,7184, 2120,4624, 2128,2576, 2136,6672, 2152,5648, 2160,3600, 2168,7696, 2184,4368,
+   2192,2320, 2200,6416, 2216,5392, 2224,3344, 2232,7440, 2248,4880, 2256,2832, 2264,6928,
+   2280,5904, 2288,3856, 2296,7952, 2312,4240, 2328,6288, 2344,5264, 2352,3216, 2360,7312,
+   2376,4752, 2384,2704, 2392,6800, 2408,5776, 2416,3728, 2424,7824, 2440,4496, 2456,6544,
+   2472,5520, 2480,3472, 2488,7568, 2504,5008, 2512,2960, 2520,7056, 2536,6032, 2544,3984,
+   2552,8080, 2568,4176, 2584,6224, 2600,5200, 2608,3152, 2616,7248, 2632,4688, 2648,6736,
+   2664,5712, 2672,3664, 2680,7760, 2696,4432, 2712,6480, 2728,5456, 2736,3408, 2744,7504,
+   2760,4944, 2768,2896, 2776,6992, 2792,5968, 2800,3920, 2808,8016, 2824,4304, 2840,6352,
+   2856,5328, 2864,3280, 2872,7376, 2888,4816, 2904,6864, 2920,5840, 2928,3792, 2936,7888,
+   2952,4560, 2968,6608, 2984,5584, 2992,3536, 3000,7632, 3016,5072, 3032,7120, 3048,6096,
+   3056,4048, 3064,8144, 3080,4144, 3096,6192, 3112,5168, 3128,7216, 3144,4656, 3160,6704,
+   3176,5680, 3184,3632, 3192,7728, 3208,4400, 3224,6448, 3240,5424, 3248,3376, 3256,7472,
+   3272,4912, 3288,6960, 3304,5936, 3312,3888, 3320,7984, 3336,4272, 3352,6320, 3368,5296,
+   3384,7344, 3400,4784, 3416,6832, 3432,5808, 3440,3760, 3448,7856, 3464,4528, 3480,6576,
+   3496,5552, 3512,7600, 3528,5040, 3544,7088, 3560,6064, 3568,4016, 3576,8112, 3592,4208,
+   3608,6256, 3624,5232, 3640,7280, 3656,4720, 3672,6768, 3688,5744, 3704,7792, 3720,4464,
+   3736,6512, 3752,5488, 3768,7536, 3784,4976, 3800,7024, 3816,6000, 3824,3952, 3832,8048,
+   3848,4336, 3864,6384, 3880,5360, 3896,7408, 3912,4848, 3928,6896, 3944,5872, 3960,7920,
+   3976,4592, 3992,6640, 4008,5616, 4024,7664, 4040,5104, 4056,7152, 4072,6128, 4088,8176,
+   4120,6152, 4136,5128, 4152,7176, 4168,4616, 4184,6664, 4200,5640, 4216,7688, 4232,4360,
+   4248,6408, 4264,5384, 4280,7432, 4296,4872, 4312,6920, 4328,5896, 4344,7944, 4376,6280,
+   4392,5256, 4408,7304, 4424,4744, 4440,6792, 4456,5768, 4472,7816, 4504,6536, 4520,5512,
+   4536,7560, 4552,5000, 4568,7048, 4584,6024, 4600,8072, 4632,6216, 4648,5192, 4664,7240,
+   4696,6728, 4712,5704, 4728,7752, 4760,6472, 4776,5448, 4792,7496, 4808,4936, 4824,6984,
+   4840,5960, 4856,8008, 4888,6344, 4904,5320, 4920,7368, 4952,6856, 4968,5832, 4984,7880,
+   5016,6600, 5032,5576, 5048,7624, 5080,7112, 5096,6088, 5112,8136, 5144,6184, 5176,7208,
+   5208,6696, 5224,5672, 5240,7720, 5272,6440, 5288,5416, 5304,7464, 5336,6952, 5352,5928,
+   5368,7976, 5400,6312, 5432,7336, 5464,6824, 5480,5800, 5496,7848, 5528,6568, 5560,7592,
+   5592,7080, 5608,6056, 5624,8104, 5656,6248, 5688,7272, 5720,6760, 5752,7784, 5784,6504,
+   5816,7528, 5848,7016, 5864,5992, 5880,8040, 5912,6376, 5944,7400, 5976,6888, 6008,7912,
+   6040,6632, 6072,7656, 6104,7144, 6136,8168, 6200,7192, 6232,6680, 6264,7704, 6296,6424,
+   6328,7448, 6360,6936, 6392,7960, 6456,7320, 6488,6808, 6520,7832, 6584,7576, 6616,7064,
+   6648,8088, 6712,7256, 6776,7768, 6840,7512, 6872,7000, 6904,8024, 6968,7384, 7032,7896,
+   7096,7640, 7160,8152, 7288,7736, 7352,7480, 7416,7992, 7544,7864, 7672,8120, 7928,8056
+};
+
+const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] = 
+{
+   8,8192, 16,4096, 24,12288, 32,2048, 40,10240, 48,6144, 56,14336, 64,1024,
+   72,9216, 80,5120, 88,13312, 96,3072, 104,11264, 112,7168, 120,15360, 128,512,
+   136,8704, 144,4608, 152,12800, 160,2560, 168,10752, 176,6656, 184,14848, 192,1536,
+   200,9728, 208,5632, 216,13824, 224,3584, 232,11776, 240,7680, 248,15872, 264,8448,
+   272,4352, 280,12544, 288,2304, 296,10496, 304,6400, 312,14592, 320,1280, 328,9472,
+   336,5376, 344,13568, 352,3328, 360,11520, 368,7424, 376,15616, 384,768, 392,8960,
+   400,4864, 408,13056, 416,2816, 424,11008, 432,6912, 440,15104, 448,1792, 456,9984,
+   464,5888, 472,14080, 480,3840, 488,12032, 496,7936, 504,16128, 520,8320, 528,4224,
+   536,12416, 544,2176, 552,10368, 560,6272, 568,14464, 576,1152, 584,9344, 592,5248,
+   600,13440, 608,3200, 616,11392, 624,7296, 632,15488, 648,8832, 656,4736, 664,12928,
+   672,2688, 680,10880, 688,6784, 696,14976, 704,1664, 712,9856, 720,5760, 728,13952,
+   736,3712, 744,11904, 752,7808, 760,16000, 776,8576, 784,4480, 792,12672, 800,2432,
+   808,10624, 816,6528, 824,14720, 832,1408, 840,9600, 848,5504, 856,13696, 864,3456,
+   872,11648, 880,7552, 888,15744, 904,9088, 912,4992, 920,13184, 928,2944, 936,11136,
+   944,7040, 952,15232, 960,1920, 968,10112, 976,6016, 984,14208, 992,3968, 1000,12160,
+   1008,8064, 1016,16256, 1032,8256, 1040,4160, 1048,12352, 1056,2112, 1064,10304, 1072,6208,
+   1080,14400, 1096,9280, 1104,5184, 1112,13376, 1120,3136, 1128,11328, 1136,7232, 1144,15424,
+   1160,8768, 1168,4672, 1176,12864, 1184,2624, 1192,10816, 1200,6720, 1208,14912, 1216,1600,
+   1224,9792, 1232,5696, 1240,13888, 1248,3648, 1256,11840, 1264,7744, 1272,15936, 1288,8512,
+   1296,4416, 1304,12608, 1312,2368, 1320,10560, 1328,6464, 1336,14656, 1352,9536, 1360,5440,
+   1368,13632, 1376,3392, 1384,11584, 1392,7488, 1400,15680, 1416,9024, 1424,4928, 1432,13120,
+   1440,2880, 1448,11072, 1456,6976, 1464,15168, 1472,1856, 1480,10048, 1488,5952, 1496,14144,
+   1504,3904, 1512,12096, 1520,8000, 1528,16192, 1544,8384, 1552,4288, 1560,12480, 1568,2240,
+   1576,10432, 1584,6336, 1592,14528, 1608,9408, 1616,5312, 1624,13504, 1632,3264, 1640,11456,
+   1648,7360, 1656,15552, 1672,8896, 1680,4800, 1688,12992, 1696,2752, 1704,10944, 1712,6848,
+   1720,15040, 1736,9920, 1744,5824, 1752,14016, 1760,3776, 1768,11968, 1776,7872, 1784,16064,
+   1800,8640, 1808,4544, 1816,12736, 1824,2496, 1832,10688, 1840,6592, 1848,14784, 1864,9664,
+   1872,5568, 1880,13760, 1888,3520, 1896,11712, 1904,7616, 1912,15808, 1928,9152, 1936,5056,
+   1944,13248, 1952,3008, 1960,11200, 1968,7104, 1976,15296, 1992,10176, 2000,6080, 2008,14272,
+   2016,4032, 2024,12224, 2032,8128, 2040,16320, 2056,8224, 2064,4128, 2072,12320, 2088,10272,
+   2096,6176, 2104,14368, 2120,9248, 2128,5152, 2136,13344, 2144,3104, 2152,11296, 2160,7200,
+   2168,15392, 2184,8736, 2192,4640, 2200,12832, 2208,2592, 2216,10784, 2224,6688, 2232,14880,
+   2248,9760, 2256,5664, 2264,13856, 2272,3616, 2280,11808, 2288,7712, 2296,15904, 2312,8480,
+   2320,4384, 2328,12576, 2344,10528, 2352,6432, 2360,14624, 2376,9504, 2384,5408, 2392,13600,
+   2400,3360, 2408,11552, 2416,7456, 2424,15648, 2440,8992, 2448,4896, 2456,13088, 2464,2848,
+   2472,11040, 2480,6944, 2488,15136, 2504,10016, 2512,5920, 2520,14112, 2528,3872, 2536,12064,
+   2544,7968, 2552,16160, 2568,8352, 2576,4256, 2584,12448, 2600,10400, 2608,6304, 2616,14496,
+   2632,9376, 2640,5280, 2648,13472, 2656,3232, 2664,11424, 2672,7328, 2680,15520, 2696,8864,
+   2704,4768, 2712,12960, 2728,10912, 2736,6816, 2744,15008, 2760,9888, 2768,5792, 2776,13984,
+   2784,3744, 2792,11936, 2800,7840, 2808,16032, 2824,8608, 2832,4512, 2840,12704, 2856,10656,
+   2864,6560, 2872,14752, 2888,9632, 2896,5536, 2904,13728, 2912,3488, 2920,11680, 2928,7584,
+   2936,15776, 2952,9120, 2960,5024, 2968,13216, 2984,11168, 2992,7072, 3000,15264, 3016,10144,
+   3024,6048, 3032,14240, 3040,4000, 3048,12192, 3056,8096, 3064,16288, 3080,8288, 3088,4192,
+   3096,12384, 3112,10336, 3120,6240, 3128,14432, 3144,9312, 3152,5216, 3160,13408, 3176,11360,
+   3184,7264, 3192,15456, 3208,8800, 3216,4704, 3224,12896, 3240,10848, 3248,6752, 3256,14944,
+   3272,9824, 3280,5728, 3288,13920, 3296,3680, 3304,11872, 3312,7776, 3320,15968, 3336,8544,
+   3344,4448, 3352,12640, 3368,10592, 3376,6496, 3384,14688, 3400,9568, 3408,5472, 3416,13664,
+   3432,11616, 3440,7520, 3448,15712, 3464,9056, 3472,4960, 3480,13152, 3496,11104, 3504,7008,
+   3512,15200, 3528,10080, 3536,5984, 3544,14176, 3552,3936, 3560,12128, 3568,8032, 3576,16224,
+   3592,8416, 3600,4320, 3608,12512, 3624,10464, 3632,6368, 3640,14560, 3656,9440, 3664,5344,
+   3672,13536, 3688,11488, 3696,7392, 3704,15584, 3720,8928, 3728,4832, 3736,13024, 3752,10976,
+   3760,6880, 3768,15072, 3784,9952, 3792,5856, 3800,14048, 3816,12000, 3824,7904, 3832,16096,
+   3848,8672, 3856,4576, 3864,12768, 3880,10720, 3888,6624, 3896,14816, 3912,9696, 3920,5600,
+   3928,13792, 3944,11744, 3952,7648, 3960,15840, 3976,9184, 3984,5088, 3992,13280, 4008,11232,
+   4016,7136, 4024,15328, 4040,10208, 4048,6112, 4056,14304, 4072,12256, 4080,8160, 4088,16352,
+   4104,8208, 4120,12304, 4136,10256, 4144,6160, 4152,14352, 4168,9232, 4176,5136, 4184,13328,
+   4200,11280, 4208,7184, 4216,15376, 4232,8720, 4240,4624, 4248,12816, 4264,10768, 4272,6672,
+   4280,14864, 4296,9744, 4304,5648, 4312,13840, 4328,11792, 4336,7696, 4344,15888, 4360,8464,
+   4376,12560, 4392,10512, 4400,6416, 4408,14608, 4424,9488, 4432,5392, 4440,13584, 4456,11536,
+   4464,7440, 4472,15632, 4488,8976, 4496,4880, 4504,13072, 4520,11024, 4528,6928, 4536,15120,
+   4552,10000, 4560,5904, 4568,14096, 4584,12048, 4592,7952, 4600,16144, 4616,8336, 4632,12432,
+   4648,10384, 4656,6288, 4664,14480, 4680,9360, 4688,5264, 4696,13456, 4712,11408, 4720,7312,
+   4728,15504, 4744,8848, 4760,12944, 4776,10896, 4784,6800, 4792,14992, 4808,9872, 4816,5776,
+   4824,13968, 4840,11920, 4848,7824, 4856,16016, 4872,8592, 4888,12688, 4904,10640, 4912,6544,
+   4920,14736, 4936,9616, 4944,5520, 4952,13712, 4968,11664, 4976,7568, 4984,15760, 5000,9104,
+   5016,13200, 5032,11152, 5040,7056, 5048,15248, 5064,10128, 5072,6032, 5080,14224, 5096,12176,
+   5104,8080, 5112,16272, 5128,8272, 5144,12368, 5160,10320, 5168,6224, 5176,14416, 5192,9296,
+   5208,13392, 5224,11344, 5232,7248, 5240,15440, 5256,8784, 5272,12880, 5288,10832, 5296,6736,
+   5304,14928, 5320,9808, 5328,5712, 5336,13904, 5352,11856, 5360,7760, 5368,15952, 5384,8528,
+   5400,12624, 5416,10576, 5424,6480, 5432,14672, 5448,9552, 5464,13648, 5480,11600, 5488,7504,
+   5496,15696, 5512,9040, 5528,13136, 5544,11088, 5552,6992, 5560,15184, 5576,10064, 5584,5968,
+   5592,14160, 5608,12112, 5616,8016, 5624,16208, 5640,8400, 5656,12496, 5672,10448, 5680,6352,
+   5688,14544, 5704,9424, 5720,13520, 5736,11472, 5744,7376, 5752,15568, 5768,8912, 5784,13008,
+   5800,10960, 5808,6864, 5816,15056, 5832,9936, 5848,14032, 5864,11984, 5872,7888, 5880,16080,
+   5896,8656, 5912,12752, 5928,10704, 5936,6608, 5944,14800, 5960,9680, 5976,13776, 5992,11728,
+   6000,7632, 6008,15824, 6024,9168, 6040,13264, 6056,11216, 6064,7120, 6072,15312, 6088,10192,
+   6104,14288, 6120,12240, 6128,8144, 6136,16336, 6152,8240, 6168,12336, 6184,10288, 6200,14384,
+   6216,9264, 6232,13360, 6248,11312, 6256,7216, 6264,15408, 6280,8752, 6296,12848, 6312,10800,
+   6320,6704, 6328,14896, 6344,9776, 6360,13872, 6376,11824, 6384,7728, 6392,15920, 6408,8496,
+   6424,12592, 6440,10544, 6456,14640, 6472,9520, 6488,13616, 6504,11568, 6512,7472, 6520,15664,
+   6536,9008, 6552,13104, 6568,11056, 6576,6960, 6584,15152, 6600,10032, 6616,14128, 6632,12080,
+   6640,7984, 6648,16176, 6664,8368, 6680,12464, 6696,10416, 6712,14512, 6728,9392, 6744,13488,
+   6760,11440, 6768,7344, 6776,15536, 6792,8880, 6808,12976, 6824,10928, 6840,15024, 6856,9904,
+   6872,14000, 6888,11952, 6896,7856, 6904,16048, 6920,8624, 6936,12720, 6952,10672, 6968,14768,
+   6984,9648, 7000,13744, 7016,11696, 7024,7600, 7032,15792, 7048,9136, 7064,13232, 7080,11184,
+   7096,15280, 7112,10160, 7128,14256, 7144,12208, 7152,8112, 7160,16304, 7176,8304, 7192,12400,
+   7208,10352, 7224,14448, 7240,9328, 7256,13424, 7272,11376, 7288,15472, 7304,8816, 7320,12912,
+   7336,10864, 7352,14960, 7368,9840, 7384,13936, 7400,11888, 7408,7792, 7416,15984, 7432,8560,
+   7448,12656, 7464,10608, 7480,14704, 7496,9584, 7512,13680, 7528,11632, 7544,15728, 7560,9072,
+   7576,13168, 7592,11120, 7608,15216, 7624,10096, 7640,14192, 7656,12144, 7664,8048, 7672,16240,
+   7688,8432, 7704,12528, 7720,10480, 7736,14576, 7752,9456, 7768,13552, 7784,11504, 7800,15600,
+   7816,8944, 7832,13040, 7848,10992, 7864,15088, 7880,9968, 7896,14064, 7912,12016, 7928,16112,
+   7944,8688, 7960,12784, 7976,10736, 7992,14832, 8008,9712, 8024,13808, 8040,11760, 8056,15856,
+   8072,9200, 8088,13296, 8104,11248, 8120,15344, 8136,10224, 8152,14320, 8168,12272, 8184,16368,
+   8216,12296, 8232,10248, 8248,14344, 8264,9224, 8280,13320, 8296,11272, 8312,15368, 8328,8712,
+   8344,12808, 8360,10760, 8376,14856, 8392,9736, 8408,13832, 8424,11784, 8440,15880, 8472,12552,
+   8488,10504, 8504,14600, 8520,9480, 8536,13576, 8552,11528, 8568,15624, 8584,8968, 8600,13064,
+   8616,11016, 8632,15112, 8648,9992, 8664,14088, 8680,12040, 8696,16136, 8728,12424, 8744,10376,
+   8760,14472, 8776,9352, 8792,13448, 8808,11400, 8824,15496, 8856,12936, 8872,10888, 8888,14984,
+   8904,9864, 8920,13960, 8936,11912, 8952,16008, 8984,12680, 9000,10632, 9016,14728, 9032,9608,
+   9048,13704, 9064,11656, 9080,15752, 9112,13192, 9128,11144, 9144,15240, 9160,10120, 9176,14216,
+   9192,12168, 9208,16264, 9240,12360, 9256,10312, 9272,14408, 9304,13384, 9320,11336, 9336,15432,
+   9368,12872, 9384,10824, 9400,14920, 9416,9800, 9432,13896, 9448,11848, 9464,15944, 9496,12616,
+   9512,10568, 9528,14664, 9560,13640, 9576,11592, 9592,15688, 9624,13128, 9640,11080, 9656,15176,
+   9672,10056, 9688,14152, 9704,12104, 9720,16200, 9752,12488, 9768,10440, 9784,14536, 9816,13512,
+   9832,11464, 9848,15560, 9880,13000, 9896,10952, 9912,15048, 9944,14024, 9960,11976, 9976,16072,
+   10008,12744, 10024,10696, 10040,14792, 10072,13768, 10088,11720, 10104,15816, 10136,13256, 10152,11208,
+   10168,15304, 10200,14280, 10216,12232, 10232,16328, 10264,12328, 10296,14376, 10328,13352, 10344,11304,
+   10360,15400, 10392,12840, 10408,10792, 10424,14888, 10456,13864, 10472,11816, 10488,15912, 10520,12584,
+   10552,14632, 10584,13608, 10600,11560, 10616,15656, 10648,13096, 10664,11048, 10680,15144, 10712,14120,
+   10728,12072, 10744,16168, 10776,12456, 10808,14504, 10840,13480, 10856,11432, 10872,15528, 10904,12968,
+   10936,15016, 10968,13992, 10984,11944, 11000,16040, 11032,12712, 11064,14760, 11096,13736, 11112,11688,
+   11128,15784, 11160,13224, 11192,15272, 11224,14248, 11240,12200, 11256,16296, 11288,12392, 11320,14440,
+   11352,13416, 11384,15464, 11416,12904, 11448,14952, 11480,13928, 11496,11880, 11512,15976, 11544,12648,
+   11576,14696, 11608,13672, 11640,15720, 11672,13160, 11704,15208, 11736,14184, 11752,12136, 11768,16232,
+   11800,12520, 11832,14568, 11864,13544, 11896,15592, 11928,13032, 11960,15080, 11992,14056, 12024,16104,
+   12056,12776, 12088,14824, 12120,13800, 12152,15848, 12184,13288, 12216,15336, 12248,14312, 12280,16360,
+   12344,14360, 12376,13336, 12408,15384, 12440,12824, 12472,14872, 12504,13848, 12536,15896, 12600,14616,
+   12632,13592, 12664,15640, 12696,13080, 12728,15128, 12760,14104, 12792,16152, 12856,14488, 12888,13464,
+   12920,15512, 12984,15000, 13016,13976, 13048,16024, 13112,14744, 13144,13720, 13176,15768, 13240,15256,
+   13272,14232, 13304,16280, 13368,14424, 13432,15448, 13496,14936, 13528,13912, 13560,15960, 13624,14680,
+   13688,15704, 13752,15192, 13784,14168, 13816,16216, 13880,14552, 13944,15576, 14008,15064, 14072,16088,
+   14136,14808, 14200,15832, 14264,15320, 14328,16344, 14456,15416, 14520,14904, 14584,15928, 14712,15672,
+   14776,15160, 14840,16184, 14968,15544, 15096,16056, 15224,15800, 15352,16312, 15608,15992, 15864,16248
+};
+
+const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] = 
+{
+   8,16384, 16,8192, 24,24576, 32,4096, 40,20480, 48,12288, 56,28672, 64,2048,
+   72,18432, 80,10240, 88,26624, 96,6144, 104,22528, 112,14336, 120,30720, 128,1024,
+   136,17408, 144,9216, 152,25600, 160,5120, 168,21504, 176,13312, 184,29696, 192,3072,
+   200,19456, 208,11264, 216,27648, 224,7168, 232,23552, 240,15360, 248,31744, 256,512,
+   264,16896, 272,8704, 280,25088, 288,4608, 296,20992, 304,12800, 312,29184, 320,2560,
+   328,18944, 336,10752, 344,27136, 352,6656, 360,23040, 368,14848, 376,31232, 384,1536,
+   392,17920, 400,9728, 408,26112, 416,5632, 424,22016, 432,13824, 440,30208, 448,3584,
+   456,19968, 464,11776, 472,28160, 480,7680, 488,24064, 496,15872, 504,32256, 520,16640,
+   528,8448, 536,24832, 544,4352, 552,20736, 560,12544, 568,28928, 576,2304, 584,18688,
+   592,10496, 600,26880, 608,6400, 616,22784, 624,14592, 632,30976, 640,1280, 648,17664,
+   656,9472, 664,25856, 672,5376, 680,21760, 688,13568, 696,29952, 704,3328, 712,19712,
+   720,11520, 728,27904, 736,7424, 744,23808, 752,15616, 760,32000, 776,17152, 784,8960,
+   792,25344, 800,4864, 808,21248, 816,13056, 824,29440, 832,2816, 840,19200, 848,11008,
+   856,27392, 864,6912, 872,23296, 880,15104, 888,31488, 896,1792, 904,18176, 912,9984,
+   920,26368, 928,5888, 936,22272, 944,14080, 952,30464, 960,3840, 968,20224, 976,12032,
+   984,28416, 992,7936, 1000,24320, 1008,16128, 1016,32512, 1032,16512, 1040,8320, 1048,24704,
+   1056,4224, 1064,20608, 1072,12416, 1080,28800, 1088,2176, 1096,18560, 1104,10368, 1112,26752,
+   1120,6272, 1128,22656, 1136,14464, 1144,30848, 1160,17536, 1168,9344, 1176,25728, 1184,5248,
+   1192,21632, 1200,13440, 1208,29824, 1216,3200, 1224,19584, 1232,11392, 1240,27776, 1248,7296,
+   1256,23680, 1264,15488, 1272,31872, 1288,17024, 1296,8832, 1304,25216, 1312,4736, 1320,21120,
+   1328,12928, 1336,29312, 1344,2688, 1352,19072, 1360,10880, 1368,27264, 1376,6784, 1384,23168,
+   1392,14976, 1400,31360, 1408,1664, 1416,18048, 1424,9856, 1432,26240, 1440,5760, 1448,22144,
+   1456,13952, 1464,30336, 1472,3712, 1480,20096, 1488,11904, 1496,28288, 1504,7808, 1512,24192,
+   1520,16000, 1528,32384, 1544,16768, 1552,8576, 1560,24960, 1568,4480, 1576,20864, 1584,12672,
+   1592,29056, 1600,2432, 1608,18816, 1616,10624, 1624,27008, 1632,6528, 1640,22912, 1648,14720,
+   1656,31104, 1672,17792, 1680,9600, 1688,25984, 1696,5504, 1704,21888, 1712,13696, 1720,30080,
+   1728,3456, 1736,19840, 1744,11648, 1752,28032, 1760,7552, 1768,23936, 1776,15744, 1784,32128,
+   1800,17280, 1808,9088, 1816,25472, 1824,4992, 1832,21376, 1840,13184, 1848,29568, 1856,2944,
+   1864,19328, 1872,11136, 1880,27520, 1888,7040, 1896,23424, 1904,15232, 1912,31616, 1928,18304,
+   1936,10112, 1944,26496, 1952,6016, 1960,22400, 1968,14208, 1976,30592, 1984,3968, 1992,20352,
+   2000,12160, 2008,28544, 2016,8064, 2024,24448, 2032,16256, 2040,32640, 2056,16448, 2064,8256,
+   2072,24640, 2080,4160, 2088,20544, 2096,12352, 2104,28736, 2120,18496, 2128,10304, 2136,26688,
+   2144,6208, 2152,22592, 2160,14400, 2168,30784, 2184,17472, 2192,9280, 2200,25664, 2208,5184,
+   2216,21568, 2224,13376, 2232,29760, 2240,3136, 2248,19520, 2256,11328, 2264,27712, 2272,7232,
+   2280,23616, 2288,15424, 2296,31808, 2312,16960, 2320,8768, 2328,25152, 2336,4672, 2344,21056,
+   2352,12864, 2360,29248, 2368,2624, 2376,19008, 2384,10816, 2392,27200, 2400,6720, 2408,23104,
+   2416,14912, 2424,31296, 2440,17984, 2448,9792, 2456,26176, 2464,5696, 2472,22080, 2480,13888,
+   2488,30272, 2496,3648, 2504,20032, 2512,11840, 2520,28224, 2528,7744, 2536,24128, 2544,15936,
+   2552,32320, 2568,16704, 2576,8512, 2584,24896, 2592,4416, 2600,20800, 2608,12608, 2616,28992,
+   2632,18752, 2640,10560, 2648,26944, 2656,6464, 2664,22848, 2672,14656, 2680,31040, 2696,17728,
+   2704,9536, 2712,25920, 2720,5440, 2728,21824, 2736,13632, 2744,30016, 2752,3392, 2760,19776,
+   2768,11584, 2776,27968, 2784,7488, 2792,23872, 2800,15680, 2808,32064, 2824,17216, 2832,9024,
+   2840,25408, 2848,4928, 2856,21312, 2864,13120, 2872,29504, 2888,19264, 2896,11072, 2904,27456,
+   2912,6976, 2920,23360, 2928,15168, 2936,31552, 2952,18240, 2960,10048, 2968,26432, 2976,5952,
+   2984,22336, 2992,14144, 3000,30528, 3008,3904, 3016,20288, 3024,12096, 3032,28480, 3040,8000,
+   3048,24384, 3056,16192, 3064,32576, 3080,16576, 3088,8384, 3096,24768, 3104,4288, 3112,20672,
+   3120,12480, 3128,28864, 3144,18624, 3152,10432, 3160,26816, 3168,6336, 3176,22720, 3184,14528,
+   3192,30912, 3208,17600, 3216,9408, 3224,25792, 3232,5312, 3240,21696, 3248,13504, 3256,29888,
+   3272,19648, 3280,11456, 3288,27840, 3296,7360, 3304,23744, 3312,15552, 3320,31936, 3336,17088,
+   3344,8896, 3352,25280, 3360,4800, 3368,21184, 3376,12992, 3384,29376, 3400,19136, 3408,10944,
+   3416,27328, 3424,6848, 3432,23232, 3440,15040, 3448,31424, 3464,18112, 3472,9920, 3480,26304,
+   3488,5824, 3496,22208, 3504,14016, 3512,30400, 3520,3776, 3528,20160, 3536,11968, 3544,28352,
+   3552,7872, 3560,24256, 3568,16064, 3576,32448, 3592,16832, 3600,8640, 3608,25024, 3616,4544,
+   3624,20928, 3632,12736, 3640,29120, 3656,18880, 3664,10688, 3672,27072, 3680,6592, 3688,22976,
+   3696,14784, 3704,31168, 3720,17856, 3728,9664, 3736,26048, 3744,5568, 3752,21952, 3760,13760,
+   3768,30144, 3784,19904, 3792,11712, 3800,28096, 3808,7616, 3816,24000, 3824,15808, 3832,32192,
+   3848,17344, 3856,9152, 3864,25536, 3872,5056, 3880,21440, 3888,13248, 3896,29632, 3912,19392,
+   3920,11200, 3928,27584, 3936,7104, 3944,23488, 3952,15296, 3960,31680, 3976,18368, 3984,10176,
+   3992,26560, 4000,6080, 4008,22464, 4016,14272, 4024,30656, 4040,20416, 4048,12224, 4056,28608,
+   4064,8128, 4072,24512, 4080,16320, 4088,32704, 4104,16416, 4112,8224, 4120,24608, 4136,20512,
+   4144,12320, 4152,28704, 4168,18464, 4176,10272, 4184,26656, 4192,6176, 4200,22560, 4208,14368,
+   4216,30752, 4232,17440, 4240,9248, 4248,25632, 4256,5152, 4264,21536, 4272,13344, 4280,29728,
+   4296,19488, 4304,11296, 4312,27680, 4320,7200, 4328,23584, 4336,15392, 4344,31776, 4360,16928,
+   4368,8736, 4376,25120, 4384,4640, 4392,21024, 4400,12832, 4408,29216, 4424,18976, 4432,10784,
+   4440,27168, 4448,6688, 4456,23072, 4464,14880, 4472,31264, 4488,17952, 4496,9760, 4504,26144,
+   4512,5664, 4520,22048, 4528,13856, 4536,30240, 4552,20000, 4560,11808, 4568,28192, 4576,7712,
+   4584,24096, 4592,15904, 4600,32288, 4616,16672, 4624,8480, 4632,24864, 4648,20768, 4656,12576,
+   4664,28960, 4680,18720, 4688,10528, 4696,26912, 4704,6432, 4712,22816, 4720,14624, 4728,31008,
+   4744,17696, 4752,9504, 4760,25888, 4768,5408, 4776,21792, 4784,13600, 4792,29984, 4808,19744,
+   4816,11552, 4824,27936, 4832,7456, 4840,23840, 4848,15648, 4856,32032, 4872,17184, 4880,8992,
+   4888,25376, 4904,21280, 4912,13088, 4920,29472, 4936,19232, 4944,11040, 4952,27424, 4960,6944,
+   4968,23328, 4976,15136, 4984,31520, 5000,18208, 5008,10016, 5016,26400, 5024,5920, 5032,22304,
+   5040,14112, 5048,30496, 5064,20256, 5072,12064, 5080,28448, 5088,7968, 5096,24352, 5104,16160,
+   5112,32544, 5128,16544, 5136,8352, 5144,24736, 5160,20640, 5168,12448, 5176,28832, 5192,18592,
+   5200,10400, 5208,26784, 5216,6304, 5224,22688, 5232,14496, 5240,30880, 5256,17568, 5264,9376,
+   5272,25760, 5288,21664, 5296,13472, 5304,29856, 5320,19616, 5328,11424, 5336,27808, 5344,7328,
+   5352,23712, 5360,15520, 5368,31904, 5384,17056, 5392,8864, 5400,25248, 5416,21152, 5424,12960,
+   5432,29344, 5448,19104, 5456,10912, 5464,27296, 5472,6816, 5480,23200, 5488,15008, 5496,31392,
+   5512,18080, 5520,9888, 5528,26272, 5536,5792, 5544,22176, 5552,13984, 5560,30368, 5576,20128,
+   5584,11936, 5592,28320, 5600,7840, 5608,24224, 5616,16032, 5624,32416, 5640,16800, 5648,8608,
+   5656,24992, 5672,20896, 5680,12704, 5688,29088, 5704,18848, 5712,10656, 5720,27040, 5728,6560,
+   5736,22944, 5744,14752, 5752,31136, 5768,17824, 5776,9632, 5784,26016, 5800,21920, 5808,13728,
+   5816,30112, 5832,19872, 5840,11680, 5848,28064, 5856,7584, 5864,23968, 5872,15776, 5880,32160,
+   5896,17312, 5904,9120, 5912,25504, 5928,21408, 5936,13216, 5944,29600, 5960,19360, 5968,11168,
+   5976,27552, 5984,7072, 5992,23456, 6000,15264, 6008,31648, 6024,18336, 6032,10144, 6040,26528,
+   6056,22432, 6064,14240, 6072,30624, 6088,20384, 6096,12192, 6104,28576, 6112,8096, 6120,24480,
+   6128,16288, 6136,32672, 6152,16480, 6160,8288, 6168,24672, 6184,20576, 6192,12384, 6200,28768,
+   6216,18528, 6224,10336, 6232,26720, 6248,22624, 6256,14432, 6264,30816, 6280,17504, 6288,9312,
+   6296,25696, 6312,21600, 6320,13408, 6328,29792, 6344,19552, 6352,11360, 6360,27744, 6368,7264,
+   6376,23648, 6384,15456, 6392,31840, 6408,16992, 6416,8800, 6424,25184, 6440,21088, 6448,12896,
+   6456,29280, 6472,19040, 6480,10848, 6488,27232, 6496,6752, 6504,23136, 6512,14944, 6520,31328,
+   6536,18016, 6544,9824, 6552,26208, 6568,22112, 6576,13920, 6584,30304, 6600,20064, 6608,11872,
+   6616,28256, 6624,7776, 6632,24160, 6640,15968, 6648,32352, 6664,16736, 6672,8544, 6680,24928,
+   6696,20832, 6704,12640, 6712,29024, 6728,18784, 6736,10592, 6744,26976, 6760,22880, 6768,14688,
+   6776,31072, 6792,17760, 6800,9568, 6808,25952, 6824,21856, 6832,13664, 6840,30048, 6856,19808,
+   6864,11616, 6872,28000, 6880,7520, 6888,23904, 6896,15712, 6904,32096, 6920,17248, 6928,9056,
+   6936,25440, 6952,21344, 6960,13152, 6968,29536, 6984,19296, 6992,11104, 7000,27488, 7016,23392,
+   7024,15200, 7032,31584, 7048,18272, 7056,10080, 7064,26464, 7080,22368, 7088,14176, 7096,30560,
+   7112,20320, 7120,12128, 7128,28512, 7136,8032, 7144,24416, 7152,16224, 7160,32608, 7176,16608,
+   7184,8416, 7192,24800, 7208,20704, 7216,12512, 7224,28896, 7240,18656, 7248,10464, 7256,26848,
+   7272,22752, 7280,14560, 7288,30944, 7304,17632, 7312,9440, 7320,25824, 7336,21728, 7344,13536,
+   7352,29920, 7368,19680, 7376,11488, 7384,27872, 7400,23776, 7408,15584, 7416,31968, 7432,17120,
+   7440,8928, 7448,25312, 7464,21216, 7472,13024, 7480,29408, 7496,19168, 7504,10976, 7512,27360,
+   7528,23264, 7536,15072, 7544,31456, 7560,18144, 7568,9952, 7576,26336, 7592,22240, 7600,14048,
+   7608,30432, 7624,20192, 7632,12000, 7640,28384, 7648,7904, 7656,24288, 7664,16096, 7672,32480,
+   7688,16864, 7696,8672, 7704,25056, 7720,20960, 7728,12768, 7736,29152, 7752,18912, 7760,10720,
+   7768,27104, 7784,23008, 7792,14816, 7800,31200, 7816,17888, 7824,9696, 7832,26080, 7848,21984,
+   7856,13792, 7864,30176, 7880,19936, 7888,11744, 7896,28128, 7912,24032, 7920,15840, 7928,32224,
+   7944,17376, 7952,9184, 7960,25568, 7976,21472, 7984,13280, 7992,29664, 8008,19424, 8016,11232,
+   8024,27616, 8040,23520, 8048,15328, 8056,31712, 8072,18400, 8080,10208, 8088,26592, 8104,22496,
+   8112,14304, 8120,30688, 8136,20448, 8144,12256, 8152,28640, 8168,24544, 8176,16352, 8184,32736,
+   8200,16400, 8216,24592, 8232,20496, 8240,12304, 8248,28688, 8264,18448, 8272,10256, 8280,26640,
+   8296,22544, 8304,14352, 8312,30736, 8328,17424, 8336,9232, 8344,25616, 8360,21520, 8368,13328,
+   8376,29712, 8392,19472, 8400,11280, 8408,27664, 8424,23568, 8432,15376, 8440,31760, 8456,16912,
+   8464,8720, 8472,25104, 8488,21008, 8496,12816, 8504,29200, 8520,18960, 8528,10768, 8536,27152,
+   8552,23056, 8560,14864, 8568,31248, 8584,17936, 8592,9744, 8600,26128, 8616,22032, 8624,13840,
+   8632,30224, 8648,19984, 8656,11792, 8664,28176, 8680,24080, 8688,15888, 8696,32272, 8712,16656,
+   8728,24848, 8744,20752, 8752,12560, 8760,28944, 8776,18704, 8784,10512, 8792,26896, 8808,22800,
+   8816,14608, 8824,30992, 8840,17680, 8848,9488, 8856,25872, 8872,21776, 8880,13584, 8888,29968,
+   8904,19728, 8912,11536, 8920,27920, 8936,23824, 8944,15632, 8952,32016, 8968,17168, 8984,25360,
+   9000,21264, 9008,13072, 9016,29456, 9032,19216, 9040,11024, 9048,27408, 9064,23312, 9072,15120,
+   9080,31504, 9096,18192, 9104,10000, 9112,26384, 9128,22288, 9136,14096, 9144,30480, 9160,20240,
+   9168,12048, 9176,28432, 9192,24336, 9200,16144, 9208,32528, 9224,16528, 9240,24720, 9256,20624,
+   9264,12432, 9272,28816, 9288,18576, 9296,10384, 9304,26768, 9320,22672, 9328,14480, 9336,30864,
+   9352,17552, 9368,25744, 9384,21648, 9392,13456, 9400,29840, 9416,19600, 9424,11408, 9432,27792,
+   9448,23696, 9456,15504, 9464,31888, 9480,17040, 9496,25232, 9512,21136, 9520,12944, 9528,29328,
+   9544,19088, 9552,10896, 9560,27280, 9576,23184, 9584,14992, 9592,31376, 9608,18064, 9616,9872,
+   9624,26256, 9640,22160, 9648,13968, 9656,30352, 9672,20112, 9680,11920, 9688,28304, 9704,24208,
+   9712,16016, 9720,32400, 9736,16784, 9752,24976, 9768,20880, 9776,12688, 9784,29072, 9800,18832,
+   9808,10640, 9816,27024, 9832,22928, 9840,14736, 9848,31120, 9864,17808, 9880,26000, 9896,21904,
+   9904,13712, 9912,30096, 9928,19856, 9936,11664, 9944,28048, 9960,23952, 9968,15760, 9976,32144,
+   9992,17296, 10008,25488, 10024,21392, 10032,13200, 10040,29584, 10056,19344, 10064,11152, 10072,27536,
+   10088,23440, 10096,15248, 10104,31632, 10120,18320, 10136,26512, 10152,22416, 10160,14224, 10168,30608,
+   10184,20368, 10192,12176, 10200,28560, 10216,24464, 10224,16272, 10232,32656, 10248,16464, 10264,24656,
+   10280,20560, 10288,12368, 10296,28752, 10312,18512, 10328,26704, 10344,22608, 10352,14416, 10360,30800,
+   10376,17488, 10392,25680, 10408,21584, 10416,13392, 10424,29776, 10440,19536, 10448,11344, 10456,27728,
+   10472,23632, 10480,15440, 10488,31824, 10504,16976, 10520,25168, 10536,21072, 10544,12880, 10552,29264,
+   10568,19024, 10576,10832, 10584,27216, 10600,23120, 10608,14928, 10616,31312, 10632,18000, 10648,26192,
+   10664,22096, 10672,13904, 10680,30288, 10696,20048, 10704,11856, 10712,28240, 10728,24144, 10736,15952,
+   10744,32336, 10760,16720, 10776,24912, 10792,20816, 10800,12624, 10808,29008, 10824,18768, 10840,26960,
+   10856,22864, 10864,14672, 10872,31056, 10888,17744, 10904,25936, 10920,21840, 10928,13648, 10936,30032,
+   10952,19792, 10960,11600, 10968,27984, 10984,23888, 10992,15696, 11000,32080, 11016,17232, 11032,25424,
+   11048,21328, 11056,13136, 11064,29520, 11080,19280, 11096,27472, 11112,23376, 11120,15184, 11128,31568,
+   11144,18256, 11160,26448, 11176,22352, 11184,14160, 11192,30544, 11208,20304, 11216,12112, 11224,28496,
+   11240,24400, 11248,16208, 11256,32592, 11272,16592, 11288,24784, 11304,20688, 11312,12496, 11320,28880,
+   11336,18640, 11352,26832, 11368,22736, 11376,14544, 11384,30928, 11400,17616, 11416,25808, 11432,21712,
+   11440,13520, 11448,29904, 11464,19664, 11480,27856, 11496,23760, 11504,15568, 11512,31952, 11528,17104,
+   11544,25296, 11560,21200, 11568,13008, 11576,29392, 11592,19152, 11608,27344, 11624,23248, 11632,15056,
+   11640,31440, 11656,18128, 11672,26320, 11688,22224, 11696,14032, 11704,30416, 11720,20176, 11728,11984,
+   11736,28368, 11752,24272, 11760,16080, 11768,32464, 11784,16848, 11800,25040, 11816,20944, 11824,12752,
+   11832,29136, 11848,18896, 11864,27088, 11880,22992, 11888,14800, 11896,31184, 11912,17872, 11928,26064,
+   11944,21968, 11952,13776, 11960,30160, 11976,19920, 11992,28112, 12008,24016, 12016,15824, 12024,32208,
+   12040,17360, 12056,25552, 12072,21456, 12080,13264, 12088,29648, 12104,19408, 12120,27600, 12136,23504,
+   12144,15312, 12152,31696, 12168,18384, 12184,26576, 12200,22480, 12208,14288, 12216,30672, 12232,20432,
+   12248,28624, 12264,24528, 12272,16336, 12280,32720, 12296,16432, 12312,24624, 12328,20528, 12344,28720,
+   12360,18480, 12376,26672, 12392,22576, 12400,14384, 12408,30768, 12424,17456, 12440,25648, 12456,21552,
+   12464,13360, 12472,29744, 12488,19504, 12504,27696, 12520,23600, 12528,15408, 12536,31792, 12552,16944,
+   12568,25136, 12584,21040, 12592,12848, 12600,29232, 12616,18992, 12632,27184, 12648,23088, 12656,14896,
+   12664,31280, 12680,17968, 12696,26160, 12712,22064, 12720,13872, 12728,30256, 12744,20016, 12760,28208,
+   12776,24112, 12784,15920, 12792,32304, 12808,16688, 12824,24880, 12840,20784, 12856,28976, 12872,18736,
+   12888,26928, 12904,22832, 12912,14640, 12920,31024, 12936,17712, 12952,25904, 12968,21808, 12976,13616,
+   12984,30000, 13000,19760, 13016,27952, 13032,23856, 13040,15664, 13048,32048, 13064,17200, 13080,25392,
+   13096,21296, 13112,29488, 13128,19248, 13144,27440, 13160,23344, 13168,15152, 13176,31536, 13192,18224,
+   13208,26416, 13224,22320, 13232,14128, 13240,30512, 13256,20272, 13272,28464, 13288,24368, 13296,16176,
+   13304,32560, 13320,16560, 13336,24752, 13352,20656, 13368,28848, 13384,18608, 13400,26800, 13416,22704,
+   13424,14512, 13432,30896, 13448,17584, 13464,25776, 13480,21680, 13496,29872, 13512,19632, 13528,27824,
+   13544,23728, 13552,15536, 13560,31920, 13576,17072, 13592,25264, 13608,21168, 13624,29360, 13640,19120,
+   13656,27312, 13672,23216, 13680,15024, 13688,31408, 13704,18096, 13720,26288, 13736,22192, 13744,14000,
+   13752,30384, 13768,20144, 13784,28336, 13800,24240, 13808,16048, 13816,32432, 13832,16816, 13848,25008,
+   13864,20912, 13880,29104, 13896,18864, 13912,27056, 13928,22960, 13936,14768, 13944,31152, 13960,17840,
+   13976,26032, 13992,21936, 14008,30128, 14024,19888, 14040,28080, 14056,23984, 14064,15792, 14072,32176,
+   14088,17328, 14104,25520, 14120,21424, 14136,29616, 14152,19376, 14168,27568, 14184,23472, 14192,15280,
+   14200,31664, 14216,18352, 14232,26544, 14248,22448, 14264,30640, 14280,20400, 14296,28592, 14312,24496,
+   14320,16304, 14328,32688, 14344,16496, 14360,24688, 14376,20592, 14392,28784, 14408,18544, 14424,26736,
+   14440,22640, 14456,30832, 14472,17520, 14488,25712, 14504,21616, 14520,29808, 14536,19568, 14552,27760,
+   14568,23664, 14576,15472, 14584,31856, 14600,17008, 14616,25200, 14632,21104, 14648,29296, 14664,19056,
+   14680,27248, 14696,23152, 14704,14960, 14712,31344, 14728,18032, 14744,26224, 14760,22128, 14776,30320,
+   14792,20080, 14808,28272, 14824,24176, 14832,15984, 14840,32368, 14856,16752, 14872,24944, 14888,20848,
+   14904,29040, 14920,18800, 14936,26992, 14952,22896, 14968,31088, 14984,17776, 15000,25968, 15016,21872,
+   15032,30064, 15048,19824, 15064,28016, 15080,23920, 15088,15728, 15096,32112, 15112,17264, 15128,25456,
+   15144,21360, 15160,29552, 15176,19312, 15192,27504, 15208,23408, 15224,31600, 15240,18288, 15256,26480,
+   15272,22384, 15288,30576, 15304,20336, 15320,28528, 15336,24432, 15344,16240, 15352,32624, 15368,16624,
+   15384,24816, 15400,20720, 15416,28912, 15432,18672, 15448,26864, 15464,22768, 15480,30960, 15496,17648,
+   15512,25840, 15528,21744, 15544,29936, 15560,19696, 15576,27888, 15592,23792, 15608,31984, 15624,17136,
+   15640,25328, 15656,21232, 15672,29424, 15688,19184, 15704,27376, 15720,23280, 15736,31472, 15752,18160,
+   15768,26352, 15784,22256, 15800,30448, 15816,20208, 15832,28400, 15848,24304, 15856,16112, 15864,32496,
+   15880,16880, 15896,25072, 15912,20976, 15928,29168, 15944,18928, 15960,27120, 15976,23024, 15992,31216,
+   16008,17904, 16024,26096, 16040,22000, 16056,30192, 16072,19952, 16088,28144, 16104,24048, 16120,32240,
+   16136,17392, 16152,25584, 16168,21488, 16184,29680, 16200,19440, 16216,27632, 16232,23536, 16248,31728,
+   16264,18416, 16280,26608, 16296,22512, 16312,30704, 16328,20464, 16344,28656, 16360,24560, 16376,32752,
+   16408,24584, 16424,20488, 16440,28680, 16456,18440, 16472,26632, 16488,22536, 16504,30728, 16520,17416,
+   16536,25608, 16552,21512, 16568,29704, 16584,19464, 16600,27656, 16616,23560, 16632,31752, 16648,16904,
+   16664,25096, 16680,21000, 16696,29192, 16712,18952, 16728,27144, 16744,23048, 16760,31240, 16776,17928,
+   16792,26120, 16808,22024, 16824,30216, 16840,19976, 16856,28168, 16872,24072, 16888,32264, 16920,24840,
+   16936,20744, 16952,28936, 16968,18696, 16984,26888, 17000,22792, 17016,30984, 17032,17672, 17048,25864,
+   17064,21768, 17080,29960, 17096,19720, 17112,27912, 17128,23816, 17144,32008, 17176,25352, 17192,21256,
+   17208,29448, 17224,19208, 17240,27400, 17256,23304, 17272,31496, 17288,18184, 17304,26376, 17320,22280,
+   17336,30472, 17352,20232, 17368,28424, 17384,24328, 17400,32520, 17432,24712, 17448,20616, 17464,28808,
+   17480,18568, 17496,26760, 17512,22664, 17528,30856, 17560,25736, 17576,21640, 17592,29832, 17608,19592,
+   17624,27784, 17640,23688, 17656,31880, 17688,25224, 17704,21128, 17720,29320, 17736,19080, 17752,27272,
+   17768,23176, 17784,31368, 17800,18056, 17816,26248, 17832,22152, 17848,30344, 17864,20104, 17880,28296,
+   17896,24200, 17912,32392, 17944,24968, 17960,20872, 17976,29064, 17992,18824, 18008,27016, 18024,22920,
+   18040,31112, 18072,25992, 18088,21896, 18104,30088, 18120,19848, 18136,28040, 18152,23944, 18168,32136,
+   18200,25480, 18216,21384, 18232,29576, 18248,19336, 18264,27528, 18280,23432, 18296,31624, 18328,26504,
+   18344,22408, 18360,30600, 18376,20360, 18392,28552, 18408,24456, 18424,32648, 18456,24648, 18472,20552,
+   18488,28744, 18520,26696, 18536,22600, 18552,30792, 18584,25672, 18600,21576, 18616,29768, 18632,19528,
+   18648,27720, 18664,23624, 18680,31816, 18712,25160, 18728,21064, 18744,29256, 18760,19016, 18776,27208,
+   18792,23112, 18808,31304, 18840,26184, 18856,22088, 18872,30280, 18888,20040, 18904,28232, 18920,24136,
+   18936,32328, 18968,24904, 18984,20808, 19000,29000, 19032,26952, 19048,22856, 19064,31048, 19096,25928,
+   19112,21832, 19128,30024, 19144,19784, 19160,27976, 19176,23880, 19192,32072, 19224,25416, 19240,21320,
+   19256,29512, 19288,27464, 19304,23368, 19320,31560, 19352,26440, 19368,22344, 19384,30536, 19400,20296,
+   19416,28488, 19432,24392, 19448,32584, 19480,24776, 19496,20680, 19512,28872, 19544,26824, 19560,22728,
+   19576,30920, 19608,25800, 19624,21704, 19640,29896, 19672,27848, 19688,23752, 19704,31944, 19736,25288,
+   19752,21192, 19768,29384, 19800,27336, 19816,23240, 19832,31432, 19864,26312, 19880,22216, 19896,30408,
+   19912,20168, 19928,28360, 19944,24264, 19960,32456, 19992,25032, 20008,20936, 20024,29128, 20056,27080,
+   20072,22984, 20088,31176, 20120,26056, 20136,21960, 20152,30152, 20184,28104, 20200,24008, 20216,32200,
+   20248,25544, 20264,21448, 20280,29640, 20312,27592, 20328,23496, 20344,31688, 20376,26568, 20392,22472,
+   20408,30664, 20440,28616, 20456,24520, 20472,32712, 20504,24616, 20536,28712, 20568,26664, 20584,22568,
+   20600,30760, 20632,25640, 20648,21544, 20664,29736, 20696,27688, 20712,23592, 20728,31784, 20760,25128,
+   20776,21032, 20792,29224, 20824,27176, 20840,23080, 20856,31272, 20888,26152, 20904,22056, 20920,30248,
+   20952,28200, 20968,24104, 20984,32296, 21016,24872, 21048,28968, 21080,26920, 21096,22824, 21112,31016,
+   21144,25896, 21160,21800, 21176,29992, 21208,27944, 21224,23848, 21240,32040, 21272,25384, 21304,29480,
+   21336,27432, 21352,23336, 21368,31528, 21400,26408, 21416,22312, 21432,30504, 21464,28456, 21480,24360,
+   21496,32552, 21528,24744, 21560,28840, 21592,26792, 21608,22696, 21624,30888, 21656,25768, 21688,29864,
+   21720,27816, 21736,23720, 21752,31912, 21784,25256, 21816,29352, 21848,27304, 21864,23208, 21880,31400,
+   21912,26280, 21928,22184, 21944,30376, 21976,28328, 21992,24232, 22008,32424, 22040,25000, 22072,29096,
+   22104,27048, 22120,22952, 22136,31144, 22168,26024, 22200,30120, 22232,28072, 22248,23976, 22264,32168,
+   22296,25512, 22328,29608, 22360,27560, 22376,23464, 22392,31656, 22424,26536, 22456,30632, 22488,28584,
+   22504,24488, 22520,32680, 22552,24680, 22584,28776, 22616,26728, 22648,30824, 22680,25704, 22712,29800,
+   22744,27752, 22760,23656, 22776,31848, 22808,25192, 22840,29288, 22872,27240, 22888,23144, 22904,31336,
+   22936,26216, 22968,30312, 23000,28264, 23016,24168, 23032,32360, 23064,24936, 23096,29032, 23128,26984,
+   23160,31080, 23192,25960, 23224,30056, 23256,28008, 23272,23912, 23288,32104, 23320,25448, 23352,29544,
+   23384,27496, 23416,31592, 23448,26472, 23480,30568, 23512,28520, 23528,24424, 23544,32616, 23576,24808,
+   23608,28904, 23640,26856, 23672,30952, 23704,25832, 23736,29928, 23768,27880, 23800,31976, 23832,25320,
+   23864,29416, 23896,27368, 23928,31464, 23960,26344, 23992,30440, 24024,28392, 24040,24296, 24056,32488,
+   24088,25064, 24120,29160, 24152,27112, 24184,31208, 24216,26088, 24248,30184, 24280,28136, 24312,32232,
+   24344,25576, 24376,29672, 24408,27624, 24440,31720, 24472,26600, 24504,30696, 24536,28648, 24568,32744,
+   24632,28696, 24664,26648, 24696,30744, 24728,25624, 24760,29720, 24792,27672, 24824,31768, 24856,25112,
+   24888,29208, 24920,27160, 24952,31256, 24984,26136, 25016,30232, 25048,28184, 25080,32280, 25144,28952,
+   25176,26904, 25208,31000, 25240,25880, 25272,29976, 25304,27928, 25336,32024, 25400,29464, 25432,27416,
+   25464,31512, 25496,26392, 25528,30488, 25560,28440, 25592,32536, 25656,28824, 25688,26776, 25720,30872,
+   25784,29848, 25816,27800, 25848,31896, 25912,29336, 25944,27288, 25976,31384, 26008,26264, 26040,30360,
+   26072,28312, 26104,32408, 26168,29080, 26200,27032, 26232,31128, 26296,30104, 26328,28056, 26360,32152,
+   26424,29592, 26456,27544, 26488,31640, 26552,30616, 26584,28568, 26616,32664, 26680,28760, 26744,30808,
+   26808,29784, 26840,27736, 26872,31832, 26936,29272, 26968,27224, 27000,31320, 27064,30296, 27096,28248,
+   27128,32344, 27192,29016, 27256,31064, 27320,30040, 27352,27992, 27384,32088, 27448,29528, 27512,31576,
+   27576,30552, 27608,28504, 27640,32600, 27704,28888, 27768,30936, 27832,29912, 27896,31960, 27960,29400,
+   28024,31448, 28088,30424, 28120,28376, 28152,32472, 28216,29144, 28280,31192, 28344,30168, 28408,32216,
+   28472,29656, 28536,31704, 28600,30680, 28664,32728, 28792,30776, 28856,29752, 28920,31800, 28984,29240,
+   29048,31288, 29112,30264, 29176,32312, 29304,31032, 29368,30008, 29432,32056, 29560,31544, 29624,30520,
+   29688,32568, 29816,30904, 29944,31928, 30072,31416, 30136,30392, 30200,32440, 30328,31160, 30456,32184,
+   30584,31672, 30712,32696, 30968,31864, 31096,31352, 31224,32376, 31480,32120, 31736,32632, 32248,32504
+};
+
+/**    
+ * @} end of CFFT_CIFFT group    
+ */
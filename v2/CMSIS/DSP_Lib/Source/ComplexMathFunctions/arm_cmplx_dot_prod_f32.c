@@ -93,6 +93,7 @@ void arm_cmplx_dot_prod_f32(
   float32_t * imagResult)
 {
   float32_t real_sum = 0.0f, imag_sum = 0.0f;    /* Temporary result storage */
+  float32_t a0, a1, b0, b1;                      /* Temporary input storage */
 
 #ifndef ARM_MATH_CM0_FAMILY
 
@@ -106,19 +107,57 @@ void arm_cmplx_dot_prod_f32(
    ** a second loop below computes the remaining 1 to 3 samples. */
   while(blkCnt > 0u)
   {
-    /* CReal = A[0]* B[0] + A[2]* B[2] + A[4]* B[4] + .....+ A[numSamples-2]* B[numSamples-2] */
-    real_sum += (*pSrcA++) * (*pSrcB++);
-    /* CImag = A[1]* B[1] + A[3]* B[3] + A[5]* B[5] + .....+ A[numSamples-1]* B[numSamples-1] */
-    imag_sum += (*pSrcA++) * (*pSrcB++);
-
-    real_sum += (*pSrcA++) * (*pSrcB++);
-    imag_sum += (*pSrcA++) * (*pSrcB++);
-
-    real_sum += (*pSrcA++) * (*pSrcB++);
-    imag_sum += (*pSrcA++) * (*pSrcB++);
-
-    real_sum += (*pSrcA++) * (*pSrcB++);
-    imag_sum += (*pSrcA++) * (*pSrcB++);
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += a0 * b0;
+    real_sum -= a1 * b1;
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += a0 * b1;
+    imag_sum += a1 * b0;
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += a0 * b0;
+    real_sum -= a1 * b1;
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += a0 * b1;
+    imag_sum += a1 * b0;
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += a0 * b0;
+    real_sum -= a1 * b1;
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += a0 * b1;
+    imag_sum += a1 * b0;
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += a0 * b0;
+    real_sum -= a1 * b1;
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += a0 * b1;
+    imag_sum += a1 * b0;
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -130,11 +169,18 @@ void arm_cmplx_dot_prod_f32(
 
   while(blkCnt > 0u)
   {
-    /* CReal = A[0]* B[0] + A[2]* B[2] + A[4]* B[4] + .....+ A[numSamples-2]* B[numSamples-2] */
-    real_sum += (*pSrcA++) * (*pSrcB++);
-    /* CImag = A[1]* B[1] + A[3]* B[3] + A[5]* B[5] + .....+ A[numSamples-1]* B[numSamples-1] */
-    imag_sum += (*pSrcA++) * (*pSrcB++);
-
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += a0 * b0;
+    real_sum -= a1 * b1;
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += a0 * b1;
+    imag_sum += a1 * b0;
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -146,11 +192,18 @@ void arm_cmplx_dot_prod_f32(
 
   while(numSamples > 0u)
   {
-    /* CReal = A[0]* B[0] + A[2]* B[2] + A[4]* B[4] + .....+ A[numSamples-2]* B[numSamples-2] */
-    real_sum += (*pSrcA++) * (*pSrcB++);
-    /* CImag = A[1]* B[1] + A[3]* B[3] + A[5]* B[5] + .....+ A[numSamples-1]* B[numSamples-1] */
-    imag_sum += (*pSrcA++) * (*pSrcB++);
-
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += a0 * b0;
+    real_sum -= a1 * b1;
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += a0 * b1;
+    imag_sum += a1 * b0;
 
     /* Decrement the loop counter */
     numSamples--;
@@ -75,6 +75,7 @@ void arm_cmplx_dot_prod_q15(
   q31_t * imagResult)
 {
   q63_t real_sum = 0, imag_sum = 0;              /* Temporary result storage */
+  q15_t a0, a1, b0, b1;                          /* Temporary input storage */
 
 #ifndef ARM_MATH_CM0_FAMILY
 
@@ -89,20 +90,57 @@ void arm_cmplx_dot_prod_q15(
    ** a second loop below computes the remaining 1 to 3 samples. */
   while(blkCnt > 0u)
   {
-    /* CReal = A[0]* B[0] + A[2]* B[2] + A[4]* B[4] + .....+ A[numSamples-2]* B[numSamples-2] */
-    real_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-
-    /* CImag = A[1]* B[1] + A[3]* B[3] + A[5]* B[5] + .....+ A[numSamples-1]* B[numSamples-1] */
-    imag_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-
-    real_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-    imag_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-
-    real_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-    imag_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-
-    real_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-    imag_sum += ((q31_t) * pSrcA++ * *pSrcB++);
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += ((q31_t) a0 * b0);
+    real_sum -= ((q31_t) a1 * b1);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += ((q31_t) a0 * b1);
+    imag_sum += ((q31_t) a1 * b0);
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += ((q31_t) a0 * b0);
+    real_sum -= ((q31_t) a1 * b1);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += ((q31_t) a0 * b1);
+    imag_sum += ((q31_t) a1 * b0);
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += ((q31_t) a0 * b0);
+    real_sum -= ((q31_t) a1 * b1);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += ((q31_t) a0 * b1);
+    imag_sum += ((q31_t) a1 * b0);
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += ((q31_t) a0 * b0);
+    real_sum -= ((q31_t) a1 * b1);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += ((q31_t) a0 * b1);
+    imag_sum += ((q31_t) a1 * b0);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -114,10 +152,18 @@ void arm_cmplx_dot_prod_q15(
 
   while(blkCnt > 0u)
   {
-    /* CReal = A[0]* B[0] + A[2]* B[2] + A[4]* B[4] + .....+ A[numSamples-2]* B[numSamples-2] */
-    real_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-    /* CImag = A[1]* B[1] + A[3]* B[3] + A[5]* B[5] + .....+ A[numSamples-1]* B[numSamples-1] */
-    imag_sum += ((q31_t) * pSrcA++ * *pSrcB++);
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += ((q31_t) a0 * b0);
+    real_sum -= ((q31_t) a1 * b1);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += ((q31_t) a0 * b1);
+    imag_sum += ((q31_t) a1 * b0);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -129,10 +175,18 @@ void arm_cmplx_dot_prod_q15(
 
   while(numSamples > 0u)
   {
-    /* CReal = A[0]* B[0] + A[2]* B[2] + A[4]* B[4] + .....+ A[numSamples-2]* B[numSamples-2] */
-    real_sum += ((q31_t) * pSrcA++ * *pSrcB++);
-    /* CImag = A[1]* B[1] + A[3]* B[3] + A[5]* B[5] + .....+ A[numSamples-1]* B[numSamples-1] */
-    imag_sum += ((q31_t) * pSrcA++ * *pSrcB++);
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += ((q31_t) a0 * b0);
+    real_sum -= ((q31_t) a1 * b1);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += ((q31_t) a0 * b1);
+    imag_sum += ((q31_t) a1 * b0);
 
     /* Decrement the loop counter */
     numSamples--;
@@ -142,9 +196,9 @@ void arm_cmplx_dot_prod_q15(
 
   /* Store the real and imaginary results in 8.24 format  */
   /* Convert real data in 34.30 to 8.24 by 6 right shifts */
-  *realResult = (q31_t) (real_sum) >> 6;
+  *realResult = (q31_t) (real_sum >> 6);
   /* Convert imaginary data in 34.30 to 8.24 by 6 right shifts */
-  *imagResult = (q31_t) (imag_sum) >> 6;
+  *imagResult = (q31_t) (imag_sum >> 6);
 }
 
 /**    
@@ -63,7 +63,7 @@
  * The function is implemented using an internal 64-bit accumulator.    
  * The intermediate 1.31 by 1.31 multiplications are performed with 64-bit precision and then shifted to 16.48 format.    
  * The internal real and imaginary accumulators are in 16.48 format and provide 15 guard bits.    
- * Additions are nonsaturating and no overflow will occur as long as <code>numSamples</code> is less than 32768.    
+ * Additions are nonsaturating and no overflow will occur as long as <code>numSamples</code> is less than 16384.    
  * The return results <code>realResult</code> and <code>imagResult</code> are in 16.48 format.    
  * Input down scaling is not required.    
  */
@@ -76,6 +76,7 @@ void arm_cmplx_dot_prod_q31(
   q63_t * imagResult)
 {
   q63_t real_sum = 0, imag_sum = 0;              /* Temporary result storage */
+  q31_t a0, a1, b0, b1;                          /* Temporary input storage */
 
 #ifndef ARM_MATH_CM0_FAMILY
 
@@ -90,22 +91,57 @@ void arm_cmplx_dot_prod_q31(
    ** a second loop below computes the remaining 1 to 3 samples. */
   while(blkCnt > 0u)
   {
-    /* CReal = A[0]* B[0] + A[2]* B[2] + A[4]* B[4] + .....+ A[numSamples-2]* B[numSamples-2] */
-    /* Convert real data in 2.62 to 16.48 by 14 right shifts */
-    real_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-    /* CImag = A[1]* B[1] + A[3]* B[3] + A[5]* B[5] + .....+ A[numSamples-1]* B[numSamples-1] */
-    /* Convert imag data in 2.62 to 16.48 by 14 right shifts */
-    imag_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-
-    real_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-    imag_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-
-    real_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-    imag_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-
-    real_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-    imag_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += (((q63_t) a0 * b0) >> 14);
+    real_sum -= (((q63_t) a1 * b1) >> 14);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += (((q63_t) a0 * b1) >> 14);
+    imag_sum += (((q63_t) a1 * b0) >> 14);
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += (((q63_t) a0 * b0) >> 14);
+    real_sum -= (((q63_t) a1 * b1) >> 14);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += (((q63_t) a0 * b1) >> 14);
+    imag_sum += (((q63_t) a1 * b0) >> 14);
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += (((q63_t) a0 * b0) >> 14);
+    real_sum -= (((q63_t) a1 * b1) >> 14);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += (((q63_t) a0 * b1) >> 14);
+    imag_sum += (((q63_t) a1 * b0) >> 14);
+
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += (((q63_t) a0 * b0) >> 14);
+    real_sum -= (((q63_t) a1 * b1) >> 14);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += (((q63_t) a0 * b1) >> 14);
+    imag_sum += (((q63_t) a1 * b0) >> 14);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -117,10 +153,18 @@ void arm_cmplx_dot_prod_q31(
 
   while(blkCnt > 0u)
   {
-    /* CReal = A[0]* B[0] + A[2]* B[2] + A[4]* B[4] + .....+ A[numSamples-2]* B[numSamples-2] */
-    real_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-    /* CImag = A[1]* B[1] + A[3]* B[3] + A[5]* B[5] + .....+ A[numSamples-1]* B[numSamples-1] */
-    imag_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += (((q63_t) a0 * b0) >> 14);
+    real_sum -= (((q63_t) a1 * b1) >> 14);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += (((q63_t) a0 * b1) >> 14);
+    imag_sum += (((q63_t) a1 * b0) >> 14);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -132,10 +176,18 @@ void arm_cmplx_dot_prod_q31(
 
   while(numSamples > 0u)
   {
-    /* outReal = realA[0]* realB[0] + realA[2]* realB[2] + realA[4]* realB[4] + .....+ realA[numSamples-2]* realB[numSamples-2] */
-    real_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
-    /* outImag = imagA[1]* imagB[1] + imagA[3]* imagB[3] + imagA[5]* imagB[5] + .....+ imagA[numSamples-1]* imagB[numSamples-1] */
-    imag_sum += (q63_t) * pSrcA++ * (*pSrcB++) >> 14;
+    /* Read the real and imaginary parts of the inputs */
+    a0 = *pSrcA++;
+    a1 = *pSrcA++;
+    b0 = *pSrcB++;
+    b1 = *pSrcB++;
+
+    /* CReal += A[2n] * B[2n] - A[2n+1] * B[2n+1] */
+    real_sum += (((q63_t) a0 * b0) >> 14);
+    real_sum -= (((q63_t) a1 * b1) >> 14);
+    /* CImag += A[2n] * B[2n+1] + A[2n+1] * B[2n] */
+    imag_sum += (((q63_t) a0 * b1) >> 14);
+    imag_sum += (((q63_t) a1 * b0) >> 14);
 
     /* Decrement the loop counter */
     numSamples--;
@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_kalman_f32.c
+*
+* Description:  Floating-point linear Kalman filter predict and update steps.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup Kalman Linear Kalman Filter
+ *
+ * Estimates the state of a linear system from noisy measurements. The
+ * system and the measurements are described by
+ * <pre>
+ *     x[n] = F * x[n-1] + w[n]        w with covariance Q
+ *     z[n] = H * x[n] + v[n]          v with covariance R
+ * </pre>
+ * for <code>N</code> state variables and <code>M</code> measurements.
+ * The filter keeps the estimate <code>x</code> and its covariance
+ * <code>P</code>.
+ *
+ * \par Algorithm
+ * <code>arm_kalman_predict</code> moves the estimate one step on:
+ * <pre>
+ *     x = F * x
+ *     P = F * P * F' + Q
+ * </pre>
+ * <code>arm_kalman_update</code> corrects it with a measurement
+ * <code>z</code>:
+ * <pre>
+ *     y = z - H * x
+ *     S = H * P * H' + R
+ *     K = P * H' * inv(S)
+ *     x = x + K * y
+ *     P = P - K * H * P
+ * </pre>
+ * The inverse is not formed: <code>S</code> is symmetric positive definite,
+ * so the update factors it with <code>arm_mat_cholesky</code> and solves
+ * <code>S * K' = H * P</code> for the gain. Only the lower triangle of
+ * <code>P</code> is computed and then mirrored, which halves the work
+ * and keeps <code>P</code> exactly symmetric. If <code>S</code> is not
+ * positive definite the update returns <code>ARM_MATH_SINGULAR</code>
+ * and leaves <code>x</code> and <code>P</code> as they were.
+ *
+ * \par
+ * All matrices are arrays in row order, as in the matrix structures.
+ * Control inputs can be added to <code>x</code> between the predict and
+ * update calls.
+ *
+ * \par Memory
+ * The filter allocates no memory. The caller provides the matrices and a
+ * work buffer of <code>ARM_KALMAN_WORK_SIZE(N, M)</code> values, which can
+ * be sized at compile time:
+ * <pre>
+ *     \#define NUM_STATES  4
+ *     \#define NUM_MEAS    2
+ *     float32_t work[ARM_KALMAN_WORK_SIZE(NUM_STATES, NUM_MEAS)];
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * In the Q31 filter <code>x</code>, <code>z</code>, <code>P</code>,
+ * <code>Q</code> and <code>R</code> are in 1.31 format. <code>F</code>
+ * and <code>H</code> often have elements of 1 or more, so they are given
+ * divided by <code>2^postShift</code>, and the products are shifted back
+ * up. The gain <code>K</code> is kept in the same format as
+ * <code>H</code>. Dot products are accumulated in 2.62 format and results
+ * saturated to 1.31 format. Choose the units of the state and the
+ * measurements so that <code>P</code> and <code>S</code> stay below 1.
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Prediction step of the floating-point Kalman filter.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @return none.
+ */
+
+void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S)
+{
+  uint16_t n = S->numStates;                     /* number of state variables */
+  float32_t *pF = S->pF;                         /* state transition matrix */
+  float32_t *pP = S->pP;                         /* estimate covariance */
+  float32_t *pT = S->pWork;                      /* F * P, N x N */
+  float32_t *pXt = pT + ((uint32_t) n * n);      /* F * x, N values */
+  float32_t sum;                                 /* accumulator */
+  uint32_t i, j;                                 /* loop counters */
+
+  /* x = F * x */
+  for (i = 0u; i < n; i++)
+  {
+    arm_dot_prod_f32(pF + (i * n), S->pX, n, &pXt[i]);
+  }
+
+  memcpy(S->pX, pXt, n * sizeof(float32_t));
+
+  /* F * P, with column j of P read as row j as P is symmetric */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      arm_dot_prod_f32(pF + (i * n), pP + (j * n), n, &pT[(i * n) + j]);
+    }
+  }
+
+  /* P = F * P * F' + Q, the lower triangle mirrored */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      arm_dot_prod_f32(pT + (i * n), pF + (j * n), n, &sum);
+      sum += S->pQ[(i * n) + j];
+      pP[(i * n) + j] = sum;
+      pP[(j * n) + i] = sum;
+    }
+  }
+}
+
+/**
+ * @brief  Measurement update step of the floating-point Kalman filter.
+ * @param[in,out] *S  points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     *pZ points to the measurement vector of <code>numMeas</code> values.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the innovation covariance
+ * is not positive definite and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ)
+{
+  float32_t *pH = S->pH;                         /* measurement matrix */
+  float32_t *pP = S->pP;                         /* estimate covariance */
+  float32_t *pX = S->pX;                         /* state estimate */
+  uint16_t n = S->numStates;                     /* number of state variables */
+  uint16_t m = S->numMeas;                       /* number of measurements */
+  float32_t *pHP = S->pWork;                     /* H * P, M x N */
+  float32_t *pKt = pHP + ((uint32_t) m * n);     /* K', M x N */
+  float32_t *pS = pKt + ((uint32_t) m * n);      /* S and its factor, M x M */
+  float32_t *pY = pS + ((uint32_t) m * m);       /* innovation, M values */
+  float32_t sum;                                 /* accumulator */
+  arm_matrix_instance_f32 matS, matK;            /* matrix structures of S and K' */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the factorization */
+
+  /* H * P, with column j of P read as row j as P is symmetric */
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      arm_dot_prod_f32(pH + (i * n), pP + (j * n), n, &pHP[(i * n) + j]);
+    }
+  }
+
+  /* S = H * P * H' + R, the lower triangle is all the factorization reads */
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      arm_dot_prod_f32(pHP + (i * n), pH + (j * n), n, &sum);
+      pS[(i * m) + j] = sum + S->pR[(i * m) + j];
+    }
+
+    /* y = z - H * x */
+    arm_dot_prod_f32(pH + (i * n), pX, n, &sum);
+    pY[i] = pZ[i] - sum;
+  }
+
+  /* K' = inv(S) * H * P from the Cholesky factor of S */
+  arm_mat_init_f32(&matS, m, m, pS);
+  arm_mat_init_f32(&matK, m, n, pKt);
+  memcpy(pKt, pHP, (uint32_t) m * n * sizeof(float32_t));
+
+  status = arm_mat_cholesky_f32(&matS, &matS);
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    status = arm_mat_cholesky_solve_f32(&matS, &matK, &matK);
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      /* x = x + K * y */
+      sum = 0.0f;
+
+      for (k = 0u; k < m; k++)
+      {
+        sum += pKt[(k * n) + j] * pY[k];
+      }
+
+      pX[j] += sum;
+    }
+
+    /* P = P - K * H * P, the lower triangle mirrored */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j <= i; j++)
+      {
+        sum = pP[(i * n) + j];
+
+        for (k = 0u; k < m; k++)
+        {
+          sum -= pKt[(k * n) + i] * pHP[(k * n) + j];
+        }
+
+        pP[(i * n) + j] = sum;
+        pP[(j * n) + i] = sum;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
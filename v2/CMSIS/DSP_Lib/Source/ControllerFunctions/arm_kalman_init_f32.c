@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_kalman_init_f32.c
+*
+* Description:  Floating-point linear Kalman filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Kalman filter.
+ * @param[in,out] *S          points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     numStates   number of state variables N.
+ * @param[in]     numMeas     number of measurements M.
+ * @param[in]     *pF         points to the N x N state transition matrix.
+ * @param[in]     *pQ         points to the N x N process noise covariance.
+ * @param[in]     *pH         points to the M x N measurement matrix.
+ * @param[in]     *pR         points to the M x M measurement noise covariance.
+ * @param[in]     *pX         points to the state estimate of N values.
+ * @param[in]     *pP         points to the N x N estimate covariance.
+ * @param[in]     *pWork      points to a work buffer of <code>ARM_KALMAN_WORK_SIZE(N, M)</code> values.
+ * @return The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numStates</code>
+ * or <code>numMeas</code> is zero and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par Description:
+ * The filter starts from the estimate in <code>pX</code> and
+ * <code>pP</code>, which the caller sets; they are not changed here.
+ */
+
+arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pF,
+  float32_t * pQ,
+  float32_t * pH,
+  float32_t * pR,
+  float32_t * pX,
+  float32_t * pP,
+  float32_t * pWork)
+{
+  arm_status status;
+
+  if((numStates == 0u) || (numMeas == 0u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the sizes */
+    S->numStates = numStates;
+    S->numMeas = numMeas;
+
+    /* Assign the model matrices */
+    S->pF = pF;
+    S->pQ = pQ;
+    S->pH = pH;
+    S->pR = pR;
+
+    /* Assign the estimate and the work buffer */
+    S->pX = pX;
+    S->pP = pP;
+    S->pWork = pWork;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_kalman_q31.c
+*
+* Description:  Q31 linear Kalman filter predict and update steps.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Dot product of two Q31 vectors in 2.62 format.
+ */
+static q63_t arm_kalman_dot_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  uint32_t blockSize)
+{
+  q63_t sum = 0;                                 /* accumulator */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    sum += (q63_t) pSrcA[0] * pSrcB[0];
+    sum += (q63_t) pSrcA[1] * pSrcB[1];
+    sum += (q63_t) pSrcA[2] * pSrcB[2];
+    sum += (q63_t) pSrcA[3] * pSrcB[3];
+    pSrcA += 4u;
+    pSrcB += 4u;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    sum += (q63_t) * pSrcA++ * *pSrcB++;
+    blkCnt--;
+  }
+
+  return (sum);
+}
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Prediction step of the Q31 Kalman filter.
+ * @param[in,out] *S points to an instance of the Q31 Kalman filter structure.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * <code>F * P</code> is kept divided by <code>2^postShift</code>; the
+ * new <code>x</code> and <code>P</code> are shifted back up and saturated
+ * to 1.31 format.
+ */
+
+void arm_kalman_predict_q31(
+  arm_kalman_instance_q31 * S)
+{
+  uint16_t n = S->numStates;                     /* number of state variables */
+  q31_t *pF = S->pF;                             /* state transition matrix */
+  q31_t *pP = S->pP;                             /* estimate covariance */
+  q31_t *pT = S->pWork;                          /* F * P, N x N */
+  q31_t *pXt = pT + ((uint32_t) n * n);          /* F * x, N values */
+  uint32_t shift1 = 31u - S->postShift;          /* shift of the products with F */
+  uint32_t shift2 = 31u - (2u * S->postShift);   /* shift of the products with F twice */
+  q31_t out;                                     /* result */
+  uint32_t i, j;                                 /* loop counters */
+
+  /* x = F * x */
+  for (i = 0u; i < n; i++)
+  {
+    pXt[i] = clip_q63_to_q31(arm_kalman_dot_q31(pF + (i * n), S->pX, n) >> shift1);
+  }
+
+  memcpy(S->pX, pXt, n * sizeof(q31_t));
+
+  /* F * P / 2^postShift, with column j of P read as row j as P is symmetric */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      pT[(i * n) + j] = clip_q63_to_q31(arm_kalman_dot_q31(pF + (i * n), pP + (j * n), n) >> 31);
+    }
+  }
+
+  /* P = F * P * F' + Q, the lower triangle mirrored */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      out = clip_q63_to_q31((arm_kalman_dot_q31(pT + (i * n), pF + (j * n), n) >> shift2)
+                            + S->pQ[(i * n) + j]);
+      pP[(i * n) + j] = out;
+      pP[(j * n) + i] = out;
+    }
+  }
+}
+
+/**
+ * @brief  Measurement update step of the Q31 Kalman filter.
+ * @param[in,out] *S  points to an instance of the Q31 Kalman filter structure.
+ * @param[in]     *pZ points to the measurement vector of <code>numMeas</code> values.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the innovation covariance
+ * is not positive definite and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * <code>H * P</code> and the gain are kept divided by
+ * <code>2^postShift</code>. The gain saturates if <code>K</code> is
+ * <code>2^postShift</code> or more in magnitude.
+ */
+
+arm_status arm_kalman_update_q31(
+  arm_kalman_instance_q31 * S,
+  q31_t * pZ)
+{
+  q31_t *pH = S->pH;                             /* measurement matrix */
+  q31_t *pP = S->pP;                             /* estimate covariance */
+  q31_t *pX = S->pX;                             /* state estimate */
+  uint16_t n = S->numStates;                     /* number of state variables */
+  uint16_t m = S->numMeas;                       /* number of measurements */
+  q31_t *pHP = S->pWork;                         /* H * P, M x N */
+  q31_t *pKt = pHP + ((uint32_t) m * n);         /* K', M x N */
+  q31_t *pS = pKt + ((uint32_t) m * n);          /* S and its factor, M x M */
+  q31_t *pY = pS + ((uint32_t) m * m);           /* innovation, M values */
+  uint32_t shift1 = 31u - S->postShift;          /* shift of the products with H or K */
+  uint32_t shift2 = 31u - (2u * S->postShift);   /* shift of the products with H and K */
+  q63_t sum;                                     /* accumulator */
+  q31_t out;                                     /* result */
+  arm_matrix_instance_q31 matS, matK;            /* matrix structures of S and K' */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the factorization */
+
+  /* H * P / 2^postShift, with column j of P read as row j as P is symmetric */
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      pHP[(i * n) + j] = clip_q63_to_q31(arm_kalman_dot_q31(pH + (i * n), pP + (j * n), n) >> 31);
+    }
+  }
+
+  /* S = H * P * H' + R, the lower triangle is all the factorization reads */
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      pS[(i * m) + j] = clip_q63_to_q31((arm_kalman_dot_q31(pHP + (i * n), pH + (j * n), n) >> shift2)
+                                        + S->pR[(i * m) + j]);
+    }
+
+    /* y = z - H * x */
+    pY[i] = clip_q63_to_q31((q63_t) pZ[i] - (arm_kalman_dot_q31(pH + (i * n), pX, n) >> shift1));
+  }
+
+  /* K' / 2^postShift = inv(S) * H * P / 2^postShift from the Cholesky factor of S */
+  arm_mat_init_q31(&matS, m, m, pS);
+  arm_mat_init_q31(&matK, m, n, pKt);
+  memcpy(pKt, pHP, (uint32_t) m * n * sizeof(q31_t));
+
+  status = arm_mat_cholesky_q31(&matS, &matS);
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    status = arm_mat_cholesky_solve_q31(&matS, &matK, &matK);
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      /* x = x + K * y */
+      sum = 0;
+
+      for (k = 0u; k < m; k++)
+      {
+        sum += (q63_t) pKt[(k * n) + j] * pY[k];
+      }
+
+      pX[j] = clip_q63_to_q31((q63_t) pX[j] + (sum >> shift1));
+    }
+
+    /* P = P - K * H * P, the lower triangle mirrored */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j <= i; j++)
+      {
+        sum = 0;
+
+        for (k = 0u; k < m; k++)
+        {
+          sum += (q63_t) pKt[(k * n) + i] * pHP[(k * n) + j];
+        }
+
+        out = clip_q63_to_q31((q63_t) pP[(i * n) + j] - (sum >> shift2));
+        pP[(i * n) + j] = out;
+        pP[(j * n) + i] = out;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -50,7 +50,7 @@
 * This set of functions implements arbitrary order recursive (IIR) filters using a transposed direct form II structure.       
 * The filters are implemented as a cascade of second order Biquad sections.       
 * These functions provide a slight memory savings as compared to the direct form I Biquad filter functions.      
-* Only floating-point data is supported.       
+* Floating-point, Q31 and Q15 data types are supported.       
 *       
 * This function operate on blocks of input and output data and each call to the function       
 * processes <code>blockSize</code> samples through the filter.       
@@ -105,9 +105,15 @@
 * The advantage of the Direct Form I structure is that it is numerically more robust for fixed-point data types.    
 * That is why the Direct Form I structure supports Q15 and Q31 data types.    
 * The transposed Direct Form II structure, on the other hand, requires a wide dynamic range for the state variables <code>d1</code> and <code>d2</code>.    
-* Because of this, the CMSIS library only has a floating-point version of the Direct Form II Biquad.    
+* Because of this, the Q31 and Q15 versions of the Direct Form II Biquad keep the state variables in 64-bit accumulators.    
 * The advantage of the Direct Form II Biquad is that it requires half the number of state variables, 2 rather than 4, per Biquad stage.    
 *       
+* \par Multichannel Functions       
+* The <code>arm_biquad_cascade_mc_df2T</code> functions filter <code>numChannels</code> interleaved channels with the same    
+* coefficients, as found in the DMA buffers of a stereo or multichannel audio interface.    
+* <code>blockSize</code> counts samples per channel, so <code>pSrc</code> and <code>pDst</code> hold    
+* <code>blockSize*numChannels</code> values. Each channel has its own state variables.    
+*       
 * \par Instance Structure       
 * The coefficients and state variables for a filter are stored together in an instance data structure.       
 * A separate instance structure must be defined for each filter.       
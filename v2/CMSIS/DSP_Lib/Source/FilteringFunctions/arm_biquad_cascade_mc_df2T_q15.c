@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_biquad_cascade_mc_df2T_q15.c
+*
+* Description:  Processing function for the Q15 multichannel transposed
+*               direct form II Biquad cascade filter
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 multichannel transposed direct form II Biquad cascade filter.
+ * @param[in]  *S         points to an instance of the Q15 multichannel filter data structure.
+ * @param[in]  *pSrc      points to the block of interleaved input data.
+ * @param[out] *pDst      points to the block of interleaved output data.
+ * @param[in]  blockSize  number of samples to process per channel.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The same as for arm_biquad_cascade_df2T_q15.
+ *
+ * <b>Description:</b>
+ * \par
+ * The coefficients of a stage are loaded once and used for all channels, so the
+ * interleaved buffers of a DMA transfer need no de-interleaving.
+ */
+
+void arm_biquad_cascade_mc_df2T_q15(
+  const arm_biquad_cascade_mc_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pStageIn = pSrc;                        /* Input of the current stage */
+  q15_t *pIn;                                    /* Source pointer */
+  q15_t *pOut;                                   /* Destination pointer */
+  q63_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+  q15_t Xn, Yn;                                  /* Input and output samples */
+  q63_t d1, d2;                                  /* State variables */
+  int32_t shift = 15 - (int32_t) S->postShift;   /* Shift from the 34.30 accumulator to the 1.15 output */
+#ifndef ARM_MATH_CM0_FAMILY
+  q31_t b1a1, b2a2;                              /* Packed coefficient pairs */
+  q31_t XnYn;                                    /* Packed input and output */
+#endif
+  uint32_t numChannels = S->numChannels;         /* Number of interleaved channels */
+  uint32_t channel;                              /* Channel counter */
+  uint32_t sample, stage = S->numStages;         /* Loop counters */
+
+  do
+  {
+    /* Reading the coefficients, {b0, 0, b1, b2, a1, a2} as for the direct form I */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+    pCoeffs += 6u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Pair the coefficients for the dual multiply accumulates */
+    b1a1 = __PKHBT(b1, a1, 16);
+    b2a2 = __PKHBT(b2, a2, 16);
+
+#endif
+
+    /* Each channel runs through the stage with its state in registers,
+     ** reading and writing every numChannels-th value of the block */
+    for (channel = 0u; channel < numChannels; channel++)
+    {
+      pIn = pStageIn + channel;
+      pOut = pDst + channel;
+      d1 = pState[0];
+      d2 = pState[1];
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Apply loop unrolling and compute 4 output values simultaneously. */
+      sample = blockSize >> 2u;
+
+      /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+       ** a second loop below computes the remaining 1 to 3 samples. */
+      while(sample > 0u)
+      {
+        /* y[n] = b0 * x[n] + d1 */
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        Xn = pIn[0];
+        Yn = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) (b0 * Xn) + d1) >> shift), 16);
+        pOut[0] = Yn;
+        XnYn = __PKHBT(Xn, Yn, 16);
+        d1 = __SMLALD(b1a1, XnYn, d2);
+        d2 = __SMLALD(b2a2, XnYn, 0);
+
+        Xn = pIn[1u * numChannels];
+        Yn = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) (b0 * Xn) + d1) >> shift), 16);
+        pOut[1u * numChannels] = Yn;
+        XnYn = __PKHBT(Xn, Yn, 16);
+        d1 = __SMLALD(b1a1, XnYn, d2);
+        d2 = __SMLALD(b2a2, XnYn, 0);
+
+        Xn = pIn[2u * numChannels];
+        Yn = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) (b0 * Xn) + d1) >> shift), 16);
+        pOut[2u * numChannels] = Yn;
+        XnYn = __PKHBT(Xn, Yn, 16);
+        d1 = __SMLALD(b1a1, XnYn, d2);
+        d2 = __SMLALD(b2a2, XnYn, 0);
+
+        Xn = pIn[3u * numChannels];
+        Yn = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) (b0 * Xn) + d1) >> shift), 16);
+        pOut[3u * numChannels] = Yn;
+        XnYn = __PKHBT(Xn, Yn, 16);
+        d1 = __SMLALD(b1a1, XnYn, d2);
+        d2 = __SMLALD(b2a2, XnYn, 0);
+
+        pIn += 4u * numChannels;
+        pOut += 4u * numChannels;
+
+        /* Decrement the loop counter */
+        sample--;
+      }
+
+      /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+       ** No loop unrolling is used. */
+      sample = blockSize & 0x3u;
+
+      while(sample > 0u)
+      {
+        Xn = *pIn;
+        Yn = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) (b0 * Xn) + d1) >> shift), 16);
+        *pOut = Yn;
+        XnYn = __PKHBT(Xn, Yn, 16);
+        d1 = __SMLALD(b1a1, XnYn, d2);
+        d2 = __SMLALD(b2a2, XnYn, 0);
+        pIn += numChannels;
+        pOut += numChannels;
+
+        /* Decrement the loop counter */
+        sample--;
+      }
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        Xn = *pIn;
+        Yn = (q15_t) __SSAT(clip_q63_to_q31(((q63_t) (b0 * Xn) + d1) >> shift), 16);
+        *pOut = Yn;
+        d1 = (d2 + (b1 * Xn)) + (a1 * Yn);
+        d2 = ((q63_t) (b2 * Xn)) + (a2 * Yn);
+        pIn += numChannels;
+        pOut += numChannels;
+
+        /* Decrement the loop counter */
+        sample--;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      /* Store the updated state variables back into the state array */
+      pState[0] = d1;
+      pState[1] = d2;
+      pState += 2u;
+    }
+
+    /* The current stage input is given as the output to the next stage */
+    pStageIn = pDst;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
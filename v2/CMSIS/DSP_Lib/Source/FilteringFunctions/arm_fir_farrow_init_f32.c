@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_farrow_init_f32.c
+*
+* Description:  floating-point Farrow FIR resampler initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Farrow FIR resampler.
+ * @param[in,out] *S          points to an instance of the floating-point Farrow FIR resampler structure.
+ * @param[in]     numTaps     number of coefficients of each filter.
+ * @param[in]     order       order of the polynomial in the fractional position.
+ * @param[in]     *pCoeffs    points to the <code>(order+1)*numTaps</code> filter coefficients.
+ * @param[in]     step        input samples per output sample, in Q8.24 format.
+ * @param[in]     *pState     points to the state buffer.
+ * @param[in]     blockSize   number of input samples that are processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ *                <code>numTaps</code> or <code>step</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> holds the filters <code>b0</code> to <code>bK</code> of the polynomial one after the other,
+ * each of <code>numTaps</code> coefficients in time reversed order.
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>numTaps+blockSize-1</code> words
+ * where <code>blockSize</code> is the number of input samples processed by each call to <code>arm_fir_farrow_f32()</code>.
+ * \par
+ * The first output sample is computed at the first input sample, with a fractional position of 0.
+ * <code>step</code> can be changed in the instance afterwards at any time.
+ */
+
+arm_status arm_fir_farrow_init_f32(
+  arm_fir_farrow_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t order,
+  float32_t * pCoeffs,
+  uint32_t step,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if((numTaps == 0u) || (step == 0u))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps and polynomial order */
+    S->numTaps = numTaps;
+    S->order = order;
+
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* The first output is at the first input */
+    S->step = step;
+    S->pos = 0u;
+
+    /* Clear state buffer and size of buffer is always numTaps + blockSize - 1 */
+    memset(pState, 0, (blockSize + ((uint32_t) numTaps - 1u)) * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
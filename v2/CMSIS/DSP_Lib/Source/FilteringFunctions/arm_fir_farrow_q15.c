@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_farrow_q15.c
+*
+* Description:  Q15 Farrow FIR resampler processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Farrow FIR resampler.
+ * @param[in,out] *S         points to an instance of the Q15 Farrow FIR resampler structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>. *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The coefficients are in 1.15 format scaled down by
+ * <code>2^postShift</code> and the state in 1.15 format. The polynomial
+ * coefficients are accumulated in 64 bits in 34.30 format and the
+ * polynomial is evaluated in the same format, with the fractional position
+ * in 1.15 format. The result is shifted right by <code>15 - postShift</code>
+ * bits and saturated to 1.15 format.
+ */
+
+uint32_t arm_fir_farrow_q15(
+  arm_fir_farrow_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *px;                                     /* Temporary pointer for the state */
+  q15_t *pc;                                     /* Temporary pointer for the coefficients */
+  q31_t mu;                                      /* Fractional position in 1.15 format */
+  q63_t sum;                                     /* Accumulator of one polynomial coefficient */
+  q63_t out;                                     /* Output accumulator */
+  int32_t shift = 15 - (int32_t) S->postShift;   /* Output shift */
+  uint32_t numTaps = S->numTaps;                 /* Length of each filter */
+  uint32_t pos = S->pos;                         /* Position of the next output, Q8.24 */
+  uint32_t n;                                    /* Input sample of the next output */
+  uint32_t outCnt = 0u;                          /* Number of output samples */
+  uint32_t k, tapCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples,
+   * the new block goes after them */
+  memcpy(pState + (numTaps - 1u), pSrc, blockSize * sizeof(q15_t));
+
+  /* Skip to the input sample of the first output */
+  n = pos >> 24u;
+  pos &= 0x00FFFFFFu;
+
+  while(n < blockSize)
+  {
+    mu = (q31_t) (pos >> 9u);
+    out = 0;
+
+    /* Horner's scheme, from the highest order filter down */
+    for (k = (uint32_t) S->order + 1u; k > 0u; k--)
+    {
+      /* The window of the output ends with input sample n */
+      px = pState + n;
+      pc = S->pCoeffs + (k - 1u) * numTaps;
+      sum = 0;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling.  Compute 4 taps at a time */
+      tapCnt = numTaps >> 2u;
+
+      while(tapCnt > 0u)
+      {
+        sum += (q63_t) px[0] * pc[0];
+        sum += (q63_t) px[1] * pc[1];
+        sum += (q63_t) px[2] * pc[2];
+        sum += (q63_t) px[3] * pc[3];
+        px += 4u;
+        pc += 4u;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* If numTaps is not a multiple of 4, compute the remaining taps */
+      tapCnt = numTaps % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      tapCnt = numTaps;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(tapCnt > 0u)
+      {
+        sum += (q63_t) *px++ * *pc++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      out = ((out * mu) >> 15) + sum;
+    }
+
+    *pDst++ = (q15_t) (__SSAT((out >> shift), 16));
+    outCnt++;
+
+    /* Step on to the position of the next output */
+    pos += S->step;
+    n += pos >> 24u;
+    pos &= 0x00FFFFFFu;
+  }
+
+  /* Keep the position relative to the first sample of the next block */
+  S->pos = pos + ((n - blockSize) << 24u);
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  px = pState + blockSize;
+  tapCnt = numTaps - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pState++ = *px++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
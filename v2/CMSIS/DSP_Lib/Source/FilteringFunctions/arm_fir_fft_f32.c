@@ -0,0 +1,211 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_fft_f32.c
+*
+* Description:  floating-point partitioned FFT FIR filter processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_FFT Partitioned FFT FIR Filters
+ *
+ * This group of functions implements long FIR filters by fast convolution.
+ * A direct form FIR filter costs <code>numTaps</code> multiplications per
+ * sample. The FFT FIR filter splits the impulse response into partitions of
+ * <code>partLen</code> taps and filters the input in blocks of
+ * <code>partLen</code> samples with a real FFT of <code>2 * partLen</code>
+ * points, so the cost per sample grows with the number of partitions rather
+ * than with the number of taps.
+ *
+ * \par Algorithm:
+ * The filter is a uniformly partitioned overlap-save convolution. For every
+ * block of <code>partLen</code> input samples:
+ * - The last <code>2 * partLen</code> input samples are transformed and the
+ *   spectrum is stored in a frequency domain delay line of
+ *   <code>numParts</code> spectra.
+ * - Each spectrum in the delay line is multiplied by the spectrum of the
+ *   matching partition of the impulse response, the newest spectrum by the
+ *   first partition, and the products are summed.
+ * - The inverse transform of the sum holds the filter output for the block
+ *   in its second half. The first half is wrapped around and discarded.
+ *
+ * \par
+ * The spectra of the partitions are computed once by the initialization
+ * function. Each block then takes one forward FFT, one inverse FFT and
+ * <code>numParts</code> complex multiply accumulates of
+ * <code>partLen</code> bins, against <code>partLen</code> multiply
+ * accumulates per sample and tap for a direct form filter.
+ *
+ * \par Latency versus efficiency:
+ * The output of a block is available as soon as the block has been read, so
+ * the latency is the partition length <code>partLen</code>. Long partitions
+ * make few, large transforms and are the most efficient. Short partitions
+ * lower the latency at the cost of more complex multiply accumulates per
+ * sample. A good starting point is a partition of about
+ * <code>numTaps / 4</code>, e.g. a 2048 tap filter with 512 sample
+ * partitions.
+ *
+ * \par
+ * <code>blockSize</code> must be a multiple of <code>partLen</code>. Each
+ * call to the processing function filters <code>blockSize / partLen</code>
+ * partitions.
+ *
+ * \par Memory:
+ * With <code>numParts = (numTaps + partLen - 1) / partLen</code>:
+ * - <code>pCoeffSpectra</code> holds <code>numParts * 2 * partLen</code> values.
+ * - <code>pState</code> holds <code>(numParts + 3) * 2 * partLen</code> values.
+ * Both are Q31 arrays for the Q15 filter.
+ * The delay line takes the first <code>numParts * 2 * partLen</code> values.
+ * Then come the input window, a scratch buffer and the accumulator, of
+ * <code>2 * partLen</code> values each.
+ *
+ * \par Instance Structure
+ * The partition spectra, the state and the real FFT instance are stored
+ * together in an instance data structure. A separate instance structure must
+ * be defined for each filter. The partition spectra may be shared among
+ * several instances while the state arrays cannot be shared.
+ *
+ * \par Initialization Functions
+ * There is an initialization function for each data type. It
+ * - initializes the real FFT of <code>2 * partLen</code> points,
+ * - computes the spectra of the partitions from the time reversed
+ *   coefficients, in the same order as for <code>arm_fir_f32()</code>,
+ * - clears the state.
+ * The reset function clears the state of an initialized filter, e.g. on a
+ * discontinuity of the input stream.
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 real FFT scales its output down by the FFT length. The
+ * initialization function normalises the partition spectra to the full
+ * range and the processing function normalises the sum of the products
+ * before the inverse transform of every block. The output shift undoes both,
+ * so the output has the scale of a direct form filter and saturates.
+ * \par
+ * The Q15 filter takes Q15 input, coefficients and output but runs the Q31
+ * engine, with Q31 partition spectra and state. Spectra held in 16 bits lose
+ * most of their precision to the 1/fftLen scaling of the transforms, and
+ * the Cortex-M3 and Cortex-M0 have no SIMD instructions to make a Q15
+ * transform faster than a Q31 one.
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FFT FIR filter.
+ * @param[in,out] *S         points to an instance of the floating-point FFT FIR structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, a multiple of <code>partLen</code>.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t partLen = S->partLen;                 /* Partition length */
+  uint32_t fftLen = 2u * partLen;                /* Real FFT length */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  float32_t *pIn = S->pState + numParts * fftLen; /* Input window */
+  float32_t *pScratch = pIn + fftLen;            /* Scratch buffer */
+  float32_t *pAcc = pScratch + fftLen;           /* Sum of the products */
+  float32_t *pFdl;                               /* Delay line spectrum */
+  float32_t *pH;                                 /* Partition spectrum */
+  float32_t *pOut;                               /* Product destination */
+  uint32_t blkCnt = blockSize / partLen;         /* Loop counter */
+  uint32_t p, slot;                              /* Partition and delay line slot */
+
+  while(blkCnt > 0u)
+  {
+    /* Slide the input window on by one partition */
+    memcpy(pIn, pIn + partLen, partLen * sizeof(float32_t));
+    memcpy(pIn + partLen, pSrc, partLen * sizeof(float32_t));
+
+    /* The spectrum of the window replaces the oldest one in the delay line */
+    S->partIndex = (S->partIndex == 0u) ? (uint16_t) (numParts - 1u) : (uint16_t) (S->partIndex - 1u);
+    memcpy(pScratch, pIn, fftLen * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->rfft, pScratch, S->pState + S->partIndex * fftLen, 0u);
+
+    /* Sum of the delayed spectra times the partition spectra */
+    slot = S->partIndex;
+    pH = S->pCoeffs;
+
+    for (p = 0u; p < numParts; p++)
+    {
+      pFdl = S->pState + slot * fftLen;
+      pOut = (p == 0u) ? pAcc : pScratch;
+
+      /* DC and Nyquist bins are real */
+      pOut[0] = pFdl[0] * pH[0];
+      pOut[1] = pFdl[1] * pH[1];
+      arm_cmplx_mult_cmplx_f32(pFdl + 2u, pH + 2u, pOut + 2u, partLen - 1u);
+
+      if(p != 0u)
+      {
+        arm_add_f32(pAcc, pScratch, pAcc, fftLen);
+      }
+
+      slot = (slot == numParts - 1u) ? 0u : slot + 1u;
+      pH += fftLen;
+    }
+
+    /* The second half of the inverse transform is the output */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pScratch, 1u);
+    memcpy(pDst, pScratch + partLen, partLen * sizeof(float32_t));
+
+    pSrc += partLen;
+    pDst += partLen;
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_fft_init_q15.c
+*
+* Description:  Q15 partitioned FFT FIR filter initialization and
+*               reset functions
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 FFT FIR filter.
+ * @param[in,out] *S              points to an instance of the Q15 FFT FIR structure.
+ * @param[in]     numTaps         number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs        points to the filter coefficients.
+ * @param[in]     partLen         partition length, 16 to 2048 and a power of 2.
+ * @param[out]    *pCoeffSpectra  points to the buffer for the partition spectra.
+ * @param[in]     *pState         points to the state buffer.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ *                <code>numTaps</code> is 0 or <code>partLen</code> is not supported.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the <code>numTaps</code> coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * They are only read during initialization.
+ * \par
+ * With <code>numParts = (numTaps + partLen - 1) / partLen</code>,
+ * <code>pCoeffSpectra</code> must hold <code>numParts * 2 * partLen</code> Q31 values and
+ * <code>pState</code> <code>(numParts + 3) * 2 * partLen</code> Q31 values.
+ */
+
+arm_status arm_fir_fft_init_q15(
+  arm_fir_fft_instance_q15 * S,
+  uint16_t numTaps,
+  const q15_t * pCoeffs,
+  uint16_t partLen,
+  q31_t * pCoeffSpectra,
+  q31_t * pState)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  /* The Q31 initialization does not touch the delay line part of the state
+     before it clears it, so the Q31 coefficients are held there. It holds
+     at least numTaps values for any partLen but 0. */
+  if(partLen == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numTaps; i++)
+  {
+    pState[i] = (q31_t) pCoeffs[i] << 16;
+  }
+
+  return (arm_fir_fft_init_q31(&S->Sint, numTaps, pState, partLen, pCoeffSpectra, pState));
+}
+
+/**
+ * @brief  Clears the state of the Q15 FFT FIR filter.
+ * @param[in,out] *S  points to an instance of the Q15 FFT FIR structure.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * Clears the delay line and the input window, as if the filter had only
+ * been fed zeros. The partition spectra are kept.
+ */
+
+void arm_fir_fft_reset_q15(
+  arm_fir_fft_instance_q15 * S)
+{
+  arm_fir_fft_reset_q31(&S->Sint);
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
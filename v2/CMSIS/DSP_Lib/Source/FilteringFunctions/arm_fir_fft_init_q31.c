@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_fft_init_q31.c
+*
+* Description:  Q31 partitioned FFT FIR filter initialization and
+*               reset functions
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Number of bits the values can be shifted left by without overflow.
+ */
+static uint32_t arm_fir_fft_headroom_q31(
+  const q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t bits = 0;                                /* OR of the magnitude bits */
+
+  while(blockSize > 0u)
+  {
+    bits |= *pSrc ^ (*pSrc >> 31);
+    pSrc++;
+    blockSize--;
+  }
+
+  return (__CLZ((uint32_t) bits) - 1u);
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 FFT FIR filter.
+ * @param[in,out] *S              points to an instance of the Q31 FFT FIR structure.
+ * @param[in]     numTaps         number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs        points to the filter coefficients.
+ * @param[in]     partLen         partition length, 16 to 2048 and a power of 2.
+ * @param[out]    *pCoeffSpectra  points to the buffer for the partition spectra.
+ * @param[in]     *pState         points to the state buffer.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ *                <code>numTaps</code> is 0 or <code>partLen</code> is not supported.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the <code>numTaps</code> coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * They are only read during initialization.
+ * \par
+ * With <code>numParts = (numTaps + partLen - 1) / partLen</code>,
+ * <code>pCoeffSpectra</code> must hold <code>numParts * 2 * partLen</code> values and
+ * <code>pState</code> <code>(numParts + 3) * 2 * partLen</code> values.
+ */
+
+arm_status arm_fir_fft_init_q31(
+  arm_fir_fft_instance_q31 * S,
+  uint16_t numTaps,
+  const q31_t * pCoeffs,
+  uint16_t partLen,
+  q31_t * pCoeffSpectra,
+  q31_t * pState)
+{
+  uint32_t fftLen = 2u * partLen;                /* Real FFT length */
+  q31_t *pScratch;                               /* Time domain partition */
+  uint32_t p, i, n;                              /* Loop counters */
+  uint32_t shift;                                /* Normalisation shift */
+  arm_status status;                             /* Status of the FFT initialization */
+
+  if(numTaps == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Only the supported power of 2 lengths pass */
+  status = arm_rfft_fast_init_q31(&S->rfft, (uint16_t) fftLen);
+
+  if((status != ARM_MATH_SUCCESS) || (fftLen > 4096u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->partLen = partLen;
+  S->numParts = (uint16_t) ((numTaps + partLen - 1u) / partLen);
+  S->pCoeffs = pCoeffSpectra;
+  S->pState = pState;
+
+  /* Spectra of the partitions of the impulse response, zero padded to fftLen */
+  pScratch = pState + (S->numParts + 1u) * fftLen;
+
+  for (p = 0u; p < S->numParts; p++)
+  {
+    for (i = 0u; i < partLen; i++)
+    {
+      n = p * partLen + i;
+      pScratch[i] = (n < numTaps) ? pCoeffs[numTaps - 1u - n] : 0;
+    }
+
+    memset(pScratch + partLen, 0, partLen * sizeof(q31_t));
+    arm_rfft_fast_q31(&S->rfft, pScratch, pCoeffSpectra + p * fftLen, 0u);
+  }
+
+  /* Normalise the spectra to the full range. The output shift undoes the
+     normalisation, the scaling of the forward transforms by fftLen each and
+     the scaling of the products by 4. */
+  shift = arm_fir_fft_headroom_q31(pCoeffSpectra, S->numParts * fftLen);
+  arm_shift_q31(pCoeffSpectra, (int8_t) shift, pCoeffSpectra, S->numParts * fftLen);
+  S->outShift = (int8_t) (2u + 2u * (31u - __CLZ(fftLen)) - shift);
+
+  arm_fir_fft_reset_q31(S);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Clears the state of the Q31 FFT FIR filter.
+ * @param[in,out] *S  points to an instance of the Q31 FFT FIR structure.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * Clears the delay line and the input window, as if the filter had only
+ * been fed zeros. The partition spectra are kept.
+ */
+
+void arm_fir_fft_reset_q31(
+  arm_fir_fft_instance_q31 * S)
+{
+  memset(S->pState, 0, (S->numParts + 1u) * 2u * S->partLen * sizeof(q31_t));
+  S->partIndex = 0u;
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_fft_q15.c
+*
+* Description:  Q15 partitioned FFT FIR filter processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_fir_fft_partition_q31(
+  arm_fir_fft_instance_q31 * S);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 FFT FIR filter.
+ * @param[in,out] *S         points to an instance of the Q15 FFT FIR structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, a multiple of <code>partLen</code>.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is converted to 1.31 format and filtered as by arm_fir_fft_q31().
+ * The saturated 1.31 result is truncated to 1.15 format.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void arm_fir_fft_q15(
+  arm_fir_fft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  arm_fir_fft_instance_q31 *Sint = &S->Sint;     /* Q31 filter */
+  uint32_t partLen = Sint->partLen;              /* Partition length */
+  q31_t *pIn = Sint->pState + Sint->numParts * 2u * partLen;  /* Input window */
+  uint32_t blkCnt = blockSize / partLen;         /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Slide the input window on by one partition */
+    memcpy(pIn, pIn + partLen, partLen * sizeof(q31_t));
+    arm_q15_to_q31(pSrc, pIn + partLen, partLen);
+
+    arm_fir_fft_partition_q31(Sint);
+
+    /* The scratch buffer follows the input window */
+    arm_q31_to_q15(pIn + 3u * partLen, pDst, partLen);
+
+    pSrc += partLen;
+    pDst += partLen;
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
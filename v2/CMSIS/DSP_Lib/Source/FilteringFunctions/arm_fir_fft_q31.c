@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_fft_q31.c
+*
+* Description:  Q31 partitioned FFT FIR filter processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Number of bits the values can be shifted left by without overflow.
+ */
+static uint32_t arm_fir_fft_headroom_q31(
+  const q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t bits = 0;                                /* OR of the magnitude bits */
+
+  while(blockSize > 0u)
+  {
+    bits |= *pSrc ^ (*pSrc >> 31);
+    pSrc++;
+    blockSize--;
+  }
+
+  return (__CLZ((uint32_t) bits) - 1u);
+}
+
+/**
+ * @brief  Filters one partition of the Q31 FFT FIR filter.
+ * @param[in,out] *S  points to an instance of the Q31 FFT FIR structure.
+ * @return none.
+ *
+ * The caller slides the input window on by one partition and places the new
+ * samples in its second half. The output of the partition is left in the
+ * second half of the scratch buffer. Shared with arm_fir_fft_q15().
+ */
+
+void arm_fir_fft_partition_q31(
+  arm_fir_fft_instance_q31 * S)
+{
+  uint32_t partLen = S->partLen;                 /* Partition length */
+  uint32_t fftLen = 2u * partLen;                /* Real FFT length */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  q31_t *pIn = S->pState + numParts * fftLen;    /* Input window */
+  q31_t *pScratch = pIn + fftLen;                /* Scratch buffer */
+  q31_t *pAcc = pScratch + fftLen;               /* Sum of the products */
+  q31_t *pFdl;                                   /* Delay line spectrum */
+  q31_t *pH = S->pCoeffs;                        /* Partition spectrum */
+  q31_t *pOut;                                   /* Product destination */
+  uint32_t norm;                                 /* Block normalisation shift */
+  int32_t shift;                                 /* Output shift */
+  uint32_t p, slot;                              /* Partition and delay line slot */
+
+  /* The spectrum of the window replaces the oldest one in the delay line */
+  S->partIndex = (S->partIndex == 0u) ? (uint16_t) (numParts - 1u) : (uint16_t) (S->partIndex - 1u);
+  memcpy(pScratch, pIn, fftLen * sizeof(q31_t));
+  arm_rfft_fast_q31(&S->rfft, pScratch, S->pState + S->partIndex * fftLen, 0u);
+
+  /* Sum of the delayed spectra times the partition spectra */
+  slot = S->partIndex;
+
+  for (p = 0u; p < numParts; p++)
+  {
+    pFdl = S->pState + slot * fftLen;
+    pOut = (p == 0u) ? pAcc : pScratch;
+
+    /* DC and Nyquist bins are real, scaled as the complex products */
+    pOut[0] = (q31_t) (((q63_t) pFdl[0] * pH[0]) >> 33);
+    pOut[1] = (q31_t) (((q63_t) pFdl[1] * pH[1]) >> 33);
+    arm_cmplx_mult_cmplx_q31(pFdl + 2u, pH + 2u, pOut + 2u, partLen - 1u);
+
+    if(p != 0u)
+    {
+      arm_add_q31(pAcc, pScratch, pAcc, fftLen);
+    }
+
+    slot = (slot == numParts - 1u) ? 0u : slot + 1u;
+    pH += fftLen;
+  }
+
+  /* Block normalisation keeps the precision of the inverse transform. One
+     bit of headroom is left for the merge stage of the real inverse FFT. */
+  norm = arm_fir_fft_headroom_q31(pAcc, fftLen);
+  norm = (norm > 0u) ? norm - 1u : 0u;
+  arm_shift_q31(pAcc, (int8_t) norm, pAcc, fftLen);
+  arm_rfft_fast_q31(&S->rfft, pAcc, pScratch, 1u);
+
+  /* The second half of the inverse transform is the output */
+  shift = (int32_t) S->outShift - (int32_t) norm;
+  shift = (shift < -31) ? -31 : shift;
+  arm_shift_q31(pScratch + partLen, (int8_t) shift, pScratch + partLen, partLen);
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FFT FIR filter.
+ * @param[in,out] *S         points to an instance of the Q31 FFT FIR structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, a multiple of <code>partLen</code>.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input spectra are scaled down by <code>2 * partLen</code> by the real
+ * FFT and the products of the spectra by a further 4. The sum of the
+ * products saturates. It is normalised to the full range before the
+ * inverse transform, and the output is shifted back to the scale of a
+ * direct form filter with saturation. Results are in 1.31 format.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void arm_fir_fft_q31(
+  arm_fir_fft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t partLen = S->partLen;                 /* Partition length */
+  q31_t *pIn = S->pState + S->numParts * 2u * partLen;  /* Input window */
+  uint32_t blkCnt = blockSize / partLen;         /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Slide the input window on by one partition */
+    memcpy(pIn, pIn + partLen, partLen * sizeof(q31_t));
+    memcpy(pIn + partLen, pSrc, partLen * sizeof(q31_t));
+
+    arm_fir_fft_partition_q31(S);
+
+    /* The scratch buffer follows the input window */
+    memcpy(pDst, pIn + 3u * partLen, partLen * sizeof(q31_t));
+
+    pSrc += partLen;
+    pDst += partLen;
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
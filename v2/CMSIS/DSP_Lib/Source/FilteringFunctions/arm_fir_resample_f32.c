@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_resample_f32.c
+*
+* Description:  floating-point rational FIR resampler processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Resampler
+ *
+ * These functions change the sample rate of a signal by a rational factor
+ * <code>L/M</code>, or by an arbitrary and variable factor, in one pass.
+ * Cascading arm_fir_interpolate and arm_fir_decimate computes all
+ * <code>L</code> times as many samples of the upsampled signal only to throw
+ * away all but one in <code>M</code> of them. The resampler computes only
+ * the output samples that are kept.
+ *
+ * \par Rational resampler:
+ * Conceptually the signal is upsampled by <code>L</code>, filtered by a
+ * lowpass filter with a normalized cutoff frequency of
+ * <code>1/max(L, M)</code> and a gain of <code>L</code>, and downsampled by
+ * <code>M</code>. Output sample <code>j</code> is sample <code>j*M</code> of
+ * the upsampled and filtered signal. With <code>n = floor(j*M/L)</code> and
+ * the phase <code>p = j*M mod L</code> it takes one polyphase component of
+ * the filter:
+ * <pre>
+ *    y[j] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+ * </pre>
+ * so each output costs <code>phaseLength = numTaps/L</code> multiply
+ * accumulates. Converting 44.1 kHz to 16 kHz, for example, takes
+ * <code>L = 160</code> and <code>M = 441</code>.
+ *
+ * \par
+ * The coefficients are stored in time reversed order, as for the FIR
+ * interpolator, and <code>numTaps</code> must be a multiple of
+ * <code>L</code>:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ *
+ * \par Farrow resampler:
+ * The Farrow structure computes an output at any fractional position
+ * <code>mu</code> between two input samples. It holds <code>order+1</code>
+ * FIR filters of <code>numTaps</code> coefficients <code>b0</code> to
+ * <code>bK</code>, with <code>K = order</code>, and evaluates a polynomial
+ * in <code>mu</code>:
+ * <pre>
+ *    y = v0 + mu * (v1 + mu * (v2 + ... + mu * vK))
+ *    vk = bk[0] * x[n] + bk[1] * x[n-1] + ... + bk[numTaps-1] * x[n-numTaps+1]
+ * </pre>
+ * <code>pCoeffs</code> holds the filters <code>b0</code> to <code>bK</code>
+ * one after the other, each in time reversed order. The cubic Lagrange
+ * interpolator from <code>x[n-2]</code> at <code>mu = 0</code> towards
+ * <code>x[n-1]</code>, for example, has <code>numTaps = 4</code>,
+ * <code>order = 3</code> and is stored as:
+ * <pre>
+ *    {    0,    1,    0,    0,
+ *      -1/3, -1/2,    1, -1/6,
+ *       1/2,   -1,  1/2,    0,
+ *      -1/6,  1/2, -1/2,  1/6 }
+ * </pre>
+ * The position advances by <code>step</code> input samples per output
+ * sample, a Q8.24 unsigned value. The ratio of the input to the output
+ * sample rate is <code>step / 2^24</code>. <code>step</code> may be changed
+ * in the instance at any time, e.g. by a loop that tracks the clock of an
+ * asynchronous source, and takes effect from the next output sample. The
+ * 24 fraction bits resolve the ratio to 0.06 ppm.
+ *
+ * \par
+ * Both resamplers produce a varying number of output samples per block.
+ * The processing functions return it. <code>pDst</code> must have room for
+ * <code>blockSize * L / M + 1</code> samples, or
+ * <code>blockSize * 2^24 / step + 1</code> samples for the Farrow
+ * resampler.
+ *
+ * \par
+ * <code>pState</code> points to a state array of size
+ * <code>blockSize + phaseLength - 1</code>, or
+ * <code>blockSize + numTaps - 1</code> for the Farrow resampler, in the same
+ * order as for the FIR interpolator.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a resampler are stored together
+ * in an instance data structure. A separate instance structure must be
+ * defined for each resampler. Coefficient arrays may be shared among
+ * several instances while state variable arrays cannot be shared.
+ *
+ * \par Initialization Functions
+ * There is an initialization function for each resampler and data type.
+ * It sets the values of the internal structure fields, zeros out the state
+ * buffer and checks the arguments.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 functions accumulate the products in 64 bits, in 34.30 format,
+ * and saturate the output. The Farrow resampler has a
+ * <code>postShift</code> for coefficients that reach 1 or more, as the
+ * cubic Lagrange ones.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point rational FIR resampler.
+ * @param[in,out] *S         points to an instance of the floating-point rational FIR resampler structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px;                                 /* Temporary pointer for the state */
+  float32_t *pb;                                 /* Temporary pointer for the coefficients */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t M = S->M;                             /* Downsample factor */
+  uint32_t phase = S->phase;                     /* Phase of the next output */
+  uint32_t n;                                    /* Input sample of the next output */
+  uint32_t outCnt = 0u;                          /* Number of output samples */
+  uint32_t tapCnt;                               /* Loop counter */
+  uint16_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples,
+   * the new block goes after them */
+  memcpy(pState + (phaseLen - 1u), pSrc, blockSize * sizeof(float32_t));
+
+  /* Skip to the input sample of the first output */
+  n = phase / L;
+  phase = phase % L;
+
+  while(n < blockSize)
+  {
+    /* The window of the output ends with input sample n */
+    px = pState + n;
+
+    /* Polyphase component of the output phase */
+    pb = pCoeffs + (L - 1u - phase);
+
+    sum = 0.0f;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Compute 4 taps at a time */
+    tapCnt = (uint32_t) phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum += px[0] * *pb;
+      pb += L;
+      sum += px[1] * *pb;
+      pb += L;
+      sum += px[2] * *pb;
+      pb += L;
+      sum += px[3] * *pb;
+      pb += L;
+      px += 4u;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyphase length is not a multiple of 4, compute the remaining taps */
+    tapCnt = (uint32_t) phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = (uint32_t) phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(tapCnt > 0u)
+    {
+      sum += *px++ * *pb;
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    *pDst++ = sum;
+    outCnt++;
+
+    /* Step on by M samples of the upsampled signal */
+    phase += M;
+    n += phase / L;
+    phase = phase % L;
+  }
+
+  /* Keep the phase relative to the first sample of the next block */
+  S->phase = phase + (n - blockSize) * L;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  px = pState + blockSize;
+  tapCnt = (uint32_t) phaseLen - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pState++ = *px++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
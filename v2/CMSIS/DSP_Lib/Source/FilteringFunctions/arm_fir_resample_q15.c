@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_resample_q15.c
+*
+* Description:  Q15 rational FIR resampler processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 rational FIR resampler.
+ * @param[in,out] *S         points to an instance of the Q15 rational FIR resampler structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>. *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function uses a 64-bit internal accumulator. Both coefficients and
+ * state variables are represented in 1.15 format and multiplications yield
+ * a 2.30 result. The 2.30 intermediate results are accumulated in a 64-bit
+ * accumulator in 34.30 format. There is no risk of overflow. The result is
+ * truncated to 34.15 format by discarding the low 15 bits and then saturated
+ * to 1.15 format.
+ */
+
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *px;                                     /* Temporary pointer for the state */
+  q15_t *pb;                                     /* Temporary pointer for the coefficients */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t M = S->M;                             /* Downsample factor */
+  uint32_t phase = S->phase;                     /* Phase of the next output */
+  uint32_t n;                                    /* Input sample of the next output */
+  uint32_t outCnt = 0u;                          /* Number of output samples */
+  uint32_t tapCnt;                               /* Loop counter */
+  uint16_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples,
+   * the new block goes after them */
+  memcpy(pState + (phaseLen - 1u), pSrc, blockSize * sizeof(q15_t));
+
+  /* Skip to the input sample of the first output */
+  n = phase / L;
+  phase = phase % L;
+
+  while(n < blockSize)
+  {
+    /* The window of the output ends with input sample n */
+    px = pState + n;
+
+    /* Polyphase component of the output phase */
+    pb = pCoeffs + (L - 1u - phase);
+
+    sum = 0;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Compute 4 taps at a time */
+    tapCnt = (uint32_t) phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum += (q63_t) px[0] * *pb;
+      pb += L;
+      sum += (q63_t) px[1] * *pb;
+      pb += L;
+      sum += (q63_t) px[2] * *pb;
+      pb += L;
+      sum += (q63_t) px[3] * *pb;
+      pb += L;
+      px += 4u;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyphase length is not a multiple of 4, compute the remaining taps */
+    tapCnt = (uint32_t) phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = (uint32_t) phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(tapCnt > 0u)
+    {
+      sum += (q63_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    *pDst++ = (q15_t) (__SSAT((sum >> 15), 16));
+    outCnt++;
+
+    /* Step on by M samples of the upsampled signal */
+    phase += M;
+    n += phase / L;
+    phase = phase % L;
+  }
+
+  /* Keep the phase relative to the first sample of the next block */
+  S->phase = phase + (n - blockSize) * L;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  px = pState + blockSize;
+  tapCnt = (uint32_t) phaseLen - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pState++ = *px++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_cholesky_f32.c
+*
+* Description:  Floating-point Cholesky decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky Decomposition
+ *
+ * Factors a symmetric positive definite matrix into a lower triangular
+ * matrix and its transpose, and solves linear systems with the factors:
+ * <pre>
+ *     A = L * L'
+ * </pre>
+ * Solving <code>A * X = B</code> this way takes a third of the work of
+ * Gaussian elimination and is far cheaper and more accurate than forming
+ * the inverse of <code>A</code>. Covariance matrices, as in a Kalman
+ * filter, are symmetric positive definite.
+ *
+ * \par Algorithm
+ * The rows of <code>L</code> are computed from the top down, each
+ * element as a dot product of two rows already known:
+ * <pre>
+ *     L(i,j) = (A(i,j) - sum(L(i,k) * L(j,k), k = 0 .. j-1)) / L(j,j)
+ *     L(i,i) = sqrt(A(i,i) - sum(L(i,k) * L(i,k), k = 0 .. i-1))
+ * </pre>
+ * Only the lower triangle of <code>A</code> is read. The upper triangle
+ * of the output is cleared. The destination may be the source matrix, so
+ * the decomposition can be done in place. If a value under the square root
+ * is not positive, the matrix is not positive definite and the function
+ * returns <code>ARM_MATH_SINGULAR</code>.
+ *
+ * \par
+ * <code>arm_mat_cholesky_solve</code> then solves <code>L * Y = B</code>
+ * and <code>L' * X = Y</code> by forward and back substitution, one
+ * column of <code>B</code> at a time. <code>X</code> may be
+ * <code>B</code>.
+ *
+ * \par Fixed-Point Behavior
+ * If the elements of <code>A</code> are below 1 in magnitude, so are
+ * those of <code>L</code>, as the squares of a row of <code>L</code>
+ * add up to the diagonal element of <code>A</code>. The Q31 functions
+ * keep the sums in 64-bit accumulators in 2.62 format and take the square
+ * root of the accumulator, so <code>L</code> has the full precision of
+ * the Q31 format. The solution <code>X</code> can be larger than
+ * <code>B</code> and is saturated to the Q31 range; scale <code>B</code>
+ * down by the expected gain of the inverse of <code>A</code>.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition.
+ * @param[in]  *pSrc points to the symmetric positive definite input matrix structure.
+ * @param[out] *pDst points to the output matrix structure for <code>L</code>, may be <code>pSrc</code>.
+ * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not
+ * square and of the same size, <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* rows i and j of L */
+  float32_t sum;                                 /* accumulator */
+  uint16_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (i = 0u; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pL + (i * n);
+
+      for (j = 0u; j <= i; j++)
+      {
+        pRowJ = pL + (j * n);
+
+        /* A(i,j) minus the dot product of the first j elements of rows i and j */
+        sum = pA[(i * n) + j];
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling */
+        k = 0u;
+
+        while((k + 4u) <= j)
+        {
+          sum -= (pRowI[k] * pRowJ[k]) + (pRowI[k + 1u] * pRowJ[k + 1u])
+            + (pRowI[k + 2u] * pRowJ[k + 2u]) + (pRowI[k + 3u] * pRowJ[k + 3u]);
+          k += 4u;
+        }
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        k = 0u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        while(k < j)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+          k++;
+        }
+
+        if(j < i)
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+        else if(sum > 0.0f)
+        {
+          arm_sqrt_f32(sum, &pRowI[i]);
+        }
+        else
+        {
+          /* Not positive definite */
+          pRowI[i] = 0.0f;
+          status = ARM_MATH_SINGULAR;
+        }
+      }
+
+      /* Clear the upper triangle, which the lower rows do not read */
+      for (j = i + 1u; j < n; j++)
+      {
+        pRowI[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_cholesky_q31.c
+*
+* Description:  Q31 Cholesky decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Q31 Cholesky decomposition.
+ * @param[in]  *pSrc points to the symmetric positive definite input matrix structure.
+ * @param[out] *pDst points to the output matrix structure for <code>L</code>, may be <code>pSrc</code>.
+ * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not
+ * square and of the same size, <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The dot products are accumulated in 2.62 format, the diagonal elements
+ * are the rounded square root of the accumulator and the others the
+ * accumulator divided by a diagonal element. <code>L</code> cannot
+ * overflow for a positive definite input.
+ */
+
+arm_status arm_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst)
+{
+  q31_t *pA = pSrc->pData;                       /* input data matrix pointer */
+  q31_t *pL = pDst->pData;                       /* output data matrix pointer */
+  q31_t *pRowI, *pRowJ;                          /* rows i and j of L */
+  q63_t sum;                                     /* accumulator */
+  uint16_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (i = 0u; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pL + (i * n);
+
+      for (j = 0u; j <= i; j++)
+      {
+        pRowJ = pL + (j * n);
+
+        /* A(i,j) in 2.62 format minus the dot product of the first j elements of rows i and j */
+        sum = (q63_t) pA[(i * n) + j] << 31;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling */
+        k = 0u;
+
+        while((k + 4u) <= j)
+        {
+          sum -= (q63_t) pRowI[k] * pRowJ[k];
+          sum -= (q63_t) pRowI[k + 1u] * pRowJ[k + 1u];
+          sum -= (q63_t) pRowI[k + 2u] * pRowJ[k + 2u];
+          sum -= (q63_t) pRowI[k + 3u] * pRowJ[k + 3u];
+          k += 4u;
+        }
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        k = 0u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        while(k < j)
+        {
+          sum -= (q63_t) pRowI[k] * pRowJ[k];
+          k++;
+        }
+
+        if(j < i)
+        {
+          /* 2.62 divided by 1.31 gives 1.31 */
+          pRowI[j] = clip_q63_to_q31(sum / pRowJ[j]);
+        }
+        else
+        {
+          pRowI[i] = (sum > 0) ? sqrt_q63_to_q31(sum) : 0;
+
+          if(pRowI[i] == 0)
+          {
+            /* Not positive definite, or too close to it for the Q31 format */
+            status = ARM_MATH_SINGULAR;
+          }
+        }
+      }
+
+      /* Clear the upper triangle, which the lower rows do not read */
+      for (j = i + 1u; j < n; j++)
+      {
+        pRowI[j] = 0;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
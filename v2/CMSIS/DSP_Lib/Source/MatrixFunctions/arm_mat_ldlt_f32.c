@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_ldlt_f32.c
+*
+* Description:  Floating-point LDL' decomposition with symmetric pivoting.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLDLT LDL' Decomposition
+ *
+ * Factors a symmetric positive semi-definite matrix into a unit lower
+ * triangular matrix <code>L</code> and a diagonal matrix <code>D</code>,
+ * and solves linear systems with the factors:
+ * <pre>
+ *     P * A * P' = L * D * L'
+ * </pre>
+ * Unlike the Cholesky decomposition this needs no square roots, which
+ * suits processors without a floating-point unit.
+ *
+ * \par Algorithm
+ * Column k of <code>L</code> is the column of the remaining submatrix
+ * divided by its diagonal element, which becomes <code>D(k,k)</code>.
+ * The submatrix below and to the right is then updated. At every step the
+ * row and column with the largest remaining diagonal element are swapped
+ * into place first. The swaps make up the permutation <code>P</code>
+ * and are stored like the row swaps of the LU decomposition:
+ * <code>pPivot[k]</code> is the row swapped with row <code>k</code> at
+ * step k. For a positive semi-definite matrix this keeps all elements of
+ * <code>L</code> below 1 in magnitude. If a remaining diagonal element
+ * is zero the function returns <code>ARM_MATH_SINGULAR</code>.
+ *
+ * \par
+ * The output holds <code>L</code> below the diagonal and <code>D</code>
+ * on the diagonal; the unit diagonal of <code>L</code> is not stored and
+ * the upper triangle is cleared. Only the lower triangle of the input is
+ * read. The destination may be the source matrix, so the decomposition
+ * can be done in place.
+ *
+ * \par
+ * <code>arm_mat_ldlt_solve</code> solves <code>A * X = B</code> from the
+ * factors. <code>X</code> may be <code>B</code>.
+ *
+ * \par Fixed-Point Behavior
+ * With the pivoting, the elements of <code>L</code> are below 1 and those
+ * of <code>D</code> below the largest diagonal element of <code>A</code>,
+ * so the Q31 decomposition cannot overflow. The update of the submatrix
+ * is rounded to Q31 at every step. The solution <code>X</code> is
+ * saturated to the Q31 range; scale <code>B</code> down by the expected
+ * gain of the inverse of <code>A</code>.
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL' decomposition.
+ * @param[in]  *pSrc   points to the symmetric input matrix structure.
+ * @param[out] *pDst   points to the output matrix structure for <code>L</code> and <code>D</code>, may be <code>pSrc</code>.
+ * @param[out] *pPivot points to the row swaps, an array of <code>numRows</code> values.
+ * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not
+ * square and of the same size, <code>ARM_MATH_SINGULAR</code> if the input matrix is singular
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPivot)
+{
+  float32_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRowI, *pColK;                      /* temporary pointers */
+  float32_t d, v, maxVal, temp;                  /* pivot, element and swap values */
+  uint16_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k, p;                           /* loop counters and pivot row */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pSrc->pData != pA)
+    {
+      memcpy(pA, pSrc->pData, (uint32_t) n * n * sizeof(float32_t));
+    }
+
+    for (k = 0u; (k < n) && (status == ARM_MATH_SUCCESS); k++)
+    {
+      /* Find the largest remaining diagonal element */
+      p = k;
+      maxVal = fabsf(pA[(k * n) + k]);
+
+      for (i = k + 1u; i < n; i++)
+      {
+        if(fabsf(pA[(i * n) + i]) > maxVal)
+        {
+          maxVal = fabsf(pA[(i * n) + i]);
+          p = i;
+        }
+      }
+
+      pPivot[k] = (uint16_t) p;
+
+      if(p != k)
+      {
+        /* Swap rows and columns k and p within the lower triangle */
+        for (j = 0u; j < k; j++)
+        {
+          temp = pA[(k * n) + j];
+          pA[(k * n) + j] = pA[(p * n) + j];
+          pA[(p * n) + j] = temp;
+        }
+
+        for (i = k + 1u; i < p; i++)
+        {
+          temp = pA[(i * n) + k];
+          pA[(i * n) + k] = pA[(p * n) + i];
+          pA[(p * n) + i] = temp;
+        }
+
+        for (i = p + 1u; i < n; i++)
+        {
+          temp = pA[(i * n) + k];
+          pA[(i * n) + k] = pA[(i * n) + p];
+          pA[(i * n) + p] = temp;
+        }
+
+        temp = pA[(k * n) + k];
+        pA[(k * n) + k] = pA[(p * n) + p];
+        pA[(p * n) + p] = temp;
+      }
+
+      d = pA[(k * n) + k];
+
+      if(d == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        for (i = k + 1u; i < n; i++)
+        {
+          /* Column k of L, then the update of row i of the submatrix.
+           ** Rows above i already hold L(j,k), so A(i,j) -= v * L(j,k) */
+          pRowI = pA + (i * n);
+          v = pRowI[k];
+          pRowI[k] = v / d;
+          pRowI += k + 1u;
+          pColK = pA + ((k + 1u) * n) + k;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+          /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+          /* Loop unrolling */
+          j = (i - k) >> 2u;
+
+          while(j > 0u)
+          {
+            pRowI[0] -= v * pColK[0];
+            pRowI[1] -= v * pColK[n];
+            pRowI[2] -= v * pColK[2u * n];
+            pRowI[3] -= v * pColK[3u * n];
+            pRowI += 4u;
+            pColK += 4u * n;
+            j--;
+          }
+
+          j = (i - k) % 0x4u;
+
+#else
+
+          /* Run the below code for Cortex-M0 */
+
+          j = i - k;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+          while(j > 0u)
+          {
+            *pRowI++ -= v * *pColK;
+            pColK += n;
+            j--;
+          }
+        }
+      }
+    }
+
+    /* Clear the upper triangle */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = i + 1u; j < n; j++)
+      {
+        pA[(i * n) + j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_ldlt_q31.c
+*
+* Description:  Q31 LDL' decomposition with symmetric pivoting.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Q31 LDL' decomposition.
+ * @param[in]  *pSrc   points to the symmetric input matrix structure.
+ * @param[out] *pDst   points to the output matrix structure for <code>L</code> and <code>D</code>, may be <code>pSrc</code>.
+ * @param[out] *pPivot points to the row swaps, an array of <code>numRows</code> values.
+ * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not
+ * square and of the same size, <code>ARM_MATH_SINGULAR</code> if the input matrix is singular
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The elements of <code>L</code> are the quotients of 64-bit divisions, and
+ * the submatrix update is computed in 2.62 format and saturated to 1.31
+ * format. For a positive semi-definite input the results cannot overflow.
+ */
+
+arm_status arm_mat_ldlt_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst,
+  uint16_t * pPivot)
+{
+  q31_t *pA = pDst->pData;                   /* output data matrix pointer */
+  q31_t *pRowI, *pColK;                      /* temporary pointers */
+  q31_t d, v, maxVal, temp;                      /* pivot, element and swap values */
+  uint16_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k, p;                           /* loop counters and pivot row */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pSrc->pData != pA)
+    {
+      memcpy(pA, pSrc->pData, (uint32_t) n * n * sizeof(q31_t));
+    }
+
+    for (k = 0u; (k < n) && (status == ARM_MATH_SUCCESS); k++)
+    {
+      /* Find the largest remaining diagonal element */
+      p = k;
+      maxVal = (pA[(k * n) + k] > 0) ? pA[(k * n) + k] : -pA[(k * n) + k];
+
+      for (i = k + 1u; i < n; i++)
+      {
+        temp = (pA[(i * n) + i] > 0) ? pA[(i * n) + i] : -pA[(i * n) + i];
+
+        if(temp > maxVal)
+        {
+          maxVal = temp;
+          p = i;
+        }
+      }
+
+      pPivot[k] = (uint16_t) p;
+
+      if(p != k)
+      {
+        /* Swap rows and columns k and p within the lower triangle */
+        for (j = 0u; j < k; j++)
+        {
+          temp = pA[(k * n) + j];
+          pA[(k * n) + j] = pA[(p * n) + j];
+          pA[(p * n) + j] = temp;
+        }
+
+        for (i = k + 1u; i < p; i++)
+        {
+          temp = pA[(i * n) + k];
+          pA[(i * n) + k] = pA[(p * n) + i];
+          pA[(p * n) + i] = temp;
+        }
+
+        for (i = p + 1u; i < n; i++)
+        {
+          temp = pA[(i * n) + k];
+          pA[(i * n) + k] = pA[(i * n) + p];
+          pA[(i * n) + p] = temp;
+        }
+
+        temp = pA[(k * n) + k];
+        pA[(k * n) + k] = pA[(p * n) + p];
+        pA[(p * n) + p] = temp;
+      }
+
+      d = pA[(k * n) + k];
+
+      if(d == 0)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        for (i = k + 1u; i < n; i++)
+        {
+          /* Column k of L, then the update of row i of the submatrix.
+           ** Rows above i already hold L(j,k), so A(i,j) -= v * L(j,k) */
+          pRowI = pA + (i * n);
+          v = pRowI[k];
+          pRowI[k] = clip_q63_to_q31(((q63_t) v << 31) / d);
+          pRowI += k + 1u;
+          pColK = pA + ((k + 1u) * n) + k;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+          /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+          /* Loop unrolling */
+          j = (i - k) >> 2u;
+
+          while(j > 0u)
+          {
+            pRowI[0] = clip_q63_to_q31((((q63_t) pRowI[0] << 31) - ((q63_t) v * pColK[0])) >> 31);
+            pRowI[1] = clip_q63_to_q31((((q63_t) pRowI[1] << 31) - ((q63_t) v * pColK[n])) >> 31);
+            pRowI[2] = clip_q63_to_q31((((q63_t) pRowI[2] << 31) - ((q63_t) v * pColK[2u * n])) >> 31);
+            pRowI[3] = clip_q63_to_q31((((q63_t) pRowI[3] << 31) - ((q63_t) v * pColK[3u * n])) >> 31);
+            pRowI += 4u;
+            pColK += 4u * n;
+            j--;
+          }
+
+          j = (i - k) % 0x4u;
+
+#else
+
+          /* Run the below code for Cortex-M0 */
+
+          j = i - k;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+          while(j > 0u)
+          {
+            *pRowI = clip_q63_to_q31((((q63_t) * pRowI << 31) - ((q63_t) v * *pColK)) >> 31);
+            pRowI++;
+            pColK += n;
+            j--;
+          }
+        }
+      }
+    }
+
+    /* Clear the upper triangle */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = i + 1u; j < n; j++)
+      {
+        pA[(i * n) + j] = 0;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
@@ -0,0 +1,215 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_lu_f32.c
+*
+* Description:  Floating-point LU decomposition with partial pivoting.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLU LU Decomposition
+ *
+ * Factors a square matrix into a unit lower triangular matrix
+ * <code>L</code> and an upper triangular matrix <code>U</code>, and solves
+ * linear systems with the factors:
+ * <pre>
+ *     P * A = L * U
+ * </pre>
+ * This works for any non-singular matrix, symmetric or not.
+ *
+ * \par Algorithm
+ * Gaussian elimination with partial pivoting. At step k the row with the
+ * largest element in column k at or below the diagonal is swapped into
+ * row k, so all elements of <code>L</code> are at most 1 in magnitude.
+ * <code>pPivot[k]</code> is the row swapped with row k at step k. The
+ * output holds <code>L</code> below the diagonal, without its unit
+ * diagonal, and <code>U</code> on and above it. The destination may be
+ * the source matrix, so the decomposition can be done in place. If a
+ * column has no non-zero pivot the function returns
+ * <code>ARM_MATH_SINGULAR</code>.
+ *
+ * \par
+ * <code>arm_mat_lu_solve</code> applies the row swaps to <code>B</code>
+ * and solves <code>L * Y = P * B</code> and <code>U * X = Y</code> by
+ * forward and back substitution. <code>X</code> may be <code>B</code>.
+ *
+ * \par Fixed-Point Behavior
+ * The elements of <code>L</code> fit the Q31 format. Those of
+ * <code>U</code> can grow during the elimination, for a diagonally
+ * dominant matrix by at most a factor of 2, and are saturated to the Q31
+ * range. Scale <code>A</code> down to leave room for this. The solution
+ * <code>X</code> is saturated too; scale <code>B</code> down by the
+ * expected gain of the inverse of <code>A</code>.
+ */
+
+/**
+ * @addtogroup MatrixLU
+ * @{
+ */
+
+/**
+ * @brief Floating-point LU decomposition.
+ * @param[in]  *pSrc   points to the input matrix structure.
+ * @param[out] *pDst   points to the output matrix structure for <code>L</code> and <code>U</code>, may be <code>pSrc</code>.
+ * @param[out] *pPivot points to the row swaps, an array of <code>numRows</code> values.
+ * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not
+ * square and of the same size, <code>ARM_MATH_SINGULAR</code> if the input matrix is singular
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPivot)
+{
+  float32_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRowI, *pRowK;                      /* temporary pointers */
+  float32_t pivot, l, maxVal, temp;              /* pivot, multiplier and swap values */
+  uint16_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k, p;                           /* loop counters and pivot row */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pSrc->pData != pA)
+    {
+      memcpy(pA, pSrc->pData, (uint32_t) n * n * sizeof(float32_t));
+    }
+
+    for (k = 0u; (k < n) && (status == ARM_MATH_SUCCESS); k++)
+    {
+      /* Find the largest element in column k on or below the diagonal */
+      p = k;
+      maxVal = fabsf(pA[(k * n) + k]);
+
+      for (i = k + 1u; i < n; i++)
+      {
+        if(fabsf(pA[(i * n) + k]) > maxVal)
+        {
+          maxVal = fabsf(pA[(i * n) + k]);
+          p = i;
+        }
+      }
+
+      pPivot[k] = (uint16_t) p;
+
+      if(maxVal == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        if(p != k)
+        {
+          for (j = 0u; j < n; j++)
+          {
+            temp = pA[(k * n) + j];
+            pA[(k * n) + j] = pA[(p * n) + j];
+            pA[(p * n) + j] = temp;
+          }
+        }
+
+        pivot = pA[(k * n) + k];
+
+        for (i = k + 1u; i < n; i++)
+        {
+          /* Row i of L, then row i minus l times row k */
+          pRowI = pA + (i * n) + k;
+          pRowK = pA + (k * n) + k + 1u;
+          l = *pRowI / pivot;
+          *pRowI++ = l;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+          /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+          /* Loop unrolling */
+          j = (n - 1u - k) >> 2u;
+
+          while(j > 0u)
+          {
+            pRowI[0] -= l * pRowK[0];
+            pRowI[1] -= l * pRowK[1];
+            pRowI[2] -= l * pRowK[2];
+            pRowI[3] -= l * pRowK[3];
+            pRowI += 4u;
+            pRowK += 4u;
+            j--;
+          }
+
+          j = (n - 1u - k) % 0x4u;
+
+#else
+
+          /* Run the below code for Cortex-M0 */
+
+          j = n - 1u - k;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+          while(j > 0u)
+          {
+            *pRowI++ -= l * *pRowK++;
+            j--;
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLU group
+ */
@@ -0,0 +1,240 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_qr_f32.c
+*
+* Description:  Floating-point QR decomposition by Householder reflections.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixQR QR Decomposition
+ *
+ * Factors an <code>M x N</code> matrix with <code>M >= N</code> into an
+ * orthogonal matrix <code>Q</code> and an upper triangular matrix
+ * <code>R</code>, and solves linear least squares problems with the
+ * factors:
+ * <pre>
+ *     A = Q * R
+ * </pre>
+ * The least squares solution of <code>A * X = B</code> is
+ * <code>R * X = Q' * B</code>. Unlike the normal equations
+ * <code>A' * A * X = A' * B</code> this does not square the condition
+ * number of <code>A</code>.
+ *
+ * \par Algorithm
+ * Householder reflections. Step k reflects column k below the diagonal
+ * onto the diagonal with
+ * <pre>
+ *     H(k) = I - tau(k) * v * v'
+ * </pre>
+ * where <code>v(k) = 1</code>, and applies the reflection to the columns
+ * on the right. <code>Q = H(0) * H(1) * ... * H(N-1)</code> is not formed:
+ * the output holds <code>R</code> on and above the diagonal and the
+ * elements of <code>v</code> below <code>v(k)</code> in column k below
+ * the diagonal. <code>tau</code> goes to a separate array of N values.
+ * The destination may be the source matrix, so the decomposition can be
+ * done in place.
+ *
+ * \par
+ * <code>arm_mat_qr_solve</code> applies the reflections to
+ * <code>B</code> in place, giving <code>Q' * B</code>, and solves
+ * <code>R * X = Q' * B</code> by back substitution. <code>X</code> may
+ * share the data of <code>B</code>, as it is the same size as the first
+ * N rows. If <code>R</code> has a zero on its diagonal, <code>A</code>
+ * does not have full rank and the solve returns
+ * <code>ARM_MATH_SINGULAR</code>.
+ *
+ * \par Fixed-Point Behavior
+ * The reflections keep the norm of every column, so the elements of
+ * <code>R</code> are at most the norm of the columns of <code>A</code>.
+ * For the Q31 functions scale <code>A</code> so that its column norms are
+ * below 1, e.g. by <code>1/sqrt(M)</code>. The elements of
+ * <code>v</code> are at most 1 and <code>tau</code> lies in [1, 2]; the
+ * Q31 functions store <code>tau/2</code>. Sums are accumulated in 2.62
+ * format. The solution <code>X</code> is saturated to the Q31 range;
+ * scale <code>B</code> down by the expected gain of the inverse of
+ * <code>R</code>.
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point QR decomposition.
+ * @param[in]  *pSrc points to the input matrix structure, with at least as many rows as columns.
+ * @param[out] *pDst points to the output matrix structure for <code>R</code> and the reflections, may be <code>pSrc</code>.
+ * @param[out] *pTau points to the reflection factors, an array of <code>numCols</code> values.
+ * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not
+ * of the same size or have more columns than rows, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau)
+{
+  float32_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pV, *pCol;                          /* reflection and column pointers */
+  float32_t alpha, beta, tau, scale, sum;        /* reflection values */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t n = pSrc->numCols;                    /* number of columns of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows < pSrc->numCols) || (pDst->numRows != pSrc->numRows)
+     || (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pSrc->pData != pA)
+    {
+      memcpy(pA, pSrc->pData, (uint32_t) numRows * n * sizeof(float32_t));
+    }
+
+    for (k = 0u; k < n; k++)
+    {
+      /* Squared norm of column k below the diagonal */
+      pV = pA + ((k + 1u) * n) + k;
+      sum = 0.0f;
+
+      for (i = k + 1u; i < numRows; i++)
+      {
+        sum += *pV * *pV;
+        pV += n;
+      }
+
+      alpha = pA[(k * n) + k];
+      tau = 0.0f;
+
+      if(sum > 0.0f)
+      {
+        /* beta = -sign(alpha) * norm, so alpha - beta does not cancel */
+        arm_sqrt_f32((alpha * alpha) + sum, &beta);
+        beta = (alpha >= 0.0f) ? -beta : beta;
+        tau = (beta - alpha) / beta;
+        scale = 1.0f / (alpha - beta);
+        pA[(k * n) + k] = beta;
+
+        pV = pA + ((k + 1u) * n) + k;
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          *pV *= scale;
+          pV += n;
+        }
+
+        /* Apply the reflection to the columns on the right */
+        for (j = k + 1u; j < n; j++)
+        {
+          pV = pA + ((k + 1u) * n) + k;
+          pCol = pA + ((k + 1u) * n) + j;
+          sum = pA[(k * n) + j];
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+          /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+          /* Loop unrolling */
+          i = (numRows - 1u - k) >> 2u;
+
+          while(i > 0u)
+          {
+            sum += (pV[0] * pCol[0]) + (pV[n] * pCol[n])
+              + (pV[2u * n] * pCol[2u * n]) + (pV[3u * n] * pCol[3u * n]);
+            pV += 4u * n;
+            pCol += 4u * n;
+            i--;
+          }
+
+          i = (numRows - 1u - k) % 0x4u;
+
+#else
+
+          /* Run the below code for Cortex-M0 */
+
+          i = numRows - 1u - k;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+          while(i > 0u)
+          {
+            sum += *pV * *pCol;
+            pV += n;
+            pCol += n;
+            i--;
+          }
+
+          sum *= tau;
+          pA[(k * n) + j] -= sum;
+
+          pV = pA + ((k + 1u) * n) + k;
+          pCol = pA + ((k + 1u) * n) + j;
+
+          for (i = k + 1u; i < numRows; i++)
+          {
+            *pCol -= sum * *pV;
+            pV += n;
+            pCol += n;
+          }
+        }
+      }
+
+      pTau[k] = tau;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_qr_q31.c
+*
+* Description:  Q31 QR decomposition by Householder reflections.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Q31 QR decomposition.
+ * @param[in]  *pSrc points to the input matrix structure, with at least as many rows as columns.
+ * @param[out] *pDst points to the output matrix structure for <code>R</code> and the reflections, may be <code>pSrc</code>.
+ * @param[out] *pTau points to the reflection factors divided by 2, an array of <code>numCols</code> values.
+ * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not
+ * of the same size or have more columns than rows, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The column norms are accumulated in 2.62 format and their square root
+ * saturates at 1, so the columns of the input must have a norm below 1.
+ * The products of the reflections are accumulated in 2.62 format and the
+ * results saturated to 1.31 format.
+ */
+
+arm_status arm_mat_qr_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst,
+  q31_t * pTau)
+{
+  q31_t *pA = pDst->pData;                       /* output data matrix pointer */
+  q31_t *pV, *pCol;                              /* reflection and column pointers */
+  q31_t alpha, beta, tauHalf, tw;                /* reflection values */
+  q63_t sum, den;                                /* accumulators */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t n = pSrc->numCols;                    /* number of columns of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows < pSrc->numCols) || (pDst->numRows != pSrc->numRows)
+     || (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(pSrc->pData != pA)
+    {
+      memcpy(pA, pSrc->pData, (uint32_t) numRows * n * sizeof(q31_t));
+    }
+
+    for (k = 0u; k < n; k++)
+    {
+      /* Squared norm of column k below the diagonal in 2.62 format */
+      pV = pA + ((k + 1u) * n) + k;
+      sum = 0;
+
+      for (i = k + 1u; i < numRows; i++)
+      {
+        sum += (q63_t) * pV * *pV;
+        pV += n;
+      }
+
+      alpha = pA[(k * n) + k];
+      tauHalf = 0;
+
+      if(sum > 0)
+      {
+        /* beta = -sign(alpha) * norm, so alpha - beta does not cancel */
+        beta = sqrt_q63_to_q31(((q63_t) alpha * alpha) + sum);
+        beta = (alpha >= 0) ? -beta : beta;
+
+        /* tau / 2 = (beta - alpha) / (2 * beta), in [0.5, 1] */
+        tauHalf = clip_q63_to_q31((((q63_t) beta - alpha) << 30) / beta);
+        den = (q63_t) alpha - beta;
+        pA[(k * n) + k] = beta;
+
+        /* v = x / (alpha - beta), at most 1 in magnitude */
+        pV = pA + ((k + 1u) * n) + k;
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          *pV = clip_q63_to_q31(((q63_t) * pV << 31) / den);
+          pV += n;
+        }
+
+        /* Apply the reflection to the columns on the right */
+        for (j = k + 1u; j < n; j++)
+        {
+          pV = pA + ((k + 1u) * n) + k;
+          pCol = pA + ((k + 1u) * n) + j;
+          sum = (q63_t) pA[(k * n) + j] << 31;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+          /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+          /* Loop unrolling */
+          i = (numRows - 1u - k) >> 2u;
+
+          while(i > 0u)
+          {
+            sum += (q63_t) pV[0] * pCol[0];
+            sum += (q63_t) pV[n] * pCol[n];
+            sum += (q63_t) pV[2u * n] * pCol[2u * n];
+            sum += (q63_t) pV[3u * n] * pCol[3u * n];
+            pV += 4u * n;
+            pCol += 4u * n;
+            i--;
+          }
+
+          i = (numRows - 1u - k) % 0x4u;
+
+#else
+
+          /* Run the below code for Cortex-M0 */
+
+          i = numRows - 1u - k;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+          while(i > 0u)
+          {
+            sum += (q63_t) * pV * *pCol;
+            pV += n;
+            pCol += n;
+            i--;
+          }
+
+          /* tau * v' * x / 2, below 1 in magnitude */
+          tw = clip_q63_to_q31(((sum >> 31) * tauHalf) >> 31);
+          pA[(k * n) + j] = clip_q63_to_q31((q63_t) pA[(k * n) + j] - (2 * (q63_t) tw));
+
+          pV = pA + ((k + 1u) * n) + k;
+          pCol = pA + ((k + 1u) * n) + j;
+
+          for (i = k + 1u; i < numRows; i++)
+          {
+            *pCol = clip_q63_to_q31((q63_t) * pCol - (((q63_t) tw * *pV) >> 30));
+            pV += n;
+            pCol += n;
+          }
+        }
+      }
+
+      pTau[k] = tauHalf;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,227 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_qr_solve_q31.c
+*
+* Description:  Q31 least squares solve with a QR decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Q31 least squares solve with a QR decomposition.
+ * @param[in]     *pQR  points to the matrix structure of <code>R</code> and the reflections from <code>arm_mat_qr_q31()</code>.
+ * @param[in]     *pTau points to the reflection factors from <code>arm_mat_qr_q31()</code>.
+ * @param[in,out] *pB   points to the right hand side matrix structure, overwritten with <code>Q' * B</code>.
+ * @param[out]    *pX   points to the solution matrix structure, may share the data of <code>pB</code>.
+ * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes do not
+ * match, <code>ARM_MATH_SINGULAR</code> if <code>R</code> has a zero on its diagonal and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * Finds the <code>X</code> that minimizes the norm of <code>A * X - B</code>
+ * for all columns of <code>B</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The reflections and the back substitution accumulate in 2.62 format.
+ * The results are saturated to 1.31 format, so <code>B</code> must be
+ * scaled down enough for the solution to fit.
+ */
+
+arm_status arm_mat_qr_solve_q31(
+  const arm_matrix_instance_q31 * pQR,
+  const q31_t * pTau,
+  arm_matrix_instance_q31 * pB,
+  arm_matrix_instance_q31 * pX)
+{
+  q31_t *pInQR = pQR->pData;                 /* R and reflections data matrix pointer */
+  q31_t *pInB = pB->pData;                   /* right hand side data pointer */
+  q31_t *pOut = pX->pData;                   /* solution data pointer */
+  q31_t *pA, *pY;                            /* temporary pointers */
+  q63_t sum;                                     /* accumulator */
+  q31_t tw;                                      /* tau * v' * b / 2 */
+  uint16_t numRows = pQR->numRows;               /* number of rows of A */
+  uint16_t n = pQR->numCols;                     /* number of columns of A */
+  uint16_t numCols = pB->numCols;                /* number of right hand sides */
+  uint32_t i, c, k;                              /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((numRows < n) || (pB->numRows != numRows)
+     || (pX->numRows != n) || (pX->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (i = 0u; i < n; i++)
+    {
+      if(pInQR[(i * n) + i] == 0)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+
+    for (c = 0u; (c < numCols) && (status == ARM_MATH_SUCCESS); c++)
+    {
+      /* Q' * B, the reflections in order */
+      for (k = 0u; k < n; k++)
+      {
+        pA = pInQR + ((k + 1u) * n) + k;
+        pY = pInB + ((k + 1u) * numCols) + c;
+        sum = (q63_t) pInB[(k * numCols) + c] << 31;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling */
+        i = (numRows - 1u - k) >> 2u;
+
+        while(i > 0u)
+        {
+          sum += (q63_t) pA[0] * pY[0];
+          sum += (q63_t) pA[n] * pY[numCols];
+          sum += (q63_t) pA[2u * n] * pY[2u * numCols];
+          sum += (q63_t) pA[3u * n] * pY[3u * numCols];
+          pA += 4u * n;
+          pY += 4u * numCols;
+          i--;
+        }
+
+        i = (numRows - 1u - k) % 0x4u;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        i = numRows - 1u - k;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        while(i > 0u)
+        {
+          sum += (q63_t) * pA * *pY;
+          pA += n;
+          pY += numCols;
+          i--;
+        }
+
+        tw = clip_q63_to_q31(((sum >> 31) * pTau[k]) >> 31);
+        pInB[(k * numCols) + c] = clip_q63_to_q31((q63_t) pInB[(k * numCols) + c] - (2 * (q63_t) tw));
+
+        pA = pInQR + ((k + 1u) * n) + k;
+        pY = pInB + ((k + 1u) * numCols) + c;
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          *pY = clip_q63_to_q31((q63_t) * pY - (((q63_t) tw * *pA) >> 30));
+          pA += n;
+          pY += numCols;
+        }
+      }
+
+      /* Back substitution, R * X = Q' * B, along row i of R */
+      i = n;
+
+      while(i > 0u)
+      {
+        i--;
+        sum = (q63_t) pInB[(i * numCols) + c] << 31;
+        pA = pInQR + (i * n) + i + 1u;
+        pY = pOut + ((i + 1u) * numCols) + c;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling */
+        k = (n - 1u - i) >> 2u;
+
+        while(k > 0u)
+        {
+          sum -= (q63_t) pA[0] * pY[0];
+          sum -= (q63_t) pA[1] * pY[numCols];
+          sum -= (q63_t) pA[2] * pY[2u * numCols];
+          sum -= (q63_t) pA[3] * pY[3u * numCols];
+          pA += 4u;
+          pY += 4u * numCols;
+          k--;
+        }
+
+        k = (n - 1u - i) % 0x4u;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        k = n - 1u - i;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        while(k > 0u)
+        {
+          sum -= (q63_t) * pA++ * *pY;
+          pY += numCols;
+          k--;
+        }
+
+        /* 2.62 divided by 1.31 gives 1.31 */
+        pOut[(i * numCols) + c] = clip_q63_to_q31(sum / pInQR[(i * n) + i]);
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_conv_1x1_hwc_q7.c
+*
+* Description:  Q7 pointwise convolution layer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_nn_q7_to_q15_no_shift(
+  q7_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+extern void arm_nn_mat_mult_kernel_q7_q15(
+  q7_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pBias,
+  q7_t * pDst);
+
+extern void arm_nn_vec_mult_kernel_q7_q15(
+  q7_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pBias,
+  q7_t * pDst);
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief  Q7 pointwise (1 x 1) convolution layer.
+ * @param[in]  *pSrc      points to the input image, <code>dimIn x dimIn x chIn</code> values.
+ * @param[in]  dimIn      width and height of the input and output images.
+ * @param[in]  chIn       number of input channels.
+ * @param[in]  *pWeights  points to the weights, <code>chOut x chIn</code> values.
+ * @param[in]  chOut      number of output channels.
+ * @param[in]  *pBias     points to the <code>chOut</code> bias values.
+ * @param[in]  biasShift  left shift of the bias.
+ * @param[in]  outShift   right shift of the outputs.
+ * @param[out] *pDst      points to the output image, <code>dimIn x dimIn x chOut</code> values.
+ * @param[in]  *pBuffer   points to a buffer of <code>ARM_NN_CONV_BUFFER_SIZE(chIn, 1)</code> values.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are accumulated in a 32-bit accumulator, which does not
+ * wrap as long as <code>chIn</code> is below 2^17.
+ */
+
+void arm_nn_conv_1x1_hwc_q7(
+  q7_t * pSrc,
+  uint16_t dimIn,
+  uint16_t chIn,
+  q7_t * pWeights,
+  uint16_t chOut,
+  q7_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pDst,
+  q15_t * pBuffer)
+{
+  uint32_t numPixels;                            /* pixels of the image */
+  uint32_t pixCnt;                               /* loop counter */
+
+  numPixels = (uint32_t) dimIn * dimIn;
+
+  /* Each pixel is a column, two of them are sign extended at a time */
+  pixCnt = numPixels >> 1u;
+
+  while(pixCnt > 0u)
+  {
+    arm_nn_q7_to_q15_no_shift(pSrc, pBuffer, 2u * chIn);
+    arm_nn_mat_mult_kernel_q7_q15(pWeights, pBuffer, chOut, chIn, biasShift, outShift, pBias, pDst);
+
+    pSrc += 2u * chIn;
+    pDst += 2u * chOut;
+    pixCnt--;
+  }
+
+  if((numPixels & 1u) != 0u)
+  {
+    arm_nn_q7_to_q15_no_shift(pSrc, pBuffer, chIn);
+    arm_nn_vec_mult_kernel_q7_q15(pWeights, pBuffer, chOut, chIn, biasShift, outShift, pBias, pDst);
+  }
+}
+
+/**
+ * @} end of NNConv group
+ */
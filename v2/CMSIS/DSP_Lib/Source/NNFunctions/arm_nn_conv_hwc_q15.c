@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_conv_hwc_q15.c
+*
+* Description:  Q15 convolution layer with im2col.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_nn_mat_mult_kernel_q15(
+  q15_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pBias,
+  q15_t * pDst);
+
+extern void arm_nn_vec_mult_kernel_q15(
+  q15_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pBias,
+  q15_t * pDst);
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief  Q15 convolution layer.
+ * @param[in]  *pSrc      points to the input image, <code>dimIn x dimIn x chIn</code> values.
+ * @param[in]  dimIn      width and height of the input image.
+ * @param[in]  chIn       number of input channels.
+ * @param[in]  *pWeights  points to the weights, <code>chOut x dimKernel x dimKernel x chIn</code> values.
+ * @param[in]  chOut      number of output channels.
+ * @param[in]  dimKernel  width and height of the kernel.
+ * @param[in]  padding    zero padding on each side of the input.
+ * @param[in]  stride     step of the kernel.
+ * @param[in]  *pBias     points to the <code>chOut</code> bias values.
+ * @param[in]  biasShift  left shift of the bias.
+ * @param[in]  outShift   right shift of the outputs.
+ * @param[out] *pDst      points to the output image, <code>dimOut x dimOut x chOut</code> values.
+ * @param[in]  *pBuffer   points to a buffer of <code>ARM_NN_CONV_BUFFER_SIZE(chIn, dimKernel)</code> values.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are accumulated in a 64-bit accumulator.
+ */
+
+void arm_nn_conv_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t chIn,
+  q15_t * pWeights,
+  uint16_t chOut,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q15_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pDst,
+  q15_t * pBuffer)
+{
+  uint32_t dimOut;                               /* output width */
+  uint32_t colLen;                               /* values of a column */
+  q15_t *pCol = pBuffer;                         /* next column of the buffer */
+  q15_t *pOut = pDst;                            /* next output pixel */
+  int32_t x, y;                                  /* input position */
+  uint32_t outX, outY, kx, ky;                   /* loop counters */
+
+  dimOut = ((dimIn + (2u * padding) - dimKernel) / stride) + 1u;
+  colLen = (uint32_t) chIn * dimKernel * dimKernel;
+
+  for (outY = 0u; outY < dimOut; outY++)
+  {
+    for (outX = 0u; outX < dimOut; outX++)
+    {
+      /* im2col: the input under the kernel, zeros outside of the image */
+      for (ky = 0u; ky < dimKernel; ky++)
+      {
+        y = (int32_t) ((outY * stride) + ky) - (int32_t) padding;
+
+        for (kx = 0u; kx < dimKernel; kx++)
+        {
+          x = (int32_t) ((outX * stride) + kx) - (int32_t) padding;
+
+          if((y < 0) || (y >= (int32_t) dimIn) || (x < 0) || (x >= (int32_t) dimIn))
+          {
+            arm_fill_q15(0, pCol, chIn);
+          }
+          else
+          {
+            arm_copy_q15(pSrc + ((((uint32_t) y * dimIn) + (uint32_t) x) * chIn), pCol, chIn);
+          }
+
+          pCol += chIn;
+        }
+      }
+
+      /* Two columns make two output pixels */
+      if(pCol == (pBuffer + (2u * colLen)))
+      {
+        arm_nn_mat_mult_kernel_q15(pWeights, pBuffer, chOut, (uint16_t) colLen, biasShift, outShift,
+                                   pBias, pOut);
+        pOut += 2u * chOut;
+        pCol = pBuffer;
+      }
+    }
+  }
+
+  /* The last output pixel if there is an odd number of them */
+  if(pCol != pBuffer)
+  {
+    arm_nn_vec_mult_kernel_q15(pWeights, pBuffer, chOut, (uint16_t) colLen, biasShift, outShift,
+                               pBias, pOut);
+  }
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_depthwise_conv_hwc_q15.c
+*
+* Description:  Q15 depthwise convolution layer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief  Q15 depthwise convolution layer.
+ * @param[in]  *pSrc      points to the input image, <code>dimIn x dimIn x ch</code> values.
+ * @param[in]  dimIn      width and height of the input image.
+ * @param[in]  ch         number of input and output channels.
+ * @param[in]  *pWeights  points to the weights, <code>dimKernel x dimKernel x ch</code> values.
+ * @param[in]  dimKernel  width and height of the kernel.
+ * @param[in]  padding    zero padding on each side of the input.
+ * @param[in]  stride     step of the kernel.
+ * @param[in]  *pBias     points to the <code>ch</code> bias values.
+ * @param[in]  biasShift  left shift of the bias.
+ * @param[in]  outShift   right shift of the outputs.
+ * @param[out] *pDst      points to the output image, <code>dimOut x dimOut x ch</code> values.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are accumulated in a 64-bit accumulator.
+ * The padding is skipped rather than multiplied by zero.
+ */
+
+void arm_nn_depthwise_conv_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  q15_t * pWeights,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q15_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pDst)
+{
+  q63_t round = ((q63_t) 1 << outShift) >> 1;    /* rounding of the outputs */
+  uint32_t dimOut;                               /* output width */
+  int32_t y0, x0;                                /* input position of the kernel */
+  uint32_t kyStart, kyEnd, kxStart, kxEnd;       /* kernel rows and columns on the image */
+  uint32_t offset;                               /* input of the first kernel position on the image */
+  q15_t *pIn, *pW;                               /* input and weight pointers */
+  q63_t sum;                                     /* accumulator */
+  uint32_t outX, outY, ky, kx, c;                /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q63_t sum1, sum2, sum3;                        /* accumulators of the next channels */
+  uint32_t chCnt;                                /* loop counter */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  dimOut = ((dimIn + (2u * padding) - dimKernel) / stride) + 1u;
+
+  for (outY = 0u; outY < dimOut; outY++)
+  {
+    /* Rows of the kernel that are on the image */
+    y0 = (int32_t) (outY * stride) - (int32_t) padding;
+    kyStart = (y0 < 0) ? (uint32_t) -y0 : 0u;
+    kyEnd = ((y0 + (int32_t) dimKernel) > (int32_t) dimIn) ? (uint32_t) ((int32_t) dimIn - y0) : dimKernel;
+
+    for (outX = 0u; outX < dimOut; outX++)
+    {
+      x0 = (int32_t) (outX * stride) - (int32_t) padding;
+      kxStart = (x0 < 0) ? (uint32_t) -x0 : 0u;
+      kxEnd = ((x0 + (int32_t) dimKernel) > (int32_t) dimIn) ? (uint32_t) ((int32_t) dimIn - x0) : dimKernel;
+      offset = ((((uint32_t) (y0 + (int32_t) kyStart) * dimIn) + (uint32_t) (x0 + (int32_t) kxStart)) * ch);
+
+      c = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Four channels at a time, so each kernel position is addressed once for all of them */
+      chCnt = ch >> 2u;
+
+      while(chCnt > 0u)
+      {
+        sum = ((q63_t) pBias[c] << biasShift) + round;
+        sum1 = ((q63_t) pBias[c + 1u] << biasShift) + round;
+        sum2 = ((q63_t) pBias[c + 2u] << biasShift) + round;
+        sum3 = ((q63_t) pBias[c + 3u] << biasShift) + round;
+
+        for (ky = kyStart; ky < kyEnd; ky++)
+        {
+          pIn = pSrc + offset + ((ky - kyStart) * dimIn * ch) + c;
+          pW = pWeights + ((((ky * dimKernel) + kxStart) * ch) + c);
+
+          for (kx = kxStart; kx < kxEnd; kx++)
+          {
+            sum += (q31_t) pIn[0] * pW[0];
+            sum1 += (q31_t) pIn[1] * pW[1];
+            sum2 += (q31_t) pIn[2] * pW[2];
+            sum3 += (q31_t) pIn[3] * pW[3];
+            pIn += ch;
+            pW += ch;
+          }
+        }
+
+        pDst[0] = (q15_t) __SSAT(clip_q63_to_q31(sum >> outShift), 16);
+        pDst[1] = (q15_t) __SSAT(clip_q63_to_q31(sum1 >> outShift), 16);
+        pDst[2] = (q15_t) __SSAT(clip_q63_to_q31(sum2 >> outShift), 16);
+        pDst[3] = (q15_t) __SSAT(clip_q63_to_q31(sum3 >> outShift), 16);
+        pDst += 4u;
+        c += 4u;
+        chCnt--;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      for (; c < ch; c++)
+      {
+        sum = ((q63_t) pBias[c] << biasShift) + round;
+
+        for (ky = kyStart; ky < kyEnd; ky++)
+        {
+          pIn = pSrc + offset + ((ky - kyStart) * dimIn * ch) + c;
+          pW = pWeights + ((((ky * dimKernel) + kxStart) * ch) + c);
+
+          for (kx = kxStart; kx < kxEnd; kx++)
+          {
+            sum += (q31_t) * pIn * *pW;
+            pIn += ch;
+            pW += ch;
+          }
+        }
+
+        *pDst++ = (q15_t) __SSAT(clip_q63_to_q31(sum >> outShift), 16);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of NNConv group
+ */
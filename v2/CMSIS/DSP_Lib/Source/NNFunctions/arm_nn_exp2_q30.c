@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_exp2_q30.c
+*
+* Description:  Power of two for the softmax functions.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* 2^(-k/32) for k = 0 .. 32 in Q30 */
+static const q31_t arm_nn_exp2_table_q30[33] = {
+  0x40000000, 0x3EA0ECB7, 0x3D495F45, 0x3BF92E67,
+  0x3AB031BA, 0x396E41BA, 0x383337BB, 0x36FEEDE6,
+  0x35D13F33, 0x34AA0764, 0x33892305, 0x326E6F62,
+  0x3159CA84, 0x304B1333, 0x2F4228E8, 0x2E3EEBD2,
+  0x2D413CCD, 0x2C48FD60, 0x2B560FBB, 0x2A6856AD,
+  0x297FB5AA, 0x289C10C1, 0x27BD4C98, 0x26E34E6E,
+  0x260DFC14, 0x253D3BEA, 0x2470F4DD, 0x23A90E63,
+  0x22E57079, 0x222603A0, 0x216AB0DA, 0x20B361A6,
+  0x20000000
+};
+
+/**
+ * @brief  Power of two of a value that is zero or negative, in Q30.
+ * @param[in] in        minus the exponent, with <code>fracBits</code> fractional bits.
+ * @param[in] fracBits  fractional bits of the exponent, up to 16.
+ * @return 2^(-in / 2^fracBits) in Q30 format.
+ *
+ * The fraction of the exponent indexes the table with its top 5 bits and
+ * interpolates with the next 11, which is within 6e-5 of the power.
+ */
+
+q31_t arm_nn_exp2_neg_q30(
+  uint32_t in,
+  uint16_t fracBits)
+{
+  uint32_t intPart = in >> fracBits;             /* integer part of the exponent */
+  uint32_t frac;                                 /* fraction of the exponent in Q16 */
+  uint32_t index;                                /* table index */
+  q31_t out;                                     /* power of the fraction */
+
+  if(intPart > 30u)
+  {
+    return (0);
+  }
+
+  frac = (in << (16u - fracBits)) & 0xFFFFu;
+  index = frac >> 11u;
+  frac &= 0x7FFu;
+
+  out = arm_nn_exp2_table_q30[index]
+    - (q31_t) ((((q63_t) arm_nn_exp2_table_q30[index] - arm_nn_exp2_table_q30[index + 1u]) * frac) >> 11);
+
+  return (out >> intPart);
+}
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_fully_connected_q7.c
+*
+* Description:  Q7 fully-connected layer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_nn_q7_to_q15_no_shift(
+  q7_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+extern void arm_nn_vec_mult_kernel_q7_q15(
+  q7_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pBias,
+  q7_t * pDst);
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNFullyConnected Fully-Connected Layer
+ *
+ * Multiplies the input vector by a weight matrix and adds a bias:
+ * <pre>
+ *     pDst[r] = pBias[r] + sum(pWeights[r * dimVec + c] * pSrc[c])    for c = 0 .. dimVec-1
+ * </pre>
+ * for each of the <code>numRows</code> rows of the weights, which are in
+ * row order.
+ *
+ * \par
+ * The Q7 layer sign extends the input into <code>pBuffer</code> once, so
+ * that the Cortex-M4 can multiply two weights at a time with
+ * <code>__SMLAD</code>, and does two rows at a time so each input value is
+ * read once for both. The buffer holds <code>dimVec</code> Q15 values.
+ * The Q15 layer needs no buffer.
+ */
+
+/**
+ * @addtogroup NNFullyConnected
+ * @{
+ */
+
+/**
+ * @brief  Q7 fully-connected layer.
+ * @param[in]  *pSrc      points to the input vector of <code>dimVec</code> values.
+ * @param[in]  *pWeights  points to the weights, <code>numRows</code> rows of <code>dimVec</code> values.
+ * @param[in]  dimVec     length of the input vector.
+ * @param[in]  numRows    number of outputs.
+ * @param[in]  biasShift  left shift of the bias.
+ * @param[in]  outShift   right shift of the outputs.
+ * @param[in]  *pBias     points to the <code>numRows</code> bias values.
+ * @param[out] *pDst      points to the <code>numRows</code> outputs.
+ * @param[in]  *pBuffer   points to a buffer of <code>dimVec</code> values.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are accumulated in a 32-bit accumulator together with the
+ * bias shifted left by <code>biasShift</code>. The sum is shifted right by
+ * <code>outShift</code> with rounding and saturated to Q7.
+ */
+
+void arm_nn_fully_connected_q7(
+  q7_t * pSrc,
+  q7_t * pWeights,
+  uint16_t dimVec,
+  uint16_t numRows,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pBias,
+  q7_t * pDst,
+  q15_t * pBuffer)
+{
+  /* Sign extend the input once for all the rows */
+  arm_nn_q7_to_q15_no_shift(pSrc, pBuffer, dimVec);
+
+  arm_nn_vec_mult_kernel_q7_q15(pWeights, pBuffer, numRows, dimVec, biasShift, outShift, pBias, pDst);
+}
+
+/**
+ * @} end of NNFullyConnected group
+ */
@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_pool_hwc_q15.c
+*
+* Description:  Q15 max and average pooling layers.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Larger of each pair of values of two Q15 blocks, in place in the first.
+ */
+static void arm_nn_max_q15(
+  q15_t * pSrcDst,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q15_t *pOut = pSrcDst;                         /* output pointer */
+  q31_t inA, inB;                                /* two values of each block */
+  q31_t mask;                                    /* 0xFFFF in the lanes where B is larger */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    inA = *__SIMD32(pSrcDst)++;
+    inB = *__SIMD32(pSrc)++;
+
+    /* The sign of the saturated difference selects the lanes of B */
+    mask = __QSUB16(0, (q31_t) __ROR((uint32_t) __QSUB16(inA, inB) & 0x80008000u, 15));
+    *__SIMD32(pOut)++ = (inA & ~mask) | (inB & mask);
+
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pSrcDst = (*pSrc > *pSrcDst) ? *pSrc : *pSrcDst;
+    pSrcDst++;
+    pSrc++;
+    blkCnt--;
+  }
+}
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNPool
+ * @{
+ */
+
+/**
+ * @brief  Q15 max pooling layer.
+ * @param[in]  *pSrc      points to the input image, <code>dimIn x dimIn x ch</code> values.
+ * @param[in]  dimIn      width and height of the input image.
+ * @param[in]  ch         number of channels.
+ * @param[in]  dimKernel  width and height of the window.
+ * @param[in]  padding    padding on each side of the input.
+ * @param[in]  stride     step of the window.
+ * @param[out] *pDst      points to the output image, <code>dimOut x dimOut x ch</code> values.
+ * @return none.
+ */
+
+void arm_nn_maxpool_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q15_t * pDst)
+{
+  uint32_t dimOut;                               /* output width */
+  int32_t y0, x0;                                /* input position of the window */
+  uint32_t yStart, yEnd, xStart, xEnd;           /* input rows and columns of the window */
+  uint32_t outX, outY, y, x;                     /* loop counters */
+
+  dimOut = ((dimIn + (2u * padding) - dimKernel) / stride) + 1u;
+
+  for (outY = 0u; outY < dimOut; outY++)
+  {
+    y0 = (int32_t) (outY * stride) - (int32_t) padding;
+    yStart = (y0 < 0) ? 0u : (uint32_t) y0;
+    yEnd = ((y0 + (int32_t) dimKernel) > (int32_t) dimIn) ? dimIn : (uint32_t) (y0 + (int32_t) dimKernel);
+
+    for (outX = 0u; outX < dimOut; outX++)
+    {
+      x0 = (int32_t) (outX * stride) - (int32_t) padding;
+      xStart = (x0 < 0) ? 0u : (uint32_t) x0;
+      xEnd = ((x0 + (int32_t) dimKernel) > (int32_t) dimIn) ? dimIn : (uint32_t) (x0 + (int32_t) dimKernel);
+
+      /* Start from the first pixel of the window and take the larger values of the others */
+      memcpy(pDst, pSrc + (((yStart * dimIn) + xStart) * ch), ch * sizeof(q15_t));
+
+      for (y = yStart; y < yEnd; y++)
+      {
+        for (x = (y == yStart) ? (xStart + 1u) : xStart; x < xEnd; x++)
+        {
+          arm_nn_max_q15(pDst, pSrc + (((y * dimIn) + x) * ch), ch);
+        }
+      }
+
+      pDst += ch;
+    }
+  }
+}
+
+/**
+ * @brief  Q15 average pooling layer.
+ * @param[in]  *pSrc      points to the input image, <code>dimIn x dimIn x ch</code> values.
+ * @param[in]  dimIn      width and height of the input image.
+ * @param[in]  ch         number of channels.
+ * @param[in]  dimKernel  width and height of the window.
+ * @param[in]  padding    padding on each side of the input.
+ * @param[in]  stride     step of the window.
+ * @param[out] *pDst      points to the output image, <code>dimOut x dimOut x ch</code> values.
+ * @return none.
+ */
+
+void arm_nn_avgpool_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q15_t * pDst)
+{
+  uint32_t dimOut;                               /* output width */
+  int32_t y0, x0;                                /* input position of the window */
+  uint32_t yStart, yEnd, xStart, xEnd;           /* input rows and columns of the window */
+  int32_t count;                                 /* pixels of the window on the image */
+  q15_t *pIn;                                    /* input pointer */
+  q31_t sum;                                     /* accumulator */
+  uint32_t outX, outY, y, x, c;                  /* loop counters */
+
+  dimOut = ((dimIn + (2u * padding) - dimKernel) / stride) + 1u;
+
+  for (outY = 0u; outY < dimOut; outY++)
+  {
+    y0 = (int32_t) (outY * stride) - (int32_t) padding;
+    yStart = (y0 < 0) ? 0u : (uint32_t) y0;
+    yEnd = ((y0 + (int32_t) dimKernel) > (int32_t) dimIn) ? dimIn : (uint32_t) (y0 + (int32_t) dimKernel);
+
+    for (outX = 0u; outX < dimOut; outX++)
+    {
+      x0 = (int32_t) (outX * stride) - (int32_t) padding;
+      xStart = (x0 < 0) ? 0u : (uint32_t) x0;
+      xEnd = ((x0 + (int32_t) dimKernel) > (int32_t) dimIn) ? dimIn : (uint32_t) (x0 + (int32_t) dimKernel);
+      count = (int32_t) ((yEnd - yStart) * (xEnd - xStart));
+
+      for (c = 0u; c < ch; c++)
+      {
+        sum = 0;
+
+        for (y = yStart; y < yEnd; y++)
+        {
+          pIn = pSrc + (((y * dimIn) + xStart) * ch) + c;
+
+          for (x = xStart; x < xEnd; x++)
+          {
+            sum += *pIn;
+            pIn += ch;
+          }
+        }
+
+        /* Average rounded away from zero at one half */
+        sum = (sum < 0) ? -(((-sum) + (count >> 1)) / count) : ((sum + (count >> 1)) / count);
+        *pDst++ = (q15_t) sum;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of NNPool group
+ */
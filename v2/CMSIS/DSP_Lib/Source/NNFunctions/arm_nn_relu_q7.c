@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_relu_q7.c
+*
+* Description:  Q7 rectified linear unit.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNActivation Activation Functions
+ *
+ * <code>arm_nn_relu</code> sets the negative values of a block to zero:
+ * <pre>
+ *     pDst[n] = max(pSrc[n], 0)    0 <= n < blockSize
+ * </pre>
+ * The Cortex-M4 and Cortex-M3 versions make a mask of the sign bits of
+ * four Q7 or two Q15 values with <code>__QSUB8</code> or
+ * <code>__QSUB16</code> and clear the negative lanes with it. The
+ * function can work in place.
+ *
+ * \par
+ * <code>arm_nn_softmax</code> turns the outputs of the last layer of a
+ * classifier into probabilities. It uses 2 rather than e as the base:
+ * <pre>
+ *     pDst[n] = 2^x[n] / sum(2^x[k])    0 <= k < blockSize
+ * </pre>
+ * where <code>x</code> is the input with <code>fracBits</code> fractional
+ * bits. A softmax with base e is the same function of the input times
+ * log2(e), which can be folded into the weights and bias of the layer
+ * before. The powers of two are taken relative to the largest input, from
+ * a table with linear interpolation, and the probabilities are in Q7 or
+ * Q15 format, saturated at the largest positive value.
+ */
+
+/**
+ * @addtogroup NNActivation
+ * @{
+ */
+
+/**
+ * @brief  Q7 rectified linear unit.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector, which may be <code>pSrc</code>.
+ * @param[in]  blockSize  number of values in the vectors.
+ * @return none.
+ */
+
+void arm_nn_relu_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in;                                      /* four input values */
+  q31_t mask;                                    /* 0xFF in the negative lanes */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pSrc)++;
+
+    /* Move each sign bit to the bottom of its lane and spread it over the lane */
+    mask = __QSUB8(0, (q31_t) __ROR((uint32_t) in & 0x80808080u, 7));
+    *__SIMD32(pDst)++ = in & ~mask;
+
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (*pSrc < 0) ? 0 : *pSrc;
+    pSrc++;
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of NNActivation group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_softmax_q7.c
+*
+* Description:  Q7 softmax with base 2.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern q31_t arm_nn_exp2_neg_q30(
+  uint32_t in,
+  uint16_t fracBits);
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNActivation
+ * @{
+ */
+
+/**
+ * @brief  Q7 softmax with base 2.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector, which may be <code>pSrc</code>.
+ * @param[in]  blockSize  number of values in the vectors.
+ * @param[in]  fracBits   fractional bits of the input, up to 7.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The powers are summed in a 64-bit accumulator and the outputs are in
+ * 1.7 format, saturated to 127 if one input is so far above the others
+ * that its probability rounds to 1.
+ */
+
+void arm_nn_softmax_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize,
+  uint16_t fracBits)
+{
+  q7_t maxVal;                                   /* largest input */
+  uint32_t index;                                /* position of the largest input */
+  q63_t sum = 0;                                 /* sum of the powers */
+  q63_t out;                                     /* one output */
+  uint32_t recip;                                /* 2^61 / sum */
+  uint32_t i;                                    /* loop counter */
+
+  arm_max_q7(pSrc, blockSize, &maxVal, &index);
+
+  /* The largest input gives 2^0, the sum is from 1 to blockSize in Q30 */
+  for (i = 0u; i < blockSize; i++)
+  {
+    sum += arm_nn_exp2_neg_q30((uint32_t) (maxVal - pSrc[i]), fracBits);
+  }
+
+  recip = (uint32_t) (((q63_t) 1 << 61) / sum);
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    out = (q63_t) arm_nn_exp2_neg_q30((uint32_t) (maxVal - pSrc[i]), fracBits) * recip;
+    out = (out + ((q63_t) 1 << 53)) >> 54;
+    pDst[i] = (q7_t) ((out > 127) ? 127 : out);
+  }
+}
+
+/**
+ * @} end of NNActivation group
+ */
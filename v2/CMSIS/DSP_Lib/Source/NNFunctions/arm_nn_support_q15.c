@@ -0,0 +1,244 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_support_q15.c
+*
+* Description:  Q15 matrix kernels of the neural network layers.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Q15 weights times two Q15 columns, requantised to Q15.
+ * @param[in]  *pWeights  points to the weights, <code>numRows</code> rows of <code>numCols</code> values.
+ * @param[in]  *pCol      points to the two columns of <code>numCols</code> values, one after the other.
+ * @param[in]  numRows    number of rows of the weights.
+ * @param[in]  numCols    number of columns of the weights.
+ * @param[in]  biasShift  left shift of the bias.
+ * @param[in]  outShift   right shift of the outputs.
+ * @param[in]  *pBias     points to the <code>numRows</code> bias values.
+ * @param[out] *pDst      points to the <code>numRows</code> outputs of the first column
+ *                        followed by those of the second column.
+ * @return none.
+ *
+ * Each pair of weights is read once for both columns.
+ */
+
+void arm_nn_mat_mult_kernel_q15(
+  q15_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pBias,
+  q15_t * pDst)
+{
+  q15_t *pW = pWeights;                          /* weight pointer */
+  q15_t *pA, *pB;                                /* column pointers */
+  q63_t round = ((q63_t) 1 << outShift) >> 1;    /* rounding of the outputs */
+  q63_t sumA, sumB;                              /* accumulators */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t w01, w23;                                /* four weights */
+
+  for (row = 0u; row < numRows; row++)
+  {
+    pA = pCol;
+    pB = pCol + numCols;
+    sumA = ((q63_t) pBias[row] << biasShift) + round;
+    sumB = sumA;
+
+    /* Loop unrolling */
+    colCnt = numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      w01 = *__SIMD32(pW)++;
+      w23 = *__SIMD32(pW)++;
+
+      sumA = __SMLALD(w01, *__SIMD32(pA)++, sumA);
+      sumA = __SMLALD(w23, *__SIMD32(pA)++, sumA);
+      sumB = __SMLALD(w01, *__SIMD32(pB)++, sumB);
+      sumB = __SMLALD(w23, *__SIMD32(pB)++, sumB);
+
+      colCnt--;
+    }
+
+    colCnt = numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      sumA += (q31_t) * pW * *pA++;
+      sumB += (q31_t) * pW++ * *pB++;
+      colCnt--;
+    }
+
+    pDst[row] = (q15_t) __SSAT(clip_q63_to_q31(sumA >> outShift), 16);
+    pDst[numRows + row] = (q15_t) __SSAT(clip_q63_to_q31(sumB >> outShift), 16);
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  for (row = 0u; row < numRows; row++)
+  {
+    pA = pCol;
+    pB = pCol + numCols;
+    sumA = ((q63_t) pBias[row] << biasShift) + round;
+    sumB = sumA;
+
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sumA += (q31_t) * pW * *pA++;
+      sumB += (q31_t) * pW++ * *pB++;
+      colCnt--;
+    }
+
+    pDst[row] = (q15_t) __SSAT(clip_q63_to_q31(sumA >> outShift), 16);
+    pDst[numRows + row] = (q15_t) __SSAT(clip_q63_to_q31(sumB >> outShift), 16);
+  }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+}
+
+/**
+ * @brief  Q15 weights times one Q15 column, requantised to Q15.
+ * @param[in]  *pWeights  points to the weights, <code>numRows</code> rows of <code>numCols</code> values.
+ * @param[in]  *pCol      points to the column of <code>numCols</code> values.
+ * @param[in]  numRows    number of rows of the weights.
+ * @param[in]  numCols    number of columns of the weights.
+ * @param[in]  biasShift  left shift of the bias.
+ * @param[in]  outShift   right shift of the outputs.
+ * @param[in]  *pBias     points to the <code>numRows</code> bias values.
+ * @param[out] *pDst      points to the <code>numRows</code> outputs.
+ * @return none.
+ *
+ * Two rows are done at a time so each value of the column is read once
+ * for both.
+ */
+
+void arm_nn_vec_mult_kernel_q15(
+  q15_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pBias,
+  q15_t * pDst)
+{
+  q15_t *pW = pWeights;                          /* weight pointer of the first row */
+  q15_t *pA;                                     /* column pointer */
+  q63_t round = ((q63_t) 1 << outShift) >> 1;    /* rounding of the outputs */
+  q63_t sum;                                     /* accumulator */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q15_t *pW2;                                    /* weight pointer of the second row */
+  q63_t sum2;                                    /* accumulator of the second row */
+  q31_t x01, x23;                                /* four column values */
+
+  for (row = 0u; row < (numRows & ~1u); row += 2u)
+  {
+    pA = pCol;
+    pW2 = pW + numCols;
+    sum = ((q63_t) pBias[row] << biasShift) + round;
+    sum2 = ((q63_t) pBias[row + 1u] << biasShift) + round;
+
+    /* Loop unrolling */
+    colCnt = numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      x01 = *__SIMD32(pA)++;
+      x23 = *__SIMD32(pA)++;
+
+      sum = __SMLALD(*__SIMD32(pW)++, x01, sum);
+      sum = __SMLALD(*__SIMD32(pW)++, x23, sum);
+      sum2 = __SMLALD(*__SIMD32(pW2)++, x01, sum2);
+      sum2 = __SMLALD(*__SIMD32(pW2)++, x23, sum2);
+
+      colCnt--;
+    }
+
+    colCnt = numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      sum += (q31_t) * pW++ * *pA;
+      sum2 += (q31_t) * pW2++ * *pA++;
+      colCnt--;
+    }
+
+    pDst[row] = (q15_t) __SSAT(clip_q63_to_q31(sum >> outShift), 16);
+    pDst[row + 1u] = (q15_t) __SSAT(clip_q63_to_q31(sum2 >> outShift), 16);
+
+    /* The second row is done as well */
+    pW = pW2;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = 0u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  for (; row < numRows; row++)
+  {
+    pA = pCol;
+    sum = ((q63_t) pBias[row] << biasShift) + round;
+
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sum += (q31_t) * pW++ * *pA++;
+      colCnt--;
+    }
+
+    pDst[row] = (q15_t) __SSAT(clip_q63_to_q31(sum >> outShift), 16);
+  }
+}
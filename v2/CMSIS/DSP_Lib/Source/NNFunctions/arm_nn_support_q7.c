@@ -0,0 +1,352 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_nn_support_q7.c
+*
+* Description:  Q7 matrix kernels of the neural network layers.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Sign extends a block of Q7 values to 16 bits without scaling them.
+ * @param[in]  *pSrc     points to the Q7 input.
+ * @param[out] *pDst     points to the 16-bit output.
+ * @param[in]  blockSize number of values.
+ * @return none.
+ *
+ * Unlike <code>arm_q7_to_q15()</code> the values keep their size, so the
+ * products with Q7 weights stay in the format of the Q7 products.
+ */
+
+void arm_nn_q7_to_q15_no_shift(
+  q7_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in;                                      /* four input values */
+  q31_t in1, in2;                                /* two values each, sign extended */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Read four values and sign extend them in the lanes of two words */
+    in = *__SIMD32(pSrc)++;
+    in1 = __SXTB16(__ROR(in, 8));
+    in2 = __SXTB16(in);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT(in2, in1, 16);
+    *__SIMD32(pDst)++ = __PKHTB(in1, in2, 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHTB(in1, in2, 16);
+    *__SIMD32(pDst)++ = __PKHBT(in2, in1, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) * pSrc++;
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief  Q7 weights times two 16-bit columns, requantised to Q7.
+ * @param[in]  *pWeights  points to the weights, <code>numRows</code> rows of <code>numCols</code> values.
+ * @param[in]  *pCol      points to the two columns of <code>numCols</code> values, one after the other.
+ * @param[in]  numRows    number of rows of the weights.
+ * @param[in]  numCols    number of columns of the weights.
+ * @param[in]  biasShift  left shift of the bias.
+ * @param[in]  outShift   right shift of the outputs.
+ * @param[in]  *pBias     points to the <code>numRows</code> bias values.
+ * @param[out] *pDst      points to the <code>numRows</code> outputs of the first column
+ *                        followed by those of the second column.
+ * @return none.
+ *
+ * Each weight is read and sign extended once for both columns.
+ */
+
+void arm_nn_mat_mult_kernel_q7_q15(
+  q7_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pBias,
+  q7_t * pDst)
+{
+  q7_t *pW = pWeights;                           /* weight pointer */
+  q15_t *pA, *pB;                                /* column pointers */
+  q31_t round = ((q31_t) 1 << outShift) >> 1;    /* rounding of the outputs */
+  q31_t sumA, sumB;                              /* accumulators */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in, in1, in2;                            /* four weights, sign extended */
+  q31_t w01, w23;                                /* weights in the order of the columns */
+
+  for (row = 0u; row < numRows; row++)
+  {
+    pA = pCol;
+    pB = pCol + numCols;
+    sumA = ((q31_t) pBias[row] << biasShift) + round;
+    sumB = sumA;
+
+    /* Loop unrolling */
+    colCnt = numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      in = *__SIMD32(pW)++;
+      in1 = __SXTB16(__ROR(in, 8));
+      in2 = __SXTB16(in);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      w01 = __PKHBT(in2, in1, 16);
+      w23 = __PKHTB(in1, in2, 16);
+
+#else
+
+      w01 = __PKHTB(in1, in2, 16);
+      w23 = __PKHBT(in2, in1, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      sumA = __SMLAD(w01, *__SIMD32(pA)++, sumA);
+      sumA = __SMLAD(w23, *__SIMD32(pA)++, sumA);
+      sumB = __SMLAD(w01, *__SIMD32(pB)++, sumB);
+      sumB = __SMLAD(w23, *__SIMD32(pB)++, sumB);
+
+      colCnt--;
+    }
+
+    colCnt = numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      sumA += (q31_t) * pW * *pA++;
+      sumB += (q31_t) * pW++ * *pB++;
+      colCnt--;
+    }
+
+    pDst[row] = (q7_t) __SSAT(sumA >> outShift, 8);
+    pDst[numRows + row] = (q7_t) __SSAT(sumB >> outShift, 8);
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  for (row = 0u; row < numRows; row++)
+  {
+    pA = pCol;
+    pB = pCol + numCols;
+    sumA = ((q31_t) pBias[row] << biasShift) + round;
+    sumB = sumA;
+
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sumA += (q31_t) * pW * *pA++;
+      sumB += (q31_t) * pW++ * *pB++;
+      colCnt--;
+    }
+
+    pDst[row] = (q7_t) __SSAT(sumA >> outShift, 8);
+    pDst[numRows + row] = (q7_t) __SSAT(sumB >> outShift, 8);
+  }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+}
+
+/**
+ * @brief  Q7 weights times one 16-bit column, requantised to Q7.
+ * @param[in]  *pWeights  points to the weights, <code>numRows</code> rows of <code>numCols</code> values.
+ * @param[in]  *pCol      points to the column of <code>numCols</code> values.
+ * @param[in]  numRows    number of rows of the weights.
+ * @param[in]  numCols    number of columns of the weights.
+ * @param[in]  biasShift  left shift of the bias.
+ * @param[in]  outShift   right shift of the outputs.
+ * @param[in]  *pBias     points to the <code>numRows</code> bias values.
+ * @param[out] *pDst      points to the <code>numRows</code> outputs.
+ * @return none.
+ *
+ * Two rows are done at a time so each value of the column is read once
+ * for both.
+ */
+
+void arm_nn_vec_mult_kernel_q7_q15(
+  q7_t * pWeights,
+  q15_t * pCol,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pBias,
+  q7_t * pDst)
+{
+  q7_t *pW = pWeights;                           /* weight pointer of the first row */
+  q15_t *pA;                                     /* column pointer */
+  q31_t round = ((q31_t) 1 << outShift) >> 1;    /* rounding of the outputs */
+  q31_t sum;                                     /* accumulator */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q7_t *pW2;                                     /* weight pointer of the second row */
+  q31_t sum2;                                    /* accumulator of the second row */
+  q31_t in, in1, in2;                            /* four weights, sign extended */
+  q31_t x01, x23;                                /* four column values */
+
+  for (row = 0u; row < (numRows & ~1u); row += 2u)
+  {
+    pA = pCol;
+    pW2 = pW + numCols;
+    sum = ((q31_t) pBias[row] << biasShift) + round;
+    sum2 = ((q31_t) pBias[row + 1u] << biasShift) + round;
+
+    /* Loop unrolling */
+    colCnt = numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      x01 = *__SIMD32(pA)++;
+      x23 = *__SIMD32(pA)++;
+
+      in = *__SIMD32(pW)++;
+      in1 = __SXTB16(__ROR(in, 8));
+      in2 = __SXTB16(in);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      sum = __SMLAD(__PKHBT(in2, in1, 16), x01, sum);
+      sum = __SMLAD(__PKHTB(in1, in2, 16), x23, sum);
+
+#else
+
+      sum = __SMLAD(__PKHTB(in1, in2, 16), x01, sum);
+      sum = __SMLAD(__PKHBT(in2, in1, 16), x23, sum);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      in = *__SIMD32(pW2)++;
+      in1 = __SXTB16(__ROR(in, 8));
+      in2 = __SXTB16(in);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      sum2 = __SMLAD(__PKHBT(in2, in1, 16), x01, sum2);
+      sum2 = __SMLAD(__PKHTB(in1, in2, 16), x23, sum2);
+
+#else
+
+      sum2 = __SMLAD(__PKHTB(in1, in2, 16), x01, sum2);
+      sum2 = __SMLAD(__PKHBT(in2, in1, 16), x23, sum2);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      colCnt--;
+    }
+
+    colCnt = numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      sum += (q31_t) * pW++ * *pA;
+      sum2 += (q31_t) * pW2++ * *pA++;
+      colCnt--;
+    }
+
+    pDst[row] = (q7_t) __SSAT(sum >> outShift, 8);
+    pDst[row + 1u] = (q7_t) __SSAT(sum2 >> outShift, 8);
+
+    /* The second row is done as well */
+    pW = pW2;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = 0u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  for (; row < numRows; row++)
+  {
+    pA = pCol;
+    sum = ((q31_t) pBias[row] << biasShift) + round;
+
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sum += (q31_t) * pW++ * *pA++;
+      colCnt--;
+    }
+
+    pDst[row] = (q7_t) __SSAT(sum >> outShift, 8);
+  }
+}
@@ -0,0 +1,357 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_moving_stats_f32.c
+*
+* Description:  Floating-point moving statistics over a sliding window
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup MovingStats Moving Statistics
+ *
+ * Computes the mean, variance, RMS, maximum and minimum of the last
+ * <code>windowLen</code> samples of a stream. The block functions mean,
+ * var, rms, max and min go over the whole window on every call, which
+ * costs <code>windowLen</code> operations per new sample. The moving
+ * statistics instance updates its results in constant time per sample.
+ * There are separate functions for floating-point, Q31 and Q15 data types.
+ *
+ * \par Algorithm:
+ * The instance holds the window in a delay line of <code>windowLen</code>
+ * samples. Each new sample replaces the oldest one:
+ * - The fixed-point functions keep the sum and the sum of the squares of
+ *   the window in 64-bit integers. They add the new sample and take away
+ *   the oldest one exactly, so the sums never drift.
+ * - The floating-point functions keep the mean and the sum of the squared
+ *   deviations from it, updated as in Welford's algorithm. Rounding errors
+ *   would build up over a long stream, so both are recomputed from the delay
+ *   line once every <code>windowLen</code> samples, which costs two more
+ *   operations per sample on average.
+ * - Maximum and minimum come from two monotonic deques of delay line slots.
+ *   A new sample removes all candidates from the back of the maximum deque
+ *   that it equals or beats, as they can never be the maximum again, and
+ *   is added at the back. The maximum is at the front and leaves the deque
+ *   when it leaves the window. Each sample enters and leaves each deque
+ *   once, so the cost is constant per sample on average.
+ *
+ * \par
+ * Until <code>windowLen</code> samples have been seen, the results are over
+ * the samples seen so far. The variance is the sample variance, divided by
+ * the number of samples less one, as computed by arm_var.
+ *
+ * \par
+ * <code>arm_moving_stats_update</code> takes a block of any size, from a
+ * single sample upwards. The results can be read at any time.
+ * <code>pState</code> points to a delay line of <code>windowLen</code>
+ * samples and <code>pDeque</code> to <code>2*windowLen</code> indices.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 sums hold any window of up to 65535 samples without overflow. The
+ * Q31 sum of squares holds the squares in 18.46 format, i.e. with the
+ * lowest 16 bits of the 2.62 products dropped, and also holds any window.
+ * Results are saturated to the input format.
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of samples to the floating-point moving statistics window.
+ * @param[in,out] *S         points to an instance of the floating-point moving statistics structure.
+ * @param[in]     *pSrc      points to the block of new samples.
+ * @param[in]     blockSize  number of samples in the block, 1 or more.
+ * @return none.
+ */
+
+void arm_moving_stats_update_f32(
+  arm_moving_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* Delay line */
+  uint16_t *pMax = S->pDeque;                    /* Deque of the maximum candidates */
+  uint16_t *pMin = S->pDeque + S->windowLen;     /* Deque of the minimum candidates */
+  float32_t mean = S->mean;                      /* Mean of the window */
+  float32_t m2 = S->m2;                          /* Sum of the squared deviations from the mean */
+  float32_t invLen = 1.0f / (float32_t) S->windowLen; /* Reciprocal of the window length */
+  float32_t in, old;                             /* Newest and oldest sample */
+  float32_t delta, meanOld;                      /* Temporary variables */
+  uint32_t renorm = S->renormCount;              /* Samples since the last recomputation */
+  uint32_t i;                                    /* Loop counter */
+  uint32_t windowLen = S->windowLen;             /* Window length */
+  uint32_t count = S->count;                     /* Samples in the window */
+  uint32_t wr = S->writeIndex;                   /* Delay line slot of the new sample */
+  uint32_t maxHead = S->maxHead;                 /* Front of the maximum deque */
+  uint32_t maxCnt = S->maxCount;                 /* Length of the maximum deque */
+  uint32_t minHead = S->minHead;                 /* Front of the minimum deque */
+  uint32_t minCnt = S->minCount;                 /* Length of the minimum deque */
+  uint32_t back;                                 /* Back of a deque */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(count == windowLen)
+    {
+      /* The oldest sample leaves the window as the new one enters */
+      old = pState[wr];
+      meanOld = mean;
+      delta = in - old;
+      mean += delta * invLen;
+      m2 += delta * ((in - mean) + (old - meanOld));
+
+      /* The slot of the oldest sample leaves the deques if it is at the front */
+      if(pMax[maxHead] == wr)
+      {
+        maxHead = (maxHead == windowLen - 1u) ? 0u : maxHead + 1u;
+        maxCnt--;
+      }
+
+      if(pMin[minHead] == wr)
+      {
+        minHead = (minHead == windowLen - 1u) ? 0u : minHead + 1u;
+        minCnt--;
+      }
+    }
+    else
+    {
+      /* Welford's update while the window fills */
+      count++;
+      delta = in - mean;
+      mean += delta / (float32_t) count;
+      m2 += delta * (in - mean);
+    }
+
+    pState[wr] = in;
+
+    /* Candidates the new sample equals or beats can never be the maximum
+     * or the minimum again */
+    while(maxCnt > 0u)
+    {
+      back = maxHead + maxCnt - 1u;
+      back = (back >= windowLen) ? back - windowLen : back;
+
+      if(pState[pMax[back]] > in)
+      {
+        break;
+      }
+
+      maxCnt--;
+    }
+
+    back = maxHead + maxCnt;
+    pMax[(back >= windowLen) ? back - windowLen : back] = (uint16_t) wr;
+    maxCnt++;
+
+    while(minCnt > 0u)
+    {
+      back = minHead + minCnt - 1u;
+      back = (back >= windowLen) ? back - windowLen : back;
+
+      if(pState[pMin[back]] < in)
+      {
+        break;
+      }
+
+      minCnt--;
+    }
+
+    back = minHead + minCnt;
+    pMin[(back >= windowLen) ? back - windowLen : back] = (uint16_t) wr;
+    minCnt++;
+
+    wr = (wr == windowLen - 1u) ? 0u : wr + 1u;
+
+    /* Recompute the mean and the squared deviations from the delay line
+     * once per window, before rounding errors build up */
+    renorm++;
+
+    if(renorm == windowLen)
+    {
+      renorm = 0u;
+      arm_mean_f32(pState, count, &mean);
+      m2 = 0.0f;
+
+      for (i = 0u; i < count; i++)
+      {
+        delta = pState[i] - mean;
+        m2 += delta * delta;
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->mean = mean;
+  S->m2 = m2;
+  S->renormCount = (uint16_t) renorm;
+  S->count = (uint16_t) count;
+  S->writeIndex = (uint16_t) wr;
+  S->maxHead = (uint16_t) maxHead;
+  S->maxCount = (uint16_t) maxCnt;
+  S->minHead = (uint16_t) minHead;
+  S->minCount = (uint16_t) minCnt;
+}
+
+/**
+ * @brief  Mean of the floating-point moving statistics window.
+ * @param[in]  *S        points to an instance of the floating-point moving statistics structure.
+ * @param[out] *pResult  mean returned here.
+ * @return none.
+ */
+
+void arm_moving_mean_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult)
+{
+  *pResult = S->mean;
+}
+
+/**
+ * @brief  Variance of the floating-point moving statistics window.
+ * @param[in]  *S        points to an instance of the floating-point moving statistics structure.
+ * @param[out] *pResult  variance returned here.
+ * @return none.
+ */
+
+void arm_moving_var_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult)
+{
+  float32_t var = 0.0f;                          /* Variance */
+
+  if(S->count > 1u)
+  {
+    var = S->m2 / (float32_t) (S->count - 1u);
+  }
+
+  /* Rounding can leave a tiny negative sum of squared deviations */
+  *pResult = (var > 0.0f) ? var : 0.0f;
+}
+
+/**
+ * @brief  Root mean square of the floating-point moving statistics window.
+ * @param[in]  *S        points to an instance of the floating-point moving statistics structure.
+ * @param[out] *pResult  root mean square returned here.
+ * @return none.
+ */
+
+void arm_moving_rms_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult)
+{
+  float32_t meanOfSquares = 0.0f;                /* Mean of the squares */
+
+  if(S->count > 0u)
+  {
+    meanOfSquares = (S->m2 / (float32_t) S->count) + (S->mean * S->mean);
+  }
+
+  arm_sqrt_f32((meanOfSquares > 0.0f) ? meanOfSquares : 0.0f, pResult);
+}
+
+/**
+ * @brief  maximum of the floating-point moving statistics window.
+ * @param[in]  *S        points to an instance of the floating-point moving statistics structure.
+ * @param[out] *pResult  maximum value returned here.
+ * @param[out] *pIndex   position of the maximum in the window returned here, 0 for the oldest sample.
+ * @return none.
+ */
+
+void arm_moving_max_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult,
+  uint32_t * pIndex)
+{
+  uint32_t slot;                                 /* Delay line slot of the maximum */
+  uint32_t oldest;                               /* Delay line slot of the oldest sample */
+
+  if(S->count == 0u)
+  {
+    *pResult = 0;
+    *pIndex = 0u;
+    return;
+  }
+
+  slot = S->pDeque[S->maxHead];
+  oldest = (S->count == S->windowLen) ? S->writeIndex : 0u;
+
+  *pResult = S->pState[slot];
+  *pIndex = (slot >= oldest) ? slot - oldest : slot + S->windowLen - oldest;
+}
+
+/**
+ * @brief  minimum of the floating-point moving statistics window.
+ * @param[in]  *S        points to an instance of the floating-point moving statistics structure.
+ * @param[out] *pResult  minimum value returned here.
+ * @param[out] *pIndex   position of the minimum in the window returned here, 0 for the oldest sample.
+ * @return none.
+ */
+
+void arm_moving_min_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult,
+  uint32_t * pIndex)
+{
+  uint32_t slot;                                 /* Delay line slot of the minimum */
+  uint32_t oldest;                               /* Delay line slot of the oldest sample */
+
+  if(S->count == 0u)
+  {
+    *pResult = 0;
+    *pIndex = 0u;
+    return;
+  }
+
+  slot = S->pDeque[S->minHead + S->windowLen];
+  oldest = (S->count == S->windowLen) ? S->writeIndex : 0u;
+
+  *pResult = S->pState[slot];
+  *pIndex = (slot >= oldest) ? slot - oldest : slot + S->windowLen - oldest;
+}
+
+/**
+ * @} end of MovingStats group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_moving_stats_init_q31.c
+*
+* Description:  Q31 moving statistics initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 moving statistics.
+ * @param[in,out] *S          points to an instance of the Q31 moving statistics structure.
+ * @param[in]     windowLen   number of samples in the window.
+ * @param[in]     *pState     points to the delay line of <code>windowLen</code> samples.
+ * @param[in]     *pDeque     points to the deque buffer of <code>2*windowLen</code> indices.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ *                <code>windowLen</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * The window starts empty. Calling the function again on an instance clears it.
+ */
+
+arm_status arm_moving_stats_init_q31(
+  arm_moving_stats_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState,
+  uint16_t * pDeque)
+{
+  if(windowLen == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the window length and the buffers */
+  S->windowLen = windowLen;
+  S->pState = pState;
+  S->pDeque = pDeque;
+
+  /* Empty window */
+  S->count = 0u;
+  S->writeIndex = 0u;
+  S->maxHead = 0u;
+  S->maxCount = 0u;
+  S->minHead = 0u;
+  S->minCount = 0u;
+  S->sum = 0;
+  S->sumSq = 0;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MovingStats group
+ */
@@ -0,0 +1,294 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_moving_stats_q15.c
+*
+* Description:  Q15 moving statistics over a sliding window
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of samples to the Q15 moving statistics window.
+ * @param[in,out] *S         points to an instance of the Q15 moving statistics structure.
+ * @param[in]     *pSrc      points to the block of new samples.
+ * @param[in]     blockSize  number of samples in the block, 1 or more.
+ * @return none.
+ */
+
+void arm_moving_stats_update_q15(
+  arm_moving_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* Delay line */
+  uint16_t *pMax = S->pDeque;                    /* Deque of the maximum candidates */
+  uint16_t *pMin = S->pDeque + S->windowLen;     /* Deque of the minimum candidates */
+  q63_t sum = S->sum;                            /* Sum of the window */
+  q63_t sumSq = S->sumSq;                        /* Sum of the squares of the window */
+  q15_t in, old;                                 /* Newest and oldest sample */
+  uint32_t windowLen = S->windowLen;             /* Window length */
+  uint32_t count = S->count;                     /* Samples in the window */
+  uint32_t wr = S->writeIndex;                   /* Delay line slot of the new sample */
+  uint32_t maxHead = S->maxHead;                 /* Front of the maximum deque */
+  uint32_t maxCnt = S->maxCount;                 /* Length of the maximum deque */
+  uint32_t minHead = S->minHead;                 /* Front of the minimum deque */
+  uint32_t minCnt = S->minCount;                 /* Length of the minimum deque */
+  uint32_t back;                                 /* Back of a deque */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(count == windowLen)
+    {
+      /* The oldest sample leaves the window as the new one enters */
+      old = pState[wr];
+      sum -= old;
+      sumSq -= ((q63_t) old * old);
+
+      /* The slot of the oldest sample leaves the deques if it is at the front */
+      if(pMax[maxHead] == wr)
+      {
+        maxHead = (maxHead == windowLen - 1u) ? 0u : maxHead + 1u;
+        maxCnt--;
+      }
+
+      if(pMin[minHead] == wr)
+      {
+        minHead = (minHead == windowLen - 1u) ? 0u : minHead + 1u;
+        minCnt--;
+      }
+    }
+    else
+    {
+      count++;
+    }
+
+    sum += in;
+    sumSq += ((q63_t) in * in);
+
+    pState[wr] = in;
+
+    /* Candidates the new sample equals or beats can never be the maximum
+     * or the minimum again */
+    while(maxCnt > 0u)
+    {
+      back = maxHead + maxCnt - 1u;
+      back = (back >= windowLen) ? back - windowLen : back;
+
+      if(pState[pMax[back]] > in)
+      {
+        break;
+      }
+
+      maxCnt--;
+    }
+
+    back = maxHead + maxCnt;
+    pMax[(back >= windowLen) ? back - windowLen : back] = (uint16_t) wr;
+    maxCnt++;
+
+    while(minCnt > 0u)
+    {
+      back = minHead + minCnt - 1u;
+      back = (back >= windowLen) ? back - windowLen : back;
+
+      if(pState[pMin[back]] < in)
+      {
+        break;
+      }
+
+      minCnt--;
+    }
+
+    back = minHead + minCnt;
+    pMin[(back >= windowLen) ? back - windowLen : back] = (uint16_t) wr;
+    minCnt++;
+
+    wr = (wr == windowLen - 1u) ? 0u : wr + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->sum = sum;
+  S->sumSq = sumSq;
+  S->count = (uint16_t) count;
+  S->writeIndex = (uint16_t) wr;
+  S->maxHead = (uint16_t) maxHead;
+  S->maxCount = (uint16_t) maxCnt;
+  S->minHead = (uint16_t) minHead;
+  S->minCount = (uint16_t) minCnt;
+}
+
+/**
+ * @brief  Mean of the Q15 moving statistics window.
+ * @param[in]  *S        points to an instance of the Q15 moving statistics structure.
+ * @param[out] *pResult  mean returned here.
+ * @return none.
+ */
+
+void arm_moving_mean_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult)
+{
+  *pResult = (S->count > 0u) ? (q15_t) (S->sum / S->count) : 0;
+}
+
+/**
+ * @brief  Variance of the Q15 moving statistics window.
+ * @param[in]  *S        points to an instance of the Q15 moving statistics structure.
+ * @param[out] *pResult  variance returned here.
+ * @return none.
+ */
+
+void arm_moving_var_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult)
+{
+  q63_t mean, dev;                               /* Mean and squared deviations */
+
+  if(S->count < 2u)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Squared deviations from the truncated mean, in 34.30 format:
+   * sum(x^2) - mean * (2 * sum(x) - count * mean) */
+  mean = S->sum / S->count;
+  dev = S->sumSq - (mean * (2 * S->sum - (q63_t) S->count * mean));
+  dev = (dev > 0) ? dev : 0;
+
+  /* Divide and convert 34.30 to 1.15 format */
+  *pResult = (q15_t) __SSAT((q31_t) clip_q63_to_q31((dev / (S->count - 1u)) >> 15), 16);
+}
+
+/**
+ * @brief  Root mean square of the Q15 moving statistics window.
+ * @param[in]  *S        points to an instance of the Q15 moving statistics structure.
+ * @param[out] *pResult  root mean square returned here.
+ * @return none.
+ */
+
+void arm_moving_rms_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult)
+{
+  q15_t meanOfSquares = 0;                       /* Mean of the squares */
+
+  if(S->count > 0u)
+  {
+    /* Convert 34.30 to 1.15 format */
+    meanOfSquares = (q15_t) __SSAT((q31_t) clip_q63_to_q31((S->sumSq / S->count) >> 15), 16);
+  }
+
+  arm_sqrt_q15(meanOfSquares, pResult);
+}
+
+/**
+ * @brief  maximum of the Q15 moving statistics window.
+ * @param[in]  *S        points to an instance of the Q15 moving statistics structure.
+ * @param[out] *pResult  maximum value returned here.
+ * @param[out] *pIndex   position of the maximum in the window returned here, 0 for the oldest sample.
+ * @return none.
+ */
+
+void arm_moving_max_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex)
+{
+  uint32_t slot;                                 /* Delay line slot of the maximum */
+  uint32_t oldest;                               /* Delay line slot of the oldest sample */
+
+  if(S->count == 0u)
+  {
+    *pResult = 0;
+    *pIndex = 0u;
+    return;
+  }
+
+  slot = S->pDeque[S->maxHead];
+  oldest = (S->count == S->windowLen) ? S->writeIndex : 0u;
+
+  *pResult = S->pState[slot];
+  *pIndex = (slot >= oldest) ? slot - oldest : slot + S->windowLen - oldest;
+}
+
+/**
+ * @brief  minimum of the Q15 moving statistics window.
+ * @param[in]  *S        points to an instance of the Q15 moving statistics structure.
+ * @param[out] *pResult  minimum value returned here.
+ * @param[out] *pIndex   position of the minimum in the window returned here, 0 for the oldest sample.
+ * @return none.
+ */
+
+void arm_moving_min_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex)
+{
+  uint32_t slot;                                 /* Delay line slot of the minimum */
+  uint32_t oldest;                               /* Delay line slot of the oldest sample */
+
+  if(S->count == 0u)
+  {
+    *pResult = 0;
+    *pIndex = 0u;
+    return;
+  }
+
+  slot = S->pDeque[S->minHead + S->windowLen];
+  oldest = (S->count == S->windowLen) ? S->writeIndex : 0u;
+
+  *pResult = S->pState[slot];
+  *pIndex = (slot >= oldest) ? slot - oldest : slot + S->windowLen - oldest;
+}
+
+/**
+ * @} end of MovingStats group
+ */
@@ -240,3 +240,71 @@ uint16_t * pBitRevTab)
       pBitRevTab += bitRevFactor;
    }
 }
+
+/*    
+   * @brief  In-place bit reversal function for 16-bit complex data.   
+   * @param[in, out] *pSrc        points to the in-place buffer of q15 complex values.   
+   * @param[in]      bitRevLen    bit reversal table length   
+   * @param[in]      *pBitRevTab  points to bit reversal table of byte offsets of 8 byte complex values, in pairs to swap.   
+   * @return none.   
+*/
+
+void arm_bitreversal_16(
+uint16_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+   q31_t *pSrc32 = (q31_t *) pSrc;
+   q31_t in;
+   uint32_t a, b, i;
+
+   for (i = 0u; i < bitRevLen; i += 2u)
+   {
+      /*  A q15 complex value is 4 bytes, so the offsets are halved */
+      a = pBitRevTab[i] >> 3u;
+      b = pBitRevTab[i + 1u] >> 3u;
+
+      /*  pSrc[a] <-> pSrc[b]; */
+      in = pSrc32[a];
+      pSrc32[a] = pSrc32[b];
+      pSrc32[b] = in;
+   }
+}
+
+#if defined (ARM_MATH_HOST)
+
+/*    
+   * @brief  In-place bit reversal function, C version of arm_bitreversal2.S for the host build.   
+   * @param[in, out] *pSrc        points to the in-place buffer of unknown 32-bit data type.   
+   * @param[in]      bitRevLen    bit reversal table length   
+   * @param[in]      *pBitRevTab  points to bit reversal table of byte offsets, in pairs to swap.   
+   * @return none.   
+*/
+
+void arm_bitreversal_32(
+uint32_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+   uint32_t in;
+   uint32_t a, b, i;
+
+   for (i = 0u; i < bitRevLen; i += 2u)
+   {
+      /*  The table holds byte offsets of the complex values to swap */
+      a = pBitRevTab[i] >> 2u;
+      b = pBitRevTab[i + 1u] >> 2u;
+
+      /*  pSrc[a] <-> pSrc[b]; */
+      in = pSrc[a];
+      pSrc[a] = pSrc[b];
+      pSrc[b] = in;
+
+      /*  pSrc[a+1u] <-> pSrc[b+1u]; */
+      in = pSrc[a + 1u];
+      pSrc[a + 1u] = pSrc[b + 1u];
+      pSrc[b + 1u] = in;
+   }
+}
+
+#endif /* defined (ARM_MATH_HOST) */
@@ -0,0 +1,263 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_cfft_q15.c
+*
+* Description:  Combined Radix Decimation in Frequency CFFT Q15 processing function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_radix4_butterfly_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  q15_t * pCoef,
+  uint32_t twidCoefModifier);
+
+extern void arm_radix4_butterfly_inverse_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  q15_t * pCoef,
+  uint32_t twidCoefModifier);
+
+extern void arm_bitreversal_16(
+  uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+void arm_cfft_radix4by2_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef);
+
+void arm_cfft_radix4by2_inverse_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef);
+
+/**   
+* @ingroup groupTransforms   
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+/**
+* @details
+* @brief       Processing function for the Q15 complex FFT.
+* @param[in]      *S    points to an instance of the Q15 CFFT structure.
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return none.
+*
+* \par
+* The function supports lengths of [16, 32, 64, ..., 4096]. Lengths that are
+* a power of 4 use radix-4 stages only. The other lengths start with a single
+* radix-2 stage and then run two radix-4 transforms of half the length.
+* \par
+* Use one of the preinitialized instances of <code>arm_const_structs.h</code>,
+* for example <code>arm_cfft_q15(&arm_cfft_sR_q15_len512, pSrc, 0, 1)</code>.
+* They point to constant twiddle factor and bit reversal tables, so no
+* initialization function and no RAM are needed.
+* \par Input and output formats:
+* \par
+* The input is in 1.31 format. Every stage scales its result down to avoid
+* saturation, so the forward transform is scaled by <code>1/fftLen</code>
+* compared to the textbook definition and the output is in
+* (1+log2(fftLen)).(15-log2(fftLen)) format. The inverse transform is scaled
+* the same way, which matches the textbook definition of the inverse FFT.
+*/
+
+void arm_cfft_q15(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  uint32_t L = S->fftLen;
+
+  if(ifftFlag == 1u)
+  {
+    switch (L)
+    {
+    case 16:
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+      arm_radix4_butterfly_inverse_q15(p1, L, (q15_t *) S->pTwiddle, 1u);
+      break;
+
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+      arm_cfft_radix4by2_inverse_q15(p1, L, S->pTwiddle);
+      break;
+    }
+  }
+  else
+  {
+    switch (L)
+    {
+    case 16:
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+      arm_radix4_butterfly_q15(p1, L, (q15_t *) S->pTwiddle, 1u);
+      break;
+
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+      arm_cfft_radix4by2_q15(p1, L, S->pTwiddle);
+      break;
+    }
+  }
+
+  if(bitReverseFlag)
+    arm_bitreversal_16((uint16_t *) p1, S->bitRevLength, S->pBitRevTable);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
+
+/*
+* Radix-2 decimation in frequency stage followed by two radix-4 transforms.
+* The radix-2 stage scales by 1/4 rather than 1/2, as the twiddle rotation
+* of a full scale difference can exceed 1.0 in either part. The difference
+* is halved before the rotation and the product shifted by 16 rather than
+* 15. The output is scaled back up by 2 once the radix-4 transforms are done.
+*/
+
+void arm_cfft_radix4by2_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef)
+{
+  uint32_t i, n2;
+  q31_t xt, yt;
+  q15_t cosVal, sinVal;
+  q15_t *pA = pSrc;                              /* first half */
+  q15_t *pB;                                     /* second half */
+  const q15_t *pTw = pCoef;                      /* twiddle factors */
+
+  n2 = fftLen >> 1u;
+  pB = pSrc + fftLen;
+
+  for (i = 0u; i < n2; i++)
+  {
+    cosVal = *pTw++;
+    sinVal = *pTw++;
+
+    /* xa - xb, ya - yb */
+    xt = (pA[0] >> 1u) - (pB[0] >> 1u);
+    yt = (pA[1] >> 1u) - (pB[1] >> 1u);
+
+    /* xa' = xa + xb, ya' = ya + yb */
+    pA[0] = ((pA[0] >> 1u) + (pB[0] >> 1u)) >> 1u;
+    pA[1] = ((pA[1] >> 1u) + (pB[1] >> 1u)) >> 1u;
+
+    /* xb' = xt * cos + yt * sin, yb' = yt * cos - xt * sin */
+    pB[0] = (q15_t) ((((q31_t) xt * cosVal) + ((q31_t) yt * sinVal)) >> 16);
+    pB[1] = (q15_t) ((((q31_t) yt * cosVal) - ((q31_t) xt * sinVal)) >> 16);
+
+    pA += 2u;
+    pB += 2u;
+  }
+
+  /* Radix-4 transforms of both halves, with every other twiddle factor */
+  arm_radix4_butterfly_q15(pSrc, n2, (q15_t *) pCoef, 2u);
+  arm_radix4_butterfly_q15(pSrc + fftLen, n2, (q15_t *) pCoef, 2u);
+
+  /* Undo the extra scale of the radix-2 stage */
+  for (i = 0u; i < (fftLen << 1u); i++)
+  {
+    pSrc[i] = (q15_t) (pSrc[i] << 1u);
+  }
+}
+
+void arm_cfft_radix4by2_inverse_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef)
+{
+  uint32_t i, n2;
+  q31_t xt, yt;
+  q15_t cosVal, sinVal;
+  q15_t *pA = pSrc;                              /* first half */
+  q15_t *pB;                                     /* second half */
+  const q15_t *pTw = pCoef;                      /* twiddle factors */
+
+  n2 = fftLen >> 1u;
+  pB = pSrc + fftLen;
+
+  for (i = 0u; i < n2; i++)
+  {
+    cosVal = *pTw++;
+    sinVal = *pTw++;
+
+    /* xa - xb, ya - yb */
+    xt = (pA[0] >> 1u) - (pB[0] >> 1u);
+    yt = (pA[1] >> 1u) - (pB[1] >> 1u);
+
+    /* xa' = xa + xb, ya' = ya + yb */
+    pA[0] = ((pA[0] >> 1u) + (pB[0] >> 1u)) >> 1u;
+    pA[1] = ((pA[1] >> 1u) + (pB[1] >> 1u)) >> 1u;
+
+    /* xb' = xt * cos - yt * sin, yb' = yt * cos + xt * sin */
+    pB[0] = (q15_t) ((((q31_t) xt * cosVal) - ((q31_t) yt * sinVal)) >> 16);
+    pB[1] = (q15_t) ((((q31_t) yt * cosVal) + ((q31_t) xt * sinVal)) >> 16);
+
+    pA += 2u;
+    pB += 2u;
+  }
+
+  /* Radix-4 transforms of both halves, with every other twiddle factor */
+  arm_radix4_butterfly_inverse_q15(pSrc, n2, (q15_t *) pCoef, 2u);
+  arm_radix4_butterfly_inverse_q15(pSrc + fftLen, n2, (q15_t *) pCoef, 2u);
+
+  /* Undo the extra scale of the radix-2 stage */
+  for (i = 0u; i < (fftLen << 1u); i++)
+  {
+    pSrc[i] = (q15_t) (pSrc[i] << 1u);
+  }
+}
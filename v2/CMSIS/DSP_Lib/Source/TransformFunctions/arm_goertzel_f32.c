@@ -0,0 +1,221 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_f32.c
+*
+* Description:  Floating-point Goertzel filter bank
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Filter Bank
+ *
+ * Computes the DFT of a signal at a small set of frequencies. When only a
+ * few bins matter, as for DTMF and pilot tone detectors, this is cheaper
+ * than a full FFT and the frequencies need not be on an FFT bin.
+ * There are separate functions for floating-point, Q31 and Q15 data types.
+ *
+ * \par Algorithm:
+ * Each tone at normalised frequency <code>f</code>, i.e. the frequency
+ * divided by the sample rate, has a second order resonator with
+ * <code>w = 2*pi*f</code>:
+ * <pre>
+ *     s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]
+ * </pre>
+ * After the N samples of a frame, one more step with a zero input gives
+ * the DFT
+ * <pre>
+ *     X = (cos(w)*s[N-1] - s[N-2]) + j*sin(w)*s[N-1]
+ *       = sum(x[n] * exp(j*w*(N-n)), n = 0 .. N-1)
+ * </pre>
+ * which equals bin <code>k</code> of an N-point DFT, conjugated, when
+ * <code>f = k/N</code>. The magnitude or power follows from
+ * <code>arm_cmplx_mag</code> or <code>arm_cmplx_mag_squared</code>.
+ *
+ * \par
+ * <code>arm_goertzel</code> runs the resonators over a block. It may be
+ * called several times per frame. <code>arm_goertzel_dft</code> writes
+ * the DFT of the frame so far as <code>numTones</code> interleaved complex
+ * values, and <code>arm_goertzel_reset</code> starts a new frame. Each
+ * tone costs one multiply per sample. The block is run once per tone
+ * with the state held in registers.
+ *
+ * \par Sliding DFT:
+ * The sliding functions give the DFT of the last <code>windowLen</code>
+ * samples after every sample, at a cost per sample that depends on the
+ * number of tones but not on the window length:
+ * <pre>
+ *     X[n] = (X[n-1] + x[n] - exp(j*w*windowLen)*x[n-windowLen]) * exp(j*w)
+ * </pre>
+ * where the factor of the sample leaving the window is 1 for a tone on a
+ * DFT bin of the window.
+ * The rotation lets rounding errors build up, so once per window the
+ * bins are recomputed from the delay line by the resonators above. This
+ * costs one more multiply per sample and tone on average. The result is
+ * the same as <code>arm_goertzel_dft</code> over the window. The window
+ * starts filled with zeros.
+ *
+ * \par Fixed-Point Behavior
+ * The resonator state can grow to <code>N/sin(w)</code> times the input,
+ * and to at most <code>N*N</code> times. The init functions work out the
+ * number of bits this needs for the frame length and the highest tone and
+ * store it in <code>shift</code>. The input is shifted right by
+ * <code>shift</code> bits, so the DFT is scaled down by
+ * <code>2^shift</code> and cannot overflow. The Q15 functions keep the
+ * state and coefficients in Q31 format for accuracy.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Runs the floating-point Goertzel filter bank over a block of samples.
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples in the block.
+ * @return none.
+ */
+
+void arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* Resonator states */
+  const float32_t *pCoeffs = S->pCoeffs;         /* cos(w) and sin(w) per tone */
+  float32_t *pIn;                                /* Input pointer */
+  float32_t coef;                                /* 2*cos(w) */
+  float32_t s0, s1, s2;                          /* Resonator outputs */
+  uint32_t tone;                                 /* Tone counter */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  for (tone = 0u; tone < S->numTones; tone++)
+  {
+    /* Each tone runs over the whole block with its state in registers */
+    coef = 2.0f * pCoeffs[2u * tone];
+    s1 = pState[2u * tone];
+    s2 = pState[(2u * tone) + 1u];
+    pIn = pSrc;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the condition code on the Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling. Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* The two state variables swap roles every sample */
+      s2 = pIn[0] + (coef * s1) - s2;
+      s1 = pIn[1] + (coef * s2) - s1;
+      s2 = pIn[2] + (coef * s1) - s2;
+      s1 = pIn[3] + (coef * s2) - s1;
+      pIn += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over the whole block */
+    blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      s0 = *pIn++ + (coef * s1) - s2;
+      s2 = s1;
+      s1 = s0;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    pState[2u * tone] = s1;
+    pState[(2u * tone) + 1u] = s2;
+  }
+}
+
+/**
+ * @brief  DFT of the floating-point Goertzel filter bank frame.
+ * @param[in]  *S     points to an instance of the floating-point Goertzel structure.
+ * @param[out] *pDst  points to the output buffer of <code>2*numTones</code> values, real and imaginary parts interleaved.
+ * @return none.
+ */
+
+void arm_goertzel_dft_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pDst)
+{
+  const float32_t *pState = S->pState;           /* Resonator states */
+  const float32_t *pCoeffs = S->pCoeffs;         /* cos(w) and sin(w) per tone */
+  float32_t cosVal, sinVal;                      /* Tone coefficients */
+  float32_t s1, s2;                              /* Resonator outputs */
+  uint32_t tone;                                 /* Tone counter */
+
+  for (tone = 0u; tone < S->numTones; tone++)
+  {
+    cosVal = pCoeffs[2u * tone];
+    sinVal = pCoeffs[(2u * tone) + 1u];
+    s1 = pState[2u * tone];
+    s2 = pState[(2u * tone) + 1u];
+
+    /* The last resonator step with a zero input */
+    *pDst++ = (cosVal * s1) - s2;
+    *pDst++ = sinVal * s1;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_init_f32.c
+*
+* Description:  Floating-point Goertzel filter bank initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]     numTones   number of tones.
+ * @param[in]     *pFreqs    points to the <code>numTones</code> normalised frequencies, in the range [0 0.5].
+ * @param[out]    *pCoeffs   points to the coefficient buffer of <code>2*numTones</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>2*numTones</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ *                <code>pFreqs</code> holds a frequency out of range.
+ *
+ * <b>Description:</b>
+ * \par
+ * Works out the coefficients of the tones and starts the first frame.
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numTones,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  float32_t w;                                   /* Frequency in radians */
+  uint32_t tone;                                 /* Tone counter */
+
+  for (tone = 0u; tone < numTones; tone++)
+  {
+    if((pFreqs[tone] < 0.0f) || (pFreqs[tone] > 0.5f))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    w = 2.0f * PI * pFreqs[tone];
+    pCoeffs[2u * tone] = arm_cos_f32(w);
+    pCoeffs[(2u * tone) + 1u] = arm_sin_f32(w);
+  }
+
+  S->numTones = numTones;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  arm_goertzel_reset_f32(S);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Starts a new frame of the floating-point Goertzel filter bank.
+ * @param[in,out] *S  points to an instance of the floating-point Goertzel structure.
+ * @return none.
+ */
+
+void arm_goertzel_reset_f32(
+  arm_goertzel_instance_f32 * S)
+{
+  /* Clear the resonator states */
+  memset(S->pState, 0, (2u * S->numTones) * sizeof(float32_t));
+}
+
+/**
+ * @} end of Goertzel group
+ */
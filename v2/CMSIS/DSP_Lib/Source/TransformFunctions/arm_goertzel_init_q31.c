@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_init_q31.c
+*
+* Description:  Q31 Goertzel filter bank initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numTones   number of tones.
+ * @param[in]     *pFreqs    points to the <code>numTones</code> normalised frequencies, in the range [0 0.5].
+ * @param[in]     frameLen   largest number of samples per frame, which sets the input scaling.
+ * @param[out]    *pCoeffs   points to the coefficient buffer of <code>2*numTones</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>2*numTones</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ *                <code>pFreqs</code> holds a frequency out of range, <code>frameLen</code> is 0, or the frame is too long for the lowest or highest tone.
+ *
+ * <b>Description:</b>
+ * \par
+ * Works out the coefficients of the tones and starts the first frame.
+ * \par
+ * The frequencies are in 1.31 format, where 0.5 is half the sample rate.
+ * The input is scaled down by <code>shift</code> bits, set here for frames of up to
+ * <code>frameLen</code> samples.
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numTones,
+  const q31_t * pFreqs,
+  uint16_t frameLen,
+  q31_t * pCoeffs,
+  q31_t * pState)
+{
+  q31_t sinVal;                                  /* sin(w) in 1.31 format */
+  uint32_t frameBits = 0u;                       /* Bits for the frame length */
+  uint32_t toneBits;                             /* Bits for the gain of one tone */
+  uint32_t shift = 1u;                           /* Bits for the highest gain, one at least */
+  uint32_t tone;                                 /* Tone counter */
+
+  if(frameLen == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  while((1u << frameBits) < frameLen)
+  {
+    frameBits++;
+  }
+
+  for (tone = 0u; tone < numTones; tone++)
+  {
+    if((pFreqs[tone] < 0) || (pFreqs[tone] > 0x40000000))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    sinVal = arm_sin_q31(pFreqs[tone]);
+    pCoeffs[2u * tone] = arm_cos_q31(pFreqs[tone]);
+    pCoeffs[(2u * tone) + 1u] = sinVal;
+
+    /* The state grows to at most frameLen / sin(w) and frameLen * frameLen
+     * times the input, and sin(w) is at least 2^-CLZ(sinVal) */
+    toneBits = frameBits + ((sinVal > 0) ? __CLZ((uint32_t) sinVal) : 32u);
+    toneBits = (toneBits < (2u * frameBits)) ? toneBits : (2u * frameBits);
+    shift = (toneBits > shift) ? toneBits : shift;
+  }
+
+  if(shift > 31u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTones = numTones;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->shift = (uint8_t) shift;
+
+  arm_goertzel_reset_q31(S);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Starts a new frame of the Q31 Goertzel filter bank.
+ * @param[in,out] *S  points to an instance of the Q31 Goertzel structure.
+ * @return none.
+ */
+
+void arm_goertzel_reset_q31(
+  arm_goertzel_instance_q31 * S)
+{
+  /* Clear the resonator states */
+  memset(S->pState, 0, (2u * S->numTones) * sizeof(q31_t));
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_q31.c
+*
+* Description:  Q31 Goertzel filter bank
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Runs the Q31 Goertzel filter bank over a block of samples.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples in the block.
+ * @return none.
+ */
+
+void arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* Resonator states */
+  const q31_t *pCoeffs = S->pCoeffs;             /* cos(w) and sin(w) per tone */
+  q31_t *pIn;                                    /* Input pointer */
+  q31_t coef;                                    /* 2*cos(w) in 2.30 format, i.e. cos(w) in 1.31 */
+  q31_t s0, s1, s2;                              /* Resonator outputs */
+  uint32_t shift = S->shift;                     /* Input scaling */
+  uint32_t tone;                                 /* Tone counter */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  for (tone = 0u; tone < S->numTones; tone++)
+  {
+    /* Each tone runs over the whole block with its state in registers */
+    coef = pCoeffs[2u * tone];
+    s1 = pState[2u * tone];
+    s2 = pState[(2u * tone) + 1u];
+    pIn = pSrc;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the condition code on the Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling. Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* The two state variables swap roles every sample */
+      s2 = (q31_t) ((((q63_t) s1 * coef) >> 30) + (pIn[0] >> shift) - s2);
+      s1 = (q31_t) ((((q63_t) s2 * coef) >> 30) + (pIn[1] >> shift) - s1);
+      s2 = (q31_t) ((((q63_t) s1 * coef) >> 30) + (pIn[2] >> shift) - s2);
+      s1 = (q31_t) ((((q63_t) s2 * coef) >> 30) + (pIn[3] >> shift) - s1);
+      pIn += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over the whole block */
+    blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      s0 = (q31_t) ((((q63_t) s1 * coef) >> 30) + (*pIn++ >> shift) - s2);
+      s2 = s1;
+      s1 = s0;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    pState[2u * tone] = s1;
+    pState[(2u * tone) + 1u] = s2;
+  }
+}
+
+/**
+ * @brief  DFT of the Q31 Goertzel filter bank frame.
+ * @param[in]  *S     points to an instance of the Q31 Goertzel structure.
+ * @param[out] *pDst  points to the output buffer of <code>2*numTones</code> values, real and imaginary parts interleaved.
+ * @return none.
+ *
+ * <b>Scaling:</b>
+ * \par
+ * The DFT is scaled down by <code>2^shift</code>, see the instance.
+ */
+
+void arm_goertzel_dft_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pDst)
+{
+  const q31_t *pState = S->pState;               /* Resonator states */
+  const q31_t *pCoeffs = S->pCoeffs;             /* cos(w) and sin(w) per tone */
+  q31_t cosVal, sinVal;                          /* Tone coefficients */
+  q31_t s1, s2;                                  /* Resonator outputs */
+  uint32_t tone;                                 /* Tone counter */
+
+  for (tone = 0u; tone < S->numTones; tone++)
+  {
+    cosVal = pCoeffs[2u * tone];
+    sinVal = pCoeffs[(2u * tone) + 1u];
+    s1 = pState[2u * tone];
+    s2 = pState[(2u * tone) + 1u];
+
+    /* The last resonator step with a zero input */
+    *pDst++ = clip_q63_to_q31((((q63_t) s1 * cosVal) >> 31) - s2);
+    *pDst++ = (q31_t) (((q63_t) s1 * sinVal) >> 31);
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_sliding_f32.c
+*
+* Description:  Floating-point sliding Goertzel filter bank
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Slides the floating-point Goertzel filter bank window over a block of samples.
+ * @param[in,out] *S         points to an instance of the floating-point sliding Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples in the block.
+ * @return none.
+ */
+
+void arm_goertzel_sliding_f32(
+  arm_goertzel_sliding_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->bank.pState;            /* Bins, real and imaginary parts */
+  const float32_t *pCoeffs = S->bank.pCoeffs;    /* cos(w) and sin(w) per tone */
+  const float32_t *pWinCoeffs = S->pWinCoeffs;   /* cos(w*windowLen) and sin(w*windowLen) per tone */
+  float32_t *pDelay = S->pDelay;                 /* Delay line */
+  float32_t in, old;                             /* Samples entering and leaving the window */
+  float32_t re, im;                              /* Bin before rotation */
+  float32_t cosVal, sinVal;                      /* Tone coefficients */
+  float32_t s1, s2;                              /* Resonator outputs */
+  uint32_t windowLen = S->windowLen;             /* Window length */
+  uint32_t wr = S->writeIndex;                   /* Delay line slot of the oldest sample */
+  uint32_t numTones = S->bank.numTones;          /* Number of tones */
+  uint32_t tone;                                 /* Tone counter */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Newest sample in, oldest sample out */
+    in = *pSrc++;
+    old = pDelay[wr];
+    pDelay[wr] = in;
+
+    /* X[n] = (X[n-1] + x[n] - exp(j*w*windowLen)*x[n-windowLen]) * exp(j*w) */
+    for (tone = 0u; tone < numTones; tone++)
+    {
+      cosVal = pCoeffs[2u * tone];
+      sinVal = pCoeffs[(2u * tone) + 1u];
+      re = pState[2u * tone] + in - (old * pWinCoeffs[2u * tone]);
+      im = pState[(2u * tone) + 1u] - (old * pWinCoeffs[(2u * tone) + 1u]);
+      pState[2u * tone] = (re * cosVal) - (im * sinVal);
+      pState[(2u * tone) + 1u] = (re * sinVal) + (im * cosVal);
+    }
+
+    wr++;
+
+    /* Once per window, recompute the bins from the delay line, which now
+     * holds the window from oldest to newest, before rounding errors build up */
+    if(wr == windowLen)
+    {
+      wr = 0u;
+      arm_goertzel_reset_f32(&S->bank);
+      arm_goertzel_f32(&S->bank, pDelay, windowLen);
+
+      for (tone = 0u; tone < numTones; tone++)
+      {
+        cosVal = pCoeffs[2u * tone];
+        sinVal = pCoeffs[(2u * tone) + 1u];
+        s1 = pState[2u * tone];
+        s2 = pState[(2u * tone) + 1u];
+
+        /* The last resonator step with a zero input */
+        pState[2u * tone] = (cosVal * s1) - s2;
+        pState[(2u * tone) + 1u] = sinVal * s1;
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->writeIndex = (uint16_t) wr;
+}
+
+/**
+ * @brief  DFT of the floating-point sliding Goertzel filter bank window.
+ * @param[in]  *S     points to an instance of the floating-point sliding Goertzel structure.
+ * @param[out] *pDst  points to the output buffer of <code>2*numTones</code> values, real and imaginary parts interleaved.
+ * @return none.
+ */
+
+void arm_goertzel_sliding_dft_f32(
+  const arm_goertzel_sliding_instance_f32 * S,
+  float32_t * pDst)
+{
+  memcpy(pDst, S->bank.pState, (2u * S->bank.numTones) * sizeof(float32_t));
+}
+
+/**
+ * @} end of Goertzel group
+ */
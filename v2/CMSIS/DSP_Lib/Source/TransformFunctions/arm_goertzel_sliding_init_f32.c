@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_sliding_init_f32.c
+*
+* Description:  Floating-point sliding Goertzel filter bank initialization
+*               function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the floating-point sliding Goertzel structure.
+ * @param[in]     numTones   number of tones.
+ * @param[in]     *pFreqs    points to the <code>numTones</code> normalised frequencies, in the range [0 0.5].
+ * @param[in]     windowLen  number of samples in the window.
+ * @param[out]    *pCoeffs   points to the coefficient buffer of <code>4*numTones</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>2*numTones</code> values.
+ * @param[in]     *pDelay    points to the delay line of <code>windowLen</code> samples.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ *                arm_goertzel_init_f32 fails for the window or <code>windowLen</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * Sets up the bank of the tones as arm_goertzel_init_f32 does, with frames of
+ * <code>windowLen</code> samples, and fills the window with zeros.
+ */
+
+arm_status arm_goertzel_sliding_init_f32(
+  arm_goertzel_sliding_instance_f32 * S,
+  uint16_t numTones,
+  const float32_t * pFreqs,
+  uint16_t windowLen,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay)
+{
+  arm_status status;                             /* Status of the bank initialization */
+  uint32_t phase;                                /* w*windowLen in turns, 0.32 format */
+  float32_t w;                                   /* w*windowLen in radians */
+  uint32_t tone;                                 /* Tone counter */
+
+  if(windowLen == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_goertzel_init_f32(&S->bank, numTones, pFreqs, pCoeffs, pState);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* The factor of the sample leaving the window, exp(j*w*windowLen) */
+  for (tone = 0u; tone < numTones; tone++)
+  {
+    /* Wrap w*windowLen to one turn exactly, in integers */
+    phase = (uint32_t) (pFreqs[tone] * 4294967296.0f) * windowLen;
+    w = 6.28318530718f * ((float32_t) phase * 2.3283064365e-10f);
+    pCoeffs[(2u * numTones) + (2u * tone)] = arm_cos_f32(w);
+    pCoeffs[(2u * numTones) + (2u * tone) + 1u] = arm_sin_f32(w);
+  }
+
+  /* Empty window */
+  S->pWinCoeffs = pCoeffs + (2u * numTones);
+  S->windowLen = windowLen;
+  S->writeIndex = 0u;
+  S->pDelay = pDelay;
+  memset(pDelay, 0, windowLen * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_sliding_init_q31.c
+*
+* Description:  Q31 sliding Goertzel filter bank initialization
+*               function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the Q31 sliding Goertzel structure.
+ * @param[in]     numTones   number of tones.
+ * @param[in]     *pFreqs    points to the <code>numTones</code> normalised frequencies, in the range [0 0.5].
+ * @param[in]     windowLen  number of samples in the window.
+ * @param[out]    *pCoeffs   points to the coefficient buffer of <code>4*numTones</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>2*numTones</code> values.
+ * @param[in]     *pDelay    points to the delay line of <code>windowLen</code> samples.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ *                arm_goertzel_init_q31 fails for the window or <code>windowLen</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * Sets up the bank of the tones as arm_goertzel_init_q31 does, with frames of
+ * <code>windowLen</code> samples, and fills the window with zeros.
+ */
+
+arm_status arm_goertzel_sliding_init_q31(
+  arm_goertzel_sliding_instance_q31 * S,
+  uint16_t numTones,
+  const q31_t * pFreqs,
+  uint16_t windowLen,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pDelay)
+{
+  arm_status status;                             /* Status of the bank initialization */
+  q31_t phase;                                   /* w*windowLen in turns, 1.31 format */
+  uint32_t tone;                                 /* Tone counter */
+
+  if(windowLen == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_goertzel_init_q31(&S->bank, numTones, pFreqs, windowLen, pCoeffs, pState);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* The factor of the sample leaving the window, exp(j*w*windowLen) */
+  for (tone = 0u; tone < numTones; tone++)
+  {
+    /* Wrap w*windowLen to one turn exactly, in integers */
+    phase = (q31_t) (((uint32_t) pFreqs[tone] * windowLen) & 0x7FFFFFFFu);
+    pCoeffs[(2u * numTones) + (2u * tone)] = arm_cos_q31(phase);
+    pCoeffs[(2u * numTones) + (2u * tone) + 1u] = arm_sin_q31(phase);
+  }
+
+  /* Empty window */
+  S->pWinCoeffs = pCoeffs + (2u * numTones);
+  S->windowLen = windowLen;
+  S->writeIndex = 0u;
+  S->pDelay = pDelay;
+  memset(pDelay, 0, windowLen * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,187 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mfcc_f32.c
+*
+* Description:  Floating-point MFCC and log mel feature extraction
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MFCC Mel Frequency Cepstral Coefficients
+ *
+ * Turns a stream of audio samples into the features used by keyword and
+ * sound event classifiers: log mel energies, the log mel spectrogram,
+ * or their cepstral coefficients, the MFCCs. There are separate
+ * functions for floating-point and Q15 data types.
+ *
+ * \par Algorithm:
+ * Each call takes the next <code>hopLen</code> samples and makes one
+ * frame of the last <code>fftLen</code> samples, so frames overlap by
+ * <code>fftLen - hopLen</code> samples. The frame then goes through
+ * <pre>
+ *     x[n] * w[n]                                  Hann window
+ *     P[k] = |X[k]|^2,  k = 0 .. fftLen/2 - 1      power spectrum
+ *     E[m] = sum(H[m, k] * P[k])                   mel filter bank
+ *     L[m] = ln(E[m])                              log compression
+ *     c[i] = sum(D[i, m] * L[m])                   DCT-II
+ * </pre>
+ * The filters <code>H</code> are triangles spaced evenly on the mel scale
+ * <code>mel = 1127*ln(1 + f/700)</code> between <code>fMin</code> and
+ * <code>fMax</code>, with a peak of 1. <code>D</code> is the orthonormal
+ * DCT-II, of which only the first <code>numCeps</code> rows are kept.
+ * With <code>numCeps</code> equal to 0 the log mel energies
+ * <code>L</code> are the output; one such vector per hop makes the log
+ * mel spectrogram.
+ *
+ * \par
+ * The window, filter bank and DCT are worked out once by the init
+ * function. A triangle is nonzero on only a few bins, so only those
+ * weights are kept, with the first bin and number of bins of each filter
+ * in <code>pFilterPos</code>. Each bin is in at most two filters, so the
+ * weights take at most <code>fftLen</code> values instead of
+ * <code>numMels*fftLen/2</code>. The samples are kept in a circular
+ * buffer and windowed straight into the scratch buffer, where the real
+ * FFT, the power spectrum and the log mel energies are computed in place.
+ * The bin at half the sample rate has zero weight in every filter and is
+ * not used.
+ *
+ * \par Memory
+ * The caller provides all buffers. The init function sets
+ * <code>memSize</code> to the bytes of the instance and of its tables and
+ * buffers, not counting the constant FFT tables.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 functions take 1.15 samples and give the log mel energies and
+ * cepstral coefficients in 8.8 format, that is the value times 256, for
+ * the same values as the floating-point functions on the same samples.
+ * Each frame is normalised by the shift that brings its largest sample
+ * to at least 0.5 before the FFT, so quiet frames keep their precision,
+ * and the shift is taken out again in the log. Mel energies are
+ * accumulated in 64 bits. A zero energy gives -128 and large values
+ * saturate; the first cepstral coefficient can reach
+ * <code>sqrt(numMels)</code> times the log energies.
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Floating-point MFCC feature extraction of one hop.
+ * @param[in,out] *S    points to an instance of the floating-point MFCC structure.
+ * @param[in]     *pSrc points to the block of <code>hopLen</code> new samples.
+ * @param[out]    *pDst points to the <code>numCeps</code> cepstral coefficients, or the
+ *                      <code>numMels</code> log mel energies when <code>numCeps</code> is 0.
+ * @return none.
+ *
+ * \par
+ * Energies below 1e-12 are raised to it before the log.
+ */
+
+void arm_mfcc_f32(
+  arm_mfcc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t *pState = S->pState;                 /* Last fftLen samples */
+  float32_t *pFrame = S->pScratch;               /* Frame, then its power spectrum */
+  float32_t *pWeights = S->pWeights;             /* Nonzero filter weights */
+  uint16_t *pPos = S->pFilterPos;                /* First bin and bins of each filter */
+  uint32_t fftLen = S->fftLen;                   /* Frame length */
+  uint32_t hopLen = S->hopLen;                   /* New samples per frame */
+  uint32_t numMels = S->numMels;                 /* Number of filters */
+  uint32_t head = S->writeIndex;                 /* Slot of the oldest sample */
+  uint32_t tail;                                 /* Samples up to the end of the buffer */
+  float32_t *pMel;                               /* Log mel energies */
+  float32_t energy, dc;                          /* Temporary variables */
+  uint32_t m, k;                                 /* Loop counters */
+
+  /* The new samples overwrite the oldest ones */
+  tail = fftLen - head;
+
+  if(hopLen <= tail)
+  {
+    arm_copy_f32(pSrc, pState + head, hopLen);
+  }
+  else
+  {
+    arm_copy_f32(pSrc, pState + head, tail);
+    arm_copy_f32(pSrc + tail, pState, hopLen - tail);
+  }
+
+  head += hopLen;
+  head = (head >= fftLen) ? (head - fftLen) : head;
+  S->writeIndex = (uint16_t) head;
+
+  /* Window the frame, oldest sample first, in two runs around the wrap */
+  tail = fftLen - head;
+  arm_mult_f32(pState + head, S->pWindow, pFrame, tail);
+  arm_mult_f32(pState, S->pWindow + tail, pFrame + tail, head);
+
+  /* Real FFT in place, then the power spectrum over it. pFrame[1] holds
+   * the bin at half the sample rate, which is not used. */
+  arm_rfft_fast_f32(&S->rfft, pFrame, pFrame, 0u);
+  dc = pFrame[0];
+  arm_cmplx_mag_squared_f32(pFrame + 2u, pFrame + 1u, (fftLen >> 1u) - 1u);
+  pFrame[0] = dc * dc;
+
+  /* The log mel energies go after the power spectrum unless they are the output */
+  pMel = (S->numCeps == 0u) ? pDst : (pFrame + (fftLen >> 1u));
+
+  for (m = 0u; m < numMels; m++)
+  {
+    arm_dot_prod_f32(pWeights, pFrame + pPos[0], pPos[1], &energy);
+    pWeights += pPos[1];
+    pPos += 2u;
+
+    pMel[m] = logf((energy > 1.0e-12f) ? energy : 1.0e-12f);
+  }
+
+  for (k = 0u; k < S->numCeps; k++)
+  {
+    arm_dot_prod_f32(S->pDctCoeffs + (k * numMels), pMel, numMels, pDst + k);
+  }
+}
+
+/**
+ * @} end of MFCC group
+ */
@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mfcc_init_q15.c
+*
+* Description:  Q15 MFCC feature extractor initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Rounds a value in [-1 1] to Q15, saturating 1 to 0x7FFF.
+ */
+static q15_t arm_mfcc_float_to_q15(
+  float32_t in)
+{
+  in = (in * 32768.0f) + ((in > 0.0f) ? 0.5f : -0.5f);
+
+  return ((q15_t) __SSAT((q31_t) in, 16));
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 MFCC feature extractor.
+ * @param[in,out] *S          points to an instance of the Q15 MFCC structure.
+ * @param[in]     fftLen      frame and FFT length, 32 to 4096 and a power of 2.
+ * @param[in]     hopLen      number of new samples per frame, 1 to <code>fftLen</code>.
+ * @param[in]     numMels     number of mel filters, 1 to <code>fftLen/2</code>.
+ * @param[in]     numCeps     number of cepstral coefficients, at most <code>numMels</code>, or 0 for log mel energies.
+ * @param[in]     sampleRate  sample rate in Hz.
+ * @param[in]     fMin        lower edge of the first filter in Hz.
+ * @param[in]     fMax        upper edge of the last filter in Hz, at most <code>sampleRate/2</code>.
+ * @param[out]    *pWindow    points to the window buffer of <code>fftLen</code> values.
+ * @param[out]    *pWeights   points to the filter weight buffer of <code>fftLen</code> values.
+ * @param[out]    *pFilterPos points to the buffer of <code>2*numMels</code> filter positions.
+ * @param[out]    *pDctCoeffs points to the DCT buffer of <code>numCeps*numMels</code> values.
+ * @param[in]     *pState     points to the state buffer of <code>fftLen</code> values.
+ * @param[in]     *pScratch   points to the scratch buffer of <code>fftLen</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ *                an argument is out of range or a filter is narrower than one FFT bin.
+ *
+ * <b>Description:</b>
+ * \par
+ * Works out the window, the filter bank and the DCT in floating-point and
+ * rounds them to Q15, and clears the state.
+ * <code>memSize</code> is set to the bytes of the instance and of the
+ * buffers it uses, with only the filter weights in use counted.
+ */
+
+arm_status arm_mfcc_init_q15(
+  arm_mfcc_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopLen,
+  uint16_t numMels,
+  uint16_t numCeps,
+  uint32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  q15_t * pWindow,
+  q15_t * pWeights,
+  uint16_t * pFilterPos,
+  q15_t * pDctCoeffs,
+  q15_t * pState,
+  q31_t * pScratch)
+{
+  float32_t melMin, melStep;                     /* Mel scale of the filter edges */
+  float32_t left, center, right;                 /* Edges of one filter */
+  float32_t mel, weight;                         /* Mel value and weight of one bin */
+  float32_t scale;                               /* DCT normalisation */
+  uint32_t numWeights = 0u;                      /* Weights in use */
+  uint32_t m, k;                                 /* Loop counters */
+
+  if((arm_rfft_fast_init_q15(&S->rfft, fftLen) != ARM_MATH_SUCCESS)
+     || (hopLen == 0u) || (hopLen > fftLen) || (numMels == 0u)
+     || (numMels > (fftLen >> 1u)) || (numCeps > numMels)
+     || (fMin < 0.0f) || (fMin >= fMax) || (fMax > (0.5f * (float32_t) sampleRate)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Periodic Hann window */
+  for (k = 0u; k < fftLen; k++)
+  {
+    pWindow[k] = arm_mfcc_float_to_q15(0.5f - (0.5f * arm_cos_f32((2.0f * PI * (float32_t) k) / (float32_t) fftLen)));
+  }
+
+  /* Triangles on the mel scale, mel = 1127 * ln(1 + f / 700), with the
+   * edges of each filter at the centers of its neighbours */
+  melMin = 1127.0f * logf(1.0f + (fMin / 700.0f));
+  melStep = ((1127.0f * logf(1.0f + (fMax / 700.0f))) - melMin) / (float32_t) (numMels + 1u);
+
+  for (m = 0u; m < numMels; m++)
+  {
+    left = melMin + ((float32_t) m * melStep);
+    center = left + melStep;
+    right = center + melStep;
+    pFilterPos[2u * m] = 0u;
+    pFilterPos[(2u * m) + 1u] = 0u;
+
+    /* The nonzero weights of a triangle are on a run of bins */
+    for (k = 0u; k < (fftLen >> 1u); k++)
+    {
+      mel = 1127.0f * logf(1.0f + (((float32_t) k * (float32_t) sampleRate) / (700.0f * (float32_t) fftLen)));
+      weight = (mel <= center) ? ((mel - left) / melStep) : ((right - mel) / melStep);
+
+      if(weight > 0.0f)
+      {
+        if(pFilterPos[(2u * m) + 1u] == 0u)
+        {
+          pFilterPos[2u * m] = (uint16_t) k;
+        }
+
+        pWeights[numWeights++] = arm_mfcc_float_to_q15(weight);
+        pFilterPos[(2u * m) + 1u]++;
+      }
+    }
+
+    if(pFilterPos[(2u * m) + 1u] == 0u)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  /* Orthonormal DCT-II of the log mel energies */
+  for (k = 0u; k < numCeps; k++)
+  {
+    arm_sqrt_f32(((k == 0u) ? 1.0f : 2.0f) / (float32_t) numMels, &scale);
+
+    for (m = 0u; m < numMels; m++)
+    {
+      pDctCoeffs[(k * numMels) + m] =
+        arm_mfcc_float_to_q15(scale * arm_cos_f32((PI * (float32_t) k * ((float32_t) m + 0.5f)) / (float32_t) numMels));
+    }
+  }
+
+  S->fftLen = fftLen;
+  S->hopLen = hopLen;
+  S->numMels = numMels;
+  S->numCeps = numCeps;
+  S->pWindow = pWindow;
+  S->pWeights = pWeights;
+  S->pFilterPos = pFilterPos;
+  S->pDctCoeffs = pDctCoeffs;
+  S->pState = pState;
+  S->pScratch = pScratch;
+  S->memSize = sizeof(arm_mfcc_instance_q15)
+    + (((2u * (uint32_t) fftLen) + numWeights + ((uint32_t) numCeps * numMels)) * sizeof(q15_t))
+    + ((uint32_t) fftLen * sizeof(q31_t)) + (2u * (uint32_t) numMels * sizeof(uint16_t));
+
+  arm_mfcc_reset_q15(S);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Clears the state of the Q15 MFCC feature extractor.
+ * @param[in,out] *S points to an instance of the Q15 MFCC structure.
+ * @return none.
+ *
+ * \par
+ * The first frames after a reset see zeros before the first sample.
+ */
+
+void arm_mfcc_reset_q15(
+  arm_mfcc_instance_q15 * S)
+{
+  S->writeIndex = 0u;
+  arm_fill_q15(0, S->pState, S->fftLen);
+}
+
+/**
+ * @} end of MFCC group
+ */
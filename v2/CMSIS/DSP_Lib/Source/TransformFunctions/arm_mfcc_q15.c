@@ -0,0 +1,338 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mfcc_q15.c
+*
+* Description:  Q15 MFCC and log mel feature extraction
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief  log2(1 + i/32) in Q30 for i = 0 .. 32.
+ */
+static const q31_t arm_mfcc_log2_q30[33] = {
+  0x00000000, 0x02D75A6F, 0x0598FDBF, 0x08462C46,
+  0x0AE00D1D, 0x0D67AF17, 0x0FDE0B5D, 0x124407AB,
+  0x149A784C, 0x16E221CE, 0x191BBA89, 0x1B47EBF7,
+  0x1D6753E0, 0x1F7A8569, 0x21820A02, 0x237E623D,
+  0x2570068E, 0x275767F5, 0x2934F098, 0x2B09044D,
+  0x2CD4011D, 0x2E963FAD, 0x305013AB, 0x3201CC2C,
+  0x33ABB3FB, 0x354E11EB, 0x36E9291F, 0x387D3946,
+  0x3A0A7EDA, 0x3B913356, 0x3D118D67, 0x3E8BC118,
+  0x40000000
+};
+
+/**
+ * @brief  ln(energy * 2^exponent) in 8.8 format.
+ *
+ * The leading one of the energy gives the integer part of log2 and the
+ * next 21 bits index the table and interpolate in it, which is within
+ * 2e-4 of log2 and below the 8.8 resolution.
+ */
+static q15_t arm_mfcc_log_q15(
+  q63_t energy,
+  int32_t exponent)
+{
+  uint32_t hi = (uint32_t) (energy >> 32);       /* Upper word of the energy */
+  int32_t msb;                                   /* Position of the leading one */
+  uint32_t index, frac;                          /* Table index and fraction */
+  q63_t out;                                     /* log2 in Q30, then ln in 8.8 */
+
+  if(energy <= 0)
+  {
+    return ((q15_t) 0x8000);
+  }
+
+  msb = (hi != 0u) ? (63 - (int32_t) __CLZ(hi)) : (31 - (int32_t) __CLZ((uint32_t) energy));
+
+  /* Move the leading one to bit 62 */
+  energy <<= (62 - msb);
+  index = (uint32_t) (energy >> 57) & 0x1Fu;
+  frac = (uint32_t) (energy >> 41) & 0xFFFFu;
+
+  out = arm_mfcc_log2_q30[index]
+    + ((((q63_t) arm_mfcc_log2_q30[index + 1u] - arm_mfcc_log2_q30[index]) * frac) >> 16);
+  out += (q63_t) (msb + exponent) << 30;
+
+  /* Times ln(2) in Q16, rounded to 8.8 format; the clip drops the last 15 bits */
+  out = ((out * 45426) + ((q63_t) 1 << 37)) >> 23;
+
+  return (clip_q63_to_q15(out));
+}
+
+/**
+ * @brief  Largest magnitude of a block of Q15 samples.
+ */
+static uint32_t arm_mfcc_absmax_q15(
+  const q15_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t out = 0u;                             /* Largest magnitude */
+  uint32_t in;                                   /* Magnitude of one sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in = (uint32_t) ((pSrc[0] < 0) ? -pSrc[0] : pSrc[0]);
+    out = (in > out) ? in : out;
+    in = (uint32_t) ((pSrc[1] < 0) ? -pSrc[1] : pSrc[1]);
+    out = (in > out) ? in : out;
+    in = (uint32_t) ((pSrc[2] < 0) ? -pSrc[2] : pSrc[2]);
+    out = (in > out) ? in : out;
+    in = (uint32_t) ((pSrc[3] < 0) ? -pSrc[3] : pSrc[3]);
+    out = (in > out) ? in : out;
+    pSrc += 4u;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    in = (uint32_t) ((*pSrc < 0) ? -*pSrc : *pSrc);
+    out = (in > out) ? in : out;
+    pSrc++;
+    blkCnt--;
+  }
+
+  return (out);
+}
+
+/**
+ * @brief  Windows a block of Q15 samples and scales it up by 2^shift.
+ */
+static void arm_mfcc_window_q15(
+  const q15_t * pSrc,
+  const q15_t * pWindow,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint32_t shift)
+{
+  uint32_t rShift = 15u - shift;                 /* Right shift of the products */
+  uint32_t blkCnt;                               /* Loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    pDst[0] = (q15_t) (((q31_t) pSrc[0] * pWindow[0]) >> rShift);
+    pDst[1] = (q15_t) (((q31_t) pSrc[1] * pWindow[1]) >> rShift);
+    pDst[2] = (q15_t) (((q31_t) pSrc[2] * pWindow[2]) >> rShift);
+    pDst[3] = (q15_t) (((q31_t) pSrc[3] * pWindow[3]) >> rShift);
+    pSrc += 4u;
+    pWindow += 4u;
+    pDst += 4u;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) (((q31_t) * pSrc++ * *pWindow++) >> rShift);
+    blkCnt--;
+  }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Q15 MFCC feature extraction of one hop.
+ * @param[in,out] *S    points to an instance of the Q15 MFCC structure.
+ * @param[in]     *pSrc points to the block of <code>hopLen</code> new samples.
+ * @param[out]    *pDst points to the <code>numCeps</code> cepstral coefficients, or the
+ *                      <code>numMels</code> log mel energies when <code>numCeps</code> is 0, in 8.8 format.
+ * @return none.
+ */
+
+void arm_mfcc_q15(
+  arm_mfcc_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst)
+{
+  q15_t *pState = S->pState;                     /* Last fftLen samples */
+  q15_t *pFrame = (q15_t *) S->pScratch;         /* Frame */
+  q31_t *pPower = S->pScratch;                   /* Power spectrum, over the frame */
+  q15_t *pWeights = S->pWeights;                 /* Nonzero filter weights */
+  uint16_t *pPos = S->pFilterPos;                /* First bin and bins of each filter */
+  uint32_t fftLen = S->fftLen;                   /* Frame length */
+  uint32_t hopLen = S->hopLen;                   /* New samples per frame */
+  uint32_t numMels = S->numMels;                 /* Number of filters */
+  uint32_t head = S->writeIndex;                 /* Slot of the oldest sample */
+  uint32_t tail;                                 /* Samples up to the end of the buffer */
+  uint32_t shift = 0u;                           /* Normalisation of the frame */
+  int32_t exponent;                              /* log2 of the energy scale */
+  q15_t *pMel;                                   /* Log mel energies */
+  q15_t *pW;                                     /* Weight pointer */
+  q31_t *pP;                                     /* Power pointer */
+  q31_t re, im;                                  /* Temporary variables */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t m, k;                                 /* Loop counters */
+
+  /* The new samples overwrite the oldest ones */
+  tail = fftLen - head;
+
+  if(hopLen <= tail)
+  {
+    arm_copy_q15(pSrc, pState + head, hopLen);
+  }
+  else
+  {
+    arm_copy_q15(pSrc, pState + head, tail);
+    arm_copy_q15(pSrc + tail, pState, hopLen - tail);
+  }
+
+  head += hopLen;
+  head = (head >= fftLen) ? (head - fftLen) : head;
+  S->writeIndex = (uint16_t) head;
+
+  /* Block floating point: the largest sample of the frame goes to at least 0.5 */
+  k = arm_mfcc_absmax_q15(pState, fftLen);
+
+  if((k > 0u) && (__CLZ(k) > 17u))
+  {
+    shift = __CLZ(k) - 17u;
+  }
+
+  /* Window the frame, oldest sample first, in two runs around the wrap */
+  tail = fftLen - head;
+  arm_mfcc_window_q15(pState + head, S->pWindow, pFrame, tail, shift);
+  arm_mfcc_window_q15(pState, S->pWindow + tail, pFrame + tail, head, shift);
+
+  /* Real FFT in place, scaled by 2^shift / fftLen */
+  arm_rfft_fast_q15(&S->rfft, pFrame, pFrame, 0u);
+
+  /* Power spectrum in Q31 words over the complex values, so
+   * P = |X|^2 * 2^29. pFrame[1] holds the bin at half the sample
+   * rate, which is not used. */
+  re = pFrame[0];
+  pPower[0] = (re * re) >> 1;
+
+  for (k = 1u; k < (fftLen >> 1u); k++)
+  {
+    re = pFrame[2u * k];
+    im = pFrame[(2u * k) + 1u];
+    pPower[k] = ((re * re) >> 1) + ((im * im) >> 1);
+  }
+
+  /* The energies are 2^(44 + 2*shift) / fftLen^2 times those of arm_mfcc_f32() */
+  exponent = (2 * (31 - (int32_t) __CLZ(fftLen))) - 44 - (2 * (int32_t) shift);
+
+  /* The log mel energies go after the power spectrum unless they are the output */
+  pMel = (S->numCeps == 0u) ? pDst : (q15_t *) (pPower + (fftLen >> 1u));
+
+  for (m = 0u; m < numMels; m++)
+  {
+    pW = pWeights;
+    pP = pPower + pPos[0];
+    k = pPos[1];
+    sum = 0;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    while(k >= 4u)
+    {
+      sum += (q63_t) pW[0] * pP[0];
+      sum += (q63_t) pW[1] * pP[1];
+      sum += (q63_t) pW[2] * pP[2];
+      sum += (q63_t) pW[3] * pP[3];
+      pW += 4u;
+      pP += 4u;
+      k -= 4u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(k > 0u)
+    {
+      sum += (q63_t) * pW++ * *pP++;
+      k--;
+    }
+
+    pWeights += pPos[1];
+    pPos += 2u;
+
+    pMel[m] = arm_mfcc_log_q15(sum, exponent);
+  }
+
+  for (k = 0u; k < S->numCeps; k++)
+  {
+    arm_dot_prod_q15(S->pDctCoeffs + (k * numMels), pMel, numMels, &sum);
+    pDst[k] = clip_q63_to_q15(sum + (1 << 14));
+  }
+}
+
+/**
+ * @} end of MFCC group
+ */
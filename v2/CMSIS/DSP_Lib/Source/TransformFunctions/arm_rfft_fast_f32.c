@@ -47,9 +47,12 @@ void stage_rfft_f32(
    uint32_t  k;								   /* Loop Counter                     */
    float32_t twR, twI;						   /* RFFT Twiddle coefficients        */
    float32_t * pCoeff = S->pTwiddleRFFT;  /* Points to RFFT Twiddle factors   */
+   float32_t * pCoeffB;                      /* decreasing twiddle pointer       */
    float32_t *pA = p;						   /* increasing pointer               */
    float32_t *pB = p;						   /* decreasing pointer               */
+   float32_t *pOutB;                         /* decreasing output pointer        */
    float32_t xAR, xAI, xBR, xBI;				/* temporary variables              */
+   float32_t yAR, yAI;                       /* temporary variables              */
    float32_t t1a, t1b;				         /* temporary variables              */
    float32_t p0, p1, p2, p3;				   /* temporary variables              */
 
@@ -80,6 +83,12 @@ void stage_rfft_f32(
    // XA(1) = 1/2*( U1 - imag(U2) +  i*( U1 +imag(U2) ));
    pB  = p + 2*k;
    pA += 2;
+   pOutB = pOut + 2*(k - 1);
+   pCoeffB = pCoeff + 2*(k - 1);
+
+   /* Bins k and fftLen/2 - k are made together from the same two inputs,
+      so the output can overwrite the input */
+   k = ((S->Sint).fftLen) >> 1;
 
    do
    {
@@ -116,11 +125,30 @@ void stage_rfft_f32(
       p2 = twR * t1b;
       p3 = twI * t1b;
 
-      *pOut++ = 0.5f * (xAR + xBR + p0 + p3 ); //xAR
-      *pOut++ = 0.5f * (xAI - xBI + p1 - p2 ); //xAI
+      yAR = 0.5f * (xAR + xBR + p0 + p3 ); //xAR
+      yAI = 0.5f * (xAI - xBI + p1 - p2 ); //xAI
+
+      /* The mirrored bin swaps the roles of xA and xB */
+      twR = pCoeffB[0];
+      twI = pCoeffB[1];
+      pCoeffB -= 2;
+
+      t1a = xAR - xBR ;
+
+      p0 = twR * t1a;
+      p1 = twI * t1a;
+      p2 = twR * t1b;
+      p3 = twI * t1b;
+
+      pOutB[0] = 0.5f * (xBR + xAR + p0 + p3 ); //xBR
+      pOutB[1] = 0.5f * (xBI - xAI + p1 - p2 ); //xBI
+      pOut[0] = yAR;
+      pOut[1] = yAI;
 
       pA += 2;
       pB -= 2;
+      pOut += 2;
+      pOutB -= 2;
       k--;
    } while(k > 0u);
 }
@@ -268,6 +296,10 @@ float32_t * p, float32_t * pOut)
  * The forward and inverse real FFT functions apply the standard FFT scaling; no
  * scaling on the forward transform and 1/fftLen scaling on the inverse
  * transform.
+ * \par
+ * The input buffer is used as scratch. The forward transform can write its
+ * output over its input, <code>pOut == p</code>, so a frame is transformed
+ * without a second buffer.
  * \par Q15 and Q31
  * The real algorithms are defined in a similar manner and utilize N/2 complex
  * transforms behind the scenes.  In the case of fixed-point data, a radix-4
@@ -320,7 +352,7 @@ float32_t * p, float32_t * pOut)
 * @brief Processing function for the floating-point real FFT.
 * @param[in]  *S              points to an arm_rfft_fast_instance_f32 structure.
 * @param[in]  *p              points to the input buffer.
-* @param[in]  *pOut           points to an arm_rfft_fast_instance_f32 structure.
+* @param[out] *pOut           points to the output buffer, which may be <code>p</code> for the forward transform.
 * @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
 * @return none.
 */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_rfft_fast_init_q15.c
+*
+* Description:  Initialization function for the Q15 real FFT built on arm_cfft_q15
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**   
+ * @ingroup groupTransforms   
+ */
+
+/**   
+ * @addtogroup RealFFT   
+ * @{   
+ */
+
+/**   
+* @brief  Initialization function for the Q15 real FFT.  
+* @param[in,out] *S             points to an arm_rfft_fast_instance_q15 structure.
+* @param[in]     fftLen         length of the Real Sequence.  
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.  
+*   
+* \par Description:  
+* \par   
+* The parameter <code>fftLen</code>	Specifies length of RFFT/RIFFT process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.   
+* \par   
+* This Function points the instance to the constant twiddle factor and bit reversal tables,
+* it does not compute anything. The real stage reuses the complex FFT twiddle factors of <code>fftLen</code> points.
+*/
+arm_status arm_rfft_fast_init_q15(
+  arm_rfft_fast_instance_q15 * S,
+  uint16_t fftLen)
+{
+  arm_cfft_instance_q15 * Sint;
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+  /*  Initialise the FFT length */
+  Sint = &(S->Sint);
+  Sint->fftLen = fftLen/2;
+  S->fftLenRFFT = fftLen;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (Sint->fftLen)
+  {
+  case 2048u:
+    /*  Initializations of structure parameters for 2048 point FFT */
+    /*  Initialise the bit reversal table length */
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH;
+    /*  Initialise the bit reversal table pointer */
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_2048;
+    /*  Initialise the twiddle coefficient pointers */
+    Sint->pTwiddle = twiddleCoef_2048_q15;
+    S->pTwiddleRFFT = twiddleCoef_4096_q15;
+    break;
+  case 1024u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_1024;
+    Sint->pTwiddle = twiddleCoef_1024_q15;
+    S->pTwiddleRFFT = twiddleCoef_2048_q15;
+    break;
+  case 512u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_512;
+    Sint->pTwiddle = twiddleCoef_512_q15;
+    S->pTwiddleRFFT = twiddleCoef_1024_q15;
+    break;
+  case 256u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_256;
+    Sint->pTwiddle = twiddleCoef_256_q15;
+    S->pTwiddleRFFT = twiddleCoef_512_q15;
+    break;
+  case 128u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_128;
+    Sint->pTwiddle = twiddleCoef_128_q15;
+    S->pTwiddleRFFT = twiddleCoef_256_q15;
+    break;
+  case 64u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_64;
+    Sint->pTwiddle = twiddleCoef_64_q15;
+    S->pTwiddleRFFT = twiddleCoef_128_q15;
+    break;
+  case 32u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_32;
+    Sint->pTwiddle = twiddleCoef_32_q15;
+    S->pTwiddleRFFT = twiddleCoef_64_q15;
+    break;
+  case 16u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_16;
+    Sint->pTwiddle = twiddleCoef_16_q15;
+    S->pTwiddleRFFT = twiddleCoef_32_q15;
+    break;
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**   
+ * @} end of RealFFT group   
+ */
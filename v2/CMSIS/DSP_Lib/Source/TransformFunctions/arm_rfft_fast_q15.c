@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_rfft_fast_q15.c
+*
+* Description:  RFFT & RIFFT Q15 process function built on arm_cfft_q15
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/*
+* Splits the complex FFT of the even and odd samples into the first half of
+* the spectrum of the real sequence. The twiddle factors are those of the
+* complex FFT of fftLenRFFT points, read as sin and cos. The result is
+* scaled by a further 1/2 to stay in range.
+*/
+
+static void stage_rfft_q15(
+  arm_rfft_fast_instance_q15 * S,
+  q15_t * p, q15_t * pOut)
+{
+   uint32_t  k;                                  /* Loop Counter                     */
+   q15_t twR, twI;                               /* RFFT Twiddle coefficients        */
+   const q15_t *pCoeff = S->pTwiddleRFFT;        /* Points to RFFT Twiddle factors   */
+   const q15_t *pCoeffB;                         /* decreasing twiddle pointer       */
+   q15_t *pA = p;                                /* increasing pointer               */
+   q15_t *pB = p;                                /* decreasing pointer               */
+   q15_t *pOutB;                                 /* decreasing output pointer        */
+   q15_t xAR, xAI, xBR, xBI;                     /* temporary variables              */
+   q15_t yAR, yAI;                               /* temporary variables              */
+   q31_t t1a, t1b;                               /* temporary variables              */
+   q31_t p0, p1, p2, p3;                         /* temporary variables              */
+
+   k = (S->Sint).fftLen - 1u;
+
+   /* Pack first and last sample of the frequency domain together */
+   xAR = pA[0];
+   xAI = pA[1];
+
+   *pOut++ = (q15_t) (((q31_t) xAR + xAI) >> 1);
+   *pOut++ = (q15_t) (((q31_t) xAR - xAI) >> 1);
+
+   pB  = p + 2u * k;
+   pA += 2u;
+   pCoeff += 2u;
+   pOutB = pOut + 2u * (k - 1u);
+   pCoeffB = pCoeff + 2u * (k - 1u);
+
+   /* Bins k and fftLen/2 - k are made together from the same two inputs,
+      so the output can overwrite the input */
+   k = ((S->Sint).fftLen) >> 1u;
+
+   while(k > 0u)
+   {
+      xBI = pB[1];
+      xBR = pB[0];
+      xAR = pA[0];
+      xAI = pA[1];
+
+      /* The complex FFT table holds cos and sin */
+      twI = *pCoeff++;
+      twR = *pCoeff++;
+
+      t1a = (q31_t) xBR - xAR;
+      t1b = (q31_t) xBI + xAI;
+
+      // real(tw * (xB - xA)) = twR * (xBR - xAR) - twI * (xBI - xAI);
+      // imag(tw * (xB - xA)) = twI * (xBR - xAR) + twR * (xBI - xAI);
+      p0 = (twR * t1a) >> 15;
+      p1 = (twI * t1a) >> 15;
+      p2 = (twR * t1b) >> 15;
+      p3 = (twI * t1b) >> 15;
+
+      yAR = (q15_t) __SSAT(((q31_t) xAR + xBR + p0 + p3) >> 2, 16); //xAR
+      yAI = (q15_t) __SSAT(((q31_t) xAI - xBI + p1 - p2) >> 2, 16); //xAI
+
+      /* The mirrored bin swaps the roles of xA and xB */
+      twI = pCoeffB[0];
+      twR = pCoeffB[1];
+      pCoeffB -= 2u;
+
+      t1a = (q31_t) xAR - xBR;
+
+      p0 = (twR * t1a) >> 15;
+      p1 = (twI * t1a) >> 15;
+      p2 = (twR * t1b) >> 15;
+      p3 = (twI * t1b) >> 15;
+
+      pOutB[0] = (q15_t) __SSAT(((q31_t) xBR + xAR + p0 + p3) >> 2, 16); //xBR
+      pOutB[1] = (q15_t) __SSAT(((q31_t) xBI - xAI + p1 - p2) >> 2, 16); //xBI
+      pOut[0] = yAR;
+      pOut[1] = yAI;
+
+      pA += 2u;
+      pB -= 2u;
+      pOut += 2u;
+      pOutB -= 2u;
+      k--;
+   }
+}
+
+/* Prepares data for inverse cfft */
+static void merge_rfft_q15(
+  arm_rfft_fast_instance_q15 * S,
+  q15_t * p, q15_t * pOut)
+{
+   uint32_t  k;                                  /* Loop Counter                     */
+   q15_t twR, twI;                               /* RFFT Twiddle coefficients        */
+   const q15_t *pCoeff = S->pTwiddleRFFT;        /* Points to RFFT Twiddle factors   */
+   q15_t *pA = p;                                /* increasing pointer               */
+   q15_t *pB = p;                                /* decreasing pointer               */
+   q15_t xAR, xAI, xBR, xBI;                     /* temporary variables              */
+   q31_t t1a, t1b, r, s, t, u;                   /* temporary variables              */
+
+   k = (S->Sint).fftLen - 1u;
+
+   xAR = pA[0];
+   xAI = pA[1];
+
+   pCoeff += 2u;
+
+   *pOut++ = (q15_t) (((q31_t) xAR + xAI) >> 1);
+   *pOut++ = (q15_t) (((q31_t) xAR - xAI) >> 1);
+
+   pB  = p + 2u * k;
+   pA += 2u;
+
+   while(k > 0u)
+   {
+      /* G is half of the frequency complex spectrum */
+      //for k = 2:N
+      //    Xk(k) = 1/2 * (G(k) + conj(G(N-k+2)) + Tw(k)*( G(k) - conj(G(N-k+2))));
+      xBI = pB[1];
+      xBR = pB[0];
+      xAR = pA[0];
+      xAI = pA[1];
+
+      twI = *pCoeff++;
+      twR = *pCoeff++;
+
+      t1a = (q31_t) xAR - xBR;
+      t1b = (q31_t) xAI + xBI;
+
+      r = (twR * t1a) >> 15;
+      s = (twI * t1b) >> 15;
+      t = (twI * t1a) >> 15;
+      u = (twR * t1b) >> 15;
+
+      *pOut++ = (q15_t) __SSAT(((q31_t) xAR + xBR - r - s) >> 1, 16); //xAR
+      *pOut++ = (q15_t) __SSAT(((q31_t) xAI - xBI + t - u) >> 1, 16); //xAI
+
+      pA += 2u;
+      pB -= 2u;
+      k--;
+   }
+}
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the Q15 real FFT.
+* @param[in]  *S              points to an arm_rfft_fast_instance_q15 structure.
+* @param[in]  *p              points to the input buffer, which is also used as scratch.
+* @param[out] *pOut           points to the output buffer, which may be <code>p</code> for the forward transform.
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @return none.
+*
+* \par
+* The function works as arm_rfft_fast_f32(), with the packed output format
+* described there, on top of arm_cfft_q15() of half the length.
+* \par Input and output formats:
+* \par
+* The forward transform takes a 1.15 input and is scaled by <code>1/fftLen</code>,
+* so the output is in (1+log2(fftLen)).(15-log2(fftLen)) format. The inverse
+* transform matches the textbook definition and includes the 1/fftLen scale.
+* A forward transform followed by an inverse one returns the input scaled by
+* <code>1/fftLen</code>.
+*/
+
+void arm_rfft_fast_q15(
+  arm_rfft_fast_instance_q15 * S,
+  q15_t * p, q15_t * pOut,
+  uint8_t ifftFlag)
+{
+   arm_cfft_instance_q15 * Sint = &(S->Sint);
+
+   /* Calculation of Real FFT */
+   if(ifftFlag)
+   {
+      /*  Real FFT compression */
+      merge_rfft_q15(S, p, pOut);
+
+      /* Complex IFFT process */
+      arm_cfft_q15( Sint, pOut, ifftFlag, 1);
+   }
+   else
+   {
+      /* Calculation of RFFT of input */
+      arm_cfft_q15( Sint, p, ifftFlag, 1);
+
+      /*  Real FFT extraction */
+      stage_rfft_q15(S, p, pOut);
+   }
+}
+
+/**
+* @} end of RealFFT group
+*/
@@ -82,4 +82,76 @@
       4096, twiddleCoef_4096, armBitRevIndexTable4096, ARMBITREVINDEXTABLE4096_TABLE_LENGTH
    };
 
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len16 = {
+      16, twiddleCoef_16_q15, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len32 = {
+      32, twiddleCoef_32_q15, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len64 = {
+      64, twiddleCoef_64_q15, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len128 = {
+      128, twiddleCoef_128_q15, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len256 = {
+      256, twiddleCoef_256_q15, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len512 = {
+      512, twiddleCoef_512_q15, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024 = {
+      1024, twiddleCoef_1024_q15, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 = {
+      2048, twiddleCoef_2048_q15, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 = {
+      4096, twiddleCoef_4096_q15, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len16 = {
+      16, twiddleCoef_16_q31, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len32 = {
+      32, twiddleCoef_32_q31, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len64 = {
+      64, twiddleCoef_64_q31, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 = {
+      128, twiddleCoef_128_q31, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 = {
+      256, twiddleCoef_256_q31, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len512 = {
+      512, twiddleCoef_512_q31, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len1024 = {
+      1024, twiddleCoef_1024_q31, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len2048 = {
+      2048, twiddleCoef_2048_q31, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len4096 = {
+      4096, twiddleCoef_4096_q31, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+   };
+
 #endif
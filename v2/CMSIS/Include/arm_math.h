@@ -132,6 +132,13 @@
    *
    * Initialize macro __FPU_PRESENT = 1 when building on FPU supported Targets. Enable this macro for M4bf and M4lf libraries
    *
+   * - ARM_MATH_HOST:
+   *
+   * Define macro ARM_MATH_HOST to build the library with a C compiler for the machine it runs on, for testing and
+   * benchmarking on a PC. The core intrinsics are replaced by the C functions in <code>arm_math_host.h</code>.
+   * The Cortex-M3 code paths are built by default, define ARM_MATH_CM0 as well to build the Cortex-M0 code paths.
+   * The benchmark and accuracy suite in the <code>CMSIS\\DSP_Lib\\Host</code> folder uses this build.
+   *
    * <b>Copyright Notice</b>
    *
    * Copyright (C) 2010-2013 ARM Limited. All rights reserved.
@@ -258,6 +265,31 @@
  * bilinear interpolation is used for 2-dimensional data.
  */
 
+/**
+ * @defgroup groupNN Neural Network Functions
+ *
+ * Layers for the inference of small quantised neural networks, in Q7 and
+ * Q15 versions: fully-connected, convolution, depthwise and pointwise
+ * convolution, pooling, ReLU and softmax. The layers keep no state and
+ * allocate no memory; the caller gives each layer its input, output and
+ * scratch buffers, and the same buffers can be reused from layer to layer.
+ *
+ * \par Requantisation
+ * The values of each layer are fixed-point numbers with a number of
+ * fractional bits chosen for the layer when the network is quantised.
+ * The products of an input with <code>a</code> fractional bits and
+ * weights with <code>w</code> fractional bits have <code>a + w</code>
+ * fractional bits. The bias, with <code>b</code> fractional bits, is
+ * shifted left by <code>biasShift = a + w - b</code> to the same format,
+ * and the sum is shifted right by <code>outShift = a + w - o</code> to an
+ * output with <code>o</code> fractional bits, rounded and saturated.
+ * The Q7 layers accumulate in 32 bits and the Q15 layers in 64 bits.
+ *
+ * \par Images
+ * Images are square and stored in HWC order: the channels of each pixel
+ * next to each other and the pixels in row order.
+ */
+
 /**
  * @defgroup groupExamples Examples
  */
@@ -266,7 +298,12 @@
 
 #define __CMSIS_GENERIC         /* disable NVIC and Systick functions */
 
-#if defined (ARM_MATH_CM4)
+#if defined (ARM_MATH_HOST)
+#include "arm_math_host.h"
+#if defined (ARM_MATH_CM0) || defined (ARM_MATH_CM0PLUS)
+#define ARM_MATH_CM0_FAMILY
+#endif
+#elif defined (ARM_MATH_CM4)
 #include "core_cm4.h"
 #elif defined (ARM_MATH_CM3)
 #include "core_cm3.h"
@@ -480,6 +517,47 @@ extern "C"
             (((q63_t) (x >> 32) * y)));
   }
 
+  /**
+   * @brief Square root of a non-negative 2.62 value, rounded and saturated to 1.31 format.
+   */
+
+  static __INLINE q31_t sqrt_q63_to_q31(
+  q63_t x)
+  {
+    uint64_t rem = (uint64_t) x;
+    uint64_t root = 0u;
+    uint64_t bit = 1ull << 62;
+
+    /* One result bit per step, from the most significant down */
+    while(bit > rem)
+    {
+      bit >>= 2;
+    }
+
+    while(bit != 0u)
+    {
+      if(rem >= (root + bit))
+      {
+        rem -= root + bit;
+        root = (root >> 1) + bit;
+      }
+      else
+      {
+        root >>= 1;
+      }
+
+      bit >>= 2;
+    }
+
+    /* Round to nearest */
+    if(rem > root)
+    {
+      root++;
+    }
+
+    return ((root > 0x7FFFFFFFu) ? 0x7FFFFFFF : (q31_t) root);
+  }
+
 
 #if defined (ARM_MATH_CM0_FAMILY) && defined ( __CC_ARM   )
 #define __CLZ __clz
@@ -2133,6 +2211,42 @@ extern "C"
   uint8_t ifftFlag,
   uint8_t bitReverseFlag);
 
+  /**
+   * @brief Instance structure for the Q15 CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const q15_t *pTwiddle;             /**< points to the Twiddle factor table. */
+    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
+    uint16_t bitRevLength;             /**< bit reversal table length. */
+  } arm_cfft_instance_q15;
+
+  void arm_cfft_q15(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
+  /**
+   * @brief Instance structure for the Q31 CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const q31_t *pTwiddle;             /**< points to the Twiddle factor table. */
+    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
+    uint16_t bitRevLength;             /**< bit reversal table length. */
+  } arm_cfft_instance_q31;
+
+  void arm_cfft_q31(
+  const arm_cfft_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2237,6 +2351,206 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Instance structure for the Q15 fast RFFT/RIFFT function.
+   */
+
+typedef struct
+  {
+    arm_cfft_instance_q15 Sint;      /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;                        /**< length of the real sequence */
+    const q15_t * pTwiddleRFFT;                 /**< Twiddle factors real stage  */
+  } arm_rfft_fast_instance_q15 ;
+
+arm_status arm_rfft_fast_init_q15 (
+	arm_rfft_fast_instance_q15 * S,
+	uint16_t fftLen);
+
+void arm_rfft_fast_q15(
+  arm_rfft_fast_instance_q15 * S,
+  q15_t * p, q15_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q31 fast RFFT/RIFFT function.
+   */
+
+typedef struct
+  {
+    arm_cfft_instance_q31 Sint;      /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;                        /**< length of the real sequence */
+    const q31_t * pTwiddleRFFT;                 /**< Twiddle factors real stage  */
+  } arm_rfft_fast_instance_q31 ;
+
+arm_status arm_rfft_fast_init_q31 (
+	arm_rfft_fast_instance_q31 * S,
+	uint16_t fftLen);
+
+void arm_rfft_fast_q31(
+  arm_rfft_fast_instance_q31 * S,
+  q31_t * p, q31_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point FFT FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+    uint16_t partLen;                   /**< partition length, the number of samples filtered per FFT. */
+    uint16_t numParts;                  /**< number of partitions, numTaps / partLen rounded up. */
+    uint16_t partIndex;                 /**< delay line slot that holds the spectrum of the newest input. */
+    float32_t *pState;                  /**< points to the state array of length (numParts + 3) * 2 * partLen. */
+    float32_t *pCoeffs;                 /**< points to the partition spectra, of length numParts * 2 * partLen. */
+    arm_rfft_fast_instance_f32 rfft;    /**< real FFT of 2 * partLen points. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 FFT FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+    uint16_t partLen;                   /**< partition length, the number of samples filtered per FFT. */
+    uint16_t numParts;                  /**< number of partitions, numTaps / partLen rounded up. */
+    uint16_t partIndex;                 /**< delay line slot that holds the spectrum of the newest input. */
+    int8_t outShift;                    /**< left shift that restores the output scale, less the block normalisation. */
+    q31_t *pState;                      /**< points to the state array of length (numParts + 3) * 2 * partLen. */
+    q31_t *pCoeffs;                     /**< points to the partition spectra, of length numParts * 2 * partLen. */
+    arm_rfft_fast_instance_q31 rfft;    /**< real FFT of 2 * partLen points. */
+  } arm_fir_fft_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 FFT FIR filter.
+   */
+  typedef struct
+  {
+    arm_fir_fft_instance_q31 Sint;      /**< Q31 filter that does the work, with Q31 spectra and state. */
+  } arm_fir_fft_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point FFT FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point FFT FIR structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients, in time reversed order as for arm_fir_f32().
+   * @param[in]     partLen partition length, 16 to 2048 and a power of 2.
+   * @param[out]    *pCoeffSpectra points to a buffer of numParts * 2 * partLen values for the partition spectra.
+   * @param[in]     *pState points to the state buffer of (numParts + 3) * 2 * partLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   *                <code>numTaps</code> is 0 or <code>partLen</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  uint16_t partLen,
+  float32_t * pCoeffSpectra,
+  float32_t * pState);
+
+  /**
+   * @brief  Clears the state of the floating-point FFT FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point FFT FIR structure.
+   * @return none.
+   */
+  void arm_fir_fft_reset_f32(
+  arm_fir_fft_instance_f32 * S);
+
+  /**
+   * @brief Processing function for the floating-point FFT FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point FFT FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process, a multiple of partLen.
+   * @return none.
+   */
+  void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FFT FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 FFT FIR structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients, in time reversed order as for arm_fir_q31().
+   * @param[in]     partLen partition length, 16 to 2048 and a power of 2.
+   * @param[out]    *pCoeffSpectra points to a buffer of numParts * 2 * partLen values for the partition spectra.
+   * @param[in]     *pState points to the state buffer of (numParts + 3) * 2 * partLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   *                <code>numTaps</code> is 0 or <code>partLen</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_q31(
+  arm_fir_fft_instance_q31 * S,
+  uint16_t numTaps,
+  const q31_t * pCoeffs,
+  uint16_t partLen,
+  q31_t * pCoeffSpectra,
+  q31_t * pState);
+
+  /**
+   * @brief  Clears the state of the Q31 FFT FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 FFT FIR structure.
+   * @return none.
+   */
+  void arm_fir_fft_reset_q31(
+  arm_fir_fft_instance_q31 * S);
+
+  /**
+   * @brief Processing function for the Q31 FFT FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 FFT FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process, a multiple of partLen.
+   * @return none.
+   */
+  void arm_fir_fft_q31(
+  arm_fir_fft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FFT FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 FFT FIR structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients, in time reversed order as for arm_fir_q15().
+   * @param[in]     partLen partition length, 16 to 2048 and a power of 2.
+   * @param[out]    *pCoeffSpectra points to a buffer of numParts * 2 * partLen Q31 values for the partition spectra.
+   * @param[in]     *pState points to the state buffer of (numParts + 3) * 2 * partLen Q31 values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   *                <code>numTaps</code> is 0 or <code>partLen</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_q15(
+  arm_fir_fft_instance_q15 * S,
+  uint16_t numTaps,
+  const q15_t * pCoeffs,
+  uint16_t partLen,
+  q31_t * pCoeffSpectra,
+  q31_t * pState);
+
+  /**
+   * @brief  Clears the state of the Q15 FFT FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 FFT FIR structure.
+   * @return none.
+   */
+  void arm_fir_fft_reset_q15(
+  arm_fir_fft_instance_q15 * S);
+
+  /**
+   * @brief Processing function for the Q15 FFT FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 FFT FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process, a multiple of partLen.
+   * @return none.
+   */
+  void arm_fir_fft_q15(
+  arm_fir_fft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2379,136 +2693,647 @@ void arm_rfft_fast_f32(
   q15_t * pInlineBuffer);
 
   /**
-   * @brief Floating-point vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Instance structure for the floating-point Goertzel filter bank.
    */
+  typedef struct
+  {
+    uint16_t numTones;                  /**< number of tones. */
+    const float32_t *pCoeffs;            /**< points to cos(w) and sin(w) of each tone, of length 2 * numTones. */
+    float32_t *pState;                  /**< points to the resonator states, of length 2 * numTones. */
+  } arm_goertzel_instance_f32;
 
-  void arm_add_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
-  float32_t * pDst,
-  uint32_t blockSize);
+  /**
+   * @brief Instance structure for the floating-point sliding Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                 /**< number of samples in the window. */
+    uint16_t writeIndex;                /**< delay line slot of the oldest sample. */
+    arm_goertzel_instance_f32 bank;     /**< tones and bins of the window. */
+    const float32_t *pWinCoeffs;         /**< points to cos(w*windowLen) and sin(w*windowLen) of each tone, after those of the bank. */
+    float32_t *pDelay;                   /**< points to the delay line of length windowLen. */
+  } arm_goertzel_sliding_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numTones number of tones.
+   * @param[in]     *pFreqs points to the normalised frequencies, in the range [0 0.5].
+   * @param[out]    *pCoeffs points to the coefficient buffer of 2 * numTones values.
+   * @param[in]     *pState points to the state buffer of 2 * numTones values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numTones,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState);
 
   /**
-   * @brief Q7 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  Starts a new frame of the floating-point Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the floating-point Goertzel structure.
    * @return none.
    */
 
-  void arm_add_q7(
-  q7_t * pSrcA,
-  q7_t * pSrcB,
-  q7_t * pDst,
-  uint32_t blockSize);
+  void arm_goertzel_reset_f32(
+  arm_goertzel_instance_f32 * S);
 
   /**
-   * @brief Q15 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  Runs the floating-point Goertzel filter bank over a block of samples.
+   * @param[in,out] *S points to an instance of the floating-point Goertzel structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
    * @return none.
    */
 
-  void arm_add_q15(
-  q15_t * pSrcA,
-  q15_t * pSrcB,
-  q15_t * pDst,
+  void arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
   uint32_t blockSize);
 
   /**
-   * @brief Q31 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  DFT of the floating-point Goertzel filter bank frame.
+   * @param[in]  *S points to an instance of the floating-point Goertzel structure.
+   * @param[out] *pDst points to the 2 * numTones output values, real and imaginary parts interleaved.
    * @return none.
    */
 
-  void arm_add_q31(
-  q31_t * pSrcA,
-  q31_t * pSrcB,
-  q31_t * pDst,
-  uint32_t blockSize);
+  void arm_goertzel_dft_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pDst);
 
   /**
-   * @brief Floating-point vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief  Initialization function for the floating-point sliding Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the floating-point sliding Goertzel structure.
+   * @param[in]     numTones number of tones.
+   * @param[in]     *pFreqs points to the normalised frequencies, in the range [0 0.5].
+   * @param[in]     windowLen number of samples in the window.
+   * @param[out]    *pCoeffs points to the coefficient buffer of 4 * numTones values.
+   * @param[in]     *pState points to the state buffer of 2 * numTones values.
+   * @param[in]     *pDelay points to the delay line of windowLen samples.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
    */
 
-  void arm_sub_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
-  float32_t * pDst,
-  uint32_t blockSize);
+  arm_status arm_goertzel_sliding_init_f32(
+  arm_goertzel_sliding_instance_f32 * S,
+  uint16_t numTones,
+  const float32_t * pFreqs,
+  uint16_t windowLen,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay);
 
   /**
-   * @brief Q7 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  Slides the floating-point Goertzel filter bank window over a block of samples.
+   * @param[in,out] *S points to an instance of the floating-point sliding Goertzel structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
    * @return none.
    */
 
-  void arm_sub_q7(
-  q7_t * pSrcA,
-  q7_t * pSrcB,
-  q7_t * pDst,
+  void arm_goertzel_sliding_f32(
+  arm_goertzel_sliding_instance_f32 * S,
+  float32_t * pSrc,
   uint32_t blockSize);
 
   /**
-   * @brief Q15 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  DFT of the floating-point sliding Goertzel filter bank window.
+   * @param[in]  *S points to an instance of the floating-point sliding Goertzel structure.
+   * @param[out] *pDst points to the 2 * numTones output values, real and imaginary parts interleaved.
    * @return none.
    */
 
-  void arm_sub_q15(
-  q15_t * pSrcA,
-  q15_t * pSrcB,
-  q15_t * pDst,
-  uint32_t blockSize);
+  void arm_goertzel_sliding_dft_f32(
+  const arm_goertzel_sliding_instance_f32 * S,
+  float32_t * pDst);
 
   /**
-   * @brief Q31 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Instance structure for the Q31 Goertzel filter bank.
    */
+  typedef struct
+  {
+    uint16_t numTones;                  /**< number of tones. */
+    uint8_t shift;                      /**< input scaling, the DFT is scaled down by 2^shift. */
+    const q31_t *pCoeffs;                /**< points to cos(w) and sin(w) of each tone, of length 2 * numTones. */
+    q31_t *pState;                      /**< points to the resonator states, of length 2 * numTones. */
+  } arm_goertzel_instance_q31;
 
-  void arm_sub_q31(
-  q31_t * pSrcA,
-  q31_t * pSrcB,
-  q31_t * pDst,
-  uint32_t blockSize);
+  /**
+   * @brief Instance structure for the Q31 sliding Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                 /**< number of samples in the window. */
+    uint16_t writeIndex;                /**< delay line slot of the oldest sample. */
+    arm_goertzel_instance_q31 bank;     /**< tones and bins of the window. */
+    const q31_t *pWinCoeffs;             /**< points to cos(w*windowLen) and sin(w*windowLen) of each tone, after those of the bank. */
+    q31_t *pDelay;                       /**< points to the delay line of length windowLen. */
+  } arm_goertzel_sliding_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numTones number of tones.
+   * @param[in]     *pFreqs points to the normalised frequencies, in the range [0 0.5].
+   * @param[in]     frameLen largest number of samples per frame, which sets the input scaling.
+   * @param[out]    *pCoeffs points to the coefficient buffer of 2 * numTones values.
+   * @param[in]     *pState points to the state buffer of 2 * numTones values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numTones,
+  const q31_t * pFreqs,
+  uint16_t frameLen,
+  q31_t * pCoeffs,
+  q31_t * pState);
 
   /**
-   * @brief Multiplies a floating-point vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scale scale factor to be applied
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
+   * @brief  Starts a new frame of the Q31 Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the Q31 Goertzel structure.
    * @return none.
    */
 
-  void arm_scale_f32(
-  float32_t * pSrc,
+  void arm_goertzel_reset_q31(
+  arm_goertzel_instance_q31 * S);
+
+  /**
+   * @brief  Runs the Q31 Goertzel filter bank over a block of samples.
+   * @param[in,out] *S points to an instance of the Q31 Goertzel structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  DFT of the Q31 Goertzel filter bank frame.
+   * @param[in]  *S points to an instance of the Q31 Goertzel structure.
+   * @param[out] *pDst points to the 2 * numTones output values, real and imaginary parts interleaved.
+   * @return none.
+   */
+
+  void arm_goertzel_dft_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pDst);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the Q31 sliding Goertzel structure.
+   * @param[in]     numTones number of tones.
+   * @param[in]     *pFreqs points to the normalised frequencies, in the range [0 0.5].
+   * @param[in]     windowLen number of samples in the window.
+   * @param[out]    *pCoeffs points to the coefficient buffer of 4 * numTones values.
+   * @param[in]     *pState points to the state buffer of 2 * numTones values.
+   * @param[in]     *pDelay points to the delay line of windowLen samples.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+
+  arm_status arm_goertzel_sliding_init_q31(
+  arm_goertzel_sliding_instance_q31 * S,
+  uint16_t numTones,
+  const q31_t * pFreqs,
+  uint16_t windowLen,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pDelay);
+
+  /**
+   * @brief  Slides the Q31 Goertzel filter bank window over a block of samples.
+   * @param[in,out] *S points to an instance of the Q31 sliding Goertzel structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_goertzel_sliding_q31(
+  arm_goertzel_sliding_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  DFT of the Q31 sliding Goertzel filter bank window.
+   * @param[in]  *S points to an instance of the Q31 sliding Goertzel structure.
+   * @param[out] *pDst points to the 2 * numTones output values, real and imaginary parts interleaved.
+   * @return none.
+   */
+
+  void arm_goertzel_sliding_dft_q31(
+  const arm_goertzel_sliding_instance_q31 * S,
+  q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numTones;                  /**< number of tones. */
+    uint8_t shift;                      /**< input scaling, the DFT is scaled down by 2^shift. */
+    const q31_t *pCoeffs;                /**< points to cos(w) and sin(w) of each tone, of length 2 * numTones. */
+    q31_t *pState;                      /**< points to the resonator states, of length 2 * numTones. */
+  } arm_goertzel_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q15 sliding Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                 /**< number of samples in the window. */
+    uint16_t writeIndex;                /**< delay line slot of the oldest sample. */
+    arm_goertzel_instance_q15 bank;     /**< tones and bins of the window. */
+    const q31_t *pWinCoeffs;             /**< points to cos(w*windowLen) and sin(w*windowLen) of each tone, after those of the bank. */
+    q15_t *pDelay;                       /**< points to the delay line of length windowLen. */
+  } arm_goertzel_sliding_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the Q15 Goertzel structure.
+   * @param[in]     numTones number of tones.
+   * @param[in]     *pFreqs points to the normalised frequencies, in the range [0 0.5].
+   * @param[in]     frameLen largest number of samples per frame, which sets the input scaling.
+   * @param[out]    *pCoeffs points to the coefficient buffer of 2 * numTones values.
+   * @param[in]     *pState points to the state buffer of 2 * numTones values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+
+  arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numTones,
+  const q15_t * pFreqs,
+  uint16_t frameLen,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+  /**
+   * @brief  Starts a new frame of the Q15 Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the Q15 Goertzel structure.
+   * @return none.
+   */
+
+  void arm_goertzel_reset_q15(
+  arm_goertzel_instance_q15 * S);
+
+  /**
+   * @brief  Runs the Q15 Goertzel filter bank over a block of samples.
+   * @param[in,out] *S points to an instance of the Q15 Goertzel structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_goertzel_q15(
+  arm_goertzel_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  DFT of the Q15 Goertzel filter bank frame.
+   * @param[in]  *S points to an instance of the Q15 Goertzel structure.
+   * @param[out] *pDst points to the 2 * numTones output values, real and imaginary parts interleaved.
+   * @return none.
+   */
+
+  void arm_goertzel_dft_q15(
+  const arm_goertzel_instance_q15 * S,
+  q15_t * pDst);
+
+  /**
+   * @brief  Initialization function for the Q15 sliding Goertzel filter bank.
+   * @param[in,out] *S points to an instance of the Q15 sliding Goertzel structure.
+   * @param[in]     numTones number of tones.
+   * @param[in]     *pFreqs points to the normalised frequencies, in the range [0 0.5].
+   * @param[in]     windowLen number of samples in the window.
+   * @param[out]    *pCoeffs points to the coefficient buffer of 4 * numTones values.
+   * @param[in]     *pState points to the state buffer of 2 * numTones values.
+   * @param[in]     *pDelay points to the delay line of windowLen samples.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+
+  arm_status arm_goertzel_sliding_init_q15(
+  arm_goertzel_sliding_instance_q15 * S,
+  uint16_t numTones,
+  const q15_t * pFreqs,
+  uint16_t windowLen,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q15_t * pDelay);
+
+  /**
+   * @brief  Slides the Q15 Goertzel filter bank window over a block of samples.
+   * @param[in,out] *S points to an instance of the Q15 sliding Goertzel structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_goertzel_sliding_q15(
+  arm_goertzel_sliding_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  DFT of the Q15 sliding Goertzel filter bank window.
+   * @param[in]  *S points to an instance of the Q15 sliding Goertzel structure.
+   * @param[out] *pDst points to the 2 * numTones output values, real and imaginary parts interleaved.
+   * @return none.
+   */
+
+  void arm_goertzel_sliding_dft_q15(
+  const arm_goertzel_sliding_instance_q15 * S,
+  q15_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point MFCC feature extractor.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                    /**< frame and FFT length. */
+    uint16_t hopLen;                    /**< number of new samples per frame. */
+    uint16_t numMels;                   /**< number of mel filters. */
+    uint16_t numCeps;                   /**< number of cepstral coefficients, 0 for log mel energies. */
+    uint16_t writeIndex;                /**< state slot of the oldest sample. */
+    uint32_t memSize;                   /**< bytes of the instance, tables and buffers, set by the init function. */
+    float32_t *pWindow;                 /**< points to the window of length fftLen. */
+    float32_t *pWeights;                /**< points to the nonzero filter weights, at most fftLen values. */
+    uint16_t *pFilterPos;               /**< points to the first bin and number of bins of each filter, of length 2 * numMels. */
+    float32_t *pDctCoeffs;              /**< points to the DCT matrix of numCeps x numMels values. */
+    float32_t *pState;                  /**< points to the last fftLen samples. */
+    float32_t *pScratch;                /**< points to the scratch buffer of length fftLen. */
+    arm_rfft_fast_instance_f32 rfft;    /**< real FFT of fftLen points. */
+  } arm_mfcc_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point MFCC feature extractor.
+   * @param[in,out] *S points to an instance of the floating-point MFCC structure.
+   * @param[in]     fftLen frame and FFT length, 32 to 4096 and a power of 2.
+   * @param[in]     hopLen number of new samples per frame, 1 to fftLen.
+   * @param[in]     numMels number of mel filters, 1 to fftLen / 2.
+   * @param[in]     numCeps number of cepstral coefficients, at most numMels, or 0 for log mel energies.
+   * @param[in]     sampleRate sample rate in Hz.
+   * @param[in]     fMin lower edge of the first filter in Hz.
+   * @param[in]     fMax upper edge of the last filter in Hz, at most sampleRate / 2.
+   * @param[out]    *pWindow points to the window buffer of fftLen values.
+   * @param[out]    *pWeights points to the filter weight buffer of fftLen values.
+   * @param[out]    *pFilterPos points to the buffer of 2 * numMels filter positions.
+   * @param[out]    *pDctCoeffs points to the DCT buffer of numCeps * numMels values.
+   * @param[in]     *pState points to the state buffer of fftLen values.
+   * @param[in]     *pScratch points to the scratch buffer of fftLen values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+
+  arm_status arm_mfcc_init_f32(
+  arm_mfcc_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopLen,
+  uint16_t numMels,
+  uint16_t numCeps,
+  uint32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  float32_t * pWindow,
+  float32_t * pWeights,
+  uint16_t * pFilterPos,
+  float32_t * pDctCoeffs,
+  float32_t * pState,
+  float32_t * pScratch);
+
+  /**
+   * @brief  Clears the state of the floating-point MFCC feature extractor.
+   * @param[in,out] *S points to an instance of the floating-point MFCC structure.
+   * @return none.
+   */
+
+  void arm_mfcc_reset_f32(
+  arm_mfcc_instance_f32 * S);
+
+  /**
+   * @brief  Floating-point MFCC feature extraction of one hop.
+   * @param[in,out] *S points to an instance of the floating-point MFCC structure.
+   * @param[in]     *pSrc points to the block of hopLen new samples.
+   * @param[out]    *pDst points to the numCeps cepstral coefficients, or numMels log mel energies.
+   * @return none.
+   */
+
+  void arm_mfcc_f32(
+  arm_mfcc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q15 MFCC feature extractor.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                    /**< frame and FFT length. */
+    uint16_t hopLen;                    /**< number of new samples per frame. */
+    uint16_t numMels;                   /**< number of mel filters. */
+    uint16_t numCeps;                   /**< number of cepstral coefficients, 0 for log mel energies. */
+    uint16_t writeIndex;                /**< state slot of the oldest sample. */
+    uint32_t memSize;                   /**< bytes of the instance, tables and buffers, set by the init function. */
+    q15_t *pWindow;                     /**< points to the window of length fftLen. */
+    q15_t *pWeights;                    /**< points to the nonzero filter weights, at most fftLen values. */
+    uint16_t *pFilterPos;               /**< points to the first bin and number of bins of each filter, of length 2 * numMels. */
+    q15_t *pDctCoeffs;                  /**< points to the DCT matrix of numCeps x numMels values. */
+    q15_t *pState;                      /**< points to the last fftLen samples. */
+    q31_t *pScratch;                    /**< points to the scratch buffer of length fftLen. */
+    arm_rfft_fast_instance_q15 rfft;    /**< real FFT of fftLen points. */
+  } arm_mfcc_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 MFCC feature extractor.
+   * @param[in,out] *S points to an instance of the Q15 MFCC structure.
+   * @param[in]     fftLen frame and FFT length, 32 to 4096 and a power of 2.
+   * @param[in]     hopLen number of new samples per frame, 1 to fftLen.
+   * @param[in]     numMels number of mel filters, 1 to fftLen / 2.
+   * @param[in]     numCeps number of cepstral coefficients, at most numMels, or 0 for log mel energies.
+   * @param[in]     sampleRate sample rate in Hz.
+   * @param[in]     fMin lower edge of the first filter in Hz.
+   * @param[in]     fMax upper edge of the last filter in Hz, at most sampleRate / 2.
+   * @param[out]    *pWindow points to the window buffer of fftLen values.
+   * @param[out]    *pWeights points to the filter weight buffer of fftLen values.
+   * @param[out]    *pFilterPos points to the buffer of 2 * numMels filter positions.
+   * @param[out]    *pDctCoeffs points to the DCT buffer of numCeps * numMels values.
+   * @param[in]     *pState points to the state buffer of fftLen values.
+   * @param[in]     *pScratch points to the scratch buffer of fftLen values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+
+  arm_status arm_mfcc_init_q15(
+  arm_mfcc_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopLen,
+  uint16_t numMels,
+  uint16_t numCeps,
+  uint32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  q15_t * pWindow,
+  q15_t * pWeights,
+  uint16_t * pFilterPos,
+  q15_t * pDctCoeffs,
+  q15_t * pState,
+  q31_t * pScratch);
+
+  /**
+   * @brief  Clears the state of the Q15 MFCC feature extractor.
+   * @param[in,out] *S points to an instance of the Q15 MFCC structure.
+   * @return none.
+   */
+
+  void arm_mfcc_reset_q15(
+  arm_mfcc_instance_q15 * S);
+
+  /**
+   * @brief  Q15 MFCC feature extraction of one hop.
+   * @param[in,out] *S points to an instance of the Q15 MFCC structure.
+   * @param[in]     *pSrc points to the block of hopLen new samples.
+   * @param[out]    *pDst points to the numCeps cepstral coefficients, or numMels log mel energies.
+   * @return none.
+   */
+
+  void arm_mfcc_q15(
+  arm_mfcc_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst);
+
+  /**
+   * @brief Floating-point vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_add_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q7 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_add_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q15 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_add_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q31 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_add_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Floating-point vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_sub_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q7 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_sub_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q15 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_sub_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q31 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_sub_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Multiplies a floating-point vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scale scale factor to be applied
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void arm_scale_f32(
+  float32_t * pSrc,
   float32_t scale,
   float32_t * pDst,
   uint32_t blockSize);
@@ -3516,214 +4341,649 @@ void arm_rfft_fast_f32(
   } arm_fir_interpolate_instance_q31;
 
   /**
-   * @brief Instance structure for the floating-point FIR interpolator.
+   * @brief Instance structure for the floating-point FIR interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                     /**< upsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
+  } arm_fir_interpolate_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 FIR interpolator.
+   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_interpolate_q15(
+  const arm_fir_interpolate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR interpolator.
+   * @param[in,out] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  arm_status arm_fir_interpolate_init_q15(
+  arm_fir_interpolate_instance_q15 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR interpolator.
+   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_interpolate_q31(
+  const arm_fir_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR interpolator.
+   * @param[in,out] *S        points to an instance of the Q31 FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  arm_status arm_fir_interpolate_init_q31(
+  arm_fir_interpolate_instance_q31 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR interpolator.
+   * @param[in] *S        points to an instance of the floating-point FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_interpolate_f32(
+  const arm_fir_interpolate_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR interpolator.
+   * @param[in,out] *S        points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  arm_status arm_fir_interpolate_init_f32(
+  arm_fir_interpolate_instance_f32 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 rational FIR resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t phase;                 /**< position of the next output in the upsampled signal, from the oldest new input. */
+    q15_t *pCoeffs;              /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;               /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point rational FIR resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t phase;                 /**< position of the next output in the upsampled signal, from the oldest new input. */
+    float32_t *pCoeffs;          /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;           /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 Farrow FIR resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of coefficients of each filter. */
+    uint16_t order;                 /**< order of the polynomial in the fractional position. */
+    int8_t postShift;               /**< left shift of the output, the coefficients are scaled down by 2^postShift. */
+    uint32_t step;                  /**< input samples per output sample, in Q8.24 format. May be changed at any time. */
+    uint32_t pos;                   /**< position of the next output in Q8.24 format, from the oldest new input. */
+    q15_t *pCoeffs;              /**< points to the coefficient array. The array is of length (order+1)*numTaps. */
+    q15_t *pState;               /**< points to the state variable array. The array is of length blockSize+numTaps-1. */
+  } arm_fir_farrow_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point Farrow FIR resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of coefficients of each filter. */
+    uint16_t order;                 /**< order of the polynomial in the fractional position. */
+    uint32_t step;                  /**< input samples per output sample, in Q8.24 format. May be changed at any time. */
+    uint32_t pos;                   /**< position of the next output in Q8.24 format, from the oldest new input. */
+    float32_t *pCoeffs;          /**< points to the coefficient array. The array is of length (order+1)*numTaps. */
+    float32_t *pState;           /**< points to the state variable array. The array is of length blockSize+numTaps-1. */
+  } arm_fir_farrow_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 rational FIR resampler.
+   * @param[in,out] *S points to an instance of the Q15 rational FIR resampler structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of output data, with room for blockSize*L/M+1 samples.
+   * @param[in]     blockSize number of input samples to process.
+   * @return        number of output samples.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 rational FIR resampler.
+   * @param[in,out] *S points to an instance of the Q15 rational FIR resampler structure.
+   * @param[in]     L upsample factor.
+   * @param[in]     M downsample factor.
+   * @param[in]     numTaps number of filter coefficients in the filter, a multiple of L.
+   * @param[in]     *pCoeffs points to the filter coefficient buffer.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   *                L or M is 0 or numTaps is not a multiple of L.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 Farrow FIR resampler.
+   * @param[in,out] *S points to an instance of the Q15 Farrow FIR resampler structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of output data, with room for blockSize*2^24/step+1 samples.
+   * @param[in]     blockSize number of input samples to process.
+   * @return        number of output samples.
+   */
+  uint32_t arm_fir_farrow_q15(
+  arm_fir_farrow_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 Farrow FIR resampler.
+   * @param[in,out] *S points to an instance of the Q15 Farrow FIR resampler structure.
+   * @param[in]     numTaps number of coefficients of each filter.
+   * @param[in]     order order of the polynomial in the fractional position.
+   * @param[in]     *pCoeffs points to the (order+1)*numTaps filter coefficients.
+   * @param[in]     postShift left shift of the output, the coefficients are scaled down by 2^postShift.
+   * @param[in]     step input samples per output sample, in Q8.24 format.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   *                an argument is out of range.
+   */
+  arm_status arm_fir_farrow_init_q15(
+  arm_fir_farrow_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t order,
+  q15_t * pCoeffs,
+  int8_t postShift,
+  uint32_t step,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point rational FIR resampler.
+   * @param[in,out] *S points to an instance of the floating-point rational FIR resampler structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of output data, with room for blockSize*L/M+1 samples.
+   * @param[in]     blockSize number of input samples to process.
+   * @return        number of output samples.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point rational FIR resampler.
+   * @param[in,out] *S points to an instance of the floating-point rational FIR resampler structure.
+   * @param[in]     L upsample factor.
+   * @param[in]     M downsample factor.
+   * @param[in]     numTaps number of filter coefficients in the filter, a multiple of L.
+   * @param[in]     *pCoeffs points to the filter coefficient buffer.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   *                L or M is 0 or numTaps is not a multiple of L.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point Farrow FIR resampler.
+   * @param[in,out] *S points to an instance of the floating-point Farrow FIR resampler structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of output data, with room for blockSize*2^24/step+1 samples.
+   * @param[in]     blockSize number of input samples to process.
+   * @return        number of output samples.
+   */
+  uint32_t arm_fir_farrow_f32(
+  arm_fir_farrow_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point Farrow FIR resampler.
+   * @param[in,out] *S points to an instance of the floating-point Farrow FIR resampler structure.
+   * @param[in]     numTaps number of coefficients of each filter.
+   * @param[in]     order order of the polynomial in the fractional position.
+   * @param[in]     *pCoeffs points to the (order+1)*numTaps filter coefficients.
+   * @param[in]     step input samples per output sample, in Q8.24 format.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   *                an argument is out of range.
+   */
+  arm_status arm_fir_farrow_init_f32(
+  arm_fir_farrow_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t order,
+  float32_t * pCoeffs,
+  uint32_t step,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cas_df1_32x64_q31(
+  const arm_biquad_cas_df1_32x64_ins_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cas_df1_32x64_init_q31(
+  arm_biquad_cas_df1_32x64_ins_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
+
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df2T_init_f32(
+  arm_biquad_cascade_df2T_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief Instance structure for the Q31 transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;         /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df2T_instance_q31;
+
+
+  /**
+   * @brief Processing function for the Q31 transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df2T_q31(
+  const arm_biquad_cascade_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df2T_init_q31(
+  arm_biquad_cascade_df2T_instance_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
+
+  /**
+   * @brief Instance structure for the Q15 transposed direct form II Biquad cascade filter.
    */
 
   typedef struct
   {
-    uint8_t L;                     /**< upsample factor. */
-    uint16_t phaseLength;          /**< length of each polyphase filter component. */
-    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
-    float32_t *pState;              /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
-  } arm_fir_interpolate_instance_f32;
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    q15_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;          /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df2T_instance_q15;
 
 
   /**
-   * @brief Processing function for the Q15 FIR interpolator.
-   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
+   * @brief Processing function for the Q15 transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
    * @return none.
    */
 
-  void arm_fir_interpolate_q15(
-  const arm_fir_interpolate_instance_q15 * S,
+  void arm_biquad_cascade_df2T_q15(
+  const arm_biquad_cascade_df2T_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Initialization function for the Q15 FIR interpolator.
-   * @param[in,out] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief  Initialization function for the Q15 transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format.
+   * @return        none
    */
 
-  arm_status arm_fir_interpolate_init_q15(
-  arm_fir_interpolate_instance_q15 * S,
-  uint8_t L,
-  uint16_t numTaps,
+  void arm_biquad_cascade_df2T_init_q15(
+  arm_biquad_cascade_df2T_instance_q15 * S,
+  uint8_t numStages,
   q15_t * pCoeffs,
-  q15_t * pState,
-  uint32_t blockSize);
-
-  /**
-   * @brief Processing function for the Q31 FIR interpolator.
-   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none.
-   */
-
-  void arm_fir_interpolate_q31(
-  const arm_fir_interpolate_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+  q63_t * pState,
+  int8_t postShift);
 
   /**
-   * @brief  Initialization function for the Q31 FIR interpolator.
-   * @param[in,out] *S        points to an instance of the Q31 FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief Instance structure for the floating-point multichannel transposed direct form II Biquad cascade filter.
    */
 
-  arm_status arm_fir_interpolate_init_q31(
-  arm_fir_interpolate_instance_q31 * S,
-  uint8_t L,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_mc_df2T_instance_f32;
 
 
   /**
-   * @brief Processing function for the floating-point FIR interpolator.
-   * @param[in] *S        points to an instance of the floating-point FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
+   * @brief Processing function for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of interleaved input data.
+   * @param[out] *pDst     points to the block of interleaved output data
+   * @param[in]  blockSize number of samples to process per channel.
    * @return none.
    */
 
-  void arm_fir_interpolate_f32(
-  const arm_fir_interpolate_instance_f32 * S,
+  void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
   float32_t * pSrc,
   float32_t * pDst,
   uint32_t blockSize);
 
+
   /**
-   * @brief  Initialization function for the floating-point FIR interpolator.
-   * @param[in,out] *S        points to an instance of the floating-point FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief  Initialization function for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
    */
 
-  arm_status arm_fir_interpolate_init_f32(
-  arm_fir_interpolate_instance_f32 * S,
-  uint8_t L,
-  uint16_t numTaps,
+  void arm_biquad_cascade_mc_df2T_init_f32(
+  arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
   float32_t * pCoeffs,
-  float32_t * pState,
-  uint32_t blockSize);
+  float32_t * pState);
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief Instance structure for the Q31 multichannel transposed direct form II Biquad cascade filter.
    */
 
   typedef struct
   {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-
-  } arm_biquad_cas_df1_32x64_ins_q31;
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    q63_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;         /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_mc_df2T_instance_q31;
 
 
   /**
-   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
+   * @brief Processing function for the Q31 multichannel transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of interleaved input data.
+   * @param[out] *pDst     points to the block of interleaved output data
+   * @param[in]  blockSize number of samples to process per channel.
    * @return none.
    */
 
-  void arm_biquad_cas_df1_32x64_q31(
-  const arm_biquad_cas_df1_32x64_ins_q31 * S,
+  void arm_biquad_cascade_mc_df2T_q31(
+  const arm_biquad_cascade_mc_df2T_instance_q31 * S,
   q31_t * pSrc,
   q31_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @brief  Initialization function for the Q31 multichannel transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
    * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
    * @param[in]     *pCoeffs     points to the filter coefficients.
    * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format.
    * @return        none
    */
 
-  void arm_biquad_cas_df1_32x64_init_q31(
-  arm_biquad_cas_df1_32x64_ins_q31 * S,
+  void arm_biquad_cascade_mc_df2T_init_q31(
+  arm_biquad_cascade_mc_df2T_instance_q31 * S,
   uint8_t numStages,
+  uint16_t numChannels,
   q31_t * pCoeffs,
   q63_t * pState,
   uint8_t postShift);
 
-
-
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Instance structure for the Q15 multichannel transposed direct form II Biquad cascade filter.
    */
 
   typedef struct
   {
     uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_df2T_instance_f32;
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    q63_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    q15_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;          /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_mc_df2T_instance_q15;
 
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Processing function for the Q15 multichannel transposed direct form II Biquad cascade filter.
    * @param[in]  *S        points to an instance of the filter data structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
+   * @param[in]  *pSrc     points to the block of interleaved input data.
+   * @param[out] *pDst     points to the block of interleaved output data
+   * @param[in]  blockSize number of samples to process per channel.
    * @return none.
    */
 
-  void arm_biquad_cascade_df2T_f32(
-  const arm_biquad_cascade_df2T_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
+  void arm_biquad_cascade_mc_df2T_q15(
+  const arm_biquad_cascade_mc_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief  Initialization function for the Q15 multichannel transposed direct form II Biquad cascade filter.
    * @param[in,out] *S           points to an instance of the filter data structure.
    * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
    * @param[in]     *pCoeffs     points to the filter coefficients.
    * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format.
    * @return        none
    */
 
-  void arm_biquad_cascade_df2T_init_f32(
-  arm_biquad_cascade_df2T_instance_f32 * S,
+  void arm_biquad_cascade_mc_df2T_init_q15(
+  arm_biquad_cascade_mc_df2T_instance_q15 * S,
   uint8_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q63_t * pState,
+  int8_t postShift);
 
 
 
@@ -5000,27 +6260,402 @@ void arm_rfft_fast_f32(
     S->state[0] = in;
     S->state[2] = out;
 
-    /* return to application */
-    return (out);
+    /* return to application */
+    return (out);
+
+  }
+
+  /**
+   * @} end of PID group
+   */
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  *src points to the instance of the input floating-point matrix structure.
+   * @param[out] *dst points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_inverse_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  *pSrc points to the symmetric positive definite input matrix structure.
+   * @param[out] *pDst points to the output matrix structure for L, may be pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_SINGULAR if the input matrix is not positive definite and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point solve with a Cholesky decomposition.
+   * @param[in]  *pL points to the matrix structure of L.
+   * @param[in]  *pB points to the right hand side matrix structure.
+   * @param[out] *pX points to the solution matrix structure, may be pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the sizes do not match,
+   * ARM_MATH_SINGULAR if L has a zero on its diagonal and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+  /**
+   * @brief Q31 Cholesky decomposition.
+   * @param[in]  *pSrc points to the symmetric positive definite input matrix structure.
+   * @param[out] *pDst points to the output matrix structure for L, may be pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_SINGULAR if the input matrix is not positive definite and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Q31 solve with a Cholesky decomposition.
+   * @param[in]  *pL points to the matrix structure of L.
+   * @param[in]  *pB points to the right hand side matrix structure.
+   * @param[out] *pX points to the solution matrix structure, may be pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the sizes do not match,
+   * ARM_MATH_SINGULAR if L has a zero on its diagonal and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_cholesky_solve_q31(
+  const arm_matrix_instance_q31 * pL,
+  const arm_matrix_instance_q31 * pB,
+  arm_matrix_instance_q31 * pX);
+
+  /**
+   * @brief Floating-point LDL' decomposition with symmetric pivoting.
+   * @param[in]  *pSrc   points to the symmetric input matrix structure.
+   * @param[out] *pDst   points to the output matrix structure for L and D, may be pSrc.
+   * @param[out] *pPivot points to the row swaps, an array of numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_SINGULAR if the input matrix is singular and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPivot);
+
+  /**
+   * @brief Floating-point solve with an LDL' decomposition.
+   * @param[in]  *pLD    points to the matrix structure of L and D.
+   * @param[in]  *pPivot points to the row swaps.
+   * @param[in]  *pB     points to the right hand side matrix structure.
+   * @param[out] *pX     points to the solution matrix structure, may be pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the sizes do not match,
+   * ARM_MATH_SINGULAR if D has a zero on its diagonal and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pLD,
+  const uint16_t * pPivot,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+  /**
+   * @brief Q31 LDL' decomposition with symmetric pivoting.
+   * @param[in]  *pSrc   points to the symmetric input matrix structure.
+   * @param[out] *pDst   points to the output matrix structure for L and D, may be pSrc.
+   * @param[out] *pPivot points to the row swaps, an array of numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_SINGULAR if the input matrix is singular and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_ldlt_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst,
+  uint16_t * pPivot);
+
+  /**
+   * @brief Q31 solve with an LDL' decomposition.
+   * @param[in]  *pLD    points to the matrix structure of L and D.
+   * @param[in]  *pPivot points to the row swaps.
+   * @param[in]  *pB     points to the right hand side matrix structure.
+   * @param[out] *pX     points to the solution matrix structure, may be pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the sizes do not match,
+   * ARM_MATH_SINGULAR if D has a zero on its diagonal and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_ldlt_solve_q31(
+  const arm_matrix_instance_q31 * pLD,
+  const uint16_t * pPivot,
+  const arm_matrix_instance_q31 * pB,
+  arm_matrix_instance_q31 * pX);
+
+  /**
+   * @brief Floating-point LU decomposition with partial pivoting.
+   * @param[in]  *pSrc   points to the input matrix structure.
+   * @param[out] *pDst   points to the output matrix structure for L and U, may be pSrc.
+   * @param[out] *pPivot points to the row swaps, an array of numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_SINGULAR if the input matrix is singular and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPivot);
+
+  /**
+   * @brief Floating-point solve with an LU decomposition.
+   * @param[in]  *pLU    points to the matrix structure of L and U.
+   * @param[in]  *pPivot points to the row swaps.
+   * @param[in]  *pB     points to the right hand side matrix structure.
+   * @param[out] *pX     points to the solution matrix structure, may be pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the sizes do not match,
+   * ARM_MATH_SINGULAR if U has a zero on its diagonal and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pLU,
+  const uint16_t * pPivot,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+  /**
+   * @brief Q31 LU decomposition with partial pivoting.
+   * @param[in]  *pSrc   points to the input matrix structure.
+   * @param[out] *pDst   points to the output matrix structure for L and U, may be pSrc.
+   * @param[out] *pPivot points to the row swaps, an array of numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_SINGULAR if the input matrix is singular and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_lu_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst,
+  uint16_t * pPivot);
+
+  /**
+   * @brief Q31 solve with an LU decomposition.
+   * @param[in]  *pLU    points to the matrix structure of L and U.
+   * @param[in]  *pPivot points to the row swaps.
+   * @param[in]  *pB     points to the right hand side matrix structure.
+   * @param[out] *pX     points to the solution matrix structure, may be pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the sizes do not match,
+   * ARM_MATH_SINGULAR if U has a zero on its diagonal and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_lu_solve_q31(
+  const arm_matrix_instance_q31 * pLU,
+  const uint16_t * pPivot,
+  const arm_matrix_instance_q31 * pB,
+  arm_matrix_instance_q31 * pX);
+
+  /**
+   * @brief Floating-point QR decomposition by Householder reflections.
+   * @param[in]  *pSrc points to the input matrix structure, with at least as many rows as columns.
+   * @param[out] *pDst points to the output matrix structure for R and the reflections, may be pSrc.
+   * @param[out] *pTau points to the reflection factors, an array of numCols values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not of the same size
+   * or have more columns than rows, and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau);
+
+  /**
+   * @brief Floating-point least squares solve with a QR decomposition.
+   * @param[in]     *pQR  points to the matrix structure of R and the reflections.
+   * @param[in]     *pTau points to the reflection factors.
+   * @param[in,out] *pB   points to the right hand side matrix structure, overwritten with Q' * B.
+   * @param[out]    *pX   points to the solution matrix structure, may share the data of pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the sizes do not match,
+   * ARM_MATH_SINGULAR if R has a zero on its diagonal and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pQR,
+  const float32_t * pTau,
+  arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+  /**
+   * @brief Q31 QR decomposition by Householder reflections.
+   * @param[in]  *pSrc points to the input matrix structure, with at least as many rows as columns.
+   * @param[out] *pDst points to the output matrix structure for R and the reflections, may be pSrc.
+   * @param[out] *pTau points to the reflection factors divided by 2, an array of numCols values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not of the same size
+   * or have more columns than rows, and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_qr_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst,
+  q31_t * pTau);
+
+  /**
+   * @brief Q31 least squares solve with a QR decomposition.
+   * @param[in]     *pQR  points to the matrix structure of R and the reflections.
+   * @param[in]     *pTau points to the reflection factors.
+   * @param[in,out] *pB   points to the right hand side matrix structure, overwritten with Q' * B.
+   * @param[out]    *pX   points to the solution matrix structure, may share the data of pB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the sizes do not match,
+   * ARM_MATH_SINGULAR if R has a zero on its diagonal and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_qr_solve_q31(
+  const arm_matrix_instance_q31 * pQR,
+  const q31_t * pTau,
+  arm_matrix_instance_q31 * pB,
+  arm_matrix_instance_q31 * pX);
+
+
+  /**
+   * @brief Number of values in the work buffer of a Kalman filter with N states and M measurements.
+   */
+#define ARM_KALMAN_WORK_SIZE(N, M) \
+  ((((N) * ((N) + 1u)) > ((M) * ((2u * (N)) + (M) + 1u))) ? \
+   ((N) * ((N) + 1u)) : ((M) * ((2u * (N)) + (M) + 1u)))
+
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStates;        /**< number of state variables N. */
+    uint16_t numMeas;          /**< number of measurements M. */
+    float32_t *pF;             /**< points to the N x N state transition matrix. */
+    float32_t *pQ;             /**< points to the N x N process noise covariance. */
+    float32_t *pH;             /**< points to the M x N measurement matrix. */
+    float32_t *pR;             /**< points to the M x M measurement noise covariance. */
+    float32_t *pX;             /**< points to the state estimate of N values. */
+    float32_t *pP;             /**< points to the N x N estimate covariance. */
+    float32_t *pWork;          /**< points to the work buffer of ARM_KALMAN_WORK_SIZE(N, M) values. */
+  } arm_kalman_instance_f32;
 
-  }
+  /**
+   * @brief Instance structure for the Q31 Kalman filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStates;        /**< number of state variables N. */
+    uint16_t numMeas;          /**< number of measurements M. */
+    q31_t *pF;                 /**< points to the N x N state transition matrix divided by 2^postShift. */
+    q31_t *pQ;                 /**< points to the N x N process noise covariance. */
+    q31_t *pH;                 /**< points to the M x N measurement matrix divided by 2^postShift. */
+    q31_t *pR;                 /**< points to the M x M measurement noise covariance. */
+    q31_t *pX;                 /**< points to the state estimate of N values. */
+    q31_t *pP;                 /**< points to the N x N estimate covariance. */
+    q31_t *pWork;              /**< points to the work buffer of ARM_KALMAN_WORK_SIZE(N, M) values. */
+    uint8_t postShift;         /**< number of bits F and H are shifted down by. */
+  } arm_kalman_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[in,out] *S          points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     numStates   number of state variables N.
+   * @param[in]     numMeas     number of measurements M.
+   * @param[in]     *pF         points to the N x N state transition matrix.
+   * @param[in]     *pQ         points to the N x N process noise covariance.
+   * @param[in]     *pH         points to the M x N measurement matrix.
+   * @param[in]     *pR         points to the M x M measurement noise covariance.
+   * @param[in]     *pX         points to the state estimate of N values.
+   * @param[in]     *pP         points to the N x N estimate covariance.
+   * @param[in]     *pWork      points to a work buffer of ARM_KALMAN_WORK_SIZE(N, M) values.
+   * @return The function returns ARM_MATH_ARGUMENT_ERROR if numStates or numMeas is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pF,
+  float32_t * pQ,
+  float32_t * pH,
+  float32_t * pR,
+  float32_t * pX,
+  float32_t * pP,
+  float32_t * pWork);
+
+  /**
+   * @brief  Prediction step of the floating-point Kalman filter.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @return none.
+   */
+
+  void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S);
+
+  /**
+   * @brief  Measurement update step of the floating-point Kalman filter.
+   * @param[in,out] *S  points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     *pZ points to the measurement vector of numMeas values.
+   * @return The function returns ARM_MATH_SINGULAR if the innovation covariance is not
+   * positive definite and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ);
+
+  /**
+   * @brief  Initialization function for the Q31 Kalman filter.
+   * @param[in,out] *S          points to an instance of the Q31 Kalman filter structure.
+   * @param[in]     numStates   number of state variables N.
+   * @param[in]     numMeas     number of measurements M.
+   * @param[in]     *pF         points to the N x N state transition matrix divided by 2^postShift.
+   * @param[in]     *pQ         points to the N x N process noise covariance.
+   * @param[in]     *pH         points to the M x N measurement matrix divided by 2^postShift.
+   * @param[in]     *pR         points to the M x M measurement noise covariance.
+   * @param[in]     *pX         points to the state estimate of N values.
+   * @param[in]     *pP         points to the N x N estimate covariance.
+   * @param[in]     *pWork      points to a work buffer of ARM_KALMAN_WORK_SIZE(N, M) values.
+   * @param[in]     postShift   number of bits F and H are shifted down by, at most 15.
+   * @return The function returns ARM_MATH_ARGUMENT_ERROR if numStates or numMeas is zero or postShift is above 15,
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_kalman_init_q31(
+  arm_kalman_instance_q31 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  q31_t * pF,
+  q31_t * pQ,
+  q31_t * pH,
+  q31_t * pR,
+  q31_t * pX,
+  q31_t * pP,
+  q31_t * pWork,
+  uint8_t postShift);
 
   /**
-   * @} end of PID group
+   * @brief  Prediction step of the Q31 Kalman filter.
+   * @param[in,out] *S points to an instance of the Q31 Kalman filter structure.
+   * @return none.
    */
 
+  void arm_kalman_predict_q31(
+  arm_kalman_instance_q31 * S);
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  *src points to the instance of the input floating-point matrix structure.
-   * @param[out] *dst points to the instance of the output floating-point matrix structure.
-   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   * @brief  Measurement update step of the Q31 Kalman filter.
+   * @param[in,out] *S  points to an instance of the Q31 Kalman filter structure.
+   * @param[in]     *pZ points to the measurement vector of numMeas values.
+   * @return The function returns ARM_MATH_SINGULAR if the innovation covariance is not
+   * positive definite and ARM_MATH_SUCCESS otherwise.
    */
 
-  arm_status arm_mat_inverse_f32(
-  const arm_matrix_instance_f32 * src,
-  arm_matrix_instance_f32 * dst);
+  arm_status arm_kalman_update_q31(
+  arm_kalman_instance_q31 * S,
+  q31_t * pZ);
 
 
 
@@ -5982,12 +7617,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0u;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6000,7 +7636,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (int32_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6082,13 +7718,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6101,7 +7738,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q15_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6184,13 +7821,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6203,7 +7841,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q7_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6697,6 +8335,322 @@ void arm_rfft_fast_f32(
   float32_t * pResult,
   uint32_t * pIndex);
 
+  /**
+   * @brief Instance structure for the floating-point moving statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                 /**< number of samples in the window. */
+    uint16_t count;                     /**< number of samples in the window so far. */
+    uint16_t writeIndex;                /**< delay line slot of the next sample. */
+    uint16_t maxHead;                   /**< front of the maximum deque. */
+    uint16_t maxCount;                  /**< length of the maximum deque. */
+    uint16_t minHead;                   /**< front of the minimum deque. */
+    uint16_t minCount;                  /**< length of the minimum deque. */
+    uint16_t renormCount;               /**< samples since the mean and the squared deviations were recomputed. */
+    float32_t mean;                     /**< mean of the window. */
+    float32_t m2;                       /**< sum of the squared deviations from the mean. */
+    float32_t *pState;                  /**< points to the delay line of length windowLen. */
+    uint16_t *pDeque;                   /**< points to the deques of length 2 * windowLen, maximum then minimum. */
+  } arm_moving_stats_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point moving statistics.
+   * @param[in,out] *S points to an instance of the floating-point moving statistics structure.
+   * @param[in]     windowLen number of samples in the window.
+   * @param[in]     *pState points to the delay line of windowLen samples.
+   * @param[in]     *pDeque points to the deque buffer of 2 * windowLen indices.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is 0.
+   */
+
+  arm_status arm_moving_stats_init_f32(
+  arm_moving_stats_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pState,
+  uint16_t * pDeque);
+
+  /**
+   * @brief  Adds a block of samples to the floating-point moving statistics window.
+   * @param[in,out] *S points to an instance of the floating-point moving statistics structure.
+   * @param[in]     *pSrc points to the block of new samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_moving_stats_update_f32(
+  arm_moving_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Mean of the floating-point moving statistics window.
+   * @param[in]  *S points to an instance of the floating-point moving statistics structure.
+   * @param[out] *pResult mean returned here.
+   * @return none.
+   */
+
+  void arm_moving_mean_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult);
+
+  /**
+   * @brief  Variance of the floating-point moving statistics window.
+   * @param[in]  *S points to an instance of the floating-point moving statistics structure.
+   * @param[out] *pResult variance returned here.
+   * @return none.
+   */
+
+  void arm_moving_var_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult);
+
+  /**
+   * @brief  Root mean square of the floating-point moving statistics window.
+   * @param[in]  *S points to an instance of the floating-point moving statistics structure.
+   * @param[out] *pResult root mean square returned here.
+   * @return none.
+   */
+
+  void arm_moving_rms_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult);
+
+  /**
+   * @brief  Maximum of the floating-point moving statistics window.
+   * @param[in]  *S points to an instance of the floating-point moving statistics structure.
+   * @param[out] *pResult maximum value returned here.
+   * @param[out] *pIndex position of the maximum in the window returned here, 0 for the oldest sample.
+   * @return none.
+   */
+
+  void arm_moving_max_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Minimum of the floating-point moving statistics window.
+   * @param[in]  *S points to an instance of the floating-point moving statistics structure.
+   * @param[out] *pResult minimum value returned here.
+   * @param[out] *pIndex position of the minimum in the window returned here, 0 for the oldest sample.
+   * @return none.
+   */
+
+  void arm_moving_min_f32(
+  const arm_moving_stats_instance_f32 * S,
+  float32_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief Instance structure for the Q31 moving statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                 /**< number of samples in the window. */
+    uint16_t count;                     /**< number of samples in the window so far. */
+    uint16_t writeIndex;                /**< delay line slot of the next sample. */
+    uint16_t maxHead;                   /**< front of the maximum deque. */
+    uint16_t maxCount;                  /**< length of the maximum deque. */
+    uint16_t minHead;                   /**< front of the minimum deque. */
+    uint16_t minCount;                  /**< length of the minimum deque. */
+    q63_t sum;                          /**< sum of the window. */
+    q63_t sumSq;                        /**< sum of the squares of the window, in 18.46 format. */
+    q31_t *pState;                      /**< points to the delay line of length windowLen. */
+    uint16_t *pDeque;                   /**< points to the deques of length 2 * windowLen, maximum then minimum. */
+  } arm_moving_stats_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 moving statistics.
+   * @param[in,out] *S points to an instance of the Q31 moving statistics structure.
+   * @param[in]     windowLen number of samples in the window.
+   * @param[in]     *pState points to the delay line of windowLen samples.
+   * @param[in]     *pDeque points to the deque buffer of 2 * windowLen indices.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is 0.
+   */
+
+  arm_status arm_moving_stats_init_q31(
+  arm_moving_stats_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState,
+  uint16_t * pDeque);
+
+  /**
+   * @brief  Adds a block of samples to the Q31 moving statistics window.
+   * @param[in,out] *S points to an instance of the Q31 moving statistics structure.
+   * @param[in]     *pSrc points to the block of new samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_moving_stats_update_q31(
+  arm_moving_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Mean of the Q31 moving statistics window.
+   * @param[in]  *S points to an instance of the Q31 moving statistics structure.
+   * @param[out] *pResult mean returned here.
+   * @return none.
+   */
+
+  void arm_moving_mean_q31(
+  const arm_moving_stats_instance_q31 * S,
+  q31_t * pResult);
+
+  /**
+   * @brief  Variance of the Q31 moving statistics window.
+   * @param[in]  *S points to an instance of the Q31 moving statistics structure.
+   * @param[out] *pResult variance returned here.
+   * @return none.
+   */
+
+  void arm_moving_var_q31(
+  const arm_moving_stats_instance_q31 * S,
+  q31_t * pResult);
+
+  /**
+   * @brief  Root mean square of the Q31 moving statistics window.
+   * @param[in]  *S points to an instance of the Q31 moving statistics structure.
+   * @param[out] *pResult root mean square returned here.
+   * @return none.
+   */
+
+  void arm_moving_rms_q31(
+  const arm_moving_stats_instance_q31 * S,
+  q31_t * pResult);
+
+  /**
+   * @brief  Maximum of the Q31 moving statistics window.
+   * @param[in]  *S points to an instance of the Q31 moving statistics structure.
+   * @param[out] *pResult maximum value returned here.
+   * @param[out] *pIndex position of the maximum in the window returned here, 0 for the oldest sample.
+   * @return none.
+   */
+
+  void arm_moving_max_q31(
+  const arm_moving_stats_instance_q31 * S,
+  q31_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Minimum of the Q31 moving statistics window.
+   * @param[in]  *S points to an instance of the Q31 moving statistics structure.
+   * @param[out] *pResult minimum value returned here.
+   * @param[out] *pIndex position of the minimum in the window returned here, 0 for the oldest sample.
+   * @return none.
+   */
+
+  void arm_moving_min_q31(
+  const arm_moving_stats_instance_q31 * S,
+  q31_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief Instance structure for the Q15 moving statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                 /**< number of samples in the window. */
+    uint16_t count;                     /**< number of samples in the window so far. */
+    uint16_t writeIndex;                /**< delay line slot of the next sample. */
+    uint16_t maxHead;                   /**< front of the maximum deque. */
+    uint16_t maxCount;                  /**< length of the maximum deque. */
+    uint16_t minHead;                   /**< front of the minimum deque. */
+    uint16_t minCount;                  /**< length of the minimum deque. */
+    q63_t sum;                          /**< sum of the window. */
+    q63_t sumSq;                        /**< sum of the squares of the window, in 34.30 format. */
+    q15_t *pState;                      /**< points to the delay line of length windowLen. */
+    uint16_t *pDeque;                   /**< points to the deques of length 2 * windowLen, maximum then minimum. */
+  } arm_moving_stats_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 moving statistics.
+   * @param[in,out] *S points to an instance of the Q15 moving statistics structure.
+   * @param[in]     windowLen number of samples in the window.
+   * @param[in]     *pState points to the delay line of windowLen samples.
+   * @param[in]     *pDeque points to the deque buffer of 2 * windowLen indices.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is 0.
+   */
+
+  arm_status arm_moving_stats_init_q15(
+  arm_moving_stats_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pState,
+  uint16_t * pDeque);
+
+  /**
+   * @brief  Adds a block of samples to the Q15 moving statistics window.
+   * @param[in,out] *S points to an instance of the Q15 moving statistics structure.
+   * @param[in]     *pSrc points to the block of new samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+
+  void arm_moving_stats_update_q15(
+  arm_moving_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Mean of the Q15 moving statistics window.
+   * @param[in]  *S points to an instance of the Q15 moving statistics structure.
+   * @param[out] *pResult mean returned here.
+   * @return none.
+   */
+
+  void arm_moving_mean_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult);
+
+  /**
+   * @brief  Variance of the Q15 moving statistics window.
+   * @param[in]  *S points to an instance of the Q15 moving statistics structure.
+   * @param[out] *pResult variance returned here.
+   * @return none.
+   */
+
+  void arm_moving_var_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult);
+
+  /**
+   * @brief  Root mean square of the Q15 moving statistics window.
+   * @param[in]  *S points to an instance of the Q15 moving statistics structure.
+   * @param[out] *pResult root mean square returned here.
+   * @return none.
+   */
+
+  void arm_moving_rms_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult);
+
+  /**
+   * @brief  Maximum of the Q15 moving statistics window.
+   * @param[in]  *S points to an instance of the Q15 moving statistics structure.
+   * @param[out] *pResult maximum value returned here.
+   * @param[out] *pIndex position of the maximum in the window returned here, 0 for the oldest sample.
+   * @return none.
+   */
+
+  void arm_moving_max_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Minimum of the Q15 moving statistics window.
+   * @param[in]  *S points to an instance of the Q15 moving statistics structure.
+   * @param[out] *pResult minimum value returned here.
+   * @param[out] *pIndex position of the minimum in the window returned here, 0 for the oldest sample.
+   * @return none.
+   */
+
+  void arm_moving_min_q15(
+  const arm_moving_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex);
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  *pSrcA points to the first input vector
@@ -6842,6 +8796,361 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Number of values in the im2col buffer of a convolution layer.
+   */
+#define ARM_NN_CONV_BUFFER_SIZE(CH_IN, DIM_KERNEL) \
+  (2u * (CH_IN) * (DIM_KERNEL) * (DIM_KERNEL))
+
+  /**
+   * @brief Q7 fully-connected layer.
+   * @param[in]  *pSrc      points to the input vector of dimVec values.
+   * @param[in]  *pWeights  points to the weights, numRows rows of dimVec values.
+   * @param[in]  dimVec     length of the input vector.
+   * @param[in]  numRows    number of outputs.
+   * @param[in]  biasShift  left shift of the bias.
+   * @param[in]  outShift   right shift of the outputs.
+   * @param[in]  *pBias     points to the numRows bias values.
+   * @param[out] *pDst      points to the numRows outputs.
+   * @param[in]  *pBuffer   points to a buffer of dimVec values.
+   * @return none.
+   */
+  void arm_nn_fully_connected_q7(
+  q7_t * pSrc,
+  q7_t * pWeights,
+  uint16_t dimVec,
+  uint16_t numRows,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pBias,
+  q7_t * pDst,
+  q15_t * pBuffer);
+
+  /**
+   * @brief Q15 fully-connected layer.
+   * @param[in]  *pSrc      points to the input vector of dimVec values.
+   * @param[in]  *pWeights  points to the weights, numRows rows of dimVec values.
+   * @param[in]  dimVec     length of the input vector.
+   * @param[in]  numRows    number of outputs.
+   * @param[in]  biasShift  left shift of the bias.
+   * @param[in]  outShift   right shift of the outputs.
+   * @param[in]  *pBias     points to the numRows bias values.
+   * @param[out] *pDst      points to the numRows outputs.
+   * @return none.
+   */
+  void arm_nn_fully_connected_q15(
+  q15_t * pSrc,
+  q15_t * pWeights,
+  uint16_t dimVec,
+  uint16_t numRows,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pBias,
+  q15_t * pDst);
+
+  /**
+   * @brief Q7 convolution layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x chIn values.
+   * @param[in]  dimIn      width and height of the input image.
+   * @param[in]  chIn       number of input channels.
+   * @param[in]  *pWeights  points to the weights, chOut x dimKernel x dimKernel x chIn values.
+   * @param[in]  chOut      number of output channels.
+   * @param[in]  dimKernel  width and height of the kernel.
+   * @param[in]  padding    zero padding on each side of the input.
+   * @param[in]  stride     step of the kernel.
+   * @param[in]  *pBias     points to the chOut bias values.
+   * @param[in]  biasShift  left shift of the bias.
+   * @param[in]  outShift   right shift of the outputs.
+   * @param[out] *pDst      points to the output image, dimOut x dimOut x chOut values.
+   * @param[in]  *pBuffer   points to a buffer of ARM_NN_CONV_BUFFER_SIZE(chIn, dimKernel) values.
+   * @return none.
+   */
+  void arm_nn_conv_hwc_q7(
+  q7_t * pSrc,
+  uint16_t dimIn,
+  uint16_t chIn,
+  q7_t * pWeights,
+  uint16_t chOut,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q7_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pDst,
+  q15_t * pBuffer);
+
+  /**
+   * @brief Q15 convolution layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x chIn values.
+   * @param[in]  dimIn      width and height of the input image.
+   * @param[in]  chIn       number of input channels.
+   * @param[in]  *pWeights  points to the weights, chOut x dimKernel x dimKernel x chIn values.
+   * @param[in]  chOut      number of output channels.
+   * @param[in]  dimKernel  width and height of the kernel.
+   * @param[in]  padding    zero padding on each side of the input.
+   * @param[in]  stride     step of the kernel.
+   * @param[in]  *pBias     points to the chOut bias values.
+   * @param[in]  biasShift  left shift of the bias.
+   * @param[in]  outShift   right shift of the outputs.
+   * @param[out] *pDst      points to the output image, dimOut x dimOut x chOut values.
+   * @param[in]  *pBuffer   points to a buffer of ARM_NN_CONV_BUFFER_SIZE(chIn, dimKernel) values.
+   * @return none.
+   */
+  void arm_nn_conv_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t chIn,
+  q15_t * pWeights,
+  uint16_t chOut,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q15_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pDst,
+  q15_t * pBuffer);
+
+  /**
+   * @brief Q7 pointwise (1 x 1) convolution layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x chIn values.
+   * @param[in]  dimIn      width and height of the input and output images.
+   * @param[in]  chIn       number of input channels.
+   * @param[in]  *pWeights  points to the weights, chOut x chIn values.
+   * @param[in]  chOut      number of output channels.
+   * @param[in]  *pBias     points to the chOut bias values.
+   * @param[in]  biasShift  left shift of the bias.
+   * @param[in]  outShift   right shift of the outputs.
+   * @param[out] *pDst      points to the output image, dimIn x dimIn x chOut values.
+   * @param[in]  *pBuffer   points to a buffer of ARM_NN_CONV_BUFFER_SIZE(chIn, 1) values.
+   * @return none.
+   */
+  void arm_nn_conv_1x1_hwc_q7(
+  q7_t * pSrc,
+  uint16_t dimIn,
+  uint16_t chIn,
+  q7_t * pWeights,
+  uint16_t chOut,
+  q7_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pDst,
+  q15_t * pBuffer);
+
+  /**
+   * @brief Q15 pointwise (1 x 1) convolution layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x chIn values.
+   * @param[in]  dimIn      width and height of the input and output images.
+   * @param[in]  chIn       number of input channels.
+   * @param[in]  *pWeights  points to the weights, chOut x chIn values.
+   * @param[in]  chOut      number of output channels.
+   * @param[in]  *pBias     points to the chOut bias values.
+   * @param[in]  biasShift  left shift of the bias.
+   * @param[in]  outShift   right shift of the outputs.
+   * @param[out] *pDst      points to the output image, dimIn x dimIn x chOut values.
+   * @return none.
+   */
+  void arm_nn_conv_1x1_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t chIn,
+  q15_t * pWeights,
+  uint16_t chOut,
+  q15_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pDst);
+
+  /**
+   * @brief Q7 depthwise convolution layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x ch values.
+   * @param[in]  dimIn      width and height of the input image.
+   * @param[in]  ch         number of input and output channels.
+   * @param[in]  *pWeights  points to the weights, dimKernel x dimKernel x ch values.
+   * @param[in]  dimKernel  width and height of the kernel.
+   * @param[in]  padding    zero padding on each side of the input.
+   * @param[in]  stride     step of the kernel.
+   * @param[in]  *pBias     points to the ch bias values.
+   * @param[in]  biasShift  left shift of the bias.
+   * @param[in]  outShift   right shift of the outputs.
+   * @param[out] *pDst      points to the output image, dimOut x dimOut x ch values.
+   * @return none.
+   */
+  void arm_nn_depthwise_conv_hwc_q7(
+  q7_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  q7_t * pWeights,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q7_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q7_t * pDst);
+
+  /**
+   * @brief Q15 depthwise convolution layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x ch values.
+   * @param[in]  dimIn      width and height of the input image.
+   * @param[in]  ch         number of input and output channels.
+   * @param[in]  *pWeights  points to the weights, dimKernel x dimKernel x ch values.
+   * @param[in]  dimKernel  width and height of the kernel.
+   * @param[in]  padding    zero padding on each side of the input.
+   * @param[in]  stride     step of the kernel.
+   * @param[in]  *pBias     points to the ch bias values.
+   * @param[in]  biasShift  left shift of the bias.
+   * @param[in]  outShift   right shift of the outputs.
+   * @param[out] *pDst      points to the output image, dimOut x dimOut x ch values.
+   * @return none.
+   */
+  void arm_nn_depthwise_conv_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  q15_t * pWeights,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q15_t * pBias,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pDst);
+
+  /**
+   * @brief Q7 max pooling layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x ch values.
+   * @param[in]  dimIn      width and height of the input image.
+   * @param[in]  ch         number of channels.
+   * @param[in]  dimKernel  width and height of the window.
+   * @param[in]  padding    padding on each side of the input.
+   * @param[in]  stride     step of the window.
+   * @param[out] *pDst      points to the output image, dimOut x dimOut x ch values.
+   * @return none.
+   */
+  void arm_nn_maxpool_hwc_q7(
+  q7_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q7_t * pDst);
+
+  /**
+   * @brief Q7 average pooling layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x ch values.
+   * @param[in]  dimIn      width and height of the input image.
+   * @param[in]  ch         number of channels.
+   * @param[in]  dimKernel  width and height of the window.
+   * @param[in]  padding    padding on each side of the input.
+   * @param[in]  stride     step of the window.
+   * @param[out] *pDst      points to the output image, dimOut x dimOut x ch values.
+   * @return none.
+   */
+  void arm_nn_avgpool_hwc_q7(
+  q7_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q7_t * pDst);
+
+  /**
+   * @brief Q15 max pooling layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x ch values.
+   * @param[in]  dimIn      width and height of the input image.
+   * @param[in]  ch         number of channels.
+   * @param[in]  dimKernel  width and height of the window.
+   * @param[in]  padding    padding on each side of the input.
+   * @param[in]  stride     step of the window.
+   * @param[out] *pDst      points to the output image, dimOut x dimOut x ch values.
+   * @return none.
+   */
+  void arm_nn_maxpool_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q15_t * pDst);
+
+  /**
+   * @brief Q15 average pooling layer.
+   * @param[in]  *pSrc      points to the input image, dimIn x dimIn x ch values.
+   * @param[in]  dimIn      width and height of the input image.
+   * @param[in]  ch         number of channels.
+   * @param[in]  dimKernel  width and height of the window.
+   * @param[in]  padding    padding on each side of the input.
+   * @param[in]  stride     step of the window.
+   * @param[out] *pDst      points to the output image, dimOut x dimOut x ch values.
+   * @return none.
+   */
+  void arm_nn_avgpool_hwc_q15(
+  q15_t * pSrc,
+  uint16_t dimIn,
+  uint16_t ch,
+  uint16_t dimKernel,
+  uint16_t padding,
+  uint16_t stride,
+  q15_t * pDst);
+
+  /**
+   * @brief Q7 rectified linear unit.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector, which may be pSrc.
+   * @param[in]  blockSize  number of values in the vectors.
+   * @return none.
+   */
+  void arm_nn_relu_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q15 rectified linear unit.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector, which may be pSrc.
+   * @param[in]  blockSize  number of values in the vectors.
+   * @return none.
+   */
+  void arm_nn_relu_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q7 softmax with base 2.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector, which may be pSrc.
+   * @param[in]  blockSize  number of values in the vectors.
+   * @param[in]  fracBits   fractional bits of the input, up to 7.
+   * @return none.
+   */
+  void arm_nn_softmax_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize,
+  uint16_t fracBits);
+
+  /**
+   * @brief Q15 softmax with base 2.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector, which may be pSrc.
+   * @param[in]  blockSize  number of values in the vectors.
+   * @param[in]  fracBits   fractional bits of the input, up to 15.
+   * @return none.
+   */
+  void arm_nn_softmax_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint16_t fracBits);
+
+
   /**
    * @ingroup groupInterpolation
    */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2014 Silicon Laboratories, Inc. All rights reserved.
+*
+* $Date:        14. May 2014
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_math_host.h
+*
+* Description:  Core definitions used when the library is built for the
+*               host machine with ARM_MATH_HOST defined
+*
+* Target Processor: Host (Cortex-M3/Cortex-M0 code paths)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_MATH_HOST_H
+#define _ARM_MATH_HOST_H
+
+#include <stdint.h>
+
+/*
+ * The host build runs the Cortex-M3 code paths of the library unless the
+ * Cortex-M0 code paths are asked for. The Cortex-M4 code paths are the same
+ * as the Cortex-M3 ones, only with the SIMD intrinsics done in hardware, so
+ * they are built as Cortex-M3 code paths with the C intrinsics of arm_math.h.
+ */
+#if defined (ARM_MATH_CM4)
+#undef ARM_MATH_CM4
+#endif
+
+#if !defined (ARM_MATH_CM3) && !defined (ARM_MATH_CM0) && !defined (ARM_MATH_CM0PLUS)
+#define ARM_MATH_CM3
+#endif
+
+#ifndef __GNUC__
+#error "ARM_MATH_HOST needs a GCC compatible compiler"
+#endif
+
+#define __ASM            __asm
+#define __INLINE         inline
+#define __STATIC_INLINE  static inline
+
+#define __FPU_USED       0
+
+#if defined (ARM_MATH_CM3)
+
+  /*
+   * @brief C versions of the Cortex-M3 instructions used by the library.
+   * The Cortex-M0 code paths get their own versions from arm_math.h.
+   */
+
+  /*
+   * @brief C version of SSAT, saturates to a signed value of y bits.
+   */
+  static __INLINE int32_t __SSAT(
+  int32_t x,
+  uint32_t y)
+  {
+    const int32_t posMax = (int32_t) ((1u << (y - 1u)) - 1u);
+    const int32_t negMin = -posMax - 1;
+
+    if(x > posMax)
+    {
+      x = posMax;
+    }
+    else if(x < negMin)
+    {
+      x = negMin;
+    }
+
+    return (x);
+  }
+
+  /*
+   * @brief C version of USAT, saturates to an unsigned value of y bits.
+   */
+  static __INLINE uint32_t __USAT(
+  int32_t x,
+  uint32_t y)
+  {
+    const int32_t posMax = (int32_t) ((1u << y) - 1u);
+
+    if(x > posMax)
+    {
+      x = posMax;
+    }
+    else if(x < 0)
+    {
+      x = 0;
+    }
+
+    return ((uint32_t) x);
+  }
+
+  /*
+   * @brief C version of CLZ, counts the leading zeros of a 32 bit value.
+   */
+  static __INLINE uint32_t __CLZ(
+  uint32_t data)
+  {
+    return ((data == 0u) ? 32u : (uint32_t) __builtin_clz(data));
+  }
+
+  /*
+   * @brief C version of ROR, rotates a 32 bit value right.
+   */
+  static __INLINE uint32_t __ROR(
+  uint32_t op1,
+  uint32_t op2)
+  {
+    op2 &= 31u;
+    return ((op2 == 0u) ? op1 : ((op1 >> op2) | (op1 << (32u - op2))));
+  }
+
+#endif /* defined (ARM_MATH_CM3) */
+
+#endif /* _ARM_MATH_HOST_H */
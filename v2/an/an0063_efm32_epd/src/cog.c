@@ -239,10 +239,28 @@ void sendDummyLine(void)
  * 
  **********************************************************/
 void sendFrame(uint8_t *frameBuffer)
+{
+  sendLines(frameBuffer, epdConfig.verticalSize);
+}
+
+
+/**********************************************************
+ * Sends a number of lines to the COG driver. Each line
+ * selects the panel line it is written to with its 
+ * scan bytes, so the lines do not have to be
+ * consecutive. 
+ * 
+ * @param frameBuffer
+ *   Pointer to the COG/EPD lines
+ * 
+ * @param numLines
+ *   Number of lines in frameBuffer
+ **********************************************************/
+void sendLines(uint8_t *frameBuffer, int numLines)
 {
   int i;
   
-  for ( i=0; i<epdConfig.verticalSize; i++ )
+  for ( i=0; i<numLines; i++ )
   {
     /* Set chargepump voltage level */
     spiSend1(0x04, epdConfig.voltageLevel);
@@ -338,15 +356,31 @@ void sendNothingFrame(void)
  *   Pointer to the COG/EPD frame buffer
  **********************************************************/
 void updateStage(uint8_t *frameBuffer)
+{
+  updateStageLines(frameBuffer, epdConfig.verticalSize);
+}
+
+/**********************************************************
+ * Sends a number of lines multiple times to the COG
+ * driver, for the same time as updateStage(). Used to
+ * update only the lines of the panel that changed. 
+ * 
+ * @param frameBuffer
+ *   Pointer to the COG/EPD lines
+ * 
+ * @param numLines
+ *   Number of lines in frameBuffer
+ **********************************************************/
+void updateStageLines(uint8_t *frameBuffer, int numLines)
 {
   /* Calculate the stage time in ms */
   uint32_t endTime = getTempAdjustedStageTime(epdConfig.stageTime);
   
-  /* Resend the frame for the entire stage time */
+  /* Resend the lines for the entire stage time */
   rtcStart();
   do 
   {
-    sendFrame(frameBuffer);
+    sendLines(frameBuffer, numLines);
   }
   while ( rtcGetMs() < endTime );
   rtcStop();
@@ -67,9 +67,11 @@ typedef struct _EPD_Config
 
 
 void sendFrame(uint8_t *frameBuffer);
+void sendLines(uint8_t *frameBuffer, int numLines);
 void cogInit(void);
 void cogPowerUp(void);
 void cogPowerOff(void);
 void updateStage(uint8_t *frameBuffer);
+void updateStageLines(uint8_t *frameBuffer, int numLines);
 
 #endif
@@ -53,6 +53,9 @@ uint8_t oldFrame[FRAME_SIZE];
  * in the format expected by the COG */
 uint8_t epdFrame[PANEL_FRAME_SIZE];
 
+/* Numbers of the lines that changed since the last update */
+uint8_t changedLines[PANEL_HEIGHT];
+
 /* The frame buffer used by emWin */
 uint8_t emwinFrameBuffer[EMWIN_FRAME_SIZE];
 
@@ -155,3 +158,57 @@ void showImage(void)
    * for the next panel update. */
   memcpy(oldFrame, newFrame, FRAME_SIZE);
 }
+
+/**********************************************************
+ * Displays the current frame buffer on the EPD panel, 
+ * like showImage(), but only the lines which differ 
+ * from the previous frame are generated and driven. 
+ * The panel is not powered up at all if nothing has
+ * changed. Lines which are not driven keep their 
+ * image, use showImage() now and then to refresh the
+ * whole panel. 
+ **********************************************************/
+void showImagePartial(void)
+{
+  int i;
+  int numLines;
+
+  /* Copy the current emWin buffer */
+  copyFromEmwinBuffer();
+  
+  /* Find the lines that need to be updated */
+  numLines = findChangedLines(oldFrame, newFrame, changedLines);
+  if ( numLines == 0 )
+  {
+    return;
+  }
+  
+  /* Power up the panel and COG driver */
+  cogPowerUp();
+  
+  /* Initialize the COG */
+  cogInit();
+  
+  /* Loop through the 4 stages, only the changed lines are
+   * generated and transmitted */
+  for ( i=1; i<=4; i++ )
+  {  
+    /* Run off HFXO while generating lines */
+    CMU_ClockSelectSet(cmuClock_HF, cmuSelect_HFXO);
+    
+    /* Generate EPD lines from the old and new frame buffers and current stage */
+    generateLines(oldFrame, newFrame, epdFrame, i, changedLines, numLines);
+    
+    /* Run off HFRCO while transmitting */
+    CMU_ClockSelectSet(cmuClock_HF, cmuSelect_HFRCO);
+    
+    /* Send the EPD lines to the COG */
+    updateStageLines(epdFrame, numLines);
+  }
+  
+  /* Power down the COG and panel */
+  cogPowerOff();
+
+  /* Keep the newly transmitted frame */
+  memcpy(oldFrame, newFrame, FRAME_SIZE);
+}
@@ -35,5 +35,6 @@
 
 void epdInit(void);
 void showImage(void);
+void showImagePartial(void);
 
 #endif
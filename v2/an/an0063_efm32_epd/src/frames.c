@@ -43,6 +43,17 @@
 
 extern EPD_Config epdConfig;
 
+/* Lookup tables which convert one byte (8 pixels) of a frame buffer to
+ * one byte (4 pixels) of EPD data for the current stage. evenLut holds
+ * the odd numbered pixels of the byte in descending order, as sent in
+ * the first half of a line. oddLut holds the even numbered pixels in
+ * ascending order, as sent in the second half of a line. */
+static uint8_t evenLut[256];
+static uint8_t oddLut[256];
+
+/* The stage the lookup tables are built for, 0 if not built */
+static int lutStage = 0;
+
 
 /**********************************************************
  * Helper function to create one pixel for the EPD
@@ -89,6 +100,105 @@ uint8_t createPixel(int oldPixel, int newPixel, int stage)
   while (1);
 }
 
+/**********************************************************
+ * Builds the lookup tables for the given stage. The EPD
+ * pixels are created by createPixel, the tables only
+ * let generateLine convert a whole byte in one step.
+ * 
+ * @param stage
+ *   The current stage number (1-4)
+ **********************************************************/
+static void buildStageLut(int stage)
+{
+  int value, i;
+  uint8_t px, evenPx, oddPx;
+  
+  if ( lutStage == stage )
+  {
+    return;
+  }
+  
+  for ( value=0; value<256; value++ )
+  {
+    evenPx = 0;
+    oddPx = 0;
+    
+    for ( i=0; i<4; i++ )
+    {
+      /* Pixel 7-2i goes to bit position 6-2i in the even byte */
+      px = (value >> (7 - 2*i)) & 0x1;
+      evenPx |= createPixel(px, px, stage) << (6 - 2*i);
+      
+      /* Pixel 2i goes to bit position 6-2i in the odd byte */
+      px = (value >> (2*i)) & 0x1;
+      oddPx |= createPixel(px, px, stage) << (6 - 2*i);
+    }
+    
+    evenLut[value] = evenPx;
+    oddLut[value] = oddPx;
+  }
+  
+  lutStage = stage;
+}
+
+/**********************************************************
+ * Generates one line of an EPD frame with the lookup
+ * tables of the current stage. 
+ * 
+ * @param frame
+ *   The frame buffer used by the current stage
+ * 
+ * @param y
+ *   The line number
+ * 
+ * @param outLine
+ *   The EPD line is put in this buffer
+ * 
+ * @returns
+ *   Pointer to the byte following the generated line
+ **********************************************************/
+static uint8_t *generateLine(uint8_t *frame, int y, uint8_t *outLine)
+{
+  /* Get width and height from the configuration */
+  int bytesPerLine = epdConfig.horizontalSize / 8;
+  int height       = epdConfig.verticalSize;
+  
+  /* The pixels of line y in the frame buffer */
+  uint8_t *pixels = frame + y * bytesPerLine;
+  int i;
+  
+  /* Border byte check */
+  if ( epdConfig.borderByte )
+  {
+    *outLine++ = 0x00;
+  }
+  
+  /* Even pixels, starting with the rightmost */
+  for ( i=bytesPerLine-1; i>=0; i-- )
+  {
+    *outLine++ = evenLut[pixels[i]];
+  }
+  
+  /* The scan line should have 0b11 at the current line and 0 for the rest. */
+  memset(outLine, 0, height / 4);
+  outLine[y / 4] = 0x3 << (6 - (y%4)*2);
+  outLine += height / 4;
+  
+  /* Odd pixels, starting with the leftmost */
+  for ( i=0; i<bytesPerLine; i++ )
+  {
+    *outLine++ = oddLut[pixels[i]];
+  }
+  
+  /* Add dummy byte if needed */
+  if ( epdConfig.dummyByte )
+  {
+    *outLine++ = 0x00; 
+  }
+  
+  return outLine;
+}
+
 /**********************************************************
  * Generates an EPD frame from the supplied stage number
  * and the two frame buffers in memory. During stage
@@ -111,117 +221,85 @@ uint8_t createPixel(int oldPixel, int newPixel, int stage)
  **********************************************************/
 void generateFrame(uint8_t *oldFrame, uint8_t *newFrame, uint8_t *outFrame, int stage)
 {
-  /* Temp variable for pixel EPD pixel data. 2 bits per pixel. */
-  uint8_t epdPx;
-  
-  /* Temp variables for frame buffer pixel data. 1 bit per pixel */
-  uint8_t oldPx, newPx;
-
-  /* Screen coordinates */
-  int x, y;
+  /* Stages 1 and 2 only care about old image, 3 and 4 about new image */
+  uint8_t *frame = stage <= 2 ? oldFrame : newFrame;
+  int y;
   
-  /* Number of shifts to perform when saving the EPD pixel to buffer */
-  int shifts;
+  buildStageLut(stage);
   
-  /* Used to calculate position of the current line in the scan line array */
-  uint8_t scanByte, scanShift;
-  
-  /* Get width and height from the configuration */
-  int width  =  epdConfig.horizontalSize;
-  int height =  epdConfig.verticalSize;
-  
-  /* Clear frame */
-  memset(outFrame, 0, PANEL_FRAME_SIZE);
+  for ( y=0; y<epdConfig.verticalSize; y++ )
+  {
+    outFrame = generateLine(frame, y, outFrame);
+  }
+}
+
+/**********************************************************
+ * Finds the lines which differ between the old and
+ * the new frame buffer. 
+ * 
+ * @param oldFrame
+ *   The old (previous) frame buffer
+ * 
+ * @param newFrame
+ *   The new frame buffer (to be displayed)
+ * 
+ * @param lines
+ *   The numbers of the changed lines are put in this
+ *   buffer. Must have room for one entry per line. 
+ * 
+ * @returns
+ *   The number of changed lines
+ **********************************************************/
+int findChangedLines(uint8_t *oldFrame, uint8_t *newFrame, uint8_t *lines)
+{
+  int bytesPerLine = epdConfig.horizontalSize / 8;
+  int numLines = 0;
+  int y;
   
-  y = 0;
-  while ( y < height )
+  for ( y=0; y<epdConfig.verticalSize; y++ )
   {
-    /* Border byte check */
-    if ( epdConfig.borderByte )
+    if ( memcmp(oldFrame + y * bytesPerLine, newFrame + y * bytesPerLine, bytesPerLine) != 0 )
     {
-      *outFrame++ = 0x00;
+      lines[numLines++] = y;
     }
-    
-    /* Start at rightmost pixel */
-    x = width - 1;
-    
-    /* Start writing to the upper 2 bits of the byte (MSB) */
-    shifts = 6;
+  }
   
-    /* Generate even pixels, starting with the rightmost */
-    while ( x > 0 )
-    {
-      /* Extract pixel at (x,y) from old frame */
-      oldPx = (oldFrame[y * width/8 + x/8] >> (x%8)) & 0x1;
-      
-      /* Extract pixel at (x,y) from new frame */
-      newPx = (newFrame[y * width/8 + x/8] >> (x%8)) & 0x1;
-      
-      /* Generate EPD pixel based on old and new pixel and current stage */
-      epdPx = createPixel(oldPx, newPx, stage);
-
-      /* Write pixel to EPD frame */
-      *outFrame |= epdPx << shifts;
-
-      /* Get next even pixel */
-      x -= 2;
-      
-      /* Decrease shift. If current byte is full, move to the next */
-      shifts -= 2;
-      if ( shifts < 0 )
-      {
-        shifts = 6;
-        outFrame++;
-      }
-    }
-    
-    /* Calculate the position of the current line in the scan lines buffer. */
-    scanByte = y / 4;
-    scanShift = 6 - (y%4)*2;
-    
-    /* The scan line should have 0b11 at the current line and 0 for the rest. */
-    *(outFrame + scanByte) = 0x3 << scanShift;
-    
-    /* Skip over all the scan bytes */
-    outFrame += height / 4;
-    
-    /* Start at leftmost pixel */
-    x = 0;
-    
-    /* Generate odd pixels, starting with the leftmost */
-    while ( x < width )
-    {
-      /* Extract pixel at (x,y) from old frame */
-      oldPx = (oldFrame[y * width/8 + x/8] >> (x%8)) & 0x1;
-      
-      /* Extract pixel at (x,y) from new frame */
-      newPx = (newFrame[y * width/8 + x/8] >> (x%8)) & 0x1;
-      
-      /* Generate EPD pixel based on old and new pixel and current stage */
-      epdPx = createPixel(oldPx, newPx, stage);
+  return numLines;
+}
 
-      /* Write pixel to EPD frame */
-      *outFrame |= epdPx << shifts;
-      
-      /* Get next odd pixel */
-      x += 2;
-      
-      /* Decrease shift. If current byte is full, move to the next */
-      shifts -= 2;
-      if ( shifts < 0 )
-      {
-        shifts = 6;
-        outFrame++;
-      }
-    }
-    
-    /* Add dummy byte if needed */
-    if ( epdConfig.dummyByte )
-    {
-      *outFrame++ = 0x00; 
-    }
-    
-    /* Move to the next line */
-    y++;
+/**********************************************************
+ * Generates the given lines of an EPD frame. The lines 
+ * are put after each other in outFrame, each line 
+ * carries its own scan byte and can be sent to the 
+ * COG with updateStageLines(). 
+ * 
+ * @param oldFrame
+ *   The old (previous) frame buffer
+ * 
+ * @param newFrame
+ *   The new frame buffer (to be displayed)
+ * 
+ * @param outFrame
+ *   The EPD lines are put in this buffer
+ * 
+ * @param stage
+ *   The current stage number (1-4)
+ * 
+ * @param lines
+ *   The numbers of the lines to generate
+ * 
+ * @param numLines
+ *   Number of lines to generate
+ **********************************************************/
+void generateLines(uint8_t *oldFrame, uint8_t *newFrame, uint8_t *outFrame, int stage, uint8_t *lines, int numLines)
+{
+  uint8_t *frame = stage <= 2 ? oldFrame : newFrame;
+  int i;
+  
+  buildStageLut(stage);
+  
+  for ( i=0; i<numLines; i++ )
+  {
+    outFrame = generateLine(frame, lines[i], outFrame);
   }
 }
@@ -34,5 +34,7 @@
 #define _FRAMES_H_
 
 void generateFrame(uint8_t *oldFrame, uint8_t *newFrame, uint8_t *outFrame, int stage);
+int findChangedLines(uint8_t *oldFrame, uint8_t *newFrame, uint8_t *lines);
+void generateLines(uint8_t *oldFrame, uint8_t *newFrame, uint8_t *outFrame, int stage, uint8_t *lines, int numLines);
 
 #endif
@@ -35,6 +35,9 @@ GLIB_Context_t gc;
 uint8_t palette[PALETTE_SIZE];
 uint8_t rgbBuffer[RGB_BUFFER_SIZE];
 
+/* Row cache, word aligned */
+uint32_t rowCache[ROW_CACHE_SIZE / 4];
+
 /* File to read bmp data from */
 FIL BMPfile;
 
@@ -98,11 +101,9 @@ EMSTATUS SLIDES_readData(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToR
  *****************************************************************************/
 void SLIDES_showBMP(char *fileName)
 {
-  int32_t  xCursor;
-  int32_t  yCursor;
-  uint32_t pixelsRead;
   uint32_t nPixelsPerRow;
   uint32_t nRows;
+  uint32_t scale;
 
   EMSTATUS status;
 
@@ -128,43 +129,21 @@ void SLIDES_showBMP(char *fileName)
   /* Get important BMP data */
   nPixelsPerRow = BMP_getWidth();
   nRows         = BMP_getHeight();
-  yCursor       = nRows - 1;
-  xCursor       = 0;
-
-  /* Check size of BMP */
-  if ((nPixelsPerRow > 320) || (nRows > 240))
-  {
-    SLIDES_showError(false, "Info:\n  %s is larger than 320x240.", fileName);
-  }
 
-  /* Set clipping region */
-  DMD_setClippingArea(0, 0, nPixelsPerRow, nRows);
+  /* Scale down BMPs which are larger than the display */
+  scale = 1;
+  while ((nPixelsPerRow / scale > 320) || (nRows / scale > 240))
+    scale++;
 
-  /* Read in and draw row for row */
-  while (yCursor >= 0)
+  /* Set row cache, rows are read and converted a whole row at a time */
+  if (BMP_setRowCache((uint8_t *) rowCache, ROW_CACHE_SIZE, scale) != BMP_OK)
   {
-    /* Read in row buffer */
-    status = BMP_readRgbData(rgbBuffer, RGB_BUFFER_SIZE, &pixelsRead);
-    if (status != BMP_OK || pixelsRead == 0)
-      break;
-
-    /* Draw row buffer. Remember, BMP is stored bottom-up */
-    status = DMD_writeData(xCursor, yCursor, rgbBuffer, pixelsRead);
-    if (status != DMD_OK)
-      break;
-
-    /* Update cursor */
-    xCursor += pixelsRead;
-    if ((uint32_t) xCursor >= nPixelsPerRow)
-    {
-      yCursor -= xCursor / nPixelsPerRow;
-      xCursor  = xCursor % nPixelsPerRow;
-    }
+    SLIDES_showError(false, "Info:\n  %s is too large.", fileName);
+    goto cleanup;
   }
-  /* Reset clipping area in DMD driver */
-  status = GLIB_resetDisplayClippingArea(&gc);
-  if (status != 0)
-    return;
+
+  /* Read in and draw row for row. The clipping area is reset when done */
+  BMP_drawToDisplay(0, 0, rgbBuffer, RGB_BUFFER_SIZE);
 
  cleanup:
   /* Close the file */
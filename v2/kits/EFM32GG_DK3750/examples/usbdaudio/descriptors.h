@@ -0,0 +1,333 @@
+/***************************************************************************//**
+ * @file descriptors.h
+ * @brief USB descriptors for USB audio device example project.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+EFM32_ALIGN(4)
+static const USB_DeviceDescriptor_TypeDef deviceDesc __attribute__ ((aligned(4)))=
+{
+  .bLength            = USB_DEVICE_DESCSIZE,
+  .bDescriptorType    = USB_DEVICE_DESCRIPTOR,
+  .bcdUSB             = 0x0200,
+  .bDeviceClass       = 0,
+  .bDeviceSubClass    = 0,
+  .bDeviceProtocol    = 0,
+  .bMaxPacketSize0    = USB_EP0_SIZE,
+  .idVendor           = 0x10C4,
+  .idProduct          = 0x0009,
+  .bcdDevice          = 0x0000,
+  .iManufacturer      = 1,
+  .iProduct           = 2,
+  .iSerialNumber      = 0,
+  .bNumConfigurations = 1
+};
+
+/* Audio class specific descriptor sizes. */
+#define AC_HEADER_DESCSIZE    ( 8 + 2 )  /* Two streaming interfaces.       */
+#define AC_IT_DESCSIZE        12
+#define AC_OT_DESCSIZE        9
+#define AC_FU_DESCSIZE        ( 7 + ( UACD_CHANNELS + 1 ) )
+#define AS_GENERAL_DESCSIZE   7
+#define AS_FORMAT_DESCSIZE    ( 8 + 3 )  /* One discrete sample rate.       */
+#define AS_EP_DESCSIZE        9          /* Audio class endpoint, 9 bytes.  */
+#define AS_CS_EP_DESCSIZE     7
+
+#define AC_TOTAL_DESCSIZE ( AC_HEADER_DESCSIZE   + \
+                            ( AC_IT_DESCSIZE * 2 ) + \
+                            ( AC_OT_DESCSIZE * 2 ) + \
+                            AC_FU_DESCSIZE )
+
+#define CONFIG_DESCSIZE ( USB_CONFIG_DESCSIZE                    + \
+                          ( USB_INTERFACE_DESCSIZE * 5 )         + \
+                          AC_TOTAL_DESCSIZE                      + \
+                          ( AS_GENERAL_DESCSIZE * 2 )            + \
+                          ( AS_FORMAT_DESCSIZE * 2 )             + \
+                          ( AS_EP_DESCSIZE * NUM_EP_USED )       + \
+                          ( AS_CS_EP_DESCSIZE * 2 ) )
+
+/* Format type I descriptor body, identical for speaker and microphone. */
+#define AS_FORMAT_TYPE_I                                                      \
+  AS_FORMAT_DESCSIZE,          /* bLength                                  */ \
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType                          */ \
+  UACD_AS_FORMAT_TYPE,         /* bDescriptorSubtype                       */ \
+  UACD_FORMAT_TYPE_I,          /* bFormatType                              */ \
+  UACD_CHANNELS,               /* bNrChannels                              */ \
+  2,                           /* bSubframeSize                            */ \
+  16,                          /* bBitResolution                           */ \
+  1,                           /* bSamFreqType, one discrete frequency     */ \
+  UACD_SAMPLE_RATE & 0xFF,     /* tSamFreq                                 */ \
+  ( UACD_SAMPLE_RATE >> 8 ) & 0xFF,                                           \
+  ( UACD_SAMPLE_RATE >> 16 ) & 0xFF
+
+/* Class specific isochronous audio data endpoint descriptor. */
+#define AS_CS_ENDPOINT                                                        \
+  AS_CS_EP_DESCSIZE,           /* bLength                                  */ \
+  USB_CS_ENDPOINT_DESCRIPTOR,  /* bDescriptorType                          */ \
+  UACD_EP_GENERAL,             /* bDescriptorSubtype                       */ \
+  UACD_EP_SAMPLING_FREQ_CONTROL,/* bmAttributes                            */ \
+  0,                           /* bLockDelayUnits                          */ \
+  0,                           /* wLockDelay (LSB)                         */ \
+  0                            /* wLockDelay (MSB)                         */
+
+EFM32_ALIGN(4)
+static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
+{
+  /*** Configuration descriptor ***/
+  USB_CONFIG_DESCSIZE,    /* bLength                                   */
+  USB_CONFIG_DESCRIPTOR,  /* bDescriptorType                           */
+  CONFIG_DESCSIZE,        /* wTotalLength (LSB)                        */
+  CONFIG_DESCSIZE>>8,     /* wTotalLength (MSB)                        */
+  NUM_INTERFACES,         /* bNumInterfaces                            */
+  1,                      /* bConfigurationValue                       */
+  0,                      /* iConfiguration                            */
+  CONFIG_DESC_BM_RESERVED_D7 |   /* bmAttrib: Self powered             */
+  CONFIG_DESC_BM_SELFPOWERED,
+  CONFIG_DESC_MAXPOWER_mA( 100 ),/* bMaxPower: 100 mA                  */
+
+  /*** Audio Control Interface descriptor (interface no. 0)          ***/
+  USB_INTERFACE_DESCSIZE, /* bLength               */
+  USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
+  UACD_AC_INTERFACE_NO,   /* bInterfaceNumber      */
+  0,                      /* bAlternateSetting     */
+  0,                      /* bNumEndpoints         */
+  USB_CLASS_AUDIO,        /* bInterfaceClass       */
+  USB_CLASS_AUDIO_CONTROL,/* bInterfaceSubClass    */
+  0,                      /* bInterfaceProtocol    */
+  0,                      /* iInterface            */
+
+  /*** Audio Control Header descriptor ***/
+  AC_HEADER_DESCSIZE,     /* bLength               */
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
+  UACD_AC_HEADER,         /* bDescriptorSubtype    */
+  0x00,                   /* bcdADC (LSB), 1.00    */
+  0x01,                   /* bcdADC (MSB)          */
+  AC_TOTAL_DESCSIZE,      /* wTotalLength (LSB)    */
+  AC_TOTAL_DESCSIZE>>8,   /* wTotalLength (MSB)    */
+  2,                      /* bInCollection         */
+  UACD_SPEAKER_INTERFACE_NO, /* baInterfaceNr(1)   */
+  UACD_MIC_INTERFACE_NO,  /* baInterfaceNr(2)      */
+
+  /*** Speaker path: USB streaming input terminal ***/
+  AC_IT_DESCSIZE,         /* bLength               */
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
+  UACD_AC_INPUT_TERMINAL, /* bDescriptorSubtype    */
+  UACD_IT_SPEAKER_ID,     /* bTerminalID           */
+  UACD_TERMINAL_USB_STREAMING & 0xFF, /* wTerminalType (LSB) */
+  UACD_TERMINAL_USB_STREAMING >> 8,   /* wTerminalType (MSB) */
+  0,                      /* bAssocTerminal        */
+  UACD_CHANNELS,          /* bNrChannels           */
+  0x03,                   /* wChannelConfig (LSB), left and right front */
+  0x00,                   /* wChannelConfig (MSB)  */
+  0,                      /* iChannelNames         */
+  0,                      /* iTerminal             */
+
+  /*** Speaker path: mute and volume feature unit ***/
+  AC_FU_DESCSIZE,         /* bLength               */
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
+  UACD_AC_FEATURE_UNIT,   /* bDescriptorSubtype    */
+  UACD_FU_SPEAKER_ID,     /* bUnitID               */
+  UACD_IT_SPEAKER_ID,     /* bSourceID             */
+  1,                      /* bControlSize          */
+  ( 1 << ( UACD_FU_MUTE_CONTROL   - 1 ) ) |  /* bmaControls(0), master */
+  ( 1 << ( UACD_FU_VOLUME_CONTROL - 1 ) ),   /* mute and volume.       */
+  0,                      /* bmaControls(1), left  */
+  0,                      /* bmaControls(2), right */
+  0,                      /* iFeature              */
+
+  /*** Speaker path: speaker output terminal ***/
+  AC_OT_DESCSIZE,         /* bLength               */
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
+  UACD_AC_OUTPUT_TERMINAL,/* bDescriptorSubtype    */
+  UACD_OT_SPEAKER_ID,     /* bTerminalID           */
+  UACD_TERMINAL_SPEAKER & 0xFF,       /* wTerminalType (LSB) */
+  UACD_TERMINAL_SPEAKER >> 8,         /* wTerminalType (MSB) */
+  0,                      /* bAssocTerminal        */
+  UACD_FU_SPEAKER_ID,     /* bSourceID             */
+  0,                      /* iTerminal             */
+
+  /*** Microphone path: line in input terminal ***/
+  AC_IT_DESCSIZE,         /* bLength               */
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
+  UACD_AC_INPUT_TERMINAL, /* bDescriptorSubtype    */
+  UACD_IT_MIC_ID,         /* bTerminalID           */
+  UACD_TERMINAL_LINE_IN & 0xFF,       /* wTerminalType (LSB) */
+  UACD_TERMINAL_LINE_IN >> 8,         /* wTerminalType (MSB) */
+  0,                      /* bAssocTerminal        */
+  UACD_CHANNELS,          /* bNrChannels           */
+  0x03,                   /* wChannelConfig (LSB), left and right front */
+  0x00,                   /* wChannelConfig (MSB)  */
+  0,                      /* iChannelNames         */
+  0,                      /* iTerminal             */
+
+  /*** Microphone path: USB streaming output terminal ***/
+  AC_OT_DESCSIZE,         /* bLength               */
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
+  UACD_AC_OUTPUT_TERMINAL,/* bDescriptorSubtype    */
+  UACD_OT_MIC_ID,         /* bTerminalID           */
+  UACD_TERMINAL_USB_STREAMING & 0xFF, /* wTerminalType (LSB) */
+  UACD_TERMINAL_USB_STREAMING >> 8,   /* wTerminalType (MSB) */
+  0,                      /* bAssocTerminal        */
+  UACD_IT_MIC_ID,         /* bSourceID             */
+  0,                      /* iTerminal             */
+
+  /*** Speaker Audio Streaming Interface, zero bandwidth (alt. 0)    ***/
+  USB_INTERFACE_DESCSIZE, /* bLength               */
+  USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
+  UACD_SPEAKER_INTERFACE_NO,/* bInterfaceNumber    */
+  0,                      /* bAlternateSetting     */
+  0,                      /* bNumEndpoints         */
+  USB_CLASS_AUDIO,        /* bInterfaceClass       */
+  USB_CLASS_AUDIO_STREAMING,/* bInterfaceSubClass  */
+  0,                      /* bInterfaceProtocol    */
+  0,                      /* iInterface            */
+
+  /*** Speaker Audio Streaming Interface, operational (alt. 1)       ***/
+  USB_INTERFACE_DESCSIZE, /* bLength               */
+  USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
+  UACD_SPEAKER_INTERFACE_NO,/* bInterfaceNumber    */
+  1,                      /* bAlternateSetting     */
+  2,                      /* bNumEndpoints         */
+  USB_CLASS_AUDIO,        /* bInterfaceClass       */
+  USB_CLASS_AUDIO_STREAMING,/* bInterfaceSubClass  */
+  0,                      /* bInterfaceProtocol    */
+  0,                      /* iInterface            */
+
+  /*** Audio Streaming General descriptor ***/
+  AS_GENERAL_DESCSIZE,    /* bLength               */
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
+  UACD_AS_GENERAL,        /* bDescriptorSubtype    */
+  UACD_IT_SPEAKER_ID,     /* bTerminalLink         */
+  1,                      /* bDelay                */
+  UACD_FORMAT_PCM & 0xFF, /* wFormatTag (LSB)      */
+  UACD_FORMAT_PCM >> 8,   /* wFormatTag (MSB)      */
+
+  AS_FORMAT_TYPE_I,
+
+  /*** Speaker isochronous data endpoint descriptor ***/
+  AS_EP_DESCSIZE,         /* bLength               */
+  USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
+  UACD_EP_OUT,            /* bEndpointAddress (OUT)*/
+  USB_EPTYPE_ISOC | USB_EPSYNC_ASYNC, /* bmAttributes */
+  UACD_EP_SIZE & 0xFF,    /* wMaxPacketSize (LSB)  */
+  UACD_EP_SIZE >> 8,      /* wMaxPacketSize (MSB)  */
+  1,                      /* bInterval             */
+  0,                      /* bRefresh              */
+  UACD_EP_FEEDBACK,       /* bSynchAddress         */
+
+  AS_CS_ENDPOINT,
+
+  /*** Speaker sample rate feedback endpoint descriptor ***/
+  AS_EP_DESCSIZE,         /* bLength               */
+  USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
+  UACD_EP_FEEDBACK,       /* bEndpointAddress (IN) */
+  USB_EPTYPE_ISOC | USB_EPUSAGE_FEEDBACK, /* bmAttributes */
+  UACD_FEEDBACK_SIZE,     /* wMaxPacketSize (LSB)  */
+  0,                      /* wMaxPacketSize (MSB)  */
+  1,                      /* bInterval             */
+  UACD_FEEDBACK_REFRESH,  /* bRefresh              */
+  0,                      /* bSynchAddress         */
+
+  /*** Microphone Audio Streaming Interface, zero bandwidth (alt. 0) ***/
+  USB_INTERFACE_DESCSIZE, /* bLength               */
+  USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
+  UACD_MIC_INTERFACE_NO,  /* bInterfaceNumber      */
+  0,                      /* bAlternateSetting     */
+  0,                      /* bNumEndpoints         */
+  USB_CLASS_AUDIO,        /* bInterfaceClass       */
+  USB_CLASS_AUDIO_STREAMING,/* bInterfaceSubClass  */
+  0,                      /* bInterfaceProtocol    */
+  0,                      /* iInterface            */
+
+  /*** Microphone Audio Streaming Interface, operational (alt. 1)    ***/
+  USB_INTERFACE_DESCSIZE, /* bLength               */
+  USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
+  UACD_MIC_INTERFACE_NO,  /* bInterfaceNumber      */
+  1,                      /* bAlternateSetting     */
+  1,                      /* bNumEndpoints         */
+  USB_CLASS_AUDIO,        /* bInterfaceClass       */
+  USB_CLASS_AUDIO_STREAMING,/* bInterfaceSubClass  */
+  0,                      /* bInterfaceProtocol    */
+  0,                      /* iInterface            */
+
+  /*** Audio Streaming General descriptor ***/
+  AS_GENERAL_DESCSIZE,    /* bLength               */
+  USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
+  UACD_AS_GENERAL,        /* bDescriptorSubtype    */
+  UACD_OT_MIC_ID,         /* bTerminalLink         */
+  1,                      /* bDelay                */
+  UACD_FORMAT_PCM & 0xFF, /* wFormatTag (LSB)      */
+  UACD_FORMAT_PCM >> 8,   /* wFormatTag (MSB)      */
+
+  AS_FORMAT_TYPE_I,
+
+  /*** Microphone isochronous data endpoint descriptor ***/
+  AS_EP_DESCSIZE,         /* bLength               */
+  USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
+  UACD_EP_IN,             /* bEndpointAddress (IN) */
+  USB_EPTYPE_ISOC | USB_EPSYNC_ASYNC, /* bmAttributes */
+  UACD_EP_SIZE & 0xFF,    /* wMaxPacketSize (LSB)  */
+  UACD_EP_SIZE >> 8,      /* wMaxPacketSize (MSB)  */
+  1,                      /* bInterval             */
+  0,                      /* bRefresh              */
+  0,                      /* bSynchAddress         */
+
+  AS_CS_ENDPOINT
+};
+
+STATIC_CONST_STRING_DESC_LANGID( langID, 0x04, 0x09 );
+STATIC_CONST_STRING_DESC( iManufacturer, 'S','i','l','i','c','o','n',' ','L', \
+                                         'a','b','o','r','a','t','o','r','i', \
+                                         'e','s',' ','I','n','c','.' );
+STATIC_CONST_STRING_DESC( iProduct     , 'E','F','M','3','2',' ','U','S','B', \
+                                         ' ','A','u','d','i','o',' ','d','e', \
+                                         'v','i','c','e' );
+
+static const void * const strings[] =
+{
+  &langID,
+  &iManufacturer,
+  &iProduct,
+};
+
+/* Endpoint buffer sizes */
+/* 1 = single buffer, 2 = double buffering, 3 = triple buffering ...  */
+/* Use double buffering on the audio data endpoints.                  */
+static const uint8_t bufferingMultiplier[ NUM_EP_USED + 1 ] = { 1, 2, 1, 2 };
+
+static const USBD_Callbacks_TypeDef callbacks =
+{
+  .usbReset        = NULL,
+  .usbStateChange  = UACD_StateChangeEvent,
+  .setupCmd        = UACD_SetupCmd,
+  .isSelfPowered   = NULL,
+  .sofInt          = UACD_SofInt
+};
+
+static const USBD_Init_TypeDef initstruct =
+{
+  .deviceDescriptor    = &deviceDesc,
+  .configDescriptor    = configDesc,
+  .stringDescriptors   = strings,
+  .numberOfStrings     = sizeof(strings)/sizeof(void*),
+  .callbacks           = &callbacks,
+  .bufferingMultiplier = bufferingMultiplier,
+  .reserved            = 0
+};
+
+#ifdef __cplusplus
+}
+#endif
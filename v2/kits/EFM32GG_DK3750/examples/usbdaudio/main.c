@@ -0,0 +1,84 @@
+/**************************************************************************//**
+ * @file main.c
+ * @brief USB audio device example project.
+ * @version 3.20.7
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#include "em_device.h"
+#include "em_cmu.h"
+#include "em_dma.h"
+#include "em_emu.h"
+#include "dmactrl.h"
+#include "em_usb.h"
+#include "uacd.h"
+#include "bsp.h"
+#include "bsp_trace.h"
+
+/**************************************************************************//**
+ *
+ * This example shows how a USB audio class 1.0 device can be implemented.
+ *
+ * The device is a 48 kHz 16 bit stereo speaker and microphone. Audio from
+ * the host is played on the DK audio out jack (DAC0), audio on the DK audio
+ * in jack (ADC0) is recorded and sent to the host.
+ *
+ * No driver installation is needed, the host operating system uses its
+ * built in USB audio class driver.
+ *
+ *****************************************************************************/
+
+/*** Include device descriptor definitions. ***/
+
+#include "descriptors.h"
+
+
+/**************************************************************************//**
+ * @brief main - the entrypoint after reset.
+ *****************************************************************************/
+int main( void )
+{
+  DMA_Init_TypeDef dmaInit;
+
+  BSP_Init( BSP_INIT_DEFAULT );   /* Initialize DK board register access */
+
+  /* If first word of user data page is non-zero, enable eA Profiler trace */
+  BSP_TraceProfilerSetup();
+
+  /* The sample rate timer runs from HFPERCLK, HFXO gives an exact rate. */
+  CMU_ClockSelectSet( cmuClock_HF, cmuSelect_HFXO );
+
+  /* Connect audio in/out to ADC/DAC */
+  BSP_PeripheralAccess( BSP_AUDIO_IN,  true );
+  BSP_PeripheralAccess( BSP_AUDIO_OUT, true );
+
+  CMU_ClockEnable( cmuClock_DMA, true );
+  dmaInit.hprot        = 0;
+  dmaInit.controlBlock = dmaControlBlock;
+  DMA_Init( &dmaInit );
+
+  UACD_Init();
+  USBD_Init( &initstruct );
+
+  /*
+   * When using a debugger it is practical to uncomment the following three
+   * lines to force host to re-enumerate the device.
+   */
+  /* USBD_Disconnect();      */
+  /* USBTIMER_DelayMs(1000); */
+  /* USBD_Connect();         */
+
+  for (;;)
+  {
+    /* All audio processing is done in interrupt context. */
+    EMU_EnterEM1();
+  }
+}
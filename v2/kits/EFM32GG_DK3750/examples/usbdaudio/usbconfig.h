@@ -0,0 +1,73 @@
+/***************************************************************************//**
+ * @file usbconfig.h
+ * @brief USB protocol stack library, application supplied configuration options.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifndef __USBCONFIG_H
+#define __USBCONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define USB_DEVICE        /* Compile stack for device mode. */
+
+/****************************************************************************
+**                                                                         **
+** Specify number of endpoints used (in addition to EP0).                  **
+**                                                                         **
+*****************************************************************************/
+#define NUM_EP_USED 3
+
+/****************************************************************************
+**                                                                         **
+** Specify number of application timers you need.                          **
+**                                                                         **
+*****************************************************************************/
+#define NUM_APP_TIMERS 1
+
+/****************************************************************************
+**                                                                         **
+** Audio function interface numbers, endpoints and entity id's.            **
+**                                                                         **
+*****************************************************************************/
+#define UACD_AC_INTERFACE_NO      ( 0 )
+#define UACD_SPEAKER_INTERFACE_NO ( 1 )
+#define UACD_MIC_INTERFACE_NO     ( 2 )
+#define NUM_INTERFACES            ( 3 )
+
+#define UACD_EP_OUT       ( 0x01 ) /* Speaker audio data from host.          */
+#define UACD_EP_FEEDBACK  ( 0x81 ) /* Speaker sample rate feedback to host.  */
+#define UACD_EP_IN        ( 0x82 ) /* Microphone audio data to host.         */
+
+#define UACD_IT_SPEAKER_ID  ( 1 )  /* USB streaming input terminal.          */
+#define UACD_FU_SPEAKER_ID  ( 2 )  /* Mute and volume feature unit.          */
+#define UACD_OT_SPEAKER_ID  ( 3 )  /* Speaker (DAC) output terminal.         */
+#define UACD_IT_MIC_ID      ( 4 )  /* Line in (ADC) input terminal.          */
+#define UACD_OT_MIC_ID      ( 5 )  /* USB streaming output terminal.         */
+
+/****************************************************************************
+**                                                                         **
+** Audio hardware resources, DMA channel 0 and 1 and PRS channel 0 are     **
+** the driver defaults.                                                    **
+**                                                                         **
+*****************************************************************************/
+#define UACD_DMA_DAC      ( 0 )
+#define UACD_DMA_ADC      ( 1 )
+#define UACD_PRS_CHANNEL  ( 0 )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBCONFIG_H */
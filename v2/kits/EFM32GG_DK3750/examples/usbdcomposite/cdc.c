@@ -20,6 +20,7 @@
 #include "em_gpio.h"
 #include "dmactrl.h"
 #include "em_usb.h"
+#include "em_usbdclass.h"
 #include "em_usart.h"
 #include "bsp.h"
 #include "cdc.h"
@@ -39,8 +40,11 @@
 
 /*** Typedef's and defines. ***/
 
-#define CDC_USB_RX_BUF_SIZ  CDC_BULK_EP_SIZE /* Packet size when receiving on USB */
-#define CDC_USB_TX_BUF_SIZ  127    /* Packet size when transmitting on USB.  */
+/* Endpoint addresses assigned by the composite device framework, in    */
+/* descriptor order.                                                      */
+#define CDC_EP_NOTIFY     ( cdcFn->epAddr[ 0 ] ) /* Notification endpoint. */
+#define CDC_EP_DATA_IN    ( cdcFn->epAddr[ 1 ] ) /* Data transmission.     */
+#define CDC_EP_DATA_OUT   ( cdcFn->epAddr[ 2 ] ) /* Data reception.        */
 
 /* Calculate a timeout in ms corresponding to 5 char times on current     */
 /* baudrate. Minimum timeout is set to 10 ms.                             */
@@ -65,6 +69,13 @@ EFM32_PACK_END()
 static int  UsbDataReceived(USB_Status_TypeDef status, uint32_t xferred,
                             uint32_t remaining);
 static void DmaSetup(void);
+static void PatchDescriptors( USBD_ClassFunction_TypeDef *fn,
+                              uint8_t *desc, int len );
+static int  SetupCmd( USBD_ClassFunction_TypeDef *fn,
+                      const USB_Setup_TypeDef *setup );
+static void StateChangeEvent( USBD_ClassFunction_TypeDef *fn,
+                              USBD_State_TypeDef oldState,
+                              USBD_State_TypeDef newState );
 static int  LineCodingReceived(USB_Status_TypeDef status,
                                uint32_t xferred,
                                uint32_t remaining);
@@ -85,13 +96,19 @@ static cdcLineCoding_TypeDef __attribute__ ((aligned(4))) cdcLineCoding =
 };
 EFM32_PACK_END()
 
-STATIC_UBUF(usbRxBuffer0,  CDC_USB_RX_BUF_SIZ);   /* USB receive buffers.   */
-STATIC_UBUF(usbRxBuffer1,  CDC_USB_RX_BUF_SIZ);
-STATIC_UBUF(uartRxBuffer0, CDC_USB_TX_BUF_SIZ);   /* UART receive buffers.  */
-STATIC_UBUF(uartRxBuffer1, CDC_USB_TX_BUF_SIZ);
+/** CDC class driver. */
+const USBD_ClassDriver_TypeDef CDC_Driver =
+{
+  .setupCmd         = SetupCmd,
+  .stateChange      = StateChangeEvent,
+  .sofInt           = NULL,
+  .patchDescriptors = PatchDescriptors
+};
+
+static USBD_ClassFunction_TypeDef *cdcFn;
 
-static const uint8_t  *usbRxBuffer[  2 ] = { usbRxBuffer0, usbRxBuffer1 };
-static const uint8_t  *uartRxBuffer[ 2 ] = { uartRxBuffer0, uartRxBuffer1 };
+static uint8_t        *usbRxBuffer[  2 ];   /* Application owned buffers. */
+static uint8_t        *uartRxBuffer[ 2 ];
 
 static int            usbRxIndex, usbBytesReceived;
 static int            uartRxIndex, uartRxCount;
@@ -107,24 +124,73 @@ static DMA_CB_TypeDef DmaRxCallBack;
 
 /**************************************************************************//**
  * @brief CDC device initialization.
+ *
+ * @param[in] fn
+ *   The CDC class function. The instance member must point to a
+ *   @ref CDC_Buffers_TypeDef struct owned by the application.
  *****************************************************************************/
-void CDC_Init( void )
+void CDC_Init( USBD_ClassFunction_TypeDef *fn )
 {
+  CDC_Buffers_TypeDef *buffers = (CDC_Buffers_TypeDef*) fn->instance;
+
+  cdcFn             = fn;
+  usbRxBuffer[ 0 ]  = buffers->usbRxBuffer0;
+  usbRxBuffer[ 1 ]  = buffers->usbRxBuffer1;
+  uartRxBuffer[ 0 ] = buffers->uartRxBuffer0;
+  uartRxBuffer[ 1 ] = buffers->uartRxBuffer1;
+
   SerialPortInit();
   DmaSetup();
 }
 
+/**************************************************************************//**
+ * @brief
+ *   Set the interface numbers in the class specific descriptors when the
+ *   composite device framework has assigned interface numbers.
+ *
+ * @param[in] fn   The class function.
+ * @param[in] desc The descriptors of the function.
+ * @param[in] len  Length of the descriptors.
+ *****************************************************************************/
+static void PatchDescriptors( USBD_ClassFunction_TypeDef *fn,
+                              uint8_t *desc, int len )
+{
+  int i;
+  uint8_t *end = desc + len;
+
+  while ( desc < end )
+  {
+    if ( desc[ 1 ] == USB_CS_INTERFACE_DESCRIPTOR )
+    {
+      if ( desc[ 2 ] == USB_CLASS_CDC_CMNGFN )
+      {
+        desc[ 4 ] += fn->firstInterface;          /* bDataInterface        */
+      }
+      else if ( desc[ 2 ] == USB_CLASS_CDC_UNIONFN )
+      {
+        for ( i = 3; i < desc[ 0 ]; i++ )         /* Control/subordinate   */
+        {
+          desc[ i ] += fn->firstInterface;
+        }
+      }
+    }
+    desc += desc[ 0 ];
+  }
+}
+
 /**************************************************************************//**
  * @brief
  *   Handle USB setup commands. Implements CDC class specific commands.
  *
+ * @param[in] fn    The class function.
  * @param[in] setup Pointer to the setup packet received.
  *
  * @return USB_STATUS_OK if command accepted.
  *         USB_STATUS_REQ_UNHANDLED when command is unknown, the USB device
  *         stack will handle the request.
  *****************************************************************************/
-int CDC_SetupCmd(const USB_Setup_TypeDef *setup)
+static int SetupCmd( USBD_ClassFunction_TypeDef *fn,
+                     const USB_Setup_TypeDef *setup )
 {
   int retVal = USB_STATUS_REQ_UNHANDLED;
 
@@ -136,7 +202,7 @@ int CDC_SetupCmd(const USB_Setup_TypeDef *setup)
     case USB_CDC_GETLINECODING:
       /********************/
       if ( ( setup->wValue    == 0                     ) &&
-           ( setup->wIndex    == CDC_CTRL_INTERFACE_NO ) && /* Interface no. */
+           ( setup->wIndex    == fn->firstInterface ) && /* Interface no. */
            ( setup->wLength   == 7                     ) && /* Length of cdcLineCoding */
            ( setup->Direction == USB_SETUP_DIR_IN      )    )
       {
@@ -149,7 +215,7 @@ int CDC_SetupCmd(const USB_Setup_TypeDef *setup)
     case USB_CDC_SETLINECODING:
       /********************/
       if ( ( setup->wValue    == 0                     ) &&
-           ( setup->wIndex    == CDC_CTRL_INTERFACE_NO ) && /* Interface no. */
+           ( setup->wIndex    == fn->firstInterface ) && /* Interface no. */
            ( setup->wLength   == 7                     ) && /* Length of cdcLineCoding */
            ( setup->Direction != USB_SETUP_DIR_IN      )    )
       {
@@ -161,7 +227,7 @@ int CDC_SetupCmd(const USB_Setup_TypeDef *setup)
 
     case USB_CDC_SETCTRLLINESTATE:
       /********************/
-      if ( ( setup->wIndex  == CDC_CTRL_INTERFACE_NO ) &&   /* Interface no.  */
+      if ( ( setup->wIndex  == fn->firstInterface ) &&   /* Interface no.  */
            ( setup->wLength == 0                     )    ) /* No data        */
       {
         /* Do nothing ( Non compliant behaviour !! ) */
@@ -179,12 +245,16 @@ int CDC_SetupCmd(const USB_Setup_TypeDef *setup)
  *   Callback function called each time the USB device state is changed.
  *   Starts CDC operation when device has been configured by USB host.
  *
+ * @param[in] fn       The class function.
  * @param[in] oldState The device state the device has just left.
  * @param[in] newState The new device state.
  *****************************************************************************/
-void CDC_StateChangeEvent( USBD_State_TypeDef oldState,
-                           USBD_State_TypeDef newState)
+static void StateChangeEvent( USBD_ClassFunction_TypeDef *fn,
+                              USBD_State_TypeDef oldState,
+                              USBD_State_TypeDef newState )
 {
+  (void) fn;                   /* Unused parameter */
+
   if (newState == USBD_STATE_CONFIGURED)
   {
     /* We have been configured, start CDC functionality ! */
@@ -16,16 +16,30 @@
 #ifndef __CDC_H
 #define __CDC_H
 
+#include "em_usbdclass.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #define CDC_BULK_EP_SIZE  USB_MAX_EP_SIZE  /* This is the max. ep size. */
 
-void CDC_Init( void );
-int  CDC_SetupCmd(const USB_Setup_TypeDef *setup);
-void CDC_StateChangeEvent( USBD_State_TypeDef oldState,
-                           USBD_State_TypeDef newState);
+#define CDC_USB_RX_BUF_SIZ  CDC_BULK_EP_SIZE /* Packet size when receiving on USB */
+#define CDC_USB_TX_BUF_SIZ  127    /* Packet size when transmitting on USB.  */
+
+/* CDC transfer buffers, owned by the application. USB and UART DMA      */
+/* transfers use the buffers directly, data is never copied.             */
+typedef struct
+{
+  UBUF( usbRxBuffer0,  CDC_USB_RX_BUF_SIZ );  /* USB receive buffers.     */
+  UBUF( usbRxBuffer1,  CDC_USB_RX_BUF_SIZ );
+  UBUF( uartRxBuffer0, CDC_USB_TX_BUF_SIZ );  /* UART receive buffers.    */
+  UBUF( uartRxBuffer1, CDC_USB_TX_BUF_SIZ );
+} CDC_Buffers_TypeDef;
+
+extern const USBD_ClassDriver_TypeDef CDC_Driver;
+
+void CDC_Init( USBD_ClassFunction_TypeDef *fn );
 
 #ifdef __cplusplus
 }
@@ -15,17 +15,17 @@
 
 #include "em_common.h"
 #include "em_usb.h"
+#include "em_usbdclass.h"
 
 #include "cdc.h"
+#include "msdd.h"
+#include "vud.h"
 #include "usbconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-extern int  SetupCmd(const USB_Setup_TypeDef *setup);
-extern void StateChangeEvent(USBD_State_TypeDef oldState, USBD_State_TypeDef newState);
-
 EFM32_ALIGN(4)
 static const USB_DeviceDescriptor_TypeDef deviceDesc __attribute__ ((aligned(4)))=
 {
@@ -45,56 +45,37 @@ static const USB_DeviceDescriptor_TypeDef deviceDesc __attribute__ ((aligned(4))
   .bNumConfigurations = 1
 };
 
-#if ( NUM_EP_USED != (MSD_NUM_EP_USED + VUD_NUM_EP_USED + CDC_NUM_EP_USED) )
-#error "Incorrect endpoint count."
-#endif
-
-#define CDC_MISC_DESCRIPTOR_LEN ( USB_CDC_HEADER_FND_DESCSIZE  +        \
-                                  USB_CDC_CALLMNG_FND_DESCSIZE +        \
-                                  USB_CDC_ACM_FND_DESCSIZE     +        \
-                                  USB_INTERFACE_ASSOCIATION_DESCSIZE +  \
-                                  5 )/*CDC Union Functional descriptor length*/
+/*
+ * Descriptor templates of the functions of the composite device. Interface
+ * numbers start at 0 in each function, and only the direction bit of the
+ * endpoint addresses is used. The composite device framework assigns the
+ * final interface numbers and endpoint addresses in USBD_ClassInit().
+ */
 
-#define CONFIG_DESC_TOTAL_LEN                             \
-        ( USB_CONFIG_DESCSIZE                         +   \
-          ( USB_INTERFACE_DESCSIZE * NUM_INTERFACES ) +   \
-          ( USB_ENDPOINT_DESCSIZE  * NUM_EP_USED )    +   \
-          CDC_MISC_DESCRIPTOR_LEN )
-
-EFM32_ALIGN(4)
-static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
+/*** VUD (Vendor Unique Device) Function ***/
+static const uint8_t vudDesc[] =
 {
-  /*** Configuration descriptor ***/
-  USB_CONFIG_DESCSIZE,    /* bLength                                   */
-  USB_CONFIG_DESCRIPTOR,  /* bDescriptorType                           */
-  CONFIG_DESC_TOTAL_LEN,  /* wTotalLength (LSB)                        */
-  CONFIG_DESC_TOTAL_LEN>>8, /* wTotalLength (MSB)                      */
-  NUM_INTERFACES,         /* bNumInterfaces                            */
-  1,                      /* bConfigurationValue                       */
-  0,                      /* iConfiguration                            */
-  CONFIG_DESC_BM_RESERVED_D7 |    /* bmAttrib: Self powered            */
-  CONFIG_DESC_BM_SELFPOWERED,
-  CONFIG_DESC_MAXPOWER_mA( 100 ), /* bMaxPower: 100 mA                 */
-
-  /*** VUD (Vendor Unique Device) Function ***/
   /*** Interface descriptor ***/
   USB_INTERFACE_DESCSIZE, /* bLength               */
   USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
-  VUD_INTERFACE_NO,       /* bInterfaceNumber      */
+  0,                      /* bInterfaceNumber      */
   0,                      /* bAlternateSetting     */
-  VUD_NUM_EP_USED,        /* bNumEndpoints         */
+  0,                      /* bNumEndpoints         */
   0xFF,                   /* bInterfaceClass       */
   0,                      /* bInterfaceSubClass    */
   0,                      /* bInterfaceProtocol    */
   0,                      /* iInterface            */
+};
 
-  /*** MSD Function         ***/
+/*** MSD Function         ***/
+static const uint8_t msdDesc[] =
+{
   /*** Interface descriptor ***/
   USB_INTERFACE_DESCSIZE, /* bLength               */
   USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
-  MSD_INTERFACE_NO,       /* bInterfaceNumber      */
+  0,                      /* bInterfaceNumber      */
   0,                      /* bAlternateSetting     */
-  MSD_NUM_EP_USED,        /* bNumEndpoints         */
+  2,                      /* bNumEndpoints         */
   USB_CLASS_MSD,          /* bInterfaceClass       */
   USB_CLASS_MSD_SCSI_CMDSET, /* bInterfaceSubClass */
   USB_CLASS_MSD_BOT_TRANSPORT,/* bInterfaceProtocol*/
@@ -103,7 +84,7 @@ static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
   /*** Endpoint descriptors ***/
   USB_ENDPOINT_DESCSIZE,  /* bLength               */
   USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
-  MSD_BULK_OUT,           /* bEndpointAddress (OUT)*/
+  USB_SETUP_DIR_H2D,      /* bEndpointAddress (OUT)*/
   USB_EPTYPE_BULK,        /* bmAttributes          */
   USB_MAX_EP_SIZE,        /* wMaxPacketSize (LSB)  */
   0,                      /* wMaxPacketSize (MSB)  */
@@ -111,17 +92,20 @@ static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
 
   USB_ENDPOINT_DESCSIZE,  /* bLength               */
   USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
-  MSD_BULK_IN,            /* bEndpointAddress (IN) */
+  USB_SETUP_DIR_D2H,      /* bEndpointAddress (IN) */
   USB_EPTYPE_BULK,        /* bmAttributes          */
   USB_MAX_EP_SIZE,        /* wMaxPacketSize (LSB)  */
   0,                      /* wMaxPacketSize (MSB)  */
   0,                      /* bInterval             */
+};
 
-  /*** CDC Function                                                 ***/
+/*** CDC Function                                                 ***/
+static const uint8_t cdcDesc[] =
+{
   /*** IAD (Interface Association Descriptor) for the CDC function  ***/
   USB_INTERFACE_ASSOCIATION_DESCSIZE, /* bLength: Interface Descriptor size */
   USB_INTERFACE_ASSOCIATION_DESCRIPTOR, /* bDescriptorType      */
-  CDC_CTRL_INTERFACE_NO,  /* bFirstInterface                    */
+  0,                      /* bFirstInterface                    */
   2,                      /* bInterfaceCount                    */
   USB_CLASS_CDC,          /* bFunctionClass                     */
   USB_CLASS_CDC_ACM,      /* bFunctionSubClass                  */
@@ -131,7 +115,7 @@ static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
   /*** Communication Class Interface descriptor ***/
   USB_INTERFACE_DESCSIZE, /* bLength               */
   USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
-  CDC_CTRL_INTERFACE_NO,  /* bInterfaceNumber      */
+  0,                      /* bInterfaceNumber      */
   0,                      /* bAlternateSetting     */
   1,                      /* bNumEndpoints         */
   USB_CLASS_CDC,          /* bInterfaceClass       */
@@ -151,7 +135,7 @@ static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
   USB_CS_INTERFACE_DESCRIPTOR,  /* bDescriptorType */
   USB_CLASS_CDC_CMNGFN,   /* bDescriptorSubtype    */
   0,                      /* bmCapabilities        */
-  CDC_DATA_INTERFACE_NO,  /* bDataInterface        */
+  1,                      /* bDataInterface        */
 
   /*** CDC Abstract Control Management Functional descriptor ***/
   USB_CDC_ACM_FND_DESCSIZE, /* bFunctionLength     */
@@ -172,13 +156,13 @@ static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
   5,                      /* bFunctionLength       */
   USB_CS_INTERFACE_DESCRIPTOR, /* bDescriptorType  */
   USB_CLASS_CDC_UNIONFN,  /* bDescriptorSubtype    */
-  CDC_CTRL_INTERFACE_NO,  /* bControlInterface     */
-  CDC_DATA_INTERFACE_NO,  /* bSubordinateInterface0*/
+  0,                      /* bControlInterface     */
+  1,                      /* bSubordinateInterface0*/
 
   /*** CDC Notification endpoint descriptor ***/
   USB_ENDPOINT_DESCSIZE,  /* bLength               */
   USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
-  CDC_EP_NOTIFY,          /* bEndpointAddress (IN) */
+  USB_SETUP_DIR_D2H,      /* bEndpointAddress (IN) */
   USB_EPTYPE_INTR,        /* bmAttributes          */
   USB_MAX_EP_SIZE,        /* wMaxPacketSize (LSB)  */
   0,                      /* wMaxPacketSize (MSB)  */
@@ -187,7 +171,7 @@ static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
   /*** Data Class Interface descriptor ***/
   USB_INTERFACE_DESCSIZE, /* bLength               */
   USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
-  CDC_DATA_INTERFACE_NO,  /* bInterfaceNumber      */
+  1,                      /* bInterfaceNumber      */
   0,                      /* bAlternateSetting     */
   2,                      /* bNumEndpoints         */
   USB_CLASS_CDC_DATA,     /* bInterfaceClass       */
@@ -198,7 +182,7 @@ static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
   /*** CDC Data interface endpoint descriptors ***/
   USB_ENDPOINT_DESCSIZE,  /* bLength               */
   USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
-  CDC_EP_DATA_IN,         /* bEndpointAddress (IN) */
+  USB_SETUP_DIR_D2H,      /* bEndpointAddress (IN) */
   USB_EPTYPE_BULK,        /* bmAttributes          */
   CDC_BULK_EP_SIZE,       /* wMaxPacketSize (LSB)  */
   0,                      /* wMaxPacketSize (MSB)  */
@@ -206,7 +190,7 @@ static const uint8_t configDesc[] __attribute__ ((aligned(4)))=
 
   USB_ENDPOINT_DESCSIZE,  /* bLength               */
   USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
-  CDC_EP_DATA_OUT,        /* bEndpointAddress (OUT)*/
+  USB_SETUP_DIR_H2D,      /* bEndpointAddress (OUT)*/
   USB_EPTYPE_BULK,        /* bmAttributes          */
   CDC_BULK_EP_SIZE,       /* wMaxPacketSize (LSB)  */
   0,                      /* wMaxPacketSize (MSB)  */
@@ -231,33 +215,68 @@ static const void * const strings[] =
   &iSerialNumber
 };
 
-/* Endpoint buffer sizes */
-/* 1 = single buffer, 2 = double buffering, 3 = tripple buffering ... */
-static const uint8_t bufferingMultiplier[ NUM_EP_USED + 1 ] =
+/* Endpoint buffer sizes, in descriptor order of each function.         */
+/* 1 = single buffer, 2 = double buffering, 3 = tripple buffering ...   */
+static const uint8_t msdBufferingMultiplier[] = { 2, 2 };   /* Bulk.     */
+static const uint8_t cdcBufferingMultiplier[] = { 1, 2, 2 };/* Intr/bulk.*/
+
+/* Buffers used by the functions, owned by the application. */
+STATIC_UBUF( msdMediaBuffer, MEDIA_BUFSIZ );
+static CDC_Buffers_TypeDef cdcBuffers;
+
+USBD_ClassFunction_TypeDef vudFunction =
+{
+  .driver              = &VUD_Driver,
+  .instance            = NULL,
+  .descriptors         = vudDesc,
+  .descriptorsLength   = sizeof( vudDesc ),
+  .bufferingMultiplier = NULL,
+  .deviceRequests      = true     /* Vendor requests are sent to device. */
+};
+
+USBD_ClassFunction_TypeDef msdFunction =
 {
-  1,        /* Common Control endpoint.           */
-  2, 2,     /* MSD bulk endpoints.                */
-  1, 2, 2   /* CDC interrupt and bulk endpoints.  */
+  .driver              = &MSDD_Driver,
+  .instance            = msdMediaBuffer,
+  .descriptors         = msdDesc,
+  .descriptorsLength   = sizeof( msdDesc ),
+  .bufferingMultiplier = msdBufferingMultiplier,
+  .deviceRequests      = false
 };
 
-static const USBD_Callbacks_TypeDef callbacks =
+USBD_ClassFunction_TypeDef cdcFunction =
 {
-  .usbReset        = NULL,
-  .usbStateChange  = StateChangeEvent,
-  .setupCmd        = SetupCmd,
-  .isSelfPowered   = NULL,
-  .sofInt          = NULL
+  .driver              = &CDC_Driver,
+  .instance            = &cdcBuffers,
+  .descriptors         = cdcDesc,
+  .descriptorsLength   = sizeof( cdcDesc ),
+  .bufferingMultiplier = cdcBufferingMultiplier,
+  .deviceRequests      = false
 };
 
-const USBD_Init_TypeDef initstruct =
+static USBD_ClassFunction_TypeDef * const functions[] =
+{
+  &vudFunction,
+  &msdFunction,
+  &cdcFunction
+};
+
+/* The configuration descriptor is assembled in this buffer. */
+STATIC_UBUF( configDesc, USB_CONFIG_DESCSIZE + sizeof( vudDesc ) +
+                         sizeof( msdDesc ) + sizeof( cdcDesc ) );
+
+const USBD_ClassInit_TypeDef initstruct =
 {
   .deviceDescriptor    = &deviceDesc,
-  .configDescriptor    = configDesc,
   .stringDescriptors   = strings,
   .numberOfStrings     = sizeof(strings)/sizeof(void*),
-  .callbacks           = &callbacks,
-  .bufferingMultiplier = bufferingMultiplier,
-  .reserved            = 0
+  .bmAttributes        = CONFIG_DESC_BM_SELFPOWERED,
+  .bMaxPower           = CONFIG_DESC_MAXPOWER_mA( 100 ),
+  .functions           = functions,
+  .numFunctions        = sizeof(functions)/sizeof(void*),
+  .configBuffer        = configDesc,
+  .configBufferSize    = sizeof( configDesc ),
+  .usbStateChange      = NULL
 };
 
 #ifdef __cplusplus
@@ -16,6 +16,7 @@
 #include <stdio.h>
 #include "em_device.h"
 #include "em_usb.h"
+#include "em_usbdclass.h"
 #include "em_assert.h"
 #include "em_cmu.h"
 #include "em_gpio.h"
@@ -31,10 +32,14 @@
 /**************************************************************************//**
  *
  * This example shows how a Composite USB Device can be implemented.
+ * The functions of the device are registered with the composite device
+ * framework, which assigns interfaces and endpoints and dispatches setup
+ * requests to the function addressed.
  *
  *****************************************************************************/
 
-extern const USBD_Init_TypeDef initstruct;
+extern const USBD_ClassInit_TypeDef initstruct;
+extern USBD_ClassFunction_TypeDef     msdFunction, cdcFunction;
 
 /**************************************************************************//**
  * @brief main - the entrypoint after reset.
@@ -56,10 +61,10 @@ int main( void )
   }
 
   VUD_Init();                   /* Initialize the vendor unique device. */
-  CDC_Init();                   /* Initialize the communication class device. */
-  MSDD_Init(gpioPortE, 1);      /* Initialize the Mass Storage Device.  */
+  CDC_Init(&cdcFunction);       /* Initialize the communication class device. */
+  MSDD_Init(&msdFunction, gpioPortE, 1); /* Initialize the Mass Storage Device. */
 
-  USBD_Init(&initstruct);       /* Start USB. */
+  USBD_ClassInit(&initstruct);  /* Start USB. */
 
   /*
    * When using a debugger it is practical to uncomment the following three
@@ -74,54 +79,3 @@ int main( void )
     MSDD_Handler();             /* Serve the MSD device. */
   }
 }
-
-/**************************************************************************//**
- * @brief
- *   Called whenever a USB setup command is received.
- *
- * @param[in] setup
- *   Pointer to an USB setup packet.
- *
- * @return
- *   An appropriate status/error code. See USB_Status_TypeDef.
- *****************************************************************************/
-int SetupCmd(const USB_Setup_TypeDef *setup)
-{
-  int retVal;
-
-  /* Call SetupCmd handlers for all functions within the composite device. */
-
-  retVal = MSDD_SetupCmd( setup );
-
-  if ( retVal == USB_STATUS_REQ_UNHANDLED )
-  {
-    retVal = VUD_SetupCmd( setup );
-  }
-
-  if ( retVal == USB_STATUS_REQ_UNHANDLED )
-  {
-    retVal = CDC_SetupCmd( setup );
-  }
-
-  return retVal;
-}
-
-/**************************************************************************//**
- * @brief
- *   Called whenever the USB device has changed its device state.
- *
- * @param[in] oldState
- *   The device USB state just leaved. See USBD_State_TypeDef.
- *
- * @param[in] newState
- *   New (the current) USB device state. See USBD_State_TypeDef.
- *****************************************************************************/
-void StateChangeEvent( USBD_State_TypeDef oldState,
-                       USBD_State_TypeDef newState )
-{
-  /* Call device StateChange event handlers for all relevant functions within
-     the composite device. */
-
-  MSDD_StateChangeEvent( oldState, newState );
-  CDC_StateChangeEvent(  oldState, newState );
-}
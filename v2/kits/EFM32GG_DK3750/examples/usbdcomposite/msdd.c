@@ -14,6 +14,7 @@
  ******************************************************************************/
 
 #include "em_usb.h"
+#include "em_usbdclass.h"
 #include "em_cmu.h"
 #include "em_gpio.h"
 #include "msdbot.h"
@@ -28,6 +29,11 @@
 #define MSD_DIR_DATA_IN     1
 #define MSD_MAX_BURST       32768U          /* 32 * 1024 */
 
+/* Endpoint addresses assigned by the composite device framework, in    */
+/* descriptor order.                                                      */
+#define MSD_BULK_OUT        ( msdFn->epAddr[ 0 ] )
+#define MSD_BULK_IN         ( msdFn->epAddr[ 1 ] )
+
 /**************************************************************************//**
  * @brief MSD device state machine states.
  *****************************************************************************/
@@ -52,6 +58,11 @@ __STATIC_INLINE bool  CswValid(void);
 __STATIC_INLINE void  EnableNextCbw(void);
 static void           ProcessScsiCdb(void);
 __STATIC_INLINE void  SendCsw(void);
+static int            SetupCmd(USBD_ClassFunction_TypeDef *fn,
+                               const USB_Setup_TypeDef *setup);
+static void           StateChangeEvent(USBD_ClassFunction_TypeDef *fn,
+                                       USBD_State_TypeDef oldState,
+                                       USBD_State_TypeDef newState);
 static void           UsbXferBotData(uint8_t *data, uint32_t len, USB_XferCompleteCb_TypeDef cb);
 static void           XferBotData(uint32_t length);
 static int            XferBotDataCallback(USB_Status_TypeDef status, uint32_t xferred, uint32_t remaining);
@@ -68,7 +79,9 @@ EFM32_ALIGN(4)
 static MSDBOT_CSW_TypeDef csw __attribute__ ((aligned(4)));
 static MSDBOT_CSW_TypeDef *pCsw = &csw;
 
-STATIC_UBUF(mediaBuffer, MEDIA_BUFSIZ);  /* Intermediate media storage buffer */
+static uint8_t *mediaBuffer;   /* Intermediate media storage buffer, owned */
+                               /* by the application.                      */
+static USBD_ClassFunction_TypeDef *msdFn;
 
 static MSDD_CmdStatus_TypeDef CmdStatus;
 static MSDD_CmdStatus_TypeDef *pCmdStatus = &CmdStatus;
@@ -157,9 +170,23 @@ static MSDSCSI_RequestSenseData_TypeDef *pSenseData;  /**< Points to current sen
 
 /** @endcond */
 
+/** Mass Storage Device class driver. */
+const USBD_ClassDriver_TypeDef MSDD_Driver =
+{
+  .setupCmd         = SetupCmd,
+  .stateChange      = StateChangeEvent,
+  .sofInt           = NULL,
+  .patchDescriptors = NULL
+};
+
 /**************************************************************************//**
  * @brief Initialize MSD device.
  *
+ * @param[in] fn
+ *   The MSD class function. The instance member must point to a word
+ *   aligned media buffer of @ref MEDIA_BUFSIZ bytes owned by the
+ *   application, see @ref UBUF.
+ *
  * @param[in] activityLedPort
  *   Specify a GPIO port for a LED activity indicator (i.e. enum gpioPortX)
  *   Pass -1 if no indicator LED is available.
@@ -167,7 +194,8 @@ static MSDSCSI_RequestSenseData_TypeDef *pSenseData;  /**< Points to current sen
  * @param[in] activityLedPin
  *   Pin number on activityLedPort for the LED activity indicator.
  *****************************************************************************/
-void MSDD_Init(int activityLedPort, uint32_t activityLedPin)
+void MSDD_Init(USBD_ClassFunction_TypeDef *fn,
+               int activityLedPort, uint32_t activityLedPin)
 {
   if ( ( sizeof(MSDSCSI_Read10_TypeDef)           != SCSI_READ10_LEN           ) ||
        ( sizeof(MSDSCSI_Write10_TypeDef)          != SCSI_WRITE10_LEN          ) ||
@@ -188,8 +216,10 @@ void MSDD_Init(int activityLedPort, uint32_t activityLedPin)
   else
     ledPort = -1;
 
-  ledPin     = activityLedPin;
-  msdState   = MSDD_IDLE;
+  msdFn       = fn;
+  mediaBuffer = (uint8_t*) fn->instance;
+  ledPin      = activityLedPin;
+  msdState    = MSDD_IDLE;
   pSenseData = (MSDSCSI_RequestSenseData_TypeDef*) &NoSenseData;
 
   if ( ledPort != -1 )
@@ -275,13 +305,17 @@ bool MSDD_Handler(void)
  *   This function overrides standard CLEAR_FEATURE commands, and implements
  *   MSD class commands "Bulk-Only Mass Storage Reset" and "Get Max LUN".
  *
+ * @param[in] fn
+ *  The MSD class function.
+ *
  * @param[in] setup
  *  Pointer to an USB setup packet.
  *
  * @return
  *  An appropriate status/error code. See USB_Status_TypeDef.
  *****************************************************************************/
-int MSDD_SetupCmd(const USB_Setup_TypeDef *setup)
+static int SetupCmd(USBD_ClassFunction_TypeDef *fn,
+                    const USB_Setup_TypeDef *setup)
 {
   int retVal;
   static uint32_t tmp;
@@ -295,7 +329,7 @@ int MSDD_SetupCmd(const USB_Setup_TypeDef *setup)
        ( setup->Recipient == USB_SETUP_RECIPIENT_INTERFACE ) &&
        ( setup->bRequest  == USB_MSD_BOTRESET              ) &&
        ( setup->wValue    == 0                             ) &&
-       ( setup->wIndex    == MSD_INTERFACE_NO              ) &&
+       ( setup->wIndex    == fn->firstInterface            ) &&
        ( setup->wLength   == 0                             )    )
   {
     if (msdState == MSDD_WAITFOR_RECOVERY)
@@ -313,7 +347,7 @@ int MSDD_SetupCmd(const USB_Setup_TypeDef *setup)
             ( setup->Recipient == USB_SETUP_RECIPIENT_INTERFACE ) &&
             ( setup->bRequest  == USB_MSD_GETMAXLUN             ) &&
             ( setup->wValue    == 0                             ) &&
-            ( setup->wIndex    == MSD_INTERFACE_NO              ) &&
+            ( setup->wIndex    == fn->firstInterface            ) &&
             ( setup->wLength   == 1                             )    )
   {
     /* Only one LUN (i.e. no support for multiple LUN's). Reply "0". */
@@ -366,15 +400,21 @@ int MSDD_SetupCmd(const USB_Setup_TypeDef *setup)
  * @brief
  *   Called whenever the USB device has changed its device state.
  *
+ * @param[in] fn
+ *   The MSD class function.
+ *
  * @param[in] oldState
  *   The device USB state just leaved. See USBD_State_TypeDef.
  *
  * @param[in] newState
  *   New (the current) USB device state. See USBD_State_TypeDef.
  *****************************************************************************/
-void MSDD_StateChangeEvent( USBD_State_TypeDef oldState,
-                            USBD_State_TypeDef newState )
+static void StateChangeEvent( USBD_ClassFunction_TypeDef *fn,
+                              USBD_State_TypeDef oldState,
+                              USBD_State_TypeDef newState )
 {
+  (void) fn;                   /* Unused parameter */
+
   if (newState == USBD_STATE_CONFIGURED)
   {
     /* We have been configured, start MSD functionality ! */
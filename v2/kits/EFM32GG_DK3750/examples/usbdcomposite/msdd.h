@@ -16,6 +16,8 @@
 #ifndef __MSDD_H
 #define __MSDD_H
 
+#include "em_usbdclass.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -39,11 +41,11 @@ typedef struct
 
 /*** MSDD Device Driver Function prototypes ***/
 
+extern const USBD_ClassDriver_TypeDef MSDD_Driver;
+
 bool MSDD_Handler(void);
-void MSDD_Init(int activityLedPort, uint32_t activityLedPin);
-int  MSDD_SetupCmd(const USB_Setup_TypeDef *setup);
-void MSDD_StateChangeEvent(USBD_State_TypeDef oldState,
-                           USBD_State_TypeDef newState);
+void MSDD_Init(USBD_ClassFunction_TypeDef *fn,
+               int activityLedPort, uint32_t activityLedPin);
 
 #ifdef __cplusplus
 }
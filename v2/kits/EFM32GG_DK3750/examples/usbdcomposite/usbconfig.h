@@ -40,24 +40,10 @@ extern "C" {
 
 /*** Misc. definitions for the interfaces of the composite device. ***/
 
-/* Define interface numbers */
-#define VUD_INTERFACE_NO        ( 0 )
-#define MSD_INTERFACE_NO        ( 1 )
-#define CDC_CTRL_INTERFACE_NO   ( 2 )
-#define CDC_DATA_INTERFACE_NO   ( 3 )
-#define NUM_INTERFACES          ( 4 )
-
-#define MSD_NUM_EP_USED         ( 2 ) /* Number of EP's used by MSD function */
-#define VUD_NUM_EP_USED         ( 0 ) /* Number of EP's used by VUD function */
-#define CDC_NUM_EP_USED         ( 3 ) /* Number of EP's used by CDC function */
-
-/* Define USB endpoint addresses for the interfaces */
-#define CDC_EP_DATA_OUT   ( 0x01 ) /* Endpoint for CDC data reception.       */
-#define CDC_EP_DATA_IN    ( 0x81 ) /* Endpoint for CDC data transmission.    */
-#define CDC_EP_NOTIFY     ( 0x82 ) /* The notification endpoint (not used).  */
-
-#define MSD_BULK_OUT      ( 0x02 ) /* Endpoint for MSD data reception.       */
-#define MSD_BULK_IN       ( 0x83 ) /* Endpoint for MSD data transmission.    */
+/* Interface numbers and endpoint addresses are assigned by the composite */
+/* device framework, see descriptors.c.                                   */
+#define USBD_CLASS_MAX_INTERFACES ( 4 )
+#define USBD_CLASS_MAX_FUNCTIONS  ( 3 )
 
 /* Define timer ID's */
 #define CDC_TIMER_ID        ( 1 )
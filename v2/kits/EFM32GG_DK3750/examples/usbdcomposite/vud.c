@@ -15,7 +15,9 @@
 
 #include "em_device.h"
 #include "em_usb.h"
+#include "em_usbdclass.h"
 #include "bsp.h"
+#include "vud.h"
 
 /**************************************************************************//**
  *
@@ -40,6 +42,22 @@
 #define VND_GET_LEDS    0x10
 #define VND_SET_LED     0x11
 
+/*** Function prototypes. ***/
+
+static int SetupCmd( USBD_ClassFunction_TypeDef *fn,
+                     const USB_Setup_TypeDef *setup );
+
+/*** Variables ***/
+
+/** Vendor Unique Device class driver. */
+const USBD_ClassDriver_TypeDef VUD_Driver =
+{
+  .setupCmd         = SetupCmd,
+  .stateChange      = NULL,
+  .sofInt           = NULL,
+  .patchDescriptors = NULL
+};
+
 /**************************************************************************//**
  * @brief Vendor Unique Device initialization.
  *****************************************************************************/
@@ -51,19 +69,23 @@ void VUD_Init( void )
 /**************************************************************************//**
  * @brief Handle USB setup commands for Vendor Unique Device.
  *
+ * @param[in] fn    The class function.
  * @param[in] setup Pointer to the setup packet received.
  *
  * @return USB_STATUS_OK if command accepted.
  *         USB_STATUS_REQ_UNHANDLED when command is unknown, the USB device
  *         stack will handle the request.
  *****************************************************************************/
-int VUD_SetupCmd(const USB_Setup_TypeDef *setup)
+static int SetupCmd( USBD_ClassFunction_TypeDef *fn,
+                     const USB_Setup_TypeDef *setup )
 {
   int             retVal;
   uint16_t        leds;
   static uint32_t buffer;
   uint8_t         *pBuffer = (uint8_t*) &buffer;
 
+  (void) fn;                   /* Unused parameter */
+
   retVal = USB_STATUS_REQ_UNHANDLED;
 
   if (setup->Type == USB_SETUP_TYPE_VENDOR)
@@ -16,12 +16,15 @@
 #ifndef __VUD_H
 #define __VUD_H
 
+#include "em_usbdclass.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+extern const USBD_ClassDriver_TypeDef VUD_Driver;
+
 void VUD_Init( void );
-int  VUD_SetupCmd(const USB_Setup_TypeDef *setup);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,370 @@
+/**************************************************************************//**
+ * @file main.c
+ * @brief USB host stack hub example project.
+ * @version 3.20.7
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#include "em_device.h"
+#include "em_cmu.h"
+#include "bsp.h"
+#include "bsp_trace.h"
+#include "retargetserial.h"
+#include "em_usb.h"
+#include "hubh.h"
+#include "usbkbdscancodes.h"
+
+/**************************************************************************//**
+ *
+ * This example shows how the USB host stack can be used to serve several
+ * devices attached to a hub.
+ *
+ *****************************************************************************/
+
+/*** Typedef's and defines. ***/
+
+#define MAX_EP_PR_DEVICE  4     /* Endpoints of interface 0 used.         */
+#define KBD_IN_REPORT_LEN 8     /* Length of keyboard interrupt IN report.*/
+
+/* A device attached to a hub port. */
+typedef struct
+{
+  bool                  active;
+  bool                  keyboard;
+  bool                  keyReleased;
+  volatile bool         reportReady;
+  volatile bool         readActive;
+  USBH_Device_TypeDef   dev;
+  USBH_Ep_TypeDef       ep[ MAX_EP_PR_DEVICE ];
+  UBUF(                 report, KBD_IN_REPORT_LEN );
+} PortDevice_TypeDef;
+
+/*** Function prototypes. ***/
+
+static void ConsoleDebugInit( void );
+static void DeviceAttach( int port, uint8_t speed );
+static void DeviceDetach( int port );
+static const char *DeviceClassString( uint8_t devClass, uint8_t ifClass );
+static int  HidSetProtocol( USBH_Device_TypeDef *dev );
+static void KbdCheckKeyPress( PortDevice_TypeDef *p );
+static void KbdStartRead( PortDevice_TypeDef *p );
+static int  KbdReportCallback( USB_Status_TypeDef status,
+                               uint32_t xferred, uint32_t remaining );
+
+/*** Variables ***/
+
+STATIC_UBUF(                tmpBuf, 1024 );
+static PortDevice_TypeDef   portDevice[ HUBH_MAX_PORTS + 1 ];
+
+/**************************************************************************//**
+ * @brief main - the entrypoint after reset.
+ *****************************************************************************/
+int main( void )
+{
+  int i, connectionResult;
+  HUBH_Event_TypeDef event;
+  USBH_Init_TypeDef initstruct = USBH_INIT_DEFAULT;
+
+  BSP_Init(BSP_INIT_DEFAULT);   /* Initialize DK board register access */
+
+  /* If first word of user data page is non-zero, enable eA Profiler trace */
+  BSP_TraceProfilerSetup();
+
+  CMU_ClockSelectSet( cmuClock_HF, cmuSelect_HFXO );
+
+  ConsoleDebugInit();           /* Initialize DK UART port. */
+
+  printf( "\n\nEFM32 USB Host hub example.\n" );
+
+  USBH_Init( &initstruct );     /* Initialize USB HOST stack */
+
+  for (;;)
+  {
+    /* Wait for ever on hub attach... */
+    printf( "\nWaiting for USB hub plug-in...\n" );
+    connectionResult = USBH_WaitForDeviceConnectionB( tmpBuf, 0 );
+
+    if ( connectionResult == USB_STATUS_DEVICE_MALFUNCTION )
+    {
+      printf( "\nA malfunctioning device was attached, please remove device.\n" );
+    }
+
+    else if ( connectionResult == USB_STATUS_PORT_OVERCURRENT )
+    {
+      printf( "\nVBUS overcurrent condition, please remove device.\n" );
+    }
+
+    else if ( connectionResult == USB_STATUS_OK )
+    {
+      printf( "\nA device was attached...\n" );
+
+      if ( HUBH_Init( tmpBuf, sizeof( tmpBuf ) ) )
+      {
+        printf( "\nWaiting for devices on the hub ports...\n" );
+
+        /*--------------- MAIN hub loop -------------------------------------*/
+        while ( USBH_DeviceConnected() )
+        {
+          if ( HUBH_Poll( &event ) )
+          {
+            switch ( event.type )
+            {
+              case HUBH_EVENT_ATTACH:
+                DeviceAttach( event.port, event.speed );
+                break;
+
+              case HUBH_EVENT_DETACH:
+                DeviceDetach( event.port );
+                break;
+
+              case HUBH_EVENT_OVERCURRENT:
+                DeviceDetach( event.port );
+                printf( "\nOvercurrent on hub port %d.\n", event.port );
+                break;
+
+              default:
+                break;
+            }
+          }
+
+          for ( i = 1; i <= HUBH_MAX_PORTS; i++ )
+          {
+            if ( portDevice[ i ].active && portDevice[ i ].keyboard )
+              KbdCheckKeyPress( &portDevice[ i ] );
+          }
+        }
+        printf( "\n\nHub removal detected...\n" );
+        /*-------------------------------------------------------------------*/
+      }
+      else
+      {
+        printf( "\nNot a valid hub, please remove device.\n" );
+      }
+    }
+
+    /* All device addresses are released when the port is reinitialized. */
+    for ( i = 1; i <= HUBH_MAX_PORTS; i++ )
+      portDevice[ i ].active = false;
+
+    /* Wait for malfunctional device or unknown device removal. */
+    while ( USBH_DeviceConnected() ){}
+
+    /* Disable USB peripheral, power down USB port. */
+    USBH_Stop();
+  }
+}
+
+/**************************************************************************//**
+ * @brief Initialize console I/O redirection.
+ *****************************************************************************/
+static void ConsoleDebugInit( void )
+{
+  RETARGET_SerialInit();                        /* Initialize USART   */
+  RETARGET_SerialCrLf( 1 );                     /* Map LF to CRLF     */
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Enumerate a device attached to a hub port.
+ *
+ * @param[in] port  Hub port number.
+ * @param[in] speed Device bus speed, as reported by the hub.
+ *****************************************************************************/
+static void DeviceAttach( int port, uint8_t speed )
+{
+  int addr, numEp;
+  PortDevice_TypeDef *p = &portDevice[ port ];
+  USB_InterfaceDescriptor_TypeDef *id;
+
+  printf( "\nDevice attached to hub port %d.", port );
+
+  if ( USBH_QueryDeviceB( tmpBuf, sizeof( tmpBuf ), speed ) != USB_STATUS_OK )
+  {
+    printf( "\nDevice enumeration failure, port disabled.\n" );
+    HUBH_PortDisable( port );
+    return;
+  }
+
+  id    = USBH_QGetInterfaceDescriptor( tmpBuf, 0, 0 );
+  numEp = EFM32_MIN( id->bNumEndpoints, MAX_EP_PR_DEVICE );
+
+  USBH_InitDeviceData( &p->dev, tmpBuf, p->ep, numEp, speed );
+
+  addr = USBH_AllocateAddress();
+  if ( ( addr < 0 )                                                     ||
+       ( USBH_SetAddressB( &p->dev, addr ) != USB_STATUS_OK )          ||
+       ( USBH_SetConfigurationB( &p->dev,
+                                 p->dev.confDesc.bConfigurationValue )
+         != USB_STATUS_OK ) )
+  {
+    printf( "\nDevice configuration failure, port disabled.\n" );
+    if ( addr > 0 )
+      USBH_ReleaseAddress( addr );
+    HUBH_PortDisable( port );
+    return;
+  }
+
+  p->active   = true;
+  p->keyboard = ( id->bInterfaceClass    == USB_CLASS_HID          ) &&
+                ( id->bInterfaceProtocol == USB_CLASS_HID_KEYBOARD ) &&
+                ( numEp >= 1                                       );
+
+  printf( "\nDevice VID/PID is 0x%04X/0x%04X, %s, bus speed is %s, "
+          "address %d\n",
+          p->dev.devDesc.idVendor, p->dev.devDesc.idProduct,
+          DeviceClassString( p->dev.devDesc.bDeviceClass,
+                             id->bInterfaceClass ),
+          speed == PORT_FULL_SPEED ? "FULL" : "LOW", addr );
+
+  if ( p->keyboard )
+  {
+    /* Keyboards share the scheduled host channels. */
+    USBH_AssignHostChannel( &p->ep[ 0 ], USBH_HC_ANY );
+    HidSetProtocol( &p->dev );
+    p->keyReleased = true;
+    p->reportReady = false;
+    KbdStartRead( p );
+  }
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Forget a device removed from a hub port.
+ *
+ * @param[in] port Hub port number.
+ *****************************************************************************/
+static void DeviceDetach( int port )
+{
+  PortDevice_TypeDef *p = &portDevice[ port ];
+
+  if ( p->active )
+  {
+    /* A pending keyboard read will end with a transfer error. */
+    p->active = false;
+    USBH_ReleaseAddress( p->dev.addr );
+    printf( "\nDevice on hub port %d (address %d) removed.\n",
+            port, p->dev.addr );
+  }
+}
+
+/**************************************************************************//**
+ * @brief Get a device class name for printing.
+ *****************************************************************************/
+static const char *DeviceClassString( uint8_t devClass, uint8_t ifClass )
+{
+  switch ( devClass ? devClass : ifClass )
+  {
+    case USB_CLASS_AUDIO: return "audio device";
+    case USB_CLASS_CDC:   return "communication device";
+    case USB_CLASS_HID:   return "HID device";
+    case USB_CLASS_HUB:   return "hub (not supported on hub port)";
+    case USB_CLASS_MSD:   return "mass storage device";
+  }
+  return "device";
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Send HID class USB_HID_SET_PROTOCOL setup command to a keyboard.
+ *
+ * @return USB_STATUS_OK, or an appropriate USB transfer error code.
+ *****************************************************************************/
+static int HidSetProtocol( USBH_Device_TypeDef *dev )
+{
+  return USBH_ControlMsgB(
+                    &dev->ep0,
+                    USB_SETUP_DIR_H2D | USB_SETUP_RECIPIENT_INTERFACE |
+                    USB_SETUP_TYPE_CLASS_MASK,            /* bmRequestType */
+                    USB_HID_SET_PROTOCOL,                 /* bRequest      */
+                    0,                                    /* wValue 0=boot protocol */
+                    0,                                    /* wIndex        */
+                    0,                                    /* wLength       */
+                    NULL,                                 /* void* data    */
+                    1000 );                               /* int timeout   */
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Print the ASCII equivalent of a keyboard scancode received from a
+ *   keyboard, and start a new read.
+ *****************************************************************************/
+static void KbdCheckKeyPress( PortDevice_TypeDef *p )
+{
+  char c;
+
+  if ( p->reportReady )
+  {
+    if ( p->report[ 2 ] )
+    {
+      c = USB_HidScancodeToAscii( p->report[ 2 ] );
+      if ( c && p->keyReleased )
+      {
+        putchar( c );
+        p->keyReleased = false;
+      }
+    }
+    else
+    {
+      /* Key released report */
+      p->keyReleased = true;
+    }
+    p->reportReady = false;
+    KbdStartRead( p );
+  }
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Start a read on the keyboard interrupt IN endpoint. The endpoint is
+ *   polled by the host stack until the keyboard sends a report.
+ *****************************************************************************/
+static void KbdStartRead( PortDevice_TypeDef *p )
+{
+  p->readActive = true;
+  if ( USBH_Read( &p->ep[ 0 ], p->report, KBD_IN_REPORT_LEN, 0,
+                  KbdReportCallback ) != USB_STATUS_OK )
+  {
+    p->readActive = false;
+  }
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Called when a keyboard read completes. The callback does not tell which
+ *   endpoint completed, so find the keyboard by its finished read and use
+ *   the transfer result stored in the endpoint.
+ *****************************************************************************/
+static int KbdReportCallback( USB_Status_TypeDef status,
+                              uint32_t xferred, uint32_t remaining )
+{
+  int i;
+  PortDevice_TypeDef *p;
+
+  (void)status;
+  (void)xferred;
+  (void)remaining;
+
+  for ( i = 1; i <= HUBH_MAX_PORTS; i++ )
+  {
+    p = &portDevice[ i ];
+    if ( p->readActive && p->ep[ 0 ].xferCompleted )
+    {
+      p->readActive = false;
+      if ( p->active && ( p->ep[ 0 ].xferStatus == USB_STATUS_OK ) &&
+           ( p->ep[ 0 ].xferred == KBD_IN_REPORT_LEN ) )
+      {
+        p->reportReady = true;
+      }
+    }
+  }
+
+  return USB_STATUS_OK;
+}
@@ -24,7 +24,8 @@
 extern "C" {
 #endif
 
-#define RGB_BUFFER_SIZE    512
+#define RGB_BUFFER_SIZE    (320 * 3)
+#define ROW_CACHE_SIZE     2048
 #define PALETTE_SIZE       1024
 
 void SLIDES_showError(bool fatal, const char* fmt, ...);
@@ -69,4 +69,15 @@
 /* Frequency of LCD polarity inversion. */
 #define LS013B7DH03_POLARITY_INVERSION_FREQUENCY (64)
 
+/*
+ * Define LS013B7DH03_LINE_DIFF (in displayconfigapp.h) to keep a shadow copy
+ * of the display contents. Only lines which differ from the shadow copy are
+ * transmitted when the display is updated, and they are sent in one
+ * multi-line update command. The shadow copy needs one byte per pixel column
+ * per line (2 KB). Define LS013B7DH03_LINE_DIFF_CHECKSUM as well to keep a
+ * 32 bit checksum per line (512 bytes) instead.
+ * LS013B7DH03_TX_LINES sets the number of lines in each of the two transmit
+ * buffers (default 4 lines, 18 bytes per line).
+ */
+
 #endif /* _DISPLAY_LS013B7DH03_CONFIG_H_ */
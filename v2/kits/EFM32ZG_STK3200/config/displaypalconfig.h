@@ -45,4 +45,13 @@
  */
 #define INCLUDE_PAL_GPIO_PIN_AUTO_TOGGLE_HW_ONLY
 
+/*
+ * Define PAL_SPI_DMA_CHANNEL (in displayconfigapp.h) to the DMA channel
+ * number which should transmit SPI data. The MCU then sleeps in EM1 while
+ * data is transmitted. The application must include em_dma.c and dmactrl.c.
+ */
+#ifdef PAL_SPI_DMA_CHANNEL
+#define PAL_SPI_DMA_SIGNAL     (DMAREQ_USART1_TXBL)
+#endif
+
 #endif /* _DISPLAY_PAL_CONFIG_H_ */
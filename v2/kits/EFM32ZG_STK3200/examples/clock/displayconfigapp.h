@@ -52,4 +52,14 @@
 #define PIXEL_MATRIX_POOL_SIZE   ( (DISPLAY0_HEIGHT * DISPLAY0_WIDTH/8) + \
                                    (FONT_HEIGHT * DISPLAY0_WIDTH/8) )
 
+/* Only send the lines that changed since the last update, most updates only
+   move the second pointer. A checksum per line is kept instead of a full
+   copy of the display to save RAM. */
+#define LS013B7DH03_LINE_DIFF
+#define LS013B7DH03_LINE_DIFF_CHECKSUM
+#define LS013B7DH03_TX_LINES   (2)
+
+/* Transmit display data by DMA on channel 0 and sleep in EM1 meanwhile. */
+#define PAL_SPI_DMA_CHANNEL    (0)
+
 #endif /* _DISPLAY_CONFIG_APP_H_ */
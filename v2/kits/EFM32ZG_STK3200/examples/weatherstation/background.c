@@ -1,6 +1,8 @@
 /***************************************************************************//**
  * @file
  * @brief Background image for the weatherstation demo.
+ *        128 rows of 384 pixels, 1 bit per pixel LSB first, a set bit is a
+ *        black pixel (DMD_PIXEL_FORMAT_MONO).
  * @version 3.20.5
  *******************************************************************************
  * @section License
@@ -16,4 +18,4 @@
 
 #include <stdint.h>
 
-const uint8_t background[6144] = {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 128, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 128, 13, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 64, 196, 0, 0, 0, 0, 0, 0, 0, 0, 192, 24, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 100, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 224, 255, 255, 255, 127, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 48, 0, 0, 0, 192, 0, 0, 0, 0, 128, 1, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 24, 0, 0, 0, 128, 1, 0, 0, 0, 128, 1, 224, 255, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 7, 206, 1, 28, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 7, 206, 1, 28, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 8, 7, 142, 3, 14, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 192, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 96, 192, 0, 0, 0, 8, 7, 142, 3, 14, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 128, 96, 0, 0, 0, 8, 7, 142, 7, 15, 1, 0, 0, 0, 128, 1, 224, 255, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 27, 0, 0, 0, 8, 7, 14, 7, 7, 1, 0, 0, 0, 128, 1, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 12, 0, 0, 0, 8, 7, 14, 7, 7, 1, 0, 0, 0, 128, 1, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 143, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 27, 0, 0, 0, 8, 7, 14, 142, 3, 1, 0, 0, 0, 128, 1, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 192, 3, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 96, 0, 0, 0, 8, 7, 14, 142, 3, 1, 0, 0, 0, 128, 1, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 120, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 96, 192, 0, 0, 0, 8, 7, 14, 222, 3, 1, 0, 0, 0, 128, 1, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 8, 7, 14, 220, 1, 1, 0, 0, 0, 128, 1, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 7, 14, 220, 1, 1, 0, 0, 0, 128, 1, 224, 63, 0, 0, 0, 0, 0, 0, 0, 0, 254, 16, 0, 0, 128, 1, 8, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 128, 7, 0, 0, 0, 8, 15, 15, 252, 1, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 6, 0, 128, 1, 192, 68, 0, 0, 0, 8, 254, 7, 248, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 48, 0, 0, 0, 0, 0, 0, 0, 0, 128, 25, 2, 0, 128, 1, 32, 132, 0, 0, 0, 8, 254, 7, 248, 0, 1, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 255, 31, 0, 0, 0, 0, 0, 0, 0, 0, 128, 16, 1, 0, 128, 1, 32, 132, 0, 0, 0, 8, 248, 1, 112, 0, 1, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 16, 1, 0, 128, 1, 32, 132, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 144, 0, 0, 128, 1, 32, 132, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 192, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 217, 0, 0, 128, 1, 64, 196, 0, 0, 0, 136, 19, 121, 120, 34, 1, 0, 0, 0, 128, 1, 252, 127, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 128, 1, 192, 100, 0, 0, 0, 8, 49, 137, 8, 34, 1, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 28, 0, 128, 193, 248, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 15, 0, 128, 1, 0, 31, 0, 0, 0, 8, 81, 9, 9, 20, 1, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 34, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 176, 25, 0, 128, 1, 0, 0, 0, 0, 0, 8, 81, 9, 121, 8, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 34, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 128, 1, 0, 0, 0, 0, 0, 8, 145, 9, 9, 20, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 28, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 16, 0, 128, 1, 0, 0, 0, 0, 0, 8, 17, 137, 8, 34, 1, 0, 0, 0, 128, 1, 128, 255, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 16, 0, 128, 1, 0, 0, 0, 0, 0, 136, 19, 121, 120, 34, 1, 0, 0, 0, 128, 1, 96, 98, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 25, 0, 128, 129, 255, 255, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 66, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 225, 255, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 15, 0, 128, 1, 192, 96, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 130, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 48, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 96, 64, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 130, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 24, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 64, 196, 0, 0, 0, 0, 0, 0, 0, 0, 254, 16, 0, 0, 128, 1, 8, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 120, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 64, 192, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 16, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 96, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 48, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 31, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 192, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 224, 255, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 128, 255, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 193, 248, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 64, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 128, 7, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 192, 68, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 64, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 224, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 224, 255, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 64, 196, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 192, 100, 0, 0, 0, 0, 0, 0, 0, 0, 254, 16, 0, 0, 128, 1, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 255, 255, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 224, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 0, 252, 63, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 128, 31, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 192, 7, 224, 3, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 192, 96, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 8, 0, 0, 0, 0, 0, 120, 0, 0, 30, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 96, 64, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 24, 0, 0, 0, 0, 0, 14, 0, 0, 112, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 48, 0, 0, 0, 0, 128, 3, 0, 0, 192, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 248, 63, 0, 0, 0, 224, 0, 0, 0, 0, 7, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 32, 128, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 12, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 64, 192, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 56, 0, 0, 0, 128, 1, 15, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 128, 96, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 96, 0, 0, 0, 128, 1, 120, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 224, 255, 15, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 192, 0, 0, 0, 128, 1, 224, 1, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 248, 63, 0, 0, 128, 1, 0, 0, 0, 0, 128, 1, 0, 0, 128, 1, 0, 15, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 24, 0, 0, 192, 0, 0, 0, 0, 0, 0, 3, 0, 0, 128, 1, 0, 120, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 32, 0, 0, 96, 0, 0, 0, 0, 0, 0, 6, 0, 0, 128, 1, 0, 192, 0, 0, 0, 8, 0, 0, 0, 0, 1, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 32, 0, 0, 32, 0, 0, 0, 0, 0, 0, 4, 0, 0, 128, 1, 0, 248, 0, 0, 0, 24, 0, 0, 0, 128, 1, 0, 0, 0, 128, 1, 128, 255, 0, 0, 0, 0, 0, 0, 0, 0, 254, 16, 0, 0, 128, 1, 0, 32, 0, 0, 48, 0, 0, 0, 0, 0, 0, 12, 0, 0, 128, 1, 0, 31, 0, 0, 0, 48, 0, 0, 0, 192, 0, 0, 0, 0, 128, 1, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 32, 0, 0, 24, 0, 0, 0, 0, 0, 0, 24, 0, 0, 128, 1, 224, 3, 0, 0, 0, 224, 255, 255, 255, 127, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 0, 16, 0, 0, 8, 0, 0, 0, 0, 0, 0, 16, 0, 0, 128, 1, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 16, 0, 0, 128, 1, 248, 15, 0, 0, 12, 0, 0, 0, 0, 0, 0, 48, 0, 0, 128, 1, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 112, 0, 0, 128, 1, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 96, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 135, 1, 0, 128, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 64, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 7, 6, 0, 128, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 64, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 128, 255, 0, 0, 0, 0, 0, 0, 0, 128, 241, 127, 12, 0, 128, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 192, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 64, 0, 0, 0, 0, 0, 0, 0, 0, 192, 248, 255, 24, 0, 128, 193, 255, 63, 0, 0, 1, 0, 0, 0, 0, 0, 0, 128, 0, 0, 128, 1, 255, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 96, 254, 255, 51, 0, 128, 1, 32, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 128, 1, 0, 128, 1, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 32, 255, 255, 39, 0, 128, 1, 32, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 128, 1, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 0, 0, 0, 0, 0, 0, 0, 0, 16, 255, 255, 71, 0, 128, 1, 32, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 128, 1, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 96, 0, 0, 0, 0, 0, 0, 0, 0, 144, 255, 255, 79, 0, 128, 1, 32, 0, 128, 131, 0, 0, 0, 0, 0, 0, 0, 0, 49, 231, 128, 1, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 0, 0, 0, 0, 0, 0, 0, 0, 200, 255, 255, 159, 0, 128, 1, 32, 0, 64, 196, 0, 0, 0, 0, 0, 0, 0, 0, 171, 24, 129, 1, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 224, 255, 0, 0, 0, 0, 0, 0, 0, 200, 255, 255, 159, 0, 128, 1, 32, 0, 64, 68, 0, 0, 0, 224, 7, 0, 0, 0, 162, 24, 129, 1, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 200, 255, 255, 159, 0, 128, 1, 32, 0, 64, 68, 0, 0, 0, 240, 15, 0, 0, 0, 162, 24, 129, 1, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 200, 255, 255, 159, 0, 128, 1, 32, 0, 64, 68, 0, 0, 0, 248, 31, 0, 0, 0, 162, 24, 129, 1, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 255, 255, 63, 1, 128, 1, 32, 0, 64, 68, 0, 0, 0, 248, 31, 0, 0, 0, 162, 24, 129, 1, 255, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 128, 7, 0, 0, 0, 0, 0, 0, 0, 228, 255, 255, 63, 1, 128, 193, 255, 63, 128, 195, 255, 255, 255, 255, 255, 255, 255, 255, 35, 231, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 68, 0, 0, 0, 0, 0, 0, 0, 228, 255, 255, 63, 1, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 200, 255, 255, 159, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 200, 255, 255, 159, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 200, 255, 255, 159, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 32, 132, 0, 0, 0, 0, 0, 0, 0, 200, 255, 255, 159, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 64, 196, 0, 0, 0, 0, 0, 0, 0, 144, 255, 255, 79, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 192, 100, 0, 0, 0, 0, 0, 0, 0, 16, 255, 255, 71, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 31, 0, 0, 0, 0, 0, 0, 0, 32, 255, 255, 39, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 96, 254, 255, 51, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 192, 248, 255, 24, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 128, 241, 127, 12, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 7, 6, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 12, 128, 1, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 120, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255};
+const uint8_t background[6144] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 127, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 187, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 127, 242, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 191, 59, 255, 255, 255, 255, 255, 255, 255, 255, 63, 231, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 155, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 224, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 31, 0, 0, 0, 128, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 207, 255, 255, 255, 63, 255, 255, 255, 255, 127, 254, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 231, 255, 255, 255, 127, 254, 255, 255, 255, 127, 254, 31, 0, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 248, 49, 254, 227, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 248, 49, 254, 227, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 135, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 247, 248, 113, 252, 241, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 63, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 159, 63, 255, 255, 255, 247, 248, 113, 252, 241, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 127, 159, 255, 255, 255, 247, 248, 113, 248, 240, 254, 255, 255, 255, 127, 254, 31, 0, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 228, 255, 255, 255, 247, 248, 241, 248, 248, 254, 255, 255, 255, 127, 254, 255, 159, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 243, 255, 255, 255, 247, 248, 241, 248, 248, 254, 255, 255, 255, 127, 254, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 112, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 228, 255, 255, 255, 247, 248, 241, 113, 252, 254, 255, 255, 255, 127, 254, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 63, 252, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 159, 255, 255, 255, 247, 248, 241, 113, 252, 254, 255, 255, 255, 127, 254, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 135, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 159, 63, 255, 255, 255, 247, 248, 241, 33, 252, 254, 255, 255, 255, 127, 254, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 247, 248, 241, 35, 254, 254, 255, 255, 255, 127, 254, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 248, 241, 35, 254, 254, 255, 255, 255, 127, 254, 31, 192, 255, 255, 255, 255, 255, 255, 255, 255, 1, 239, 255, 255, 127, 254, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 127, 248, 255, 255, 255, 247, 240, 240, 3, 254, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 249, 255, 127, 254, 63, 187, 255, 255, 255, 247, 1, 248, 7, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 127, 230, 253, 255, 127, 254, 223, 123, 255, 255, 255, 247, 1, 248, 7, 255, 254, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 127, 239, 254, 255, 127, 254, 223, 123, 255, 255, 255, 247, 7, 254, 143, 255, 254, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 239, 254, 255, 127, 254, 223, 123, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 111, 255, 255, 127, 254, 223, 123, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 63, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 38, 255, 255, 127, 254, 191, 59, 255, 255, 255, 119, 236, 134, 135, 221, 254, 255, 255, 255, 127, 254, 3, 128, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 176, 255, 255, 127, 254, 63, 155, 255, 255, 255, 247, 206, 118, 247, 221, 254, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 227, 255, 127, 62, 7, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 240, 255, 127, 254, 255, 224, 255, 255, 255, 247, 174, 246, 246, 235, 254, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 221, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 79, 230, 255, 127, 254, 255, 255, 255, 255, 255, 247, 174, 246, 134, 247, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 221, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 111, 239, 255, 127, 254, 255, 255, 255, 255, 255, 247, 110, 246, 246, 235, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 227, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 239, 255, 127, 254, 255, 255, 255, 255, 255, 247, 238, 118, 247, 221, 254, 255, 255, 255, 127, 254, 127, 0, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 239, 255, 127, 254, 255, 255, 255, 255, 255, 119, 236, 134, 135, 221, 254, 255, 255, 255, 127, 254, 159, 157, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 123, 230, 255, 127, 126, 0, 0, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 189, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 30, 0, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 240, 255, 127, 254, 63, 159, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 125, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 207, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 159, 191, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 125, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 231, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 191, 59, 255, 255, 255, 255, 255, 255, 255, 255, 1, 239, 255, 255, 127, 254, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 135, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 191, 63, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 239, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 159, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 207, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 224, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 63, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 31, 0, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 127, 0, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 62, 7, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 191, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 127, 248, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 63, 187, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 191, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 31, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 31, 0, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 191, 59, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 63, 155, 255, 255, 255, 255, 255, 255, 255, 255, 1, 239, 255, 255, 127, 254, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 224, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 0, 0, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 31, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 255, 3, 192, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 127, 224, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 63, 248, 31, 252, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 63, 159, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 247, 255, 255, 255, 255, 255, 135, 255, 255, 225, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 231, 255, 255, 255, 255, 255, 241, 255, 255, 143, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 207, 255, 255, 255, 255, 127, 252, 255, 255, 63, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 7, 192, 255, 255, 255, 31, 255, 255, 255, 255, 248, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 223, 127, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 207, 255, 255, 255, 255, 243, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 191, 63, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 227, 255, 255, 255, 255, 199, 255, 255, 255, 127, 254, 240, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 127, 159, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 249, 255, 255, 255, 255, 159, 255, 255, 255, 127, 254, 135, 255, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 31, 0, 240, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 255, 255, 255, 255, 252, 255, 255, 255, 255, 63, 255, 255, 255, 127, 254, 31, 254, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 7, 192, 255, 255, 127, 254, 255, 255, 255, 255, 127, 254, 255, 255, 127, 254, 255, 240, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 231, 255, 255, 63, 255, 255, 255, 255, 255, 255, 252, 255, 255, 127, 254, 255, 135, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 223, 255, 255, 159, 255, 255, 255, 255, 255, 255, 249, 255, 255, 127, 254, 255, 63, 255, 255, 255, 247, 255, 255, 255, 255, 254, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 223, 255, 255, 223, 255, 255, 255, 255, 255, 255, 251, 255, 255, 127, 254, 255, 7, 255, 255, 255, 231, 255, 255, 255, 127, 254, 255, 255, 255, 127, 254, 127, 0, 255, 255, 255, 255, 255, 255, 255, 255, 1, 239, 255, 255, 127, 254, 255, 223, 255, 255, 207, 255, 255, 255, 255, 255, 255, 243, 255, 255, 127, 254, 255, 224, 255, 255, 255, 207, 255, 255, 255, 63, 255, 255, 255, 255, 127, 254, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 223, 255, 255, 231, 255, 255, 255, 255, 255, 255, 231, 255, 255, 127, 254, 31, 252, 255, 255, 255, 31, 0, 0, 0, 128, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 255, 239, 255, 255, 247, 255, 255, 255, 255, 255, 255, 239, 255, 255, 127, 254, 135, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 239, 255, 255, 127, 254, 7, 240, 255, 255, 243, 255, 255, 255, 255, 255, 255, 207, 255, 255, 127, 254, 240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 143, 143, 255, 255, 127, 254, 255, 255, 255, 255, 249, 255, 255, 255, 255, 255, 255, 159, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 243, 120, 254, 255, 127, 254, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 191, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 248, 249, 255, 127, 254, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 191, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 127, 0, 255, 255, 255, 255, 255, 255, 255, 127, 14, 128, 243, 255, 127, 254, 255, 255, 255, 255, 252, 255, 255, 255, 255, 255, 255, 63, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 191, 255, 255, 255, 255, 255, 255, 255, 255, 63, 7, 0, 231, 255, 127, 62, 0, 192, 255, 255, 254, 255, 255, 255, 255, 255, 255, 127, 255, 255, 127, 254, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 159, 1, 0, 204, 255, 127, 254, 223, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 127, 254, 255, 127, 254, 255, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 0, 216, 255, 127, 254, 223, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 127, 254, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 255, 255, 255, 255, 255, 255, 255, 255, 239, 0, 0, 184, 255, 127, 254, 223, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 127, 254, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 159, 255, 255, 255, 255, 255, 255, 255, 255, 111, 0, 0, 176, 255, 127, 254, 223, 255, 127, 124, 255, 255, 255, 255, 255, 255, 255, 255, 206, 24, 127, 254, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 255, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 96, 255, 127, 254, 223, 255, 191, 59, 255, 255, 255, 255, 255, 255, 255, 255, 84, 231, 126, 254, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 31, 0, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 96, 255, 127, 254, 223, 255, 191, 187, 255, 255, 255, 31, 248, 255, 255, 255, 93, 231, 126, 254, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 96, 255, 127, 254, 223, 255, 191, 187, 255, 255, 255, 15, 240, 255, 255, 255, 93, 231, 126, 254, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 96, 255, 127, 254, 223, 255, 191, 187, 255, 255, 255, 7, 224, 255, 255, 255, 93, 231, 126, 254, 255, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 27, 0, 0, 192, 254, 127, 254, 223, 255, 191, 187, 255, 255, 255, 7, 224, 255, 255, 255, 93, 231, 126, 254, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 127, 248, 255, 255, 255, 255, 255, 255, 255, 27, 0, 0, 192, 254, 127, 62, 0, 192, 127, 60, 0, 0, 0, 0, 0, 0, 0, 0, 220, 24, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 187, 255, 255, 255, 255, 255, 255, 255, 27, 0, 0, 192, 254, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 96, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 96, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 96, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 223, 123, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 96, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 191, 59, 255, 255, 255, 255, 255, 255, 255, 111, 0, 0, 176, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 63, 155, 255, 255, 255, 255, 255, 255, 255, 239, 0, 0, 184, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 224, 255, 255, 255, 255, 255, 255, 255, 223, 0, 0, 216, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 159, 1, 0, 204, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 63, 7, 0, 231, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 127, 14, 128, 243, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 248, 249, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 243, 127, 254, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 15, 135, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
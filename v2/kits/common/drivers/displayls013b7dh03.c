@@ -48,6 +48,21 @@
 #define LS013B7DH03_CONTROL_BYTES     (0)
 #endif
 
+#ifdef LS013B7DH03_LINE_DIFF
+/* Number of bytes of pixel data in one line. */
+#define LS013B7DH03_LINE_BYTES        (LS013B7DH03_WIDTH/8)
+
+/* Number of bytes sent per line in a multi-line update: line address, pixel
+   data and dummy byte. */
+#define LS013B7DH03_LINE_PACKET_BYTES (LS013B7DH03_LINE_BYTES + 2)
+
+/* Number of lines in each of the two transmit buffers. The CPU fills one
+   buffer while the other is transmitted. */
+#ifndef LS013B7DH03_TX_LINES
+#define LS013B7DH03_TX_LINES          (4)
+#endif
+#endif
+
 #ifdef PIXEL_MATRIX_ALLOC_SUPPORT
 
   #ifdef USE_STATIC_PIXEL_MATRIX_POOL
@@ -103,6 +118,20 @@ static PixelMatrixAlign_t* pixelMatrixPool = pixelMatrixPoolBase;
 #endif
 #endif
 
+#ifdef LS013B7DH03_LINE_DIFF
+#ifdef LS013B7DH03_LINE_DIFF_CHECKSUM
+/* Checksum of the pixel data of each line on the display. */
+static uint32_t lineShadow[LS013B7DH03_HEIGHT];
+#else
+/* Copy of the pixel data of each line on the display. */
+static uint8_t  lineShadow[LS013B7DH03_HEIGHT][LS013B7DH03_LINE_BYTES];
+#endif
+
+/* Transmit buffers for multi-line updates, one extra byte for the dummy
+   byte which terminates the update command. */
+static uint8_t  txBuffer[2][LS013B7DH03_TX_LINES*LS013B7DH03_LINE_PACKET_BYTES+1];
+#endif
+
 
 /*******************************************************************************
  ************************   STATIC FUNCTION PROTOTYPES   ***********************
@@ -140,6 +169,13 @@ static EMSTATUS PixelMatrixClear( DISPLAY_Device_t*      device,
                                   unsigned int           width,
                                   unsigned int           height);
 static EMSTATUS DriverRefresh (DISPLAY_Device_t* device);
+#ifdef LS013B7DH03_LINE_DIFF
+static void     lineShadowReset(void);
+static EMSTATUS pixelMatrixDrawChanged(const uint8_t* pLine,
+                                       unsigned int   lineStride,
+                                       unsigned int   startRow,
+                                       unsigned int   height);
+#endif
 
 
 /*******************************************************************************
@@ -222,6 +258,11 @@ EMSTATUS DISPLAY_Ls013b7dh03Init(void)
 
     /* Clear display */
     DisplayClear();
+
+#ifdef LS013B7DH03_LINE_DIFF
+    /* The display is all white now. */
+    lineShadowReset();
+#endif
   }
      
   return status;
@@ -631,6 +672,20 @@ static EMSTATUS PixelMatrixDraw( DISPLAY_Device_t*      device,
      from 1, while the DISPLAY interface starts from 0. */
   startRow++;
 
+#ifdef LS013B7DH03_LINE_DIFF
+  /* Send only the lines that differ from the display contents. The control
+     bytes are not used since the lines are copied to the transmit buffers. */
+#ifdef EMWIN_WORKAROUND
+  return pixelMatrixDrawChanged((uint8_t*) pixelMatrix, userStride/8,
+                                startRow, height);
+#else
+  return pixelMatrixDrawChanged((uint8_t*) pixelMatrix,
+                                LS013B7DH03_LINE_BYTES +
+                                LS013B7DH03_CONTROL_BYTES,
+                                startRow, height);
+#endif
+#endif
+
 #ifdef USE_CONTROL_BYTES
   /* Setup line addressing in control words. */
   pixelMatrixSetup(pixelMatrix, startRow, height
@@ -685,4 +740,174 @@ static EMSTATUS PixelMatrixDraw( DISPLAY_Device_t*      device,
   return DISPLAY_EMSTATUS_OK;
 }
 
+
+#ifdef LS013B7DH03_LINE_DIFF
+#ifdef LS013B7DH03_LINE_DIFF_CHECKSUM
+/**************************************************************************//**
+ * @brief   Calculate the checksum of the pixel data of one line.
+ *
+ * @detail  32 bit FNV-1a hash of the pixel data.
+ *
+ * @param[in]  pLine  Pointer to the pixel data of the line.
+ *
+ * @return  Checksum of the line.
+ *****************************************************************************/
+static uint32_t lineChecksum(const uint8_t* pLine)
+{
+  uint32_t     hash = 2166136261UL;
+  unsigned int i;
+
+  for (i=0; i<LS013B7DH03_LINE_BYTES; i++)
+  {
+    hash ^= pLine[i];
+    hash *= 16777619UL;
+  }
+
+  return hash;
+}
+#endif
+
+
+/**************************************************************************//**
+ * @brief   Set the shadow copy of all lines to the cleared (white) display.
+ *****************************************************************************/
+static void lineShadowReset(void)
+{
+#ifdef LS013B7DH03_LINE_DIFF_CHECKSUM
+  uint8_t      whiteLine[LS013B7DH03_LINE_BYTES];
+  uint32_t     checksum;
+  unsigned int i;
+
+  memset(whiteLine, 0xff, sizeof(whiteLine));
+  checksum = lineChecksum(whiteLine);
+  for (i=0; i<LS013B7DH03_HEIGHT; i++)
+  {
+    lineShadow[i] = checksum;
+  }
+#else
+  memset(lineShadow, 0xff, sizeof(lineShadow));
+#endif
+}
+
+
+/**************************************************************************//**
+ * @brief   Compare a line with the shadow copy and update the shadow copy.
+ *
+ * @param[in]  row    Line number, starting from 0.
+ * @param[in]  pLine  Pointer to the pixel data of the line.
+ *
+ * @return  true if the line differs from the line on the display.
+ *****************************************************************************/
+static bool lineShadowUpdate(unsigned int row, const uint8_t* pLine)
+{
+#ifdef LS013B7DH03_LINE_DIFF_CHECKSUM
+  uint32_t checksum = lineChecksum(pLine);
+
+  if (lineShadow[row] == checksum)
+  {
+    return false;
+  }
+  lineShadow[row] = checksum;
+#else
+  if (0 == memcmp(lineShadow[row], pLine, LS013B7DH03_LINE_BYTES))
+  {
+    return false;
+  }
+  memcpy(lineShadow[row], pLine, LS013B7DH03_LINE_BYTES);
+#endif
+
+  return true;
+}
+
+
+/**************************************************************************//**
+ * @brief   Send the changed lines of a pixel matrix to the display.
+ *
+ * @detail  Lines which are equal to the shadow copy of the display contents
+ *          are skipped. The remaining lines are sent in one multi-line
+ *          update command. The lines are copied into two transmit buffers
+ *          in turn, so one buffer is filled while the other is transmitted
+ *          by PAL_SpiTransmitAsync.
+ *
+ * @param[in]  pLine       Pointer to the first line of the pixel matrix.
+ * @param[in]  lineStride  Number of bytes between two lines in the matrix.
+ * @param[in]  startRow    Display line number of the first line, starting
+ *                         from 1.
+ * @param[in]  height      Number of lines in the pixel matrix.
+ *
+ * @return  EMSTATUS code of the operation.
+ *****************************************************************************/
+static EMSTATUS pixelMatrixDrawChanged(const uint8_t* pLine,
+                                       unsigned int   lineStride,
+                                       unsigned int   startRow,
+                                       unsigned int   height)
+{
+  unsigned int  i;
+  unsigned int  lines    = 0;
+  unsigned int  txIdx    = 0;
+  bool          started  = false;
+  uint8_t*      pPacket;
+  uint8_t       cmd;
+
+  for (i=0; i<height; i++, pLine+=lineStride)
+  {
+    if (!lineShadowUpdate(startRow+i-1, pLine))
+    {
+      continue;
+    }
+
+    if (!started)
+    {
+      /* Assert SCS */
+      PAL_GpioPinOutSet( LCD_PORT_SCS, LCD_PIN_SCS );
+
+      /* SCS setup time: min 6us */
+      PAL_TimerMicroSecondsDelay(6);
+
+      /* Send update command, each line carries its own address. */
+      cmd = LS013B7DH03_CMD_UPDATE;
+      PAL_SpiTransmit(&cmd, 1);
+      started = true;
+    }
+
+    /* Line address, pixel data and dummy byte. */
+    pPacket    = &txBuffer[txIdx][lines*LS013B7DH03_LINE_PACKET_BYTES];
+    pPacket[0] = startRow+i;
+    memcpy(&pPacket[1], pLine, LS013B7DH03_LINE_BYTES);
+    pPacket[LS013B7DH03_LINE_PACKET_BYTES-1] = 0xff;
+
+    if (++lines == LS013B7DH03_TX_LINES)
+    {
+      /* Start transmitting this buffer, then fill the other one. The other
+         buffer is free when the transfer has been started since only one
+         transfer can be in progress. */
+      PAL_SpiTransmitAsync(txBuffer[txIdx],
+                           lines*LS013B7DH03_LINE_PACKET_BYTES);
+      txIdx ^= 1;
+      lines  = 0;
+    }
+  }
+
+  if (!started)
+  {
+    /* Display is up to date. */
+    return DISPLAY_EMSTATUS_OK;
+  }
+
+  /* Terminate the update command with a dummy byte. */
+  txBuffer[txIdx][lines*LS013B7DH03_LINE_PACKET_BYTES] = 0xff;
+  PAL_SpiTransmitAsync(txBuffer[txIdx],
+                       lines*LS013B7DH03_LINE_PACKET_BYTES+1);
+  PAL_SpiTransmitWait();
+
+  /* SCS hold time: min 2us */
+  PAL_TimerMicroSecondsDelay(2);
+
+  /* De-assert SCS */
+  PAL_GpioPinOutClear( LCD_PORT_SCS, LCD_PIN_SCS );
+
+  return DISPLAY_EMSTATUS_OK;
+}
+#endif /* LS013B7DH03_LINE_DIFF */
+
 /** @endcond */
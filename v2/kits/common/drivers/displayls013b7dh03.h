@@ -36,6 +36,13 @@ extern "C" {
 #define LS013B7DH03_WIDTH           (128)
 #define LS013B7DH03_HEIGHT          (128)
 
+#ifdef LS013B7DH03_LINE_DIFF
+/* The driver compares each line with a shadow copy of the display contents
+   and only transmits lines that have changed. Callers may draw a span of
+   rows which includes rows that have not been written to. */
+#define DISPLAY_DRAW_CHANGED_LINES_ONLY
+#endif
+
 
 /*******************************************************************************
  **************************    FUNCTION PROTOTYPES    **************************
@@ -201,6 +201,29 @@ EMSTATUS PAL_SpiShutdown (void);
 EMSTATUS PAL_SpiTransmit (uint8_t* data, unsigned int len);
 
 
+/**************************************************************************//**
+ * @brief      Start transmitting data on the SPI interface.
+ *
+ * @detail     The transfer may still be in progress when this function
+ *             returns, see PAL_SpiTransmitWait. The data buffer must not be
+ *             modified until the transfer is complete.
+ *
+ * @param[in]  data    Pointer to the data to be transmitted.
+ * @param[in]  len     Length of data to transmit.
+ *
+ * @return     EMSTATUS code of the operation.
+ *****************************************************************************/
+EMSTATUS PAL_SpiTransmitAsync (uint8_t* data, unsigned int len);
+
+
+/**************************************************************************//**
+ * @brief      Wait for a transmission on the SPI interface to complete.
+ *
+ * @return     EMSTATUS code of the operation.
+ *****************************************************************************/
+EMSTATUS PAL_SpiTransmitWait (void);
+
+
 /**************************************************************************//**
  * @brief   Initialize the PAL Timer interface
  *
@@ -38,8 +38,24 @@
 #endif
 #endif
 
+#ifdef PAL_SPI_DMA_CHANNEL
+#include "em_dma.h"
+#include "em_emu.h"
+#include "em_int.h"
+#include "dmactrl.h"
+#endif
+
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 
+/*******************************************************************************
+ ********************************  DEFINES  ************************************
+ ******************************************************************************/
+
+#ifdef PAL_SPI_DMA_CHANNEL
+/* Max number of bytes in one basic DMA cycle. */
+#define PAL_SPI_DMA_MAX_TRANSFER  (1024)
+#endif
+
 /*******************************************************************************
  ********************************  STATICS  ************************************
  ******************************************************************************/
@@ -54,6 +70,18 @@ static unsigned int gpioPinNo;
 static void rtcSetup(unsigned int frequency);
 #endif
 
+#ifdef PAL_SPI_DMA_CHANNEL
+/* Set while a DMA transfer to the SPI USART is in progress. */
+static volatile bool spiDmaActive = false;
+
+/* DMA transfer completion callback, the primary member is modified by em_dma
+   and can not be const. */
+static DMA_CB_TypeDef spiDmaCallback;
+
+static void spiDmaSetup(void);
+static void spiDmaDone(unsigned int channel, bool primary, void *user);
+#endif
+
 /*******************************************************************************
  **************************     GLOBAL FUNCTIONS      **************************
  ******************************************************************************/
@@ -79,6 +107,10 @@ EMSTATUS PAL_SpiInit (void)
   USART_InitSync( PAL_SPI_USART_UNIT, &usartInit );
   PAL_SPI_USART_UNIT->ROUTE = (USART_ROUTE_CLKPEN | USART_ROUTE_TXPEN | PAL_SPI_USART_LOCATION);
 
+#ifdef PAL_SPI_DMA_CHANNEL
+  spiDmaSetup();
+#endif
+
   return status;
 }
 
@@ -117,6 +149,11 @@ EMSTATUS PAL_SpiTransmit (uint8_t* data, unsigned int len)
 {
   EMSTATUS status = PAL_EMSTATUS_OK;
 
+#ifdef PAL_SPI_DMA_CHANNEL
+  /* Let a DMA transfer started by PAL_SpiTransmitAsync finish first. */
+  PAL_SpiTransmitWait();
+#endif
+
   while (len>0)
   {
     /* Send only one byte if len==1 or data pointer is not aligned at a 16 bit
@@ -142,6 +179,80 @@ EMSTATUS PAL_SpiTransmit (uint8_t* data, unsigned int len)
 }
 
 
+/**************************************************************************//**
+ * @brief      Start transmitting data on the SPI interface.
+ *
+ * @detail     If PAL_SPI_DMA_CHANNEL is defined the data is moved to the
+ *             USART by DMA and the function returns while the transfer is
+ *             in progress. The data buffer must not be modified until
+ *             PAL_SpiTransmitWait has returned. Without DMA support, or if
+ *             len is larger than one DMA cycle, the data is transmitted
+ *             before the function returns.
+ *
+ * @param[in]  data    Pointer to the data to be transmitted.
+ * @param[in]  len     Length of data to transmit.
+ *
+ * @return     EMSTATUS code of the operation.
+ *****************************************************************************/
+EMSTATUS PAL_SpiTransmitAsync (uint8_t* data, unsigned int len)
+{
+#ifdef PAL_SPI_DMA_CHANNEL
+  if ((len == 0) || (len > PAL_SPI_DMA_MAX_TRANSFER))
+  {
+    return PAL_SpiTransmit(data, len);
+  }
+
+  /* Only one transfer at a time. */
+  PAL_SpiTransmitWait();
+
+  spiDmaActive = true;
+  DMA_ActivateBasic(PAL_SPI_DMA_CHANNEL,
+                    true,
+                    false,
+                    (void*) &PAL_SPI_USART_UNIT->TXDATA,
+                    data,
+                    len - 1);
+
+  return PAL_EMSTATUS_OK;
+#else
+  return PAL_SpiTransmit(data, len);
+#endif
+}
+
+
+/**************************************************************************//**
+ * @brief      Wait for a transmission on the SPI interface to complete.
+ *
+ * @detail     The MCU sleeps in EM1 while a DMA transfer is in progress, and
+ *             the function returns when the last byte has been shifted out.
+ *
+ * @return     EMSTATUS code of the operation.
+ *****************************************************************************/
+EMSTATUS PAL_SpiTransmitWait (void)
+{
+#ifdef PAL_SPI_DMA_CHANNEL
+  if (spiDmaActive)
+  {
+    /* The DMA interrupt wakes up the core even when it is masked, checking
+       the flag with interrupts disabled makes sure the wakeup is not lost. */
+    INT_Disable();
+    while (spiDmaActive)
+    {
+      EMU_EnterEM1();
+      INT_Enable();
+      INT_Disable();
+    }
+    INT_Enable();
+
+    /* Wait for the last byte to be shifted out. */
+    while (!(PAL_SPI_USART_UNIT->STATUS & USART_STATUS_TXC)) ;
+  }
+#endif
+
+  return PAL_EMSTATUS_OK;
+}
+
+
 /**************************************************************************//**
  * @brief   Initialize the PAL Timer interface
  *
@@ -515,4 +626,62 @@ static void rtcSetup(unsigned int frequency)
 }
 #endif  /* INCLUDE_PAL_GPIO_PIN_AUTO_TOGGLE */
 
+
+#ifdef PAL_SPI_DMA_CHANNEL
+/**************************************************************************//**
+ * @brief   Setup the DMA channel used to transmit data to the SPI USART.
+ *
+ * @detail  The DMA controller is initialized unless another driver has
+ *          already done so. The application must include dmactrl.c, which
+ *          holds the DMA control block.
+ *****************************************************************************/
+static void spiDmaSetup(void)
+{
+  DMA_Init_TypeDef       dmaInit;
+  DMA_CfgChannel_TypeDef chnlCfg;
+  DMA_CfgDescr_TypeDef   descrCfg;
+
+  CMU_ClockEnable(cmuClock_DMA, true);
+
+  if (!(DMA->STATUS & DMA_STATUS_EN))
+  {
+    dmaInit.hprot        = 0;
+    dmaInit.controlBlock = dmaControlBlock;
+    DMA_Init(&dmaInit);
+  }
+
+  spiDmaCallback.cbFunc  = spiDmaDone;
+  spiDmaCallback.userPtr = NULL;
+  spiDmaCallback.primary = 0;
+
+  chnlCfg.highPri   = false;
+  chnlCfg.enableInt = true;
+  chnlCfg.select    = PAL_SPI_DMA_SIGNAL;
+  chnlCfg.cb        = &spiDmaCallback;
+  DMA_CfgChannel(PAL_SPI_DMA_CHANNEL, &chnlCfg);
+
+  descrCfg.dstInc  = dmaDataIncNone;
+  descrCfg.srcInc  = dmaDataInc1;
+  descrCfg.size    = dmaDataSize1;
+  descrCfg.arbRate = dmaArbitrate1;
+  descrCfg.hprot   = 0;
+  DMA_CfgDescr(PAL_SPI_DMA_CHANNEL, true, &descrCfg);
+
+  spiDmaActive = false;
+}
+
+
+/**************************************************************************//**
+ * @brief   DMA transfer completion callback, called in interrupt context.
+ *****************************************************************************/
+static void spiDmaDone(unsigned int channel, bool primary, void *user)
+{
+  (void) channel; /* Suppress compiler warning: unused parameter. */
+  (void) primary; /* Suppress compiler warning: unused parameter. */
+  (void) user;    /* Suppress compiler warning: unused parameter. */
+
+  spiDmaActive = false;
+}
+#endif /* PAL_SPI_DMA_CHANNEL */
+
 /** @endcond */
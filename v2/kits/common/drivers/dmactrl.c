@@ -19,7 +19,11 @@
 #include "em_device.h"
 #include "dmactrl.h"
 
-#if ( ( DMA_CHAN_COUNT > 4 ) && ( DMA_CHAN_COUNT <= 8 ) )
+#if ( ( DMA_CHAN_COUNT > 0 ) && ( DMA_CHAN_COUNT <= 4 ) )
+#define DMACTRL_CH_CNT      4
+#define DMACTRL_ALIGNMENT   128
+
+#elif ( ( DMA_CHAN_COUNT > 4 ) && ( DMA_CHAN_COUNT <= 8 ) )
 #define DMACTRL_CH_CNT      8
 #define DMACTRL_ALIGNMENT   256
 
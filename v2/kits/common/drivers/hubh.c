@@ -0,0 +1,482 @@
+/**************************************************************************//**
+ * @file  hubh.c
+ * @brief Host side implementation of the USB hub class.
+ * @version 3.20.7
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+#include "em_device.h"
+#include "em_usb.h"
+#include "em_int.h"
+#include "hubh.h"
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+#define HUB_CTRL_TIMEOUT    1000  /* Control transfer timeout in ms.         */
+#define HUB_DEBOUNCE_TIME   100   /* Connect debounce interval in ms.        */
+#define HUB_RESET_POLL      10    /* Port reset completion poll interval.    */
+#define HUB_RESET_TIMEOUT   50    /* Port reset timeout in poll intervals.   */
+#define HUB_RESET_RECOVERY  10    /* Reset recovery time in ms.              */
+
+#define HUB_DESC_NBRPORTS       2 /* Hub descriptor field offsets.           */
+#define HUB_DESC_PWRON2PWRGOOD  5
+
+/* Class specific hub requests are directed at the hub or at a port. */
+#define HUB_REQ_HUB_IN   (USB_SETUP_DIR_D2H | USB_SETUP_TYPE_CLASS_MASK | \
+                          USB_SETUP_RECIPIENT_DEVICE)
+#define HUB_REQ_PORT_IN  (USB_SETUP_DIR_D2H | USB_SETUP_TYPE_CLASS_MASK | \
+                          USB_SETUP_RECIPIENT_OTHER)
+#define HUB_REQ_PORT_OUT (USB_SETUP_DIR_H2D | USB_SETUP_TYPE_CLASS_MASK | \
+                          USB_SETUP_RECIPIENT_OTHER)
+
+static int  ArmStatusChange(void);
+static int  ClearPortFeature(int port, int feature);
+static bool HandlePort(int port, HUBH_Event_TypeDef *event);
+static bool QualifyDevice(uint8_t *buf);
+static int  ResetPort(int port, uint8_t *speed);
+static int  SetPortFeature(int port, int feature);
+static int  StatusChangeCallback(USB_Status_TypeDef status,
+                                 uint32_t xferred, uint32_t remaining);
+
+static USBH_Device_TypeDef device;
+static USBH_Ep_TypeDef     ep[ 1 ];
+static int                 numPorts;
+static uint32_t            portAttached;      /* Bitmap, bit n is port n.    */
+static uint32_t            portPending;       /* Ports to be examined.       */
+static volatile uint32_t   portChanged;       /* Set by the status change EP.*/
+static volatile bool       statusChangeArmed;
+
+STATIC_UBUF(ctrlBuf, 16);
+STATIC_UBUF(statusChange, 4);
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Initialize an USB connected hub.
+ *   Checks if the device is a hub, enumerates it and powers its ports.
+ *
+ * @note
+ *   This function assumes that prior calls to USBH_Init() and
+ *   USBH_WaitForDeviceConnectionB() have been performed. Only a hub directly
+ *   attached to the USB port is supported, hubs attached to a hub port are
+ *   not.
+ *   The contents of the usbDeviceInfo data buffer will be overwritten.
+ *
+ * @param[in] usbDeviceInfo
+ *   Pointer to USB enumeration information. usbDeviceInfo must have been
+ *   initialized by a prior call to USBH_WaitForDeviceConnectionB().
+ *
+ * @param[in] usbDeviceInfoSize
+ *   The size of the usbDeviceInfo data buffer.
+ *
+ * @return
+ *   Returns true on success, false otherwise.
+ ******************************************************************************/
+bool HUBH_Init(uint8_t *usbDeviceInfo, int usbDeviceInfoSize)
+{
+  int addr, port;
+
+  numPorts          = 0;
+  portAttached      = 0;
+  portPending       = 0;
+  portChanged       = 0;
+  statusChangeArmed = false;
+
+  /* Read all device descriptors. */
+  if (USBH_QueryDeviceB(usbDeviceInfo, usbDeviceInfoSize, USBH_GetPortSpeed())
+      != USB_STATUS_OK)
+    return false;
+
+  if (!QualifyDevice(usbDeviceInfo))
+    return false;
+
+  /* Activate the hub. */
+  USBH_InitDeviceData(&device, usbDeviceInfo, ep, 1, USBH_GetPortSpeed());
+
+  addr = USBH_AllocateAddress();
+  if (addr < 0)
+    return false;
+
+  if ((USBH_SetAddressB(&device, addr) != USB_STATUS_OK) ||
+      (USBH_SetConfigurationB(&device, device.confDesc.bConfigurationValue)
+       != USB_STATUS_OK))
+  {
+    USB_PRINTF("\nHub enumeration failed.");
+    return false;
+  }
+
+  /* Get the hub descriptor, the first 7 bytes hold all we need. */
+  if (USBH_ControlMsgB(&device.ep0, HUB_REQ_HUB_IN, GET_DESCRIPTOR,
+                       USB_HUB_DESCRIPTOR << 8, 0, 7, ctrlBuf,
+                       HUB_CTRL_TIMEOUT) != 7)
+  {
+    USB_PRINTF("\nCould not read hub descriptor.");
+    return false;
+  }
+
+  numPorts = EFM32_MIN(ctrlBuf[ HUB_DESC_NBRPORTS ], HUBH_MAX_PORTS);
+
+  /* Power all ports and wait until power is good. Devices already present
+   * are reported as connect changes by the hub, but examine all ports to
+   * be sure. */
+  for (port = 1; port <= numPorts; port++)
+  {
+    if (SetPortFeature(port, HUB_FEATURE_PORT_POWER) != USB_STATUS_OK)
+      return false;
+  }
+  USBTIMER_DelayMs(ctrlBuf[ HUB_DESC_PWRON2PWRGOOD ] * 2);
+
+  portPending = ((1UL << numPorts) - 1) << 1;
+
+  /* The status change endpoint shares the scheduled host channels. */
+  USBH_AssignHostChannel(&ep[ 0 ], USBH_HC_ANY);
+
+  USB_PRINTF("\n\nHub VID/PID is 0x%04X/0x%04X, %d ports, address %d",
+             device.devDesc.idVendor, device.devDesc.idProduct,
+             numPorts, device.addr);
+
+  return true;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the number of hub ports handled by the driver.
+ *
+ * @return
+ *   Number of ports, zero when no hub is initialized.
+ ******************************************************************************/
+int HUBH_GetNumPorts(void)
+{
+  return numPorts;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Read hub port status and port status change bits.
+ *
+ * @param[in] port
+ *   Hub port number.
+ *
+ * @param[out] status
+ *   Port status bits, HUBH_PORT_xxx.
+ *
+ * @param[out] change
+ *   Port status change bits, HUBH_C_PORT_xxx.
+ *
+ * @return
+ *   @ref USB_STATUS_OK on success, else an appropriate error code.
+ ******************************************************************************/
+int HUBH_GetPortStatus(int port, uint16_t *status, uint16_t *change)
+{
+  int result;
+
+  if ((port < 1) || (port > numPorts))
+  {
+    EFM_ASSERT(false);
+    return USB_STATUS_ILLEGAL;
+  }
+
+  result = USBH_ControlMsgB(&device.ep0, HUB_REQ_PORT_IN, GET_STATUS,
+                           0, port, 4, ctrlBuf, HUB_CTRL_TIMEOUT);
+  if (result != 4)
+    return result < 0 ? result : USB_STATUS_REQ_ERR;
+
+  *status = ctrlBuf[ 0 ] | (ctrlBuf[ 1 ] << 8);
+  *change = ctrlBuf[ 2 ] | (ctrlBuf[ 3 ] << 8);
+  return USB_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Process hub port status changes.
+ *
+ * @details
+ *   Call this function regularly from the main loop. Port changes signalled
+ *   by the hub status change endpoint are handled one at a time. A new
+ *   device is debounced and reset, and is reported with a
+ *   @ref HUBH_EVENT_ATTACH event. It then waits at address 0 and must be
+ *   enumerated, with @ref USBH_QueryDeviceB() and
+ *   @ref USBH_AllocateAddress(), before the next call to this function.
+ *   After a @ref HUBH_EVENT_DETACH event the application should release
+ *   the device address with @ref USBH_ReleaseAddress().
+ *   @n This function is blocking while a port is examined.
+ *
+ * @param[out] event
+ *   Port event data.
+ *
+ * @return
+ *   True if an event is returned, false otherwise.
+ ******************************************************************************/
+bool HUBH_Poll(HUBH_Event_TypeDef *event)
+{
+  int port;
+
+  event->type  = HUBH_EVENT_NONE;
+  event->port  = 0;
+  event->speed = 0;
+
+  if ((numPorts == 0) || !USBH_DeviceConnected())
+    return false;
+
+  INT_Disable();
+  portPending |= portChanged;
+  portChanged  = 0;
+  INT_Enable();
+
+  for (port = 1; port <= numPorts; port++)
+  {
+    if (portPending & (1UL << port))
+    {
+      portPending &= ~(1UL << port);
+      if (HandlePort(port, event))
+        return true;
+    }
+  }
+
+  /* All changes cleared, wait for the next status change. */
+  if (!statusChangeArmed)
+    ArmStatusChange();
+
+  return false;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Disable a hub port.
+ *
+ * @details
+ *   Use this function to disconnect a device which failed enumeration or is
+ *   not supported. The device is not reported again until it is reattached.
+ *
+ * @param[in] port
+ *   Hub port number.
+ *
+ * @return
+ *   @ref USB_STATUS_OK on success, else an appropriate error code.
+ ******************************************************************************/
+int HUBH_PortDisable(int port)
+{
+  if ((port < 1) || (port > numPorts))
+  {
+    EFM_ASSERT(false);
+    return USB_STATUS_ILLEGAL;
+  }
+
+  return ClearPortFeature(port, HUB_FEATURE_PORT_ENABLE);
+}
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/***************************************************************************//**
+ * @brief
+ *   Start a read on the hub status change endpoint.
+ ******************************************************************************/
+static int ArmStatusChange(void)
+{
+  int result;
+
+  statusChangeArmed = true;
+  result = USBH_Read(&ep[ 0 ], statusChange,
+                     EFM32_MIN(ep[ 0 ].packetSize, sizeof(statusChange)),
+                     0, StatusChangeCallback);
+  if (result != USB_STATUS_OK)
+    statusChangeArmed = false;
+
+  return result;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Hub status change endpoint transfer completion callback.
+ *   Bit 0 of the bitmap is the hub itself, bit n is port n.
+ ******************************************************************************/
+static int StatusChangeCallback(USB_Status_TypeDef status,
+                                uint32_t xferred, uint32_t remaining)
+{
+  (void)remaining;
+
+  if (status == USB_STATUS_OK)
+  {
+    portChanged |= statusChange[ 0 ];
+    if (xferred > 1)
+      portChanged |= statusChange[ 1 ] << 8;
+  }
+  statusChangeArmed = false;
+
+  return USB_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Acknowledge port status changes and check for attach/detach.
+ *
+ * @return
+ *   True if an event is returned, false otherwise.
+ ******************************************************************************/
+static bool HandlePort(int port, HUBH_Event_TypeDef *event)
+{
+  uint16_t status, change;
+  uint32_t portMask = 1UL << port;
+  uint8_t  speed;
+
+  if (HUBH_GetPortStatus(port, &status, &change) != USB_STATUS_OK)
+    return false;
+
+  if (change & HUBH_C_PORT_CONNECTION)
+    ClearPortFeature(port, HUB_FEATURE_C_PORT_CONNECTION);
+  if (change & HUBH_C_PORT_ENABLE)
+    ClearPortFeature(port, HUB_FEATURE_C_PORT_ENABLE);
+  if (change & HUBH_C_PORT_SUSPEND)
+    ClearPortFeature(port, HUB_FEATURE_C_PORT_SUSPEND);
+  if (change & HUBH_C_PORT_RESET)
+    ClearPortFeature(port, HUB_FEATURE_C_PORT_RESET);
+
+  if (change & HUBH_C_PORT_OVER_CURRENT)
+  {
+    ClearPortFeature(port, HUB_FEATURE_C_PORT_OVER_CURRENT);
+    if (status & HUBH_PORT_OVER_CURRENT)
+    {
+      portAttached &= ~portMask;
+      event->type   = HUBH_EVENT_OVERCURRENT;
+      event->port   = port;
+      return true;
+    }
+  }
+
+  /* A device which went away, maybe replaced by another one. */
+  if ((portAttached & portMask) &&
+      (!(status & HUBH_PORT_CONNECTION) || (change & HUBH_C_PORT_CONNECTION)))
+  {
+    portAttached &= ~portMask;
+    if (status & HUBH_PORT_CONNECTION)
+      portPending |= portMask;
+    event->type = HUBH_EVENT_DETACH;
+    event->port = port;
+    return true;
+  }
+
+  if ((portAttached & portMask) || !(status & HUBH_PORT_CONNECTION))
+    return false;
+
+  /* A new device, debounce connection before resetting the port. */
+  USBTIMER_DelayMs(HUB_DEBOUNCE_TIME);
+  if ((HUBH_GetPortStatus(port, &status, &change) != USB_STATUS_OK) ||
+      !(status & HUBH_PORT_CONNECTION))
+    return false;
+  if (change & HUBH_C_PORT_CONNECTION)
+  {
+    ClearPortFeature(port, HUB_FEATURE_C_PORT_CONNECTION);
+    portPending |= portMask;
+    return false;
+  }
+
+  if (ResetPort(port, &speed) != USB_STATUS_OK)
+  {
+    USB_PRINTF("\nHub port %d reset failed.", port);
+    return false;
+  }
+
+  portAttached |= portMask;
+  event->type   = HUBH_EVENT_ATTACH;
+  event->port   = port;
+  event->speed  = speed;
+  return true;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Reset a hub port and wait for the port to be enabled.
+ ******************************************************************************/
+static int ResetPort(int port, uint8_t *speed)
+{
+  uint16_t status, change;
+  int      i, result;
+
+  result = SetPortFeature(port, HUB_FEATURE_PORT_RESET);
+  if (result != USB_STATUS_OK)
+    return result;
+
+  for (i = 0; i < HUB_RESET_TIMEOUT; i++)
+  {
+    USBTIMER_DelayMs(HUB_RESET_POLL);
+    result = HUBH_GetPortStatus(port, &status, &change);
+    if (result != USB_STATUS_OK)
+      return result;
+    if (change & HUBH_C_PORT_RESET)
+      break;
+  }
+
+  if (i == HUB_RESET_TIMEOUT)
+    return USB_STATUS_TIMEOUT;
+
+  ClearPortFeature(port, HUB_FEATURE_C_PORT_RESET);
+
+  if (!(status & HUBH_PORT_ENABLE))
+    return USB_STATUS_DEVICE_MALFUNCTION;
+
+  *speed = (status & HUBH_PORT_LOW_SPEED) ? PORT_LOW_SPEED : PORT_FULL_SPEED;
+
+  USBTIMER_DelayMs(HUB_RESET_RECOVERY);
+  return USB_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Issue a SET_FEATURE hub class request to a port.
+ ******************************************************************************/
+static int SetPortFeature(int port, int feature)
+{
+  return USBH_ControlMsgB(&device.ep0, HUB_REQ_PORT_OUT, SET_FEATURE,
+                          feature, port, 0, NULL, HUB_CTRL_TIMEOUT);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Issue a CLEAR_FEATURE hub class request to a port.
+ ******************************************************************************/
+static int ClearPortFeature(int port, int feature)
+{
+  return USBH_ControlMsgB(&device.ep0, HUB_REQ_PORT_OUT, CLEAR_FEATURE,
+                          feature, port, 0, NULL, HUB_CTRL_TIMEOUT);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Check if a device is a hub with a status change endpoint.
+ *
+ * @param[in] buf
+ *   Enumeration data buffer.
+ *
+ * @return
+ *   Returns true if a valid hub, false otherwise.
+ ******************************************************************************/
+static bool QualifyDevice(uint8_t *buf)
+{
+  USB_EndpointDescriptor_TypeDef *epd;
+
+  if ((USBH_QGetDeviceDescriptor(buf)->bDeviceClass == USB_CLASS_HUB) &&
+      (USBH_QGetInterfaceDescriptor(buf, 0, 0)->bInterfaceClass == USB_CLASS_HUB) &&
+      (USBH_QGetInterfaceDescriptor(buf, 0, 0)->bNumEndpoints == 1))
+  {
+    epd = USBH_QGetEndpointDescriptor(buf, 0, 0, 0);
+    if ((epd->bmAttributes == USB_EPTYPE_INTR) &&
+        (epd->bEndpointAddress & USB_EP_DIR_IN))
+      return true;
+  }
+
+  USBH_PrintDeviceDescriptor(USBH_QGetDeviceDescriptor(buf));
+  USB_PRINTF("\nThis is not a hub, review device descriptors.");
+  return false;
+}
+
+/** @endcond */
@@ -0,0 +1,89 @@
+/***************************************************************************//**
+ * @file  hubh.h
+ * @brief Host side implementation of the USB hub class.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifndef __HUBH_H
+#define __HUBH_H
+
+/***************************************************************************//**
+ * @addtogroup Drivers
+ * @{
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup Hub
+ * @{
+ ******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Max number of hub ports handled, ports above this number are left
+ *  unpowered. Can be overridden in usbconfig.h. */
+#if !defined( HUBH_MAX_PORTS )
+#define HUBH_MAX_PORTS          4
+#endif
+
+/* Hub port status bits, see @ref HUBH_GetPortStatus(). */
+#define HUBH_PORT_CONNECTION    0x0001  /**< A device is present on the port.   */
+#define HUBH_PORT_ENABLE        0x0002  /**< Port is enabled.                   */
+#define HUBH_PORT_SUSPEND       0x0004  /**< Port is suspended.                 */
+#define HUBH_PORT_OVER_CURRENT  0x0008  /**< Port is in an overcurrent state.   */
+#define HUBH_PORT_RESET         0x0010  /**< Port reset is in progress.         */
+#define HUBH_PORT_POWER         0x0100  /**< Port is powered.                   */
+#define HUBH_PORT_LOW_SPEED     0x0200  /**< A low speed device is attached.    */
+
+/* Hub port status change bits, see @ref HUBH_GetPortStatus(). */
+#define HUBH_C_PORT_CONNECTION    0x0001  /**< Connection status changed.       */
+#define HUBH_C_PORT_ENABLE        0x0002  /**< Port disabled by an error.       */
+#define HUBH_C_PORT_SUSPEND       0x0004  /**< Resume completed.                */
+#define HUBH_C_PORT_OVER_CURRENT  0x0008  /**< Overcurrent status changed.      */
+#define HUBH_C_PORT_RESET         0x0010  /**< Port reset completed.            */
+
+/** Hub port events, see @ref HUBH_Poll(). */
+typedef enum
+{
+  HUBH_EVENT_NONE        = 0, /**< No event.                                    */
+  HUBH_EVENT_ATTACH      = 1, /**< A device is attached, reset and ready for
+                                   enumeration at address 0.                    */
+  HUBH_EVENT_DETACH      = 2, /**< A device was removed from the port.          */
+  HUBH_EVENT_OVERCURRENT = 3, /**< Port overcurrent, the hub cut port power.    */
+} HUBH_EventType_TypeDef;
+
+/** Hub port event data. */
+typedef struct
+{
+  HUBH_EventType_TypeDef type;  /**< Event type.                                */
+  uint8_t                port;  /**< Hub port number, 1..@ref HUBH_GetNumPorts(). */
+  uint8_t                speed; /**< Device speed on attach events,
+                                     @ref PORT_FULL_SPEED or @ref PORT_LOW_SPEED. */
+} HUBH_Event_TypeDef;
+
+/*** HUBH Function prototypes ***/
+
+bool HUBH_Init(uint8_t *usbDeviceInfo, int usbDeviceInfoSize);
+int  HUBH_GetNumPorts(void);
+int  HUBH_GetPortStatus(int port, uint16_t *status, uint16_t *change);
+bool HUBH_Poll(HUBH_Event_TypeDef *event);
+int  HUBH_PortDisable(int port);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} (end group Hub) */
+/** @} (end group Drivers) */
+
+#endif /* __HUBH_H */
@@ -21,7 +21,6 @@
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 
-#define DEV_ADDR    1                 /* USB bus address    */
 #define BULK_OUT    &ep[ epOutIndex ] /* Endpoint "handles" */
 #define BULK_IN     &ep[ epInIndex  ]
 
@@ -343,12 +342,12 @@ static bool QualifyDevice(uint8_t *buf)
     /* All set, activate the device. */
 
     USBH_InitDeviceData(&device, buf, ep, 2, USBH_GetPortSpeed());
-    USBH_SetAddressB(&device, DEV_ADDR);
+    USBH_SetAddressB(&device, USBH_AllocateAddress());
     USBH_SetConfigurationB(&device, device.confDesc.bConfigurationValue);
 
-    /* Assign Host Channels to the endpoints */
-    USBH_AssignHostChannel(BULK_OUT, 2);
-    USBH_AssignHostChannel(BULK_IN, 3);
+    /* Bulk transfers are one at a time, let the scheduler pick channels. */
+    USBH_AssignHostChannel(BULK_OUT, USBH_HC_ANY);
+    USBH_AssignHostChannel(BULK_IN, USBH_HC_ANY);
 
     USB_PRINTF("\n\nDevice VID/PID is 0x%04X/0x%04X, device bus speed is %s",
                device.devDesc.idVendor, device.devDesc.idProduct,
@@ -91,6 +91,13 @@ typedef struct TEXTDISPLAY_Device_t
                                            rows/lines. */
   char*                    charBuffer;  /**< Character buffer */
   char**                   charArray;   /**< Character pointer array */
+  unsigned int             head;        /**< Index in charArray of the top
+                                           line of the display. The lines
+                                           form a ring which is scrolled by
+                                           moving the head. */
+  bool*                    lineDirty;   /**< Flag per display line which is
+                                           set when the line must be
+                                           redrawn. */
 
   uint8_t                  rgbColor[3]; /**< Color for font */
 
@@ -111,6 +118,7 @@ typedef struct TEXTDISPLAY_CharBuffers_t
 
   char*           charBuffer;    /**< Character buffer */
   char**          charArray;     /**< Character pointer array */
+  bool*           lineDirty;     /**< Dirty flag array, one per line */
 } TEXTDISPLAY_CharBuffers_t;
 
 
@@ -125,20 +133,24 @@ static TEXTDISPLAY_Device_t textdisplayTbl[TEXTDISPLAY_DEVICES_MAX];
 /* Static Character buffers */
 char  charBufferDevice0[TEXTDISPLAY_DEVICE_0_LINES * TEXTDISPLAY_DEVICE_0_COLUMNS];
 char* charArrayDevice0[TEXTDISPLAY_DEVICE_0_LINES];
+bool  lineDirtyDevice0[TEXTDISPLAY_DEVICE_0_LINES];
 
 #if (TEXTDISPLAY_DEVICES_MAX == 2)
 char  charBufferDevice1[TEXTDISPLAY_DEVICE_1_LINES * TEXTDISPLAY_DEVICE_1_COLUMNS];
 char* charArrayDevice1[TEXTDISPLAY_DEVICE_1_LINES];
+bool  lineDirtyDevice1[TEXTDISPLAY_DEVICE_1_LINES];
 #endif
 
 #if (TEXTDISPLAY_DEVICES_MAX == 3)
 char  charBufferDevice2[TEXTDISPLAY_DEVICE_2_LINES * TEXTDISPLAY_DEVICE_2_COLUMNS];
 char* charArrayDevice2[TEXTDISPLAY_DEVICE_2_LINES];
+bool  lineDirtyDevice2[TEXTDISPLAY_DEVICE_2_LINES];
 #endif
 
 #if (TEXTDISPLAY_DEVICES_MAX == 4)
 char  charBufferDevice3[TEXTDISPLAY_DEVICE_3_LINES * TEXTDISPLAY_DEVICE_3_COLUMNS];
 char* charArrayDevice3[TEXTDISPLAY_DEVICE_3_LINES];
+bool  lineDirtyDevice3[TEXTDISPLAY_DEVICE_3_LINES];
 #endif
 
 
@@ -148,14 +160,16 @@ static TEXTDISPLAY_CharBuffers_t charBufferTbl[TEXTDISPLAY_DEVICES_MAX] =
       TEXTDISPLAY_DEVICE_0_LINES,
       TEXTDISPLAY_DEVICE_0_COLUMNS,
       charBufferDevice0,
-      charArrayDevice0
+      charArrayDevice0,
+      lineDirtyDevice0
     },
 #if (TEXTDISPLAY_DEVICES_MAX == 2)
     {
       TEXTDISPLAY_DEVICE_1_LINES,
       TEXTDISPLAY_DEVICE_1_COLUMNS,
       charBufferDevice1,
-      charArrayDevice1
+      charArrayDevice1,
+      lineDirtyDevice1
     },
 #endif
 #if (TEXTDISPLAY_DEVICES_MAX == 3)
@@ -163,7 +177,8 @@ static TEXTDISPLAY_CharBuffers_t charBufferTbl[TEXTDISPLAY_DEVICES_MAX] =
       TEXTDISPLAY_DEVICE_2_LINES,
       TEXTDISPLAY_DEVICE_2_COLUMNS,
       charBufferDevice2,
-      charArrayDevice2
+      charArrayDevice2,
+      lineDirtyDevice2
     },
 #endif    
 #if (TEXTDISPLAY_DEVICES_MAX == 4)
@@ -171,7 +186,8 @@ static TEXTDISPLAY_CharBuffers_t charBufferTbl[TEXTDISPLAY_DEVICES_MAX] =
       TEXTDISPLAY_DEVICE_3_LINES,
       TEXTDISPLAY_DEVICE_3_COLUMNS,
       charBufferDevice3,
-      charArrayDevice3
+      charArrayDevice3,
+      lineDirtyDevice3
     },
 #endif    
   };
@@ -184,6 +200,8 @@ static TEXTDISPLAY_CharBuffers_t charBufferTbl[TEXTDISPLAY_DEVICES_MAX] =
 /* Static functions: */
 static void TextdisplayClear    (TEXTDISPLAY_Device_t*  textdisplay);
 static void TextdisplayScrollUp (TEXTDISPLAY_Device_t*  textdisplay);
+static char* TextdisplayLine    (TEXTDISPLAY_Device_t*  textdisplay,
+                                 unsigned int           y);
 static void TextdisplayCharAdd  (TEXTDISPLAY_Device_t*  textdisplay,
                                  int                    c);
 static EMSTATUS TextdisplayLineDraw (TEXTDISPLAY_Device_t*  textdisplay,
@@ -281,6 +299,7 @@ EMSTATUS TEXTDISPLAY_New(TEXTDISPLAY_Config_t  *config,
   textdisplay->columns    = charBufferTbl[deviceNo].columns;
   textdisplay->charBuffer = charBufferTbl[deviceNo].charBuffer;
   textdisplay->charArray  = charBufferTbl[deviceNo].charArray;
+  textdisplay->lineDirty  = charBufferTbl[deviceNo].lineDirty;
 
   /* Store user configuration options */
   textdisplay->displayDeviceNo   = config->displayDeviceNo;
@@ -327,6 +346,7 @@ EMSTATUS TEXTDISPLAY_Delete(TEXTDISPLAY_Handle_t  handle)
   {
     textdisplay->charBuffer = NULL;
     textdisplay->charArray = NULL;
+    textdisplay->lineDirty = NULL;
 
     if (textdisplay->lineBuffer)
     {
@@ -399,24 +419,9 @@ EMSTATUS TEXTDISPLAY_WriteChar(TEXTDISPLAY_Handle_t  handle,
     textdisplay->updateMode = TEXTDISPLAY_UPDATE_MODE_CHAR;
   }
 
-  if (textdisplay->scrollEnable)
-  {
-    /* Update the full screen (which has been scrolled up) if we start at the
-       bottom left position and scroll is enabled. */
-    if ((0==textdisplay->xpos) && (textdisplay->ypos == textdisplay->lines-1))
-    {
-      textdisplay->updateMode  = TEXTDISPLAY_UPDATE_MODE_FULL;
-    }
-  }
-  else
-  {
-    /* Update the full screen (which is cleared) if we start at top left
-       position and scroll is not enabled. */
-    if ((0==textdisplay->xpos) && (0==textdisplay->ypos))
-    {
-      textdisplay->updateMode  = TEXTDISPLAY_UPDATE_MODE_FULL;
-    }
-  }
+  /* Lines which are changed by scrolling or clearing are marked dirty by
+     TextdisplayScrollUp and TextdisplayClear, and only the dirty lines are
+     redrawn by TextdisplayUpdate. */
 
   /* Check for form feed - clear screen */
   if (c == '\f')
@@ -500,12 +505,17 @@ EMSTATUS TEXTDISPLAY_WriteString(TEXTDISPLAY_Handle_t  handle,
       break;
 
     case '\n':
-      /* Update display before proceeding to the next line. */
-      status = TextdisplayUpdate(textdisplay);
-      if (status != TEXTDISPLAY_EMSTATUS_OK)
-        return status;
-
-      displayUpdated = true;
+      if (false == textdisplay->scrollEnable)
+      {
+        /* Update display before proceeding to the next line, which may
+           clear the screen. In scroll mode the line stays in the ring and
+           is drawn together with the other dirty lines. */
+        status = TextdisplayUpdate(textdisplay);
+        if (status != TEXTDISPLAY_EMSTATUS_OK)
+          return status;
+
+        displayUpdated = true;
+      }
 
       /* Add CR or LF to CRLF if enabled */
       if (textdisplay->lfToCrLf)
@@ -522,9 +532,11 @@ EMSTATUS TEXTDISPLAY_WriteString(TEXTDISPLAY_Handle_t  handle,
     }
 
     /* Update display if we reach the end of the line or a full display update
-       is required. */
-    if ((textdisplay->xpos >= textdisplay->columns) ||
-        (textdisplay->updateMode == TEXTDISPLAY_UPDATE_MODE_FULL))
+       is required. In scroll mode nothing is lost by postponing the update,
+       so all lines changed by the string are drawn once at the end. */
+    if ((false == textdisplay->scrollEnable) &&
+        ((textdisplay->xpos >= textdisplay->columns) ||
+         (textdisplay->updateMode == TEXTDISPLAY_UPDATE_MODE_FULL)))
     {
       status = TextdisplayUpdate(textdisplay);
       if (status != TEXTDISPLAY_EMSTATUS_OK)
@@ -570,6 +582,10 @@ static void TextdisplayClear(TEXTDISPLAY_Device_t* textdisplay)
            textdisplay->lines * textdisplay->columns);
 #endif
 
+    /* Restart the line ring at the first line of the buffer. */
+    textdisplay->head = 0;
+    memset(textdisplay->lineDirty, true, textdisplay->lines * sizeof(bool));
+
     /* Set cursor position to upper left */
     textdisplay->xpos = 0;
     textdisplay->ypos = 0;
@@ -582,28 +598,55 @@ static void TextdisplayClear(TEXTDISPLAY_Device_t* textdisplay)
 /**************************************************************************//**
  * @brief Scroll one line of characters up on the screen
  *
+ * @detail The character lines are stored in a ring. Scrolling moves the head
+ *         of the ring one line down, which makes the old top line the new
+ *         bottom line, so no characters are copied. The display itself has
+ *         no scroll offset register, so all lines are marked dirty and
+ *         are redrawn at the next update.
+ *
  * @param[in] textdisplay     Pointer to the text display device structure.
  *****************************************************************************/
 static void TextdisplayScrollUp(TEXTDISPLAY_Device_t*  textdisplay)
 {
-  unsigned int y;
-
-  /* copy all lines one line up */
-  for (y = 0; y < (textdisplay->lines - 1); y++)
-  {
-    memcpy(textdisplay->charArray[y],
-           textdisplay->charArray[y + 1],
-           textdisplay->columns);
-  }
+  /* Move the head, the old top line becomes the last line. */
+  if (++textdisplay->head >= textdisplay->lines)
+    textdisplay->head = 0;
 
   /* clear last line */
-  memset(&textdisplay->charArray[textdisplay->lines - 1][0],
+#if (FONT_ASCII_START>' ') || (FONT_ASCII_START+FONT_CHARACTERS<' ')
+  memset(TextdisplayLine(textdisplay, textdisplay->lines - 1),
+         FONT_CHARACTERS - 1,
+         textdisplay->columns);
+#else
+  memset(TextdisplayLine(textdisplay, textdisplay->lines - 1),
          0,
          textdisplay->columns);
+#endif
+
+  /* All lines have moved on the screen. */
+  memset(textdisplay->lineDirty, true, textdisplay->lines * sizeof(bool));
 
   textdisplay->xpos       = 0;
   textdisplay->ypos       = textdisplay->lines - 1;
-  textdisplay->updateMode = TEXTDISPLAY_UPDATE_MODE_FULL;
+}
+
+
+/**************************************************************************//**
+ * @brief Get the characters of a line on the screen
+ *
+ * @param[in] textdisplay     Pointer to the text display device structure.
+ * @param[in] y               Number of line/row on the screen.
+ *
+ * @return  Pointer to the characters of the line.
+ *****************************************************************************/
+static char* TextdisplayLine(TEXTDISPLAY_Device_t*  textdisplay,
+                             unsigned int           y)
+{
+  y += textdisplay->head;
+  if (y >= textdisplay->lines)
+    y -= textdisplay->lines;
+
+  return textdisplay->charArray[y];
 }
 
 
@@ -864,8 +907,9 @@ static void TextdisplayCharAdd(TEXTDISPLAY_Device_t* textdisplay,
       TextdisplayClear(textdisplay);
     }
   }
-  textdisplay->charArray[textdisplay->ypos][textdisplay->xpos] = 
+  TextdisplayLine(textdisplay, textdisplay->ypos)[textdisplay->xpos] =
     c - FONT_ASCII_START;
+  textdisplay->lineDirty[textdisplay->ypos] = true;
 
   textdisplay->xpos = textdisplay->xpos + 1;
 
@@ -888,12 +932,13 @@ static EMSTATUS TextdisplayLineDraw(TEXTDISPLAY_Device_t*  textdisplay,
   uint8_t      c;
   FontBits_t*  rowPtr = (FontBits_t*) textdisplay->lineBuffer;
   FontBits_t   pixelBits;
+  char*        line = TextdisplayLine(textdisplay, y);
 
   for (i = 0; i < FONT_HEIGHT; i++)
   {
     for (x = 0; x < textdisplay->columns; x++)
     {
-      c = textdisplay->charArray[y][x];
+      c = line[x];
 
       pixelBits = fontBits[c + FONT_CHARACTERS * i];
 
@@ -973,6 +1018,9 @@ static EMSTATUS TextdisplayLineDraw(TEXTDISPLAY_Device_t*  textdisplay,
 /**************************************************************************//**
  * @brief  Update display
  *
+ * @detail Draws the lines which are marked dirty. In full update mode all
+ *         lines are drawn and the unused part of the screen is cleared.
+ *
  * @param[in] textdisplay     Pointer to the text display device structure.
  *
  * @return  EMSTATUS code of the operation.
@@ -982,83 +1030,78 @@ static EMSTATUS TextdisplayUpdate(TEXTDISPLAY_Device_t*  textdisplay)
   unsigned int  i;
   EMSTATUS      status;
 
-  switch (textdisplay->updateMode)
+  switch (textdisplay->displayDevice.addressMode)
   {
-  case TEXTDISPLAY_UPDATE_MODE_NONE:
-  default:
+  case DISPLAY_ADDRESSING_BY_ROWS_ONLY:
     break;
 
-  case TEXTDISPLAY_UPDATE_MODE_FULL:
+  default:
+    if (TEXTDISPLAY_UPDATE_MODE_NONE == textdisplay->updateMode)
+      return TEXTDISPLAY_EMSTATUS_OK;
+    return TEXTDISPLAY_EMSTATUS_NOT_SUPPORTED;
+  }
 
+  if (TEXTDISPLAY_UPDATE_MODE_FULL == textdisplay->updateMode)
+  {
     /* Draw a full screen */
 
-    switch (textdisplay->displayDevice.addressMode)
-    {
-    case DISPLAY_ADDRESSING_BY_ROWS_ONLY:
-
-      /* Update all text lines. */
-      for (i=0; i<textdisplay->lines; i++)
-        /* Draw the current text line on the display. */
-        TextdisplayLineDraw(textdisplay, i);
+    /* Redraw all text lines. */
+    memset(textdisplay->lineDirty, true, textdisplay->lines * sizeof(bool));
 
-      /* Clear lowest and unused part of the screen. */
-      if (textdisplay->lines * FONT_HEIGHT <
-          textdisplay->displayDevice.geometry.height)
+    /* Clear lowest and unused part of the screen. */
+    if (textdisplay->lines * FONT_HEIGHT <
+        textdisplay->displayDevice.geometry.height)
+    {
+      switch (textdisplay->displayDevice.colourMode)
       {
-        switch (textdisplay->displayDevice.colourMode)
-        {
-        case DISPLAY_COLOUR_MODE_MONOCHROME:
-          memset (textdisplay->lineBuffer, 0x00,
-                  textdisplay->displayDevice.geometry.width/8);
-          break;
-        case DISPLAY_COLOUR_MODE_MONOCHROME_INVERSE:
-          memset (textdisplay->lineBuffer, 0xff,
-                  textdisplay->displayDevice.geometry.width/8);
-          break;
-        default:
-          return TEXTDISPLAY_EMSTATUS_NOT_SUPPORTED;
-        }
+      case DISPLAY_COLOUR_MODE_MONOCHROME:
+        memset (textdisplay->lineBuffer, 0x00,
+                textdisplay->displayDevice.geometry.width/8);
+        break;
+      case DISPLAY_COLOUR_MODE_MONOCHROME_INVERSE:
+        memset (textdisplay->lineBuffer, 0xff,
+                textdisplay->displayDevice.geometry.width/8);
+        break;
+      default:
+        return TEXTDISPLAY_EMSTATUS_NOT_SUPPORTED;
+      }
 
-        for (i = textdisplay->lines * FONT_HEIGHT;
-             i < textdisplay->displayDevice.geometry.height;
-             i++)
-        {
-          status =
-            textdisplay->displayDevice.pPixelMatrixDraw(&textdisplay->displayDevice,
-                                                        textdisplay->lineBuffer,
-                                                        0,
-                                                        textdisplay->displayDevice.geometry.width,
+      for (i = textdisplay->lines * FONT_HEIGHT;
+           i < textdisplay->displayDevice.geometry.height;
+           i++)
+      {
+        status =
+          textdisplay->displayDevice.pPixelMatrixDraw(&textdisplay->displayDevice,
+                                                      textdisplay->lineBuffer,
+                                                      0,
+                                                      textdisplay->displayDevice.geometry.width,
 #ifdef EMWIN_WORKAROUND
-                                                        textdisplay->displayDevice.geometry.width,
+                                                      textdisplay->displayDevice.geometry.width,
 #endif
-                                                        i,
-                                                        1);
-          if (DISPLAY_EMSTATUS_OK != status)
-            return status;
-         }
+                                                      i,
+                                                      1);
+        if (DISPLAY_EMSTATUS_OK != status)
+          return status;
       }
-      break;
-
-    default:
-      return TEXTDISPLAY_EMSTATUS_NOT_SUPPORTED;
     }
 
-  case TEXTDISPLAY_UPDATE_MODE_LINE:
+    /* The unused part is cleared, the following updates of the same write
+       only need to draw the dirty lines. */
+    textdisplay->updateMode = TEXTDISPLAY_UPDATE_MODE_LINE;
+  }
 
-    switch (textdisplay->displayDevice.addressMode)
+  /* Draw the text lines which have changed since the last update. */
+  for (i=0; i<textdisplay->lines; i++)
+  {
+    if (textdisplay->lineDirty[i])
     {
-    case DISPLAY_ADDRESSING_BY_ROWS_ONLY:
-
-      /* Draw the current text line on the display. */
-      return TextdisplayLineDraw(textdisplay, textdisplay->ypos);
-
-    default:
-      return TEXTDISPLAY_EMSTATUS_NOT_SUPPORTED;
+      status = TextdisplayLineDraw(textdisplay, i);
+      if (DISPLAY_EMSTATUS_OK != status)
+        return status;
+      textdisplay->lineDirty[i] = false;
     }
-
-  case TEXTDISPLAY_UPDATE_MODE_CHAR:
-    return TEXTDISPLAY_EMSTATUS_NOT_SUPPORTED;
   }
+
   return TEXTDISPLAY_EMSTATUS_OK;
 }
 
@@ -1130,7 +1173,10 @@ static EMSTATUS TextdisplayUpdate(TEXTDISPLAY_Device_t*  textdisplay)
   input parameter to the TEXTDISPLAY_New function during initialization, or by
   defining RETARGETTEXTDISPLAY_SCROLL_MODE to 'true' which enables scroll mode
   when using the retargettextdisplay module to retarget stdout to a TEXTDISPLAY
-  device.
+  device. The character lines are kept in a ring buffer, so scrolling does not
+  move any characters in memory. Each line has a dirty flag, and only lines
+  which have changed are drawn on the display. TEXTDISPLAY_WriteString draws
+  the changed lines once at the end of the string in scroll mode.
 
   The user can select whether the LINE FEED (LF) character should be
   automatically accompanied by a CARRIAGE RETURN (CR) in order to bring the
@@ -0,0 +1,893 @@
+/**************************************************************************//**
+ * @file  uacd.c
+ * @brief USB Audio Class (UAC1) Device driver.
+ * @version 3.20.7
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#include "em_device.h"
+#include "em_common.h"
+#include "em_cmu.h"
+#include "em_adc.h"
+#include "em_dac.h"
+#include "em_dma.h"
+#include "em_int.h"
+#include "em_prs.h"
+#include "em_timer.h"
+#include "dmactrl.h"
+#include "em_usb.h"
+#include "uacd.h"
+
+/**************************************************************************//**
+ *
+ * USB audio class 1.0 device, a 48 kHz 16 bit stereo speaker (DAC0) and
+ * microphone (ADC0).
+ *
+ * The DAC and ADC are triggered by TIMER0 overflow through PRS, and are
+ * serviced by DMA in ping-pong mode, one 1 ms period per buffer. Between
+ * the DMA buffers and the USB isochronous endpoints there is a ring buffer
+ * in each direction.
+ *
+ * The sample clock is not locked to the USB SOF clock. The speaker
+ * streaming endpoint is asynchronous, the rate the DAC consumes samples is
+ * reported to the host on an explicit feedback endpoint. The rate is
+ * measured by counting TIMER0 ticks over 2^UACD_FEEDBACK_REFRESH frames,
+ * TIMER1 counts TIMER0 overflows (samples) in cascade mode. The measured
+ * value is trimmed by the speaker ring buffer fill level, so that the
+ * buffer is kept half full.
+ *
+ * The microphone endpoint is asynchronous too. Each frame it sends one
+ * sample more or less than nominal when the microphone ring buffer fill
+ * level drifts away from half full.
+ *
+ * The application must call DMA_Init() before UACD_Init(), and must
+ * plug UACD_SetupCmd(), UACD_StateChangeEvent() and UACD_SofInt() into the
+ * USB device stack callback structure.
+ *
+ *****************************************************************************/
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/*** Typedef's and defines. ***/
+
+#if !defined( UACD_DMA_DAC )
+#define UACD_DMA_DAC          0           /* DMA channel used by DAC0.       */
+#endif
+#if !defined( UACD_DMA_ADC )
+#define UACD_DMA_ADC          1           /* DMA channel used by ADC0.       */
+#endif
+#if !defined( UACD_PRS_CHANNEL )
+#define UACD_PRS_CHANNEL      0           /* PRS channel TIMER0 -> ADC/DAC.  */
+#endif
+#if !defined( UACD_ADC_INPUTS )
+#define UACD_ADC_INPUTS       ( ADC_SCANCTRL_INPUTMASK_CH6 | \
+                                ADC_SCANCTRL_INPUTMASK_CH7 )
+#endif
+
+#define PERIOD_SAMPLES        UACD_FRAME_SAMPLES  /* DMA period, 1 ms.        */
+#define RING_SAMPLES          256                 /* Must be a power of 2.    */
+#define RING_MASK             ( RING_SAMPLES - 1 )
+#define RING_TARGET           ( RING_SAMPLES / 2 )
+
+#define DAC_MIDSCALE          ( ( 2048 << 16 ) | 2048 )
+#define ADC_MIDSCALE          2048
+
+#define FEEDBACK_NOMINAL      ( UACD_FRAME_SAMPLES << 14 )
+#define FEEDBACK_LIMIT        ( 1 << 14 )         /* +/- one sample/frame.    */
+#define FEEDBACK_FILL_SHIFT   6                   /* 1/256 sample per sample. */
+
+#define VOLUME_STEP_Q15       29205               /* -1 dB.                   */
+
+/*** Function prototypes. ***/
+
+static void AdcConfig( void );
+static void AdcDmaDone( unsigned int channel, bool primary, void *user );
+static int  ControlReceived( USB_Status_TypeDef status, uint32_t xferred,
+                             uint32_t remaining );
+static void DacConfig( void );
+static void DacDmaDone( unsigned int channel, bool primary, void *user );
+static int  FeedbackSent( USB_Status_TypeDef status, uint32_t xferred,
+                          uint32_t remaining );
+static int  InDataSent( USB_Status_TypeDef status, uint32_t xferred,
+                        uint32_t remaining );
+static void InSendPacket( void );
+static int  OutDataReceived( USB_Status_TypeDef status, uint32_t xferred,
+                             uint32_t remaining );
+static void SetVolume( int16_t vol );
+static void StartMicrophone( void );
+static void StartSpeaker( void );
+static void StopMicrophone( void );
+static void StopSpeaker( void );
+
+/*** Variables ***/
+
+STATIC_UBUF( outBuf0, UACD_EP_SIZE );           /* USB receive buffers.     */
+STATIC_UBUF( outBuf1, UACD_EP_SIZE );
+STATIC_UBUF( inBuf,   UACD_EP_SIZE );           /* USB transmit buffer.     */
+STATIC_UBUF( fbBuf,   UACD_FEEDBACK_SIZE );     /* Feedback value.          */
+STATIC_UBUF( ctrlBuf, 4 );                      /* Control request data.    */
+
+static uint8_t * const outBuf[ 2 ] = { outBuf0, outBuf1 };
+static int             outBufIndex;
+
+/* Speaker: USB -> ring -> DAC. Samples are stored in DAC COMBDATA format. */
+static uint32_t          outRing[ RING_SAMPLES ];
+static volatile uint32_t outHead, outTail;
+static volatile bool     outPrimed;
+static uint32_t          dacBuf[ 2 ][ PERIOD_SAMPLES ];
+
+/* Microphone: ADC -> ring -> USB. Samples are stored as USB frames. */
+static uint32_t          inRing[ RING_SAMPLES ];
+static volatile uint32_t inHead, inTail;
+static volatile bool     inPrimed;
+static uint16_t          adcBuf[ 2 ][ PERIOD_SAMPLES * UACD_CHANNELS ];
+
+static DMA_CB_TypeDef    dacCb;                 /* Must remain 'live'.      */
+static DMA_CB_TypeDef    adcCb;
+
+static volatile bool     speakerOn, micOn;
+static uint8_t           speakerAlt, micAlt;
+
+static bool              mute;
+static int16_t           volume;
+static volatile int32_t  gain;                  /* Q15, 0 when muted.       */
+
+static uint32_t          timerTicks;            /* TIMER0 ticks per sample. */
+static uint32_t          lastTicks;
+static uint32_t          sofCount;
+static bool              fbValid;
+
+static UACD_Stats_TypeDef stats;
+
+/** @endcond */
+
+/**************************************************************************//**
+ * @brief
+ *   Initialize the audio device driver, sets up DAC, ADC, DMA, PRS and
+ *   sample rate timers. Streaming starts when the host selects alternate
+ *   setting 1 on a streaming interface.
+ *****************************************************************************/
+void UACD_Init( void )
+{
+  TIMER_Init_TypeDef timerInit = TIMER_INIT_DEFAULT;
+
+  CMU_ClockEnable( cmuClock_HFPER,  true );
+  CMU_ClockEnable( cmuClock_ADC0,   true );
+  CMU_ClockEnable( cmuClock_DAC0,   true );
+  CMU_ClockEnable( cmuClock_PRS,    true );
+  CMU_ClockEnable( cmuClock_DMA,    true );
+  CMU_ClockEnable( cmuClock_TIMER0, true );
+  CMU_ClockEnable( cmuClock_TIMER1, true );
+
+  SetVolume( UACD_VOLUME_MAX );
+
+  /* TIMER0 overflow triggers DAC and ADC conversions through PRS. */
+  PRS_LevelSet( 0, 1 << ( UACD_PRS_CHANNEL + _PRS_SWLEVEL_CH0LEVEL_SHIFT ) );
+  PRS_SourceSignalSet( UACD_PRS_CHANNEL,
+                       PRS_CH_CTRL_SOURCESEL_TIMER0,
+                       PRS_CH_CTRL_SIGSEL_TIMER0OF,
+                       prsEdgePos );
+
+  DacConfig();
+  AdcConfig();
+
+  /* TIMER1 counts samples (TIMER0 overflows), used for rate feedback. */
+  timerInit.clkSel = timerClkSelCascade;
+  TIMER_TopSet( TIMER1, 0xFFFF );
+  TIMER_Init( TIMER1, &timerInit );
+
+  timerTicks = CMU_ClockFreqGet( cmuClock_HFPER ) / UACD_SAMPLE_RATE;
+  timerInit.clkSel = timerClkSelHFPerClk;
+  TIMER_TopSet( TIMER0, timerTicks - 1 );
+  TIMER_Init( TIMER0, &timerInit );
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Handle USB setup commands. Implements audio class specific commands,
+ *   and alternate setting selection on the streaming interfaces.
+ *
+ * @param[in] setup Pointer to the setup packet received.
+ *
+ * @return USB_STATUS_OK if command accepted.
+ *         USB_STATUS_REQ_UNHANDLED when command is unknown, the USB device
+ *         stack will handle the request.
+ *****************************************************************************/
+int UACD_SetupCmd( const USB_Setup_TypeDef *setup )
+{
+  int retVal = USB_STATUS_REQ_UNHANDLED;
+  uint8_t  cs     = setup->wValue >> 8;
+  uint8_t  entity = setup->wIndex >> 8;
+  int16_t  *pVol  = (int16_t*)ctrlBuf;
+  uint32_t *pFreq = (uint32_t*)ctrlBuf;
+
+  if ( ( setup->Type      == USB_SETUP_TYPE_STANDARD       ) &&
+       ( setup->Recipient == USB_SETUP_RECIPIENT_INTERFACE ) &&
+       ( ( setup->wIndex == UACD_SPEAKER_INTERFACE_NO ) ||
+         ( setup->wIndex == UACD_MIC_INTERFACE_NO     )    )    )
+  {
+    switch ( setup->bRequest )
+    {
+    case SET_INTERFACE:
+      /********************/
+      if ( ( setup->wValue > 1 ) || ( setup->wLength != 0 ) ||
+           ( USBD_GetUsbState() != USBD_STATE_CONFIGURED )    )
+      {
+        return USB_STATUS_REQ_ERR;
+      }
+
+      if ( setup->wIndex == UACD_SPEAKER_INTERFACE_NO )
+      {
+        StopSpeaker();
+        speakerAlt = setup->wValue;
+        if ( speakerAlt )
+          StartSpeaker();
+      }
+      else
+      {
+        StopMicrophone();
+        micAlt = setup->wValue;
+        if ( micAlt )
+          StartMicrophone();
+      }
+      retVal = USB_STATUS_OK;
+      break;
+
+    case GET_INTERFACE:
+      /********************/
+      if ( ( setup->wValue != 0 ) || ( setup->wLength != 1 ) )
+      {
+        return USB_STATUS_REQ_ERR;
+      }
+      ctrlBuf[ 0 ] = ( setup->wIndex == UACD_SPEAKER_INTERFACE_NO ) ?
+                     speakerAlt : micAlt;
+      retVal = USBD_Write( 0, ctrlBuf, 1, NULL );
+      break;
+    }
+  }
+
+  else if ( ( setup->Type      == USB_SETUP_TYPE_CLASS          ) &&
+            ( setup->Recipient == USB_SETUP_RECIPIENT_INTERFACE ) &&
+            ( entity           == UACD_FU_SPEAKER_ID            )    )
+  {
+    /* Feature unit controls: master channel mute and volume. */
+    if ( ( setup->wValue & 0xFF ) != 0 )
+    {
+      return USB_STATUS_REQ_ERR;
+    }
+
+    if ( ( cs == UACD_FU_MUTE_CONTROL ) && ( setup->wLength == 1 ) )
+    {
+      if ( setup->bRequest == USB_AUDIO_SET_CUR )
+      {
+        retVal = USBD_Read( 0, ctrlBuf, 1, ControlReceived );
+      }
+      else if ( setup->bRequest == USB_AUDIO_GET_CUR )
+      {
+        ctrlBuf[ 0 ] = mute;
+        retVal = USBD_Write( 0, ctrlBuf, 1, NULL );
+      }
+      else
+      {
+        retVal = USB_STATUS_REQ_ERR;
+      }
+    }
+    else if ( ( cs == UACD_FU_VOLUME_CONTROL ) && ( setup->wLength == 2 ) )
+    {
+      switch ( setup->bRequest )
+      {
+      case USB_AUDIO_SET_CUR:
+        retVal = USBD_Read( 0, ctrlBuf, 2, ControlReceived );
+        break;
+
+      case USB_AUDIO_GET_CUR:
+        *pVol  = volume;
+        retVal = USBD_Write( 0, ctrlBuf, 2, NULL );
+        break;
+
+      case USB_AUDIO_GET_MIN:
+        *pVol  = UACD_VOLUME_MIN;
+        retVal = USBD_Write( 0, ctrlBuf, 2, NULL );
+        break;
+
+      case USB_AUDIO_GET_MAX:
+        *pVol  = UACD_VOLUME_MAX;
+        retVal = USBD_Write( 0, ctrlBuf, 2, NULL );
+        break;
+
+      case USB_AUDIO_GET_RES:
+        *pVol  = UACD_VOLUME_RES;
+        retVal = USBD_Write( 0, ctrlBuf, 2, NULL );
+        break;
+
+      default:
+        retVal = USB_STATUS_REQ_ERR;
+        break;
+      }
+    }
+    else
+    {
+      retVal = USB_STATUS_REQ_ERR;
+    }
+  }
+
+  else if ( ( setup->Type      == USB_SETUP_TYPE_CLASS         ) &&
+            ( setup->Recipient == USB_SETUP_RECIPIENT_ENDPOINT ) &&
+            ( ( setup->wIndex == UACD_EP_OUT ) ||
+              ( setup->wIndex == UACD_EP_IN  )    )                 )
+  {
+    /* Sampling frequency control, only 48 kHz is supported. */
+    if ( ( cs != UACD_EP_SAMPLING_FREQ_CONTROL ) || ( setup->wLength != 3 ) )
+    {
+      return USB_STATUS_REQ_ERR;
+    }
+
+    if ( setup->bRequest == USB_AUDIO_SET_CUR )
+    {
+      retVal = USBD_Read( 0, ctrlBuf, 3, ControlReceived );
+    }
+    else if ( setup->bRequest == USB_AUDIO_GET_CUR )
+    {
+      *pFreq = UACD_SAMPLE_RATE;
+      retVal = USBD_Write( 0, ctrlBuf, 3, NULL );
+    }
+    else
+    {
+      retVal = USB_STATUS_REQ_ERR;
+    }
+  }
+
+  return retVal;
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Callback function called each time the USB device state is changed.
+ *   Stops streaming when the device is deconfigured, reset or suspended.
+ *
+ * @param[in] oldState The device state the device has just left.
+ * @param[in] newState The new device state.
+ *****************************************************************************/
+void UACD_StateChangeEvent( USBD_State_TypeDef oldState,
+                            USBD_State_TypeDef newState )
+{
+  (void)oldState;
+
+  if ( newState != USBD_STATE_CONFIGURED )
+  {
+    StopSpeaker();
+    StopMicrophone();
+    speakerAlt = 0;
+    micAlt     = 0;
+  }
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Start of frame callback. Measures the DAC sample rate relative to the
+ *   USB frame rate, and updates the speaker feedback value.
+ *
+ * @param[in] sofNr Frame number.
+ *****************************************************************************/
+void UACD_SofInt( uint16_t sofNr )
+{
+  uint32_t t0, t1, ticks, delta, wrap;
+  int32_t  fb;
+
+  (void)sofNr;
+
+  if ( !speakerOn || ( ++sofCount < ( 1 << UACD_FEEDBACK_REFRESH ) ) )
+  {
+    return;
+  }
+  sofCount = 0;
+
+  /* Sample position in TIMER0 ticks, read TIMER1 twice to catch overflow. */
+  do
+  {
+    t1 = TIMER1->CNT;
+    t0 = TIMER0->CNT;
+  } while ( t1 != TIMER1->CNT );
+
+  wrap  = 0x10000 * timerTicks;
+  ticks = ( t1 * timerTicks ) + t0;
+  delta = ( ticks + wrap - lastTicks ) % wrap;
+  lastTicks = ticks;
+
+  if ( !fbValid )
+  {
+    fbValid = true;
+    return;
+  }
+
+  /* Samples per frame in 10.14 format, trimmed by ring buffer fill level. */
+  fb  = ( delta << ( 14 - UACD_FEEDBACK_REFRESH ) ) / timerTicks;
+  fb += ( RING_TARGET - (int32_t)( outHead - outTail ) )
+        << FEEDBACK_FILL_SHIFT;
+  fb  = EFM32_MAX( fb, FEEDBACK_NOMINAL - FEEDBACK_LIMIT );
+  fb  = EFM32_MIN( fb, FEEDBACK_NOMINAL + FEEDBACK_LIMIT );
+
+  stats.feedback = fb;
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Get a copy of the streaming statistics.
+ *
+ * @param[out] s Statistics.
+ *****************************************************************************/
+void UACD_GetStats( UACD_Stats_TypeDef *s )
+{
+  INT_Disable();
+  *s = stats;
+  INT_Enable();
+}
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/**************************************************************************//**
+ * @brief Configure DAC0 and its DMA channel, stereo ping-pong.
+ *****************************************************************************/
+static void DacConfig( void )
+{
+  DMA_CfgDescr_TypeDef    descrCfg;
+  DMA_CfgChannel_TypeDef  chnlCfg;
+  DAC_Init_TypeDef        dacInit   = DAC_INIT_DEFAULT;
+  DAC_InitChannel_TypeDef dacChInit = DAC_INITCHANNEL_DEFAULT;
+  int i;
+
+  for ( i = 0; i < PERIOD_SAMPLES; i++ )
+  {
+    dacBuf[ 0 ][ i ] = DAC_MIDSCALE;
+    dacBuf[ 1 ][ i ] = DAC_MIDSCALE;
+  }
+
+  dacInit.reference = dacRefVDD;
+  DAC_Init( DAC0, &dacInit );
+  DAC0->COMBDATA = DAC_MIDSCALE;
+
+  dacChInit.enable    = true;
+  dacChInit.prsSel    = (DAC_PRSSEL_TypeDef)UACD_PRS_CHANNEL;
+  dacChInit.prsEnable = true;
+  DAC_InitChannel( DAC0, &dacChInit, 0 );         /* Right channel */
+  DAC_InitChannel( DAC0, &dacChInit, 1 );         /* Left channel  */
+
+  dacCb.cbFunc  = DacDmaDone;
+  dacCb.userPtr = NULL;
+
+  chnlCfg.highPri   = true;
+  chnlCfg.enableInt = true;
+  chnlCfg.select    = DMAREQ_DAC0_CH0;
+  chnlCfg.cb        = &dacCb;
+  DMA_CfgChannel( UACD_DMA_DAC, &chnlCfg );
+
+  descrCfg.dstInc  = dmaDataIncNone;
+  descrCfg.srcInc  = dmaDataInc4;
+  descrCfg.size    = dmaDataSize4;
+  descrCfg.arbRate = dmaArbitrate1;
+  descrCfg.hprot   = 0;
+  DMA_CfgDescr( UACD_DMA_DAC, true,  &descrCfg );
+  DMA_CfgDescr( UACD_DMA_DAC, false, &descrCfg );
+
+  DMA_ActivatePingPong( UACD_DMA_DAC,
+                        false,
+                        (void *)&DAC0->COMBDATA,
+                        dacBuf[ 0 ],
+                        PERIOD_SAMPLES - 1,
+                        (void *)&DAC0->COMBDATA,
+                        dacBuf[ 1 ],
+                        PERIOD_SAMPLES - 1 );
+}
+
+/**************************************************************************//**
+ * @brief Configure ADC0 scan mode and its DMA channel, stereo ping-pong.
+ *****************************************************************************/
+static void AdcConfig( void )
+{
+  DMA_CfgDescr_TypeDef   descrCfg;
+  DMA_CfgChannel_TypeDef chnlCfg;
+  ADC_Init_TypeDef       init     = ADC_INIT_DEFAULT;
+  ADC_InitScan_TypeDef   scanInit = ADC_INITSCAN_DEFAULT;
+
+  adcCb.cbFunc  = AdcDmaDone;
+  adcCb.userPtr = NULL;
+
+  chnlCfg.highPri   = true;
+  chnlCfg.enableInt = true;
+  chnlCfg.select    = DMAREQ_ADC0_SCAN;
+  chnlCfg.cb        = &adcCb;
+  DMA_CfgChannel( UACD_DMA_ADC, &chnlCfg );
+
+  descrCfg.dstInc  = dmaDataInc2;
+  descrCfg.srcInc  = dmaDataIncNone;
+  descrCfg.size    = dmaDataSize2;
+  descrCfg.arbRate = dmaArbitrate1;
+  descrCfg.hprot   = 0;
+  DMA_CfgDescr( UACD_DMA_ADC, true,  &descrCfg );
+  DMA_CfgDescr( UACD_DMA_ADC, false, &descrCfg );
+
+  DMA_ActivatePingPong( UACD_DMA_ADC,
+                        false,
+                        adcBuf[ 0 ],
+                        (void *)&ADC0->SCANDATA,
+                        ( PERIOD_SAMPLES * UACD_CHANNELS ) - 1,
+                        adcBuf[ 1 ],
+                        (void *)&ADC0->SCANDATA,
+                        ( PERIOD_SAMPLES * UACD_CHANNELS ) - 1 );
+
+  /* Keep warm due to "high" frequency sampling */
+  init.warmUpMode = adcWarmupKeepADCWarm;
+  init.timebase   = ADC_TimebaseCalc( 0 );
+  init.prescale   = ADC_PrescaleCalc( 4000000, 0 );
+  ADC_Init( ADC0, &init );
+
+  scanInit.prsSel    = (ADC_PRSSEL_TypeDef)UACD_PRS_CHANNEL;
+  scanInit.prsEnable = true;
+  scanInit.reference = adcRefVDD;
+  scanInit.input     = UACD_ADC_INPUTS;
+  ADC_InitScan( ADC0, &scanInit );
+}
+
+/**************************************************************************//**
+ * @brief
+ *   DMA callback, a DAC period has been played. Refill it from the speaker
+ *   ring buffer, with silence until the ring buffer is half full.
+ *****************************************************************************/
+static void DacDmaDone( unsigned int channel, bool primary, void *user )
+{
+  int i;
+  uint32_t tail, fill;
+  uint32_t *dst = primary ? dacBuf[ 0 ] : dacBuf[ 1 ];
+
+  (void)user;
+
+  tail = outTail;
+  fill = outHead - tail;
+
+  if ( !outPrimed && ( fill >= RING_TARGET ) )
+  {
+    outPrimed = true;
+  }
+
+  if ( outPrimed )
+  {
+    if ( fill < PERIOD_SAMPLES )
+    {
+      /* Underrun, play what is left and wait for the buffer to refill. */
+      stats.dacUnderruns++;
+      outPrimed = false;
+    }
+
+    for ( i = 0; i < PERIOD_SAMPLES; i++ )
+    {
+      if ( fill )
+      {
+        dst[ i ] = outRing[ tail & RING_MASK ];
+        tail++;
+        fill--;
+      }
+      else
+      {
+        dst[ i ] = DAC_MIDSCALE;
+      }
+    }
+    outTail = tail;
+  }
+  else
+  {
+    for ( i = 0; i < PERIOD_SAMPLES; i++ )
+    {
+      dst[ i ] = DAC_MIDSCALE;
+    }
+  }
+
+  DMA_RefreshPingPong( channel, primary, false, NULL, NULL,
+                       PERIOD_SAMPLES - 1, false );
+}
+
+/**************************************************************************//**
+ * @brief
+ *   DMA callback, an ADC period has been sampled. Convert it to signed 16
+ *   bit and put it in the microphone ring buffer.
+ *****************************************************************************/
+static void AdcDmaDone( unsigned int channel, bool primary, void *user )
+{
+  int i;
+  int32_t left, right;
+  uint32_t head;
+  uint16_t *src = primary ? adcBuf[ 0 ] : adcBuf[ 1 ];
+
+  (void)user;
+
+  if ( micOn )
+  {
+    head = inHead;
+    for ( i = 0; i < PERIOD_SAMPLES; i++ )
+    {
+      if ( head - inTail >= RING_SAMPLES )
+      {
+        stats.adcOverruns += PERIOD_SAMPLES - i;
+        break;
+      }
+
+      /* Scan order is right, left. USB order is left, right. */
+      right = ( (int32_t)src[ 0 ] - ADC_MIDSCALE ) << 4;
+      left  = ( (int32_t)src[ 1 ] - ADC_MIDSCALE ) << 4;
+      src  += UACD_CHANNELS;
+
+      inRing[ head & RING_MASK ] = ( (uint32_t)right << 16 ) |
+                                   ( (uint32_t)left & 0xFFFF );
+      head++;
+    }
+    inHead = head;
+  }
+
+  DMA_RefreshPingPong( channel, primary, false, NULL, NULL,
+                       ( PERIOD_SAMPLES * UACD_CHANNELS ) - 1, false );
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Called each time an audio packet is received on the speaker endpoint.
+ *   Rearms the endpoint for the next frame, then applies volume and puts
+ *   the samples in the speaker ring buffer.
+ *****************************************************************************/
+static int OutDataReceived( USB_Status_TypeDef status,
+                            uint32_t xferred,
+                            uint32_t remaining )
+{
+  uint32_t i, n, head;
+  int32_t left, right;
+  int16_t *p;
+
+  (void)remaining;
+
+  if ( ( status != USB_STATUS_OK ) || !speakerOn )
+  {
+    return USB_STATUS_OK;
+  }
+
+  p = (int16_t*)outBuf[ outBufIndex ];
+  outBufIndex ^= 1;
+  USBD_Read( UACD_EP_OUT, outBuf[ outBufIndex ], UACD_EP_SIZE, OutDataReceived );
+  stats.outPackets++;
+
+  n    = xferred / UACD_SAMPLE_SIZE;
+  head = outHead;
+  for ( i = 0; i < n; i++ )
+  {
+    if ( head - outTail >= RING_SAMPLES )
+    {
+      stats.outOverruns += n - i;
+      break;
+    }
+
+    left  = ( ( (int32_t)p[ 0 ] * gain ) >> 15 ) + 32768;
+    right = ( ( (int32_t)p[ 1 ] * gain ) >> 15 ) + 32768;
+    p    += UACD_CHANNELS;
+
+    /* DAC COMBDATA, left channel (1) in the upper half word. */
+    outRing[ head & RING_MASK ] = ( ( (uint32_t)left  >> 4 ) << 16 ) |
+                                    ( (uint32_t)right >> 4 );
+    head++;
+  }
+  outHead = head;
+
+  return USB_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Queue the next microphone packet. Sends one sample more or less than
+ *   nominal when the ring buffer fill level drifts from half full, and
+ *   silence until the ring buffer has been filled once.
+ *****************************************************************************/
+static void InSendPacket( void )
+{
+  uint32_t i, n, tail, fill;
+  uint32_t *dst = (uint32_t*)inBuf;
+
+  tail = inTail;
+  fill = inHead - tail;
+  n    = UACD_FRAME_SAMPLES;
+
+  if ( !inPrimed && ( fill >= RING_TARGET ) )
+  {
+    inPrimed = true;
+  }
+
+  if ( inPrimed )
+  {
+    if ( fill > RING_TARGET + ( UACD_FRAME_SAMPLES / 2 ) )
+      n++;
+    else if ( fill < RING_TARGET - ( UACD_FRAME_SAMPLES / 2 ) )
+      n--;
+
+    if ( fill < n )
+    {
+      inPrimed = false;
+    }
+  }
+
+  for ( i = 0; i < n; i++ )
+  {
+    if ( inPrimed )
+    {
+      dst[ i ] = inRing[ tail & RING_MASK ];
+      tail++;
+    }
+    else
+    {
+      dst[ i ] = 0;
+    }
+  }
+  inTail = tail;
+
+  USBD_Write( UACD_EP_IN, inBuf, n * UACD_SAMPLE_SIZE, InDataSent );
+}
+
+/**************************************************************************//**
+ * @brief Called each time a microphone packet has been sent.
+ *****************************************************************************/
+static int InDataSent( USB_Status_TypeDef status,
+                       uint32_t xferred,
+                       uint32_t remaining )
+{
+  (void)xferred;
+  (void)remaining;
+
+  if ( ( status == USB_STATUS_OK ) && micOn )
+  {
+    stats.inPackets++;
+    InSendPacket();
+  }
+  return USB_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * @brief
+ *   Called each time the host has read the feedback value. Queues the
+ *   latest value.
+ *****************************************************************************/
+static int FeedbackSent( USB_Status_TypeDef status,
+                         uint32_t xferred,
+                         uint32_t remaining )
+{
+  uint32_t fb = stats.feedback;
+
+  (void)xferred;
+  (void)remaining;
+
+  if ( ( status == USB_STATUS_OK ) && speakerOn )
+  {
+    fbBuf[ 0 ] = fb & 0xFF;
+    fbBuf[ 1 ] = ( fb >> 8 ) & 0xFF;
+    fbBuf[ 2 ] = ( fb >> 16 ) & 0xFF;
+    USBD_Write( UACD_EP_FEEDBACK, fbBuf, UACD_FEEDBACK_SIZE, FeedbackSent );
+  }
+  return USB_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * @brief Called when the data stage of a SET_CUR request is received.
+ *****************************************************************************/
+static int ControlReceived( USB_Status_TypeDef status,
+                            uint32_t xferred,
+                            uint32_t remaining )
+{
+  (void)remaining;
+
+  if ( status != USB_STATUS_OK )
+  {
+    return USB_STATUS_REQ_ERR;
+  }
+
+  switch ( xferred )
+  {
+  case 1:                                       /* Mute        */
+    mute = ctrlBuf[ 0 ] != 0;
+    SetVolume( volume );
+    break;
+
+  case 2:                                       /* Volume      */
+    SetVolume( *(int16_t*)ctrlBuf );
+    break;
+
+  case 3:                                       /* Sample rate */
+    if ( ( ctrlBuf[ 0 ] | ( ctrlBuf[ 1 ] << 8 ) | ( ctrlBuf[ 2 ] << 16 ) )
+         != UACD_SAMPLE_RATE )
+    {
+      return USB_STATUS_REQ_ERR;
+    }
+    break;
+
+  default:
+    return USB_STATUS_REQ_ERR;
+  }
+
+  return USB_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * @brief Set speaker volume in 1/256 dB units, rounded to whole dB.
+ *****************************************************************************/
+static void SetVolume( int16_t vol )
+{
+  int32_t g  = 32767;
+  int     dB;
+
+  vol    = EFM32_MAX( vol, UACD_VOLUME_MIN );
+  vol    = EFM32_MIN( vol, UACD_VOLUME_MAX );
+  volume = vol;
+
+  for ( dB = ( -vol + 128 ) / 256; dB > 0; dB-- )
+  {
+    g = ( g * VOLUME_STEP_Q15 ) >> 15;
+  }
+
+  gain = mute ? 0 : g;
+}
+
+/**************************************************************************//**
+ * @brief Start speaker streaming, alternate setting 1 selected.
+ *****************************************************************************/
+static void StartSpeaker( void )
+{
+  INT_Disable();
+  outHead     = 0;
+  outTail     = 0;
+  outPrimed   = false;
+  outBufIndex = 0;
+  sofCount    = 0;
+  fbValid     = false;
+  speakerOn   = true;
+  stats.feedback = FEEDBACK_NOMINAL;
+  INT_Enable();
+
+  USBD_Read( UACD_EP_OUT, outBuf[ 0 ], UACD_EP_SIZE, OutDataReceived );
+  FeedbackSent( USB_STATUS_OK, 0, 0 );
+}
+
+/**************************************************************************//**
+ * @brief Stop speaker streaming, alternate setting 0 selected.
+ *****************************************************************************/
+static void StopSpeaker( void )
+{
+  speakerOn = false;
+  USBD_AbortTransfer( UACD_EP_OUT );
+  USBD_AbortTransfer( UACD_EP_FEEDBACK );
+}
+
+/**************************************************************************//**
+ * @brief Start microphone streaming, alternate setting 1 selected.
+ *****************************************************************************/
+static void StartMicrophone( void )
+{
+  INT_Disable();
+  inHead   = 0;
+  inTail   = 0;
+  inPrimed = false;
+  micOn    = true;
+  INT_Enable();
+
+  InSendPacket();
+}
+
+/**************************************************************************//**
+ * @brief Stop microphone streaming, alternate setting 0 selected.
+ *****************************************************************************/
+static void StopMicrophone( void )
+{
+  micOn = false;
+  USBD_AbortTransfer( UACD_EP_IN );
+}
+
+/** @endcond */
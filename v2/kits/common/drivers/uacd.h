@@ -0,0 +1,103 @@
+/***************************************************************************//**
+ * @file  uacd.h
+ * @brief USB Audio Class (UAC1) Device driver.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifndef __UACD_H
+#define __UACD_H
+
+/***************************************************************************//**
+ * @addtogroup Drivers
+ * @{
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup Uac
+ * @{
+ ******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UACD_SAMPLE_RATE      48000   /**< Sample rate, both directions.          */
+#define UACD_CHANNELS         2       /**< Stereo, 16 bit samples.                */
+#define UACD_SAMPLE_SIZE      ( UACD_CHANNELS * 2 ) /**< Bytes per sample frame.  */
+
+/** Nominal number of samples in a 1 ms USB frame. */
+#define UACD_FRAME_SAMPLES    ( UACD_SAMPLE_RATE / 1000 )
+
+/** Max packet size of the audio streaming endpoints, one extra sample. */
+#define UACD_EP_SIZE          ( ( UACD_FRAME_SAMPLES + 1 ) * UACD_SAMPLE_SIZE )
+
+/** Size of the feedback endpoint packet, 10.14 format samples per frame. */
+#define UACD_FEEDBACK_SIZE    3
+
+/** Feedback endpoint refresh period is 2^UACD_FEEDBACK_REFRESH frames. */
+#define UACD_FEEDBACK_REFRESH 3
+
+/* Audio class specific descriptor subtypes and control selectors. */
+#define UACD_AC_HEADER            0x01  /**< AC interface header subtype.            */
+#define UACD_AC_INPUT_TERMINAL    0x02  /**< AC input terminal subtype.              */
+#define UACD_AC_OUTPUT_TERMINAL   0x03  /**< AC output terminal subtype.             */
+#define UACD_AC_FEATURE_UNIT      0x06  /**< AC feature unit subtype.                */
+#define UACD_AS_GENERAL           0x01  /**< AS interface general subtype.           */
+#define UACD_AS_FORMAT_TYPE       0x02  /**< AS format type subtype.                 */
+#define UACD_EP_GENERAL           0x01  /**< AS isochronous endpoint general subtype.*/
+#define UACD_FORMAT_TYPE_I        0x01  /**< Type I format.                          */
+#define UACD_FORMAT_PCM           0x0001 /**< PCM format tag.                        */
+
+#define UACD_TERMINAL_USB_STREAMING 0x0101 /**< USB streaming terminal type.         */
+#define UACD_TERMINAL_MICROPHONE    0x0201 /**< Microphone terminal type.            */
+#define UACD_TERMINAL_LINE_IN       0x0603 /**< Analog line connector terminal type. */
+#define UACD_TERMINAL_SPEAKER       0x0301 /**< Speaker terminal type.               */
+
+#define UACD_FU_MUTE_CONTROL      0x01  /**< Feature unit mute control selector.     */
+#define UACD_FU_VOLUME_CONTROL    0x02  /**< Feature unit volume control selector.   */
+#define UACD_EP_SAMPLING_FREQ_CONTROL 0x01 /**< Endpoint sampling frequency control. */
+
+/** Volume control range in 1/256 dB steps. */
+#define UACD_VOLUME_MIN       ( -60 * 256 )
+#define UACD_VOLUME_MAX       0
+#define UACD_VOLUME_RES       256
+
+/**************************************************************************//**
+ * @brief Streaming statistics, see @ref UACD_GetStats().
+ *****************************************************************************/
+typedef struct
+{
+  uint32_t  outPackets;     /**< Audio packets received from the host.       */
+  uint32_t  inPackets;      /**< Audio packets sent to the host.             */
+  uint32_t  dacUnderruns;   /**< DAC periods (partly) filled with silence.   */
+  uint32_t  outOverruns;    /**< Samples from the host dropped, buffer full. */
+  uint32_t  adcOverruns;    /**< ADC samples dropped, buffer full.           */
+  uint32_t  feedback;       /**< Last feedback value, 10.14 samples/frame.   */
+} UACD_Stats_TypeDef;
+
+/*** UACD Device Driver Function prototypes ***/
+
+void UACD_Init( void );
+int  UACD_SetupCmd( const USB_Setup_TypeDef *setup );
+void UACD_StateChangeEvent( USBD_State_TypeDef oldState,
+                            USBD_State_TypeDef newState );
+void UACD_SofInt( uint16_t sofNr );
+void UACD_GetStats( UACD_Stats_TypeDef *stats );
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} (end group Uac) */
+/** @} (end group Drivers) */
+
+#endif /* __UACD_H */
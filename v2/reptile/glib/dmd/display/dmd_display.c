@@ -51,6 +51,10 @@ EMSTATUS DMD_allocateFramebuffer(void** framebuffer);
 EMSTATUS DMD_freeFramebuffer(void* framebuffer);
 EMSTATUS DMD_copyFramebuffer (void* dst, void* src);
 
+#ifdef DISPLAY_DRAW_CHANGED_LINES_ONLY
+static EMSTATUS drawDirtySpan(unsigned int startRow, unsigned int endRow);
+#endif
+
 
 /**************************************************************************//**
 *  @brief
@@ -98,6 +102,7 @@ EMSTATUS DMD_init(DMD_InitConfig* initConfig)
   dimensions.yClipStart = 0;
   dimensions.clipWidth  = dimensions.xSize;
   dimensions.clipHeight = dimensions.ySize;
+  dimensions.pixelFormat = DMD_PIXEL_FORMAT_MONO;
 
   moduleInitialized = true;
 
@@ -183,7 +188,9 @@ EMSTATUS DMD_setClippingArea(uint16_t xStart, uint16_t yStart,
 *  Y coordinate of the first pixel to be written, relative to the clipping area
 *  @param data
 *  Array containing the pixel data.
-*  For monochrome displays, each 8-bit element contains 8 pixels values.
+*  For monochrome displays, each 8-bit element contains 8 pixels values,
+*  LSB first, and a set bit is a black pixel whatever the colour mode of
+*  the display device (see DMD_PIXEL_FORMAT_MONO).
 *  For RGB displays, each 8-bit element in the array are one color
 *  component of the pixel, so that 3 bytes represent one pixel. The pixels are
 *  ordered by increasing x coordinate, after the last pixel of a row, the next
@@ -234,6 +241,7 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
     unsigned int rowPixels;
     int          pixelColour;
     int          numBytesToCopy;
+    int          i;
     uint8_t      pixelMask;
     uint8_t      matrixByte;
     uint8_t*     pStartRow;
@@ -241,6 +249,11 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
     int          rows          = 0;
     int          pixelDataBit  = 0;
     int          bytesPerRow   = displayDevice.geometry.stride>>3;
+    /* A set data bit is a black pixel, which is a cleared bit in the
+       pixelMatrix buffer of inverse monochrome displays. */
+    uint8_t      invertMask    =
+      (displayDevice.colourMode == DISPLAY_COLOUR_MODE_MONOCHROME_INVERSE) ?
+      0xff : 0x00;
 
     /* Adjust y to account for clipping. */
     y += dimensions.yClipStart;
@@ -271,7 +284,7 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
         rowPixels += x;
         for (; x < rowPixels; x++, pixelDataBit++)
         {
-          pixelColour = (data[pixelDataBit>>3] >> pixelDataBit&0x7) & 0x1;
+          pixelColour = (data[pixelDataBit>>3] >> (pixelDataBit&0x7)) & 0x1;
           /* Write pixel data to the pixelMatrix buffer. */
           if ( ( (displayDevice.colourMode == DISPLAY_COLOUR_MODE_MONOCHROME) &&
                  pixelColour )
@@ -302,7 +315,15 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
         if (numBytesToCopy)
         {
           /* We can copy data continuosly from start to end. */
-          memcpy(pDst, &data[pixelDataBit>>3], numBytesToCopy);
+          if (invertMask)
+          {
+            for (i = 0; i < numBytesToCopy; i++)
+              pDst[i] = data[(pixelDataBit>>3) + i] ^ invertMask;
+          }
+          else
+          {
+            memcpy(pDst, &data[pixelDataBit>>3], numBytesToCopy);
+          }
           rowPixels    -= numBytesToCopy<<3;
           pixelDataBit += numBytesToCopy<<3;
           pDst         += numBytesToCopy;
@@ -316,7 +337,7 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
           matrixByte = *pDst;
           pixelMask = (1<<rowPixels)-1;
           matrixByte &= ~pixelMask;
-          matrixByte |= data[pixelDataBit>>3] & pixelMask;
+          matrixByte |= (data[pixelDataBit>>3] ^ invertMask) & pixelMask;
           *pDst = matrixByte;
           pixelDataBit += rowPixels;
         }
@@ -704,6 +725,11 @@ EMSTATUS DMD_copyFramebuffer (void* dst, void* src)
 ******************************************************************************/
 EMSTATUS DMD_updateDisplay (void)
 {
+#ifdef DISPLAY_DRAW_CHANGED_LINES_ONLY
+  /* The display driver skips rows which have not changed, all dirty rows are
+     sent in one call. */
+  return drawDirtySpan(0, displayDevice.geometry.height);
+#else
   EMSTATUS      status;
   unsigned int  startRow;
   unsigned int  consecutiveDirtyRows;
@@ -748,12 +774,12 @@ EMSTATUS DMD_updateDisplay (void)
 
     /* Shift down dirtyFlags until
        all dirtyFlags in the current dirty word have been checked,
-       then set to next dirty word.  */
+       then set to next dirty word. There is no word after the last row. */
     if ( (startRow+consecutiveDirtyRows) & DIRTY_WORD_BITS_LOG2_MASK )
     {
       dirtyFlags >>= 1;
     }
-    else
+    else if (startRow+consecutiveDirtyRows < displayDevice.geometry.height)
     {
       dirtyFlags = dirtyRows[dirtyWordCnt++];
     }
@@ -777,4 +803,147 @@ EMSTATUS DMD_updateDisplay (void)
   memset(dirtyRows, 0x0, sizeof(dirtyRows));
 
   return DMD_OK;
+#endif
 }
+
+/**************************************************************************//**
+*  @brief
+*  Update a region of the display device with contents of active framebuffer.
+*
+*  @details
+*  The display is addressed by rows, so the dirty rows/lines that intersect
+*  the region are updated in full. Their dirty flags are cleared, dirty rows
+*  outside the region are left for a later update.
+*
+*  @param x
+*  X coordinate of the top left corner of the region
+*  @param y
+*  Y coordinate of the top left corner of the region
+*  @param width
+*  Width of the region
+*  @param height
+*  Height of the region
+*
+*  @return
+*  Returns DMD_OK is successful, error otherwise.
+******************************************************************************/
+EMSTATUS DMD_updateDisplayRegion(uint16_t x, uint16_t y,
+                                 uint16_t width, uint16_t height)
+{
+  unsigned int  endRow;
+#ifndef DISPLAY_DRAW_CHANGED_LINES_ONLY
+  EMSTATUS      status;
+  unsigned int  row;
+  unsigned int  startRow             = y;
+  unsigned int  consecutiveDirtyRows = 0;
+  int           bytesPerRow          = displayDevice.geometry.stride>>3;
+#endif
+
+  (void) x;       /* Suppress compiler warning: unused parameter. */
+  (void) width;   /* Suppress compiler warning: unused parameter. */
+
+  if (!moduleInitialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  endRow = y + height;
+  if (endRow > displayDevice.geometry.height)
+  {
+    endRow = displayDevice.geometry.height;
+  }
+
+#ifdef DISPLAY_DRAW_CHANGED_LINES_ONLY
+  return drawDirtySpan(y, endRow);
+#else
+  for (row = y; row <= endRow; row++)
+  {
+    if ( (row < endRow) &&
+         (dirtyRows[row>>DIRTY_WORD_BITS_LOG2] &
+          (1 << (row & DIRTY_WORD_BITS_LOG2_MASK))) )
+    {
+      /* Clear the flag and extend the series of consecutive dirty rows. */
+      dirtyRows[row>>DIRTY_WORD_BITS_LOG2] &=
+        ~(1 << (row & DIRTY_WORD_BITS_LOG2_MASK));
+      if (0 == consecutiveDirtyRows)
+      {
+        startRow = row;
+      }
+      consecutiveDirtyRows++;
+    }
+    else if (consecutiveDirtyRows)
+    {
+      status = displayDevice.pPixelMatrixDraw(&displayDevice,
+                                              (uint8_t*) pixelMatrixBuffer +
+                                              startRow * bytesPerRow,
+                                              0,
+                                              displayDevice.geometry.width,
+                                              startRow,
+                                              consecutiveDirtyRows);
+      if (DISPLAY_EMSTATUS_OK != status)
+        return status;
+
+      consecutiveDirtyRows = 0;
+    }
+  }
+
+  return DMD_OK;
+#endif
+}
+
+#ifdef DISPLAY_DRAW_CHANGED_LINES_ONLY
+/**************************************************************************//**
+*  @brief
+*  Update the dirty rows/lines in a range of rows with one draw call.
+*
+*  @details
+*  The draw call covers the first to the last dirty row in the range,
+*  including rows in between which are not dirty. The display driver only
+*  sends rows that differ from the contents of the display, so this lets the
+*  driver send all changed rows in one command. The dirty flags of the range
+*  are cleared.
+*
+*  @param startRow
+*  First row of the range
+*  @param endRow
+*  Row after the last row of the range
+*
+*  @return
+*  Returns DMD_OK is successful, error otherwise.
+******************************************************************************/
+static EMSTATUS drawDirtySpan(unsigned int startRow, unsigned int endRow)
+{
+  unsigned int  row;
+  unsigned int  firstDirty  = endRow;
+  unsigned int  lastDirty   = 0;
+  int           bytesPerRow = displayDevice.geometry.stride>>3;
+
+  for (row = startRow; row < endRow; row++)
+  {
+    if (dirtyRows[row>>DIRTY_WORD_BITS_LOG2] &
+        (1 << (row & DIRTY_WORD_BITS_LOG2_MASK)))
+    {
+      dirtyRows[row>>DIRTY_WORD_BITS_LOG2] &=
+        ~(1 << (row & DIRTY_WORD_BITS_LOG2_MASK));
+      if (firstDirty == endRow)
+      {
+        firstDirty = row;
+      }
+      lastDirty = row;
+    }
+  }
+
+  if (firstDirty == endRow)
+  {
+    return DMD_OK;
+  }
+
+  return displayDevice.pPixelMatrixDraw(&displayDevice,
+                                        (uint8_t*) pixelMatrixBuffer +
+                                        firstDirty * bytesPerRow,
+                                        0,
+                                        displayDevice.geometry.width,
+                                        firstDirty,
+                                        lastDirty - firstDirty + 1);
+}
+#endif
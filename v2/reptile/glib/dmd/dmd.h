@@ -66,6 +66,14 @@
 #define DMD_MEMORY_TEST_HEIGHT       3
 
 
+/* Pixel data formats of DMD_writeData */
+/** Data format not described by the driver */
+#define DMD_PIXEL_FORMAT_NONE        0
+/** 24 bits per pixel, one byte each of red, green and blue */
+#define DMD_PIXEL_FORMAT_RGB888      1
+/** 1 bit per pixel packed LSB first, a set bit is a black pixel */
+#define DMD_PIXEL_FORMAT_MONO        2
+
 /** Configuration parameter for DMD_init. This typedef is defined 'void' and
     may be defined differently in the future. */
 typedef void DMD_InitConfig;
@@ -87,6 +95,8 @@ typedef struct __DMD_DisplayGeometry
   uint16_t clipWidth;
   /** Height of the clipping area */
   uint16_t clipHeight;
+  /** Format of the pixel data passed to DMD_writeData, DMD_PIXEL_FORMAT_xxx */
+  uint8_t  pixelFormat;
 } DMD_DisplayGeometry; /**< Typedef for display dimensions */
 
 /** @struct __DMD_MemoryError
@@ -126,6 +136,8 @@ EMSTATUS DMD_flipDisplay(int horizontal, int vertical);
 
 EMSTATUS DMD_selectFramebuffer (void* framebuffer);
 EMSTATUS DMD_updateDisplay (void);
+EMSTATUS DMD_updateDisplayRegion(uint16_t x, uint16_t y,
+                                 uint16_t width, uint16_t height);
 
 /* Test functions */
 EMSTATUS DMD_testParameterChecks(void);
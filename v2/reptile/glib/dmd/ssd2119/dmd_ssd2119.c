@@ -20,6 +20,9 @@
 #include "dmd_ssd2119.h"
 #include "dmd_ssd2119_registers.h"
 #include "dmdif_ssd2119_ebi.h"
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+#include "dmdif_ssd2119_dma.h"
+#endif
 
 /** Dimensions of the display */
 DMD_DisplayGeometry dimensions;
@@ -35,6 +38,16 @@ static void colorTransform18To24bpp(uint32_t color, uint8_t *red,
                                     uint8_t *green, uint8_t *blue);
 static EMSTATUS setPixelAddress(uint16_t x, uint16_t y);
 
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+static EMSTATUS writeDataDma(const uint8_t data[], uint32_t numPixels);
+static EMSTATUS writeColorDma(uint32_t color, uint32_t numPixels);
+static void transferDone(void);
+
+/* Pixel data converted for DMA, two halfwords per pixel on the 9-bit bus */
+static uint16_t dmaBuffer[2][2 * DMD_SSD2119_DMA_PIXELS];
+static void     (*transferCallback)(void) = NULL;
+#endif
+
 /**************************************************************************//**
 *  @brief
 *  Initializes the LCD display
@@ -194,6 +207,7 @@ EMSTATUS DMD_init(DMD_InitConfig* initConfig)
   dimensions.yClipStart = 0;
   dimensions.clipWidth  = dimensions.xSize;
   dimensions.clipHeight = dimensions.ySize;
+  dimensions.pixelFormat = DMD_PIXEL_FORMAT_RGB888;
 
   initialized = 1;
 
@@ -334,6 +348,13 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
     return DMD_ERROR_TOO_MUCH_DATA;
   }
 
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+  if (numPixels >= DMD_SSD2119_DMA_MIN_PIXELS)
+  {
+    return writeDataDma(data, numPixels);
+  }
+#endif
+
   /* Write data */
   DMDIF_prepareDataAccess( );
   for (i = 0; i < numPixels; i++)
@@ -486,9 +507,17 @@ EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
     return DMD_ERROR_TOO_MUCH_DATA;
   }
 
+  color = colorTransform24To18bpp(red, green, blue);
+
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+  if (numPixels >= DMD_SSD2119_DMA_MIN_PIXELS)
+  {
+    return writeColorDma(color, numPixels);
+  }
+#endif
+
   /* Write data */
   DMDIF_prepareDataAccess( );
-  color = colorTransform24To18bpp(red, green, blue);
   for (i = 0; i < numPixels; i++)
   {
     DMDIF_writeData(color);
@@ -677,3 +706,194 @@ EMSTATUS DMD_flipDisplay(int horizontal, int vertical)
 
   return DMD_OK;
 }
+
+/**************************************************************************//**
+*  @brief
+*  Update a region of the display device
+*
+*  @details
+*  The controller shows pixels as soon as they are written, there is
+*  nothing to update.
+*
+*  @param x
+*  X coordinate of the top left corner of the region
+*  @param y
+*  Y coordinate of the top left corner of the region
+*  @param width
+*  Width of the region
+*  @param height
+*  Height of the region
+*
+*  @return
+*  Returns DMD_OK is successful, error otherwise.
+******************************************************************************/
+EMSTATUS DMD_updateDisplayRegion(uint16_t x, uint16_t y,
+                                 uint16_t width, uint16_t height)
+{
+  (void) x;       /* Suppress compiler warning: unused parameter. */
+  (void) y;       /* Suppress compiler warning: unused parameter. */
+  (void) width;   /* Suppress compiler warning: unused parameter. */
+  (void) height;  /* Suppress compiler warning: unused parameter. */
+
+  if (!initialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  return DMD_OK;
+}
+
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+/**************************************************************************//**
+*  @brief
+*  Sets a function to be called when a DMA transfer started by DMD_writeData
+*  or DMD_writeColor is done. The function is called from the DMA interrupt.
+*
+*  DMD_writeData and DMD_writeColor return as soon as the last part of the
+*  pixel data is handed to the DMA. The application can render the next
+*  region while the transfer is in progress. The next call to the driver
+*  waits for the transfer to finish.
+*
+*  @param callback
+*  Function to call, or NULL
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_setTransferCallback(void (*callback)(void))
+{
+  transferCallback = callback;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks if a DMA transfer of pixel data is in progress
+*
+*  @return
+*  true while a transfer is in progress
+******************************************************************************/
+bool DMD_transferActive(void)
+{
+  return DMDIF_dmaActive();
+}
+
+/**************************************************************************//**
+*  @brief
+*  Waits until the DMA transfer of pixel data is done
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_waitTransfer(void)
+{
+  DMDIF_dmaWait();
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes pixel data by DMA. The data is converted into one buffer while the
+*  other buffer is sent, the last buffer is still being sent on return.
+*
+*  @param data
+*  Array containing the pixel data, 3 bytes per pixel
+*  @param numPixels
+*  Number of pixels to be written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+static EMSTATUS writeDataDma(const uint8_t data[], uint32_t numPixels)
+{
+  EMSTATUS statusCode;
+  uint16_t *buffer;
+  uint32_t color;
+  uint32_t n;
+  uint32_t i;
+  int      next = 0;
+
+  DMDIF_prepareDataAccess( );
+  while (numPixels > 0)
+  {
+    n = numPixels;
+    if (n > DMD_SSD2119_DMA_PIXELS) n = DMD_SSD2119_DMA_PIXELS;
+
+    /* Split each pixel like DMDIF_writeData, bits [17:9] first */
+    buffer = dmaBuffer[next];
+    for (i = 0; i < n; i++)
+    {
+      color = colorTransform24To18bpp(data[0], data[1], data[2]);
+      buffer[2 * i]     = (color & 0x0003FE00) >> 9;
+      buffer[2 * i + 1] = (color & 0x000001FF);
+      data += 3;
+    }
+    numPixels -= n;
+
+    /* Waits for the previous buffer to be sent */
+    statusCode = DMDIF_dmaWrite(buffer, 2 * n, 1,
+                                numPixels == 0 ? transferDone : NULL);
+    if (statusCode != DMD_OK)
+    {
+      return statusCode;
+    }
+
+    next ^= 1;
+  }
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a number of pixels of the same color by DMA. A buffer holding the
+*  two halfwords of the color repeatedly is sent as many times as needed, the
+*  remaining pixels are written by the CPU.
+*
+*  @param color
+*  18bpp color value
+*  @param numPixels
+*  Number of pixels to be written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+static EMSTATUS writeColorDma(uint32_t color, uint32_t numPixels)
+{
+  uint16_t *pattern = dmaBuffer[0];
+  uint32_t n;
+  uint32_t i;
+
+  n = numPixels;
+  if (n > DMD_SSD2119_DMA_PIXELS) n = DMD_SSD2119_DMA_PIXELS;
+
+  for (i = 0; i < n; i++)
+  {
+    pattern[2 * i]     = (color & 0x0003FE00) >> 9;
+    pattern[2 * i + 1] = (color & 0x000001FF);
+  }
+
+  /* Pixels which do not fill a whole pattern */
+  DMDIF_prepareDataAccess( );
+  for (i = 0; i < numPixels % n; i++)
+  {
+    DMDIF_writeData(color);
+  }
+
+  return DMDIF_dmaWrite(pattern, 2 * n, numPixels / n, transferDone);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Called from the DMA interrupt when the last transfer is done
+******************************************************************************/
+static void transferDone(void)
+{
+  if (transferCallback != NULL)
+  {
+    transferCallback();
+  }
+}
+#endif
@@ -16,6 +16,7 @@
 #ifndef __DMD_SSD2119_H
 #define __DMD_SSD2119_H
 
+#include <stdbool.h>
 #include "dmd/dmd.h"
 
 /** Frame update frequency of display */
@@ -27,4 +28,25 @@
 
 EMSTATUS DMDIF_init(uint32_t cmdRegAddr, uint32_t dataRegAddr);
 
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+/* DMA write engine. Define DMD_SSD2119_DMA_CHANNEL to the DMA channel to use,
+ * call DMA_Init() before DMDIF_init(), and add dmdif_ssd2119_dma.c to the
+ * project. Only the EBI interfaces support DMA. */
+
+/** Number of pixels converted and sent per DMA transfer by DMD_writeData.
+    Two buffers of this size are used. */
+#if !defined(DMD_SSD2119_DMA_PIXELS)
+#define DMD_SSD2119_DMA_PIXELS        320
+#endif
+
+/** Writes shorter than this number of pixels are done by the CPU */
+#if !defined(DMD_SSD2119_DMA_MIN_PIXELS)
+#define DMD_SSD2119_DMA_MIN_PIXELS    32
+#endif
+
+EMSTATUS DMD_setTransferCallback(void (*callback)(void));
+bool DMD_transferActive(void);
+EMSTATUS DMD_waitTransfer(void);
+#endif
+
 #endif
@@ -521,3 +521,39 @@ EMSTATUS DMD_flipDisplay(int horizontal, int vertical)
 
   return DMD_OK;
 }
+
+/**************************************************************************//**
+*  @brief
+*  Update a region of the display device
+*
+*  @details
+*  The controller shows pixels as soon as they are written, there is
+*  nothing to update.
+*
+*  @param x
+*  X coordinate of the top left corner of the region
+*  @param y
+*  Y coordinate of the top left corner of the region
+*  @param width
+*  Width of the region
+*  @param height
+*  Height of the region
+*
+*  @return
+*  Returns DMD_OK is successful, error otherwise.
+******************************************************************************/
+EMSTATUS DMD_updateDisplayRegion(uint16_t x, uint16_t y,
+                                 uint16_t width, uint16_t height)
+{
+  (void) x;       /* Suppress compiler warning: unused parameter. */
+  (void) y;       /* Suppress compiler warning: unused parameter. */
+  (void) width;   /* Suppress compiler warning: unused parameter. */
+  (void) height;  /* Suppress compiler warning: unused parameter. */
+
+  if (!initialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  return DMD_OK;
+}
@@ -0,0 +1,226 @@
+/*************************************************************************//***
+ * @file dmdif_ssd2119_dma.c
+ * @brief Dot matrix display SSD2119 DMA write engine for EBI interfaces
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "em_device.h"
+#include "em_dma.h"
+#include "dmd/dmd.h"
+#include "dmd_ssd2119.h"
+#include "dmdif_ssd2119_dma.h"
+
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+
+/* Local function prototypes */
+static void startSequence(void);
+static void transferComplete(unsigned int channel, bool primary, void *user);
+
+/* Data register of the display controller, NULL if DMA is not available */
+static volatile uint16_t *dmaDataReg = NULL;
+
+/* Current transfer: dmaRepeat copies of dmaLen halfwords from dmaSrc */
+static const uint16_t    *dmaSrc;
+static uint32_t          dmaLen;
+static uint32_t          dmaOffset;
+static uint32_t          dmaRepeat;
+static void              (*dmaDone)(void);
+static volatile bool     dmaBusy = false;
+
+static DMA_CB_TypeDef         dmaCallback;
+static DMA_DESCRIPTOR_TypeDef dmaDescriptors[DMDIF_DMA_DESCRIPTORS];
+
+/**************************************************************************//**
+*  @brief
+*  Initializes the DMA write engine. Called by the EBI interfaces from
+*  DMDIF_init(). The application has to call DMA_Init() before this.
+*
+*  @param dataReg
+*  The address in memory where data to the data register in the display
+*  controller are written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_dmaInit(volatile uint16_t *dataReg)
+{
+  DMA_CfgChannel_TypeDef channelConfig;
+
+  /* Wait for a transfer started before a re-initialization */
+  DMDIF_dmaWait();
+
+  dmaCallback.cbFunc  = transferComplete;
+  dmaCallback.userPtr = NULL;
+
+  channelConfig.highPri   = false;         /* No high priority */
+  channelConfig.enableInt = true;          /* Enable interrupt */
+  channelConfig.select    = 0;             /* Memory to memory transfer */
+  channelConfig.cb        = &dmaCallback;  /* Callback routine */
+  DMA_CfgChannel(DMD_SSD2119_DMA_CHANNEL, &channelConfig);
+
+  dmaDataReg = dataReg;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Starts an asynchronous write of pixel data to the LCD controller.
+*  DMDIF_prepareDataAccess() needs to be called before starting a transfer.
+*  The data is written repeat times. If len is 1 the source address is fixed,
+*  otherwise each copy of the data is sent by one or more scatter-gather
+*  descriptors. The data has to stay valid until the transfer is done.
+*
+*  @param data
+*  Halfwords to write to the data register
+*  @param len
+*  Number of halfwords in data
+*  @param repeat
+*  Number of times to write data
+*  @param done
+*  Function called from the DMA interrupt when the transfer is done, or NULL
+*
+*  @return
+*  DMD_OK on success, DMD_ERROR_NOT_SUPPORTED if DMA is not available
+******************************************************************************/
+EMSTATUS DMDIF_dmaWrite(const uint16_t data[], uint32_t len, uint32_t repeat,
+                        void (*done)(void))
+{
+  if (dmaDataReg == NULL)
+  {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+
+  DMDIF_dmaWait();
+
+  if (len == 0 || repeat == 0)
+  {
+    if (done != NULL) done();
+    return DMD_OK;
+  }
+
+  dmaSrc    = data;
+  dmaLen    = len;
+  dmaOffset = 0;
+  dmaRepeat = repeat;
+  dmaDone   = done;
+  dmaBusy   = true;
+
+  startSequence();
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks if a DMA transfer is in progress
+*
+*  @return
+*  true while a transfer started by DMDIF_dmaWrite() is in progress
+******************************************************************************/
+bool DMDIF_dmaActive(void)
+{
+  return dmaBusy;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Waits until the current DMA transfer is done. Has to be called before any
+*  other access to the LCD controller.
+******************************************************************************/
+void DMDIF_dmaWait(void)
+{
+  while (dmaBusy) ;
+}
+
+/**************************************************************************//**
+*  \brief
+*  Loads the scatter-gather descriptors for the next part of the transfer
+*  and starts the DMA
+******************************************************************************/
+static void startSequence(void)
+{
+  DMA_CfgDescrSGAlt_TypeDef descriptorConfig;
+  uint32_t                  n;
+  unsigned int              i;
+
+  /* Common values for all the descriptors */
+  descriptorConfig.dst        = (void *) dmaDataReg;
+  descriptorConfig.dstInc     = dmaDataIncNone;   /* Do not increase destination */
+  descriptorConfig.srcInc     = (dmaLen == 1) ? dmaDataIncNone : dmaDataInc2;
+  descriptorConfig.size       = dmaDataSize2;     /* Element size is 2 bytes */
+  descriptorConfig.arbRate    = dmaArbitrate1;
+  descriptorConfig.hprot      = 0;
+  descriptorConfig.peripheral = false;
+
+  for (i = 0; i < DMDIF_DMA_DESCRIPTORS && dmaRepeat > 0; i++)
+  {
+    if (dmaLen == 1)
+    {
+      /* Fixed source, one descriptor writes up to 1024 copies */
+      n = dmaRepeat;
+      if (n > DMDIF_DMA_MAX_TRANSFER) n = DMDIF_DMA_MAX_TRANSFER;
+
+      descriptorConfig.src = (void *) dmaSrc;
+      dmaRepeat           -= n;
+    }
+    else
+    {
+      /* Send the next part of the current copy of the data */
+      n = dmaLen - dmaOffset;
+      if (n > DMDIF_DMA_MAX_TRANSFER) n = DMDIF_DMA_MAX_TRANSFER;
+
+      descriptorConfig.src = (void *) (dmaSrc + dmaOffset);
+      dmaOffset           += n;
+      if (dmaOffset == dmaLen)
+      {
+        dmaOffset = 0;
+        dmaRepeat--;
+      }
+    }
+
+    descriptorConfig.nMinus1 = n - 1;
+    DMA_CfgDescrScatterGather(dmaDescriptors, i, &descriptorConfig);
+  }
+
+  DMA_ActivateScatterGather(DMD_SSD2119_DMA_CHANNEL,
+                            false,
+                            dmaDescriptors,
+                            i);
+}
+
+/**************************************************************************//**
+*  \brief
+*  Called by the DMA driver when a scatter-gather sequence is done. Continues
+*  the transfer, or marks it as done and calls the completion callback.
+******************************************************************************/
+static void transferComplete(unsigned int channel, bool primary, void *user)
+{
+  (void) channel;
+  (void) primary;
+  (void) user;
+
+  if (dmaRepeat > 0)
+  {
+    startSequence();
+    return;
+  }
+
+  dmaBusy = false;
+
+  if (dmaDone != NULL) dmaDone();
+}
+
+#endif /* defined(DMD_SSD2119_DMA_CHANNEL) */
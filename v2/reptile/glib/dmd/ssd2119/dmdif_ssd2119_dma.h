@@ -0,0 +1,39 @@
+ /*************************************************************************//**
+ * @file dmdif_ssd2119_dma.h
+ * @brief Dot matrix display SSD2119 DMA write engine for EBI interfaces
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+#ifndef __DMDIF_SSD2119_DMA_H_
+#define __DMDIF_SSD2119_DMA_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "em_types.h"
+
+/** Number of scatter-gather descriptors loaded per DMA sequence. Longer
+ *  transfers are continued from the DMA completion interrupt. */
+#if !defined(DMDIF_DMA_DESCRIPTORS)
+#define DMDIF_DMA_DESCRIPTORS    8
+#endif
+
+/** Max number of elements the DMA can transfer in one descriptor */
+#define DMDIF_DMA_MAX_TRANSFER   1024
+
+/* Module Prototypes */
+EMSTATUS DMDIF_dmaInit(volatile uint16_t *dataReg);
+EMSTATUS DMDIF_dmaWrite(const uint16_t data[], uint32_t len, uint32_t repeat,
+                        void (*done)(void));
+bool DMDIF_dmaActive(void);
+void DMDIF_dmaWait(void);
+
+#endif
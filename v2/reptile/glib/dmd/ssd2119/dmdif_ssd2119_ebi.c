@@ -17,6 +17,7 @@
 #include "dmd_ssd2119_registers.h"
 #include "dmd_ssd2119.h"
 #include "dmdif_ssd2119_ebi.h"
+#include "dmdif_ssd2119_dma.h"
 #include "bsp.h"
 
 /* Local function prototypes */
@@ -47,6 +48,11 @@ EMSTATUS DMDIF_init(uint32_t cmdRegAddr, uint32_t dataRegAddr)
 
   BSP_RegisterWrite( BC_BUS_CFG, BC_BUS_CFG_EBI );
 
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+  /* Pixel data can be written by DMA */
+  DMDIF_dmaInit(data_register);
+#endif
+
   return DMD_OK;
 }
 
@@ -190,6 +196,11 @@ static EMSTATUS setNextReg(uint8_t reg)
 {
   uint16_t data;
 
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+  /* Every access starts here, let a DMA transfer of pixel data finish first */
+  DMDIF_dmaWait();
+#endif
+
   data = ((uint16_t) reg) << 1;
 
   /* First 9 bits is 0 */
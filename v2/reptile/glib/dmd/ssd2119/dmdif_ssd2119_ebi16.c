@@ -18,6 +18,7 @@
 #include "dmd_ssd2119_registers.h"
 #include "dmd_ssd2119.h"
 #include "dmdif_ssd2119_ebi.h"
+#include "dmdif_ssd2119_dma.h"
 #include "bsp.h"
 
 /* Local function prototypes */
@@ -46,6 +47,11 @@ EMSTATUS DMDIF_init(uint32_t cmdRegAddr, uint32_t dataRegAddr)
   command_register = (volatile uint16_t*) cmdRegAddr;
   data_register    = (volatile uint16_t*) dataRegAddr;
 
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+  /* Pixel data can be written by DMA */
+  DMDIF_dmaInit(data_register);
+#endif
+
   return DMD_OK;
 }
 
@@ -212,6 +218,11 @@ static EMSTATUS setNextReg(uint8_t reg)
 {
   uint16_t data;
 
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+  /* Every access starts here, let a DMA transfer of pixel data finish first */
+  DMDIF_dmaWait();
+#endif
+
   data = reg & 0xff;
   /* Write the register address to bits [8:1] in the index register */
   *command_register = data;
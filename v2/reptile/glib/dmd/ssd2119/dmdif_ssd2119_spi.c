@@ -20,6 +20,11 @@
 #include "dmdif_ssd2119_spi.h"
 #include "bsp.h"
 
+#if defined(DMD_SSD2119_DMA_CHANNEL)
+/* The board controller SPI protocol toggles chip select for every halfword */
+#error "The SSD2119 DMA write engine needs an EBI interface"
+#endif
+
 /* Local function prototypes */
 static EMSTATUS setNextReg(uint8_t reg);
 
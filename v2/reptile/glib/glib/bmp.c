@@ -18,10 +18,14 @@
 
 /* C Standard header files */
 #include <stdint.h>
+#include <string.h>
 
 /* EM types */
 #include "em_types.h"
 
+/* Display driver, used by BMP_drawToDisplay */
+#include "dmd/dmd.h"
+
 #define MODE_RLE     (0)
 #define MODE_8BIT    (1)
 
@@ -51,6 +55,27 @@ typedef struct __BMP_RleInfo
 
 RleInfo rleInfo;
 
+/* Row streaming state, see BMP_setRowCache() */
+static uint8_t  *rowCache     = NULL;
+static uint32_t rowCacheSize  = 0;
+static uint32_t rowScale      = 1;
+/* Number of source rows held in the row cache, and the next one to use */
+static uint32_t rowsInCache   = 0;
+static uint32_t rowCacheIdx   = 0;
+/* Number of output rows returned by BMP_readRow */
+static uint32_t rowsDecoded   = 0;
+/* Buffer holding a chunk of RLE8 compressed data */
+static uint8_t  *rleChunk     = NULL;
+static uint32_t rleChunkSize  = 0;
+static uint32_t rleChunkLen   = 0;
+static uint32_t rleChunkIdx   = 0;
+/* RLE8 position left by a delta marker or an end of file marker */
+static uint32_t rleColumn     = 0;
+static uint32_t rleSkipRows   = 0;
+static uint32_t rleDone       = 0;
+/* One bit per palette index, set if the palette color is black in mono output */
+static uint8_t  monoTable[ 32 ];
+
 /* Local function pointer */
 EMSTATUS (*fpReadData)(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToRead);
 
@@ -61,6 +86,13 @@ static EMSTATUS BMP_readRawDataRLE8(BMP_DataType *dataType, uint8_t buffer[], ui
 static EMSTATUS BMP_readPaddingBytes(uint8_t paddingBytes);
 static EMSTATUS BMP_readRleData(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength);
 static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32_t *pixelsRead);
+static uint32_t BMP_accumulatorSize(uint32_t scale);
+static EMSTATUS BMP_readRleBytes(uint8_t buffer[], uint32_t count);
+static EMSTATUS BMP_decodeRleRow(uint8_t row[]);
+static EMSTATUS BMP_readSourceRow(uint8_t **row);
+static void BMP_convertRow(const uint8_t src[], uint8_t buffer[], uint8_t pixelFormat);
+static void BMP_accumulateRow(const uint8_t src[], uint16_t acc[], uint32_t outWidth);
+static void BMP_averageRow(const uint16_t acc[], uint8_t buffer[], uint8_t pixelFormat, uint32_t outWidth);
 
 /**************************************************************************//**
 *  @brief
@@ -218,6 +250,12 @@ EMSTATUS BMP_reset()
   rleInfo.pixelsRemaining = 0;
   rleInfo.pixelIdx        = 0;
 
+  /* The row cache has to be set again for the new file */
+  rowCache    = NULL;
+  rowsInCache = 0;
+  rowCacheIdx = 0;
+  rowsDecoded = 0;
+
   return BMP_OK;
 }
 
@@ -910,6 +948,690 @@ EMSTATUS BMP_readRawData(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufL
   return status;
 }
 
+/**************************************************************************//**
+*  @brief
+*  Help function to get the size of the scale down accumulator at the start of
+*  the row cache. The size is rounded up to a multiple of 4 bytes.
+*
+*  @param scale
+*  Scale down factor
+*
+*  @return
+*  Returns the accumulator size in bytes, 0 if scale is 1
+******************************************************************************/
+static uint32_t BMP_accumulatorSize(uint32_t scale)
+{
+  if (scale <= 1) return 0;
+
+  return ((bmpHeader.width / scale) * 3 * sizeof(uint16_t) + 3) & ~3UL;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Get the minimum size of the row cache passed to BMP_setRowCache().
+*
+*  The row cache holds one source row (including padding for uncompressed
+*  BMPs), and for scale > 1 an accumulator of (width / scale) * 3 halfwords.
+*  A larger row cache lets the module read several rows, or a larger chunk
+*  of RLE8 data, with each call to the read function.
+*
+*  @param scale
+*  Scale down factor, 1 to BMP_MAX_SCALE
+*
+*  @return
+*  Returns size in bytes, or -1 on error
+******************************************************************************/
+int32_t BMP_getRowCacheSize(uint32_t scale)
+{
+  /* Check if header is read correctly */
+  if (moduleInit == 0 || fileReset == 0) return -1;
+
+  if (scale < 1 || scale > BMP_MAX_SCALE) return -1;
+
+  if (bmpHeader.width < scale || bmpHeader.height < scale) return -1;
+
+  if (bmpHeader.compressionType == RLE8_COMPRESSION)
+  {
+    /* Palette indices of one decoded row */
+    return BMP_accumulatorSize(scale) + bmpHeader.width;
+  }
+
+  return BMP_accumulatorSize(scale) + bmpHeader.imageDataSize / bmpHeader.height;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the row cache used by BMP_readRow() and BMP_drawToDisplay(). Has to be
+*  called after BMP_reset() and before any data is read from the file.
+*
+*  Uncompressed data is read as whole rows straight into the row cache. RLE8
+*  data is read in chunks into the part of the row cache after the decoded
+*  row, or into the local cache if that part is smaller than
+*  BMP_LOCAL_CACHE_SIZE.
+*
+*  If scale is larger than 1, the image is scaled down while decoding. Each
+*  output pixel is the average of a block of scale * scale source pixels. The
+*  output size is (width / scale) * (height / scale), the source pixels to the
+*  right and at the top of the image which do not fill a whole block are
+*  dropped.
+*
+*  Do not mix BMP_readRow() with BMP_readRgbData() or BMP_readRawData() on
+*  the same file.
+*
+*  @param buffer
+*  Row cache, has to be word aligned
+*  @param bufLength
+*  Length of the row cache in bytes, see BMP_getRowCacheSize()
+*  @param scale
+*  Scale down factor, 1 to BMP_MAX_SCALE
+*
+*  @return
+*  Returns BMP_OK on success, or else error code
+******************************************************************************/
+EMSTATUS BMP_setRowCache(uint8_t *buffer, uint32_t bufLength, uint32_t scale)
+{
+  int32_t  size;
+  uint32_t rowOffset;
+  uint32_t rowEnd;
+  uint32_t paletteEntries;
+  uint32_t i;
+
+  /* Check if module is initialized */
+  if (moduleInit == 0) return BMP_ERROR_MODULE_NOT_INITIALIZED;
+
+  /* Check file is reset and no data is read */
+  if (fileReset == 0 || dataIdx != 0) return BMP_ERROR_FILE_NOT_RESET;
+
+  /* Check if palette is read */
+  if (bmpHeader.bitsPerPixel == 8 && paletteRead == 0) return BMP_ERROR_PALETTE_NOT_READ;
+
+  if (buffer == NULL || ((uintptr_t) buffer & 3) != 0) return BMP_ERROR_INVALID_ARGUMENT;
+
+  size = BMP_getRowCacheSize(scale);
+  if (size < 0) return BMP_ERROR_INVALID_ARGUMENT;
+
+  if (bufLength < (uint32_t) size) return BMP_ERROR_BUFFER_TOO_SMALL;
+
+  rowCache     = buffer;
+  rowCacheSize = bufLength;
+  rowScale     = scale;
+  rowsInCache  = 0;
+  rowCacheIdx  = 0;
+  rowsDecoded  = 0;
+
+  if (bmpHeader.compressionType == RLE8_COMPRESSION)
+  {
+    /* Use the space after the decoded row for compressed data if it is larger than the local cache */
+    rowOffset = BMP_accumulatorSize(scale);
+    rowEnd    = rowOffset + bmpHeader.width;
+
+    if (bufLength - rowEnd > BMP_LOCAL_CACHE_SIZE)
+    {
+      rleChunk     = buffer + rowEnd;
+      rleChunkSize = bufLength - rowEnd;
+    }
+    else
+    {
+      rleChunk     = localCache;
+      rleChunkSize = BMP_LOCAL_CACHE_SIZE;
+    }
+
+    rleChunkLen = 0;
+    rleChunkIdx = 0;
+    rleColumn   = 0;
+    rleSkipRows = 0;
+    rleDone     = 0;
+  }
+
+  if (bmpHeader.bitsPerPixel == 8)
+  {
+    /* Precalculate the mono value of each palette entry */
+    paletteEntries = (bmpHeader.dataOffset - BMP_HEADER_SIZE) / 4;
+    if (paletteEntries > 256) paletteEntries = 256;
+
+    memset(monoTable, 0, sizeof(monoTable));
+
+    for (i = 0; i < paletteEntries; ++i)
+    {
+      if (bmpPalette.data[ 4 * i + 1 ] < BMP_MONO_THRESHOLD)
+      {
+        monoTable[ i >> 3 ] |= 1 << (i & 7);
+      }
+    }
+  }
+
+  return BMP_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Help function to read bytes from the RLE8 data stream through the chunk
+*  buffer.
+*
+*  @param buffer
+*  Buffer to be filled with count bytes, or NULL to skip the bytes
+*  @param count
+*  Number of bytes to read
+*
+*  @return
+*  Returns BMP_OK on success.
+*  Returns BMP_ERROR_END_OF_FILE if the image data ends, or else error code
+******************************************************************************/
+static EMSTATUS BMP_readRleBytes(uint8_t buffer[], uint32_t count)
+{
+  EMSTATUS status;
+  uint32_t bytesToRead;
+  uint32_t bytesToCopy;
+
+  while (count > 0)
+  {
+    /* Read in the next chunk of compressed data */
+    if (rleChunkIdx == rleChunkLen)
+    {
+      if (dataIdx >= bytesInImage) return BMP_ERROR_END_OF_FILE;
+
+      bytesToRead = bytesInImage - dataIdx;
+      if (bytesToRead > rleChunkSize) bytesToRead = rleChunkSize;
+
+      status = fpReadData(rleChunk, rleChunkSize, bytesToRead);
+      if (status != BMP_OK) return status;
+
+      dataIdx    += bytesToRead;
+      rleChunkLen = bytesToRead;
+      rleChunkIdx = 0;
+    }
+
+    bytesToCopy = rleChunkLen - rleChunkIdx;
+    if (bytesToCopy > count) bytesToCopy = count;
+
+    if (buffer != NULL)
+    {
+      memcpy(buffer, rleChunk + rleChunkIdx, bytesToCopy);
+      buffer += bytesToCopy;
+    }
+
+    rleChunkIdx += bytesToCopy;
+    count       -= bytesToCopy;
+  }
+
+  return BMP_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Help function to decode one row of RLE8 data into palette indices.
+*  Pixels not covered by the data, e.g. skipped by a delta marker, are set to
+*  palette index 0. Runs past the end of the row are clipped.
+*
+*  @param row
+*  Buffer to be filled with width palette indices
+*
+*  @return
+*  Returns BMP_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS BMP_decodeRleRow(uint8_t row[])
+{
+  EMSTATUS status;
+  uint32_t width = bmpHeader.width;
+  uint32_t x;
+  uint32_t count;
+  uint32_t copy;
+  uint8_t  code[ 2 ];
+
+  memset(row, 0, width);
+
+  /* Rows after the end of file marker, or skipped by a delta marker, are empty */
+  if (rleDone == 1) return BMP_OK;
+
+  if (rleSkipRows > 0)
+  {
+    rleSkipRows--;
+    return BMP_OK;
+  }
+
+  x         = rleColumn;
+  rleColumn = 0;
+
+  while (1)
+  {
+    status = BMP_readRleBytes(code, 2);
+    if (status == BMP_ERROR_END_OF_FILE)
+    {
+      rleDone = 1;
+      return BMP_OK;
+    }
+    if (status != BMP_OK) return status;
+
+    if (code[0] > 0)
+    {
+      /* Encoded run */
+      count = code[0];
+
+      if (x < width)
+      {
+        copy = (count < width - x) ? count : width - x;
+        memset(row + x, code[1], copy);
+      }
+
+      x += count;
+    }
+    else if (code[1] == 0)
+    {
+      /* End of scan line marker */
+      return BMP_OK;
+    }
+    else if (code[1] == 1)
+    {
+      /* End of file marker */
+      rleDone = 1;
+      return BMP_OK;
+    }
+    else if (code[1] == 2)
+    {
+      /* Run offset marker, continue dx pixels to the right and dy rows up */
+      status = BMP_readRleBytes(code, 2);
+      if (status != BMP_OK) return status;
+
+      x += code[0];
+
+      if (code[1] > 0)
+      {
+        rleSkipRows = code[1] - 1;
+        rleColumn   = x;
+        return BMP_OK;
+      }
+    }
+    else
+    {
+      /* Unencoded run, padded to an even number of bytes */
+      count = code[1];
+      copy  = 0;
+
+      if (x < width)
+      {
+        copy = (count < width - x) ? count : width - x;
+
+        status = BMP_readRleBytes(row + x, copy);
+        if (status != BMP_OK) return status;
+      }
+
+      status = BMP_readRleBytes(NULL, count - copy + (count & 1));
+      if (status != BMP_OK) return status;
+
+      x += count;
+    }
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Help function to get the next source row, bottom-up. Uncompressed rows are
+*  read into the row cache as many at a time as it can hold. RLE8 rows are
+*  decoded into the row cache.
+*
+*  @param row
+*  Set to point to the BGR values or palette indices of the row
+*
+*  @return
+*  Returns BMP_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS BMP_readSourceRow(uint8_t **row)
+{
+  EMSTATUS status;
+  uint32_t rowOffset   = BMP_accumulatorSize(rowScale);
+  uint32_t bytesPerRow = bmpHeader.imageDataSize / bmpHeader.height;
+  uint32_t rowsLeft;
+
+  if (bmpHeader.compressionType == RLE8_COMPRESSION)
+  {
+    *row = rowCache + rowOffset;
+
+    return BMP_decodeRleRow(*row);
+  }
+
+  /* Read in as many whole rows as fit in the row cache */
+  if (rowCacheIdx == rowsInCache)
+  {
+    if (dataIdx >= bytesInImage) return BMP_ERROR_END_OF_FILE;
+
+    rowsLeft    = (bytesInImage - dataIdx) / bytesPerRow;
+    rowsInCache = (rowCacheSize - rowOffset) / bytesPerRow;
+    if (rowsInCache > rowsLeft) rowsInCache = rowsLeft;
+
+    status = fpReadData(rowCache + rowOffset, rowCacheSize - rowOffset, rowsInCache * bytesPerRow);
+    if (status != BMP_OK) return status;
+
+    dataIdx    += rowsInCache * bytesPerRow;
+    rowCacheIdx = 0;
+  }
+
+  *row = rowCache + rowOffset + rowCacheIdx * bytesPerRow;
+  rowCacheIdx++;
+
+  return BMP_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Help function to convert one source row to the output pixel format.
+*
+*  @param src
+*  BGR values or palette indices of the source row
+*  @param buffer
+*  Buffer to be filled with the converted row
+*  @param pixelFormat
+*  DMD_PIXEL_FORMAT_RGB888 or DMD_PIXEL_FORMAT_MONO
+******************************************************************************/
+static void BMP_convertRow(const uint8_t src[], uint8_t buffer[], uint8_t pixelFormat)
+{
+  const uint8_t *pal   = bmpPalette.data;
+  const uint8_t *color;
+  uint32_t      width  = bmpHeader.width;
+  uint32_t      i;
+  uint32_t      idx;
+  uint8_t       bits   = 0;
+
+  if (pixelFormat == DMD_PIXEL_FORMAT_MONO)
+  {
+    for (i = 0; i < width; ++i)
+    {
+      if (bmpHeader.bitsPerPixel == 24)
+      {
+        if (src[ 3 * i + 1 ] < BMP_MONO_THRESHOLD) bits |= 1 << (i & 7);
+      }
+      else
+      {
+        idx = src[ i ];
+        if (monoTable[ idx >> 3 ] & (1 << (idx & 7))) bits |= 1 << (i & 7);
+      }
+
+      /* Store each completed byte */
+      if ((i & 7) == 7)
+      {
+        buffer[ i >> 3 ] = bits;
+        bits             = 0;
+      }
+    }
+
+    if (width & 7) buffer[ width >> 3 ] = bits;
+  }
+  else if (bmpHeader.bitsPerPixel == 24)
+  {
+    /* Flip BGR to RGB */
+    for (i = 0; i < 3 * width; i += 3)
+    {
+      buffer[ i ]     = src[ i + 2 ];
+      buffer[ i + 1 ] = src[ i + 1 ];
+      buffer[ i + 2 ] = src[ i ];
+    }
+  }
+  else
+  {
+    /* Look up palette indices */
+    for (i = 0; i < width; ++i)
+    {
+      color = &pal[ 4 * src[ i ] ];
+
+      buffer[ 0 ] = color[ 0 ];
+      buffer[ 1 ] = color[ 1 ];
+      buffer[ 2 ] = color[ 2 ];
+      buffer     += 3;
+    }
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Help function to add one source row to the scale down accumulator.
+*
+*  @param src
+*  BGR values or palette indices of the source row
+*  @param acc
+*  Accumulator holding the red, green and blue sums of each output pixel
+*  @param outWidth
+*  Width of the output row in pixels
+******************************************************************************/
+static void BMP_accumulateRow(const uint8_t src[], uint16_t acc[], uint32_t outWidth)
+{
+  const uint8_t *pal = bmpPalette.data;
+  const uint8_t *color;
+  uint32_t      i;
+  uint32_t      k;
+
+  if (bmpHeader.bitsPerPixel == 24)
+  {
+    for (i = 0; i < outWidth; ++i)
+    {
+      for (k = 0; k < rowScale; ++k)
+      {
+        acc[ 0 ] += src[ 2 ];
+        acc[ 1 ] += src[ 1 ];
+        acc[ 2 ] += src[ 0 ];
+        src      += 3;
+      }
+      acc += 3;
+    }
+  }
+  else
+  {
+    for (i = 0; i < outWidth; ++i)
+    {
+      for (k = 0; k < rowScale; ++k)
+      {
+        color = &pal[ 4 * *src++ ];
+
+        acc[ 0 ] += color[ 0 ];
+        acc[ 1 ] += color[ 1 ];
+        acc[ 2 ] += color[ 2 ];
+      }
+      acc += 3;
+    }
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Help function to convert the scale down accumulator to an output row.
+*
+*  @param acc
+*  Accumulator holding the red, green and blue sums of each output pixel
+*  @param buffer
+*  Buffer to be filled with the output row
+*  @param pixelFormat
+*  DMD_PIXEL_FORMAT_RGB888 or DMD_PIXEL_FORMAT_MONO
+*  @param outWidth
+*  Width of the output row in pixels
+******************************************************************************/
+static void BMP_averageRow(const uint16_t acc[], uint8_t buffer[], uint8_t pixelFormat, uint32_t outWidth)
+{
+  uint32_t blockSize = rowScale * rowScale;
+  uint32_t i;
+  uint8_t  bits      = 0;
+
+  if (pixelFormat == DMD_PIXEL_FORMAT_MONO)
+  {
+    for (i = 0; i < outWidth; ++i)
+    {
+      if (acc[ 3 * i + 1 ] < BMP_MONO_THRESHOLD * blockSize) bits |= 1 << (i & 7);
+
+      if ((i & 7) == 7)
+      {
+        buffer[ i >> 3 ] = bits;
+        bits             = 0;
+      }
+    }
+
+    if (outWidth & 7) buffer[ outWidth >> 3 ] = bits;
+  }
+  else
+  {
+    for (i = 0; i < 3 * outWidth; ++i)
+    {
+      buffer[ i ] = acc[ i ] / blockSize;
+    }
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reads the next row of the image and converts it to the given pixel format.
+*  Rows are returned bottom-up, the way they are stored in the file. The row
+*  cache has to be set with BMP_setRowCache() first.
+*
+*  - If pixelFormat is DMD_PIXEL_FORMAT_RGB888: Buffer is filled with
+*  3 bytes of red, green and blue per pixel.
+*  - If pixelFormat is DMD_PIXEL_FORMAT_MONO: Buffer is filled with 1 bit per
+*  pixel, LSB first. A set bit is a black pixel, i.e. green is below
+*  BMP_MONO_THRESHOLD.
+*
+*  @param buffer
+*  Buffer to be filled with one row. Has to hold (width / scale) * 3 bytes
+*  for RGB888, or ((width / scale) + 7) / 8 bytes for mono.
+*  @param bufLength
+*  Buffer length in bytes
+*  @param pixelFormat
+*  DMD_PIXEL_FORMAT_RGB888 or DMD_PIXEL_FORMAT_MONO
+*  @param row
+*  Pointer to a uint32_t which is set to the row number of the returned row,
+*  counted from the top of the (scaled) image
+*
+*  @return
+*  - Returns BMP_OK on success
+*  - Returns BMP_ERROR_END_OF_FILE if all rows are read
+*  - Returns error code otherwise.
+******************************************************************************/
+EMSTATUS BMP_readRow(uint8_t buffer[], uint32_t bufLength, uint8_t pixelFormat, uint32_t *row)
+{
+  EMSTATUS status;
+  uint8_t  *src;
+  uint16_t *acc;
+  uint32_t outWidth;
+  uint32_t outHeight;
+  uint32_t rowLength;
+  uint32_t i;
+
+  /* Check if module is initialized */
+  if (moduleInit == 0) return BMP_ERROR_MODULE_NOT_INITIALIZED;
+
+  /* Check file is reset */
+  if (fileReset == 0) return BMP_ERROR_FILE_NOT_RESET;
+
+  /* Check if row cache is set */
+  if (rowCache == NULL) return BMP_ERROR_ROW_CACHE_NOT_SET;
+
+  if (buffer == NULL || row == NULL) return BMP_ERROR_INVALID_ARGUMENT;
+
+  outWidth  = bmpHeader.width / rowScale;
+  outHeight = bmpHeader.height / rowScale;
+
+  /* Check if all rows are read */
+  if (rowsDecoded >= outHeight) return BMP_ERROR_END_OF_FILE;
+
+  /* Check if buffer is big enough to hold one row */
+  if (pixelFormat == DMD_PIXEL_FORMAT_MONO)
+  {
+    rowLength = (outWidth + 7) / 8;
+  }
+  else if (pixelFormat == DMD_PIXEL_FORMAT_RGB888)
+  {
+    rowLength = outWidth * 3;
+  }
+  else
+  {
+    return BMP_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (bufLength < rowLength) return BMP_ERROR_BUFFER_TOO_SMALL;
+
+  if (rowScale == 1)
+  {
+    status = BMP_readSourceRow(&src);
+    if (status != BMP_OK) return status;
+
+    BMP_convertRow(src, buffer, pixelFormat);
+  }
+  else
+  {
+    /* Average blocks of rowScale * rowScale source pixels */
+    acc = (uint16_t *) rowCache;
+    memset(acc, 0, outWidth * 3 * sizeof(uint16_t));
+
+    for (i = 0; i < rowScale; ++i)
+    {
+      status = BMP_readSourceRow(&src);
+      if (status != BMP_OK) return status;
+
+      BMP_accumulateRow(src, acc, outWidth);
+    }
+
+    BMP_averageRow(acc, buffer, pixelFormat, outWidth);
+  }
+
+  *row = outHeight - 1 - rowsDecoded;
+  rowsDecoded++;
+
+  return BMP_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Decodes the whole image and draws it on the display with its top left
+*  corner at (x, y). The row cache has to be set with BMP_setRowCache() first.
+*
+*  Rows are converted to the pixel format of the display driver and written
+*  with one DMD_writeData call each. In DMD_PIXEL_FORMAT_MONO a set bit is a
+*  black pixel, the driver maps it to the colour mode of the display. The
+*  clipping area of the display is reset to the whole display when the
+*  function returns.
+*
+*  @param x
+*  X coordinate of the top left corner of the image on the display
+*  @param y
+*  Y coordinate of the top left corner of the image on the display
+*  @param buffer
+*  Buffer to hold one converted row, see BMP_readRow()
+*  @param bufLength
+*  Buffer length in bytes
+*
+*  @return
+*  Returns BMP_OK on success, or else a BMP or DMD error code
+******************************************************************************/
+EMSTATUS BMP_drawToDisplay(uint16_t x, uint16_t y, uint8_t buffer[], uint32_t bufLength)
+{
+  EMSTATUS            status;
+  DMD_DisplayGeometry *geometry;
+  uint8_t             pixelFormat;
+  uint32_t            row;
+
+  /* Check if module is initialized, file is reset and row cache is set */
+  if (moduleInit == 0) return BMP_ERROR_MODULE_NOT_INITIALIZED;
+  if (fileReset == 0) return BMP_ERROR_FILE_NOT_RESET;
+  if (rowCache == NULL) return BMP_ERROR_ROW_CACHE_NOT_SET;
+
+  status = DMD_getDisplayGeometry(&geometry);
+  if (status != DMD_OK) return status;
+
+  /* Drivers which do not describe their format take RGB888 data */
+  pixelFormat = DMD_PIXEL_FORMAT_RGB888;
+  if (geometry->pixelFormat == DMD_PIXEL_FORMAT_MONO) pixelFormat = DMD_PIXEL_FORMAT_MONO;
+
+  status = DMD_setClippingArea(x, y, bmpHeader.width / rowScale, bmpHeader.height / rowScale);
+  if (status != DMD_OK) return status;
+
+  /* Write one full row at a time */
+  while ((status = BMP_readRow(buffer, bufLength, pixelFormat, &row)) == BMP_OK)
+  {
+    status = DMD_writeData(0, row, buffer, bmpHeader.width / rowScale);
+    if (status != DMD_OK) break;
+  }
+
+  DMD_setClippingArea(0, 0, geometry->xSize, geometry->ySize);
+
+  if (status == BMP_ERROR_END_OF_FILE) status = BMP_OK;
+
+  return status;
+}
+
 /**************************************************************************//**
 *  @brief
 *  Get width of BMP image in pixels
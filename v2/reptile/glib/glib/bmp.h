@@ -56,6 +56,8 @@
 #define BMP_ERROR_BUFFER_TOO_SMALL          (ECODE_BMP_BASE | 0x0020)
 /** Bmp palette is not read */
 #define BMP_ERROR_PALETTE_NOT_READ          (ECODE_BMP_BASE | 0x0030)
+/** Row cache is not set. Call BMP_setRowCache() */
+#define BMP_ERROR_ROW_CACHE_NOT_SET         (ECODE_BMP_BASE | 0x0040)
 
 /* Palette size in bytes */
 #define BMP_PALETTE_8BIT_SIZE               (256 * 4)
@@ -67,6 +69,11 @@
 
 #define BMP_LOCAL_CACHE_SIZE                (BMP_CONFIG_LOCAL_CACHE_SIZE)
 
+/** Largest scale down factor supported by BMP_setRowCache() */
+#define BMP_MAX_SCALE                       (16)
+/** Pixels with a green component below this value are black in mono output */
+#define BMP_MONO_THRESHOLD                  (128)
+
 /** @struct __BMP_Header
  *  @brief BMP Module header structure. Must be packed to exact 54 bytes.
  */
@@ -150,6 +157,12 @@ EMSTATUS BMP_reset(void);
 EMSTATUS BMP_readRgbData(uint8_t buffer[], uint32_t bufLength, uint32_t *pixelsRead);
 EMSTATUS BMP_readRawData(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength);
 
+/* Row streaming functions */
+int32_t BMP_getRowCacheSize(uint32_t scale);
+EMSTATUS BMP_setRowCache(uint8_t *buffer, uint32_t bufLength, uint32_t scale);
+EMSTATUS BMP_readRow(uint8_t buffer[], uint32_t bufLength, uint8_t pixelFormat, uint32_t *row);
+EMSTATUS BMP_drawToDisplay(uint16_t x, uint16_t y, uint8_t buffer[], uint32_t bufLength);
+
 /* Accessor functions */
 int32_t BMP_getWidth(void);
 int32_t BMP_getHeight(void);
@@ -15,6 +15,7 @@
 
 /* Standard C header files */
 #include <stdint.h>
+#include <string.h>
 
 /* EM types and devices */
 #include "em_types.h"
@@ -35,6 +36,44 @@ static __INLINE void GLIB_colorTranslate24bppInl(uint32_t color, uint8_t *red, u
   *blue  = (color >> BlueShift) & 0xFF;
 }
 
+/**************************************************************************//**
+*  @brief
+*  Sets the GLIB_Context_t to default values for drawing to the area
+*  described by pDisplayGeometry
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS GLIB_contextSetup(GLIB_Context_t *pContext,
+                                  const DMD_DisplayGeometry *pDisplayGeometry,
+                                  GLIB_Canvas_t *pCanvas)
+{
+  EMSTATUS status;
+
+  /* Sets the default background and foreground color */
+  pContext->backgroundColor = Black;  
+  pContext->foregroundColor = White;
+
+  /* Nothing drawn yet */
+  pContext->numDirtyRects = 0;
+  memset(&pContext->dirtyStats, 0, sizeof(GLIB_DirtyStats_t));
+
+  pContext->pDisplayGeometry = pDisplayGeometry;
+  pContext->pCanvas = pCanvas;
+
+  /* Sets the clipping region to the whole display */
+  GLIB_Rectangle_t tmpRect = {0, 0, pDisplayGeometry->xSize - 1, pDisplayGeometry->ySize - 1};
+  status = GLIB_setClippingRegion(pContext, &tmpRect);   
+  if (status != GLIB_OK) return status;
+    
+  /* Configure font. Default to NORMAL 8x8 if included in project. */
+#ifndef GLIB_NO_DEFAULT_FONT
+  GLIB_setFont(pContext, GLIB_DEFAULT_FONT);   
+#endif
+  
+  return status;  
+}
+
 /**************************************************************************//**
 *  @brief
 *  Initialize the GLIB_Context_t
@@ -56,27 +95,35 @@ EMSTATUS GLIB_contextInit(GLIB_Context_t *pContext)
   /* Check arguments */
   if (pContext == NULL) return GLIB_ERROR_INVALID_ARGUMENT; 
 
-  /* Sets the default background and foreground color */
-  pContext->backgroundColor = Black;  
-  pContext->foregroundColor = White;
-
   /* Sets a pointer to the display geometry struct */  
   status = DMD_getDisplayGeometry(&pTmpDisplayGeometry);
   if (status != DMD_OK) return status;
   
-  pContext->pDisplayGeometry = pTmpDisplayGeometry;
+  return GLIB_contextSetup(pContext, pTmpDisplayGeometry, NULL);
+}
 
-  /* Sets the clipping region to the whole display */
-  GLIB_Rectangle_t tmpRect = {0, 0, pTmpDisplayGeometry->xSize - 1, pTmpDisplayGeometry->ySize - 1};
-  status = GLIB_setClippingRegion(pContext, &tmpRect);   
-  if (status != GLIB_OK) return status;
-    
-  /* Configure font. Default to NORMAL 8x8 if included in project. */
-#ifndef GLIB_NO_DEFAULT_FONT
-  GLIB_setFont(pContext, GLIB_DEFAULT_FONT);   
-#endif
-  
-  return status;  
+/**************************************************************************//**
+*  @brief
+*  Initialize a GLIB_Context_t for drawing to an off-screen canvas
+*
+*  The context is set to default values and all drawing functions write to
+*  the canvas. GLIB_flush copies the dirty regions of the canvas to the
+*  display, see GLIB_canvasBlit.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t
+*  @param pCanvas
+*  Pointer to a canvas initialized by GLIB_canvasInit
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_contextInitCanvas(GLIB_Context_t *pContext, GLIB_Canvas_t *pCanvas)
+{
+  /* Check arguments */
+  if ((pContext == NULL) || (pCanvas == NULL)) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  return GLIB_contextSetup(pContext, &pCanvas->geometry, pCanvas);
 }
 
 /**************************************************************************//**
@@ -140,10 +187,11 @@ EMSTATUS GLIB_setClippingRegion(GLIB_Context_t *pContext, GLIB_Rectangle_t *pRec
       (pRect->yMax > pContext->pDisplayGeometry->clipHeight - 1)) return GLIB_OUT_OF_BOUNDS;
   
   /* Set clipping region in driver */
-  status = DMD_setClippingArea(pRect->xMin, 
-                               pRect->yMin, 
-                               pRect->xMin + pRect->xMax + 1,
-                               pRect->yMin + pRect->yMax + 1);  
+  status = GLIB_targetSetClippingArea(pContext,
+                                      pRect->xMin, 
+                                      pRect->yMin, 
+                                      pRect->xMin + pRect->xMax + 1,
+                                      pRect->yMin + pRect->yMax + 1);  
 
   GLIB_Rectangle_t tmpRect = {pRect->xMin, pRect->yMin, pRect->xMax, pRect->yMax};
   pContext->clippingRegion = tmpRect;
@@ -152,6 +200,165 @@ EMSTATUS GLIB_setClippingRegion(GLIB_Context_t *pContext, GLIB_Rectangle_t *pRec
 }
 
 
+/**************************************************************************//**
+*  @brief
+*  Returns the number of pixels in a normalized rectangle
+******************************************************************************/
+static __INLINE uint32_t GLIB_rectArea(const GLIB_Rectangle_t *pRect)
+{
+  return (pRect->xMax - pRect->xMin + 1) * (pRect->yMax - pRect->yMin + 1);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets pDst to the bounding rectangle of pA and pB
+******************************************************************************/
+static __INLINE void GLIB_rectUnion(GLIB_Rectangle_t *pDst, const GLIB_Rectangle_t *pA,
+                                    const GLIB_Rectangle_t *pB)
+{
+  pDst->xMin = (pA->xMin < pB->xMin) ? pA->xMin : pB->xMin;
+  pDst->yMin = (pA->yMin < pB->yMin) ? pA->yMin : pB->yMin;
+  pDst->xMax = (pA->xMax > pB->xMax) ? pA->xMax : pB->xMax;
+  pDst->yMax = (pA->yMax > pB->yMax) ? pA->yMax : pB->yMax;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Adds a rectangle to the dirty regions of the GLIB_Context_t
+*
+*  All drawing functions add the area they write to. Call this function
+*  after drawing with the display driver directly, so that GLIB_flush
+*  includes the area.
+*
+*  A rectangle that overlaps or adjoins a dirty rectangle, so that their
+*  bounding rectangle covers no more pixels than the two do separately, is
+*  merged into it. When all GLIB_MAX_DIRTY_RECTS rectangles are in use, the
+*  new rectangle is merged with the one whose bounding rectangle adds the
+*  fewest extra pixels.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t
+*  @param pRect
+*  Pointer to the rectangle that has been drawn to
+*
+*  @return
+*  None.
+******************************************************************************/
+void GLIB_addDirtyRect(GLIB_Context_t *pContext, const GLIB_Rectangle_t *pRect)
+{
+  GLIB_Rectangle_t rect = *pRect;
+  GLIB_Rectangle_t merged;
+  uint32_t waste, bestWaste;
+  int i, best;
+
+  /* Clip to the display */
+  if (rect.xMin < 0) rect.xMin = 0;
+  if (rect.yMin < 0) rect.yMin = 0;
+  if (rect.xMax > pContext->pDisplayGeometry->xSize - 1) rect.xMax = pContext->pDisplayGeometry->xSize - 1;
+  if (rect.yMax > pContext->pDisplayGeometry->ySize - 1) rect.yMax = pContext->pDisplayGeometry->ySize - 1;
+  if ((rect.xMin > rect.xMax) || (rect.yMin > rect.yMax)) return;
+
+  pContext->dirtyStats.pixelsDrawn += GLIB_rectArea(&rect);
+
+  for (;;) {
+    /* Absorb every dirty rectangle the new one overlaps well enough */
+    for (i = 0; i < pContext->numDirtyRects; i++) {
+      GLIB_rectUnion(&merged, &rect, &pContext->dirtyRects[i]);
+      if (GLIB_rectArea(&merged) <= GLIB_rectArea(&rect) + GLIB_rectArea(&pContext->dirtyRects[i])) {
+        rect = merged;
+        pContext->dirtyRects[i] = pContext->dirtyRects[--pContext->numDirtyRects];
+        i = -1;
+      }
+    }
+
+    if (pContext->numDirtyRects < GLIB_MAX_DIRTY_RECTS) break;
+
+    /* No free entry, merge with the rectangle that wastes the fewest pixels */
+    best = 0;
+    bestWaste = UINT32_MAX;
+    for (i = 0; i < pContext->numDirtyRects; i++) {
+      GLIB_rectUnion(&merged, &rect, &pContext->dirtyRects[i]);
+      waste = GLIB_rectArea(&merged) - GLIB_rectArea(&pContext->dirtyRects[i]);
+      if (waste < bestWaste) {
+        best = i;
+        bestWaste = waste;
+      }
+    }
+    GLIB_rectUnion(&rect, &rect, &pContext->dirtyRects[best]);
+    pContext->dirtyRects[best] = pContext->dirtyRects[--pContext->numDirtyRects];
+  }
+
+  pContext->dirtyRects[pContext->numDirtyRects++] = rect;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sends the dirty regions of the GLIB_Context_t to the display
+*
+*  Passes each dirty rectangle to DMD_updateDisplayRegion and clears the
+*  dirty regions. A context drawing to a canvas first copies each dirty
+*  rectangle of the canvas to the display at the canvas position xDisplay,
+*  yDisplay. Parts outside the display are skipped. Updates pixelsFlushed,
+*  regionsFlushed and flushes in the dirty region statistics.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_flush(GLIB_Context_t *pContext)
+{
+  EMSTATUS status = GLIB_OK;
+  GLIB_Rectangle_t rect;
+  GLIB_Rectangle_t display;
+  GLIB_Canvas_t *pCanvas = pContext ? pContext->pCanvas : NULL;
+  DMD_DisplayGeometry *pGeometry;
+  int i;
+
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  if (pCanvas != NULL) {
+    status = DMD_getDisplayGeometry(&pGeometry);
+    if (status != DMD_OK) return status;
+    display.xMin = -pCanvas->xDisplay;
+    display.yMin = -pCanvas->yDisplay;
+    display.xMax = display.xMin + pGeometry->xSize - 1;
+    display.yMax = display.yMin + pGeometry->ySize - 1;
+  }
+
+  for (i = 0; (i < pContext->numDirtyRects) && (status == DMD_OK); i++) {
+    rect = pContext->dirtyRects[i];
+    if (pCanvas != NULL) {
+      /* Clip to the part of the canvas covering the display */
+      if (rect.xMin < display.xMin) rect.xMin = display.xMin;
+      if (rect.yMin < display.yMin) rect.yMin = display.yMin;
+      if (rect.xMax > display.xMax) rect.xMax = display.xMax;
+      if (rect.yMax > display.yMax) rect.yMax = display.yMax;
+      if ((rect.xMin > rect.xMax) || (rect.yMin > rect.yMax)) continue;
+
+      status = GLIB_canvasBlit(pCanvas, &rect, rect.xMin + pCanvas->xDisplay,
+                               rect.yMin + pCanvas->yDisplay);
+      if (status != GLIB_OK) break;
+      rect.xMin += pCanvas->xDisplay;
+      rect.xMax += pCanvas->xDisplay;
+      rect.yMin += pCanvas->yDisplay;
+      rect.yMax += pCanvas->yDisplay;
+    }
+    status = DMD_updateDisplayRegion(rect.xMin, rect.yMin,
+                                     rect.xMax - rect.xMin + 1,
+                                     rect.yMax - rect.yMin + 1);
+    pContext->dirtyStats.pixelsFlushed += GLIB_rectArea(&rect);
+    pContext->dirtyStats.regionsFlushed++;
+  }
+
+  pContext->numDirtyRects = 0;
+  pContext->dirtyStats.flushes++;
+
+  return status;
+}
+
 /**************************************************************************//**
 *  @brief
 *  Clears the display with the background color of the GLIB_Context_t
@@ -184,7 +391,9 @@ EMSTATUS GLIB_clear(GLIB_Context_t *pContext)
   /* Fill the display with the background color of the GLIB_Context_t  */
   width = pContext->pDisplayGeometry->clipWidth;
   height = pContext->pDisplayGeometry->clipHeight;
-  return DMD_writeColor(0, 0, red, green, blue, width * height);  
+  GLIB_Rectangle_t dirty = {0, 0, width - 1, height - 1};
+  GLIB_addDirtyRect(pContext, &dirty);
+  return GLIB_targetWriteColor(pContext, 0, 0, red, green, blue, width * height);  
 }
 
 /**************************************************************************//**
@@ -202,8 +411,61 @@ EMSTATUS GLIB_resetDisplayClippingArea(GLIB_Context_t *pContext)
   /* Check arguments */
   if (pContext == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
 
-  return DMD_setClippingArea(0, 0, pContext->pDisplayGeometry->xSize,
-                                        pContext->pDisplayGeometry->ySize); 
+  return GLIB_targetSetClippingArea(pContext, 0, 0, pContext->pDisplayGeometry->xSize,
+                                    pContext->pDisplayGeometry->ySize); 
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the clipping area of the canvas of the context, or of the display
+*  driver if the context has no canvas. See DMD_setClippingArea.
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_targetSetClippingArea(GLIB_Context_t *pContext, uint16_t x, uint16_t y,
+                                    uint16_t width, uint16_t height)
+{
+  if (pContext->pCanvas != NULL) {
+    return GLIB_canvasSetClippingArea(pContext->pCanvas, x, y, width, height);
+  }
+  return DMD_setClippingArea(x, y, width, height);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes one color to a number of pixels on the canvas of the context, or
+*  on the display if the context has no canvas. See DMD_writeColor.
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_targetWriteColor(GLIB_Context_t *pContext, uint16_t x, uint16_t y,
+                               uint8_t red, uint8_t green, uint8_t blue,
+                               uint32_t numPixels)
+{
+  if (pContext->pCanvas != NULL) {
+    return GLIB_canvasWriteColor(pContext->pCanvas, x, y, red, green, blue, numPixels);
+  }
+  return DMD_writeColor(x, y, red, green, blue, numPixels);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes pixel data to the canvas of the context, or to the display if the
+*  context has no canvas. The data is in the pixelFormat of the
+*  pDisplayGeometry of the context. See DMD_writeData.
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_targetWriteData(GLIB_Context_t *pContext, uint16_t x, uint16_t y,
+                              const uint8_t data[], uint32_t numPixels)
+{
+  if (pContext->pCanvas != NULL) {
+    return GLIB_canvasWriteData(pContext->pCanvas, x, y, data, numPixels);
+  }
+  return DMD_writeData(x, y, data, numPixels);
 }
 
 /**************************************************************************//**
@@ -299,10 +561,12 @@ EMSTATUS GLIB_drawPixel(GLIB_Context_t *pContext, int32_t x, int32_t y)
   /* Check arguments */
   if (pContext == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
   if (!GLIB_rectContainsPoint(&pContext->clippingRegion, x, y)) return GLIB_ERROR_NOTHING_TO_DRAW;  
+  GLIB_Rectangle_t dirty = {x, y, x, y};
+  GLIB_addDirtyRect(pContext, &dirty);
 
   /* Translate color and draw pixel */
   GLIB_colorTranslate24bppInl(pContext->foregroundColor, &red, &green, &blue);
-  return DMD_writeColor(x, y, red, green, blue, 1);
+  return GLIB_targetWriteColor(pContext, x, y, red, green, blue, 1);
 }
 
 /**************************************************************************//**
@@ -331,10 +595,12 @@ EMSTATUS GLIB_drawPixelColor(GLIB_Context_t *pContext, int32_t x, int32_t y,
   /* Check arguments */
   if (pContext == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
   if (!GLIB_rectContainsPoint(&pContext->clippingRegion, x, y)) return GLIB_ERROR_NOTHING_TO_DRAW;  
+  GLIB_Rectangle_t dirty = {x, y, x, y};
+  GLIB_addDirtyRect(pContext, &dirty);
 
   /* Translate color and draw pixel */
   GLIB_colorTranslate24bppInl(color, &red, &green, &blue);
-  return DMD_writeColor(x, y, red, green, blue, 1);
+  return GLIB_targetWriteColor(pContext, x, y, red, green, blue, 1);
 }
 
 /**************************************************************************//**
@@ -367,7 +633,9 @@ EMSTATUS GLIB_drawPixelRGB(GLIB_Context_t *pContext, int32_t x, int32_t y,
   /* Check arguments */
   if (pContext == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
   if (!GLIB_rectContainsPoint(&pContext->clippingRegion, x, y)) return GLIB_ERROR_NOTHING_TO_DRAW;  
+  GLIB_Rectangle_t dirty = {x, y, x, y};
+  GLIB_addDirtyRect(pContext, &dirty);
   
   /* Call Display driver function */
-  return DMD_writeColor(x, y, red, green, blue, 1);
+  return GLIB_targetWriteColor(pContext, x, y, red, green, blue, 1);
 }
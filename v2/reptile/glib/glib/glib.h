@@ -57,7 +57,71 @@ extern "C" {
 /** Invalid file */
 #define GLIB_ERROR_INVALID_FILE                 (ECODE_GLIB_BASE | 0x0009)
 
-  
+
+/** Size in pixels of the row buffer the text renderer assembles glyph rows
+ *  in before handing them to DMD_writeData. Wider text is written in several
+ *  column strips. The buffer uses GLIB_ROW_BUFFER_PIXELS * 3 bytes plus
+ *  GLIB_ROW_BUFFER_PIXELS / 8 bytes of RAM. */
+#ifndef GLIB_ROW_BUFFER_PIXELS
+#define GLIB_ROW_BUFFER_PIXELS                  64
+#endif
+
+/** Max number of dirty rectangles tracked per GLIB_Context_t. More draw
+ *  calls are merged into fewer and larger rectangles. */
+#ifndef GLIB_MAX_DIRTY_RECTS
+#define GLIB_MAX_DIRTY_RECTS                    4
+#endif
+
+/** Size in pixels of the buffer GLIB_canvasBlit converts canvas pixels to
+ *  the DMD_writeData pixel format in. Uses GLIB_BLIT_BUFFER_PIXELS * 3 bytes
+ *  of RAM. */
+#ifndef GLIB_BLIT_BUFFER_PIXELS
+#define GLIB_BLIT_BUFFER_PIXELS                 128
+#endif
+
+/** Max number of polygon edges crossing one row in GLIB_rasterPolygon. Convex
+ *  polygons cross each row at most twice. */
+#ifndef GLIB_RASTER_MAX_CROSSINGS
+#define GLIB_RASTER_MAX_CROSSINGS               16
+#endif
+
+/** Size in bytes of the RAM cache of decoded glyphs of packed fonts. A glyph
+ *  is cached in the DMD_writeData pixel format of the display, so a cached
+ *  glyph is drawn with one DMD_writeData call. 0 removes the cache, the
+ *  largest size is 65532. */
+#ifndef GLIB_GLYPH_CACHE_BYTES
+#define GLIB_GLYPH_CACHE_BYTES                  0
+#endif
+
+/** Max number of glyphs in the glyph cache */
+#ifndef GLIB_GLYPH_CACHE_ENTRIES
+#define GLIB_GLYPH_CACHE_ENTRIES                16
+#endif
+
+/* Glyph data encodings of packed fonts */
+/** Alpha values of bpp bits packed LSB first, row after row */
+#define GLIB_GLYPH_ENCODING_PACKED              0
+/** One byte per run of equal alpha values, the value in the upper bpp bits
+ *  and the run length minus one in the lower 8 - bpp bits. Runs continue
+ *  from one row to the next. */
+#define GLIB_GLYPH_ENCODING_RLE                 1
+
+/* Canvas pixel formats, the value is the number of bits per pixel */
+/** 1 bit per pixel packed LSB first, a set bit is a black pixel */
+#define GLIB_CANVAS_FORMAT_1BPP                 1
+/** 8 bits per pixel, index into the palette of the canvas */
+#define GLIB_CANVAS_FORMAT_8BPP_PALETTE         8
+/** 16 bits per pixel, 5 bits red, 6 bits green and 5 bits blue */
+#define GLIB_CANVAS_FORMAT_RGB565               16
+
+/** Bytes per row of a canvas. Rows start on a word boundary. */
+#define GLIB_CANVAS_STRIDE(width, format) \
+  ((((uint32_t)(width) * (format) + 31) / 32) * 4)
+
+/** Size in 32-bit words of the pixel buffer of a canvas */
+#define GLIB_CANVAS_WORDS(width, height, format) \
+  ((GLIB_CANVAS_STRIDE(width, format) / 4) * (uint32_t)(height))
+
 /** @struct __GLIB_Font_t_Class
  *  @brief Font classes
  */
@@ -66,6 +130,7 @@ typedef enum __GLIB_Font_Class
   InvalidFont = 0,
   FullFont,
   NumbersOnlyFont,  
+  PackedFont,
 } GLIB_Font_Class;
 
 
@@ -84,6 +149,83 @@ typedef struct __GLIB_Font_t
   uint8_t charSpacing;
   GLIB_Font_Class class;
 } GLIB_Font_t;
+
+
+/** @struct __GLIB_Glyph_t
+ *  @brief Metrics and data offset of one glyph of a packed font
+ */
+typedef struct __GLIB_Glyph_t
+{
+  /** Offset of the glyph data in the pData array of the font */
+  uint32_t offset;
+  /** Width of the glyph bitmap */
+  uint8_t width;
+  /** Height of the glyph bitmap */
+  uint8_t height;
+  /** Left edge of the bitmap relative to the pen position */
+  int8_t xOffset;
+  /** Top edge of the bitmap relative to the top of the text line */
+  int8_t yOffset;
+  /** Distance the pen moves to the next glyph */
+  uint8_t xAdvance;
+  /** Glyph data encoding, GLIB_GLYPH_ENCODING_xxx */
+  uint8_t encoding;
+} GLIB_Glyph_t;
+
+
+/** @struct __GLIB_PackedFont_t
+ *  @brief Proportional font with compressed glyph data. The pFontPixMap
+ *  member of a GLIB_Font_t of class PackedFont points to this structure.
+ *  Fonts are generated by the glibfontconv tool in reptile/glib/tools.
+ */
+typedef struct __GLIB_PackedFont_t
+{
+  /** Glyph table, numChars entries */
+  const GLIB_Glyph_t *pGlyphs;
+  /** Glyph data */
+  const uint8_t *pData;
+  /** Char code of the first glyph */
+  uint8_t firstChar;
+  /** Number of glyphs */
+  uint8_t numChars;
+  /** Bits of alpha per pixel, 1, 2 or 4. Pixels are drawn in the foreground
+   *  color blended with the background color by the alpha value. */
+  uint8_t bpp;
+} GLIB_PackedFont_t;
+
+
+/** @struct __GLIB_GlyphDecoder_t
+ *  @brief State of GLIB_glyphDecodeRow, set up by GLIB_glyphDecodeInit
+ */
+typedef struct __GLIB_GlyphDecoder_t
+{
+  /** Glyph decoded */
+  const GLIB_Glyph_t *pGlyph;
+  /** Next byte of glyph data */
+  const uint8_t *pData;
+  /** Bits of alpha per pixel */
+  uint8_t bpp;
+  /** Bits left in value (packed), or pixels left in the run (RLE) */
+  uint8_t count;
+  /** Current data byte (packed), or alpha value of the run (RLE) */
+  uint8_t value;
+  /** Next glyph row */
+  uint8_t row;
+} GLIB_GlyphDecoder_t;
+
+
+/** @struct __GLIB_GlyphCacheStats_t
+ *  @brief Glyph cache statistics
+ */
+typedef struct __GLIB_GlyphCacheStats_t
+{
+  /** Glyphs drawn from the cache */
+  uint32_t hits;
+  /** Glyphs decoded into the cache */
+  uint32_t misses;
+  /** Glyphs removed from the cache to make room for others */
+  uint32_t evictions;
+} GLIB_GlyphCacheStats_t;
   
   
 /** @struct __GLIB_Rectangle_t
@@ -102,6 +244,54 @@ typedef struct __GLIB_Rectangle_t
 } GLIB_Rectangle_t;
 
 
+/** @struct __GLIB_DirtyStats_t
+ *  @brief Dirty region statistics
+ */
+typedef struct __GLIB_DirtyStats_t
+{
+  /** Pixels written by draw calls */
+  uint32_t pixelsDrawn;
+  /** Pixels in the regions passed to the display driver by GLIB_flush */
+  uint32_t pixelsFlushed;
+  /** Number of regions passed to the display driver */
+  uint32_t regionsFlushed;
+  /** Number of GLIB_flush calls */
+  uint32_t flushes;
+} GLIB_DirtyStats_t;
+
+
+/** @struct __GLIB_Canvas_t
+ *  @brief Off-screen canvas. A GLIB_Context_t initialized with
+ *  GLIB_contextInitCanvas draws to the canvas instead of the display.
+ */
+typedef struct __GLIB_Canvas_t
+{
+  /** Size of the canvas and clipping area used when drawing to it. The
+   *  pixelFormat is DMD_PIXEL_FORMAT_MONO for 1 bpp canvases, else
+   *  DMD_PIXEL_FORMAT_RGB888 */
+  DMD_DisplayGeometry geometry;
+
+  /** Pixel format, GLIB_CANVAS_FORMAT_xxx */
+  uint8_t format;
+
+  /** Bytes per row, a multiple of 4 */
+  uint32_t stride;
+
+  /** Pixel data, GLIB_CANVAS_WORDS(width, height, format) words */
+  uint32_t *pPixels;
+
+  /** Palette of 8 bpp canvases, colors as 0x00RRGGBB */
+  const uint32_t *pPalette;
+
+  /** Number of colors in the palette */
+  uint16_t paletteSize;
+
+  /** Display position of the canvas used by GLIB_flush */
+  int32_t xDisplay;
+  int32_t yDisplay;
+} GLIB_Canvas_t;
+
+
 /** @struct __GLIB_Context_t
  *  @brief GLIB Drawing Context
  *  (Multiple instances of GLIB_Context_t can exist)
@@ -123,12 +313,48 @@ typedef struct __GLIB_Context_t
   /** Font definition */
   GLIB_Font_t font;
 
+  /** Regions drawn to since the last GLIB_flush */
+  GLIB_Rectangle_t dirtyRects[GLIB_MAX_DIRTY_RECTS];
+
+  /** Number of rectangles in dirtyRects */
+  uint8_t numDirtyRects;
+
+  /** Dirty region statistics, may be cleared by the application */
+  GLIB_DirtyStats_t dirtyStats;
+
+  /** Canvas drawn to, or NULL when drawing to the display */
+  GLIB_Canvas_t *pCanvas;
+
 } GLIB_Context_t;
 
 
+/** Span function of the scanline rasterisers. Called with one run of pixels,
+ *  xMin to xMax included, on row y. Returning anything but GLIB_OK stops
+ *  the rasteriser. */
+typedef EMSTATUS (*GLIB_SpanFunc_t)(void *pUser, int32_t y, int32_t xMin, int32_t xMax);
+
+
+/** @struct __GLIB_SpanFill_t
+ *  @brief State of GLIB_fillSpan, set up by GLIB_spanFillInit
+ */
+typedef struct __GLIB_SpanFill_t
+{
+  /** Context drawn to */
+  GLIB_Context_t *pContext;
+  /** Fill color for the display driver */
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+  /** Fill color as canvas pixel value */
+  uint32_t pixel;
+} GLIB_SpanFill_t;
+
+
 /* Prototypes for graphics library functions */
 EMSTATUS GLIB_contextInit(GLIB_Context_t *pContext);
 
+EMSTATUS GLIB_contextInitCanvas(GLIB_Context_t *pContext, GLIB_Canvas_t *pCanvas);
+
 EMSTATUS GLIB_displayWakeUp(void);
 
 EMSTATUS GLIB_displaySleep(void);
@@ -149,6 +375,10 @@ void GLIB_normalizeRect(GLIB_Rectangle_t *pRect);
 
 EMSTATUS GLIB_setClippingRegion(GLIB_Context_t *pContext, GLIB_Rectangle_t *pRect);
 
+void GLIB_addDirtyRect(GLIB_Context_t *pContext, const GLIB_Rectangle_t *pRect);
+
+EMSTATUS GLIB_flush(GLIB_Context_t *pContext);
+
 EMSTATUS GLIB_drawCircle(GLIB_Context_t *pContext, int32_t x, int32_t y,
                          uint32_t radius);
 
@@ -166,6 +396,9 @@ EMSTATUS GLIB_drawString(GLIB_Context_t *pContext, char* pString, uint32_t sLeng
 EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x,
                        int32_t y, bool opaque);
 
+uint32_t GLIB_stringWidth(GLIB_Context_t *pContext, const char *pString,
+                          uint32_t sLength);
+
 EMSTATUS GLIB_drawBitmap(GLIB_Context_t* pContext, int32_t x, int32_t y,
                          uint32_t width, uint32_t height, uint8_t *picData);
 
@@ -186,6 +419,12 @@ EMSTATUS GLIB_drawRectFilled(GLIB_Context_t *pContext,
 EMSTATUS GLIB_drawPolygon(GLIB_Context_t *pContext,
                           uint32_t numPoints, int32_t *polyPoints);
 
+EMSTATUS GLIB_drawPolygonFilled(GLIB_Context_t *pContext,
+                                uint32_t numPoints, const int32_t *polyPoints);
+
+EMSTATUS GLIB_drawRoundRectFilled(GLIB_Context_t *pContext,
+                                  const GLIB_Rectangle_t *pRect, uint32_t radius);
+
 EMSTATUS GLIB_drawPixelRGB(GLIB_Context_t *pContext, int32_t x, int32_t y,
                            uint8_t red, uint8_t green, uint8_t blue);
 
@@ -194,6 +433,89 @@ EMSTATUS GLIB_drawPixel(GLIB_Context_t *pContext, int32_t x, int32_t y);
 EMSTATUS GLIB_drawPixelColor(GLIB_Context_t *pContext, int32_t x, int32_t y,
                              uint32_t color);
 
+/* Scanline rasterisers */
+EMSTATUS GLIB_rasterPolygon(const GLIB_Rectangle_t *pClip, uint32_t numPoints,
+                            const int32_t *polyPoints,
+                            GLIB_SpanFunc_t spanFunc, void *pUser);
+
+EMSTATUS GLIB_rasterCircle(const GLIB_Rectangle_t *pClip, int32_t xCenter,
+                           int32_t yCenter, uint32_t radius,
+                           GLIB_SpanFunc_t spanFunc, void *pUser);
+
+EMSTATUS GLIB_rasterRoundRect(const GLIB_Rectangle_t *pClip, const GLIB_Rectangle_t *pRect,
+                              uint32_t radius, GLIB_SpanFunc_t spanFunc, void *pUser);
+
+bool GLIB_polygonContainsPoint(uint32_t numPoints, const int32_t *polyPoints,
+                               int32_t x, int32_t y);
+
+bool GLIB_circleContainsPoint(int32_t xCenter, int32_t yCenter, uint32_t radius,
+                              int32_t x, int32_t y);
+
+bool GLIB_roundRectContainsPoint(const GLIB_Rectangle_t *pRect, uint32_t radius,
+                                 int32_t x, int32_t y);
+
+void GLIB_spanFillInit(GLIB_SpanFill_t *pFill, GLIB_Context_t *pContext);
+
+EMSTATUS GLIB_fillSpan(void *pUser, int32_t y, int32_t xMin, int32_t xMax);
+
+/* Off-screen canvas */
+EMSTATUS GLIB_canvasInit(GLIB_Canvas_t *pCanvas, uint8_t format,
+                         uint16_t width, uint16_t height, uint32_t *pPixels,
+                         const uint32_t *pPalette, uint16_t paletteSize);
+
+uint32_t GLIB_canvasColor(const GLIB_Canvas_t *pCanvas, uint32_t color);
+
+EMSTATUS GLIB_canvasFill(GLIB_Canvas_t *pCanvas, uint32_t x, uint32_t y,
+                         uint32_t width, uint32_t height, uint32_t pixel);
+
+EMSTATUS GLIB_canvasCopy(GLIB_Canvas_t *pDst, int32_t x, int32_t y,
+                         const GLIB_Canvas_t *pSrc, const GLIB_Rectangle_t *pRect);
+
+EMSTATUS GLIB_canvasBlit(const GLIB_Canvas_t *pCanvas, const GLIB_Rectangle_t *pRect,
+                         int32_t x, int32_t y);
+
+EMSTATUS GLIB_canvasSetClippingArea(GLIB_Canvas_t *pCanvas, uint16_t x, uint16_t y,
+                                    uint16_t width, uint16_t height);
+
+EMSTATUS GLIB_canvasWriteColor(GLIB_Canvas_t *pCanvas, uint16_t x, uint16_t y,
+                               uint8_t red, uint8_t green, uint8_t blue,
+                               uint32_t numPixels);
+
+EMSTATUS GLIB_canvasWriteData(GLIB_Canvas_t *pCanvas, uint16_t x, uint16_t y,
+                              const uint8_t data[], uint32_t numPixels);
+
+/* Display driver access of the drawing functions. Goes to the canvas of the
+   context when it has one, else to the display driver. */
+EMSTATUS GLIB_targetSetClippingArea(GLIB_Context_t *pContext, uint16_t x, uint16_t y,
+                                    uint16_t width, uint16_t height);
+
+EMSTATUS GLIB_targetWriteColor(GLIB_Context_t *pContext, uint16_t x, uint16_t y,
+                               uint8_t red, uint8_t green, uint8_t blue,
+                               uint32_t numPixels);
+
+EMSTATUS GLIB_targetWriteData(GLIB_Context_t *pContext, uint16_t x, uint16_t y,
+                              const uint8_t data[], uint32_t numPixels);
+
+/* Packed fonts */
+void GLIB_glyphDecodeInit(GLIB_GlyphDecoder_t *pDecoder,
+                          const GLIB_PackedFont_t *pPackedFont,
+                          const GLIB_Glyph_t *pGlyph);
+
+void GLIB_glyphDecodeRow(GLIB_GlyphDecoder_t *pDecoder, int32_t row,
+                         int32_t x, uint32_t numPixels, uint8_t *pAlpha);
+
+const uint8_t *GLIB_glyphCacheFind(const GLIB_Context_t *pContext,
+                                   const GLIB_Glyph_t *pGlyph,
+                                   uint32_t width, uint32_t height);
+
+uint8_t *GLIB_glyphCacheAlloc(const GLIB_Context_t *pContext,
+                              const GLIB_Glyph_t *pGlyph,
+                              uint32_t width, uint32_t height, uint32_t size);
+
+void GLIB_glyphCacheClear(void);
+
+void GLIB_glyphCacheGetStats(GLIB_GlyphCacheStats_t *pStats);
+
 /* Fonts included in the library */
 extern const GLIB_Font_t GLIB_FontNormal8x8; /* Default */
 extern const GLIB_Font_t GLIB_FontNarrow6x8;
@@ -53,18 +53,21 @@ EMSTATUS GLIB_drawBitmap(GLIB_Context_t *pContext, int32_t x, int32_t y,
                          uint32_t width, uint32_t height, uint8_t *picData)
 {
   EMSTATUS status;
+  GLIB_Rectangle_t dirty = {x, y, x + width - 1, y + height - 1};
+
+  GLIB_addDirtyRect(pContext, &dirty);
 
   /* Set display clipping area for bitmap */
-  status = DMD_setClippingArea(x, y, width, height);
+  status = GLIB_targetSetClippingArea(pContext, x, y, width, height);
   if (status != DMD_OK) return status;
 
   /* Write bitmap to display */
-  status = DMD_writeData(0, 0, picData, width * height);
+  status = GLIB_targetWriteData(pContext, 0, 0, picData, width * height);
   if (status != DMD_OK) return status;
 
   /* Reset driver clipping area to GLIB clipping region */
-  return DMD_setClippingArea(pContext->clippingRegion.xMin, 
-                               pContext->clippingRegion.yMin, 
-                               pContext->clippingRegion.xMin + pContext->clippingRegion.xMax + 1, 
-                               pContext->clippingRegion.yMin + pContext->clippingRegion.yMax + 1);
+  return GLIB_targetSetClippingArea(pContext, pContext->clippingRegion.xMin, 
+                                      pContext->clippingRegion.yMin, 
+                                      pContext->clippingRegion.xMin + pContext->clippingRegion.xMax + 1, 
+                                      pContext->clippingRegion.yMin + pContext->clippingRegion.yMax + 1);
 }
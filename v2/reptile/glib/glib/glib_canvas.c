@@ -0,0 +1,727 @@
+ /*************************************************************************//**
+ * @file glib_canvas.c
+ * @brief Silicon Labs Graphics Library: Off-screen Canvas Routines
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+/* Standard C header files */
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+#include "glib_color.h"
+
+/* Buffer GLIB_canvasBlit converts pixels to the DMD_writeData pixel format in.
+ * Word aligned, so that 1 bpp data can be assembled a word at a time. */
+static uint32_t blitBuffer[(GLIB_BLIT_BUFFER_PIXELS * 3 + 3) / 4];
+
+/**************************************************************************//**
+*  @brief
+*  Gets n (1 to 32) bits of a 1 bpp row, starting at pixel bit
+******************************************************************************/
+static uint32_t GLIB_getBits(const uint32_t *pRow, uint32_t bit, uint32_t n)
+{
+  const uint32_t *pWord = pRow + (bit >> 5);
+  uint32_t shift = bit & 0x1F;
+  uint32_t value = pWord[0] >> shift;
+
+  if (shift + n > 32) value |= pWord[1] << (32 - shift);
+  return (n == 32) ? value : value & ((1UL << n) - 1);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets n (1 to 32) bits of a 1 bpp row, starting at pixel bit
+******************************************************************************/
+static void GLIB_putBits(uint32_t *pRow, uint32_t bit, uint32_t n, uint32_t value)
+{
+  uint32_t *pWord = pRow + (bit >> 5);
+  uint32_t shift = bit & 0x1F;
+  uint32_t mask = (n == 32) ? 0xFFFFFFFF : (1UL << n) - 1;
+
+  value &= mask;
+  pWord[0] = (pWord[0] & ~(mask << shift)) | (value << shift);
+  if (shift + n > 32) {
+    pWord[1] = (pWord[1] & ~(mask >> (32 - shift))) | (value >> (32 - shift));
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets n (1 to 24) bits of a byte stream of 1 bpp pixel data, starting at
+*  pixel bit
+******************************************************************************/
+static uint32_t GLIB_getDataBits(const uint8_t *pData, uint32_t bit, uint32_t n)
+{
+  const uint8_t *pByte = pData + (bit >> 3);
+  uint32_t shift = bit & 0x7;
+  uint32_t value = pByte[0];
+
+  if (shift + n > 8) value |= (uint32_t)pByte[1] << 8;
+  if (shift + n > 16) value |= (uint32_t)pByte[2] << 16;
+  if (shift + n > 24) value |= (uint32_t)pByte[3] << 24;
+  return (value >> shift) & ((1UL << n) - 1);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets a pointer to the first byte of row y of the canvas
+******************************************************************************/
+static uint8_t *GLIB_canvasRow(const GLIB_Canvas_t *pCanvas, uint32_t y)
+{
+  return (uint8_t *)pCanvas->pPixels + y * pCanvas->stride;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Fills n pixels of a canvas row starting at pixel x. Writes whole words
+*  between the unaligned head and tail of the run.
+******************************************************************************/
+static void GLIB_canvasFillRow(const GLIB_Canvas_t *pCanvas, uint8_t *pRow,
+                               uint32_t x, uint32_t n, uint32_t pixel)
+{
+  uint32_t pattern, k;
+  uint32_t *pWord;
+  uint8_t *pByte;
+  uint16_t *pHalf;
+
+  switch (pCanvas->format) {
+  case GLIB_CANVAS_FORMAT_1BPP:
+    pattern = pixel ? 0xFFFFFFFF : 0;
+    if (x & 0x1F) {
+      k = 32 - (x & 0x1F);
+      if (k > n) k = n;
+      GLIB_putBits((uint32_t *)pRow, x, k, pattern);
+      x += k;
+      n -= k;
+    }
+    pWord = (uint32_t *)pRow + (x >> 5);
+    for (; n >= 32; n -= 32) *pWord++ = pattern;
+    if (n) GLIB_putBits(pWord, 0, n, pattern);
+    break;
+
+  case GLIB_CANVAS_FORMAT_8BPP_PALETTE:
+    pattern = (pixel & 0xFF) * 0x01010101;
+    pByte = pRow + x;
+    for (; n && ((uintptr_t)pByte & 0x3); n--) *pByte++ = (uint8_t)pattern;
+    pWord = (uint32_t *)pByte;
+    for (; n >= 4; n -= 4) *pWord++ = pattern;
+    pByte = (uint8_t *)pWord;
+    while (n--) *pByte++ = (uint8_t)pattern;
+    break;
+
+  case GLIB_CANVAS_FORMAT_RGB565:
+    pattern = (pixel & 0xFFFF) * 0x00010001;
+    pHalf = (uint16_t *)pRow + x;
+    if (n && ((uintptr_t)pHalf & 0x2)) {
+      *pHalf++ = (uint16_t)pattern;
+      n--;
+    }
+    pWord = (uint32_t *)pHalf;
+    for (; n >= 2; n -= 2) *pWord++ = pattern;
+    if (n) *(uint16_t *)pWord = (uint16_t)pattern;
+    break;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Converts n pixels of a canvas row starting at pixel x to 24 bpp pixel
+*  data, one byte each of red, green and blue
+******************************************************************************/
+static void GLIB_canvasRowToRgb888(const GLIB_Canvas_t *pCanvas, const uint8_t *pRow,
+                                   uint32_t x, uint32_t n, uint8_t *pDst)
+{
+  uint32_t i, color;
+  const uint16_t *pHalf;
+
+  for (i = 0; i < n; i++, x++) {
+    switch (pCanvas->format) {
+    case GLIB_CANVAS_FORMAT_1BPP:
+      color = ((pRow[x >> 3] >> (x & 0x7)) & 0x1) ? Black : White;
+      break;
+    case GLIB_CANVAS_FORMAT_8BPP_PALETTE:
+      color = (pRow[x] < pCanvas->paletteSize) ? pCanvas->pPalette[pRow[x]] : Black;
+      break;
+    default:
+      pHalf = (const uint16_t *)pRow;
+      color = ((pHalf[x] & 0xF800) << 8) | ((pHalf[x] & 0xE000) << 3) |
+              ((pHalf[x] & 0x07E0) << 5) | ((pHalf[x] & 0x0600) >> 1) |
+              ((pHalf[x] & 0x001F) << 3) | ((pHalf[x] & 0x001C) >> 2);
+      break;
+    }
+    *pDst++ = (color >> RedShift) & 0xFF;
+    *pDst++ = (color >> GreenShift) & 0xFF;
+    *pDst++ = (color >> BlueShift) & 0xFF;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Converts n pixels of a canvas row starting at pixel x to 1 bpp pixel data
+*  at bit dstBit of pDst. Pixels with no green component are black.
+******************************************************************************/
+static void GLIB_canvasRowToMono(const GLIB_Canvas_t *pCanvas, const uint8_t *pRow,
+                                 uint32_t x, uint32_t n, uint32_t *pDst, uint32_t dstBit)
+{
+  uint32_t k, i, bits;
+  uint8_t rgb[3];
+
+  while (n) {
+    k = (n > 32) ? 32 : n;
+    if (pCanvas->format == GLIB_CANVAS_FORMAT_1BPP) {
+      bits = 0;
+      for (i = 0; i < k; i += 24) {
+        bits |= GLIB_getDataBits(pRow, x + i, (k - i > 24) ? 24 : k - i) << i;
+      }
+    } else {
+      bits = 0;
+      for (i = 0; i < k; i++) {
+        GLIB_canvasRowToRgb888(pCanvas, pRow, x + i, 1, rgb);
+        if (rgb[1] == 0) bits |= 1UL << i;
+      }
+    }
+    GLIB_putBits(pDst, dstBit, k, bits);
+    x += k;
+    dstBit += k;
+    n -= k;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initializes an off-screen canvas
+*
+*  The pixel data is not cleared. Draw to the canvas with a GLIB_Context_t
+*  initialized by GLIB_contextInitCanvas, or with GLIB_canvasFill and
+*  GLIB_canvasCopy, and send it to the display with GLIB_canvasBlit or
+*  GLIB_flush.
+*
+*  @param pCanvas
+*  Pointer to the canvas
+*  @param format
+*  Pixel format, GLIB_CANVAS_FORMAT_xxx
+*  @param width
+*  Width in pixels
+*  @param height
+*  Height in pixels
+*  @param pPixels
+*  Pixel buffer of GLIB_CANVAS_WORDS(width, height, format) words. May be
+*  located in external memory.
+*  @param pPalette
+*  Palette of 8 bpp canvases, colors as 0x00RRGGBB. NULL for other formats.
+*  @param paletteSize
+*  Number of colors in the palette, at most 256
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_canvasInit(GLIB_Canvas_t *pCanvas, uint8_t format,
+                         uint16_t width, uint16_t height, uint32_t *pPixels,
+                         const uint32_t *pPalette, uint16_t paletteSize)
+{
+  /* Check arguments */
+  if ((pCanvas == NULL) || (pPixels == NULL) ||
+      (width == 0) || (height == 0)) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  switch (format) {
+  case GLIB_CANVAS_FORMAT_1BPP:
+    pCanvas->geometry.pixelFormat = DMD_PIXEL_FORMAT_MONO;
+    break;
+  case GLIB_CANVAS_FORMAT_8BPP_PALETTE:
+    if ((pPalette == NULL) || (paletteSize == 0) || (paletteSize > 256)) {
+      return GLIB_ERROR_INVALID_ARGUMENT;
+    }
+    pCanvas->geometry.pixelFormat = DMD_PIXEL_FORMAT_RGB888;
+    break;
+  case GLIB_CANVAS_FORMAT_RGB565:
+    pCanvas->geometry.pixelFormat = DMD_PIXEL_FORMAT_RGB888;
+    break;
+  default:
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  pCanvas->geometry.xSize = width;
+  pCanvas->geometry.ySize = height;
+  pCanvas->geometry.xClipStart = 0;
+  pCanvas->geometry.yClipStart = 0;
+  pCanvas->geometry.clipWidth = width;
+  pCanvas->geometry.clipHeight = height;
+  pCanvas->format = format;
+  pCanvas->stride = GLIB_CANVAS_STRIDE(width, format);
+  pCanvas->pPixels = pPixels;
+  pCanvas->pPalette = pPalette;
+  pCanvas->paletteSize = paletteSize;
+  pCanvas->xDisplay = 0;
+  pCanvas->yDisplay = 0;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Converts a 24 bpp color to a pixel value of the canvas
+*
+*  8 bpp canvases get the index of the nearest palette color. 1 bpp canvases
+*  get 1 (black) for colors with no green component, like the DMD drivers of
+*  monochrome displays.
+*
+*  @param pCanvas
+*  Pointer to the canvas
+*  @param color
+*  Color as 0x00RRGGBB
+*
+*  @return
+*  Returns the pixel value
+******************************************************************************/
+uint32_t GLIB_canvasColor(const GLIB_Canvas_t *pCanvas, uint32_t color)
+{
+  uint32_t i, best, bestDist, dist, entry;
+  int32_t dr, dg, db;
+
+  switch (pCanvas->format) {
+  case GLIB_CANVAS_FORMAT_1BPP:
+    return ((color >> GreenShift) & 0xFF) ? 0 : 1;
+
+  case GLIB_CANVAS_FORMAT_8BPP_PALETTE:
+    best = 0;
+    bestDist = 0xFFFFFFFF;
+    for (i = 0; (i < pCanvas->paletteSize) && bestDist; i++) {
+      entry = pCanvas->pPalette[i];
+      dr = (int32_t)((entry >> RedShift) & 0xFF) - (int32_t)((color >> RedShift) & 0xFF);
+      dg = (int32_t)((entry >> GreenShift) & 0xFF) - (int32_t)((color >> GreenShift) & 0xFF);
+      db = (int32_t)((entry >> BlueShift) & 0xFF) - (int32_t)((color >> BlueShift) & 0xFF);
+      dist = dr * dr + dg * dg + db * db;
+      if (dist < bestDist) {
+        best = i;
+        bestDist = dist;
+      }
+    }
+    return best;
+
+  default:
+    return ((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F);
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Fills a rectangle of the canvas with a pixel value
+*
+*  Ignores the clipping area of the canvas. Rows are filled a word at a time
+*  between the unaligned first and last pixels.
+*
+*  @param pCanvas
+*  Pointer to the canvas
+*  @param x
+*  Start x-coordinate
+*  @param y
+*  Start y-coordinate
+*  @param width
+*  Width in pixels
+*  @param height
+*  Height in pixels
+*  @param pixel
+*  Pixel value, see GLIB_canvasColor
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_canvasFill(GLIB_Canvas_t *pCanvas, uint32_t x, uint32_t y,
+                         uint32_t width, uint32_t height, uint32_t pixel)
+{
+  uint8_t *pRow;
+
+  /* Check arguments */
+  if (pCanvas == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
+  if ((x + width > pCanvas->geometry.xSize) ||
+      (y + height > pCanvas->geometry.ySize)) return GLIB_OUT_OF_BOUNDS;
+  if (width == 0) return GLIB_OK;
+
+  for (pRow = GLIB_canvasRow(pCanvas, y); height--; pRow += pCanvas->stride) {
+    GLIB_canvasFillRow(pCanvas, pRow, x, width, pixel);
+  }
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Copies a rectangle of a canvas to a canvas of the same format
+*
+*  Pixel values are copied unchanged, 8 bpp canvases must use the same
+*  palette. Source and destination may be the same canvas and overlap.
+*  Rows of 8 bpp and RGB565 canvases are copied with memmove, rows of 1 bpp
+*  canvases 32 pixels at a time.
+*
+*  @param pDst
+*  Pointer to the destination canvas
+*  @param x
+*  Destination x-coordinate
+*  @param y
+*  Destination y-coordinate
+*  @param pSrc
+*  Pointer to the source canvas
+*  @param pRect
+*  Rectangle of the source canvas to copy, or NULL for the whole canvas
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_canvasCopy(GLIB_Canvas_t *pDst, int32_t x, int32_t y,
+                         const GLIB_Canvas_t *pSrc, const GLIB_Rectangle_t *pRect)
+{
+  GLIB_Rectangle_t rect;
+  uint32_t width, height, row, col, k, bytesPerPixel;
+  int32_t srcRow, dstRow;
+  const uint8_t *pSrcRow;
+  uint8_t *pDstRow;
+  bool backwards;
+
+  /* Check arguments */
+  if ((pDst == NULL) || (pSrc == NULL) ||
+      (pDst->format != pSrc->format)) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  if (pRect != NULL) {
+    rect = *pRect;
+  } else {
+    rect.xMin = 0;
+    rect.yMin = 0;
+    rect.xMax = pSrc->geometry.xSize - 1;
+    rect.yMax = pSrc->geometry.ySize - 1;
+  }
+  if ((rect.xMin > rect.xMax) || (rect.yMin > rect.yMax)) return GLIB_ERROR_NOTHING_TO_DRAW;
+  if ((rect.xMin < 0) || (rect.yMin < 0) ||
+      (rect.xMax >= pSrc->geometry.xSize) || (rect.yMax >= pSrc->geometry.ySize)) return GLIB_OUT_OF_BOUNDS;
+
+  width = rect.xMax - rect.xMin + 1;
+  height = rect.yMax - rect.yMin + 1;
+  if ((x < 0) || (y < 0) ||
+      ((uint32_t)x + width > pDst->geometry.xSize) ||
+      ((uint32_t)y + height > pDst->geometry.ySize)) return GLIB_OUT_OF_BOUNDS;
+
+  /* Copy bottom-up when moving down within a canvas, and right to left when
+     moving right within a row */
+  backwards = (pDst->pPixels == pSrc->pPixels) && (y > rect.yMin);
+
+  for (row = 0; row < height; row++) {
+    srcRow = backwards ? rect.yMax - row : rect.yMin + row;
+    dstRow = srcRow - rect.yMin + y;
+    pSrcRow = GLIB_canvasRow(pSrc, srcRow);
+    pDstRow = GLIB_canvasRow(pDst, dstRow);
+
+    if (pSrc->format != GLIB_CANVAS_FORMAT_1BPP) {
+      bytesPerPixel = pSrc->format / 8;
+      memmove(pDstRow + x * bytesPerPixel, pSrcRow + rect.xMin * bytesPerPixel,
+              width * bytesPerPixel);
+    } else if ((pSrcRow == pDstRow) && (x > rect.xMin)) {
+      for (col = width; col > 0; col -= k) {
+        k = (col > 32) ? 32 : col;
+        GLIB_putBits((uint32_t *)pDstRow, x + col - k,  k,
+                     GLIB_getBits((const uint32_t *)pSrcRow, rect.xMin + col - k, k));
+      }
+    } else {
+      for (col = 0; col < width; col += k) {
+        k = (width - col > 32) ? 32 : width - col;
+        GLIB_putBits((uint32_t *)pDstRow, x + col, k,
+                     GLIB_getBits((const uint32_t *)pSrcRow, rect.xMin + col, k));
+      }
+    }
+  }
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes the pixel data buffered by GLIB_canvasBlit
+******************************************************************************/
+static EMSTATUS GLIB_canvasBlitFlush(uint32_t *pCount, uint32_t *pCol, uint32_t *pRow,
+                                     uint32_t col, uint32_t row)
+{
+  EMSTATUS status = DMD_OK;
+
+  if (*pCount) status = DMD_writeData(*pCol, *pRow, (uint8_t *)blitBuffer, *pCount);
+  *pCount = 0;
+  *pCol = col;
+  *pRow = row;
+  return status;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Copies a rectangle of the canvas to the display
+*
+*  The pixels are converted to the DMD_writeData pixel format of the display
+*  driver and written in as few DMD_writeData calls as possible. 1 bpp rows
+*  on byte boundaries are passed to monochrome drivers directly, a canvas
+*  holding whole rows of 32 pixel multiples in one call. Other pixels are
+*  converted in a buffer of GLIB_BLIT_BUFFER_PIXELS pixels, several rows per
+*  call when they fit. Drivers that do not describe their pixel format get
+*  DMD_writeColor calls for runs of equal pixels.
+*
+*  @param pCanvas
+*  Pointer to the canvas
+*  @param pRect
+*  Rectangle of the canvas to copy, or NULL for the whole canvas
+*  @param x
+*  Display x-coordinate of the top left corner of the rectangle
+*  @param y
+*  Display y-coordinate of the top left corner of the rectangle
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_canvasBlit(const GLIB_Canvas_t *pCanvas, const GLIB_Rectangle_t *pRect,
+                         int32_t x, int32_t y)
+{
+  EMSTATUS status;
+  DMD_DisplayGeometry *pGeometry;
+  GLIB_Rectangle_t rect;
+  uint32_t width, height, row, col, n, count, countCol, countRow, capacity;
+  uint32_t start;
+  const uint8_t *pRow;
+  uint8_t rgb[3], runRgb[3];
+
+  /* Check arguments */
+  if (pCanvas == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  if (pRect != NULL) {
+    rect = *pRect;
+  } else {
+    rect.xMin = 0;
+    rect.yMin = 0;
+    rect.xMax = pCanvas->geometry.xSize - 1;
+    rect.yMax = pCanvas->geometry.ySize - 1;
+  }
+  if ((rect.xMin > rect.xMax) || (rect.yMin > rect.yMax)) return GLIB_ERROR_NOTHING_TO_DRAW;
+  if ((rect.xMin < 0) || (rect.yMin < 0) ||
+      (rect.xMax >= pCanvas->geometry.xSize) ||
+      (rect.yMax >= pCanvas->geometry.ySize) ||
+      (x < 0) || (y < 0)) return GLIB_OUT_OF_BOUNDS;
+
+  width = rect.xMax - rect.xMin + 1;
+  height = rect.yMax - rect.yMin + 1;
+
+  status = DMD_getDisplayGeometry(&pGeometry);
+  if (status != DMD_OK) return status;
+
+  status = DMD_setClippingArea(x, y, width, height);
+  if (status != DMD_OK) return status;
+
+  pRow = GLIB_canvasRow(pCanvas, rect.yMin);
+
+  if ((pGeometry->pixelFormat == DMD_PIXEL_FORMAT_MONO) &&
+      (pCanvas->format == GLIB_CANVAS_FORMAT_1BPP) && ((rect.xMin & 0x7) == 0)) {
+    if (width == pCanvas->stride * 8) {
+      /* Whole rows with no padding, one call */
+      status = DMD_writeData(0, 0, pRow, width * height);
+    } else {
+      for (row = 0; (row < height) && (status == DMD_OK); row++) {
+        status = DMD_writeData(0, row, pRow + rect.xMin / 8, width);
+        pRow += pCanvas->stride;
+      }
+    }
+  } else if ((pGeometry->pixelFormat == DMD_PIXEL_FORMAT_MONO) ||
+             (pGeometry->pixelFormat == DMD_PIXEL_FORMAT_RGB888)) {
+    capacity = (pGeometry->pixelFormat == DMD_PIXEL_FORMAT_MONO) ?
+               GLIB_BLIT_BUFFER_PIXELS * 24 : GLIB_BLIT_BUFFER_PIXELS;
+    count = 0;
+    countCol = 0;
+    countRow = 0;
+    for (row = 0; (row < height) && (status == DMD_OK); row++) {
+      for (col = 0; (col < width) && (status == DMD_OK); col += n) {
+        if (count == capacity) {
+          status = GLIB_canvasBlitFlush(&count, &countCol, &countRow, col, row);
+        }
+        n = width - col;
+        if (n > capacity - count) n = capacity - count;
+        if (pGeometry->pixelFormat == DMD_PIXEL_FORMAT_MONO) {
+          GLIB_canvasRowToMono(pCanvas, pRow, rect.xMin + col, n, blitBuffer, count);
+        } else {
+          GLIB_canvasRowToRgb888(pCanvas, pRow, rect.xMin + col, n,
+                                 (uint8_t *)blitBuffer + count * 3);
+        }
+        count += n;
+      }
+      pRow += pCanvas->stride;
+    }
+    if (status == DMD_OK) status = GLIB_canvasBlitFlush(&count, &countCol, &countRow, 0, 0);
+  } else {
+    for (row = 0; (row < height) && (status == DMD_OK); row++) {
+      GLIB_canvasRowToRgb888(pCanvas, pRow, rect.xMin, 1, runRgb);
+      start = 0;
+      for (col = 1; (col <= width) && (status == DMD_OK); col++) {
+        if (col < width) {
+          GLIB_canvasRowToRgb888(pCanvas, pRow, rect.xMin + col, 1, rgb);
+          if (memcmp(rgb, runRgb, 3) == 0) continue;
+        }
+        status = DMD_writeColor(start, row, runRgb[0], runRgb[1], runRgb[2], col - start);
+        memcpy(runRgb, rgb, 3);
+        start = col;
+      }
+      pRow += pCanvas->stride;
+    }
+  }
+  if (status != DMD_OK) return status;
+
+  /* Reset driver clipping area to the whole display */
+  return DMD_setClippingArea(0, 0, pGeometry->xSize, pGeometry->ySize);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the clipping area used by GLIB_canvasWriteColor and
+*  GLIB_canvasWriteData, like DMD_setClippingArea
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_canvasSetClippingArea(GLIB_Canvas_t *pCanvas, uint16_t x, uint16_t y,
+                                    uint16_t width, uint16_t height)
+{
+  if ((x + width > pCanvas->geometry.xSize) ||
+      (y + height > pCanvas->geometry.ySize)) return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  if ((width == 0) || (height == 0)) return DMD_ERROR_EMPTY_CLIPPING_AREA;
+
+  pCanvas->geometry.xClipStart = x;
+  pCanvas->geometry.yClipStart = y;
+  pCanvas->geometry.clipWidth = width;
+  pCanvas->geometry.clipHeight = height;
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks that numPixels pixels from x, y fit in the clipping area of the
+*  canvas
+******************************************************************************/
+static EMSTATUS GLIB_canvasCheckWrite(const GLIB_Canvas_t *pCanvas, uint16_t x, uint16_t y,
+                                      uint32_t numPixels)
+{
+  const DMD_DisplayGeometry *pGeometry = &pCanvas->geometry;
+
+  if ((x >= pGeometry->clipWidth) || (y >= pGeometry->clipHeight)) {
+    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  }
+  if (numPixels > (uint32_t)(pGeometry->clipHeight - y - 1) * pGeometry->clipWidth +
+                  pGeometry->clipWidth - x) {
+    return DMD_ERROR_TOO_MUCH_DATA;
+  }
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes one color to a number of pixels of the canvas, like DMD_writeColor
+*
+*  Pixels are written from x, y relative to the clipping area, continuing at
+*  the start of the next row at the end of the clipping area. Whole rows are
+*  filled in one GLIB_canvasFill call.
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_canvasWriteColor(GLIB_Canvas_t *pCanvas, uint16_t x, uint16_t y,
+                               uint8_t red, uint8_t green, uint8_t blue,
+                               uint32_t numPixels)
+{
+  EMSTATUS status;
+  const DMD_DisplayGeometry *pGeometry = &pCanvas->geometry;
+  uint32_t pixel, n;
+
+  status = GLIB_canvasCheckWrite(pCanvas, x, y, numPixels);
+  if (status != DMD_OK) return status;
+
+  pixel = GLIB_canvasColor(pCanvas, GLIB_rgbColor(red, green, blue));
+
+  while (numPixels) {
+    if ((x == 0) && (numPixels >= pGeometry->clipWidth)) {
+      n = numPixels / pGeometry->clipWidth;
+      GLIB_canvasFill(pCanvas, pGeometry->xClipStart, pGeometry->yClipStart + y,
+                      pGeometry->clipWidth, n, pixel);
+      y += n;
+      numPixels -= n * pGeometry->clipWidth;
+    } else {
+      n = pGeometry->clipWidth - x;
+      if (n > numPixels) n = numPixels;
+      GLIB_canvasFill(pCanvas, pGeometry->xClipStart + x, pGeometry->yClipStart + y,
+                      n, 1, pixel);
+      x = 0;
+      y++;
+      numPixels -= n;
+    }
+  }
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes pixel data to the canvas, like DMD_writeData
+*
+*  The data format is geometry.pixelFormat of the canvas: 1 bpp for 1 bpp
+*  canvases, else 24 bpp. Pixels are written from x, y relative to the
+*  clipping area, continuing at the start of the next row at the end of the
+*  clipping area.
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_canvasWriteData(GLIB_Canvas_t *pCanvas, uint16_t x, uint16_t y,
+                              const uint8_t data[], uint32_t numPixels)
+{
+  EMSTATUS status;
+  const DMD_DisplayGeometry *pGeometry = &pCanvas->geometry;
+  uint32_t n, i, k, bit, color, lastColor, pixel;
+  uint8_t *pRow;
+
+  status = GLIB_canvasCheckWrite(pCanvas, x, y, numPixels);
+  if (status != DMD_OK) return status;
+
+  bit = 0;
+  lastColor = 0xFFFFFFFF;
+  pixel = 0;
+  while (numPixels) {
+    n = pGeometry->clipWidth - x;
+    if (n > numPixels) n = numPixels;
+    pRow = GLIB_canvasRow(pCanvas, pGeometry->yClipStart + y);
+
+    if (pCanvas->format == GLIB_CANVAS_FORMAT_1BPP) {
+      for (i = 0; i < n; i += k) {
+        k = (n - i > 24) ? 24 : n - i;
+        GLIB_putBits((uint32_t *)pRow, pGeometry->xClipStart + x + i, k,
+                     GLIB_getDataBits(data, bit, k));
+        bit += k;
+      }
+    } else {
+      for (i = 0; i < n; i++, data += 3) {
+        color = GLIB_rgbColor(data[0], data[1], data[2]);
+        if (color != lastColor) {
+          pixel = GLIB_canvasColor(pCanvas, color);
+          lastColor = color;
+        }
+        if (pCanvas->format == GLIB_CANVAS_FORMAT_RGB565) {
+          ((uint16_t *)pRow)[pGeometry->xClipStart + x + i] = (uint16_t)pixel;
+        } else {
+          pRow[pGeometry->xClipStart + x + i] = (uint8_t)pixel;
+        }
+      }
+    }
+
+    numPixels -= n;
+    x = 0;
+    y++;
+  }
+  return DMD_OK;
+}
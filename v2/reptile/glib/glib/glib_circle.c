@@ -121,8 +121,8 @@ EMSTATUS GLIB_drawPartialCircle(GLIB_Context_t *pContext, int32_t xCenter,
 *  @brief
 *  Draws a filled circle with center at x, y, and a radius.
 *
-*  Draws a circle using the Midpoint Circle Algorithm and using horizontal lines.
-*  See Wikipedia for algorithm.
+*  The circle is clipped once and drawn with one horizontal span per row by
+*  the scanline rasteriser, see GLIB_rasterCircle.
 *
 *  @param pContext
 *  Pointer to a GLIB_Context_t in which the circle is drawn. The circle is drawn using the foreground color.
@@ -142,50 +142,21 @@ EMSTATUS GLIB_drawPartialCircle(GLIB_Context_t *pContext, int32_t xCenter,
 EMSTATUS GLIB_drawCircleFilled(GLIB_Context_t *pContext, int32_t xCenter,
                                int32_t yCenter, uint32_t radius)
 {
-  EMSTATUS status;
-  int32_t x = 0;
-  int32_t y = radius;
-  int32_t d = 1 - radius;
-  uint32_t drawnElements = 0;
+  GLIB_SpanFill_t fill;
+  GLIB_Rectangle_t dirty;
   
   /* Check arguments */
   if (pContext == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
 
-  /* Draws the initial circle fill line */
-  status = GLIB_drawLineH(pContext, xCenter - y, yCenter, xCenter + y);
-  if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-  if (status == GLIB_OK) drawnElements++;
-
-  /* Loops through all points from 0 to 45 degrees of the circle
-   * (0 is defined straight upward) */
-  while (x < y) {        
-    if (d < 0) {
-      d += 2 * x + 1;
-    } else {
-      y--;
-      d += 2 * (x - y) + 1;
-    }
-
-    /* Draws horizontal fill lines using 4 way symmetry */
-    status = GLIB_drawLineH(pContext, xCenter - x, yCenter + y, xCenter + x);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-    if (status == GLIB_OK) drawnElements++;
-
-    status = GLIB_drawLineH(pContext, xCenter - y, yCenter + x, xCenter + y);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-    if (status == GLIB_OK) drawnElements++;
-
-    status = GLIB_drawLineH(pContext, xCenter - x, yCenter - y, xCenter + x);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-    if (status == GLIB_OK) drawnElements++;
+  dirty.xMin = xCenter - (int32_t)radius;
+  dirty.yMin = yCenter - (int32_t)radius;
+  dirty.xMax = xCenter + (int32_t)radius;
+  dirty.yMax = yCenter + (int32_t)radius;
+  GLIB_addDirtyRect(pContext, &dirty);
 
-    status = GLIB_drawLineH(pContext, xCenter - y, yCenter - x, xCenter + y);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-    if (status == GLIB_OK) drawnElements++;
-    
-    x++;
-  }
-  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+  GLIB_spanFillInit(&fill, pContext);
+  return GLIB_rasterCircle(&pContext->clippingRegion, xCenter, yCenter, radius,
+                           GLIB_fillSpan, &fill);
 }
 
 /**************************************************************************//**
@@ -0,0 +1,354 @@
+ /*************************************************************************//**
+ * @file glib_glyph.c
+ * @brief Silicon Labs Graphics Library: Packed Font Glyph Decoder and Cache
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+/* Standard C header files */
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+#if GLIB_GLYPH_CACHE_BYTES > 0xFFFC
+#error "GLIB_GLYPH_CACHE_BYTES must fit a 16 bit entry size when rounded up to words"
+#endif
+
+#if GLIB_GLYPH_CACHE_BYTES > 0
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+/* A cached glyph, in the pixel format of the display and drawn in the
+ * colors of the context it was cached for. An entry with size 0 is free. */
+typedef struct __GLIB_GlyphCacheEntry_t
+{
+  const GLIB_Glyph_t *pGlyph;
+  uint32_t foregroundColor;
+  uint32_t backgroundColor;
+  uint16_t offset;
+  uint16_t size;
+  uint8_t width;
+  uint8_t height;
+  uint8_t pixelFormat;
+} GLIB_GlyphCacheEntry_t;
+/** @endcond */
+
+/* Cached glyph data. Allocated as a ring, the oldest glyphs are evicted
+ * when the ring wraps. */
+static uint32_t glyphCacheData[(GLIB_GLYPH_CACHE_BYTES + 3) / 4];
+static GLIB_GlyphCacheEntry_t glyphCacheEntries[GLIB_GLYPH_CACHE_ENTRIES];
+/* Offset in glyphCacheData of the next glyph */
+static uint32_t glyphCacheHead;
+/* Entry of the next glyph */
+static uint32_t glyphCacheNext;
+#endif
+
+static GLIB_GlyphCacheStats_t glyphCacheStats;
+
+/**************************************************************************//**
+*  @brief
+*  Gets the alpha value of the next pixel of the glyph
+******************************************************************************/
+static uint32_t GLIB_glyphNextAlpha(GLIB_GlyphDecoder_t *pDecoder)
+{
+  uint32_t alpha;
+
+  if (pDecoder->pGlyph->encoding == GLIB_GLYPH_ENCODING_RLE) {
+    if (pDecoder->count == 0) {
+      pDecoder->value = *pDecoder->pData >> (8 - pDecoder->bpp);
+      pDecoder->count = (*pDecoder->pData++ & (0xFF >> pDecoder->bpp)) + 1;
+    }
+    pDecoder->count--;
+    return pDecoder->value;
+  }
+
+  if (pDecoder->count == 0) {
+    pDecoder->value = *pDecoder->pData++;
+    pDecoder->count = 8;
+  }
+  alpha = pDecoder->value & ((1 << pDecoder->bpp) - 1);
+  pDecoder->value >>= pDecoder->bpp;
+  pDecoder->count -= pDecoder->bpp;
+  return alpha;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Skips n pixels of the glyph
+******************************************************************************/
+static void GLIB_glyphSkip(GLIB_GlyphDecoder_t *pDecoder, uint32_t n)
+{
+  uint32_t take;
+
+  if (pDecoder->pGlyph->encoding == GLIB_GLYPH_ENCODING_RLE) {
+    while (n) {
+      if (pDecoder->count == 0) {
+        pDecoder->value = *pDecoder->pData >> (8 - pDecoder->bpp);
+        pDecoder->count = (*pDecoder->pData++ & (0xFF >> pDecoder->bpp)) + 1;
+      }
+      take = (n < pDecoder->count) ? n : pDecoder->count;
+      pDecoder->count -= take;
+      n -= take;
+    }
+    return;
+  }
+
+  n *= pDecoder->bpp;
+  if (n <= pDecoder->count) {
+    pDecoder->value >>= n;
+    pDecoder->count -= n;
+    return;
+  }
+
+  /* Move to the byte holding the next pixel, do not read beyond it */
+  n -= pDecoder->count;
+  pDecoder->pData += n >> 3;
+  pDecoder->count = 0;
+  if (n & 0x7) {
+    pDecoder->value = *pDecoder->pData++ >> (n & 0x7);
+    pDecoder->count = 8 - (n & 0x7);
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets up a decoder for a glyph of a packed font
+*
+*  @param pDecoder
+*  Pointer to the decoder state
+*
+*  @param pPackedFont
+*  Pointer to the packed font
+*
+*  @param pGlyph
+*  Pointer to the glyph in the glyph table of the font
+******************************************************************************/
+void GLIB_glyphDecodeInit(GLIB_GlyphDecoder_t *pDecoder,
+                          const GLIB_PackedFont_t *pPackedFont,
+                          const GLIB_Glyph_t *pGlyph)
+{
+  pDecoder->pGlyph = pGlyph;
+  pDecoder->pData  = pPackedFont->pData + pGlyph->offset;
+  pDecoder->bpp    = pPackedFont->bpp;
+  pDecoder->count  = 0;
+  pDecoder->value  = 0;
+  pDecoder->row    = 0;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Decodes the alpha values of a part of one row of a glyph cell. The cell
+*  is the text line height tall and starts at the pen position. Pixels of the
+*  cell not covered by the glyph bitmap get alpha 0.
+*
+*  Rows must be decoded in increasing order, rows that are not requested are
+*  skipped.
+*
+*  @param pDecoder
+*  Pointer to the decoder state
+*
+*  @param row
+*  Row of the cell, relative to the top of the text line
+*
+*  @param x
+*  First pixel of the row to decode, relative to the pen position
+*
+*  @param numPixels
+*  Number of pixels to decode
+*
+*  @param pAlpha
+*  Buffer receiving numPixels alpha values, 0 to (1 << bpp) - 1
+******************************************************************************/
+void GLIB_glyphDecodeRow(GLIB_GlyphDecoder_t *pDecoder, int32_t row,
+                         int32_t x, uint32_t numPixels, uint8_t *pAlpha)
+{
+  const GLIB_Glyph_t *pGlyph = pDecoder->pGlyph;
+  int32_t glyphRow = row - pGlyph->yOffset;
+  int32_t first, last, i;
+
+  memset(pAlpha, 0, numPixels);
+
+  if ((glyphRow < pDecoder->row) || (glyphRow >= pGlyph->height)) return;
+
+  /* Skip the glyph rows above */
+  GLIB_glyphSkip(pDecoder, (glyphRow - pDecoder->row) * pGlyph->width);
+  pDecoder->row = glyphRow + 1;
+
+  /* Glyph pixels inside the requested part of the row */
+  first = x - pGlyph->xOffset;
+  last  = first + (int32_t)numPixels;
+  if (first < 0) first = 0;
+  if (last > pGlyph->width) last = pGlyph->width;
+
+  if (first >= last) {
+    GLIB_glyphSkip(pDecoder, pGlyph->width);
+    return;
+  }
+
+  GLIB_glyphSkip(pDecoder, first);
+  for (i = first; i < last; i++) {
+    pAlpha[pGlyph->xOffset + i - x] = GLIB_glyphNextAlpha(pDecoder);
+  }
+  GLIB_glyphSkip(pDecoder, pGlyph->width - last);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Finds a glyph cell in the glyph cache
+*
+*  @param pContext
+*  Pointer to the GLIB_Context_t the glyph is drawn with. The colors and the
+*  pixel format of the context are part of the cached glyph.
+*
+*  @param pGlyph
+*  Pointer to the glyph in the glyph table of the font
+*
+*  @param width
+*  Width of the glyph cell
+*
+*  @param height
+*  Height of the glyph cell
+*
+*  @return
+*  Returns the glyph cell in the DMD_writeData pixel format, or NULL if it
+*  is not cached
+******************************************************************************/
+const uint8_t *GLIB_glyphCacheFind(const GLIB_Context_t *pContext,
+                                   const GLIB_Glyph_t *pGlyph,
+                                   uint32_t width, uint32_t height)
+{
+#if GLIB_GLYPH_CACHE_BYTES > 0
+  GLIB_GlyphCacheEntry_t *pEntry;
+
+  for (pEntry = glyphCacheEntries;
+       pEntry < &glyphCacheEntries[GLIB_GLYPH_CACHE_ENTRIES]; pEntry++) {
+    if ((pEntry->size != 0) &&
+        (pEntry->pGlyph == pGlyph) &&
+        (pEntry->width == width) &&
+        (pEntry->height == height) &&
+        (pEntry->foregroundColor == pContext->foregroundColor) &&
+        (pEntry->backgroundColor == pContext->backgroundColor) &&
+        (pEntry->pixelFormat == pContext->pDisplayGeometry->pixelFormat)) {
+      glyphCacheStats.hits++;
+      return (const uint8_t *)glyphCacheData + pEntry->offset;
+    }
+  }
+#else
+  (void)pContext;
+  (void)pGlyph;
+  (void)width;
+  (void)height;
+#endif
+  return NULL;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Allocates room for a glyph cell in the glyph cache. The caller fills in
+*  the pixel data before the next call to the cache.
+*
+*  @param pContext
+*  Pointer to the GLIB_Context_t the glyph is drawn with
+*
+*  @param pGlyph
+*  Pointer to the glyph in the glyph table of the font
+*
+*  @param width
+*  Width of the glyph cell
+*
+*  @param height
+*  Height of the glyph cell
+*
+*  @param size
+*  Size in bytes of the pixel data
+*
+*  @return
+*  Returns the buffer for the pixel data, or NULL if the glyph does not fit
+*  in the cache
+******************************************************************************/
+uint8_t *GLIB_glyphCacheAlloc(const GLIB_Context_t *pContext,
+                              const GLIB_Glyph_t *pGlyph,
+                              uint32_t width, uint32_t height, uint32_t size)
+{
+#if GLIB_GLYPH_CACHE_BYTES > 0
+  GLIB_GlyphCacheEntry_t *pEntry;
+
+  size = (size + 3) & ~0x3;
+  if ((size > sizeof(glyphCacheData)) || (width > 0xFF) || (height > 0xFF)) {
+    return NULL;
+  }
+
+  /* Wrap the ring and evict the glyphs in the way */
+  if (glyphCacheHead + size > sizeof(glyphCacheData)) glyphCacheHead = 0;
+  for (pEntry = glyphCacheEntries;
+       pEntry < &glyphCacheEntries[GLIB_GLYPH_CACHE_ENTRIES]; pEntry++) {
+    if ((pEntry->size != 0) &&
+        (pEntry->offset < glyphCacheHead + size) &&
+        (pEntry->offset + pEntry->size > glyphCacheHead)) {
+      pEntry->size = 0;
+      glyphCacheStats.evictions++;
+    }
+  }
+
+  pEntry = &glyphCacheEntries[glyphCacheNext];
+  if (pEntry->size != 0) glyphCacheStats.evictions++;
+  glyphCacheNext = (glyphCacheNext + 1) % GLIB_GLYPH_CACHE_ENTRIES;
+
+  pEntry->pGlyph          = pGlyph;
+  pEntry->foregroundColor = pContext->foregroundColor;
+  pEntry->backgroundColor = pContext->backgroundColor;
+  pEntry->pixelFormat     = pContext->pDisplayGeometry->pixelFormat;
+  pEntry->width           = width;
+  pEntry->height          = height;
+  pEntry->offset          = glyphCacheHead;
+  pEntry->size            = size;
+
+  glyphCacheHead += size;
+  glyphCacheStats.misses++;
+  return (uint8_t *)glyphCacheData + pEntry->offset;
+#else
+  (void)pContext;
+  (void)pGlyph;
+  (void)width;
+  (void)height;
+  (void)size;
+  return NULL;
+#endif
+}
+
+/**************************************************************************//**
+*  @brief
+*  Removes all glyphs from the glyph cache. Must be called if the data of a
+*  cached font is changed, e.g. when fonts are loaded into RAM.
+******************************************************************************/
+void GLIB_glyphCacheClear(void)
+{
+#if GLIB_GLYPH_CACHE_BYTES > 0
+  memset(glyphCacheEntries, 0, sizeof(glyphCacheEntries));
+  glyphCacheHead = 0;
+  glyphCacheNext = 0;
+#endif
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the glyph cache statistics
+*
+*  @param pStats
+*  Pointer to the structure receiving the statistics
+******************************************************************************/
+void GLIB_glyphCacheGetStats(GLIB_GlyphCacheStats_t *pStats)
+{
+  *pStats = glyphCacheStats;
+}
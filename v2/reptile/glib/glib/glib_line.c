@@ -81,8 +81,10 @@ EMSTATUS GLIB_drawLineH(GLIB_Context_t *pContext, int32_t x1, int32_t y1,
 
   /* Translate color and draw line using display driver */  
   length = x2 - x1 + 1;
+  GLIB_Rectangle_t dirty = {x1, y1, x2, y1};
+  GLIB_addDirtyRect(pContext, &dirty);
   GLIB_colorTranslate24bpp(pContext->foregroundColor, &red, &green, &blue);
-  return DMD_writeColor(x1, y1, red, green, blue, length);  
+  return GLIB_targetWriteColor(pContext, x1, y1, red, green, blue, length);  
 }
 
 /**************************************************************************//**
@@ -139,18 +141,21 @@ EMSTATUS GLIB_drawLineV(GLIB_Context_t *pContext, int32_t x1, int32_t y1,
 
   /* Translate color and draw line using display driver clipping (width = 1 => height <=> length) */  
   length = y2 - y1 + 1;  
-  status = DMD_setClippingArea(x1, y1, 1, length);
+  GLIB_Rectangle_t dirty = {x1, y1, x1, y2};
+  GLIB_addDirtyRect(pContext, &dirty);
+
+  status = GLIB_targetSetClippingArea(pContext, x1, y1, 1, length);
   if (status != DMD_OK) return status;
 
   GLIB_colorTranslate24bpp(pContext->foregroundColor, &red, &green, &blue);
-  status = DMD_writeColor(0, 0, red, green, blue, length);
+  status = GLIB_targetWriteColor(pContext, 0, 0, red, green, blue, length);
   if (status != DMD_OK) return status;
   
   /* Reset driver clipping area to GLIB clipping region */
-  return DMD_setClippingArea(pContext->clippingRegion.xMin, 
-                             pContext->clippingRegion.yMin, 
-                             pContext->clippingRegion.xMin + pContext->clippingRegion.xMax + 1, 
-                             pContext->clippingRegion.yMin + pContext->clippingRegion.yMax + 1);  
+  return GLIB_targetSetClippingArea(pContext, pContext->clippingRegion.xMin, 
+                                    pContext->clippingRegion.yMin, 
+                                    pContext->clippingRegion.xMin + pContext->clippingRegion.xMax + 1, 
+                                    pContext->clippingRegion.yMin + pContext->clippingRegion.yMax + 1);  
 }
 
 /**************************************************************************//**
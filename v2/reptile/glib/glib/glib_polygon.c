@@ -88,3 +88,51 @@ EMSTATUS GLIB_drawPolygon(GLIB_Context_t *pContext,
   }
   return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
 }
+
+/**************************************************************************//**
+*  @brief
+*  Draws a filled polygon.
+*
+*  The polygon is clipped once and drawn with horizontal spans by the
+*  scanline rasteriser, one span per row for convex polygons. Pixels on the
+*  left and top edges are filled, see GLIB_rasterPolygon.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t in which the polygon is drawn. The polygon is
+*  filled using the foreground color.
+*  @param numPoints
+*  Number of points in the polygon ( Has to be greater than 2 )
+*  @param polyPoints
+*  Pointer to array of polygon points. The points are laid out like this: polyPoints = {x1,y1,x2,y2 ... }
+*  Polypoints has to contain at least (numPoints * 2) entries
+*
+*  @return
+*  Returns GLIB_OK on if at least one span was drawn, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawPolygonFilled(GLIB_Context_t *pContext,
+                                uint32_t numPoints, const int32_t *polyPoints)
+{
+  GLIB_SpanFill_t fill;
+  GLIB_Rectangle_t dirty;
+  uint32_t point;
+
+  /* Check arguments */
+  if (pContext == NULL || polyPoints == NULL || numPoints < 3) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  /* Bounding box of the points */
+  dirty.xMin = dirty.xMax = polyPoints[0];
+  dirty.yMin = dirty.yMax = polyPoints[1];
+  for (point = 1; point < numPoints; point++)
+  {
+    if (polyPoints[2 * point] < dirty.xMin) dirty.xMin = polyPoints[2 * point];
+    if (polyPoints[2 * point] > dirty.xMax) dirty.xMax = polyPoints[2 * point];
+    if (polyPoints[2 * point + 1] < dirty.yMin) dirty.yMin = polyPoints[2 * point + 1];
+    if (polyPoints[2 * point + 1] > dirty.yMax) dirty.yMax = polyPoints[2 * point + 1];
+  }
+  GLIB_addDirtyRect(pContext, &dirty);
+
+  GLIB_spanFillInit(&fill, pContext);
+  return GLIB_rasterPolygon(&pContext->clippingRegion, numPoints, polyPoints,
+                            GLIB_fillSpan, &fill);
+}
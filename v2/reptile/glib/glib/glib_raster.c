@@ -0,0 +1,399 @@
+ /*************************************************************************//**
+ * @file glib_raster.c
+ * @brief Silicon Labs Graphics Library: Scanline Rasteriser
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+/* Standard C header files */
+#include <stdint.h>
+#include <stdbool.h>
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* The rasterisers clip each shape once against the clipping rectangle and
+ * hand each row of the shape to a span function as one run of pixels
+ * (polygons that are not convex may have several runs on a row). The
+ * GLIB_xxxContainsPoint functions give the same pixels one at a time, and
+ * serve as reference and for hit testing. Coordinates must be within
+ * -32768 to 32767. The host test in reptile/glib/host checks both against
+ * a reference of its own for random shapes and clipping regions. */
+
+/**************************************************************************//**
+*  @brief
+*  Returns the smallest integer not less than num / den, den > 0
+******************************************************************************/
+static int32_t GLIB_ceilDiv(int32_t num, int32_t den)
+{
+  int32_t q = num / den;
+
+  if ((num % den) > 0) q++;
+  return q;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the first pixel on row y right of the crossing of a polygon edge
+*
+*  @return
+*  Returns true if the edge crosses row y. Edges include their upper end
+*  point and exclude the lower one, so shared vertices cross once.
+******************************************************************************/
+static bool GLIB_edgeCrossing(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                              int32_t y, int32_t *pX)
+{
+  int32_t num, den;
+
+  if ((y0 > y) == (y1 > y)) return false;
+
+  num = (y - y0) * (x1 - x0);
+  den = y1 - y0;
+  if (den < 0) {
+    num = -num;
+    den = -den;
+  }
+  *pX = x0 + GLIB_ceilDiv(num, den);
+  return true;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the largest half width h of a circle row, h * h + dy * dy <= rr
+*
+*  @param h
+*  Half width of a neighbouring row, the search starts there
+******************************************************************************/
+static uint32_t GLIB_circleHalfWidth(uint32_t h, uint32_t dy, uint32_t rr)
+{
+  while ((h + 1) * (h + 1) + dy * dy <= rr) h++;
+  while (h * h + dy * dy > rr) h--;
+  return h;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Clips a span to the clipping rectangle and passes it to the span function
+******************************************************************************/
+static EMSTATUS GLIB_emitSpan(const GLIB_Rectangle_t *pClip, int32_t y,
+                              int32_t xMin, int32_t xMax,
+                              GLIB_SpanFunc_t spanFunc, void *pUser, uint32_t *pSpans)
+{
+  if (xMin < pClip->xMin) xMin = pClip->xMin;
+  if (xMax > pClip->xMax) xMax = pClip->xMax;
+  if (xMin > xMax) return GLIB_OK;
+
+  (*pSpans)++;
+  return spanFunc(pUser, y, xMin, xMax);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Rasterises a filled polygon
+*
+*  A pixel is inside when its coordinates are inside the polygon by the
+*  even-odd rule, see GLIB_polygonContainsPoint. Pixels on left and top
+*  edges are inside, pixels on right and bottom edges are not. Rows hold at
+*  most GLIB_RASTER_MAX_CROSSINGS edge crossings.
+*
+*  @param pClip
+*  Clipping rectangle
+*  @param numPoints
+*  Number of points in the polygon ( Has to be greater than 2 )
+*  @param polyPoints
+*  Pointer to array of polygon points laid out like this:
+*  polyPoints = {x1,y1,x2,y2 ... }
+*  @param spanFunc
+*  Called for each span, top to bottom and left to right
+*  @param pUser
+*  Passed to spanFunc
+*
+*  @return
+*  Returns GLIB_OK if at least one span was emitted, GLIB_ERROR_NOTHING_TO_DRAW
+*  if none, GLIB_ERROR_OUT_OF_MEMORY if a row had too many crossings, or the
+*  first error returned by spanFunc
+******************************************************************************/
+EMSTATUS GLIB_rasterPolygon(const GLIB_Rectangle_t *pClip, uint32_t numPoints,
+                            const int32_t *polyPoints,
+                            GLIB_SpanFunc_t spanFunc, void *pUser)
+{
+  EMSTATUS status;
+  int32_t crossings[GLIB_RASTER_MAX_CROSSINGS];
+  int32_t yMin, yMax, y, x;
+  uint32_t i, j, k, numCrossings, spans = 0;
+
+  /* Check arguments */
+  if ((pClip == NULL) || (polyPoints == NULL) || (spanFunc == NULL) ||
+      (numPoints < 3)) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  yMin = yMax = polyPoints[1];
+  for (i = 1; i < numPoints; i++) {
+    if (polyPoints[2 * i + 1] < yMin) yMin = polyPoints[2 * i + 1];
+    if (polyPoints[2 * i + 1] > yMax) yMax = polyPoints[2 * i + 1];
+  }
+
+  /* The bottom row only touches bottom edges */
+  yMax--;
+  if (yMin < pClip->yMin) yMin = pClip->yMin;
+  if (yMax > pClip->yMax) yMax = pClip->yMax;
+
+  for (y = yMin; y <= yMax; y++) {
+    /* Collect the crossings of the row in ascending order */
+    numCrossings = 0;
+    for (i = 0, j = numPoints - 1; i < numPoints; j = i++) {
+      if (!GLIB_edgeCrossing(polyPoints[2 * j], polyPoints[2 * j + 1],
+                             polyPoints[2 * i], polyPoints[2 * i + 1], y, &x)) continue;
+      if (numCrossings == GLIB_RASTER_MAX_CROSSINGS) return GLIB_ERROR_OUT_OF_MEMORY;
+      for (k = numCrossings++; (k > 0) && (crossings[k - 1] > x); k--) {
+        crossings[k] = crossings[k - 1];
+      }
+      crossings[k] = x;
+    }
+
+    /* Pixels between crossing 2n and 2n+1 are inside */
+    for (k = 0; k + 1 < numCrossings; k += 2) {
+      status = GLIB_emitSpan(pClip, y, crossings[k], crossings[k + 1] - 1,
+                             spanFunc, pUser, &spans);
+      if (status != GLIB_OK) return status;
+    }
+  }
+  return (spans == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Rasterises a filled circle
+*
+*  The circle holds the pixels at distance dx, dy from the center with
+*  dx * dx + dy * dy <= radius * radius + radius, see
+*  GLIB_circleContainsPoint. Each row is one span.
+*
+*  @param pClip
+*  Clipping rectangle
+*  @param xCenter
+*  Center x-coordinate
+*  @param yCenter
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*  @param spanFunc
+*  Called for each span, top to bottom
+*  @param pUser
+*  Passed to spanFunc
+*
+*  @return
+*  Returns GLIB_OK if at least one span was emitted, GLIB_ERROR_NOTHING_TO_DRAW
+*  if none, or the first error returned by spanFunc
+******************************************************************************/
+EMSTATUS GLIB_rasterCircle(const GLIB_Rectangle_t *pClip, int32_t xCenter,
+                           int32_t yCenter, uint32_t radius,
+                           GLIB_SpanFunc_t spanFunc, void *pUser)
+{
+  EMSTATUS status;
+  int32_t y, yMin, yMax, dy;
+  uint32_t h, rr, spans = 0;
+
+  /* Check arguments */
+  if ((pClip == NULL) || (spanFunc == NULL)) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  rr = radius * radius + radius;
+  yMin = yCenter - (int32_t)radius;
+  yMax = yCenter + (int32_t)radius;
+  if (yMin < pClip->yMin) yMin = pClip->yMin;
+  if (yMax > pClip->yMax) yMax = pClip->yMax;
+
+  h = 0;
+  for (y = yMin; y <= yMax; y++) {
+    dy = y - yCenter;
+    if (dy < 0) dy = -dy;
+    h = GLIB_circleHalfWidth(h, dy, rr);
+    status = GLIB_emitSpan(pClip, y, xCenter - (int32_t)h, xCenter + (int32_t)h,
+                           spanFunc, pUser, &spans);
+    if (status != GLIB_OK) return status;
+  }
+  return (spans == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the corner radius of a rounded rectangle, at most half the width
+*  and height
+******************************************************************************/
+static uint32_t GLIB_roundRectRadius(const GLIB_Rectangle_t *pRect, uint32_t radius)
+{
+  uint32_t max = (pRect->xMax - pRect->xMin) / 2;
+
+  if ((uint32_t)(pRect->yMax - pRect->yMin) / 2 < max) max = (pRect->yMax - pRect->yMin) / 2;
+  return (radius > max) ? max : radius;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Rasterises a filled rectangle with rounded corners
+*
+*  The corners are quarters of circles as drawn by GLIB_rasterCircle, see
+*  GLIB_roundRectContainsPoint. Each row is one span.
+*
+*  @param pClip
+*  Clipping rectangle
+*  @param pRect
+*  Rectangle, min and max coordinates included
+*  @param radius
+*  Corner radius, limited to half the width and height of the rectangle
+*  @param spanFunc
+*  Called for each span, top to bottom
+*  @param pUser
+*  Passed to spanFunc
+*
+*  @return
+*  Returns GLIB_OK if at least one span was emitted, GLIB_ERROR_NOTHING_TO_DRAW
+*  if none, or the first error returned by spanFunc
+******************************************************************************/
+EMSTATUS GLIB_rasterRoundRect(const GLIB_Rectangle_t *pClip, const GLIB_Rectangle_t *pRect,
+                              uint32_t radius, GLIB_SpanFunc_t spanFunc, void *pUser)
+{
+  EMSTATUS status;
+  int32_t y, yMin, yMax, dy, inset;
+  uint32_t h, rr, spans = 0;
+
+  /* Check arguments */
+  if ((pClip == NULL) || (pRect == NULL) || (spanFunc == NULL) ||
+      (pRect->xMin > pRect->xMax) || (pRect->yMin > pRect->yMax)) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  radius = GLIB_roundRectRadius(pRect, radius);
+  rr = radius * radius + radius;
+  yMin = (pRect->yMin < pClip->yMin) ? pClip->yMin : pRect->yMin;
+  yMax = (pRect->yMax > pClip->yMax) ? pClip->yMax : pRect->yMax;
+
+  h = 0;
+  for (y = yMin; y <= yMax; y++) {
+    dy = 0;
+    if (y < pRect->yMin + (int32_t)radius) dy = pRect->yMin + radius - y;
+    if (y > pRect->yMax - (int32_t)radius) dy = y - (pRect->yMax - radius);
+    h = GLIB_circleHalfWidth(h, dy, rr);
+    inset = radius - h;
+    status = GLIB_emitSpan(pClip, y, pRect->xMin + inset, pRect->xMax - inset,
+                           spanFunc, pUser, &spans);
+    if (status != GLIB_OK) return status;
+  }
+  return (spans == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks if a pixel is inside a polygon as filled by GLIB_rasterPolygon
+*
+*  @return
+*  Returns true if the pixel is inside
+******************************************************************************/
+bool GLIB_polygonContainsPoint(uint32_t numPoints, const int32_t *polyPoints,
+                               int32_t x, int32_t y)
+{
+  uint32_t i, j;
+  int32_t xCross;
+  bool inside = false;
+
+  for (i = 0, j = numPoints - 1; i < numPoints; j = i++) {
+    if (GLIB_edgeCrossing(polyPoints[2 * j], polyPoints[2 * j + 1],
+                          polyPoints[2 * i], polyPoints[2 * i + 1], y, &xCross) &&
+        (x < xCross)) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks if a pixel is inside a circle as filled by GLIB_rasterCircle
+*
+*  @return
+*  Returns true if the pixel is inside
+******************************************************************************/
+bool GLIB_circleContainsPoint(int32_t xCenter, int32_t yCenter, uint32_t radius,
+                              int32_t x, int32_t y)
+{
+  int32_t dx = x - xCenter;
+  int32_t dy = y - yCenter;
+
+  if ((dx > (int32_t)radius) || (-dx > (int32_t)radius) ||
+      (dy > (int32_t)radius) || (-dy > (int32_t)radius)) return false;
+  return (uint32_t)(dx * dx + dy * dy) <= radius * radius + radius;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks if a pixel is inside a rounded rectangle as filled by
+*  GLIB_rasterRoundRect
+*
+*  @return
+*  Returns true if the pixel is inside
+******************************************************************************/
+bool GLIB_roundRectContainsPoint(const GLIB_Rectangle_t *pRect, uint32_t radius,
+                                 int32_t x, int32_t y)
+{
+  int32_t xCenter, yCenter;
+
+  if (!GLIB_rectContainsPoint(pRect, x, y)) return false;
+
+  radius = GLIB_roundRectRadius(pRect, radius);
+  xCenter = (x < pRect->xMin + (int32_t)radius) ? pRect->xMin + (int32_t)radius :
+            (x > pRect->xMax - (int32_t)radius) ? pRect->xMax - (int32_t)radius : x;
+  yCenter = (y < pRect->yMin + (int32_t)radius) ? pRect->yMin + (int32_t)radius :
+            (y > pRect->yMax - (int32_t)radius) ? pRect->yMax - (int32_t)radius : y;
+  return GLIB_circleContainsPoint(xCenter, yCenter, radius, x, y);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Prepares a GLIB_SpanFill_t for GLIB_fillSpan with the foreground color
+*  of the GLIB_Context_t
+*
+*  @param pFill
+*  Pointer to the span fill state
+*  @param pContext
+*  Pointer to a GLIB_Context_t
+******************************************************************************/
+void GLIB_spanFillInit(GLIB_SpanFill_t *pFill, GLIB_Context_t *pContext)
+{
+  pFill->pContext = pContext;
+  GLIB_colorTranslate24bpp(pContext->foregroundColor,
+                           &pFill->red, &pFill->green, &pFill->blue);
+  if (pContext->pCanvas != NULL) {
+    pFill->pixel = GLIB_canvasColor(pContext->pCanvas, pContext->foregroundColor);
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Span function filling spans with the color prepared by GLIB_spanFillInit
+*
+*  Canvas spans are filled with GLIB_canvasFill, display spans with one
+*  DMD_writeColor call.
+*
+*  @param pUser
+*  Pointer to a GLIB_SpanFill_t
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_fillSpan(void *pUser, int32_t y, int32_t xMin, int32_t xMax)
+{
+  GLIB_SpanFill_t *pFill = (GLIB_SpanFill_t *)pUser;
+  GLIB_Context_t *pContext = pFill->pContext;
+
+  if (pContext->pCanvas != NULL) {
+    return GLIB_canvasFill(pContext->pCanvas, xMin, y, xMax - xMin + 1, 1, pFill->pixel);
+  }
+  return DMD_writeColor(xMin, y, pFill->red, pFill->green, pFill->blue, xMax - xMin + 1);
+}
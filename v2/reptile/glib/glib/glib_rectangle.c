@@ -194,15 +194,54 @@ EMSTATUS GLIB_drawRectFilled(GLIB_Context_t *pContext, GLIB_Rectangle_t *pRect)
   width  = tmpRectangle.xMax - tmpRectangle.xMin + 1;
   height = tmpRectangle.yMax - tmpRectangle.yMin + 1;
 
-  status = DMD_setClippingArea(tmpRectangle.xMin, tmpRectangle.yMin, width, height);
+  GLIB_addDirtyRect(pContext, &tmpRectangle);
+
+  status = GLIB_targetSetClippingArea(pContext, tmpRectangle.xMin, tmpRectangle.yMin, width, height);
   if (status != DMD_OK) return status;
 
-  status = DMD_writeColor(0, 0, red, green, blue, width * height);
+  status = GLIB_targetWriteColor(pContext, 0, 0, red, green, blue, width * height);
   if (status != DMD_OK) return status;
 
   /* Reset driver clipping area to GLIB clipping region */
-  return DMD_setClippingArea(pContext->clippingRegion.xMin, 
-                               pContext->clippingRegion.yMin, 
-                               pContext->clippingRegion.xMin + pContext->clippingRegion.xMax + 1, 
-                               pContext->clippingRegion.yMin + pContext->clippingRegion.yMax + 1);  
+  return GLIB_targetSetClippingArea(pContext, pContext->clippingRegion.xMin, 
+                                      pContext->clippingRegion.yMin, 
+                                      pContext->clippingRegion.xMin + pContext->clippingRegion.xMax + 1, 
+                                      pContext->clippingRegion.yMin + pContext->clippingRegion.yMax + 1);  
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a filled rectangle with rounded corners
+*
+*  The rectangle is clipped once and drawn with one horizontal span per row
+*  by the scanline rasteriser, see GLIB_rasterRoundRect.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t which holds the foreground color and clipping
+*  region
+*  @param pRect
+*  Pointer to a GLIB_Rectangle_t which defines the rectangle to draw
+*  @param radius
+*  Corner radius, limited to half the width and height of the rectangle
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawRoundRectFilled(GLIB_Context_t *pContext,
+                                  const GLIB_Rectangle_t *pRect, uint32_t radius)
+{
+  GLIB_SpanFill_t fill;
+  GLIB_Rectangle_t tmpRectangle;
+
+  /* Check arguments */
+  if ((pContext == NULL) || (pRect == NULL)) return GLIB_ERROR_INVALID_ARGUMENT;
+
+  tmpRectangle = *pRect;
+  GLIB_normalizeRect(&tmpRectangle);
+  GLIB_addDirtyRect(pContext, &tmpRectangle);
+
+  GLIB_spanFillInit(&fill, pContext);
+  return GLIB_rasterRoundRect(&pContext->clippingRegion, &tmpRectangle, radius,
+                              GLIB_fillSpan, &fill);
 }
@@ -24,6 +24,533 @@
 #include "glib.h"
 #include "glib_color.h"
 
+/* Row buffers of the text renderer. The mask holds one bit per pixel, set
+ * for foreground, LSB first. The data buffer holds the rows in the pixel
+ * format of the display driver. */
+static uint8_t rowMask[(GLIB_ROW_BUFFER_PIXELS + 7) / 8];
+static uint8_t rowData[GLIB_ROW_BUFFER_PIXELS * 3];
+
+/* Alpha values of one glyph row of a packed font, and the colors and the
+ * mono display bit of each alpha value for the current text line. */
+static uint8_t rowAlpha[GLIB_ROW_BUFFER_PIXELS];
+static uint8_t alphaColor[16][3];
+static uint16_t alphaBlack;
+
+/**************************************************************************//**
+*  @brief
+*  Get the index of a char in the font pixel map
+*
+*  @return
+*  Returns the index, or -1 if the font does not contain the char
+******************************************************************************/
+static int32_t GLIB_fontIndex(const GLIB_Font_t *pFont, char myChar)
+{
+  int32_t fontIdx;
+  const GLIB_PackedFont_t *pPackedFont;
+
+  if (pFont->class == PackedFont) {
+    pPackedFont = (const GLIB_PackedFont_t *)pFont->pFontPixMap;
+    fontIdx = (uint8_t)myChar - pPackedFont->firstChar;
+    if ((fontIdx < 0) || (fontIdx >= pPackedFont->numChars)) return -1;
+    return fontIdx;
+  }
+
+  if ((myChar < ' ') || (myChar > '~')) return -1;
+
+  /* Sets the index in the font array */
+  if (pFont->class == NumbersOnlyFont) {
+    fontIdx = myChar - '0';
+    if (myChar == ':') {
+      fontIdx = 10;
+    }
+    if (myChar == ' ') {
+      fontIdx = 11;
+    }
+  } else { /* FullFont class */
+    fontIdx = myChar - ' ';
+  }
+
+  if ((fontIdx < 0) || (fontIdx > pFont->cntOfMapElements - 1)) return -1;
+
+  return fontIdx;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Get one row of a glyph, bit 0 is the leftmost pixel
+******************************************************************************/
+static uint32_t GLIB_fontRow(const GLIB_Font_t *pFont, uint32_t fontIdx,
+                             uint32_t row)
+{
+  fontIdx += row * pFont->fontRowOffset;
+
+  switch (pFont->sizeOfMapElement) {
+    case 1:
+      return ((const uint8_t *)pFont->pFontPixMap)[fontIdx];
+
+    case 2:
+      return ((const uint16_t *)pFont->pFontPixMap)[fontIdx];
+
+    default:
+      return ((const uint32_t *)pFont->pFontPixMap)[fontIdx];
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets n (<= 32) bits in the row mask starting at bit position pos
+******************************************************************************/
+static void GLIB_maskSetBits(uint32_t pos, uint32_t bits, uint32_t n)
+{
+  uint32_t take;
+
+  while (n && bits) {
+    take = 8 - (pos & 0x7);
+    if (take > n) take = n;
+    rowMask[pos >> 3] |= (uint8_t)((bits & ((1U << take) - 1)) << (pos & 0x7));
+    bits >>= take;
+    pos  += take;
+    n    -= take;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Expands n pixels of one glyph row of a text line into the row mask
+*
+*  @param px
+*  First pixel to expand, relative to the start of the text line
+*  @param pos
+*  Bit position in the row mask of the first pixel
+******************************************************************************/
+static void GLIB_maskTextRow(const GLIB_Font_t *pFont, const char *pString,
+                             uint32_t row, uint32_t px, uint32_t n, uint32_t pos)
+{
+  uint32_t cellWidth = pFont->fontWidth + pFont->charSpacing;
+  uint32_t charIdx = px / cellWidth;
+  uint32_t offset = px % cellWidth;
+  uint32_t take;
+
+  while (n) {
+    take = cellWidth - offset;
+    if (take > n) take = n;
+
+    /* Spacing pixels are background and are left cleared */
+    if (offset < pFont->fontWidth) {
+      GLIB_maskSetBits(pos,
+                       GLIB_fontRow(pFont, GLIB_fontIndex(pFont, pString[charIdx]), row) >> offset,
+                       (take < pFont->fontWidth - offset) ? take : pFont->fontWidth - offset);
+    }
+
+    pos += take;
+    n   -= take;
+    charIdx++;
+    offset = 0;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes the pixels of the row mask as runs of color with DMD_writeColor.
+*  Used for transparent text and for drivers that do not describe their
+*  DMD_writeData pixel format.
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS GLIB_writeMaskRuns(GLIB_Context_t *pContext, uint32_t y,
+                                   uint32_t n, bool opaque, uint32_t *pDrawn)
+{
+  EMSTATUS status;
+  uint32_t start, x;
+  bool fg;
+  uint8_t red, green, blue;
+
+  x = 0;
+  while (x < n) {
+    fg = (rowMask[x >> 3] >> (x & 0x7)) & 0x1;
+    start = x;
+    do {
+      x++;
+    } while ((x < n) && ((bool)((rowMask[x >> 3] >> (x & 0x7)) & 0x1) == fg));
+
+    if (!fg && !opaque) continue;
+
+    GLIB_colorTranslate24bpp(fg ? pContext->foregroundColor : pContext->backgroundColor,
+                             &red, &green, &blue);
+    status = GLIB_targetWriteColor(pContext, start, y, red, green, blue, x - start);
+    if (status != DMD_OK) return status;
+    *pDrawn += x - start;
+  }
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Converts the row mask to the driver pixel format and writes it with one
+*  DMD_writeData call
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS GLIB_writeMaskData(GLIB_Context_t *pContext, uint32_t y, uint32_t n)
+{
+  uint32_t i;
+  uint8_t fgRgb[3], bgRgb[3];
+  uint8_t fgBlack, bgBlack;
+  const uint8_t *pColor;
+
+  GLIB_colorTranslate24bpp(pContext->foregroundColor, &fgRgb[0], &fgRgb[1], &fgRgb[2]);
+  GLIB_colorTranslate24bpp(pContext->backgroundColor, &bgRgb[0], &bgRgb[1], &bgRgb[2]);
+
+  if (pContext->pDisplayGeometry->pixelFormat == DMD_PIXEL_FORMAT_MONO) {
+    /* The driver treats pixels with no green component as black */
+    fgBlack = (fgRgb[1] == 0) ? 0xFF : 0x00;
+    bgBlack = (bgRgb[1] == 0) ? 0xFF : 0x00;
+    for (i = 0; i < (n + 7) / 8; i++) {
+      rowMask[i] = (rowMask[i] & fgBlack) | (~rowMask[i] & bgBlack);
+    }
+    return GLIB_targetWriteData(pContext, 0, y, rowMask, n);
+  }
+
+  for (i = 0; i < n; i++) {
+    pColor = ((rowMask[i >> 3] >> (i & 0x7)) & 0x1) ? fgRgb : bgRgb;
+    rowData[3 * i]     = pColor[0];
+    rowData[3 * i + 1] = pColor[1];
+    rowData[3 * i + 2] = pColor[2];
+  }
+  return GLIB_targetWriteData(pContext, 0, y, rowData, n);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets up the colors of the alpha values of a packed font. Alpha values are
+*  the foreground color blended with the background color. On mono displays
+*  alpha values above half are drawn in the foreground color, the others in
+*  the background color.
+******************************************************************************/
+static void GLIB_alphaColorsInit(GLIB_Context_t *pContext, uint32_t bpp)
+{
+  uint8_t fgRgb[3], bgRgb[3];
+  const uint8_t *pColor;
+  int32_t max = (1 << bpp) - 1;
+  int32_t alpha, i;
+  bool mono = (pContext->pDisplayGeometry->pixelFormat == DMD_PIXEL_FORMAT_MONO);
+
+  GLIB_colorTranslate24bpp(pContext->foregroundColor, &fgRgb[0], &fgRgb[1], &fgRgb[2]);
+  GLIB_colorTranslate24bpp(pContext->backgroundColor, &bgRgb[0], &bgRgb[1], &bgRgb[2]);
+
+  alphaBlack = 0;
+  for (alpha = 0; alpha <= max; alpha++) {
+    for (i = 0; i < 3; i++) {
+      alphaColor[alpha][i] = bgRgb[i] + ((fgRgb[i] - bgRgb[i]) * alpha + max / 2) / max;
+    }
+    /* The driver treats pixels with no green component as black */
+    pColor = (2 * alpha > max) ? fgRgb : bgRgb;
+    if (pColor[1] == 0) alphaBlack |= 1 << alpha;
+    /* The driver draws any blended color with green as white, runs written
+     * by GLIB_writeAlphaRuns get the thresholded color instead */
+    if (mono) memcpy(alphaColor[alpha], pColor, 3);
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Converts n alpha values of rowAlpha to the driver pixel format
+*
+*  @param pData
+*  Destination buffer, RGB888 or mono pixel data
+*  @param pos
+*  Pixel position in pData of the first pixel
+******************************************************************************/
+static void GLIB_alphaToData(uint8_t pixelFormat, uint8_t *pData, uint32_t pos,
+                             uint32_t n)
+{
+  uint32_t i;
+
+  if (pixelFormat == DMD_PIXEL_FORMAT_MONO) {
+    /* pData is cleared by the caller */
+    for (i = 0; i < n; i++, pos++) {
+      if ((alphaBlack >> rowAlpha[i]) & 0x1) pData[pos >> 3] |= 1 << (pos & 0x7);
+    }
+    return;
+  }
+
+  pData += 3 * pos;
+  for (i = 0; i < n; i++) {
+    *pData++ = alphaColor[rowAlpha[i]][0];
+    *pData++ = alphaColor[rowAlpha[i]][1];
+    *pData++ = alphaColor[rowAlpha[i]][2];
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes the pixels of rowAlpha as runs of color with DMD_writeColor. Used
+*  for transparent text and for drivers that do not describe their
+*  DMD_writeData pixel format. Transparent text skips pixels of alpha 0, the
+*  other pixels are blended with the background color of the context.
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS GLIB_writeAlphaRuns(GLIB_Context_t *pContext, uint32_t y,
+                                    uint32_t n, bool opaque, uint32_t *pDrawn)
+{
+  EMSTATUS status;
+  uint32_t start, x;
+  uint8_t alpha;
+
+  x = 0;
+  while (x < n) {
+    alpha = rowAlpha[x];
+    start = x;
+    do {
+      x++;
+    } while ((x < n) && (rowAlpha[x] == alpha));
+
+    if ((alpha == 0) && !opaque) continue;
+
+    status = GLIB_targetWriteColor(pContext, start, y, alphaColor[alpha][0],
+                                   alphaColor[alpha][1], alphaColor[alpha][2],
+                                   x - start);
+    if (status != DMD_OK) return status;
+    *pDrawn += x - start;
+  }
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the cell of one glyph of a packed font. The cell is the advance of
+*  the glyph plus the char spacing wide and the font height tall, glyph
+*  pixels outside the cell are not drawn.
+*
+*  Opaque cells which are not clipped are drawn from the glyph cache with one
+*  DMD_writeData call. Other cells are decoded row by row and written in
+*  column strips like the text lines of the fixed size fonts.
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS GLIB_drawGlyphCell(GLIB_Context_t *pContext,
+                                   const GLIB_Glyph_t *pGlyph, int32_t x,
+                                   int32_t y, uint32_t cellWidth, bool opaque,
+                                   uint32_t *pDrawn)
+{
+  EMSTATUS status;
+  const GLIB_PackedFont_t *pPackedFont = (const GLIB_PackedFont_t *)pContext->font.pFontPixMap;
+  GLIB_GlyphDecoder_t decoder;
+  GLIB_Rectangle_t box;
+  uint32_t cellHeight = pContext->font.fontHeight;
+  uint32_t width, height, stripX, rowsPerWrite, row, bufRow, size;
+  uint8_t pixelFormat = pContext->pDisplayGeometry->pixelFormat;
+  const uint8_t *pCached;
+  uint8_t *pCache;
+  uint8_t *pBuffer;
+  bool useData;
+
+  box.xMin = x;
+  box.yMin = y;
+  box.xMax = x + cellWidth - 1;
+  box.yMax = y + cellHeight - 1;
+
+  /* Clip the cell */
+  if (box.xMin < pContext->clippingRegion.xMin) box.xMin = pContext->clippingRegion.xMin;
+  if (box.xMax > pContext->clippingRegion.xMax) box.xMax = pContext->clippingRegion.xMax;
+  if (box.yMin < pContext->clippingRegion.yMin) box.yMin = pContext->clippingRegion.yMin;
+  if (box.yMax > pContext->clippingRegion.yMax) box.yMax = pContext->clippingRegion.yMax;
+  if ((cellWidth == 0) || (box.xMin > box.xMax) || (box.yMin > box.yMax)) return DMD_OK;
+
+  GLIB_addDirtyRect(pContext, &box);
+
+  useData = opaque &&
+            ((pixelFormat == DMD_PIXEL_FORMAT_RGB888) ||
+             (pixelFormat == DMD_PIXEL_FORMAT_MONO));
+  pBuffer = (pixelFormat == DMD_PIXEL_FORMAT_MONO) ? rowMask : rowData;
+
+  if (useData &&
+      (box.xMin == x) && (box.xMax == (int32_t)(x + cellWidth - 1)) &&
+      (box.yMin == y) && (box.yMax == (int32_t)(y + cellHeight - 1))) {
+    pCached = GLIB_glyphCacheFind(pContext, pGlyph, cellWidth, cellHeight);
+    if ((pCached == NULL) && (cellWidth <= GLIB_ROW_BUFFER_PIXELS)) {
+      size = (pixelFormat == DMD_PIXEL_FORMAT_MONO) ?
+             (cellWidth * cellHeight + 7) / 8 : cellWidth * cellHeight * 3;
+      pCache = GLIB_glyphCacheAlloc(pContext, pGlyph, cellWidth, cellHeight, size);
+      if (pCache != NULL) {
+        memset(pCache, 0, size);
+        GLIB_glyphDecodeInit(&decoder, pPackedFont, pGlyph);
+        for (row = 0; row < cellHeight; row++) {
+          GLIB_glyphDecodeRow(&decoder, row, 0, cellWidth, rowAlpha);
+          GLIB_alphaToData(pixelFormat, pCache, row * cellWidth, cellWidth);
+        }
+        pCached = pCache;
+      }
+    }
+
+    if (pCached != NULL) {
+      status = GLIB_targetSetClippingArea(pContext, x, y, cellWidth, cellHeight);
+      if (status != DMD_OK) return status;
+      *pDrawn += cellWidth * cellHeight;
+      return GLIB_targetWriteData(pContext, 0, 0, pCached, cellWidth * cellHeight);
+    }
+  }
+
+  height = box.yMax - box.yMin + 1;
+
+  for (stripX = box.xMin; stripX <= (uint32_t)box.xMax; stripX += width) {
+    width = box.xMax - stripX + 1;
+    if (width > GLIB_ROW_BUFFER_PIXELS) width = GLIB_ROW_BUFFER_PIXELS;
+    rowsPerWrite = useData ? GLIB_ROW_BUFFER_PIXELS / width : 1;
+
+    status = GLIB_targetSetClippingArea(pContext, stripX, box.yMin, width, height);
+    if (status != DMD_OK) return status;
+
+    GLIB_glyphDecodeInit(&decoder, pPackedFont, pGlyph);
+    bufRow = 0;
+    for (row = 0; row < height; row++) {
+      if (bufRow == 0) memset(rowMask, 0, sizeof(rowMask));
+
+      GLIB_glyphDecodeRow(&decoder, box.yMin - y + row, stripX - x, width, rowAlpha);
+
+      status = DMD_OK;
+      if (!useData) {
+        status = GLIB_writeAlphaRuns(pContext, row, width, opaque, pDrawn);
+      } else {
+        GLIB_alphaToData(pixelFormat, pBuffer, bufRow * width, width);
+        bufRow++;
+        if ((bufRow == rowsPerWrite) || (row == height - 1)) {
+          status = GLIB_targetWriteData(pContext, 0, row + 1 - bufRow, pBuffer,
+                                        bufRow * width);
+          *pDrawn += bufRow * width;
+          bufRow = 0;
+        }
+      }
+      if (status != DMD_OK) return status;
+    }
+  }
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws one line of chars of a packed font, one glyph cell after the other.
+*  All chars must be valid in the current font.
+*
+*  @param pDrawn
+*  Incremented by the number of pixels written
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS GLIB_drawPackedTextLine(GLIB_Context_t *pContext, const char *pString,
+                                        uint32_t numChars, int32_t x, int32_t y,
+                                        bool opaque, uint32_t *pDrawn)
+{
+  EMSTATUS status;
+  const GLIB_PackedFont_t *pPackedFont = (const GLIB_PackedFont_t *)pContext->font.pFontPixMap;
+  const GLIB_Glyph_t *pGlyph;
+  uint32_t i, cellWidth;
+
+  if (numChars == 0) return GLIB_OK;
+
+  GLIB_alphaColorsInit(pContext, pPackedFont->bpp);
+
+  for (i = 0; i < numChars; i++) {
+    pGlyph = &pPackedFont->pGlyphs[GLIB_fontIndex(&pContext->font, pString[i])];
+    cellWidth = pGlyph->xAdvance + pContext->font.charSpacing;
+
+    status = GLIB_drawGlyphCell(pContext, pGlyph, x, y, cellWidth, opaque, pDrawn);
+    if (status != DMD_OK) return status;
+
+    x += cellWidth;
+  }
+
+  /* Pixel coordinates of the other drawing functions are display coordinates,
+     reset driver clipping area to the whole display */
+  return GLIB_resetDisplayClippingArea(pContext);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws one line of chars. The text box is clipped once and the glyph rows
+*  are written in column strips of at most GLIB_ROW_BUFFER_PIXELS pixels,
+*  with as many rows per DMD_writeData call as fit in the row buffer.
+*  All chars must be valid in the current font.
+*
+*  @param pDrawn
+*  Incremented by the number of pixels written
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS GLIB_drawTextLine(GLIB_Context_t *pContext, const char *pString,
+                                  uint32_t numChars, int32_t x, int32_t y,
+                                  bool opaque, uint32_t *pDrawn)
+{
+  EMSTATUS status;
+  const GLIB_Font_t *pFont = &pContext->font;
+  GLIB_Rectangle_t box;
+  uint32_t width, height, stripX, rowsPerWrite, row, bufRow;
+  bool useData;
+
+  if (pFont->class == PackedFont) {
+    return GLIB_drawPackedTextLine(pContext, pString, numChars, x, y, opaque, pDrawn);
+  }
+
+  box.xMin = x;
+  box.yMin = y;
+  box.xMax = x + numChars * (pFont->fontWidth + pFont->charSpacing) - 1;
+  box.yMax = y + pFont->fontHeight - 1;
+
+  /* Clip the text box */
+  if (box.xMin < pContext->clippingRegion.xMin) box.xMin = pContext->clippingRegion.xMin;
+  if (box.xMax > pContext->clippingRegion.xMax) box.xMax = pContext->clippingRegion.xMax;
+  if (box.yMin < pContext->clippingRegion.yMin) box.yMin = pContext->clippingRegion.yMin;
+  if (box.yMax > pContext->clippingRegion.yMax) box.yMax = pContext->clippingRegion.yMax;
+  if ((numChars == 0) || (box.xMin > box.xMax) || (box.yMin > box.yMax)) return GLIB_OK;
+
+  GLIB_addDirtyRect(pContext, &box);
+
+  useData = opaque &&
+            ((pContext->pDisplayGeometry->pixelFormat == DMD_PIXEL_FORMAT_RGB888) ||
+             (pContext->pDisplayGeometry->pixelFormat == DMD_PIXEL_FORMAT_MONO));
+  height = box.yMax - box.yMin + 1;
+
+  for (stripX = box.xMin; stripX <= (uint32_t)box.xMax; stripX += width) {
+    width = box.xMax - stripX + 1;
+    if (width > GLIB_ROW_BUFFER_PIXELS) width = GLIB_ROW_BUFFER_PIXELS;
+    rowsPerWrite = useData ? GLIB_ROW_BUFFER_PIXELS / width : 1;
+
+    status = GLIB_targetSetClippingArea(pContext, stripX, box.yMin, width, height);
+    if (status != DMD_OK) return status;
+
+    bufRow = 0;
+    for (row = 0; row < height; row++) {
+      if (bufRow == 0) memset(rowMask, 0, sizeof(rowMask));
+
+      GLIB_maskTextRow(pFont, pString, box.yMin - y + row, stripX - x, width,
+                       bufRow * width);
+      bufRow++;
+
+      status = DMD_OK;
+      if (!useData) {
+        status = GLIB_writeMaskRuns(pContext, row, width, opaque, pDrawn);
+        bufRow = 0;
+      } else if ((bufRow == rowsPerWrite) || (row == height - 1)) {
+        status = GLIB_writeMaskData(pContext, row + 1 - bufRow, bufRow * width);
+        *pDrawn += bufRow * width;
+        bufRow = 0;
+      }
+      if (status != DMD_OK) return status;
+    }
+  }
+
+  /* Pixel coordinates of the other drawing functions are display coordinates,
+     reset driver clipping area to the whole display */
+  return GLIB_resetDisplayClippingArea(pContext);
+}
+
 /**************************************************************************//**
 *  @brief
 *  Draws a char using the font supplied with the library.
@@ -52,87 +579,17 @@ EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x, int32_t
                        bool opaque)
 {
   EMSTATUS status;
-  uint16_t fontIdx;
-  uint8_t *pPixMap8;
-  uint16_t *pPixMap16;
-  uint32_t *pPixMap32;
-  uint16_t row;
-  uint16_t currentRow;
-  uint16_t xOffset;
   uint32_t drawnElements = 0;
-                       
+
   /* Check arguments */
   if (pContext == NULL) return GLIB_ERROR_INVALID_ARGUMENT;
 
   /* Check input char */
-  if ((myChar < ' ') || (myChar > '~')) return GLIB_ERROR_INVALID_CHAR; 
+  if (GLIB_fontIndex(&pContext->font, myChar) < 0) return GLIB_ERROR_INVALID_CHAR;
 
-  /* Sets the index in the font array */
-  if (pContext->font.class == NumbersOnlyFont) {
-    fontIdx = (myChar - '0');
-    if (myChar == ':') {
-      fontIdx = 10;
-    }
-    if (myChar == ' ') {
-      fontIdx = 11;
-    }
-  } else { /* FullFont class */
-    fontIdx = myChar - ' ';
-  }  
-  
-  if (fontIdx > (pContext->font.cntOfMapElements - 1)) {
-    return GLIB_ERROR_INVALID_CHAR;
-  }  
-  
-  /* Loop through the rows and draw the font */
-  pPixMap8 = (uint8_t *)pContext->font.pFontPixMap;     
-  pPixMap16 = (uint16_t *)pContext->font.pFontPixMap;     
-  pPixMap32 = (uint32_t *)pContext->font.pFontPixMap;      
-    
-  for (row = 0; row < pContext->font.fontHeight; row++) {
-    
-    switch (pContext->font.sizeOfMapElement) {
-      case 1:
-        currentRow = pPixMap8[fontIdx];        
-        break;
-        
-      case 2:
-        currentRow = pPixMap16[fontIdx];    
-        break;
-        
-      default:
-        currentRow = pPixMap32[fontIdx];         
-    }  
-    
-    for (xOffset = 0; xOffset < pContext->font.fontWidth; ++xOffset) {
-      /* Bit 1 means draw, Bit 0 means do not draw */
-      if (currentRow & 0x1) {        
-        status = GLIB_drawPixel(pContext, x + xOffset, y + row);    
-        if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-        if (status == GLIB_OK) drawnElements++;
-      }
-      else if (opaque) {
-        /* Draw background pixel */
-        status = GLIB_drawPixelColor(pContext, x + xOffset, y + row, pContext->backgroundColor);    
-        if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-        if (status == GLIB_OK) drawnElements++;
-      }
-      currentRow >>= 1;
-    }
-    
-    /* Handle character spacing */
-    for (; xOffset < pContext->font.fontWidth + pContext->font.charSpacing; ++xOffset) {
-      if (opaque) {
-        /* Draw background pixel */
-        status = GLIB_drawPixelColor(pContext, x + xOffset, y + row, pContext->backgroundColor);    
-        if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-        if (status == GLIB_OK) drawnElements++;  
-      }
-    }
+  status = GLIB_drawTextLine(pContext, &myChar, 1, x, y, opaque, &drawnElements);
+  if (status != GLIB_OK) return status;
 
-    /* fontIdx offset for a new row */
-    fontIdx += pContext->font.fontRowOffset;
-  }
   return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
 }
 
@@ -140,6 +597,8 @@ EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x, int32_t
 *  @brief
 *  Draws a string using the font supplied with the library.
 *
+*  Each line of the string is rendered as one text box, see GLIB_drawChar.
+*
 *  @param pContext
 *  Pointer to a GLIB_Context_t
 *
@@ -162,43 +621,98 @@ EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x, int32_t
 
 EMSTATUS GLIB_drawString(GLIB_Context_t *pContext, char* pString, uint32_t sLength,
                          int32_t x0, int32_t y0, bool opaque)
-{  
+{
   EMSTATUS status;
   uint32_t drawnElements = 0;
   uint32_t stringIndex;
-  int32_t x, y;  
-  
+  uint32_t lineStart;
+  int32_t y;
+
   /* Check arguments */
   if (pContext == NULL || pString == NULL) {
     return GLIB_ERROR_INVALID_ARGUMENT;
   }
-  
+
   if (pContext->font.class == InvalidFont) {
     return GLIB_ERROR_INVALID_CHAR;
   }
- 
-  x = x0;
+
   y = y0;
+  lineStart = 0;
 
-  /* Loops through the string and prints char for char */
-  for (stringIndex = 0; stringIndex < sLength; stringIndex++)
+  /* Loops through the string and draws it line by line */
+  for (stringIndex = 0; stringIndex <= sLength; stringIndex++)
   {
+    if ((stringIndex < sLength) && (pString[stringIndex] != '\n')) {
+      if (GLIB_fontIndex(&pContext->font, pString[stringIndex]) >= 0) continue;
+
+      /* Draw the chars up to the invalid one */
+      GLIB_drawTextLine(pContext, &pString[lineStart], stringIndex - lineStart,
+                        x0, y, opaque, &drawnElements);
+      return GLIB_ERROR_INVALID_CHAR;
+    }
+
+    status = GLIB_drawTextLine(pContext, &pString[lineStart], stringIndex - lineStart,
+                               x0, y, opaque, &drawnElements);
+    if (status != GLIB_OK) return status;
+
     /* Newline char */
+    y = y + pContext->font.fontHeight + pContext->font.lineSpacing;
+    lineStart = stringIndex + 1;
+  }
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+}
+
+
+/**************************************************************************//**
+*  @brief
+*  Gets the width in pixels of a string drawn with the current font. The
+*  width of the widest line is returned if the string has several lines.
+*  Chars not in the font are not counted.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t
+*
+*  @param pString
+*  Pointer to the string
+*
+*  @param sLength
+*  Number of chars in the string
+*
+*  @return
+*  Returns the width in pixels, including the char spacing after each char
+******************************************************************************/
+
+uint32_t GLIB_stringWidth(GLIB_Context_t *pContext, const char *pString,
+                          uint32_t sLength)
+{
+  const GLIB_Font_t *pFont;
+  uint32_t stringIndex;
+  uint32_t width = 0;
+  uint32_t maxWidth = 0;
+  int32_t fontIdx;
+
+  if ((pContext == NULL) || (pString == NULL)) return 0;
+
+  pFont = &pContext->font;
+  for (stringIndex = 0; stringIndex < sLength; stringIndex++) {
     if (pString[stringIndex] == '\n') {
-      x = x0;
-      y = y + pContext->font.fontHeight + pContext->font.lineSpacing;
+      width = 0;
       continue;
     }
 
-    /* Draw the current char */
-    status = GLIB_drawChar(pContext, pString[stringIndex], x, y, opaque);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) return status;
-    if (status == GLIB_OK) drawnElements++;
+    fontIdx = GLIB_fontIndex(pFont, pString[stringIndex]);
+    if (fontIdx < 0) continue;
 
-    /* Adjust x and y coordinate */
-    x += (pContext->font.fontWidth + pContext->font.charSpacing);
+    if (pFont->class == PackedFont) {
+      width += ((const GLIB_PackedFont_t *)pFont->pFontPixMap)->pGlyphs[fontIdx].xAdvance;
+    } else {
+      width += pFont->fontWidth;
+    }
+    width += pFont->charSpacing;
+    if (width > maxWidth) maxWidth = width;
   }
-  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+  return maxWidth;
 }
 
 
@@ -0,0 +1,48 @@
+ /*************************************************************************//**
+ * @file displayconfig.h
+ * @brief Silicon Labs Graphics Library: display configuration of the host test
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+#ifndef __DISPLAYCONFIG_H
+#define __DISPLAYCONFIG_H
+
+#include "emstatus.h"
+
+/* The host test registers one display with the geometry of the
+ * LS013B7DH03 memory LCD of the EFM32ZG_STK3200, see glib_host_test.c. */
+
+/**
+ * Maximum number of display devices the display module is configured
+ * to support.
+ */
+#define DISPLAY_DEVICES_MAX   (1)
+
+/**
+ * Geometry of display device #0 in the system. These defines can be used
+ * at compile time to define the display dimensions.
+ */
+#define DISPLAY0_WIDTH    (128)
+#define DISPLAY0_HEIGHT   (128)
+
+/**
+ * Define all display device driver initialization functions here.
+ */
+#define DISPLAY_DEVICE_DRIVER_INIT_FUNCTIONS \
+  {                                          \
+    GLIBHOST_displayInit,                    \
+    NULL                                     \
+  }
+
+EMSTATUS GLIBHOST_displayInit(void);
+
+#endif /* __DISPLAYCONFIG_H */
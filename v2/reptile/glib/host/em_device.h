@@ -0,0 +1,29 @@
+ /*************************************************************************//**
+ * @file em_device.h
+ * @brief Silicon Labs Graphics Library: host replacement for em_device.h
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+/* GLIB only takes the compiler abstraction of the CMSIS headers from
+ * em_device.h. This file is found first when GLIB is compiled for the host
+ * test, see glib_host_test.c. */
+
+#ifndef __EM_DEVICE_HOST_H
+#define __EM_DEVICE_HOST_H
+
+#include <stdint.h>
+
+#ifndef __INLINE
+#define __INLINE inline
+#endif
+
+#endif /* __EM_DEVICE_HOST_H */
@@ -0,0 +1,332 @@
+ /*************************************************************************//**
+ * @file glib_host_test.c
+ * @brief Silicon Labs Graphics Library: host test of GLIB and the DMD driver
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/* Host test drawing with GLIB through the real dmd_display.c and display.c
+ * to a display device modelled in RAM. The device has the geometry of the
+ * LS013B7DH03 memory LCD, two control bytes per line included, and decodes
+ * the pixel matrix as the display shows it, so the test checks the pixels
+ * a user sees and not the calls GLIB makes. Each case draws random shapes,
+ * text or images and compares the display with a reference drawn pixel by
+ * pixel. The packed font cases also draw to an RGB565 canvas, and convert
+ * BDF fonts with ../tools/glibfontconv.c, which is built into the test.
+ * Build with a small glyph cache and run from the reptile/glib/host folder:
+ *
+ *   cc -O2 -DGLIB_GLYPH_CACHE_BYTES=2048 -DGLIB_GLYPH_CACHE_ENTRIES=8 \
+ *      -I. -I.. -I../glib -I../dmd -I../../../kits/common/drivers \
+ *      -o glib_host_test glib_host_test.c glib_host_test_cases.c \
+ *      ../glib/glib*.c ../glib/bmp.c ../dmd/display/dmd_display.c \
+ *      ../../../kits/common/drivers/display.c
+ *   glib_host_test [options]
+ *
+ * Options:
+ *   -n          The display uses DISPLAY_COLOUR_MODE_MONOCHROME, where a set
+ *               pixel matrix bit is black. By default it uses
+ *               DISPLAY_COLOUR_MODE_MONOCHROME_INVERSE as the LS013B7DH03.
+ *               Run the test both ways.
+ *   -k text     Runs only the cases whose name contains text
+ *   -l          Lists the cases
+ *
+ * The exit status is 0 when all cases pass and 1 when one fails. The
+ * random inputs are the same from run to run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "displaybackend.h"
+#include "glib_host_test.h"
+
+/* Line stride of the pixel matrix, two control bytes per line as the
+ * LS013B7DH03 driver */
+#define GLIBHOST_STRIDE         (GLIBHOST_WIDTH + 16)
+
+/* Seed of the random generator, reset for every case */
+#define GLIBHOST_SEED           0x12345678u
+
+uint8_t GLIBHOST_panel[GLIBHOST_HEIGHT][GLIBHOST_WIDTH];
+uint8_t GLIBHOST_ref[GLIBHOST_HEIGHT][GLIBHOST_WIDTH];
+GLIB_Context_t GLIBHOST_context;
+
+static uint8_t pixelMatrix[GLIBHOST_HEIGHT][GLIBHOST_STRIDE / 8];
+static DISPLAY_ColourMode_t colourMode = DISPLAY_COLOUR_MODE_MONOCHROME_INVERSE;
+static uint32_t seed = GLIBHOST_SEED;
+
+/**************************************************************************//**
+*  @brief
+*  Turns the host display on or off
+******************************************************************************/
+static EMSTATUS hostPowerOn(DISPLAY_Device_t *device, bool on)
+{
+  (void) device;
+  (void) on;
+  return DISPLAY_EMSTATUS_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Hands out the one pixel matrix of the host display
+******************************************************************************/
+static EMSTATUS hostPixelMatrixAllocate(DISPLAY_Device_t *device,
+                                        unsigned int width,
+                                        unsigned int height,
+                                        DISPLAY_PixelMatrix_t *pPixelMatrix)
+{
+  (void) device;
+
+  if ((width != GLIBHOST_WIDTH) || (height != GLIBHOST_HEIGHT)) {
+    return DISPLAY_EMSTATUS_OUT_OF_RANGE;
+  }
+  *pPixelMatrix = pixelMatrix;
+  return DISPLAY_EMSTATUS_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Frees a pixel matrix of the host display
+******************************************************************************/
+static EMSTATUS hostPixelMatrixFree(DISPLAY_Device_t *device,
+                                    DISPLAY_PixelMatrix_t pPixelMatrix)
+{
+  (void) device;
+  (void) pPixelMatrix;
+  return DISPLAY_EMSTATUS_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Shows rows of the pixel matrix in GLIBHOST_panel
+******************************************************************************/
+static EMSTATUS hostPixelMatrixDraw(DISPLAY_Device_t *device,
+                                    DISPLAY_PixelMatrix_t pPixelMatrix,
+                                    unsigned int startColumn,
+                                    unsigned int width,
+                                    unsigned int startRow,
+                                    unsigned int height)
+{
+  const uint8_t *pRow = (const uint8_t *) pPixelMatrix;
+  unsigned int row, col;
+  uint8_t bit;
+
+  if ((pRow != pixelMatrix[startRow]) || (startColumn != 0) ||
+      (width != GLIBHOST_WIDTH) || (startRow + height > GLIBHOST_HEIGHT)) {
+    return DISPLAY_EMSTATUS_INVALID_PARAMETER;
+  }
+
+  for (row = startRow; row < startRow + height; row++) {
+    for (col = 0; col < GLIBHOST_WIDTH; col++) {
+      bit = (pRow[col >> 3] >> (col & 0x7)) & 0x1;
+      GLIBHOST_panel[row][col] =
+        (device->colourMode == DISPLAY_COLOUR_MODE_MONOCHROME) ? bit : !bit;
+    }
+    pRow += GLIBHOST_STRIDE / 8;
+  }
+  return DISPLAY_EMSTATUS_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Clears a pixel matrix of the host display
+******************************************************************************/
+static EMSTATUS hostPixelMatrixClear(DISPLAY_Device_t *device,
+                                     DISPLAY_PixelMatrix_t pPixelMatrix,
+                                     unsigned int width,
+                                     unsigned int height)
+{
+  (void) device;
+  (void) width;
+
+  memset(pPixelMatrix, 0, height * (GLIBHOST_STRIDE / 8));
+  return DISPLAY_EMSTATUS_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Registers the host display, called by DISPLAY_Init
+******************************************************************************/
+EMSTATUS GLIBHOST_displayInit(void)
+{
+  DISPLAY_Device_t display;
+
+  memset(&display, 0, sizeof(display));
+  display.name                 = "host";
+  display.colourMode           = colourMode;
+  display.addressMode          = DISPLAY_ADDRESSING_BY_ROWS_ONLY;
+  display.geometry.width       = GLIBHOST_WIDTH;
+  display.geometry.height      = GLIBHOST_HEIGHT;
+  display.geometry.stride      = GLIBHOST_STRIDE;
+  display.pDisplayPowerOn      = hostPowerOn;
+  display.pPixelMatrixAllocate = hostPixelMatrixAllocate;
+  display.pPixelMatrixFree     = hostPixelMatrixFree;
+  display.pPixelMatrixDraw     = hostPixelMatrixDraw;
+  display.pPixelMatrixClear    = hostPixelMatrixClear;
+
+  return DISPLAY_DeviceRegister(&display);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns a pseudo random number, xorshift32
+******************************************************************************/
+uint32_t GLIBHOST_random(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns a pseudo random number from min to max, both included
+******************************************************************************/
+int32_t GLIBHOST_randomRange(int32_t min, int32_t max)
+{
+  return min + (int32_t) (GLIBHOST_random() % (uint32_t) (max - min + 1));
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets a random rectangle on the display, at least minSize pixels wide and
+*  high
+******************************************************************************/
+void GLIBHOST_randomRect(GLIB_Rectangle_t *pRect, int32_t minSize)
+{
+  pRect->xMin = GLIBHOST_randomRange(0, GLIBHOST_WIDTH - minSize);
+  pRect->yMin = GLIBHOST_randomRange(0, GLIBHOST_HEIGHT - minSize);
+  pRect->xMax = GLIBHOST_randomRange(pRect->xMin + minSize - 1, GLIBHOST_WIDTH - 1);
+  pRect->yMax = GLIBHOST_randomRange(pRect->yMin + minSize - 1, GLIBHOST_HEIGHT - 1);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Fills the display and the reference with black or white
+******************************************************************************/
+void GLIBHOST_fill(uint8_t black)
+{
+  uint8_t level = black ? 0x00 : 0xFF;
+
+  DMD_setClippingArea(0, 0, GLIBHOST_WIDTH, GLIBHOST_HEIGHT);
+  DMD_writeColor(0, 0, level, level, level, GLIBHOST_WIDTH * GLIBHOST_HEIGHT);
+  memset(GLIBHOST_ref, black, sizeof(GLIBHOST_ref));
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets a pixel of the reference if it is inside the clipping rectangle and
+*  the display
+******************************************************************************/
+void GLIBHOST_refPixel(const GLIB_Rectangle_t *pClip, int32_t x, int32_t y, uint8_t black)
+{
+  if ((x < 0) || (y < 0) || (x >= GLIBHOST_WIDTH) || (y >= GLIBHOST_HEIGHT)) return;
+  if ((pClip != NULL) && !GLIB_rectContainsPoint(pClip, x, y)) return;
+
+  GLIBHOST_ref[y][x] = black;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the clipping region of GLIBHOST_context
+*
+*  GLIB_setClippingRegion also sets the clipping area of the driver, which
+*  GLIB sets again for each drawing call. It is reset to the whole display
+*  here so that the next region is checked against the display.
+******************************************************************************/
+EMSTATUS GLIBHOST_setClippingRegion(const GLIB_Rectangle_t *pRect)
+{
+  GLIB_Rectangle_t rect = *pRect;
+  EMSTATUS status;
+
+  status = GLIB_setClippingRegion(&GLIBHOST_context, &rect);
+  GLIB_resetDisplayClippingArea(&GLIBHOST_context);
+  return status;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Updates the display and compares it with the reference
+*
+*  @param what
+*  Printed with the first wrong pixel
+*
+*  @return
+*  Returns the number of wrong pixels
+******************************************************************************/
+uint32_t GLIBHOST_check(const char *what)
+{
+  uint32_t errors = 0;
+  int32_t x, y;
+
+  if (DMD_updateDisplay() != DMD_OK) {
+    printf("  %s: DMD_updateDisplay failed\n", what);
+    return 1;
+  }
+
+  for (y = 0; y < GLIBHOST_HEIGHT; y++) {
+    for (x = 0; x < GLIBHOST_WIDTH; x++) {
+      if (GLIBHOST_panel[y][x] == GLIBHOST_ref[y][x]) continue;
+      if (errors == 0) {
+        printf("  %s: pixel (%d, %d) is %s\n", what, (int) x, (int) y,
+               GLIBHOST_panel[y][x] ? "black" : "white");
+      }
+      errors++;
+    }
+  }
+  return errors;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *pFilter = NULL;
+  uint32_t i, errors, failed = 0;
+  int arg;
+
+  for (arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "-n") == 0) {
+      colourMode = DISPLAY_COLOUR_MODE_MONOCHROME;
+    } else if ((strcmp(argv[arg], "-k") == 0) && (arg + 1 < argc)) {
+      pFilter = argv[++arg];
+    } else if (strcmp(argv[arg], "-l") == 0) {
+      for (i = 0; i < GLIBHOST_numCases; i++) printf("%s\n", GLIBHOST_cases[i].name);
+      return 0;
+    } else {
+      fprintf(stderr, "usage: glib_host_test [-n] [-k text] [-l]\n");
+      return 2;
+    }
+  }
+
+  if (DMD_init(NULL) != DMD_OK) {
+    fprintf(stderr, "DMD_init failed\n");
+    return 1;
+  }
+
+  printf("%s display\n", (colourMode == DISPLAY_COLOUR_MODE_MONOCHROME) ?
+         "DISPLAY_COLOUR_MODE_MONOCHROME" : "DISPLAY_COLOUR_MODE_MONOCHROME_INVERSE");
+
+  for (i = 0; i < GLIBHOST_numCases; i++) {
+    if ((pFilter != NULL) && (strstr(GLIBHOST_cases[i].name, pFilter) == NULL)) continue;
+
+    seed = GLIBHOST_SEED;
+    GLIB_contextInit(&GLIBHOST_context);
+    GLIBHOST_fill(0);
+
+    errors = GLIBHOST_cases[i].run();
+    printf("%-32s %8u %s\n", GLIBHOST_cases[i].name, (unsigned) errors,
+           errors ? "FAIL" : "ok");
+    if (errors) failed++;
+  }
+
+  printf("%u failed\n", (unsigned) failed);
+  return failed ? 1 : 0;
+}
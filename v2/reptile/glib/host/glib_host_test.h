@@ -0,0 +1,62 @@
+ /*************************************************************************//**
+ * @file glib_host_test.h
+ * @brief Silicon Labs Graphics Library: host test of GLIB and the DMD driver
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+
+#ifndef __GLIB_HOST_TEST_H
+#define __GLIB_HOST_TEST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "display.h"
+#include "glib.h"
+
+/** Width of the host display, as the LS013B7DH03 */
+#define GLIBHOST_WIDTH          DISPLAY0_WIDTH
+/** Height of the host display, as the LS013B7DH03 */
+#define GLIBHOST_HEIGHT         DISPLAY0_HEIGHT
+
+/** @struct __GLIBHOST_Case_t
+ *  @brief Test case of the host test
+ */
+typedef struct __GLIBHOST_Case_t
+{
+  /** Name of the case */
+  const char *name;
+  /** Runs the case and returns the number of wrong pixels or calls */
+  uint32_t (*run)(void);
+} GLIBHOST_Case_t;
+
+/** Pixels shown by the host display, 1 for black. Set from the pixel
+ *  matrix by DMD_updateDisplay, as the display device shows them. */
+extern uint8_t GLIBHOST_panel[GLIBHOST_HEIGHT][GLIBHOST_WIDTH];
+/** Pixels expected on the display, 1 for black, drawn by the cases */
+extern uint8_t GLIBHOST_ref[GLIBHOST_HEIGHT][GLIBHOST_WIDTH];
+/** Context drawing to the display, set to defaults before each case */
+extern GLIB_Context_t GLIBHOST_context;
+
+/** Test cases, in glib_host_test_cases.c */
+extern const GLIBHOST_Case_t GLIBHOST_cases[];
+/** Number of test cases */
+extern const uint32_t GLIBHOST_numCases;
+
+uint32_t GLIBHOST_random(void);
+int32_t GLIBHOST_randomRange(int32_t min, int32_t max);
+void GLIBHOST_randomRect(GLIB_Rectangle_t *pRect, int32_t minSize);
+void GLIBHOST_fill(uint8_t black);
+void GLIBHOST_refPixel(const GLIB_Rectangle_t *pClip, int32_t x, int32_t y, uint8_t black);
+EMSTATUS GLIBHOST_setClippingRegion(const GLIB_Rectangle_t *pRect);
+uint32_t GLIBHOST_check(const char *what);
+
+#endif /* __GLIB_HOST_TEST_H */
@@ -0,0 +1,1555 @@
+ /*************************************************************************//**
+ * @file glib_host_test_cases.c
+ * @brief Silicon Labs Graphics Library: test cases of the host test
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "glib_host_test.h"
+#include "bmp.h"
+
+/**************************************************************************//**
+*  @brief
+*  Writes DMD_PIXEL_FORMAT_MONO data of random length to random positions
+*  of random clipping areas, so that the rows start and end on and off byte
+*  boundaries of the pixel matrix and of the data
+******************************************************************************/
+static uint32_t dmdWriteDataMono(void)
+{
+  uint8_t data[64];
+  uint32_t i, n, numPixels, errors = 0;
+  int32_t x, y, width, height, pos;
+  GLIB_Rectangle_t clip;
+
+  for (i = 0; (i < 2000) && (errors == 0); i++) {
+    GLIBHOST_randomRect(&clip, 1);
+    width = clip.xMax - clip.xMin + 1;
+    height = clip.yMax - clip.yMin + 1;
+
+    /* Byte aligned starts and whole bytes are the interesting cases */
+    x = (GLIBHOST_random() & 1) ? 0 : GLIBHOST_randomRange(0, width - 1);
+    y = GLIBHOST_randomRange(0, height - 1);
+    numPixels = (GLIBHOST_random() & 1) ? 8 * GLIBHOST_randomRange(1, 8) :
+                GLIBHOST_randomRange(1, 8 * sizeof(data));
+    if (numPixels > (uint32_t) ((height - y) * width - x)) {
+      numPixels = (height - y) * width - x;
+    }
+    for (n = 0; n < sizeof(data); n++) data[n] = GLIBHOST_random();
+
+    DMD_setClippingArea(clip.xMin, clip.yMin, width, height);
+    if (DMD_writeData(x, y, data, numPixels) != DMD_OK) errors++;
+
+    for (n = 0; n < numPixels; n++) {
+      pos = y * width + x + n;
+      GLIBHOST_refPixel(NULL, clip.xMin + pos % width, clip.yMin + pos / width,
+                        (data[n >> 3] >> (n & 0x7)) & 0x1);
+    }
+    errors += GLIBHOST_check("DMD_writeData");
+  }
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a char of a fixed size font into the reference, as GLIB_drawChar
+*  drew it pixel by pixel
+******************************************************************************/
+static void refChar(const GLIB_Rectangle_t *pClip, const GLIB_Font_t *pFont,
+                    char c, int32_t x, int32_t y, uint8_t fg, uint8_t bg, bool opaque)
+{
+  uint32_t fontIdx, bits;
+  int32_t row, col;
+
+  if (pFont->class == NumbersOnlyFont) {
+    fontIdx = (c == ':') ? 10 : ((c == ' ') ? 11 : (uint32_t) (c - '0'));
+  } else {
+    fontIdx = c - ' ';
+  }
+
+  for (row = 0; row < pFont->fontHeight; row++) {
+    switch (pFont->sizeOfMapElement) {
+    case 1:
+      bits = ((const uint8_t *) pFont->pFontPixMap)[fontIdx];
+      break;
+    case 2:
+      bits = ((const uint16_t *) pFont->pFontPixMap)[fontIdx];
+      break;
+    default:
+      bits = ((const uint32_t *) pFont->pFontPixMap)[fontIdx];
+      break;
+    }
+    for (col = 0; col < pFont->fontWidth + pFont->charSpacing; col++) {
+      if ((col < pFont->fontWidth) && ((bits >> col) & 0x1)) {
+        GLIBHOST_refPixel(pClip, x + col, y + row, fg);
+      } else if (opaque) {
+        GLIBHOST_refPixel(pClip, x + col, y + row, bg);
+      }
+    }
+    fontIdx += pFont->fontRowOffset;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws random strings of the fixed size fonts at random positions, partly
+*  clipped, black on white and white on black, opaque and transparent
+******************************************************************************/
+static uint32_t glibDrawString(void)
+{
+  static const GLIB_Font_t *fonts[] = {
+    &GLIB_FontNormal8x8, &GLIB_FontNarrow6x8, &GLIB_FontNumber16x20
+  };
+  static const char numbers[] = "0123456789: ";
+  const GLIB_Font_t *pFont;
+  GLIB_Rectangle_t clip;
+  char text[24];
+  uint32_t i, n, length, errors = 0;
+  int32_t x, y;
+  uint8_t fg;
+  bool opaque;
+
+  for (i = 0; (i < 1500) && (errors == 0); i++) {
+    pFont = fonts[i % 3];
+    GLIB_setFont(&GLIBHOST_context, (GLIB_Font_t *) pFont);
+
+    if (GLIBHOST_random() & 1) {
+      GLIBHOST_randomRect(&clip, 2);
+    } else {
+      clip.xMin = clip.yMin = 0;
+      clip.xMax = GLIBHOST_WIDTH - 1;
+      clip.yMax = GLIBHOST_HEIGHT - 1;
+    }
+    GLIBHOST_setClippingRegion(&clip);
+
+    length = GLIBHOST_randomRange(1, sizeof(text) - 1);
+    for (n = 0; n < length; n++) {
+      text[n] = (pFont->class == NumbersOnlyFont) ?
+                numbers[GLIBHOST_random() % (sizeof(numbers) - 1)] :
+                (char) GLIBHOST_randomRange(' ', '~');
+    }
+    text[length] = '\0';
+
+    /* Strings start on and off byte boundaries of the pixel matrix */
+    x = (GLIBHOST_random() & 1) ? 8 * GLIBHOST_randomRange(-2, 15) :
+        GLIBHOST_randomRange(-20, GLIBHOST_WIDTH - 1);
+    y = GLIBHOST_randomRange(-20, GLIBHOST_HEIGHT - 1);
+    fg = GLIBHOST_random() & 1;
+    opaque = GLIBHOST_random() & 1;
+    GLIBHOST_context.foregroundColor = fg ? Black : White;
+    GLIBHOST_context.backgroundColor = fg ? White : Black;
+
+    GLIB_drawString(&GLIBHOST_context, text, length, x, y, opaque);
+
+    for (n = 0; n < length; n++) {
+      refChar(&clip, pFont, text[n], x + n * (pFont->fontWidth + pFont->charSpacing), y,
+              fg, !fg, opaque);
+    }
+    errors += GLIBHOST_check("GLIB_drawString");
+  }
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets a random clipping region of at least 2 by 2 pixels, as taken by
+*  GLIB_setClippingRegion, half of the time the whole display
+******************************************************************************/
+static void randomClip(GLIB_Rectangle_t *pClip)
+{
+  if (GLIBHOST_random() & 1) {
+    GLIBHOST_randomRect(pClip, 2);
+  } else {
+    pClip->xMin = pClip->yMin = 0;
+    pClip->xMax = GLIBHOST_WIDTH - 1;
+    pClip->yMax = GLIBHOST_HEIGHT - 1;
+  }
+  GLIBHOST_setClippingRegion(pClip);
+}
+
+/** Spans of a shape as passed to spanCollect */
+typedef struct __SpanCollect_t
+{
+  const GLIB_Rectangle_t *pClip;
+  int32_t y;
+  int32_t x;
+  uint32_t errors;
+  uint8_t map[GLIBHOST_HEIGHT][GLIBHOST_WIDTH];
+} SpanCollect_t;
+
+static SpanCollect_t spanCollect;
+
+/**************************************************************************//**
+*  @brief
+*  Span function of the GLIB_raster functions, checks that the spans are
+*  inside the clipping rectangle, top to bottom and left to right and do not
+*  overlap, and marks their pixels
+******************************************************************************/
+static EMSTATUS spanCollectFunc(void *pUser, int32_t y, int32_t xMin, int32_t xMax)
+{
+  SpanCollect_t *pSpans = (SpanCollect_t *) pUser;
+
+  if ((xMin > xMax) || (xMin < pSpans->pClip->xMin) || (xMax > pSpans->pClip->xMax) ||
+      (y < pSpans->pClip->yMin) || (y > pSpans->pClip->yMax) ||
+      (y < pSpans->y) || ((y == pSpans->y) && (xMin <= pSpans->x))) {
+    if (pSpans->errors++ == 0) {
+      printf("  span y %d x %d..%d after y %d x %d\n", (int) y, (int) xMin, (int) xMax,
+             (int) pSpans->y, (int) pSpans->x);
+    }
+    return GLIB_OK;
+  }
+
+  pSpans->y = y;
+  pSpans->x = xMax;
+  for (; xMin <= xMax; xMin++) pSpans->map[y][xMin] = 1;
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Prepares spanCollect for the spans of one shape
+******************************************************************************/
+static void spanCollectInit(const GLIB_Rectangle_t *pClip)
+{
+  spanCollect.pClip = pClip;
+  spanCollect.y = INT32_MIN;
+  spanCollect.x = INT32_MIN;
+  spanCollect.errors = 0;
+  memset(spanCollect.map, 0, sizeof(spanCollect.map));
+}
+
+/**************************************************************************//**
+*  @brief
+*  Compares the spans in spanCollect with the shape in the reference,
+*  drawn black on white within pClip
+******************************************************************************/
+static uint32_t spanCollectCheck(const char *what)
+{
+  uint32_t errors = spanCollect.errors;
+  int32_t x, y;
+
+  for (y = 0; y < GLIBHOST_HEIGHT; y++) {
+    for (x = 0; x < GLIBHOST_WIDTH; x++) {
+      if (spanCollect.map[y][x] == GLIBHOST_ref[y][x]) continue;
+      if (errors++ == 0) {
+        printf("  %s: span pixel %d,%d is %u, expected %u\n", what, (int) x, (int) y,
+               spanCollect.map[y][x], GLIBHOST_ref[y][x]);
+      }
+    }
+  }
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reference polygon fill: a pixel is inside when a ray from it to the right
+*  crosses an odd number of edges. An edge includes its upper end point and
+*  excludes the lower one, and a crossing exactly at the pixel does not count.
+******************************************************************************/
+static bool refPolygonContains(uint32_t numPoints, const int32_t *polyPoints,
+                               int32_t x, int32_t y)
+{
+  uint32_t i, j;
+  int64_t num, den;
+  bool inside = false;
+
+  for (i = 0, j = numPoints - 1; i < numPoints; j = i++) {
+    int32_t x0 = polyPoints[2 * j], y0 = polyPoints[2 * j + 1];
+    int32_t x1 = polyPoints[2 * i], y1 = polyPoints[2 * i + 1];
+
+    if ((y0 > y) == (y1 > y)) continue;
+
+    /* x < x0 + (y - y0) * (x1 - x0) / (y1 - y0) */
+    num = (int64_t) (y - y0) * (x1 - x0);
+    den = y1 - y0;
+    if (den < 0) {
+      num = -num;
+      den = -den;
+    }
+    if ((int64_t) (x - x0) * den < num) inside = !inside;
+  }
+  return inside;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reference circle fill: dx * dx + dy * dy <= radius * (radius + 1)
+******************************************************************************/
+static bool refCircleContains(int32_t xCenter, int32_t yCenter, uint32_t radius,
+                              int32_t x, int32_t y)
+{
+  int64_t dx = x - xCenter, dy = y - yCenter;
+
+  return dx * dx + dy * dy <= (int64_t) radius * (radius + 1);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reference rounded rectangle fill: the rectangle without the pixels of the
+*  corner squares outside the quarter circles
+******************************************************************************/
+static bool refRoundRectContains(const GLIB_Rectangle_t *pRect, uint32_t radius,
+                                 int32_t x, int32_t y)
+{
+  int32_t r = radius, xCenter = x, yCenter = y;
+
+  if ((x < pRect->xMin) || (x > pRect->xMax) || (y < pRect->yMin) || (y > pRect->yMax)) {
+    return false;
+  }
+
+  if (r > (pRect->xMax - pRect->xMin) / 2) r = (pRect->xMax - pRect->xMin) / 2;
+  if (r > (pRect->yMax - pRect->yMin) / 2) r = (pRect->yMax - pRect->yMin) / 2;
+  if (x < pRect->xMin + r) xCenter = pRect->xMin + r;
+  if (x > pRect->xMax - r) xCenter = pRect->xMax - r;
+  if (y < pRect->yMin + r) yCenter = pRect->yMin + r;
+  if (y > pRect->yMax - r) yCenter = pRect->yMax - r;
+  return refCircleContains(xCenter, yCenter, r, x, y);
+}
+
+/** Pixels outside the display also checked against the hit test functions */
+#define SHAPE_MARGIN    24
+
+/**************************************************************************//**
+*  @brief
+*  Draws random polygons, convex or not and with vertices on a coarse grid
+*  or anywhere, partly outside the display and the clipping region. The
+*  pixels drawn by GLIB_drawPolygonFilled, the spans of GLIB_rasterPolygon
+*  and GLIB_polygonContainsPoint are compared with refPolygonContains.
+******************************************************************************/
+static uint32_t glibPolygonFilled(void)
+{
+  int32_t points[2 * 8];
+  GLIB_Rectangle_t clip;
+  EMSTATUS status;
+  uint32_t i, n, numPoints, errors = 0;
+  int32_t x, y;
+  uint8_t black;
+  bool grid;
+
+  for (i = 0; (i < 1500) && (errors == 0); i++) {
+    randomClip(&clip);
+
+    /* Vertices on a grid give horizontal edges and vertices on the rows of
+     * other vertices */
+    numPoints = GLIBHOST_randomRange(3, 8);
+    grid = GLIBHOST_random() & 1;
+    for (n = 0; n < 2 * numPoints; n++) {
+      points[n] = grid ? 16 * GLIBHOST_randomRange(-1, GLIBHOST_WIDTH / 16 + 1) :
+                  GLIBHOST_randomRange(-SHAPE_MARGIN, GLIBHOST_WIDTH + SHAPE_MARGIN);
+    }
+
+    /* Black shapes on white and white on black */
+    black = GLIBHOST_random() & 1;
+    GLIBHOST_fill(!black);
+    GLIBHOST_context.foregroundColor = black ? Black : White;
+
+    status = GLIB_drawPolygonFilled(&GLIBHOST_context, numPoints, points);
+    if ((status != GLIB_OK) && (status != GLIB_ERROR_NOTHING_TO_DRAW)) errors++;
+
+    for (y = -SHAPE_MARGIN; y < GLIBHOST_HEIGHT + SHAPE_MARGIN; y++) {
+      for (x = -SHAPE_MARGIN; x < GLIBHOST_WIDTH + SHAPE_MARGIN; x++) {
+        if (GLIB_polygonContainsPoint(numPoints, points, x, y) !=
+            refPolygonContains(numPoints, points, x, y)) {
+          if (errors++ == 0) printf("  GLIB_polygonContainsPoint %d,%d\n", (int) x, (int) y);
+        }
+        if (refPolygonContains(numPoints, points, x, y)) {
+          GLIBHOST_refPixel(&clip, x, y, black);
+        }
+      }
+    }
+    errors += GLIBHOST_check("GLIB_drawPolygonFilled");
+
+    /* The spans are the shape drawn black on white */
+    for (y = 0; y < GLIBHOST_HEIGHT; y++) {
+      for (x = 0; x < GLIBHOST_WIDTH; x++) {
+        GLIBHOST_ref[y][x] = GLIB_rectContainsPoint(&clip, x, y) &&
+                             refPolygonContains(numPoints, points, x, y);
+      }
+    }
+    spanCollectInit(&clip);
+    GLIB_rasterPolygon(&clip, numPoints, points, spanCollectFunc, &spanCollect);
+    errors += spanCollectCheck("GLIB_rasterPolygon");
+  }
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws random circles, partly outside the display and the clipping region,
+*  and compares them with refCircleContains like glibPolygonFilled
+******************************************************************************/
+static uint32_t glibCircleFilled(void)
+{
+  GLIB_Rectangle_t clip;
+  EMSTATUS status;
+  uint32_t i, radius, errors = 0;
+  int32_t x, y, xCenter, yCenter;
+  uint8_t black;
+
+  for (i = 0; (i < 1000) && (errors == 0); i++) {
+    randomClip(&clip);
+
+    xCenter = GLIBHOST_randomRange(-SHAPE_MARGIN, GLIBHOST_WIDTH + SHAPE_MARGIN);
+    yCenter = GLIBHOST_randomRange(-SHAPE_MARGIN, GLIBHOST_HEIGHT + SHAPE_MARGIN);
+    radius = (GLIBHOST_random() & 1) ? GLIBHOST_randomRange(0, 8) :
+             GLIBHOST_randomRange(0, GLIBHOST_WIDTH / 2);
+
+    black = GLIBHOST_random() & 1;
+    GLIBHOST_fill(!black);
+    GLIBHOST_context.foregroundColor = black ? Black : White;
+
+    status = GLIB_drawCircleFilled(&GLIBHOST_context, xCenter, yCenter, radius);
+    if ((status != GLIB_OK) && (status != GLIB_ERROR_NOTHING_TO_DRAW)) errors++;
+
+    for (y = -SHAPE_MARGIN; y < GLIBHOST_HEIGHT + SHAPE_MARGIN; y++) {
+      for (x = -SHAPE_MARGIN; x < GLIBHOST_WIDTH + SHAPE_MARGIN; x++) {
+        if (GLIB_circleContainsPoint(xCenter, yCenter, radius, x, y) !=
+            refCircleContains(xCenter, yCenter, radius, x, y)) {
+          if (errors++ == 0) printf("  GLIB_circleContainsPoint %d,%d\n", (int) x, (int) y);
+        }
+        if (refCircleContains(xCenter, yCenter, radius, x, y)) {
+          GLIBHOST_refPixel(&clip, x, y, black);
+        }
+      }
+    }
+    errors += GLIBHOST_check("GLIB_drawCircleFilled");
+
+    for (y = 0; y < GLIBHOST_HEIGHT; y++) {
+      for (x = 0; x < GLIBHOST_WIDTH; x++) {
+        GLIBHOST_ref[y][x] = GLIB_rectContainsPoint(&clip, x, y) &&
+                             refCircleContains(xCenter, yCenter, radius, x, y);
+      }
+    }
+    spanCollectInit(&clip);
+    GLIB_rasterCircle(&clip, xCenter, yCenter, radius, spanCollectFunc, &spanCollect);
+    errors += spanCollectCheck("GLIB_rasterCircle");
+  }
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws random rounded rectangles, from thin ones to ones with a radius
+*  larger than half their size, partly outside the display and the clipping
+*  region, and compares them with refRoundRectContains like glibPolygonFilled
+******************************************************************************/
+static uint32_t glibRoundRectFilled(void)
+{
+  GLIB_Rectangle_t clip, rect;
+  EMSTATUS status;
+  uint32_t i, radius, errors = 0;
+  int32_t x, y;
+  uint8_t black;
+
+  for (i = 0; (i < 1000) && (errors == 0); i++) {
+    randomClip(&clip);
+
+    rect.xMin = GLIBHOST_randomRange(-SHAPE_MARGIN, GLIBHOST_WIDTH + SHAPE_MARGIN);
+    rect.yMin = GLIBHOST_randomRange(-SHAPE_MARGIN, GLIBHOST_HEIGHT + SHAPE_MARGIN);
+    rect.xMax = rect.xMin + GLIBHOST_randomRange(0, GLIBHOST_WIDTH);
+    rect.yMax = rect.yMin + GLIBHOST_randomRange(0, GLIBHOST_HEIGHT);
+    radius = GLIBHOST_randomRange(0, GLIBHOST_WIDTH / 2);
+
+    black = GLIBHOST_random() & 1;
+    GLIBHOST_fill(!black);
+    GLIBHOST_context.foregroundColor = black ? Black : White;
+
+    status = GLIB_drawRoundRectFilled(&GLIBHOST_context, &rect, radius);
+    if ((status != GLIB_OK) && (status != GLIB_ERROR_NOTHING_TO_DRAW)) errors++;
+
+    for (y = -SHAPE_MARGIN; y < GLIBHOST_HEIGHT + SHAPE_MARGIN; y++) {
+      for (x = -SHAPE_MARGIN; x < GLIBHOST_WIDTH + SHAPE_MARGIN; x++) {
+        if (GLIB_roundRectContainsPoint(&rect, radius, x, y) !=
+            refRoundRectContains(&rect, radius, x, y)) {
+          if (errors++ == 0) printf("  GLIB_roundRectContainsPoint %d,%d\n", (int) x, (int) y);
+        }
+        if (refRoundRectContains(&rect, radius, x, y)) {
+          GLIBHOST_refPixel(&clip, x, y, black);
+        }
+      }
+    }
+    errors += GLIBHOST_check("GLIB_drawRoundRectFilled");
+
+    for (y = 0; y < GLIBHOST_HEIGHT; y++) {
+      for (x = 0; x < GLIBHOST_WIDTH; x++) {
+        GLIBHOST_ref[y][x] = GLIB_rectContainsPoint(&clip, x, y) &&
+                             refRoundRectContains(&rect, radius, x, y);
+      }
+    }
+    spanCollectInit(&clip);
+    GLIB_rasterRoundRect(&clip, &rect, radius, spanCollectFunc, &spanCollect);
+    errors += spanCollectCheck("GLIB_rasterRoundRect");
+  }
+  return errors;
+}
+
+/** Largest BMP file built by glibBmpMono, 120 x 100 pixels of 24 bits */
+#define BMP_FILE_SIZE   (BMP_HEADER_SIZE + BMP_PALETTE_8BIT_SIZE + 120 * 100 * 3)
+
+static uint8_t bmpFile[BMP_FILE_SIZE];
+static uint32_t bmpFileLength;
+static uint32_t bmpFileIdx;
+
+/**************************************************************************//**
+*  @brief
+*  Read function of the BMP module, reads from bmpFile
+******************************************************************************/
+static EMSTATUS bmpRead(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToRead)
+{
+  if ((bytesToRead > bufLength) || (bmpFileIdx + bytesToRead > bmpFileLength)) {
+    return BMP_ERROR_IO;
+  }
+  memcpy(buffer, &bmpFile[bmpFileIdx], bytesToRead);
+  bmpFileIdx += bytesToRead;
+  return BMP_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Stores a little endian value of 2 or 4 bytes in bmpFile
+******************************************************************************/
+static void bmpPut(uint32_t offset, uint32_t value, uint32_t size)
+{
+  for (; size > 0; size--, offset++, value >>= 8) bmpFile[offset] = value & 0xFF;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Appends one row of palette indices to bmpFile as RLE8 data, with encoded
+*  runs for repeated indices and unencoded runs for the others
+******************************************************************************/
+static void bmpPutRleRow(const uint8_t *row, uint32_t width, bool last)
+{
+  uint32_t i = 0, n, count;
+
+  while (i < width) {
+    for (count = 1; (i + count < width) && (count < 255) && (row[i + count] == row[i]); count++) ;
+
+    if (count == 1) {
+      /* Unencoded runs end where an encoded run starts */
+      for (count = 1; (i + count < width) && (count < 255) &&
+           ((i + count + 1 >= width) || (row[i + count] != row[i + count + 1])); count++) ;
+
+      if (count >= 3) {
+        bmpFile[bmpFileLength++] = 0;
+        bmpFile[bmpFileLength++] = count;
+        for (n = 0; n < count; n++) bmpFile[bmpFileLength++] = row[i++];
+        if (count & 1) bmpFile[bmpFileLength++] = 0;
+        continue;
+      }
+      count = 1;
+    }
+
+    bmpFile[bmpFileLength++] = count;
+    bmpFile[bmpFileLength++] = row[i];
+    i += count;
+  }
+
+  /* End of line, or end of bitmap */
+  bmpFile[bmpFileLength++] = 0;
+  bmpFile[bmpFileLength++] = last ? 1 : 0;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws random BMP files, 24 bit, 8 bit and 8 bit RLE, scaled down or not,
+*  with BMP_drawToDisplay at random positions on and off byte boundaries of
+*  the pixel matrix. The driver takes DMD_PIXEL_FORMAT_MONO data, a pixel is
+*  black when its green component, or the average green component of the
+*  scaled down block, is below BMP_MONO_THRESHOLD.
+******************************************************************************/
+static uint32_t glibBmpMono(void)
+{
+  static uint8_t green[100][120];
+  static uint8_t index[100][120];
+  static uint8_t palette[BMP_PALETTE_8BIT_SIZE];
+  static uint32_t rowCache[BMP_FILE_SIZE / 4];
+  uint8_t buffer[GLIBHOST_WIDTH / 8];
+  EMSTATUS status;
+  uint32_t i, n, bpp, rle, scale, width, height, colors, stride, sum, errors = 0;
+  int32_t x, y, row, col, outWidth, outHeight, cacheSize;
+  uint8_t black;
+
+  for (i = 0; (i < 400) && (errors == 0); i++) {
+    bpp = (GLIBHOST_random() & 1) ? 24 : 8;
+    rle = (bpp == 8) && (GLIBHOST_random() & 1);
+    scale = (GLIBHOST_random() & 1) ? 1 : GLIBHOST_randomRange(2, BMP_MAX_SCALE);
+    width = GLIBHOST_randomRange(scale, 120);
+    height = GLIBHOST_randomRange(scale, 100);
+    colors = GLIBHOST_randomRange(2, 256);
+
+    /* Pixels in runs, rows bottom-up as in the file */
+    for (row = 0; row < (int32_t) height; row++) {
+      for (col = 0; col < (int32_t) width; col++) {
+        index[row][col] = ((col > 0) && (GLIBHOST_random() & 1)) ? index[row][col - 1] :
+                          GLIBHOST_random() % colors;
+      }
+    }
+
+    memset(bmpFile, 0, BMP_HEADER_SIZE);
+    bmpPut(0, 0x4D42, 2);
+    bmpPut(14, 40, 4);
+    bmpPut(18, width, 4);
+    bmpPut(22, height, 4);
+    bmpPut(26, 1, 2);
+    bmpPut(28, bpp, 2);
+    bmpPut(30, rle ? RLE8_COMPRESSION : NO_COMPRESSION, 4);
+    bmpFileLength = BMP_HEADER_SIZE;
+
+    if (bpp == 8) {
+      for (n = 0; n < 4 * colors; n++) bmpFile[bmpFileLength++] = GLIBHOST_random();
+    }
+    bmpPut(10, bmpFileLength, 4);
+
+    stride = (bpp == 24) ? ((3 * width + 3) & ~3UL) : ((width + 3) & ~3UL);
+    for (row = 0; row < (int32_t) height; row++) {
+      if (rle) {
+        bmpPutRleRow(index[row], width, row == (int32_t) height - 1);
+      } else {
+        memset(&bmpFile[bmpFileLength], 0, stride);
+        for (col = 0; col < (int32_t) width; col++) {
+          if (bpp == 24) {
+            /* Blue and red differ from green, the mono output only uses green */
+            bmpFile[bmpFileLength + 3 * col] = GLIBHOST_random();
+            bmpFile[bmpFileLength + 3 * col + 1] = index[row][col];
+            bmpFile[bmpFileLength + 3 * col + 2] = GLIBHOST_random();
+          } else {
+            bmpFile[bmpFileLength + col] = index[row][col];
+          }
+        }
+        bmpFileLength += stride;
+      }
+
+      for (col = 0; col < (int32_t) width; col++) {
+        green[row][col] = (bpp == 24) ? index[row][col] :
+                          bmpFile[BMP_HEADER_SIZE + 4 * index[row][col] + 1];
+      }
+    }
+    bmpPut(34, bmpFileLength - (BMP_HEADER_SIZE + ((bpp == 8) ? 4 * colors : 0)), 4);
+    bmpPut(2, bmpFileLength, 4);
+
+    outWidth = width / scale;
+    outHeight = height / scale;
+    x = (GLIBHOST_random() & 1) ? 8 * GLIBHOST_randomRange(0, (GLIBHOST_WIDTH - outWidth) / 8) :
+        GLIBHOST_randomRange(0, GLIBHOST_WIDTH - outWidth);
+    y = GLIBHOST_randomRange(0, GLIBHOST_HEIGHT - outHeight);
+
+    black = GLIBHOST_random() & 1;
+    GLIBHOST_fill(black);
+
+    /* The smallest row cache, or one holding many rows */
+    bmpFileIdx = 0;
+    status = BMP_init(palette, sizeof(palette), bmpRead);
+    if (status == BMP_OK) status = BMP_reset();
+    if (status == BMP_OK) {
+      cacheSize = BMP_getRowCacheSize(scale);
+      if (GLIBHOST_random() & 1) cacheSize = sizeof(rowCache);
+      status = BMP_setRowCache((uint8_t *) rowCache, cacheSize, scale);
+    }
+    if (status == BMP_OK) status = BMP_drawToDisplay(x, y, buffer, sizeof(buffer));
+    if (status != BMP_OK) {
+      printf("  BMP %ux%u %u bpp%s scale %u: error 0x%x\n", (unsigned) width, (unsigned) height,
+             (unsigned) bpp, rle ? " RLE" : "", (unsigned) scale, (unsigned) status);
+      errors++;
+      break;
+    }
+
+    for (row = 0; row < outHeight; row++) {
+      for (col = 0; col < outWidth; col++) {
+        sum = 0;
+        for (n = 0; n < scale * scale; n++) sum += green[row * scale + n / scale][col * scale + n % scale];
+        GLIBHOST_refPixel(NULL, x + col, y + outHeight - 1 - row,
+                          sum < BMP_MONO_THRESHOLD * scale * scale);
+      }
+    }
+    errors += GLIBHOST_check("BMP_drawToDisplay");
+  }
+  return errors;
+}
+
+#if GLIB_GLYPH_CACHE_BYTES == 0
+#error "Build the host test with a glyph cache, see glib_host_test.c"
+#endif
+
+/** Glyphs of the packed fonts built by packedFontBuild */
+#define PACKED_CHARS            24
+/** Largest glyph bitmap of packedFontBuild */
+#define PACKED_MAX_SIZE         20
+/** Most chars of a packed font under test */
+#define CELL_MAX_CHARS          64
+/** Largest glyph cell of a packed font under test */
+#define CELL_MAX_WIDTH          48
+#define CELL_MAX_HEIGHT         24
+
+/** Packed font built by packedFontBuild, and the alpha values it encodes */
+typedef struct __PackedTestFont_t
+{
+  GLIB_Glyph_t glyphs[PACKED_CHARS];
+  uint8_t data[PACKED_CHARS * PACKED_MAX_SIZE * PACKED_MAX_SIZE];
+  uint8_t alpha[PACKED_CHARS][PACKED_MAX_SIZE * PACKED_MAX_SIZE];
+  GLIB_PackedFont_t packed;
+  GLIB_Font_t font;
+} PackedTestFont_t;
+
+/** Glyph cells of the packed font under test, as GLIB should draw them */
+typedef struct __PackedCells_t
+{
+  uint8_t firstChar;
+  uint8_t numChars;
+  uint8_t bpp;
+  uint8_t height;
+  uint8_t width[CELL_MAX_CHARS];
+  uint8_t alpha[CELL_MAX_CHARS][CELL_MAX_HEIGHT][CELL_MAX_WIDTH];
+} PackedCells_t;
+
+static PackedTestFont_t packedFont;
+static PackedCells_t cells;
+
+/**************************************************************************//**
+*  @brief
+*  Encodes n alpha values bit packed or run length encoded. Runs are also
+*  cut at random lengths, so that runs of equal alpha values follow each
+*  other.
+*
+*  @return
+*  Returns the size of the encoded data
+******************************************************************************/
+static uint32_t packedEncode(const uint8_t *pAlpha, uint32_t n, uint32_t bpp,
+                             uint8_t encoding, uint8_t *pOut)
+{
+  uint32_t i, run, size = 0, maxRun = 1 << (8 - bpp);
+
+  if (encoding == GLIB_GLYPH_ENCODING_PACKED) {
+    memset(pOut, 0, (n * bpp + 7) / 8);
+    for (i = 0; i < n; i++) pOut[(i * bpp) >> 3] |= pAlpha[i] << ((i * bpp) & 0x7);
+    return (n * bpp + 7) / 8;
+  }
+
+  for (i = 0; i < n; i += run) {
+    for (run = 1; (i + run < n) && (run < maxRun) && (pAlpha[i + run] == pAlpha[i]); run++) ;
+    if ((run > 1) && ((GLIBHOST_random() & 3) == 0)) run = GLIBHOST_randomRange(1, run);
+    pOut[size++] = (pAlpha[i] << (8 - bpp)) | (run - 1);
+  }
+  return size;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the alpha value of a glyph bitmap pixel, 0 outside the bitmap
+*
+*  @param col
+*  Column relative to the pen position
+*  @param row
+*  Row relative to the top of the text line
+******************************************************************************/
+static uint32_t packedAlpha(const GLIB_Glyph_t *pGlyph, const uint8_t *pAlpha,
+                            int32_t col, int32_t row)
+{
+  col -= pGlyph->xOffset;
+  row -= pGlyph->yOffset;
+  if ((col < 0) || (row < 0) || (col >= pGlyph->width) || (row >= pGlyph->height)) return 0;
+  return pAlpha[row * pGlyph->width + col];
+}
+
+/**************************************************************************//**
+*  @brief
+*  Builds packedFont with random glyphs of 'A' and up, bit packed or run
+*  length encoded, some of them overhanging their cell, and sets up cells
+******************************************************************************/
+static void packedFontBuild(uint32_t bpp, uint32_t height, uint32_t charSpacing)
+{
+  GLIB_Glyph_t *pGlyph;
+  uint8_t *pAlpha;
+  uint32_t i, n, offset = 0, maxAdvance = 0, max = (1 << bpp) - 1;
+  int32_t advance, row, col;
+
+  for (i = 0; i < PACKED_CHARS; i++) {
+    pGlyph = &packedFont.glyphs[i];
+    pAlpha = packedFont.alpha[i];
+
+    pGlyph->width = (i == 0) ? 0 : GLIBHOST_randomRange(1, PACKED_MAX_SIZE);
+    pGlyph->height = (i == 0) ? 0 : GLIBHOST_randomRange(1, height);
+    pGlyph->xOffset = GLIBHOST_randomRange(-2, 3);
+    pGlyph->yOffset = GLIBHOST_randomRange(-2, height - pGlyph->height + 2);
+    advance = pGlyph->xOffset + pGlyph->width + GLIBHOST_randomRange(-2, 2);
+    pGlyph->xAdvance = (advance < 1) ? 1 : advance;
+    pGlyph->encoding = GLIBHOST_random() & 1;
+    if (pGlyph->xAdvance > maxAdvance) maxAdvance = pGlyph->xAdvance;
+
+    /* Runs of blank and solid pixels with anti-aliased pixels between */
+    n = pGlyph->width * pGlyph->height;
+    for (col = 0; col < (int32_t) n; col++) {
+      if ((col > 0) && (GLIBHOST_random() & 1)) {
+        pAlpha[col] = pAlpha[col - 1];
+      } else if (GLIBHOST_random() & 1) {
+        pAlpha[col] = GLIBHOST_random() % (max + 1);
+      } else {
+        pAlpha[col] = (GLIBHOST_random() & 1) ? max : 0;
+      }
+    }
+
+    pGlyph->offset = offset;
+    offset += packedEncode(pAlpha, n, bpp, pGlyph->encoding, &packedFont.data[offset]);
+
+    cells.width[i] = pGlyph->xAdvance + charSpacing;
+    for (row = 0; row < (int32_t) height; row++) {
+      for (col = 0; col < cells.width[i]; col++) {
+        cells.alpha[i][row][col] = packedAlpha(pGlyph, pAlpha, col, row);
+      }
+    }
+  }
+
+  packedFont.packed.pGlyphs = packedFont.glyphs;
+  packedFont.packed.pData = packedFont.data;
+  packedFont.packed.firstChar = 'A';
+  packedFont.packed.numChars = PACKED_CHARS;
+  packedFont.packed.bpp = bpp;
+
+  memset(&packedFont.font, 0, sizeof(packedFont.font));
+  packedFont.font.pFontPixMap = &packedFont.packed;
+  packedFont.font.cntOfMapElements = PACKED_CHARS;
+  packedFont.font.fontWidth = maxAdvance;
+  packedFont.font.fontHeight = height;
+  packedFont.font.charSpacing = charSpacing;
+  packedFont.font.class = PackedFont;
+
+  /* The glyphs change in place, cached ones are stale */
+  GLIB_glyphCacheClear();
+
+  cells.firstChar = 'A';
+  cells.numChars = PACKED_CHARS;
+  cells.bpp = bpp;
+  cells.height = height;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets a random string of length chars of the font under test
+******************************************************************************/
+static void packedRandomText(char *text, uint32_t length)
+{
+  uint32_t n;
+
+  for (n = 0; n < length; n++) {
+    text[n] = (char) (cells.firstChar + GLIBHOST_random() % cells.numChars);
+  }
+  text[length] = '\0';
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a string of the font under test into the reference. Alpha values
+*  above half are drawn in the foreground color, the others in the
+*  background color, and transparent text skips pixels of alpha 0.
+******************************************************************************/
+static void refPackedString(const GLIB_Rectangle_t *pClip, const char *text,
+                            uint32_t length, int32_t x, int32_t y, uint8_t fg,
+                            bool opaque)
+{
+  uint32_t i, idx, alpha, max = (1 << cells.bpp) - 1;
+  int32_t row, col;
+
+  for (i = 0; i < length; i++) {
+    idx = (uint8_t) text[i] - cells.firstChar;
+    for (row = 0; row < cells.height; row++) {
+      for (col = 0; col < cells.width[idx]; col++) {
+        alpha = cells.alpha[idx][row][col];
+        if ((alpha == 0) && !opaque) continue;
+        GLIBHOST_refPixel(pClip, x + col, y + row, (2 * alpha > max) ? fg : !fg);
+      }
+    }
+    x += cells.width[idx];
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Decodes parts of random rows of random glyphs, bit packed and run length
+*  encoded with 1, 2 and 4 bpp, with GLIB_glyphDecodeRow and compares them
+*  with the alpha values encoded. Rows are skipped and parts of rows start
+*  left of and end right of the glyph bitmap.
+******************************************************************************/
+static uint32_t glibGlyphDecode(void)
+{
+  static const uint8_t bppValues[] = { 1, 2, 4 };
+  GLIB_GlyphDecoder_t decoder;
+  const GLIB_Glyph_t *pGlyph;
+  uint8_t alpha[CELL_MAX_WIDTH + 8];
+  uint32_t i, g, k, n, height, decoded[2] = { 0, 0 }, errors = 0;
+  int32_t row, x;
+
+  for (i = 0; (i < 300) && (errors == 0); i++) {
+    height = GLIBHOST_randomRange(1, PACKED_MAX_SIZE);
+    packedFontBuild(bppValues[i % 3], height, 0);
+
+    for (g = 0; g < PACKED_CHARS; g++) {
+      pGlyph = &packedFont.glyphs[g];
+      GLIB_glyphDecodeInit(&decoder, &packedFont.packed, pGlyph);
+      decoded[pGlyph->encoding]++;
+
+      for (row = -3; row < (int32_t) height + 3; row += GLIBHOST_randomRange(1, 3)) {
+        x = GLIBHOST_randomRange(-4, pGlyph->xAdvance + 4);
+        n = GLIBHOST_randomRange(1, sizeof(alpha));
+        GLIB_glyphDecodeRow(&decoder, row, x, n, alpha);
+        for (k = 0; k < n; k++) {
+          if (alpha[k] == packedAlpha(pGlyph, packedFont.alpha[g], x + (int32_t) k, row)) continue;
+          if (errors++ == 0) {
+            printf("  %u bpp %s glyph %u row %d pixel %d is %u\n", (unsigned) bppValues[i % 3],
+                   pGlyph->encoding ? "RLE" : "packed", (unsigned) g, (int) row,
+                   (int) (x + k), alpha[k]);
+          }
+        }
+      }
+    }
+  }
+
+  if ((decoded[GLIB_GLYPH_ENCODING_PACKED] == 0) || (decoded[GLIB_GLYPH_ENCODING_RLE] == 0)) {
+    printf("  both encodings must be decoded\n");
+    errors++;
+  }
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws random strings of random packed fonts with 1, 2 and 4 bpp at random
+*  positions, partly clipped, black on white and white on black, opaque and
+*  transparent. Anti-aliased pixels must be thresholded at half alpha on the
+*  mono display.
+******************************************************************************/
+static uint32_t glibDrawStringPacked(void)
+{
+  static const uint8_t bppValues[] = { 1, 2, 4 };
+  GLIB_Rectangle_t clip;
+  char text[12];
+  uint32_t i, length, errors = 0;
+  int32_t x, y;
+  uint8_t fg;
+  bool opaque;
+
+  for (i = 0; (i < 1500) && (errors == 0); i++) {
+    if ((i % 50) == 0) {
+      packedFontBuild(bppValues[(i / 50) % 3], GLIBHOST_randomRange(4, PACKED_MAX_SIZE),
+                      GLIBHOST_randomRange(0, 2));
+      GLIB_setFont(&GLIBHOST_context, &packedFont.font);
+    }
+    randomClip(&clip);
+
+    length = GLIBHOST_randomRange(1, sizeof(text) - 1);
+    packedRandomText(text, length);
+    x = GLIBHOST_randomRange(-20, GLIBHOST_WIDTH - 1);
+    y = GLIBHOST_randomRange(-20, GLIBHOST_HEIGHT - 1);
+    fg = GLIBHOST_random() & 1;
+    opaque = GLIBHOST_random() & 1;
+    GLIBHOST_context.foregroundColor = fg ? Black : White;
+    GLIBHOST_context.backgroundColor = fg ? White : Black;
+
+    GLIB_drawString(&GLIBHOST_context, text, length, x, y, opaque);
+
+    refPackedString(&clip, text, length, x, y, fg, opaque);
+    errors += GLIBHOST_check(opaque ? "GLIB_drawString packed opaque" :
+                             "GLIB_drawString packed transparent");
+  }
+  return errors;
+}
+
+/** Size of the RGB565 canvas of the packed font cases */
+#define CANVAS_WIDTH    128
+#define CANVAS_HEIGHT   64
+
+static uint32_t canvasPixels[GLIB_CANVAS_WORDS(CANVAS_WIDTH, CANVAS_HEIGHT,
+                                               GLIB_CANVAS_FORMAT_RGB565)];
+static uint16_t canvasRef[CANVAS_HEIGHT][CANVAS_WIDTH];
+static GLIB_Canvas_t canvas;
+static GLIB_Context_t canvasContext;
+
+/**************************************************************************//**
+*  @brief
+*  Converts a color as 0x00RRGGBB to RGB565
+******************************************************************************/
+static uint16_t rgb565(uint32_t color)
+{
+  return ((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets up canvasContext drawing to the RGB565 canvas, filled with color
+******************************************************************************/
+static void canvasSetup(uint32_t color)
+{
+  uint32_t x, y;
+
+  GLIB_canvasInit(&canvas, GLIB_CANVAS_FORMAT_RGB565, CANVAS_WIDTH, CANVAS_HEIGHT,
+                  canvasPixels, NULL, 0);
+  GLIB_contextInitCanvas(&canvasContext, &canvas);
+  GLIB_canvasFill(&canvas, 0, 0, CANVAS_WIDTH, CANVAS_HEIGHT, rgb565(color));
+  for (y = 0; y < CANVAS_HEIGHT; y++) {
+    for (x = 0; x < CANVAS_WIDTH; x++) canvasRef[y][x] = rgb565(color);
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a string of the font under test into the canvas reference, in the
+*  foreground color blended with the background color by the alpha values
+******************************************************************************/
+static void refPackedStringRgb(const GLIB_Rectangle_t *pClip, const char *text,
+                               uint32_t length, int32_t x, int32_t y, bool opaque)
+{
+  uint32_t i, idx, c, shift, color;
+  int32_t row, col, alpha, fg, bg, max = (1 << cells.bpp) - 1;
+
+  for (i = 0; i < length; i++) {
+    idx = (uint8_t) text[i] - cells.firstChar;
+    for (row = 0; row < cells.height; row++) {
+      for (col = 0; col < cells.width[idx]; col++) {
+        alpha = cells.alpha[idx][row][col];
+        if (((alpha == 0) && !opaque) || !GLIB_rectContainsPoint(pClip, x + col, y + row)) {
+          continue;
+        }
+        color = 0;
+        for (c = 0, shift = 16; c < 3; c++, shift -= 8) {
+          fg = (canvasContext.foregroundColor >> shift) & 0xFF;
+          bg = (canvasContext.backgroundColor >> shift) & 0xFF;
+          color |= (uint32_t) (bg + ((fg - bg) * alpha + max / 2) / max) << shift;
+        }
+        canvasRef[y + row][x + col] = rgb565(color);
+      }
+    }
+    x += cells.width[idx];
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Compares the canvas with canvasRef
+******************************************************************************/
+static uint32_t canvasCheck(const char *what)
+{
+  const uint16_t *pRow;
+  uint32_t errors = 0;
+  int32_t x, y;
+
+  for (y = 0; y < CANVAS_HEIGHT; y++) {
+    pRow = (const uint16_t *) ((const uint8_t *) canvasPixels + y * canvas.stride);
+    for (x = 0; x < CANVAS_WIDTH; x++) {
+      if (pRow[x] == canvasRef[y][x]) continue;
+      if (errors++ == 0) {
+        printf("  %s: canvas pixel (%d, %d) is 0x%04x, expected 0x%04x\n", what,
+               (int) x, (int) y, pRow[x], canvasRef[y][x]);
+      }
+    }
+  }
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws random strings of random packed fonts in random colors on an RGB565
+*  canvas, opaque and transparent, partly clipped, and compares the canvas
+*  with the blended colors
+******************************************************************************/
+static uint32_t glibDrawStringPackedRgb(void)
+{
+  static const uint8_t bppValues[] = { 1, 2, 4 };
+  GLIB_Rectangle_t clip;
+  char text[12];
+  uint32_t i, length, errors = 0;
+  int32_t x, y;
+  bool opaque;
+
+  canvasSetup(GLIBHOST_random() & 0xFFFFFF);
+  for (i = 0; (i < 600) && (errors == 0); i++) {
+    if ((i % 50) == 0) {
+      packedFontBuild(bppValues[(i / 50) % 3], GLIBHOST_randomRange(4, PACKED_MAX_SIZE),
+                      GLIBHOST_randomRange(0, 2));
+    }
+    GLIB_setFont(&canvasContext, &packedFont.font);
+
+    clip.xMin = GLIBHOST_randomRange(0, CANVAS_WIDTH - 2);
+    clip.yMin = GLIBHOST_randomRange(0, CANVAS_HEIGHT - 2);
+    clip.xMax = GLIBHOST_randomRange(clip.xMin + 1, CANVAS_WIDTH - 1);
+    clip.yMax = GLIBHOST_randomRange(clip.yMin + 1, CANVAS_HEIGHT - 1);
+    if (GLIBHOST_random() & 1) {
+      clip.xMin = clip.yMin = 0;
+      clip.xMax = CANVAS_WIDTH - 1;
+      clip.yMax = CANVAS_HEIGHT - 1;
+    }
+    GLIB_setClippingRegion(&canvasContext, &clip);
+
+    length = GLIBHOST_randomRange(1, sizeof(text) - 1);
+    packedRandomText(text, length);
+    x = GLIBHOST_randomRange(-20, CANVAS_WIDTH - 1);
+    y = GLIBHOST_randomRange(-20, CANVAS_HEIGHT - 1);
+    opaque = GLIBHOST_random() & 1;
+    canvasContext.foregroundColor = GLIBHOST_random() & 0xFFFFFF;
+    canvasContext.backgroundColor = GLIBHOST_random() & 0xFFFFFF;
+
+    GLIB_drawString(&canvasContext, text, length, x, y, opaque);
+
+    refPackedStringRgb(&clip, text, length, x, y, opaque);
+    errors += canvasCheck(opaque ? "GLIB_drawString packed RGB opaque" :
+                          "GLIB_drawString packed RGB transparent");
+  }
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks the glyph cache statistics against the expected changes
+******************************************************************************/
+static uint32_t glyphCacheExpect(GLIB_GlyphCacheStats_t *pLast, uint32_t hits,
+                                 uint32_t misses, const char *what)
+{
+  GLIB_GlyphCacheStats_t stats;
+  uint32_t errors = 0;
+
+  GLIB_glyphCacheGetStats(&stats);
+  if ((stats.hits - pLast->hits != hits) || (stats.misses - pLast->misses != misses)) {
+    printf("  %s: %u hits %u misses, expected %u and %u\n", what,
+           (unsigned) (stats.hits - pLast->hits), (unsigned) (stats.misses - pLast->misses),
+           (unsigned) hits, (unsigned) misses);
+    errors++;
+  }
+  *pLast = stats;
+  return errors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws chars of a packed font so that the glyph cache hits, misses and
+*  evicts glyphs: when its entries run out on the mono display, and when
+*  its bytes run out on the RGB565 canvas. Only opaque cells which are not
+*  clipped are cached. The pixels are checked after each string.
+******************************************************************************/
+static uint32_t glibGlyphCache(void)
+{
+  GLIB_GlyphCacheStats_t last, stats;
+  GLIB_Rectangle_t clip = { 0, 0, GLIBHOST_WIDTH - 1, GLIBHOST_HEIGHT - 1 };
+  char text[2] = { 0, 0 };
+  uint32_t i, n, bytes, errors = 0;
+  int32_t x, y;
+
+  packedFontBuild(4, 12, 1);
+  GLIB_setFont(&GLIBHOST_context, &packedFont.font);
+  GLIB_glyphCacheClear();
+  GLIB_glyphCacheGetStats(&last);
+
+  /* Draws char c of the font at a random place where it is not clipped */
+#define DRAW_CHAR(pContext, c, opaque)                                          \
+  do {                                                                          \
+    text[0] = (char) ('A' + (c));                                               \
+    x = GLIBHOST_randomRange(0, GLIBHOST_WIDTH - cells.width[c]);               \
+    y = GLIBHOST_randomRange(0, CANVAS_HEIGHT - cells.height);                  \
+    GLIB_drawString(pContext, text, 1, x, y, opaque);                           \
+    if ((pContext) == &GLIBHOST_context) {                                      \
+      refPackedString(&clip, text, 1, x, y,                                     \
+                      GLIBHOST_context.foregroundColor == Black, opaque);       \
+      errors += GLIBHOST_check("glyph cache");                                  \
+    } else {                                                                    \
+      refPackedStringRgb(&clip, text, 1, x, y, opaque);                         \
+      errors += canvasCheck("glyph cache RGB");                                 \
+    }                                                                           \
+  } while (0)
+
+  /* Mono display: first draws miss, redraws hit */
+  GLIBHOST_context.foregroundColor = Black;
+  GLIBHOST_context.backgroundColor = White;
+  for (i = 1; i <= 4; i++) DRAW_CHAR(&GLIBHOST_context, i, true);
+  errors += glyphCacheExpect(&last, 0, 4, "first draws");
+  for (i = 1; i <= 4; i++) DRAW_CHAR(&GLIBHOST_context, i, true);
+  errors += glyphCacheExpect(&last, 4, 0, "second draws");
+
+  /* Transparent and clipped cells bypass the cache */
+  for (i = 1; i <= 4; i++) DRAW_CHAR(&GLIBHOST_context, i, false);
+  text[0] = 'B';
+  GLIB_drawString(&GLIBHOST_context, text, 1, -1, 0, true);
+  refPackedString(&clip, text, 1, -1, 0, 1, true);
+  errors += GLIBHOST_check("glyph cache clipped");
+  errors += glyphCacheExpect(&last, 0, 0, "transparent and clipped draws");
+
+  /* Glyphs are cached per color */
+  GLIBHOST_context.foregroundColor = White;
+  GLIBHOST_context.backgroundColor = Black;
+  DRAW_CHAR(&GLIBHOST_context, 1, true);
+  GLIBHOST_context.foregroundColor = Black;
+  GLIBHOST_context.backgroundColor = White;
+  DRAW_CHAR(&GLIBHOST_context, 1, true);
+  errors += glyphCacheExpect(&last, 1, 1, "color change");
+
+  /* Five entries in use, GLIB_GLYPH_CACHE_ENTRIES new glyphs evict them */
+  for (i = 5; i < 5 + GLIB_GLYPH_CACHE_ENTRIES; i++) DRAW_CHAR(&GLIBHOST_context, i, true);
+  errors += glyphCacheExpect(&last, 0, GLIB_GLYPH_CACHE_ENTRIES, "new glyphs");
+  DRAW_CHAR(&GLIBHOST_context, 1, true);
+  errors += glyphCacheExpect(&last, 0, 1, "evicted glyph");
+
+  /* RGB565 canvas: glyphs of 3 bytes per pixel until the bytes run out */
+  GLIB_glyphCacheClear();
+  GLIB_glyphCacheGetStats(&last);
+  canvasSetup(White);
+  GLIB_setFont(&canvasContext, &packedFont.font);
+  canvasContext.foregroundColor = 0x2040C0;
+  canvasContext.backgroundColor = 0xE0E0A0;
+  clip.yMax = CANVAS_HEIGHT - 1;
+  for (i = 1, n = 0, bytes = 0; bytes <= GLIB_GLYPH_CACHE_BYTES; i++, n++) {
+    bytes += (cells.width[i] * cells.height * 3 + 3) & ~3UL;
+    DRAW_CHAR(&canvasContext, i, true);
+  }
+  if (n > GLIB_GLYPH_CACHE_ENTRIES) {
+    printf("  glyph cache RGB: %u glyphs fill the cache bytes\n", (unsigned) n);
+    errors++;
+  }
+  errors += glyphCacheExpect(&last, 0, n, "RGB glyphs");
+  DRAW_CHAR(&canvasContext, 1, true);
+  errors += glyphCacheExpect(&last, 0, 1, "RGB glyph evicted by the ring");
+  DRAW_CHAR(&canvasContext, i - 1, true);
+  errors += glyphCacheExpect(&last, 1, 0, "RGB glyph kept");
+
+#undef DRAW_CHAR
+
+  GLIB_glyphCacheGetStats(&stats);
+  if (stats.evictions == 0) {
+    printf("  glyph cache: no evictions\n");
+    errors++;
+  }
+  return errors;
+}
+
+/* The converter is built into the test, its main function is called with
+ * the options of each font */
+#define main glibfontconv_main
+#include "../tools/glibfontconv.c"
+#undef main
+
+/** A glyph of the BDF fonts built by glibFontConvRoundTrip */
+typedef struct __BdfTestGlyph_t
+{
+  bool defined;
+  int32_t dwidth, w, h, xoff, yoff;
+  uint8_t bits[45 * 32];
+} BdfTestGlyph_t;
+
+static BdfTestGlyph_t bdfTest[128];
+static char convOutput[64 * 1024];
+static GLIB_Glyph_t convGlyphs[CELL_MAX_CHARS];
+static uint8_t convData[16 * 1024];
+static GLIB_PackedFont_t convPacked;
+static GLIB_Font_t convFont;
+
+/**************************************************************************//**
+*  @brief
+*  Writes a BDF font with the glyphs of bdfTest from 32 to 90, and random
+*  glyphs for some of the chars from 'A' to 'Z'. The others are missing.
+******************************************************************************/
+static void bdfWrite(const char *path, int32_t scale, int32_t ascent, int32_t descent)
+{
+  BdfTestGlyph_t *g;
+  FILE *f = fopen(path, "w");
+  int32_t c, row, col, bit, byte;
+
+  memset(bdfTest, 0, sizeof(bdfTest));
+  bdfTest[' '].defined = true;
+  bdfTest[' '].dwidth = GLIBHOST_randomRange(2, 6) * scale;
+
+  for (c = 'A'; c <= 'Z'; c++) {
+    if ((GLIBHOST_random() & 3) == 0) continue;
+    g = &bdfTest[c];
+    g->defined = true;
+    g->dwidth = GLIBHOST_randomRange(2, 10) * scale + GLIBHOST_random() % scale;
+    g->w = GLIBHOST_randomRange(1, g->dwidth);
+    g->xoff = GLIBHOST_randomRange(0, g->dwidth - g->w);
+    g->h = GLIBHOST_randomRange(1, ascent + descent);
+    g->yoff = GLIBHOST_randomRange(-descent, ascent - g->h);
+    for (col = 0; col < g->w * g->h; col++) {
+      g->bits[col] = ((col > 0) && (GLIBHOST_random() & 3)) ? g->bits[col - 1] :
+                     GLIBHOST_random() & 1;
+    }
+  }
+
+  fprintf(f, "STARTFONT 2.1\nFONT -host-test\nSIZE %d 75 75\n", (int) (ascent + descent));
+  fprintf(f, "STARTPROPERTIES 2\nFONT_ASCENT %d\nFONT_DESCENT %d\nENDPROPERTIES\n",
+          (int) ascent, (int) descent);
+  for (c = ' '; c <= 'Z'; c++) {
+    g = &bdfTest[c];
+    if (!g->defined) continue;
+    fprintf(f, "STARTCHAR c%d\nENCODING %d\nSWIDTH 500 0\nDWIDTH %d 0\nBBX %d %d %d %d\nBITMAP\n",
+            (int) c, (int) c, (int) g->dwidth, (int) g->w, (int) g->h, (int) g->xoff,
+            (int) g->yoff);
+    for (row = 0; row < g->h; row++) {
+      for (col = 0; col < g->w; col += 8) {
+        byte = 0;
+        for (bit = 0; (bit < 8) && (col + bit < g->w); bit++) {
+          byte |= g->bits[row * g->w + col + bit] << (7 - bit);
+        }
+        fprintf(f, "%02X", (unsigned) byte);
+      }
+      fprintf(f, "\n");
+    }
+    fprintf(f, "ENDCHAR\n");
+  }
+  fprintf(f, "ENDFONT\n");
+  fclose(f);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets up cells from the BDF glyphs: each pixel gets the coverage of its
+*  scale x scale BDF pixels, missing chars are blank cells as wide as a space
+******************************************************************************/
+static void bdfCells(int32_t scale, int32_t bpp, int32_t ascent, int32_t descent,
+                     int32_t charSpacing)
+{
+  const BdfTestGlyph_t *g;
+  int32_t c, row, col, sx, sy, top, cov, max = (1 << bpp) - 1;
+
+  cells.firstChar = ' ';
+  cells.numChars = 'Z' - ' ' + 1;
+  cells.bpp = bpp;
+  cells.height = (ascent + descent + scale - 1) / scale;
+
+  for (c = ' '; c <= 'Z'; c++) {
+    g = bdfTest[c].defined ? &bdfTest[c] : &bdfTest[' '];
+    cells.width[c - ' '] = (g->dwidth + scale / 2) / scale + charSpacing;
+    top = ascent - g->yoff - g->h;
+    for (row = 0; row < cells.height; row++) {
+      for (col = 0; col < cells.width[c - ' ']; col++) {
+        cov = 0;
+        for (sy = row * scale; sy < (row + 1) * scale; sy++) {
+          for (sx = col * scale; sx < (col + 1) * scale; sx++) {
+            if ((sx >= g->xoff) && (sx < g->xoff + g->w) && (sy >= top) && (sy < top + g->h)) {
+              cov += g->bits[(sy - top) * g->w + sx - g->xoff];
+            }
+          }
+        }
+        cells.alpha[c - ' '][row][col] = (cov * max + scale * scale / 2) / (scale * scale);
+      }
+    }
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Runs glibfontconv with the output to a file
+*
+*  @return
+*  Returns true if the output was read into convOutput
+******************************************************************************/
+static bool fontConvRun(const char *bdfPath, const char *outPath, int32_t bpp,
+                        int32_t scale, int32_t charSpacing)
+{
+  char bppArg[4], scaleArg[4], spacingArg[4];
+  char *argv[] = { "glibfontconv", "-n", "GLIBHOST_FontConv", "-b", bppArg, "-s", scaleArg,
+                   "-r", "32-90", "-c", spacingArg, (char *) bdfPath, NULL };
+  FILE *f;
+  size_t n;
+  int savedOut, savedErr, fd;
+
+  snprintf(bppArg, sizeof(bppArg), "%d", (int) bpp);
+  snprintf(scaleArg, sizeof(scaleArg), "%d", (int) scale);
+  snprintf(spacingArg, sizeof(spacingArg), "%d", (int) charSpacing);
+
+  /* The converter prints the font to stdout and statistics to stderr */
+  fflush(stdout);
+  fflush(stderr);
+  savedOut = dup(1);
+  savedErr = dup(2);
+  fd = open(outPath, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  dup2(fd, 1);
+  close(fd);
+  fd = open("/dev/null", O_WRONLY);
+  dup2(fd, 2);
+  close(fd);
+
+  memset(bdf, 0, sizeof(bdf));
+  glibfontconv_main(sizeof(argv) / sizeof(argv[0]) - 1, argv);
+
+  fflush(stdout);
+  fflush(stderr);
+  dup2(savedOut, 1);
+  dup2(savedErr, 2);
+  close(savedOut);
+  close(savedErr);
+
+  f = fopen(outPath, "r");
+  if (f == NULL) return false;
+  n = fread(convOutput, 1, sizeof(convOutput) - 1, f);
+  convOutput[n] = '\0';
+  fclose(f);
+  return true;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reads the glyph data, the glyph table and the font structures of the
+*  converter output into convData, convGlyphs, convPacked and convFont
+*
+*  @return
+*  Returns true if the output has the expected layout
+******************************************************************************/
+static bool fontConvParse(void)
+{
+  char encoding[8];
+  const char *p;
+  unsigned value;
+  int offset, width, height, xOffset, yOffset, xAdvance, first, num, bpp;
+  int count, fontWidth, fontHeight, lineSpacing, charSpacing, k;
+  uint32_t i, n = 0;
+
+  p = strstr(convOutput, "Data[] =\n{");
+  if (p == NULL) return false;
+  p += strlen("Data[] =\n{");
+  while ((n < sizeof(convData)) && (sscanf(p, " 0x%x,%n", &value, &k) == 1)) {
+    convData[n++] = value;
+    p += k;
+  }
+
+  p = strstr(convOutput, "Packed = {");
+  if ((p == NULL) || (sscanf(p, "Packed = {%*[^,], %*[^,], %d, %d, %d}", &first, &num, &bpp) != 3) ||
+      (num > CELL_MAX_CHARS)) {
+    return false;
+  }
+
+  p = strstr(convOutput, "Glyphs[] =\n{\n");
+  if (p == NULL) return false;
+  p += strlen("Glyphs[] =\n{\n");
+  for (i = 0; i < (uint32_t) num; i++) {
+    if ((sscanf(p, " {%d, %d, %d, %d, %d, %d, GLIB_GLYPH_ENCODING_%7[A-Z]", &offset, &width,
+                &height, &xOffset, &yOffset, &xAdvance, encoding) != 7) ||
+        ((uint32_t) offset > n)) {
+      return false;
+    }
+    convGlyphs[i].offset = offset;
+    convGlyphs[i].width = width;
+    convGlyphs[i].height = height;
+    convGlyphs[i].xOffset = xOffset;
+    convGlyphs[i].yOffset = yOffset;
+    convGlyphs[i].xAdvance = xAdvance;
+    convGlyphs[i].encoding = strcmp(encoding, "RLE") ? GLIB_GLYPH_ENCODING_PACKED :
+                             GLIB_GLYPH_ENCODING_RLE;
+    p = strchr(p, '\n');
+    if (p == NULL) return false;
+    p++;
+  }
+
+  p = strstr(convOutput, "(void *)&");
+  if ((p == NULL) || ((p = strchr(p, '\n')) == NULL) ||
+      (sscanf(p, " %d, 0, 0, %d, %d, %d, %d, PackedFont", &count, &fontWidth, &fontHeight,
+              &lineSpacing, &charSpacing) != 5)) {
+    return false;
+  }
+
+  convPacked.pGlyphs = convGlyphs;
+  convPacked.pData = convData;
+  convPacked.firstChar = first;
+  convPacked.numChars = num;
+  convPacked.bpp = bpp;
+
+  memset(&convFont, 0, sizeof(convFont));
+  convFont.pFontPixMap = &convPacked;
+  convFont.cntOfMapElements = count;
+  convFont.fontWidth = fontWidth;
+  convFont.fontHeight = fontHeight;
+  convFont.lineSpacing = lineSpacing;
+  convFont.charSpacing = charSpacing;
+  convFont.class = PackedFont;
+  return true;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Converts random BDF fonts with tools/glibfontconv.c, 1, 2 and 4 bpp and
+*  scaled down or not, reads the generated C back and draws random strings
+*  with the font. The pixels are compared with the coverage of the BDF
+*  glyphs, so the converter, the encodings it picks and the decoder are
+*  checked together.
+******************************************************************************/
+static uint32_t glibFontConvRoundTrip(void)
+{
+  static const uint8_t bppValues[] = { 1, 2, 4 };
+  char bdfPath[] = "/tmp/glibhostbdfXXXXXX";
+  char outPath[] = "/tmp/glibhostfontXXXXXX";
+  GLIB_Rectangle_t clip;
+  char text[12];
+  uint32_t i, k, length, errors = 0;
+  int32_t bpp, scale, ascent, descent, charSpacing, x, y;
+  uint8_t fg;
+  bool opaque;
+
+  close(mkstemp(bdfPath));
+  close(mkstemp(outPath));
+
+  for (i = 0; (i < 24) && (errors == 0); i++) {
+    bpp = bppValues[i % 3];
+    scale = GLIBHOST_randomRange(1, 3);
+    ascent = GLIBHOST_randomRange(6, 12) * scale;
+    descent = GLIBHOST_randomRange(1, 3) * scale - GLIBHOST_random() % scale;
+    charSpacing = GLIBHOST_randomRange(0, 2);
+
+    bdfWrite(bdfPath, scale, ascent, descent);
+    bdfCells(scale, bpp, ascent, descent, charSpacing);
+    if (!fontConvRun(bdfPath, outPath, bpp, scale, charSpacing) || !fontConvParse()) {
+      printf("  glibfontconv output not read, %d bpp scale %d\n", (int) bpp, (int) scale);
+      errors++;
+      break;
+    }
+    if ((convPacked.firstChar != cells.firstChar) || (convPacked.numChars != cells.numChars) ||
+        (convPacked.bpp != bpp) || (convFont.fontHeight != cells.height) ||
+        (convFont.charSpacing != charSpacing)) {
+      printf("  glibfontconv font %d bpp scale %d: wrong font metrics\n", (int) bpp, (int) scale);
+      errors++;
+      break;
+    }
+
+    GLIB_setFont(&GLIBHOST_context, &convFont);
+    for (k = 0; (k < 40) && (errors == 0); k++) {
+      randomClip(&clip);
+      length = GLIBHOST_randomRange(1, sizeof(text) - 1);
+      packedRandomText(text, length);
+      x = GLIBHOST_randomRange(-20, GLIBHOST_WIDTH - 1);
+      y = GLIBHOST_randomRange(-20, GLIBHOST_HEIGHT - 1);
+      fg = GLIBHOST_random() & 1;
+      opaque = GLIBHOST_random() & 1;
+      GLIBHOST_context.foregroundColor = fg ? Black : White;
+      GLIBHOST_context.backgroundColor = fg ? White : Black;
+
+      GLIB_drawString(&GLIBHOST_context, text, length, x, y, opaque);
+
+      refPackedString(&clip, text, length, x, y, fg, opaque);
+      errors += GLIBHOST_check("glibfontconv font");
+    }
+    if (errors) printf("  %d bpp, scale %d\n", (int) bpp, (int) scale);
+  }
+
+  unlink(bdfPath);
+  unlink(outPath);
+  return errors;
+}
+
+const GLIBHOST_Case_t GLIBHOST_cases[] = {
+  { "DMD_writeData mono", dmdWriteDataMono },
+  { "GLIB_drawString", glibDrawString },
+  { "GLIB_drawPolygonFilled", glibPolygonFilled },
+  { "GLIB_drawCircleFilled", glibCircleFilled },
+  { "GLIB_drawRoundRectFilled", glibRoundRectFilled },
+  { "BMP_drawToDisplay mono", glibBmpMono },
+  { "GLIB_glyphDecodeRow", glibGlyphDecode },
+  { "GLIB_drawString packed", glibDrawStringPacked },
+  { "GLIB_drawString packed RGB565", glibDrawStringPackedRgb },
+  { "glyph cache", glibGlyphCache },
+  { "glibfontconv round trip", glibFontConvRoundTrip },
+};
+
+const uint32_t GLIBHOST_numCases = sizeof(GLIBHOST_cases) / sizeof(GLIBHOST_cases[0]);
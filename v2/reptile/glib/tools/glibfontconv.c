@@ -0,0 +1,337 @@
+ /*************************************************************************//**
+ * @file glibfontconv.c
+ * @brief Silicon Labs Graphics Library: BDF to packed font converter
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/* Host tool converting a BDF bitmap font into a GLIB packed font, see
+ * GLIB_PackedFont_t in glib.h. Build and run on the host:
+ *
+ *   cc -O2 -o glibfontconv glibfontconv.c
+ *   glibfontconv [options] font.bdf > glib_font_name.c
+ *
+ * Options:
+ *   -n name     Name of the GLIB_Font_t, default GLIB_FontPacked
+ *   -b bpp      Bits of alpha per pixel, 1, 2 or 4, default 1
+ *   -s scale    The BDF font is drawn scale times larger than the generated
+ *               font. Each pixel of the generated font gets the coverage of
+ *               scale x scale BDF pixels as alpha value. Use with -b 2 or
+ *               -b 4 to make anti-aliased fonts from large bitmap fonts.
+ *   -r first-last
+ *               Range of char codes to convert, default 32-126
+ *   -l spacing  Line spacing of the GLIB_Font_t, default 0
+ *   -c spacing  Char spacing of the GLIB_Font_t, default 0
+ *
+ * Glyph bitmaps are cropped to the pixels that are set, and each glyph is
+ * stored bit packed or run length encoded, whichever is smaller. Glyph
+ * pixels left of the pen position or right of the advance are outside the
+ * glyph cell and are not drawn by GLIB, the tool warns about such glyphs. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MAX_CHARS       256
+#define MAX_LINE        1024
+
+/* A glyph as read from the BDF file, bitmap relative to the baseline */
+typedef struct {
+  int defined;
+  int dwidth;
+  int w, h, xoff, yoff;
+  unsigned char *bits;            /* w * h pixels, one byte each */
+} BdfGlyph;
+
+/* A converted glyph */
+typedef struct {
+  int width, height, xOffset, yOffset, xAdvance;
+  unsigned char *alpha;           /* width * height alpha values */
+  unsigned char *data;
+  int size;
+  int encoding;
+} Glyph;
+
+static BdfGlyph bdf[MAX_CHARS];
+static int fontAscent, fontDescent;
+
+static int floorDiv(int a, int b)
+{
+  return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+static int ceilDiv(int a, int b)
+{
+  return -floorDiv(-a, b);
+}
+
+static void fail(const char *msg, const char *arg)
+{
+  fprintf(stderr, "glibfontconv: %s%s\n", msg, arg ? arg : "");
+  exit(1);
+}
+
+/* Reads the glyphs of the BDF file */
+static void readBdf(FILE *f)
+{
+  char line[MAX_LINE];
+  int encoding = -1, dwidth = 0, w = 0, h = 0, xoff = 0, yoff = 0;
+  int row, col, hex;
+  BdfGlyph *g;
+
+  while (fgets(line, sizeof(line), f)) {
+    if (!strncmp(line, "FONT_ASCENT ", 12)) {
+      fontAscent = atoi(line + 12);
+    } else if (!strncmp(line, "FONT_DESCENT ", 13)) {
+      fontDescent = atoi(line + 13);
+    } else if (!strncmp(line, "STARTCHAR", 9)) {
+      encoding = -1;
+      dwidth = w = h = xoff = yoff = 0;
+    } else if (!strncmp(line, "ENCODING ", 9)) {
+      encoding = atoi(line + 9);
+    } else if (!strncmp(line, "DWIDTH ", 7)) {
+      dwidth = atoi(line + 7);
+    } else if (!strncmp(line, "BBX ", 4)) {
+      if (sscanf(line + 4, "%d %d %d %d", &w, &h, &xoff, &yoff) != 4) {
+        fail("bad BBX line: ", line);
+      }
+    } else if (!strncmp(line, "BITMAP", 6)) {
+      if ((encoding < 0) || (encoding >= MAX_CHARS)) continue;
+      g = &bdf[encoding];
+      g->defined = 1;
+      g->dwidth = dwidth;
+      g->w = w;
+      g->h = h;
+      g->xoff = xoff;
+      g->yoff = yoff;
+      g->bits = calloc(w * h + 1, 1);
+      for (row = 0; row < h; row++) {
+        if (!fgets(line, sizeof(line), f)) fail("unexpected end of file", NULL);
+        for (col = 0; col < w; col++) {
+          if (!isxdigit((unsigned char)line[col / 4])) fail("bad BITMAP row: ", line);
+          hex = isdigit((unsigned char)line[col / 4]) ?
+                line[col / 4] - '0' : (tolower((unsigned char)line[col / 4]) - 'a' + 10);
+          g->bits[row * w + col] = (hex >> (3 - (col & 3))) & 1;
+        }
+      }
+    }
+  }
+}
+
+/* Scales a BDF glyph down to alpha values and crops it to the set pixels */
+static void convertGlyph(const BdfGlyph *b, Glyph *g, int scale, int bpp)
+{
+  int max = (1 << bpp) - 1;
+  int left, top, x0, y0, x1, y1, x, y, sx, sy, cov;
+  int minX, minY, maxX, maxY, w, h;
+  unsigned char *full;
+
+  g->xAdvance = (b->dwidth + scale / 2) / scale;
+  g->width = g->height = g->xOffset = g->yOffset = 0;
+  g->alpha = NULL;
+  if ((b->w == 0) || (b->h == 0)) return;
+
+  /* Bitmap position in BDF pixels, relative to the pen and the line top */
+  left = b->xoff;
+  top  = fontAscent - b->yoff - b->h;
+  x0 = floorDiv(left, scale);
+  y0 = floorDiv(top, scale);
+  x1 = ceilDiv(left + b->w, scale);
+  y1 = ceilDiv(top + b->h, scale);
+  w = x1 - x0;
+  h = y1 - y0;
+
+  full = calloc(w * h, 1);
+  minX = w; minY = h; maxX = -1; maxY = -1;
+  for (y = 0; y < h; y++) {
+    for (x = 0; x < w; x++) {
+      cov = 0;
+      for (sy = (y0 + y) * scale; sy < (y0 + y + 1) * scale; sy++) {
+        for (sx = (x0 + x) * scale; sx < (x0 + x + 1) * scale; sx++) {
+          if ((sx >= left) && (sx < left + b->w) && (sy >= top) && (sy < top + b->h)) {
+            cov += b->bits[(sy - top) * b->w + (sx - left)];
+          }
+        }
+      }
+      full[y * w + x] = (cov * max + scale * scale / 2) / (scale * scale);
+      if (full[y * w + x]) {
+        if (x < minX) minX = x;
+        if (x > maxX) maxX = x;
+        if (y < minY) minY = y;
+        if (y > maxY) maxY = y;
+      }
+    }
+  }
+
+  if (maxX >= 0) {
+    g->width   = maxX - minX + 1;
+    g->height  = maxY - minY + 1;
+    g->xOffset = x0 + minX;
+    g->yOffset = y0 + minY;
+    g->alpha   = malloc(g->width * g->height);
+    for (y = 0; y < g->height; y++) {
+      memcpy(&g->alpha[y * g->width], &full[(minY + y) * w + minX], g->width);
+    }
+  }
+  free(full);
+}
+
+/* Encodes the alpha values of a glyph bit packed and run length encoded,
+ * and keeps the smaller one */
+static void encodeGlyph(Glyph *g, int bpp)
+{
+  int n = g->width * g->height;
+  int maxRun = 1 << (8 - bpp);
+  int i, run, packedSize, rleSize;
+  unsigned char *packed = calloc((n * bpp + 7) / 8 + 1, 1);
+  unsigned char *rle = malloc(n + 1);
+
+  for (i = 0; i < n; i++) {
+    packed[(i * bpp) >> 3] |= g->alpha[i] << ((i * bpp) & 0x7);
+  }
+  packedSize = (n * bpp + 7) / 8;
+
+  rleSize = 0;
+  for (i = 0; i < n; i += run) {
+    for (run = 1; (i + run < n) && (run < maxRun) && (g->alpha[i + run] == g->alpha[i]); run++) ;
+    rle[rleSize++] = (g->alpha[i] << (8 - bpp)) | (run - 1);
+  }
+
+  if (rleSize < packedSize) {
+    g->data = rle;
+    g->size = rleSize;
+    g->encoding = 1;
+    free(packed);
+  } else {
+    g->data = packed;
+    g->size = packedSize;
+    g->encoding = 0;
+    free(rle);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  const char *name = "GLIB_FontPacked";
+  const char *file = NULL;
+  int bpp = 1, scale = 1, first = 32, last = 126;
+  int lineSpacing = 0, charSpacing = 0;
+  int i, c, n, offset, maxAdvance, lineHeight, fixedSize;
+  Glyph glyphs[MAX_CHARS];
+  FILE *f;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && (i + 1 < argc)) {
+      name = argv[++i];
+    } else if (!strcmp(argv[i], "-b") && (i + 1 < argc)) {
+      bpp = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-s") && (i + 1 < argc)) {
+      scale = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-r") && (i + 1 < argc)) {
+      if (sscanf(argv[++i], "%d-%d", &first, &last) != 2) fail("bad range: ", argv[i]);
+    } else if (!strcmp(argv[i], "-l") && (i + 1 < argc)) {
+      lineSpacing = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-c") && (i + 1 < argc)) {
+      charSpacing = atoi(argv[++i]);
+    } else if (argv[i][0] != '-') {
+      file = argv[i];
+    } else {
+      fail("unknown option ", argv[i]);
+    }
+  }
+  if (file == NULL) fail("usage: glibfontconv [-n name] [-b bpp] [-s scale] "
+                         "[-r first-last] [-l spacing] [-c spacing] font.bdf", NULL);
+  if ((bpp != 1) && (bpp != 2) && (bpp != 4)) fail("bpp must be 1, 2 or 4", NULL);
+  if (scale < 1) fail("bad scale", NULL);
+  if ((first < 0) || (last >= MAX_CHARS) || (first > last) || (last - first + 1 > 255)) {
+    fail("bad char range", NULL);
+  }
+
+  f = fopen(file, "r");
+  if (f == NULL) fail("cannot open ", file);
+  readBdf(f);
+  fclose(f);
+
+  lineHeight = ceilDiv(fontAscent + fontDescent, scale);
+  if ((lineHeight <= 0) || (lineHeight > 255)) fail("bad FONT_ASCENT or FONT_DESCENT", NULL);
+
+  n = last - first + 1;
+  offset = 0;
+  maxAdvance = 0;
+  for (i = 0; i < n; i++) {
+    c = first + i;
+    if (!bdf[c].defined) {
+      /* Missing chars are drawn as blank cells as wide as a space */
+      bdf[c] = bdf[' '];
+      bdf[c].w = 0;
+      bdf[c].h = 0;
+    }
+    convertGlyph(&bdf[c], &glyphs[i], scale, bpp);
+    encodeGlyph(&glyphs[i], bpp);
+    if (glyphs[i].xAdvance > maxAdvance) maxAdvance = glyphs[i].xAdvance;
+
+    if ((glyphs[i].width > 255) || (glyphs[i].height > 255) ||
+        (glyphs[i].xOffset < -128) || (glyphs[i].xOffset > 127) ||
+        (glyphs[i].yOffset < -128) || (glyphs[i].yOffset > 127) ||
+        (glyphs[i].xAdvance > 255)) {
+      fail("glyph too large", NULL);
+    }
+    if ((glyphs[i].width > 0) &&
+        ((glyphs[i].xOffset < 0) ||
+         (glyphs[i].xOffset + glyphs[i].width > glyphs[i].xAdvance + charSpacing) ||
+         (glyphs[i].yOffset < 0) ||
+         (glyphs[i].yOffset + glyphs[i].height > lineHeight))) {
+      fprintf(stderr, "glibfontconv: warning: char %d is clipped by its cell\n", c);
+    }
+  }
+
+  printf(" /*************************************************************************//**\n");
+  printf(" * @file\n");
+  printf(" * @brief Silicon Labs Graphics Library: GLIB packed font %s\n", name);
+  printf(" ******************************************************************************\n");
+  printf(" * Generated by glibfontconv from %s, %d bpp", file, bpp);
+  if (scale > 1) printf(", scale %d", scale);
+  printf(".\n");
+  printf(" ******************************************************************************/\n\n\n");
+  printf("/* Standard C header files */\n#include <stdint.h>\n#include \"glib.h\"\n\n");
+
+  printf("static const uint8_t %sData[] =\n{", name);
+  for (i = 0, offset = 0; i < n; i++) {
+    for (c = 0; c < glyphs[i].size; c++, offset++) {
+      printf("%s0x%02x,", (offset % 12) ? " " : "\n  ", glyphs[i].data[c]);
+    }
+  }
+  if (offset == 0) printf("\n  0x00,");
+  printf("\n};\n\n");
+
+  printf("static const GLIB_Glyph_t %sGlyphs[] =\n{\n", name);
+  for (i = 0, offset = 0; i < n; i++) {
+    printf("  {%6d, %3d, %3d, %4d, %4d, %3d, %s}, /* '%c' */\n", offset,
+           glyphs[i].width, glyphs[i].height, glyphs[i].xOffset, glyphs[i].yOffset,
+           glyphs[i].xAdvance,
+           glyphs[i].encoding ? "GLIB_GLYPH_ENCODING_RLE   " : "GLIB_GLYPH_ENCODING_PACKED",
+           isprint(first + i) && (first + i != '\\') ? first + i : '?');
+    offset += glyphs[i].size;
+  }
+  printf("};\n\n");
+
+  printf("static const GLIB_PackedFont_t %sPacked = {%sGlyphs, %sData, %d, %d, %d};\n\n",
+         name, name, name, first, n, bpp);
+  printf("const GLIB_Font_t %s = {(void *)&%sPacked,\n", name, name);
+  printf("%*s%d, 0, 0, %d, %d, %d, %d, PackedFont};\n",
+         (int)strlen(name) + 22, "", n, maxAdvance, lineHeight, lineSpacing, charSpacing);
+
+  fixedSize = n * lineHeight * ((maxAdvance + 7) / 8);
+  fprintf(stderr, "glibfontconv: %d glyphs, %d bytes glyph data, %d bytes glyph table "
+          "(%d bytes as a 1 bpp fixed size font)\n",
+          n, offset, n * 12, fixedSize);
+  return 0;
+}
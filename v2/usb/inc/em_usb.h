@@ -97,6 +97,11 @@ extern "C" {
 #define USB_CDC_SETCTRLLINESTATE  0x22          /**< CDC class setup request SET_CONTROL_LINE_STATE.   */
 #define USB_MSD_BOTRESET          0xFF          /**< MSD class setup request Bulk only transfer reset. */
 #define USB_MSD_GETMAXLUN         0xFE          /**< MSD class setup request Get Max LUN.              */
+#define USB_AUDIO_SET_CUR         0x01          /**< AUDIO class setup request SET_CUR.                */
+#define USB_AUDIO_GET_CUR         0x81          /**< AUDIO class setup request GET_CUR.                */
+#define USB_AUDIO_GET_MIN         0x82          /**< AUDIO class setup request GET_MIN.                */
+#define USB_AUDIO_GET_MAX         0x83          /**< AUDIO class setup request GET_MAX.                */
+#define USB_AUDIO_GET_RES         0x84          /**< AUDIO class setup request GET_RES.                */
 
 /* SETUP command GET/SET_DESCRIPTOR decriptor types */
 #define USB_DEVICE_DESCRIPTOR             1     /**< DEVICE descriptor value.                          */
@@ -112,6 +117,7 @@ extern "C" {
 #define USB_HID_DESCRIPTOR                0x21  /**< HID descriptor value.                             */
 #define USB_HID_REPORT_DESCRIPTOR         0x22  /**< HID REPORT descriptor value.                      */
 #define USB_CS_INTERFACE_DESCRIPTOR       0x24  /**< Audio Class-specific Descriptor Type.             */
+#define USB_CS_ENDPOINT_DESCRIPTOR        0x25  /**< Audio Class-specific Endpoint Descriptor Type.    */
 #define USB_SMARTCARD_DESCRIPTOR          0x21  /**< Smartcard usb-ccid-specific Descriptor Type.      */
 
 #define USB_DEVICE_DESCSIZE               18    /**< Device descriptor size.                           */
@@ -134,6 +140,10 @@ extern "C" {
 #define USB_EPTYPE_ISOC        1                /**< Endpoint type isochron.                           */
 #define USB_EPTYPE_BULK        2                /**< Endpoint type bulk.                               */
 #define USB_EPTYPE_INTR        3                /**< Endpoint type interrupt.                          */
+#define USB_EPSYNC_ASYNC       ( 1 << 2 )       /**< Isochronous endpoint, asynchronous.               */
+#define USB_EPSYNC_ADAPTIVE    ( 2 << 2 )       /**< Isochronous endpoint, adaptive.                   */
+#define USB_EPSYNC_SYNC        ( 3 << 2 )       /**< Isochronous endpoint, synchronous.                */
+#define USB_EPUSAGE_FEEDBACK   ( 1 << 4 )       /**< Isochronous endpoint, explicit feedback.          */
 #define USB_EP_DIR_IN          0x80             /**< Endpoint direction mask.                          */
 #define USB_SETUP_PKT_SIZE     8                /**< Setup request packet size.                        */
 #define USB_EPNUM_MASK         0x0F             /**< Endpoint number mask.                             */
@@ -151,9 +161,14 @@ extern "C" {
 #define USB_FEATURE_ENDPOINT_HALT         0     /**< Standard request CLEAR/SET_FEATURE bitmask.       */
 #define USB_FEATURE_DEVICE_REMOTE_WAKEUP  1     /**< Standard request CLEAR/SET_FEATURE bitmask.       */
 
+#define HUB_FEATURE_PORT_ENABLE           1     /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
+#define HUB_FEATURE_PORT_SUSPEND          2     /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
 #define HUB_FEATURE_PORT_RESET            4     /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
 #define HUB_FEATURE_PORT_POWER            8     /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
 #define HUB_FEATURE_C_PORT_CONNECTION     16    /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
+#define HUB_FEATURE_C_PORT_ENABLE         17    /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
+#define HUB_FEATURE_C_PORT_SUSPEND        18    /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
+#define HUB_FEATURE_C_PORT_OVER_CURRENT   19    /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
 #define HUB_FEATURE_C_PORT_RESET          20    /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
 #define HUB_FEATURE_PORT_INDICATOR        22    /**< HUB class request CLEAR/SET_PORT_FEATURE feature selector. */
 
@@ -165,6 +180,10 @@ extern "C" {
 #define USB_CLASS_CDC_ACMFN               2     /**< CDC class Abstract Control Management Functional Descriptor subtype.*/
 #define USB_CLASS_CDC_UNIONFN             6     /**< CDC class Union Functional Descriptor subtype.      */
 
+#define USB_CLASS_AUDIO                   1     /**< AUDIO device/interface class code.                  */
+#define USB_CLASS_AUDIO_CONTROL           1     /**< AUDIO Control interface subclass code.              */
+#define USB_CLASS_AUDIO_STREAMING         2     /**< AUDIO Streaming interface subclass code.            */
+
 #define USB_CLASS_HID                     3     /**< HID device/interface class code.                    */
 #define USB_CLASS_HID_KEYBOARD            1     /**< HID keyboard interface protocol code.               */
 #define USB_CLASS_HID_MOUSE               2     /**< HID mouse interface protocol code.                  */
@@ -765,6 +784,32 @@ typedef struct USBD_Callbacks_TypeDef
 } USBD_Callbacks_TypeDef;
 
 
+/** @brief Endpoint traffic statistics.
+ *  @details Collected by the device stack when @em usbconfig.h defines
+ *  USB_EP_STATS, see @ref USBD_GetEpStats().                              */
+typedef struct
+{
+  uint32_t  bytes;          /**< Payload bytes transferred.                         */
+  uint32_t  transfers;      /**< Number of completed transfers.                     */
+  uint32_t  naks;           /**< NAK handshakes sent to the host.                   */
+  uint32_t  fifoEmpty;      /**< IN tokens received with an empty Tx FIFO.          */
+  uint32_t  frames;         /**< Frames (SOF's) since the statistics were cleared.  */
+  uint32_t  maxFrameBytes;  /**< Most bytes moved within one frame, sampled at SOF.  */
+} USBD_EpStats_TypeDef;
+
+
+/** Largest FIFO buffering multiplier chosen by @ref USBD_FifoLayout(). */
+#define USBD_FIFO_MAX_MULTIPLIER  4
+
+/** @brief Declared endpoint traffic, input to @ref USBD_FifoLayout().      */
+typedef struct
+{
+  uint8_t   epAddr;         /**< Endpoint address.                                  */
+  uint16_t  bytesPerFrame;  /**< Peak payload bytes per frame the endpoint must
+                                 sustain.                                           */
+} USBD_EpTraffic_TypeDef;
+
+
 /*** -------------------- DEVICE mode API -------------------------------- ***/
 
 void                USBD_AbortAllTransfers( void );
@@ -772,6 +817,8 @@ int                 USBD_AbortTransfer(     int epAddr );
 void                USBD_Connect(           void );
 void                USBD_Disconnect(        void );
 bool                USBD_EpIsBusy(          int epAddr );
+int                 USBD_FifoLayout(        const USB_DeviceDescriptor_TypeDef *deviceDescriptor, const uint8_t *configDescriptor,
+                                            const USBD_EpTraffic_TypeDef *traffic, int numTraffic, uint8_t *bufferingMultiplier );
 USBD_State_TypeDef  USBD_GetUsbState(       void );
 const char *        USBD_GetUsbStateName(   USBD_State_TypeDef state );
 int                 USBD_Init(              const USBD_Init_TypeDef *p );
@@ -783,6 +830,11 @@ void                USBD_Stop(              void );
 int                 USBD_UnStallEp(         int epAddr );
 int                 USBD_Write(             int epAddr, void *data, int byteCount, USB_XferCompleteCb_TypeDef callback );
 
+#if defined( USB_EP_STATS )
+void                USBD_ClearEpStats(      void );
+int                 USBD_GetEpStats(        int epAddr, USBD_EpStats_TypeDef *stats );
+#endif
+
 /** @} (end addtogroup USB_DEVICE) */
 #endif /* defined( USB_DEVICE ) */
 
@@ -799,6 +851,10 @@ int                 USBD_Write(             int epAddr, void *data, int byteCoun
 #define USB_VBUSOVRCUR_POLARITY_LOW  0        /**< Overcurrent flag pin polarity is low.                */
 #define USB_VBUSOVRCUR_POLARITY_HIGH 1        /**< Overcurrent flag pin polarity is high.               */
 
+#define USBH_HC_ANY                  0xFF     /**< Host channel number which lets the host channel
+                                                   scheduler pick a free channel for each transfer,
+                                                   see @ref USBH_AssignHostChannel().                 */
+
 /** USB HOST endpoint status enumerator. */
 typedef enum
 {
@@ -814,7 +870,7 @@ typedef enum
 /** @brief USB HOST endpoint status data.
  *  @details A host application should not manipulate the contents of
  * this struct.                                                             */
-typedef struct
+typedef struct USBH_Ep_TypeDef
 {
   USB_Setup_TypeDef               setup;          /**< A SETUP package.                                 */
   uint8_t                         setupErrCnt;    /**< Error counter for SETUP transfers.               */
@@ -835,6 +891,8 @@ typedef struct
   uint32_t                        xferred;        /**< Number of bytes transferred.                     */
   uint32_t                        remaining;      /**< Number of bytes remaining.                       */
   uint32_t                        timeout;        /**< Transfer timeout.                                */
+  bool                            hcAny;          /**< Host channel allocated for each transfer.        */
+  struct USBH_Ep_TypeDef          *nextWaiting;   /**< Next endpoint waiting for a free host channel.   */
 } USBH_Ep_TypeDef;
 
 
@@ -881,6 +939,7 @@ typedef struct
 
 /*** -------------------- HOST mode API ---------------------------------- ***/
 
+int     USBH_AllocateAddress(              void );
 int     USBH_AssignHostChannel(            USBH_Ep_TypeDef *ep, uint8_t hcnum );
 int     USBH_ControlMsg(                   USBH_Ep_TypeDef *ep, uint8_t bmRequestType, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint16_t wLength, void *data, int timeout, USB_XferCompleteCb_TypeDef callback );
 int     USBH_ControlMsgB(                  USBH_Ep_TypeDef *ep, uint8_t bmRequestType, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint16_t wLength, void *data, int timeout );
@@ -916,6 +975,7 @@ USB_InterfaceDescriptor_TypeDef*     USBH_QGetInterfaceDescriptor(     const uin
 
 int     USBH_Read(                         USBH_Ep_TypeDef *ep, void *data, int byteCount, int timeout, USB_XferCompleteCb_TypeDef callback );
 int     USBH_ReadB(                        USBH_Ep_TypeDef *ep, void *data, int byteCount, int timeout );
+void    USBH_ReleaseAddress(               uint8_t deviceAddress );
 int     USBH_SetAddressB(                  USBH_Device_TypeDef *device, uint8_t deviceAddress );
 int     USBH_SetAltInterfaceB(             USBH_Device_TypeDef *device, uint8_t interfaceIndex, uint8_t alternateSetting );
 int     USBH_SetConfigurationB(            USBH_Device_TypeDef *device, uint8_t configValue );
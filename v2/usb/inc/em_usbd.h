@@ -103,6 +103,10 @@ __STATIC_INLINE void USBD_ArmEp0( USBD_Ep_TypeDef *ep )
 
 __STATIC_INLINE void USBD_ArmEpN( USBD_Ep_TypeDef *ep )
 {
+#if defined( USB_EP_STATS )
+  ep->statsXferBytes = 0;
+#endif
+
   if ( ep->in )
   {
     USBDHAL_StartEpIn( ep );
@@ -0,0 +1,150 @@
+/***************************************************************************//**
+ * @file em_usbdclass.h
+ * @brief USB protocol stack library, composite device class framework.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifndef __EM_USBDCLASS_H
+#define __EM_USBDCLASS_H
+
+#include "em_usb.h"
+#if defined( USB_DEVICE )
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup USB
+ * @{
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup USB_DEVICE
+ * @{
+ ******************************************************************************/
+
+/** Max number of interfaces in a composite device. Can be overridden in
+ *  usbconfig.h. */
+#if !defined( USBD_CLASS_MAX_INTERFACES )
+#define USBD_CLASS_MAX_INTERFACES   8
+#endif
+
+/** Max number of class functions in a composite device. Can be overridden in
+ *  usbconfig.h. */
+#if !defined( USBD_CLASS_MAX_FUNCTIONS )
+#define USBD_CLASS_MAX_FUNCTIONS    4
+#endif
+
+/** Max number of endpoints used by one class function. */
+#define USBD_CLASS_MAX_EPS          4
+
+/** Marks an unused entry in the framework dispatch tables. */
+#define USBD_CLASS_NONE             0xFF
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+struct USBD_ClassFunction_TypeDef;
+/** @endcond */
+
+/** @brief Class driver operations.
+ *  @details One constant instance of this struct describes a class driver.
+ *  All instances of the class share it, the instance a callback applies to
+ *  is passed in the @p fn parameter. Assign members to NULL if the class
+ *  does not need a specific callback.                                      */
+typedef struct
+{
+  /** Called on setup requests addressed to one of the interfaces or
+   *  endpoints of the function, see @ref USBD_SetupCmdCb_TypeDef for return
+   *  values. */
+  int  (*setupCmd)( struct USBD_ClassFunction_TypeDef *fn,
+                    const USB_Setup_TypeDef *setup );
+
+  /** Called whenever the device change state. */
+  void (*stateChange)( struct USBD_ClassFunction_TypeDef *fn,
+                       USBD_State_TypeDef oldState,
+                       USBD_State_TypeDef newState );
+
+  /** Called at each SOF interrupt. The SOF interrupt is only enabled when
+   *  at least one class driver implements this callback. */
+  void (*sofInt)( struct USBD_ClassFunction_TypeDef *fn, uint16_t sofNr );
+
+  /** Called when the descriptors of the function has been copied into the
+   *  configuration descriptor and interface and endpoint numbers are
+   *  assigned. Lets the class patch interface numbers stored in class
+   *  specific descriptors, e.g. the CDC union functional descriptor. */
+  void (*patchDescriptors)( struct USBD_ClassFunction_TypeDef *fn,
+                            uint8_t *desc, int len );
+} USBD_ClassDriver_TypeDef;
+
+/** @brief A class function (one instance of a class driver) in a composite
+ *  device.
+ *  @details The application owns the struct and fills in the first group of
+ *  members. The second group is assigned by @ref USBD_ClassInit().
+ *
+ *  The descriptor template holds the interface, class specific and endpoint
+ *  descriptors of the function. Interface numbers in the template start at
+ *  0, the endpoint number in endpoint descriptors is ignored and only the
+ *  direction bit is used.                                                  */
+typedef struct USBD_ClassFunction_TypeDef
+{
+  const USBD_ClassDriver_TypeDef  *driver;          /**< Class driver operations.                             */
+  void                            *instance;        /**< Class instance data, owned by the application.       */
+  const uint8_t                   *descriptors;     /**< Descriptor template of the function.                 */
+  uint16_t                        descriptorsLength;/**< Size of the descriptor template.                     */
+  const uint8_t                   *bufferingMultiplier; /**< FIFO buffering multiplier per endpoint, in
+                                                         descriptor order. NULL gives single buffering.        */
+  bool                            deviceRequests;   /**< Offer class and vendor requests addressed to the
+                                                         device to this function.                             */
+
+  uint8_t                         firstInterface;   /**< Number of the first interface of the function.       */
+  uint8_t                         numInterfaces;    /**< Number of interfaces of the function.                */
+  uint8_t                         numEps;           /**< Number of endpoints of the function.                 */
+  uint8_t                         epAddr[ USBD_CLASS_MAX_EPS ]; /**< Assigned endpoint addresses, in
+                                                         descriptor order.                                    */
+  uint16_t                        fifoBytes;        /**< Endpoint FIFO space used by the function.            */
+} USBD_ClassFunction_TypeDef;
+
+/** @brief Composite device initialization structure.
+ *  @details This structure is passed to @ref USBD_ClassInit(). The
+ *  configuration descriptor is assembled in an application owned buffer
+ *  which must stay valid while the device is in use.                       */
+typedef struct
+{
+  const USB_DeviceDescriptor_TypeDef  *deviceDescriptor;  /**< Pointer to a device descriptor.                  */
+  const void * const                  *stringDescriptors; /**< Pointer to an array of string descriptor pointers.*/
+  uint8_t                             numberOfStrings;    /**< Number of strings in string descriptor array.    */
+  uint8_t                             bmAttributes;       /**< Configuration descriptor bmAttributes.           */
+  uint8_t                             bMaxPower;          /**< Configuration descriptor bMaxPower.              */
+  USBD_ClassFunction_TypeDef * const  *functions;         /**< Array of class function pointers.                */
+  uint8_t                             numFunctions;       /**< Number of class functions.                       */
+  uint8_t                             *configBuffer;      /**< Buffer for the configuration descriptor, must be
+                                                               word aligned, see @ref UBUF.                     */
+  uint16_t                            configBufferSize;   /**< Size of the configuration descriptor buffer.     */
+  USBD_DeviceStateChangeCb_TypeDef    usbStateChange;     /**< Optional application state change callback,
+                                                               called after the class drivers.                  */
+} USBD_ClassInit_TypeDef;
+
+/*** -------------------- Composite device API --------------------------- ***/
+
+int                         USBD_ClassInit(         const USBD_ClassInit_TypeDef *p );
+USBD_ClassFunction_TypeDef *USBD_ClassGetFunction(  int interfaceNumber );
+int                         USBD_ClassGetFifoUsage( void );
+
+/** @} (end addtogroup USB_DEVICE) */
+/** @} (end addtogroup USB) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* defined( USB_DEVICE ) */
+#endif /* __EM_USBDCLASS_H */
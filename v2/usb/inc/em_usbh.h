@@ -42,6 +42,9 @@ int USBH_CtlRxRaw( uint8_t pid, USBH_Ep_TypeDef *ep, void *data, int byteCount )
 int USBH_CtlTxRaw( uint8_t pid, USBH_Ep_TypeDef *ep, void *data, int byteCount );
 #endif
 
+void USBH_HcFlushWaiting(  USB_Status_TypeDef reason );
+void USBH_HcScheduleNext(  uint8_t hcnum );
+
 void USBHEP_EpHandler(     USBH_Ep_TypeDef *ep, USB_Status_TypeDef result );
 void USBHEP_CtrlEpHandler( USBH_Ep_TypeDef *ep, USB_Status_TypeDef result );
 void USBHEP_TransferDone(  USBH_Ep_TypeDef *ep, USB_Status_TypeDef result );
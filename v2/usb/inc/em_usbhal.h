@@ -255,6 +255,7 @@ __STATIC_INLINE void USBDHAL_DeactivateEp( USBD_Ep_TypeDef *ep )
 
 __STATIC_INLINE void USBDHAL_EnableInts( USBD_Device_TypeDef *dev )
 {
+  int i;
   uint32_t mask;
 
   /* Disable all interrupts. */
@@ -275,6 +276,19 @@ __STATIC_INLINE void USBDHAL_EnableInts( USBD_Device_TypeDef *dev )
     mask |= USB_GINTMSK_SOFMSK;
   }
 
+#if defined( USB_EP_STATS )
+  mask |= USB_GINTMSK_SOFMSK;       /* Count frames for the statistics. */
+#endif
+
+  for ( i = 1; i <= NUM_EP_USED; i++ )
+  {
+    if ( dev->ep[ i ].type == USB_EPTYPE_ISOC )
+    {
+      mask |= USB_GINTMSK_INCOMPISOINMSK | USB_GINTMSK_INCOMPLPMSK;
+      break;
+    }
+  }
+
   USB->GINTMSK = mask;
 }
 
@@ -498,9 +512,21 @@ __STATIC_INLINE void USBDHAL_StartEp0Setup( USBD_Device_TypeDef *dev )
                   | dev->ep0MpsCode;
 }
 
+/*
+ * Return the DEPCTL command bit which schedules an isochronous endpoint for
+ * the frame following the current one (SOFFN holds the current frame).
+ */
+__STATIC_INLINE uint32_t USBDHAL_GetIsocFrameParity( void )
+{
+  if ( USB->DSTS & ( 1 << _USB_DSTS_SOFFN_SHIFT ) )
+    return USB_DIEP_CTL_SETD0PIDEF;
+
+  return USB_DIEP_CTL_SETD1PIDOF;
+}
+
 __STATIC_INLINE void USBDHAL_StartEpIn( USBD_Ep_TypeDef *ep )
 {
-  uint32_t pktcnt, xfersize;
+  uint32_t pktcnt, xfersize, parity;
 
   if ( ep->remaining == 0 )     /* ZLP ? */
   {
@@ -513,6 +539,17 @@ __STATIC_INLINE void USBDHAL_StartEpIn( USBD_Ep_TypeDef *ep )
     xfersize = ep->remaining;
   }
 
+  if ( ep->type == USB_EPTYPE_ISOC )
+  {
+    /* One packet per frame, scheduled for the next frame. */
+    parity = USBDHAL_GetIsocFrameParity();
+    pktcnt |= 1 << ( _USB_DIEP_TSIZ_MC_SHIFT - _USB_DIEP_TSIZ_PKTCNT_SHIFT );
+  }
+  else
+  {
+    parity = 0;
+  }
+
   USB_DINEPS[ ep->num ].TSIZ =
                 ( USB_DINEPS[ ep->num ].TSIZ                &
                   ~DIEP_XFERSIZE_PKTCNT_MASK                  ) |
@@ -522,13 +559,14 @@ __STATIC_INLINE void USBDHAL_StartEpIn( USBD_Ep_TypeDef *ep )
   USB_DINEPS[ ep->num ].DMAADDR = (uint32_t)ep->buf;
   USB_DINEPS[ ep->num ].CTL =
                   ( USB_DINEPS[ ep->num ].CTL & ~DEPCTL_WO_BITMASK ) |
+                  parity                                             |
                   USB_DIEP_CTL_CNAK                                  |
                   USB_DIEP_CTL_EPENA;
 }
 
 __STATIC_INLINE void USBDHAL_StartEpOut( USBD_Ep_TypeDef *ep )
 {
-  uint32_t pktcnt, xfersize;
+  uint32_t pktcnt, xfersize, parity;
 
   if ( ep->remaining == 0 )     /* ZLP ? */
   {
@@ -547,11 +585,18 @@ __STATIC_INLINE void USBDHAL_StartEpOut( USBD_Ep_TypeDef *ep )
                   ( xfersize << _USB_DOEP_TSIZ_XFERSIZE_SHIFT   ) |
                   ( pktcnt   << _USB_DOEP_TSIZ_PKTCNT_SHIFT     );
 
+  parity = 0;
+  if ( ep->type == USB_EPTYPE_ISOC )
+  {
+    parity = USBDHAL_GetIsocFrameParity();
+  }
+
   ep->hwXferSize = xfersize;
   USB_DOUTEPS[ ep->num ].DMAADDR = (uint32_t)ep->buf;
   USB_DOUTEPS[ ep->num ].CTL =
                           ( USB_DOUTEPS[ ep->num ].CTL  &
                             ~DEPCTL_WO_BITMASK             ) |
+                          parity                             |
                           USB_DOEP_CTL_CNAK                  |
                           USB_DOEP_CTL_EPENA;
 }
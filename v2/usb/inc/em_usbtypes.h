@@ -145,6 +145,11 @@ typedef struct
   uint32_t                    fifoSize;
   USBD_EpState_TypeDef        state;
   USB_XferCompleteCb_TypeDef  xferCompleteCb;
+#if defined( USB_EP_STATS )
+  USBD_EpStats_TypeDef        stats;
+  uint32_t                    statsXferBytes;
+  uint32_t                    statsFrameBytes;
+#endif
 } USBD_Ep_TypeDef;
 
 typedef struct
@@ -166,7 +171,36 @@ typedef struct
   uint8_t                               inEpAddr2EpIndex[  MAX_USB_EP_NUM + 1 ];
   uint8_t                               outEpAddr2EpIndex[ MAX_USB_EP_NUM + 1 ];
   uint32_t                              ep0MpsCode;
+#if defined( USB_EP_STATS )
+  uint32_t                              statsFrames;
+#endif
 } USBD_Device_TypeDef;
+
+/* FIFO RAM words used by an endpoint, see USBD_Init() and USBDHAL_CoreInit().
+ * Each Tx FIFO is at least MIN_EP_FIFO_SIZE_INWORDS deep, OUT endpoints
+ * share the Rx FIFO and store a status word with each packet. */
+__STATIC_INLINE int USBD_EpFifoWords( bool in, int packetSize,
+                                      int bufferingMultiplier )
+{
+  int words = ( packetSize + 3 ) / 4;
+
+  if ( in )
+    return EFM32_MAX( words * bufferingMultiplier,
+                      (int)MIN_EP_FIFO_SIZE_INWORDS );
+
+  return ( words + 1 ) * bufferingMultiplier;
+}
+
+/* FIFO RAM words used by EP0 and the Rx FIFO overhead.
+ * Rx-FIFO overhead: SETUP packets : 4*n + 6    n=#CTRL EP's
+ *                   GOTNAK        : 1
+ *                   Status info   : 2*n        n=#OUT EP's (EP0 included) */
+__STATIC_INLINE int USBD_Ep0FifoWords( int packetSize )
+{
+  return USBD_EpFifoWords( true,  packetSize, 1 )
+         + USBD_EpFifoWords( false, packetSize, 1 )
+         + 10 + 1 + ( 2 * ( MAX_NUM_OUT_EPS + 1 ) );
+}
 #endif /* defined( USB_DEVICE ) */
 
 #if defined( USB_HOST )
@@ -194,6 +228,7 @@ typedef struct
   uint32_t                hwXferSize;
   uint8_t                 status;
   bool                    idle;
+  bool                    reserved;
   USBH_Ep_TypeDef         *ep;
 } USBH_Hc_TypeDef;
 #endif /* defined( USB_HOST ) */
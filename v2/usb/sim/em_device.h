@@ -0,0 +1,81 @@
+/***************************************************************************//**
+ * @file em_device.h
+ * @brief USB core simulation, host (Linux) replacement for em_device.h.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/*
+ * This header must be found before the device specific em_device.h when the
+ * USB stack is compiled for the host. It pulls in the real part definition,
+ * and then redirects the peripheral base pointers used by the USB stack to
+ * RAM images owned by the USB core model in em_usbsim.c.
+ */
+
+#if !defined( __EM_DEVICE_SIM_H )
+#define __EM_DEVICE_SIM_H
+
+#if !defined( USB_SIM )
+#define USB_SIM
+#endif
+
+/* When included from this directory with "", the search for the next     */
+/* em_device.h may find this file once more, the pass flag skips it.       */
+#define __EM_DEVICE_SIM_PASS
+#include_next "em_device.h"
+#undef  __EM_DEVICE_SIM_PASS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+extern USB_TypeDef  USBSIM_usbRegs;
+extern CMU_TypeDef  USBSIM_cmuRegs;
+extern GPIO_TypeDef USBSIM_gpioRegs;
+
+#undef  USB
+#define USB   ( &USBSIM_usbRegs  )
+#undef  CMU
+#define CMU   ( &USBSIM_cmuRegs  )
+#undef  GPIO
+#define GPIO  ( &USBSIM_gpioRegs )
+
+void USBSIM_NvicClearPendingIRQ( IRQn_Type irq );
+void USBSIM_NvicDisableIRQ(      IRQn_Type irq );
+void USBSIM_NvicEnableIRQ(       IRQn_Type irq );
+
+/* The NVIC inline functions in core_cmX.h access the System Control Space  */
+/* directly, route the calls made by the USB stack to the model instead.   */
+#define NVIC_ClearPendingIRQ( irq ) USBSIM_NvicClearPendingIRQ( irq )
+#define NVIC_DisableIRQ( irq )      USBSIM_NvicDisableIRQ( irq )
+#define NVIC_EnableIRQ( irq )       USBSIM_NvicEnableIRQ( irq )
+
+/* The byte reverse intrinsics in core_cmInstr.h are ARM assembly, the mass */
+/* storage class drivers use them for SCSI big endian fields.               */
+#define __REV( v )    __builtin_bswap32( v )
+#define __REV16( v )  ( ( ( (uint32_t)( v ) & 0xFF00FF00UL ) >> 8 ) | \
+                        ( ( (uint32_t)( v ) & 0x00FF00FFUL ) << 8 ) )
+
+/* The sleep instruction is ARM assembly too. Example main loops which wait */
+/* in EM1 are built into the test programs, they are not run.               */
+#define __WFI()       ( (void)0 )
+
+/** @endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#elif defined( __EM_DEVICE_SIM_PASS )
+#include_next "em_device.h"
+#endif /* __EM_DEVICE_SIM_H */
@@ -0,0 +1,51 @@
+/***************************************************************************//**
+ * @file em_int.h
+ * @brief USB core simulation, host (Linux) replacement for em_int.h.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifndef __EM_INT_H
+#define __EM_INT_H
+
+#include "em_device.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+uint32_t USBSIM_IntDisable( void );
+uint32_t USBSIM_IntEnable(  void );
+
+/*
+ * On the host there is no PRIMASK. The model serializes the USB and timer
+ * "interrupt handlers" against code running with interrupts disabled by
+ * means of a recursive lock, with the same nesting semantics as em_int.h.
+ */
+__STATIC_INLINE uint32_t INT_Disable( void )
+{
+  return USBSIM_IntDisable();
+}
+
+__STATIC_INLINE uint32_t INT_Enable( void )
+{
+  return USBSIM_IntEnable();
+}
+
+/** @endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EM_INT_H */
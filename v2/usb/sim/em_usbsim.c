@@ -0,0 +1,2649 @@
+/***************************************************************************//**
+ * @file em_usbsim.c
+ * @brief USB core simulation, host side model of the EFM32 USB OTG core.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "em_device.h"
+#include "em_usb.h"
+#if defined( USB_DEVICE ) || defined( USB_HOST )
+
+#include "em_cmu.h"
+#include "em_gpio.h"
+#include "em_usbtypes.h"
+#include "em_usbhal.h"
+#include "em_usbsim.h"
+
+/***************************************************************************//**
+ * @addtogroup USB
+ * @{
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup USB_SIM
+ * @{
+ ******************************************************************************/
+
+/**************************************************************************//**
+ * @page usb_sim USB core simulation
+ *
+ * @section usb_sim_intro Introduction
+ *
+ * The files in usb/sim lets the USB device and host stack, and applications
+ * built on top of it, be compiled and run on a Linux host. The USB OTG core
+ * registers are modelled in RAM, and a scripted "other end of the cable" is
+ * provided by the model. This makes it possible to unit test class drivers
+ * and to measure stack overhead (interrupt count, time spent in the
+ * interrupt handler, NAK rates, throughput per endpoint) without hardware.
+ *
+ * The model implements the core in buffer DMA mode, which is the mode used
+ * by the stack. Timing is based on 1 ms full speed frames with a byte budget
+ * of @ref USBSIM_FRAME_BYTES per frame, so throughput figures are bus limited
+ * in the same way as on a real full speed bus.
+ *
+ * In device mode the occupancy of the Rx FIFO and the Tx FIFO's is modelled
+ * with the depths programmed by the stack. The DMA moves data between the
+ * DMAADDR buffers and the FIFO's at the rate set by @ref USBSIM_SetDmaRate()
+ * (unlimited by default), and bulk and interrupt tokens the FIFO's cannot
+ * serve are NAK'ed and counted in USBSIM_Stats_TypeDef::fifoNaks.
+ * Isochronous endpoints bypass the FIFO model. In host mode data is moved
+ * directly between the DMAADDR buffers and the scripted device.
+ *
+ * @section usb_sim_build Building
+ *
+ * Compile the stack sources (except em_usbtimer.c, which is replaced by the
+ * model), em_usbsim.c and the application with usb/sim first in the include
+ * path, so that the em_device.h and em_int.h versions in that directory are
+ * picked up. A device mode build:
+ *
+ * @verbatim
+gcc -O2 -no-pie -DEFM32GG990F1024 -DDEBUG_EFM_USER \
+    -Iusb/sim -Iapp -Iusb/inc -Iemlib/inc \
+    -IDevice/SiliconLabs/EFM32GG/Include -ICMSIS/Include \
+    usb/src/em_usbd.c usb/src/em_usbdch9.c usb/src/em_usbdep.c \
+    usb/src/em_usbdint.c usb/src/em_usbhal.c \
+    usb/sim/em_usbsim.c app/test.c -o test -lpthread @endverbatim
+ *
+ * A host mode build takes usb/src/em_usbh.c, em_usbhep.c, em_usbhint.c and
+ * em_usbhal.c instead of the device sources.
+ *
+ * The DMAADDR registers are 32 bit wide. Build a non position independent
+ * executable and place transfer buffers in static storage (as the stack
+ * already requires) so that the buffer addresses fit in 32 bits. Class
+ * drivers which pass stack buffers to the stack, such as msdh.c and hubh.c,
+ * must run on a stack in static storage, see USBSIMTEST_RunOnStaticStack()
+ * in usb/sim/test.
+ * USB_PWRSAVE_MODE must be left undefined or set to USB_PWRSAVE_MODE_OFF.
+ *
+ * @section usb_sim_device Device mode
+ *
+ * The model acts as a host. A test case typically does:
+ *
+ * @verbatim
+USBSIM_Init();
+USBD_Init( &usbInitStruct );
+USBSIM_VbusSet( true );
+USBSIM_HostEnumerate( 1, 1, 1000 );
+
+USBSIM_ClearStats();
+t0 = USBSIM_GetTimeUs();
+for ( i = 0; i < 1000; i++ )
+  USBSIM_HostOut( BULK_OUT_EP, buf, 512, 100 );
+USBSIM_GetStats( &stats );
+printf( "%u bytes/ms, %u irqs, %llu ns in ISR\n", ... ); @endverbatim
+ *
+ * Scripted host transactions execute in the context of the calling thread,
+ * and the USB interrupt handler is called after each transaction when an
+ * interrupt is pending, just as on hardware.
+ *
+ * @section usb_sim_host Host mode
+ *
+ * The model acts as a device, described by a @ref USBSIM_Device_TypeDef.
+ * Standard requests are answered from the descriptors unless the setup
+ * callback handles them. Host channels are serviced by a model thread once
+ * per frame, interrupt channels honour the ODDFRM bit. Frames advance while
+ * a host channel or a USBTIMER timer is active, so the blocking host API
+ * calls progress and time out in simulated time.
+ *
+ * @verbatim
+USBSIM_Init();
+USBH_Init( &is );
+USBSIM_DeviceAttach( &myDevice );
+USBH_WaitForDeviceConnectionB( tmpBuf, 5 );
+USBH_QueryDeviceB( tmpBuf, sizeof( tmpBuf ), USBH_GetPortSpeed() ); @endverbatim
+ *
+ * @ref USBSIM_HubAttach() puts the hub model on the port instead. Scripted
+ * devices are plugged into its ports with @ref USBSIM_HubPortAttach() and
+ * removed with @ref USBSIM_HubPortDetach(), at any time. As on a real hub, a
+ * downstream device is reachable when its port has been powered and reset
+ * by the host.
+ *
+ * @section usb_sim_int Interrupts and timers
+ *
+ * INT_Disable()/INT_Enable() take a recursive lock which is also held while
+ * USB_IRQHandler() and USBTIMER callbacks execute, so the critical sections
+ * of the stack keep their meaning. The USBTIMER API is implemented by the
+ * model and runs on simulated time: USBTIMER_DelayMs() advances the frame
+ * clock instead of sleeping. Expired timers and the SOF interrupt of a frame
+ * are serviced before the transactions of that frame. The incomplete
+ * isochronous IN and OUT interrupts are serviced at the end of the frame the
+ * host did not poll, before the frame number in DSTS advances, as on the core
+ * where they are raised at the end of the periodic frame.
+ *
+ * @section usb_sim_test Test programs
+ *
+ * usb/sim/test holds scripted tests of the class drivers and examples:
+ * hidkbd_test.c, cdc_test.c, msdd_test.c and uacd_test.c in device mode,
+ * msdh_test.c and hubh_test.c in host mode. They print enumeration time,
+ * interrupt counts, NAK counts and throughput. uacd_test.c streams audio on
+ * isochronous endpoints, one packet per frame, and checks the sample rate
+ * feedback value. fifo_test.c checks the endpoint FIFO RAM
+ * accounting of the device stack and USBD_FifoLayout() against the FIFO size
+ * registers. The build command is given at the top of each file, and the
+ * exit code is the number of failed checks.
+ *
+ ******************************************************************************/
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+#define EP_CNT          ( MAX_NUM_IN_EPS + 1 )
+
+#define FL_GINTSTS      0
+#define FL_GOTGINT      1
+#define FL_DIEP0        2
+#define FL_DOEP0        ( FL_DIEP0 + EP_CNT )
+#define FL_HC0          ( FL_DOEP0 + EP_CNT )
+#define FL_COUNT        ( FL_HC0 + MAX_NUM_HOSTCHANNELS )
+
+#define GINTSTS_SUMMARY ( USB_GINTSTS_IEPINT | USB_GINTSTS_OEPINT | \
+                          USB_GINTSTS_HCHINT | USB_GINTSTS_PRTINT )
+#define HPRT_RO_MASK    ( USB_HPRT_PRTCONNSTS     | USB_HPRT_PRTOVRCURRACT | \
+                          _USB_HPRT_PRTLNSTS_MASK | _USB_HPRT_PRTSPD_MASK  )
+#define HPRT_CHG_MASK   ( USB_HPRT_PRTCONNDET | USB_HPRT_PRTENCHNG | \
+                          USB_HPRT_PRTOVRCURRCHNG )
+#define GRSTCTL_CMDS    ( USB_GRSTCTL_CSFTRST | USB_GRSTCTL_RXFFLSH | \
+                          USB_GRSTCTL_TXFFLSH | USB_GRSTCTL_FRMCNTRRST )
+
+#define XACT_SETUP      0
+#define XACT_IN         1
+#define XACT_OUT        2
+
+#define DMAPTR( a )     ( (uint8_t*)(uintptr_t)( a ) )
+#define RWREG( r )      ( *(volatile uint32_t*)&( r ) )
+
+typedef struct
+{
+  volatile uint32_t *reg;       /* Register image written by the stack.      */
+  uint32_t          pub;        /* Value last published by the model.        */
+  uint32_t          sentinel;   /* Reserved bit always set in published data. */
+} SimFlags_TypeDef;
+
+USB_TypeDef   USBSIM_usbRegs;
+CMU_TypeDef   USBSIM_cmuRegs;
+GPIO_TypeDef  USBSIM_gpioRegs;
+
+extern void USB_IRQHandler( void );
+
+static SimFlags_TypeDef flags[ FL_COUNT ];
+static uint32_t         hprtPub;
+
+static pthread_mutex_t  hwLock    = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   frameCond = PTHREAD_COND_INITIALIZER;
+static pthread_mutex_t  cpuLock;
+static __thread int     cpuLockCnt;
+static __thread bool    inHandler;
+
+static pthread_t        fabricThread, busThread;
+static volatile bool    running;
+static bool             usbIrqEnabled;
+static bool             freeRun;
+static uint64_t         demandUs;
+static uint64_t         simTimeUs;
+static uint32_t         frameNum;
+static int              frameBudget;
+static bool             frameStarting;            /* Frame start work pending.   */
+static USBSIM_Stats_TypeDef stats;
+
+#if ( NUM_QTIMERS > 0 )
+typedef struct
+{
+  bool                      running;
+  uint32_t                  expires;
+  USBTIMER_Callback_TypeDef callback;
+} SimTimer_TypeDef;
+
+static SimTimer_TypeDef timers[ NUM_QTIMERS ];
+#endif
+static uint32_t         msTicks, msTicksServiced;
+
+#if defined( USB_DEVICE )
+static bool             vbusOn;
+static bool             enumerated;
+static uint8_t          hostDevAddr;
+static uint8_t          hostCtrlBuf[ 512 ];
+
+/* FIFO occupancy, see DmaService(). */
+static uint32_t         dmaRate;                  /* Bytes per frame, 0 = unlimited. */
+static uint64_t         dmaCredit;                /* In 1/USBSIM_FRAME_BYTES bytes.  */
+static int              txFifoFill[ EP_CNT ];     /* Bytes loaded per IN endpoint.   */
+static int              txFifoBusy[ EP_CNT ];     /* Packet being sent.              */
+static int              rxFifoFill;               /* Bytes not yet moved to memory.  */
+static int              rxFifoBusy;               /* Packet being received.          */
+
+static void FifoFlush(  uint32_t grstctl );
+static void DmaAdvance( int busBytes );
+#endif
+
+#if defined( USB_HOST )
+typedef struct
+{
+  const USBSIM_Device_TypeDef *dev;
+  bool                        attached;
+  uint8_t                     addr;
+  uint8_t                     pendingAddr;
+  USB_Setup_TypeDef           setup;
+  bool                        stall;
+  int                         len;
+  int                         pos;
+  uint8_t                     buf[ 1024 ];
+} SimDev_TypeDef;
+
+static SimDev_TypeDef   sdev;             /* Device on the root port.     */
+
+static struct
+{
+  bool              present;              /* The root port device is a hub. */
+  int               numPorts;
+  uint16_t          status[ USBSIM_HUB_MAX_PORTS ];
+  uint16_t          change[ USBSIM_HUB_MAX_PORTS ];
+  SimDev_TypeDef    port[   USBSIM_HUB_MAX_PORTS ];
+} hub;
+
+static void HubReset( void );
+#endif
+
+/*
+ * Interrupt flag registers are write-one-to-clear. The model keeps the value
+ * it last published, any difference to the register image is the result of
+ * a write by the stack. A reserved bit is kept set in the published value so
+ * that writing back exactly the flags that are set is also detected. Model
+ * updates are done with compare and swap so that a concurrent clear from the
+ * stack is never lost.
+ */
+static void FlagsSync( SimFlags_TypeDef *f )
+{
+  uint32_t cur, next;
+
+  for (;;)
+  {
+    cur = *f->reg;
+    if ( cur == f->pub )
+      return;
+
+    next = ( f->pub & ~cur ) | f->sentinel;
+    if ( __sync_bool_compare_and_swap( (uint32_t*)f->reg, cur, next ) )
+    {
+      f->pub = next;
+      return;
+    }
+  }
+}
+
+static void FlagsUpdate( SimFlags_TypeDef *f, uint32_t mask, uint32_t bits )
+{
+  uint32_t next;
+
+  for (;;)
+  {
+    FlagsSync( f );
+    next = ( f->pub & ~mask ) | bits;
+    if ( next == f->pub )
+      return;
+
+    if ( __sync_bool_compare_and_swap( (uint32_t*)f->reg, f->pub, next ) )
+    {
+      f->pub = next;
+      return;
+    }
+  }
+}
+
+static void FlagsSet( SimFlags_TypeDef *f, uint32_t bits )
+{
+  FlagsUpdate( f, bits, bits );
+}
+
+static uint32_t FlagsGet( int i )
+{
+  return flags[ i ].pub & ~flags[ i ].sentinel;
+}
+
+static void FlagsReset( void )
+{
+  int i;
+
+  for ( i = 0; i < FL_COUNT; i++ )
+  {
+    *flags[ i ].reg = flags[ i ].sentinel;
+    flags[ i ].pub  = flags[ i ].sentinel;
+  }
+}
+
+static void RegUpdate( volatile uint32_t *reg, uint32_t clr, uint32_t set )
+{
+  uint32_t cur;
+
+  do
+  {
+    cur = *reg;
+  } while ( !__sync_bool_compare_and_swap( (uint32_t*)reg, cur,
+                                           ( cur & ~clr ) | set ) );
+}
+
+/* HPRT holds read only, write-one-to-clear and plain read/write bits. */
+static void HprtService( uint32_t clr, uint32_t set )
+{
+  uint32_t cur, next, written;
+
+  for (;;)
+  {
+    cur  = USB->HPRT;
+    next = hprtPub;
+
+    if ( cur != hprtPub )
+    {
+      written = cur & ~( HPRT_RO_MASK | HPRT_WC_MASK );
+      next    = ( hprtPub & ( HPRT_RO_MASK | HPRT_WC_MASK ) ) | written;
+      next   &= ~( cur & HPRT_WC_MASK );
+
+      if ( ( written & USB_HPRT_PRTPWR ) && !( hprtPub & USB_HPRT_PRTPWR ) )
+      {
+#if defined( USB_HOST )
+        if ( sdev.attached )
+        {
+          next |= USB_HPRT_PRTCONNSTS | USB_HPRT_PRTCONNDET |
+                  ( sdev.dev->lowSpeed ? HPRT_L_SPEED : HPRT_F_SPEED );
+        }
+#endif
+      }
+      else if ( !( written & USB_HPRT_PRTPWR ) && ( hprtPub & USB_HPRT_PRTPWR ) )
+      {
+        next &= ~( USB_HPRT_PRTCONNSTS | USB_HPRT_PRTENA );
+      }
+
+      if ( !( written & USB_HPRT_PRTRST ) && ( hprtPub & USB_HPRT_PRTRST ) &&
+           ( next & USB_HPRT_PRTCONNSTS ) )
+      {
+        /* End of port reset, the port is enabled. */
+        next |= USB_HPRT_PRTENA | USB_HPRT_PRTENCHNG;
+#if defined( USB_HOST )
+        sdev.addr = 0;
+        sdev.stall = false;
+        HubReset();
+#endif
+      }
+    }
+
+    next = ( next & ~clr ) | set;
+
+    if ( __sync_bool_compare_and_swap( (uint32_t*)&USB->HPRT, cur, next ) )
+    {
+      hprtPub = next;
+      return;
+    }
+  }
+}
+
+static void CoreSoftReset( void )
+{
+  FlagsReset();
+  RWREG( USB->DAINT ) = 0;
+  RWREG( USB->HAINT ) = 0;
+}
+
+static void EpCtlService( volatile uint32_t *ctl, SimFlags_TypeDef *f, bool in )
+{
+  uint32_t cur, next;
+
+  for (;;)
+  {
+    cur = *ctl;
+    if ( !( cur & ( DEPCTL_WO_BITMASK | USB_DIEP_CTL_EPDIS ) ) )
+      return;
+
+    next = cur & ~DEPCTL_WO_BITMASK;
+    if ( cur & USB_DIEP_CTL_SNAK )
+      next |= USB_DIEP_CTL_NAKSTS;
+    if ( cur & USB_DIEP_CTL_CNAK )
+      next &= ~USB_DIEP_CTL_NAKSTS;
+    if ( cur & USB_DIEP_CTL_SETD0PIDEF )
+      next &= ~USB_DIEP_CTL_DPIDEOF;
+    if ( cur & USB_DIEP_CTL_SETD1PIDOF )
+      next |= USB_DIEP_CTL_DPIDEOF;
+    if ( cur & USB_DIEP_CTL_EPDIS )
+      next &= ~( USB_DIEP_CTL_EPDIS | USB_DIEP_CTL_EPENA );
+
+    if ( __sync_bool_compare_and_swap( (uint32_t*)ctl, cur, next ) )
+    {
+      if ( in && ( cur & USB_DIEP_CTL_SNAK ) )
+        FlagsSet( f, USB_DIEP_INT_INEPNAKEFF );
+      if ( ( cur & USB_DIEP_CTL_EPDIS ) && ( cur & USB_DIEP_CTL_EPENA ) )
+        FlagsSet( f, USB_DIEP_INT_EPDISBLD );
+      return;
+    }
+  }
+}
+
+static void UpdateSummary( void )
+{
+  int i;
+  uint32_t daint = 0, haint = 0, summary = 0;
+
+  for ( i = 0; i < EP_CNT; i++ )
+  {
+    if ( FlagsGet( FL_DIEP0 + i ) & USB->DIEPMSK )
+      daint |= 1 << i;
+    if ( FlagsGet( FL_DOEP0 + i ) & USB->DOEPMSK )
+      daint |= 1 << ( i + _USB_DAINT_OUTEPINT0_SHIFT );
+  }
+  for ( i = 0; i < MAX_NUM_HOSTCHANNELS; i++ )
+  {
+    if ( FlagsGet( FL_HC0 + i ) & USB->HC[ i ].INTMSK )
+      haint |= 1 << i;
+  }
+  RWREG( USB->DAINT ) = daint;
+  RWREG( USB->HAINT ) = haint;
+
+  daint &= USB->DAINTMSK;
+  if ( daint & 0x0000FFFF )
+    summary |= USB_GINTSTS_IEPINT;
+  if ( daint & 0xFFFF0000 )
+    summary |= USB_GINTSTS_OEPINT;
+  if ( haint & USB->HAINTMSK )
+    summary |= USB_GINTSTS_HCHINT;
+  if ( hprtPub & HPRT_CHG_MASK )
+    summary |= USB_GINTSTS_PRTINT;
+
+  FlagsUpdate( &flags[ FL_GINTSTS ], GINTSTS_SUMMARY, summary );
+}
+
+/* Apply the immediate side effects of register writes. Called with hwLock. */
+static void ServiceRegisters( void )
+{
+  int i;
+  uint32_t v;
+
+  v = USB->GRSTCTL;
+  if ( ( v & GRSTCTL_CMDS ) || !( v & USB_GRSTCTL_AHBIDLE ) )
+  {
+    if ( v & USB_GRSTCTL_CSFTRST )
+      CoreSoftReset();
+#if defined( USB_DEVICE )
+    FifoFlush( v );
+#endif
+    RegUpdate( &USB->GRSTCTL, GRSTCTL_CMDS, USB_GRSTCTL_AHBIDLE );
+  }
+
+  for ( i = 0; i < FL_COUNT; i++ )
+    FlagsSync( &flags[ i ] );
+
+  v = USB->IFS;
+  if ( v )
+  {
+    USB->IFS = 0;
+    RWREG( USB->IF ) |= v;
+  }
+  v = USB->IFC;
+  if ( v )
+  {
+    USB->IFC = 0;
+    RWREG( USB->IF ) &= ~v;
+  }
+
+  v = USB->DCTL;
+  if ( v & DCTL_WO_BITMASK )
+  {
+    RegUpdate( &USB->DCTL, DCTL_WO_BITMASK, 0 );
+    if ( v & USB_DCTL_SGOUTNAK )
+    {
+      RegUpdate( &USB->DCTL, 0, USB_DCTL_GOUTNAKSTS );
+      FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_GOUTNAKEFF );
+    }
+    if ( v & USB_DCTL_CGOUTNAK )
+    {
+      RegUpdate( &USB->DCTL, USB_DCTL_GOUTNAKSTS, 0 );
+      FlagsUpdate( &flags[ FL_GINTSTS ], USB_GINTSTS_GOUTNAKEFF, 0 );
+    }
+    if ( v & USB_DCTL_SGNPINNAK )
+    {
+      RegUpdate( &USB->DCTL, 0, USB_DCTL_GNPINNAKSTS );
+      FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_GINNAKEFF );
+    }
+    if ( v & USB_DCTL_CGNPINNAK )
+    {
+      RegUpdate( &USB->DCTL, USB_DCTL_GNPINNAKSTS, 0 );
+      FlagsUpdate( &flags[ FL_GINTSTS ], USB_GINTSTS_GINNAKEFF, 0 );
+    }
+  }
+
+  for ( i = 0; i < EP_CNT; i++ )
+  {
+    EpCtlService( &USB_DINEPS[ i ].CTL,  &flags[ FL_DIEP0 + i ], true  );
+    EpCtlService( &USB_DOUTEPS[ i ].CTL, &flags[ FL_DOEP0 + i ], false );
+  }
+
+  for ( i = 0; i < MAX_NUM_HOSTCHANNELS; i++ )
+  {
+    v = USB->HC[ i ].CHAR;
+    if ( v & USB_HC_CHAR_CHDIS )
+    {
+      RegUpdate( &USB->HC[ i ].CHAR, USB_HC_CHAR_CHDIS | USB_HC_CHAR_CHENA, 0 );
+      if ( v & USB_HC_CHAR_CHENA )
+        FlagsSet( &flags[ FL_HC0 + i ], USB_HC_INT_CHHLTD );
+    }
+  }
+
+  HprtService( 0, 0 );
+  UpdateSummary();
+}
+
+static bool IrqPending( void )
+{
+  if ( !usbIrqEnabled )
+    return false;
+
+  if ( ( USB->GAHBCFG & USB_GAHBCFG_GLBLINTRMSK ) &&
+       ( FlagsGet( FL_GINTSTS ) & USB->GINTMSK ) )
+    return true;
+
+  return ( USB->IF & USB->IEN ) != 0;
+}
+
+static bool CpuTryEnter( void )
+{
+  if ( cpuLockCnt || inHandler )
+    return false;
+
+  if ( pthread_mutex_trylock( &cpuLock ) )
+    return false;
+
+  cpuLockCnt++;
+  return true;
+}
+
+static void CpuLeave( void )
+{
+  cpuLockCnt--;
+  pthread_mutex_unlock( &cpuLock );
+}
+
+static uint64_t HostNs( void )
+{
+  struct timespec ts;
+
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Run the USB interrupt handler for as long as an interrupt is pending.
+ * When another thread (the application main loop) is inside a critical
+ * section, the scripted host waits for it to end before it goes on, the
+ * interrupt would be taken right after it on hardware. Letting the bus run
+ * on instead would make the NAK count and the throughput figures depend on
+ * how the host OS schedules the threads. The bus thread does not wait, the
+ * application may be waiting for a frame.
+ */
+static void DeliverIrq( void )
+{
+  bool pending;
+  uint64_t t0;
+
+  for (;;)
+  {
+    pthread_mutex_lock( &hwLock );
+    ServiceRegisters();
+    pending = IrqPending();
+    pthread_mutex_unlock( &hwLock );
+
+    if ( !pending )
+      return;
+
+    if ( !CpuTryEnter() )
+    {
+      if ( cpuLockCnt || inHandler ||
+           pthread_equal( pthread_self(), busThread ) )
+      {
+        return;
+      }
+      sched_yield();
+      continue;
+    }
+
+    inHandler = true;
+    t0 = HostNs();
+    USB_IRQHandler();
+    stats.irqTimeNs += HostNs() - t0;
+    stats.irqCount++;
+    inHandler = false;
+
+    CpuLeave();
+  }
+}
+
+static void TimerService( void )
+{
+#if ( NUM_QTIMERS > 0 )
+  int i;
+  USBTIMER_Callback_TypeDef cb;
+#endif
+
+  if ( msTicksServiced == msTicks || !CpuTryEnter() )
+    return;
+
+  inHandler = true;
+  while ( msTicksServiced != msTicks )
+  {
+    msTicksServiced++;
+    stats.timerTicks++;
+#if ( NUM_QTIMERS > 0 )
+    for ( i = 0; i < NUM_QTIMERS; i++ )
+    {
+      if ( timers[ i ].running &&
+           ( (int32_t)( msTicksServiced - timers[ i ].expires ) >= 0 ) )
+      {
+        timers[ i ].running = false;
+        cb = timers[ i ].callback;
+        if ( cb )
+          cb();
+      }
+    }
+#endif
+  }
+  inHandler = false;
+
+  CpuLeave();
+}
+
+#if defined( USB_HOST )
+/*
+ * Hub model. The hub is a scripted device on the root port with its class
+ * requests and status change endpoint implemented here. Devices on enabled
+ * hub ports share the bus with the hub and are found by their address.
+ */
+#define HUB_PS_CONNECTION     0x0001
+#define HUB_PS_ENABLE         0x0002
+#define HUB_PS_SUSPEND        0x0004
+#define HUB_PS_OVER_CURRENT   0x0008
+#define HUB_PS_POWER          0x0100
+#define HUB_PS_LOW_SPEED      0x0200
+
+/* Port status change bit for a C_PORT_xxx feature selector. */
+#define HUB_PC( feature )     ( 1 << ( ( feature ) - HUB_FEATURE_C_PORT_CONNECTION ) )
+
+static const USB_DeviceDescriptor_TypeDef hubDeviceDesc =
+{
+  .bLength            = USB_DEVICE_DESCSIZE,
+  .bDescriptorType    = USB_DEVICE_DESCRIPTOR,
+  .bcdUSB             = 0x0200,
+  .bDeviceClass       = USB_CLASS_HUB,
+  .bMaxPacketSize0    = 64,
+  .idVendor           = 0x10C4,
+  .idProduct          = 0x0009,
+  .bNumConfigurations = 1
+};
+
+static const uint8_t hubConfigDesc[] =
+{
+  USB_CONFIG_DESCSIZE, USB_CONFIG_DESCRIPTOR,
+  USB_CONFIG_DESCSIZE + USB_INTERFACE_DESCSIZE + USB_ENDPOINT_DESCSIZE, 0,
+  1, 1, 0, CONFIG_DESC_BM_RESERVED_D7 | CONFIG_DESC_BM_SELFPOWERED, 0,
+
+  USB_INTERFACE_DESCSIZE, USB_INTERFACE_DESCRIPTOR,
+  0, 0, 1, USB_CLASS_HUB, 0, 0, 0,
+
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  USB_SETUP_DIR_MASK | 1, USB_EPTYPE_INTR, 1, 0, 12
+};
+
+static void HubPortPower( int i )
+{
+  hub.status[ i ] |= HUB_PS_POWER;
+  if ( hub.port[ i ].attached && !( hub.status[ i ] & HUB_PS_CONNECTION ) )
+  {
+    hub.status[ i ] |= HUB_PS_CONNECTION |
+                       ( hub.port[ i ].dev->lowSpeed ? HUB_PS_LOW_SPEED : 0 );
+    hub.change[ i ] |= HUB_PC( HUB_FEATURE_C_PORT_CONNECTION );
+  }
+}
+
+static void HubPortReset( int i )
+{
+  if ( hub.status[ i ] & HUB_PS_CONNECTION )
+  {
+    hub.status[ i ]     |= HUB_PS_ENABLE;
+    hub.status[ i ]     &= ~HUB_PS_SUSPEND;
+    hub.change[ i ]     |= HUB_PC( HUB_FEATURE_C_PORT_RESET );
+    hub.port[ i ].addr   = 0;
+    hub.port[ i ].stall  = false;
+  }
+}
+
+/* Hub reset, ports are unpowered and downstream devices lose their address. */
+static void HubReset( void )
+{
+  int i;
+
+  for ( i = 0; i < USBSIM_HUB_MAX_PORTS; i++ )
+  {
+    hub.status[ i ]    = 0;
+    hub.change[ i ]    = 0;
+    hub.port[ i ].addr = 0;
+  }
+}
+
+static int HubSetup( const USB_Setup_TypeDef *setup, uint8_t *data, int maxLen )
+{
+  int i = setup->wIndex - 1;
+
+  (void)maxLen;
+
+  if ( setup->Type != USB_SETUP_TYPE_CLASS )
+    return USBSIM_UNHANDLED;
+
+  if ( setup->Recipient == USB_SETUP_RECIPIENT_DEVICE )
+  {
+    switch ( setup->bRequest )
+    {
+      case GET_DESCRIPTOR:
+        data[ 0 ] = 9;
+        data[ 1 ] = USB_HUB_DESCRIPTOR;
+        data[ 2 ] = hub.numPorts;
+        data[ 3 ] = 0x09;               /* Per port power and overcurrent. */
+        data[ 4 ] = 0;
+        data[ 5 ] = 5;                  /* bPwrOn2PwrGood, 10 ms.          */
+        data[ 6 ] = 0;
+        data[ 7 ] = 0;                  /* DeviceRemovable.                */
+        data[ 8 ] = 0xFF;               /* PortPwrCtrlMask.                */
+        return 9;
+
+      case GET_STATUS:
+        memset( data, 0, 4 );
+        return 4;
+
+      case CLEAR_FEATURE:
+      case SET_FEATURE:
+        return USBSIM_ACK;
+    }
+    return USBSIM_STALL;
+  }
+
+  if ( ( setup->Recipient != USB_SETUP_RECIPIENT_OTHER ) ||
+       ( i < 0 ) || ( i >= hub.numPorts ) )
+    return USBSIM_STALL;
+
+  switch ( setup->bRequest )
+  {
+    case GET_STATUS:
+      data[ 0 ] = hub.status[ i ] & 0xFF;
+      data[ 1 ] = hub.status[ i ] >> 8;
+      data[ 2 ] = hub.change[ i ] & 0xFF;
+      data[ 3 ] = hub.change[ i ] >> 8;
+      return 4;
+
+    case SET_FEATURE:
+      switch ( setup->wValue )
+      {
+        case HUB_FEATURE_PORT_POWER:
+          HubPortPower( i );
+          return USBSIM_ACK;
+
+        case HUB_FEATURE_PORT_RESET:
+          HubPortReset( i );
+          return USBSIM_ACK;
+
+        case HUB_FEATURE_PORT_SUSPEND:
+          hub.status[ i ] |= HUB_PS_SUSPEND;
+          return USBSIM_ACK;
+
+        case HUB_FEATURE_PORT_INDICATOR:
+          return USBSIM_ACK;
+      }
+      return USBSIM_STALL;
+
+    case CLEAR_FEATURE:
+      if ( ( setup->wValue >= HUB_FEATURE_C_PORT_CONNECTION ) &&
+           ( setup->wValue <= HUB_FEATURE_C_PORT_RESET      )    )
+      {
+        hub.change[ i ] &= ~HUB_PC( setup->wValue );
+        return USBSIM_ACK;
+      }
+      switch ( setup->wValue )
+      {
+        case HUB_FEATURE_PORT_ENABLE:
+          hub.status[ i ] &= ~HUB_PS_ENABLE;
+          return USBSIM_ACK;
+
+        case HUB_FEATURE_PORT_SUSPEND:
+          if ( hub.status[ i ] & HUB_PS_SUSPEND )
+          {
+            hub.status[ i ] &= ~HUB_PS_SUSPEND;
+            hub.change[ i ] |= HUB_PC( HUB_FEATURE_C_PORT_SUSPEND );
+          }
+          return USBSIM_ACK;
+
+        case HUB_FEATURE_PORT_POWER:
+          hub.status[ i ] &= HUB_PS_OVER_CURRENT;
+          return USBSIM_ACK;
+
+        case HUB_FEATURE_PORT_INDICATOR:
+          return USBSIM_ACK;
+      }
+      return USBSIM_STALL;
+  }
+  return USBSIM_STALL;
+}
+
+/* Status change endpoint, bit n of the bitmap is set when port n changed. */
+static int HubIn( uint8_t epNum, uint8_t *data, int maxLen )
+{
+  int i;
+  uint8_t map = 0;
+
+  if ( ( epNum != 1 ) || ( maxLen < 1 ) )
+    return USBSIM_STALL;
+
+  for ( i = 0; i < hub.numPorts; i++ )
+  {
+    if ( hub.change[ i ] )
+      map |= 1 << ( i + 1 );
+  }
+
+  if ( map == 0 )
+    return USBSIM_NAK;
+
+  data[ 0 ] = map;
+  return 1;
+}
+
+static const USBSIM_Device_TypeDef hubDevice =
+{
+  .deviceDescriptor = &hubDeviceDesc,
+  .configDescriptor = hubConfigDesc,
+  .setup            = HubSetup,
+  .in               = HubIn,
+};
+
+/* Find the device a host channel is talking to. */
+static SimDev_TypeDef *DevLookup( uint8_t addr )
+{
+  int i;
+
+  if ( !sdev.attached )
+    return NULL;
+
+  if ( sdev.addr == addr )
+    return &sdev;
+
+  if ( hub.present )
+  {
+    for ( i = 0; i < hub.numPorts; i++ )
+    {
+      if ( hub.port[ i ].attached                         &&
+           ( hub.port[ i ].addr == addr )                 &&
+           ( ( hub.status[ i ] & ( HUB_PS_ENABLE | HUB_PS_SUSPEND ) ) ==
+             HUB_PS_ENABLE ) )
+      {
+        return &hub.port[ i ];
+      }
+    }
+  }
+  return NULL;
+}
+
+static int DevCtrlStd( SimDev_TypeDef *d )
+{
+  int len = USBSIM_STALL;
+  const USB_Setup_TypeDef *s = &d->setup;
+
+  if ( s->Type != USB_SETUP_TYPE_STANDARD )
+    return USBSIM_STALL;
+
+  switch ( s->bRequest )
+  {
+    case GET_DESCRIPTOR:
+      if ( ( s->wValue >> 8 ) == USB_DEVICE_DESCRIPTOR &&
+           d->dev->deviceDescriptor )
+      {
+        len = USB_DEVICE_DESCSIZE;
+        memcpy( d->buf, d->dev->deviceDescriptor, len );
+      }
+      else if ( ( s->wValue >> 8 ) == USB_CONFIG_DESCRIPTOR &&
+                d->dev->configDescriptor )
+      {
+        len = d->dev->configDescriptor[ 2 ] |
+              ( d->dev->configDescriptor[ 3 ] << 8 );
+        len = EFM32_MIN( len, (int)sizeof( d->buf ) );
+        memcpy( d->buf, d->dev->configDescriptor, len );
+      }
+      break;
+
+    case GET_STATUS:
+    case GET_CONFIGURATION:
+      memset( d->buf, 0, 2 );
+      len = s->bRequest == GET_STATUS ? 2 : 1;
+      break;
+
+    case SET_ADDRESS:
+      d->pendingAddr = s->wValue & 0x7F;
+      len = 0;
+      break;
+
+    case SET_CONFIGURATION:
+    case SET_INTERFACE:
+    case CLEAR_FEATURE:
+    case SET_FEATURE:
+      len = 0;
+      break;
+  }
+  return len;
+}
+
+static int DevSetup( SimDev_TypeDef *d, const uint8_t *pkt )
+{
+  int r = USBSIM_UNHANDLED;
+
+  memcpy( &d->setup, pkt, USB_SETUP_PKT_SIZE );
+  d->stall       = false;
+  d->len         = 0;
+  d->pos         = 0;
+  d->pendingAddr = d->addr;
+
+  if ( d->dev->setup )
+    r = d->dev->setup( &d->setup, d->buf, sizeof( d->buf ) );
+  if ( r == USBSIM_UNHANDLED )
+    r = DevCtrlStd( d );
+
+  if ( r < 0 )
+    d->stall = true;
+  else if ( d->setup.Direction == USB_SETUP_DIR_IN )
+    d->len = EFM32_MIN( r, d->setup.wLength );
+
+  stats.setupXacts++;
+  return USBSIM_ACK;
+}
+
+static int DevIn( SimDev_TypeDef *d, uint8_t epNum, uint8_t *data, int maxLen )
+{
+  int n;
+
+  if ( epNum )
+    return d->dev->in ? d->dev->in( epNum, data, maxLen ) : USBSIM_NAK;
+
+  if ( d->stall )
+    return USBSIM_STALL;
+
+  if ( d->setup.Direction == USB_SETUP_DIR_IN )
+  {
+    n = EFM32_MIN( maxLen, d->len - d->pos );
+    memcpy( data, &d->buf[ d->pos ], n );
+    d->pos += n;
+    return n;
+  }
+
+  /* Status stage of a control write, a new address takes effect now. */
+  d->addr = d->pendingAddr;
+  return 0;
+}
+
+static int DevOut( SimDev_TypeDef *d, uint8_t epNum, const uint8_t *data, int len )
+{
+  if ( epNum )
+    return d->dev->out ? d->dev->out( epNum, data, len ) : USBSIM_NAK;
+
+  if ( d->stall )
+    return USBSIM_STALL;
+
+  if ( ( d->setup.Direction == USB_SETUP_DIR_OUT ) && d->dev->out )
+    return d->dev->out( 0, data, len );
+
+  return USBSIM_ACK;
+}
+
+static void HcHalt( int hc, uint32_t intFlags )
+{
+  RegUpdate( &USB->HC[ hc ].CHAR, USB_HC_CHAR_CHENA, 0 );
+  FlagsSet( &flags[ FL_HC0 + hc ], intFlags | USB_HC_INT_CHHLTD );
+}
+
+/* Execute one transaction on a host channel. Called with hwLock. */
+static bool HcTransaction( int hc )
+{
+  int r, len, mps, pid, xfersize, pktcnt;
+  uint32_t ch, tsiz, type;
+  uint8_t epNum, devAddr, tmp[ 1024 ];
+  SimDev_TypeDef *d;
+
+  ch = USB->HC[ hc ].CHAR;
+  if ( !( ch & USB_HC_CHAR_CHENA ) || ( ch & USB_HC_CHAR_CHDIS ) )
+    return false;
+
+  type = ch & _USB_HC_CHAR_EPTYPE_MASK;
+  if ( type == USB_HC_CHAR_EPTYPE_INT )
+  {
+    if ( ( ( frameNum & 1 ) != 0 ) != ( ( ch & USB_HC_CHAR_ODDFRM ) != 0 ) )
+      return false;
+  }
+
+  mps      = ( ch & _USB_HC_CHAR_MPS_MASK     ) >> _USB_HC_CHAR_MPS_SHIFT;
+  epNum    = ( ch & _USB_HC_CHAR_EPNUM_MASK   ) >> _USB_HC_CHAR_EPNUM_SHIFT;
+  devAddr  = ( ch & _USB_HC_CHAR_DEVADDR_MASK ) >> _USB_HC_CHAR_DEVADDR_SHIFT;
+  tsiz     = USB->HC[ hc ].TSIZ;
+  pid      = ( tsiz & _USB_HC_TSIZ_PID_MASK      ) >> _USB_HC_TSIZ_PID_SHIFT;
+  xfersize = ( tsiz & _USB_HC_TSIZ_XFERSIZE_MASK ) >> _USB_HC_TSIZ_XFERSIZE_SHIFT;
+  pktcnt   = ( tsiz & _USB_HC_TSIZ_PKTCNT_MASK   ) >> _USB_HC_TSIZ_PKTCNT_SHIFT;
+
+  if ( frameBudget < USBSIM_XACT_OVERHEAD + mps )
+    return false;
+  frameBudget -= USBSIM_XACT_OVERHEAD;
+
+  d = DevLookup( devAddr );
+  if ( !( hprtPub & USB_HPRT_PRTENA ) || ( d == NULL ) )
+  {
+    stats.timeouts++;
+    HcHalt( hc, USB_HC_INT_XACTERR );
+    return true;
+  }
+
+  if ( pid == USB_PID_SETUP )
+  {
+    DevSetup( d, DMAPTR( USB->HC[ hc ].DMAADDR ) );
+    frameBudget -= USB_SETUP_PKT_SIZE;
+    USB->HC[ hc ].DMAADDR += USB_SETUP_PKT_SIZE;
+    USB->HC[ hc ].TSIZ = ( USB_PID_DATA1 << _USB_HC_TSIZ_PID_SHIFT );
+    HcHalt( hc, USB_HC_INT_XFERCOMPL | USB_HC_INT_ACK );
+    return true;
+  }
+
+  if ( ch & USB_HC_CHAR_EPDIR )
+  {
+    r = DevIn( d, epNum, tmp, mps );
+    if ( r >= 0 )
+    {
+      len = r;
+      memcpy( DMAPTR( USB->HC[ hc ].DMAADDR ), tmp, len );
+      USB->HC[ hc ].DMAADDR += len;
+      stats.inXacts++;
+      stats.epInBytes[ epNum ] += len;
+    }
+  }
+  else
+  {
+    len = EFM32_MIN( mps, xfersize );
+    r = DevOut( d, epNum, DMAPTR( USB->HC[ hc ].DMAADDR ), len );
+    if ( r == USBSIM_ACK )
+    {
+      r = len;
+      USB->HC[ hc ].DMAADDR += len;
+      stats.outXacts++;
+      stats.epOutBytes[ epNum ] += len;
+    }
+  }
+
+  if ( r == USBSIM_NAK )
+  {
+    stats.naks++;
+    if ( type == USB_HC_CHAR_EPTYPE_INT )
+      HcHalt( hc, USB_HC_INT_NAK );
+    else
+      FlagsSet( &flags[ FL_HC0 + hc ], USB_HC_INT_NAK );
+    return false;
+  }
+
+  if ( r < 0 )
+  {
+    stats.stalls++;
+    HcHalt( hc, USB_HC_INT_STALL );
+    return true;
+  }
+
+  frameBudget -= len;
+  xfersize    -= EFM32_MIN( len, xfersize );
+  pktcnt      -= pktcnt ? 1 : 0;
+  pid          = ( pid == USB_PID_DATA0 ) ? USB_PID_DATA1 : USB_PID_DATA0;
+  USB->HC[ hc ].TSIZ = ( xfersize << _USB_HC_TSIZ_XFERSIZE_SHIFT ) |
+                       ( pktcnt   << _USB_HC_TSIZ_PKTCNT_SHIFT   ) |
+                       ( pid      << _USB_HC_TSIZ_PID_SHIFT      );
+
+  if ( ( pktcnt == 0 ) || ( len < mps ) )
+  {
+    if ( ch & USB_HC_CHAR_EPDIR )
+      stats.epInIrqs[ epNum ]++;
+    else
+      stats.epOutIrqs[ epNum ]++;
+    HcHalt( hc, USB_HC_INT_XFERCOMPL | USB_HC_INT_ACK );
+  }
+  else
+  {
+    FlagsSet( &flags[ FL_HC0 + hc ], USB_HC_INT_ACK );
+  }
+  return type != USB_HC_CHAR_EPTYPE_INT;
+}
+
+static bool HcService( void )
+{
+  int i;
+  bool progress = false;
+
+  pthread_mutex_lock( &hwLock );
+  ServiceRegisters();
+  for ( i = 0; i < MAX_NUM_HOSTCHANNELS; i++ )
+  {
+    while ( HcTransaction( i ) )
+      progress = true;
+  }
+  UpdateSummary();
+  pthread_mutex_unlock( &hwLock );
+
+  return progress;
+}
+#endif /* defined( USB_HOST ) */
+
+#if defined( USB_DEVICE )
+static bool DevOnline(       void );
+static bool DevIsocFrameEnd( void );
+#endif
+
+/* Start a new frame. Called with hwLock. */
+static void FrameStart( void )
+{
+#if defined( USB_DEVICE )
+  /* The rest of the frame was idle bus time, the DMA kept running. */
+  DmaAdvance( frameBudget );
+#endif
+
+  /* Catch up with time spent in sub frame delays. */
+  if ( simTimeUs >= (uint64_t)( frameNum + 1 ) * USBSIM_FRAME_US )
+  {
+    frameNum = (uint32_t)( simTimeUs / USBSIM_FRAME_US );
+  }
+  else
+  {
+    frameNum++;
+    simTimeUs = (uint64_t)frameNum * USBSIM_FRAME_US;
+  }
+  msTicks     = (uint32_t)( simTimeUs / 1000 );
+  frameBudget = USBSIM_FRAME_BYTES;
+  stats.frames++;
+
+  RWREG( USB->HFNUM ) = frameNum & _USB_HFNUM_FRNUM_MASK;
+  RWREG( USB->DSTS )  = ( USB->DSTS & ~_USB_DSTS_SOFFN_MASK ) |
+                        ( ( frameNum << _USB_DSTS_SOFFN_SHIFT ) &
+                          _USB_DSTS_SOFFN_MASK );
+
+#if defined( USB_DEVICE )
+  if ( enumerated && vbusOn && !( USB->DCTL & USB_DCTL_SFTDISCON ) )
+    FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_SOF );
+#endif
+#if defined( USB_HOST )
+  if ( hprtPub & USB_HPRT_PRTENA )
+    FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_SOF );
+#endif
+}
+
+#if defined( USB_HOST )
+/* The host stack busy waits for transfers and port timers to complete. */
+static bool HostBusy( void )
+{
+  int i;
+
+  for ( i = 0; i < MAX_NUM_HOSTCHANNELS; i++ )
+  {
+    if ( USB->HC[ i ].CHAR & USB_HC_CHAR_CHENA )
+      return true;
+  }
+#if ( NUM_QTIMERS > 0 )
+  for ( i = 0; i < NUM_QTIMERS; i++ )
+  {
+    if ( timers[ i ].running )
+      return true;
+  }
+#endif
+  return false;
+}
+#endif
+
+static void *FabricThread( void *arg )
+{
+  (void)arg;
+
+  while ( running )
+  {
+    pthread_mutex_lock( &hwLock );
+    ServiceRegisters();
+    pthread_mutex_unlock( &hwLock );
+    sched_yield();
+  }
+  return NULL;
+}
+
+static void *BusThread( void *arg )
+{
+  bool advance;
+
+  (void)arg;
+
+  while ( running )
+  {
+    pthread_mutex_lock( &hwLock );
+    advance = freeRun || ( (uint64_t)frameNum * USBSIM_FRAME_US < demandUs );
+#if defined( USB_HOST )
+    advance = advance || ( sdev.attached && HostBusy() );
+#endif
+    if ( advance )
+    {
+      frameStarting = true;
+#if defined( USB_DEVICE )
+      /* Incomplete isochronous transfers are flagged at the end of the   */
+      /* periodic frame, the handler still sees the number of that frame. */
+      if ( DevOnline() && DevIsocFrameEnd() )
+      {
+        pthread_mutex_unlock( &hwLock );
+        DeliverIrq();
+        pthread_mutex_lock( &hwLock );
+      }
+#endif
+      FrameStart();
+    }
+    pthread_mutex_unlock( &hwLock );
+
+    /* The timers and the SOF interrupt run before the waiters are released, */
+    /* as they would at the start of the frame, ahead of its transactions.   */
+    if ( advance )
+    {
+      TimerService();
+#if defined( USB_HOST )
+      do
+      {
+        DeliverIrq();
+      } while ( HcService() );
+#endif
+      DeliverIrq();
+    }
+    else
+    {
+      DeliverIrq();
+    }
+
+    pthread_mutex_lock( &hwLock );
+    frameStarting = false;
+    pthread_cond_broadcast( &frameCond );
+    pthread_mutex_unlock( &hwLock );
+
+    if ( !advance )
+      usleep( 100 );
+  }
+  return NULL;
+}
+
+/* Wait for simulated time to pass. */
+static void SimWaitUs( uint64_t usec )
+{
+  uint64_t target;
+
+  pthread_mutex_lock( &hwLock );
+  target = simTimeUs + usec;
+
+  if ( inHandler || !running ||
+       pthread_equal( pthread_self(), busThread ) ||
+       ( usec < USBSIM_FRAME_US ) )
+  {
+    /* Busy wait, or nobody to advance the frames: just move the clock. */
+    simTimeUs = target;
+  }
+  else
+  {
+    if ( demandUs < target )
+      demandUs = target;
+    while ( running && ( ( simTimeUs < target ) || frameStarting ) )
+      pthread_cond_wait( &frameCond, &hwLock );
+  }
+  pthread_mutex_unlock( &hwLock );
+}
+
+#if defined( USB_DEVICE )
+/* Account for bus time used by a transaction, waiting for new frames. */
+static void ConsumeBudget( int bytes )
+{
+  uint64_t target;
+
+  pthread_mutex_lock( &hwLock );
+  while ( running && ( ( frameBudget < bytes ) || frameStarting ) )
+  {
+    target = (uint64_t)( frameNum + 1 ) * USBSIM_FRAME_US;
+    if ( demandUs < target )
+      demandUs = target;
+    pthread_cond_wait( &frameCond, &hwLock );
+  }
+  frameBudget -= bytes;
+  DmaAdvance( bytes );
+  pthread_mutex_unlock( &hwLock );
+}
+
+static int DevEpMps( bool in, int epNum )
+{
+  static const int ep0Mps[ 4 ] = { 64, 32, 16, 8 };
+  uint32_t ctl = in ? USB_DINEPS[ epNum ].CTL : USB_DOUTEPS[ epNum ].CTL;
+
+  if ( epNum == 0 )
+    return ep0Mps[ ( ctl & _USB_DIEP0CTL_MPS_MASK ) >> _USB_DIEP0CTL_MPS_SHIFT ];
+
+  return ( ctl & _USB_DIEP_CTL_MPS_MASK ) >> _USB_DIEP_CTL_MPS_SHIFT;
+}
+
+static bool DevOnline( void )
+{
+  return vbusOn && enumerated && !( USB->DCTL & USB_DCTL_SFTDISCON );
+}
+
+static bool DevEpIsIsoc( uint32_t ctl, int epNum )
+{
+  return epNum &&
+         ( ( ctl & _USB_DIEP_CTL_EPTYPE_MASK ) == DIEPCTL_EPTYPE_ISOC );
+}
+
+/* Isochronous endpoints only respond in the frame they are armed for. */
+static bool DevIsocArmed( uint32_t ctl )
+{
+  return ( ctl & USB_DIEP_CTL_EPENA ) && !( ctl & USB_DIEP_CTL_NAKSTS ) &&
+         ( ( ( ctl & USB_DIEP_CTL_DPIDEOF ) != 0 ) == ( ( frameNum & 1 ) != 0 ) );
+}
+
+/*
+ * At the end of a frame, isochronous endpoints which were armed for it but
+ * not polled by the host raise an incomplete isochronous interrupt. Returns
+ * true when an interrupt was flagged. Called with hwLock.
+ */
+static bool DevIsocFrameEnd( void )
+{
+  int i;
+  bool incomplete = false;
+
+  for ( i = 1; i < EP_CNT; i++ )
+  {
+    if ( DevEpIsIsoc( USB_DINEPS[ i ].CTL, i ) &&
+         DevIsocArmed( USB_DINEPS[ i ].CTL ) )
+    {
+      FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_INCOMPISOIN );
+      incomplete = true;
+    }
+    if ( DevEpIsIsoc( USB_DOUTEPS[ i ].CTL, i ) &&
+         DevIsocArmed( USB_DOUTEPS[ i ].CTL ) )
+    {
+      FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_INCOMPLP );
+      incomplete = true;
+    }
+  }
+  return incomplete;
+}
+
+/* FIFO depths in bytes, as programmed by USBDHAL_CoreInit(). */
+static int RxFifoDepth( void )
+{
+  return ( ( USB->GRXFSIZ & _USB_GRXFSIZ_RXFDEP_MASK ) >>
+           _USB_GRXFSIZ_RXFDEP_SHIFT ) * 4;
+}
+
+static int TxFifoNum( int epNum )
+{
+  if ( epNum == 0 )
+    return 0;
+
+  return ( USB_DINEPS[ epNum ].CTL & _USB_DIEP_CTL_TXFNUM_MASK ) >>
+         _USB_DIEP_CTL_TXFNUM_SHIFT;
+}
+
+static int TxFifoDepth( int epNum )
+{
+  int fifoNum = TxFifoNum( epNum );
+
+  if ( ( fifoNum == 0 ) || ( fifoNum > MAX_NUM_TX_FIFOS ) )
+  {
+    return ( ( USB->GNPTXFSIZ & _USB_GNPTXFSIZ_NPTXFINEPTXF0DEP_MASK ) >>
+             _USB_GNPTXFSIZ_NPTXFINEPTXF0DEP_SHIFT ) * 4;
+  }
+
+  return ( ( USB_DIEPTXFS[ fifoNum - 1 ] & _USB_DIEPTXF1_INEPNTXFDEP_MASK ) >>
+           _USB_DIEPTXF1_INEPNTXFDEP_SHIFT ) * 4;
+}
+
+/* Apply the Tx and Rx FIFO flush commands in GRSTCTL. Called with hwLock. */
+static void FifoFlush( uint32_t grstctl )
+{
+  int i, fifoNum;
+
+  if ( grstctl & USB_GRSTCTL_CSFTRST )
+  {
+    memset( txFifoFill, 0, sizeof( txFifoFill ) );
+    memset( txFifoBusy, 0, sizeof( txFifoBusy ) );
+    rxFifoFill = rxFifoBusy = 0;
+    return;
+  }
+
+  if ( grstctl & USB_GRSTCTL_TXFFLSH )
+  {
+    fifoNum = ( grstctl & _USB_GRSTCTL_TXFNUM_MASK ) >> _USB_GRSTCTL_TXFNUM_SHIFT;
+    for ( i = 0; i < EP_CNT; i++ )
+    {
+      if ( ( fifoNum == _USB_GRSTCTL_TXFNUM_FALL ) || ( TxFifoNum( i ) == fifoNum ) )
+        txFifoFill[ i ] = txFifoBusy[ i ] = 0;
+    }
+  }
+
+  if ( grstctl & USB_GRSTCTL_RXFFLSH )
+    rxFifoFill = rxFifoBusy = 0;
+}
+
+/*
+ * Move data between memory and the FIFO's with the DMA credit earned so far.
+ * The Rx FIFO is drained first, then enabled IN endpoints get their transfer
+ * data prefetched into free Tx FIFO space, in endpoint order. Credit which
+ * finds nothing to move is lost, the DMA can not work ahead of the bus.
+ * Called with hwLock.
+ */
+static void DmaService( void )
+{
+  int i, n, xfersize, bytes;
+  uint32_t ctl;
+  bool unlimited = ( dmaRate == 0 );
+
+  bytes = (int)EFM32_MIN( unlimited ? INT32_MAX : dmaCredit / USBSIM_FRAME_BYTES,
+                          INT32_MAX );
+
+  n = EFM32_MIN( bytes, rxFifoFill );
+  rxFifoFill -= n;
+  bytes      -= n;
+
+  for ( i = 0; i < EP_CNT; i++ )
+  {
+    ctl = USB_DINEPS[ i ].CTL;
+    if ( !( ctl & USB_DIEP_CTL_EPENA ) || DevEpIsIsoc( ctl, i ) )
+      continue;
+
+    xfersize = ( USB_DINEPS[ i ].TSIZ &
+                 ( i ? _USB_DIEP_TSIZ_XFERSIZE_MASK : _USB_DIEP0TSIZ_XFERSIZE_MASK ) ) >>
+               _USB_DIEP_TSIZ_XFERSIZE_SHIFT;
+    n = EFM32_MIN( xfersize,
+                   TxFifoDepth( i ) - txFifoBusy[ i ] ) - txFifoFill[ i ];
+    n = EFM32_MIN( bytes, n );
+    if ( n > 0 )
+    {
+      txFifoFill[ i ] += n;
+      bytes           -= n;
+    }
+  }
+
+  if ( !unlimited )
+    dmaCredit = bytes ? 0 : dmaCredit % USBSIM_FRAME_BYTES;
+}
+
+/* Bus time has passed, the DMA earns credit. Called with hwLock. */
+static void DmaAdvance( int busBytes )
+{
+  if ( busBytes > 0 )
+    dmaCredit += (uint64_t)busBytes * dmaRate;
+  DmaService();
+}
+
+/* A packet has left the Tx FIFO or entered the Rx FIFO. Called with hwLock. */
+static void FifoRelease( int xact, int epNum )
+{
+  if ( xact == XACT_IN )
+  {
+    txFifoBusy[ epNum ] = 0;
+  }
+  else
+  {
+    rxFifoFill += rxFifoBusy;
+    rxFifoBusy  = 0;
+  }
+  DmaService();
+}
+
+/* Device side of a SETUP transaction. Called with hwLock. */
+static int DevSetupXact( const USB_Setup_TypeDef *setup )
+{
+  int supcnt;
+  uint32_t tsiz;
+
+  tsiz   = USB->DOEP0TSIZ;
+  supcnt = ( tsiz & _USB_DOEP0TSIZ_SUPCNT_MASK ) >> _USB_DOEP0TSIZ_SUPCNT_SHIFT;
+  memcpy( DMAPTR( USB->DOEP0DMAADDR ), setup, USB_SETUP_PKT_SIZE );
+  USB->DOEP0DMAADDR += USB_SETUP_PKT_SIZE;
+  supcnt = ( supcnt - 1 ) & 3;       /* Two bit counter, wraps to 3. */
+  USB->DOEP0TSIZ = ( tsiz & ~_USB_DOEP0TSIZ_SUPCNT_MASK ) |
+                   ( supcnt << _USB_DOEP0TSIZ_SUPCNT_SHIFT );
+
+  /* A SETUP packet clears an endpoint 0 stall condition. */
+  RegUpdate( &USB->DIEP0CTL, USB_DIEP0CTL_STALL, 0 );
+  RegUpdate( &USB->DOEP0CTL, USB_DOEP0CTL_STALL, 0 );
+
+  /* SETUP packets are never NAK'ed, the core reserves Rx FIFO space. */
+  rxFifoBusy = USB_SETUP_PKT_SIZE + 8;
+
+  FlagsSet( &flags[ FL_DOEP0 ], USB_DOEP0INT_SETUP );
+  stats.setupXacts++;
+  return USBSIM_ACK;
+}
+
+/* Device side of an IN transaction. Called with hwLock. */
+static int DevInXact( int epNum, uint8_t *data )
+{
+  int len, mps, xfersize, pktcnt;
+  uint32_t ctl, tsiz, xsMask, pcMask;
+  USB_DIEP_TypeDef *ep = &USB_DINEPS[ epNum ];
+
+  ctl = ep->CTL;
+  if ( DevEpIsIsoc( ctl, epNum ) && !DevIsocArmed( ctl ) )
+  {
+    /* No handshake on isochronous endpoints, the core sends a ZLP. */
+    stats.isocMisses++;
+    return 0;
+  }
+  if ( ctl & USB_DIEP_CTL_STALL )
+    return USBSIM_STALL;
+  if ( !( ctl & USB_DIEP_CTL_EPENA ) || ( ctl & USB_DIEP_CTL_NAKSTS ) )
+  {
+    /* Nothing loaded in the Tx FIFO, the token is NAK'ed. */
+    FlagsSet( &flags[ FL_DIEP0 + epNum ],
+              USB_DIEP_INT_NAKINTRPT |
+              ( ( ctl & USB_DIEP_CTL_EPENA ) ? 0 : USB_DIEP_INT_INTKNTXFEMP ) );
+    return USBSIM_NAK;
+  }
+
+  xsMask = epNum ? _USB_DIEP_TSIZ_XFERSIZE_MASK : _USB_DIEP0TSIZ_XFERSIZE_MASK;
+  pcMask = epNum ? _USB_DIEP_TSIZ_PKTCNT_MASK   : _USB_DIEP0TSIZ_PKTCNT_MASK;
+
+  tsiz     = ep->TSIZ;
+  mps      = DevEpMps( true, epNum );
+  xfersize = ( tsiz & xsMask ) >> _USB_DIEP_TSIZ_XFERSIZE_SHIFT;
+  pktcnt   = ( tsiz & pcMask ) >> _USB_DIEP_TSIZ_PKTCNT_SHIFT;
+  len      = EFM32_MIN( mps, xfersize );
+
+  if ( !DevEpIsIsoc( ctl, epNum ) )
+  {
+    if ( txFifoFill[ epNum ] < len )
+    {
+      /* The DMA has not loaded the whole packet yet. */
+      FlagsSet( &flags[ FL_DIEP0 + epNum ],
+                USB_DIEP_INT_NAKINTRPT | USB_DIEP_INT_INTKNTXFEMP );
+      stats.fifoNaks++;
+      return USBSIM_NAK;
+    }
+    txFifoFill[ epNum ] -= len;
+    txFifoBusy[ epNum ]  = len;
+  }
+
+  memcpy( data, DMAPTR( ep->DMAADDR ), len );
+  ep->DMAADDR += len;
+  xfersize    -= len;
+  pktcnt      -= pktcnt ? 1 : 0;
+  ep->TSIZ = ( tsiz & ~( xsMask | pcMask ) ) |
+             ( xfersize << _USB_DIEP_TSIZ_XFERSIZE_SHIFT ) |
+             ( pktcnt   << _USB_DIEP_TSIZ_PKTCNT_SHIFT   );
+
+  if ( pktcnt == 0 )
+  {
+    RegUpdate( &ep->CTL, USB_DIEP_CTL_EPENA, 0 );
+    FlagsSet( &flags[ FL_DIEP0 + epNum ], USB_DIEP_INT_XFERCOMPL );
+    stats.epInIrqs[ epNum ]++;
+  }
+
+  stats.inXacts++;
+  stats.epInBytes[ epNum ] += len;
+  return len;
+}
+
+/* Device side of an OUT transaction. Called with hwLock. */
+static int DevOutXact( int epNum, const uint8_t *data, int len )
+{
+  int mps, xfersize, pktcnt;
+  uint32_t ctl, tsiz, xsMask, pcMask;
+  uint8_t *dst;
+  USB_DOEP_TypeDef *ep = &USB_DOUTEPS[ epNum ];
+
+  ctl = ep->CTL;
+  if ( DevEpIsIsoc( ctl, epNum ) && !DevIsocArmed( ctl ) )
+  {
+    /* No handshake on isochronous endpoints, the data is lost. */
+    stats.isocMisses++;
+    return USBSIM_ACK;
+  }
+  if ( ctl & USB_DOEP_CTL_STALL )
+    return USBSIM_STALL;
+  if ( !( ctl & USB_DOEP_CTL_EPENA ) || ( ctl & USB_DOEP_CTL_NAKSTS ) ||
+       ( USB->DCTL & USB_DCTL_GOUTNAKSTS ) )
+  {
+    FlagsSet( &flags[ FL_DOEP0 + epNum ], USB_DOEP_INT_NAKINTRPT );
+    return USBSIM_NAK;
+  }
+
+  xsMask = epNum ? _USB_DOEP_TSIZ_XFERSIZE_MASK : _USB_DOEP0TSIZ_XFERSIZE_MASK;
+  pcMask = epNum ? _USB_DOEP_TSIZ_PKTCNT_MASK   : _USB_DOEP0TSIZ_PKTCNT_MASK;
+
+  tsiz     = ep->TSIZ;
+  mps      = DevEpMps( false, epNum );
+  xfersize = ( tsiz & xsMask ) >> _USB_DOEP_TSIZ_XFERSIZE_SHIFT;
+  pktcnt   = ( tsiz & pcMask ) >> _USB_DOEP_TSIZ_PKTCNT_SHIFT;
+
+  if ( ( len > mps ) || ( len > xfersize ) )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBSIM: Babble on OUT endpoint" );
+    EFM_ASSERT( false );
+    return USBSIM_STALL;
+  }
+
+  if ( !DevEpIsIsoc( ctl, epNum ) )
+  {
+    /* The packet and its status word must fit in the Rx FIFO. */
+    if ( rxFifoFill + ( ( len + 3 ) & ~3 ) + 4 > RxFifoDepth() )
+    {
+      FlagsSet( &flags[ FL_DOEP0 + epNum ], USB_DOEP_INT_NAKINTRPT );
+      stats.fifoNaks++;
+      return USBSIM_NAK;
+    }
+    rxFifoBusy = ( ( len + 3 ) & ~3 ) + 4;
+  }
+
+  /* The core writes whole words to memory. */
+  dst = DMAPTR( ep->DMAADDR );
+  memcpy( dst, data, len );
+  memset( dst + len, 0, ( ( len + 3 ) & ~3 ) - len );
+  ep->DMAADDR += ( len + 3 ) & ~3;
+  xfersize    -= len;
+  pktcnt      -= pktcnt ? 1 : 0;
+  ep->TSIZ = ( tsiz & ~( xsMask | pcMask ) ) |
+             ( xfersize << _USB_DOEP_TSIZ_XFERSIZE_SHIFT ) |
+             ( pktcnt   << _USB_DOEP_TSIZ_PKTCNT_SHIFT   );
+
+  if ( ( pktcnt == 0 ) || ( len < mps ) )
+  {
+    RegUpdate( &ep->CTL, USB_DOEP_CTL_EPENA, USB_DOEP_CTL_NAKSTS );
+    FlagsSet( &flags[ FL_DOEP0 + epNum ], USB_DOEP_INT_XFERCOMPL );
+    stats.epOutIrqs[ epNum ]++;
+  }
+
+  stats.outXacts++;
+  stats.epOutBytes[ epNum ] += len;
+  return USBSIM_ACK;
+}
+
+/* Issue a token, retry on NAK until timeout. */
+static int HostXact( int xact, int epNum, uint8_t *data, int len, int timeout )
+{
+  int r;
+  uint64_t deadline;
+
+  deadline = USBSIM_GetTimeUs() + (uint64_t)timeout * 1000;
+
+  for (;;)
+  {
+    ConsumeBudget( USBSIM_XACT_OVERHEAD );
+
+    pthread_mutex_lock( &hwLock );
+    ServiceRegisters();
+    DmaService();
+    if ( !DevOnline() )
+      r = USB_STATUS_DEVICE_REMOVED;
+    else if ( xact == XACT_SETUP )
+      r = DevSetupXact( (const USB_Setup_TypeDef*)data );
+    else if ( xact == XACT_IN )
+      r = DevInXact( epNum, data );
+    else
+      r = DevOutXact( epNum, data, len );
+    UpdateSummary();
+    pthread_mutex_unlock( &hwLock );
+
+    DeliverIrq();
+
+    if ( r == USBSIM_NAK )
+    {
+      stats.naks++;
+      if ( USBSIM_GetTimeUs() >= deadline )
+      {
+        stats.timeouts++;
+        return USB_STATUS_TIMEOUT;
+      }
+      continue;
+    }
+
+    if ( r == USBSIM_STALL )
+    {
+      stats.stalls++;
+      return USB_STATUS_EP_STALLED;
+    }
+
+    if ( xact == XACT_SETUP )
+      ConsumeBudget( USB_SETUP_PKT_SIZE );
+    else if ( xact == XACT_IN )
+      ConsumeBudget( r );
+    else
+      ConsumeBudget( len );
+
+    pthread_mutex_lock( &hwLock );
+    FifoRelease( xact, epNum );
+    pthread_mutex_unlock( &hwLock );
+
+    return r;
+  }
+}
+#endif /* defined( USB_DEVICE ) */
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Initialize the USB core model and start the model threads.
+ *
+ * @details
+ *   Must be called before USBD_Init() or USBH_Init().
+ ******************************************************************************/
+void USBSIM_Init( void )
+{
+  int i;
+  pthread_mutexattr_t attr;
+
+  USBSIM_Stop();
+
+  memset( &USBSIM_usbRegs,  0, sizeof( USBSIM_usbRegs  ) );
+  memset( &USBSIM_cmuRegs,  0, sizeof( USBSIM_cmuRegs  ) );
+  memset( &USBSIM_gpioRegs, 0, sizeof( USBSIM_gpioRegs ) );
+  memset( &stats, 0, sizeof( stats ) );
+
+  /* Inputs are pulled high, i.e. no VBUS overcurrent. */
+  for ( i = 0; i < (int)( sizeof( GPIO->P ) / sizeof( GPIO->P[ 0 ] ) ); i++ )
+    RWREG( GPIO->P[ i ].DIN ) = 0xFFFF;
+
+  RWREG( USB->GRSTCTL ) = USB_GRSTCTL_AHBIDLE;
+
+  flags[ FL_GINTSTS ].reg = &USB->GINTSTS;
+  flags[ FL_GOTGINT ].reg = &USB->GOTGINT;
+  for ( i = 0; i < EP_CNT; i++ )
+  {
+    flags[ FL_DIEP0 + i ].reg = &USB_DINEPS[ i ].INT;
+    flags[ FL_DOEP0 + i ].reg = &USB_DOUTEPS[ i ].INT;
+  }
+  for ( i = 0; i < MAX_NUM_HOSTCHANNELS; i++ )
+    flags[ FL_HC0 + i ].reg = &USB->HC[ i ].INT;
+  /* Reserved bits used as write detection sentinels. */
+  flags[ FL_GINTSTS ].sentinel = 0x08000000;
+  for ( i = FL_GOTGINT; i < FL_COUNT; i++ )
+    flags[ i ].sentinel = 0x80000000;
+  FlagsReset();
+  hprtPub = 0;
+
+  pthread_mutexattr_init( &attr );
+  pthread_mutexattr_settype( &attr, PTHREAD_MUTEX_RECURSIVE );
+  pthread_mutex_init( &cpuLock, &attr );
+  pthread_mutexattr_destroy( &attr );
+
+  usbIrqEnabled   = false;
+  freeRun         = false;
+  demandUs        = 0;
+  simTimeUs       = 0;
+  frameNum        = 0;
+  frameBudget     = USBSIM_FRAME_BYTES;
+  msTicks         = 0;
+  msTicksServiced = 0;
+#if ( NUM_QTIMERS > 0 )
+  memset( timers, 0, sizeof( timers ) );
+#endif
+#if defined( USB_DEVICE )
+  vbusOn      = false;
+  enumerated  = false;
+  hostDevAddr = 0;
+  dmaRate     = 0;
+  dmaCredit   = 0;
+  FifoFlush( USB_GRSTCTL_CSFTRST );
+#endif
+#if defined( USB_HOST )
+  memset( &sdev, 0, sizeof( sdev ) );
+  memset( &hub,  0, sizeof( hub  ) );
+#endif
+
+  running = true;
+  pthread_create( &fabricThread, NULL, FabricThread, NULL );
+  pthread_create( &busThread,    NULL, BusThread,    NULL );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Stop the model threads.
+ ******************************************************************************/
+void USBSIM_Stop( void )
+{
+  if ( !running )
+    return;
+
+  pthread_mutex_lock( &hwLock );
+  running = false;
+  pthread_cond_broadcast( &frameCond );
+  pthread_mutex_unlock( &hwLock );
+
+  pthread_join( fabricThread, NULL );
+  pthread_join( busThread,    NULL );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get simulated time.
+ *
+ * @return
+ *   Microseconds since @ref USBSIM_Init().
+ ******************************************************************************/
+uint64_t USBSIM_GetTimeUs( void )
+{
+  uint64_t t;
+
+  pthread_mutex_lock( &hwLock );
+  t = simTimeUs;
+  pthread_mutex_unlock( &hwLock );
+  return t;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Let the bus run for a number of frames.
+ *
+ * @param[in] msec
+ *   Number of milliseconds (frames) to run.
+ ******************************************************************************/
+void USBSIM_RunMs( uint32_t msec )
+{
+  SimWaitUs( (uint64_t)msec * 1000 );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Make frames advance continuously, also when no one waits for them.
+ *
+ * @details
+ *   By default frames only advance while someone waits for bus time, and in
+ *   host mode while a host channel or a USBTIMER timer is active.
+ *
+ * @param[in] on
+ *   True to free run, false to only advance time on demand.
+ ******************************************************************************/
+void USBSIM_SetFreeRun( bool on )
+{
+  pthread_mutex_lock( &hwLock );
+  freeRun = on;
+  pthread_mutex_unlock( &hwLock );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get model statistics.
+ *
+ * @param[out] s
+ *   Statistics since @ref USBSIM_Init() or @ref USBSIM_ClearStats().
+ ******************************************************************************/
+void USBSIM_GetStats( USBSIM_Stats_TypeDef *s )
+{
+  pthread_mutex_lock( &hwLock );
+  *s = stats;
+  pthread_mutex_unlock( &hwLock );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Clear model statistics.
+ ******************************************************************************/
+void USBSIM_ClearStats( void )
+{
+  pthread_mutex_lock( &hwLock );
+  memset( &stats, 0, sizeof( stats ) );
+  pthread_mutex_unlock( &hwLock );
+}
+
+#if defined( USB_DEVICE )
+/***************************************************************************//**
+ * @brief
+ *   Apply or remove VBUS.
+ *
+ * @param[in] on
+ *   True when VBUS is present.
+ ******************************************************************************/
+void USBSIM_VbusSet( bool on )
+{
+  pthread_mutex_lock( &hwLock );
+  vbusOn = on;
+  if ( on )
+  {
+    RWREG( USB->STATUS ) |= USB_STATUS_VREGOS;
+    RWREG( USB->IF )     |= USB_IF_VREGOSH;
+  }
+  else
+  {
+    RWREG( USB->STATUS ) &= ~USB_STATUS_VREGOS;
+    RWREG( USB->IF )     |= USB_IF_VREGOSL;
+    enumerated = false;
+  }
+  pthread_mutex_unlock( &hwLock );
+
+  DeliverIrq();
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Set the speed of the DMA between the FIFO's and memory.
+ *
+ * @details
+ *   The DMA prefetches IN transfer data into the Tx FIFO's and drains OUT
+ *   packets from the Rx FIFO while bus time passes. An IN token is NAK'ed
+ *   with a Tx FIFO empty interrupt until the whole packet is loaded, and an
+ *   OUT packet is NAK'ed when it does not fit in the Rx FIFO. The default is
+ *   an unlimited rate, then only the FIFO depths limit the traffic.
+ *
+ * @param[in] bytesPerFrame
+ *   Bytes the DMA moves per 1 ms frame, 0 for an unlimited rate.
+ ******************************************************************************/
+void USBSIM_SetDmaRate( uint32_t bytesPerFrame )
+{
+  pthread_mutex_lock( &hwLock );
+  dmaRate   = bytesPerFrame;
+  dmaCredit = 0;
+  pthread_mutex_unlock( &hwLock );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Drive USB reset signalling, followed by enumeration of the device
+ *   as a full speed device.
+ *
+ * @return
+ *   @ref USB_STATUS_OK, or @ref USB_STATUS_DEVICE_REMOVED when VBUS is off
+ *   or the device is soft disconnected.
+ ******************************************************************************/
+int USBSIM_HostBusReset( void )
+{
+  pthread_mutex_lock( &hwLock );
+  if ( !vbusOn || ( USB->DCTL & USB_DCTL_SFTDISCON ) )
+  {
+    pthread_mutex_unlock( &hwLock );
+    return USB_STATUS_DEVICE_REMOVED;
+  }
+  enumerated  = false;
+  hostDevAddr = 0;
+  FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_USBRST );
+  pthread_mutex_unlock( &hwLock );
+  DeliverIrq();
+
+  USBSIM_RunMs( 10 );
+
+  pthread_mutex_lock( &hwLock );
+  RWREG( USB->DSTS ) = ( USB->DSTS & ~_USB_DSTS_ENUMSPD_MASK ) |
+                       USB_DSTS_ENUMSPD_FS;
+  enumerated = true;
+  FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_ENUMDONE );
+  pthread_mutex_unlock( &hwLock );
+  DeliverIrq();
+
+  return USB_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Perform a control transfer on the default pipe.
+ *
+ * @param[in] setup
+ *   Setup packet.
+ *
+ * @param[in,out] data
+ *   Data stage buffer, at least setup->wLength bytes.
+ *
+ * @param[in] timeout
+ *   Per transaction NAK timeout in milliseconds.
+ *
+ * @return
+ *   Number of data stage bytes transferred, or a negative USB_Status_TypeDef.
+ ******************************************************************************/
+int USBSIM_HostControl( const USB_Setup_TypeDef *setup, void *data, int timeout )
+{
+  int r, len, mps, total = 0;
+  uint8_t *p = (uint8_t*)data;
+  uint8_t pkt[ 64 ];
+  USB_Setup_TypeDef s;
+
+  pthread_mutex_lock( &hwLock );
+  r = ( ( USB->DCFG & _USB_DCFG_DEVADDR_MASK ) >> _USB_DCFG_DEVADDR_SHIFT )
+      == hostDevAddr;
+  pthread_mutex_unlock( &hwLock );
+  if ( !r )
+  {
+    stats.timeouts++;
+    return USB_STATUS_TIMEOUT;
+  }
+
+  s = *setup;
+  r = HostXact( XACT_SETUP, 0, (uint8_t*)&s, USB_SETUP_PKT_SIZE, timeout );
+  if ( r < 0 )
+    return r;
+
+  mps = 64;
+  if ( setup->wLength )
+  {
+    if ( setup->Direction == USB_SETUP_DIR_IN )
+    {
+      do
+      {
+        r = HostXact( XACT_IN, 0, pkt, 0, timeout );
+        if ( r < 0 )
+          return r;
+        mps = DevEpMps( true, 0 );
+        len = EFM32_MIN( r, setup->wLength - total );
+        memcpy( p + total, pkt, len );
+        total += len;
+      } while ( ( r == mps ) && ( total < setup->wLength ) );
+    }
+    else
+    {
+      do
+      {
+        mps = DevEpMps( false, 0 );
+        len = EFM32_MIN( mps, setup->wLength - total );
+        r = HostXact( XACT_OUT, 0, p + total, len, timeout );
+        if ( r < 0 )
+          return r;
+        total += len;
+      } while ( total < setup->wLength );
+    }
+  }
+
+  if ( setup->wLength && ( setup->Direction == USB_SETUP_DIR_IN ) )
+    r = HostXact( XACT_OUT, 0, pkt, 0, timeout );
+  else
+    r = HostXact( XACT_IN, 0, pkt, 0, timeout );
+  if ( r < 0 )
+    return r;
+
+  if ( ( setup->Type == USB_SETUP_TYPE_STANDARD ) &&
+       ( setup->bRequest == SET_ADDRESS ) )
+  {
+    hostDevAddr = setup->wValue & 0x7F;
+  }
+
+  return total;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Reset and enumerate the device, leaving it in the configured state.
+ *
+ * @param[in] devAddr
+ *   USB address to assign.
+ *
+ * @param[in] configValue
+ *   Configuration value to use with SET_CONFIGURATION.
+ *
+ * @param[in] timeout
+ *   Per transaction NAK timeout in milliseconds.
+ *
+ * @return
+ *   @ref USB_STATUS_OK or a negative USB_Status_TypeDef.
+ ******************************************************************************/
+int USBSIM_HostEnumerate( uint8_t devAddr, uint8_t configValue, int timeout )
+{
+  int r;
+  USB_Setup_TypeDef s;
+
+  if ( ( r = USBSIM_HostBusReset() ) != USB_STATUS_OK )
+    return r;
+
+  memset( &s, 0, sizeof( s ) );
+  s.Direction = USB_SETUP_DIR_IN;
+  s.bRequest  = GET_DESCRIPTOR;
+  s.wValue    = USB_DEVICE_DESCRIPTOR << 8;
+  s.wLength   = 8;
+  if ( ( r = USBSIM_HostControl( &s, hostCtrlBuf, timeout ) ) < 0 )
+    return r;
+
+  s.Direction = USB_SETUP_DIR_OUT;
+  s.bRequest  = SET_ADDRESS;
+  s.wValue    = devAddr;
+  s.wLength   = 0;
+  if ( ( r = USBSIM_HostControl( &s, NULL, timeout ) ) < 0 )
+    return r;
+
+  s.Direction = USB_SETUP_DIR_IN;
+  s.bRequest  = GET_DESCRIPTOR;
+  s.wValue    = USB_DEVICE_DESCRIPTOR << 8;
+  s.wLength   = USB_DEVICE_DESCSIZE;
+  if ( ( r = USBSIM_HostControl( &s, hostCtrlBuf, timeout ) ) < 0 )
+    return r;
+
+  s.wValue    = USB_CONFIG_DESCRIPTOR << 8;
+  s.wLength   = USB_CONFIG_DESCSIZE;
+  if ( ( r = USBSIM_HostControl( &s, hostCtrlBuf, timeout ) ) < 0 )
+    return r;
+
+  s.wLength   = EFM32_MIN( hostCtrlBuf[ 2 ] | ( hostCtrlBuf[ 3 ] << 8 ),
+                           (int)sizeof( hostCtrlBuf ) );
+  if ( ( r = USBSIM_HostControl( &s, hostCtrlBuf, timeout ) ) < 0 )
+    return r;
+
+  s.Direction = USB_SETUP_DIR_OUT;
+  s.bRequest  = SET_CONFIGURATION;
+  s.wValue    = configValue;
+  s.wLength   = 0;
+  if ( ( r = USBSIM_HostControl( &s, NULL, timeout ) ) < 0 )
+    return r;
+
+  return USB_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Read data from an IN endpoint.
+ *
+ * @details
+ *   Issues IN tokens until @p byteCount bytes are received or a short packet
+ *   ends the transfer.
+ *
+ * @return
+ *   Number of bytes received, or a negative USB_Status_TypeDef.
+ ******************************************************************************/
+int USBSIM_HostIn( uint8_t epAddr, void *data, int byteCount, int timeout )
+{
+  int r, mps, total = 0;
+  int epNum = epAddr & USB_EPNUM_MASK;
+  uint8_t *p = (uint8_t*)data;
+
+  if ( ( epNum == 0 ) || ( epNum >= EP_CNT ) )
+    return USB_STATUS_ILLEGAL;
+
+  mps = DevEpMps( true, epNum );
+  do
+  {
+    if ( byteCount - total < mps )
+    {
+      DEBUG_USB_API_PUTS( "\nUSBSIM_HostIn(), Buffer smaller than max packet" );
+      EFM_ASSERT( false );
+      return USB_STATUS_ILLEGAL;
+    }
+    r = HostXact( XACT_IN, epNum, p + total, 0, timeout );
+    if ( r < 0 )
+      return r;
+    total += r;
+  } while ( ( r == mps ) && ( total < byteCount ) );
+
+  return total;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Write data to an OUT endpoint.
+ *
+ * @details
+ *   The data is split in max packet size transactions. A zero length packet
+ *   is sent when @p byteCount is zero.
+ *
+ * @return
+ *   Number of bytes sent, or a negative USB_Status_TypeDef.
+ ******************************************************************************/
+int USBSIM_HostOut( uint8_t epAddr, const void *data, int byteCount, int timeout )
+{
+  int r, len, mps, total = 0;
+  int epNum = epAddr & USB_EPNUM_MASK;
+  uint8_t *p = (uint8_t*)data;
+
+  if ( ( epNum == 0 ) || ( epNum >= EP_CNT ) )
+    return USB_STATUS_ILLEGAL;
+
+  mps = DevEpMps( false, epNum );
+  do
+  {
+    len = EFM32_MIN( mps, byteCount - total );
+    r = HostXact( XACT_OUT, epNum, p + total, len, timeout );
+    if ( r < 0 )
+      return r;
+    total += len;
+  } while ( total < byteCount );
+
+  return total;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Wait for the start of the next frame.
+ *
+ * @details
+ *   The SOF interrupt is delivered before the function returns. Use this to
+ *   pace isochronous transactions, one per endpoint and frame.
+ *
+ * @return
+ *   The new frame number.
+ ******************************************************************************/
+uint32_t USBSIM_HostNextFrame( void )
+{
+  uint32_t frame;
+  uint64_t target;
+
+  pthread_mutex_lock( &hwLock );
+  frame  = frameNum;
+  target = (uint64_t)( frame + 1 ) * USBSIM_FRAME_US;
+  if ( demandUs < target )
+    demandUs = target;
+  while ( running && ( ( frameNum == frame ) || frameStarting ) )
+    pthread_cond_wait( &frameCond, &hwLock );
+  frame = frameNum;
+  pthread_mutex_unlock( &hwLock );
+
+  DeliverIrq();
+  return frame;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Issue one IN token to an isochronous endpoint in the current frame.
+ *
+ * @details
+ *   There is no handshake. If the endpoint is not armed for the current
+ *   frame the device answers with a zero length packet.
+ *
+ * @return
+ *   Number of bytes received, or a negative USB_Status_TypeDef.
+ ******************************************************************************/
+int USBSIM_HostIsocIn( uint8_t epAddr, void *data, int maxLen )
+{
+  int epNum = epAddr & USB_EPNUM_MASK;
+
+  if ( ( epNum == 0 ) || ( epNum >= EP_CNT ) ||
+       ( maxLen < DevEpMps( true, epNum ) )      )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBSIM_HostIsocIn(), Illegal parameter" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
+  return HostXact( XACT_IN, epNum, (uint8_t*)data, 0, 0 );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Send one packet to an isochronous endpoint in the current frame.
+ *
+ * @details
+ *   There is no handshake. If the endpoint is not armed for the current
+ *   frame the packet is lost, this is counted in
+ *   @ref USBSIM_Stats_TypeDef::isocMisses.
+ *
+ * @return
+ *   Number of bytes sent, or a negative USB_Status_TypeDef.
+ ******************************************************************************/
+int USBSIM_HostIsocOut( uint8_t epAddr, const void *data, int len )
+{
+  int r;
+  int epNum = epAddr & USB_EPNUM_MASK;
+
+  if ( ( epNum == 0 ) || ( epNum >= EP_CNT ) ||
+       ( len > DevEpMps( false, epNum ) )        )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBSIM_HostIsocOut(), Illegal parameter" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
+  r = HostXact( XACT_OUT, epNum, (uint8_t*)data, len, 0 );
+  return r < 0 ? r : len;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Suspend the bus.
+ ******************************************************************************/
+void USBSIM_HostSuspend( void )
+{
+  pthread_mutex_lock( &hwLock );
+  FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_USBSUSP );
+  pthread_mutex_unlock( &hwLock );
+  DeliverIrq();
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Drive resume signalling.
+ ******************************************************************************/
+void USBSIM_HostResume( void )
+{
+  pthread_mutex_lock( &hwLock );
+  FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_WKUPINT );
+  pthread_mutex_unlock( &hwLock );
+  DeliverIrq();
+}
+#endif /* defined( USB_DEVICE ) */
+
+#if defined( USB_HOST )
+/***************************************************************************//**
+ * @brief
+ *   Attach a scripted device to the host port.
+ *
+ * @param[in] device
+ *   Device definition, must remain valid until detached.
+ ******************************************************************************/
+void USBSIM_DeviceAttach( const USBSIM_Device_TypeDef *device )
+{
+  pthread_mutex_lock( &hwLock );
+  memset( &sdev, 0, sizeof( sdev ) );
+  sdev.dev      = device;
+  sdev.attached = true;
+  hub.present   = ( device == &hubDevice );
+  if ( hprtPub & USB_HPRT_PRTPWR )
+  {
+    HprtService( _USB_HPRT_PRTSPD_MASK,
+                 USB_HPRT_PRTCONNSTS | USB_HPRT_PRTCONNDET |
+                 ( device->lowSpeed ? HPRT_L_SPEED : HPRT_F_SPEED ) );
+  }
+  UpdateSummary();
+  pthread_mutex_unlock( &hwLock );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Detach the scripted device from the host port.
+ ******************************************************************************/
+void USBSIM_DeviceDetach( void )
+{
+  pthread_mutex_lock( &hwLock );
+  sdev.attached = false;
+  HprtService( USB_HPRT_PRTCONNSTS | USB_HPRT_PRTENA, 0 );
+  FlagsSet( &flags[ FL_GINTSTS ], USB_GINTSTS_DISCONNINT );
+  pthread_mutex_unlock( &hwLock );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the USB address assigned to the scripted device by the host stack.
+ ******************************************************************************/
+uint8_t USBSIM_DeviceGetAddress( void )
+{
+  return sdev.addr;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Attach the hub model to the host port.
+ *
+ * @details
+ *   The hub has one interrupt status change endpoint and per port power
+ *   switching. Devices are attached to its ports with
+ *   @ref USBSIM_HubPortAttach(), before or after the hub is attached.
+ *
+ * @param[in] numPorts
+ *   Number of downstream ports, 1..@ref USBSIM_HUB_MAX_PORTS.
+ ******************************************************************************/
+void USBSIM_HubAttach( int numPorts )
+{
+  EFM_ASSERT( ( numPorts >= 1 ) && ( numPorts <= USBSIM_HUB_MAX_PORTS ) );
+
+  pthread_mutex_lock( &hwLock );
+  hub.numPorts = EFM32_MIN( EFM32_MAX( numPorts, 1 ), USBSIM_HUB_MAX_PORTS );
+  HubReset();
+  pthread_mutex_unlock( &hwLock );
+
+  USBSIM_DeviceAttach( &hubDevice );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Attach a scripted device to a hub port.
+ *
+ * @param[in] port
+ *   Hub port number, 1..@ref USBSIM_HUB_MAX_PORTS.
+ *
+ * @param[in] device
+ *   Device definition, must remain valid until detached.
+ ******************************************************************************/
+void USBSIM_HubPortAttach( int port, const USBSIM_Device_TypeDef *device )
+{
+  int i = port - 1;
+
+  if ( ( i < 0 ) || ( i >= USBSIM_HUB_MAX_PORTS ) )
+  {
+    EFM_ASSERT( false );
+    return;
+  }
+
+  pthread_mutex_lock( &hwLock );
+  memset( &hub.port[ i ], 0, sizeof( hub.port[ i ] ) );
+  hub.port[ i ].dev      = device;
+  hub.port[ i ].attached = true;
+  if ( hub.status[ i ] & HUB_PS_POWER )
+    HubPortPower( i );
+  pthread_mutex_unlock( &hwLock );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Detach the scripted device from a hub port.
+ *
+ * @param[in] port
+ *   Hub port number, 1..@ref USBSIM_HUB_MAX_PORTS.
+ ******************************************************************************/
+void USBSIM_HubPortDetach( int port )
+{
+  int i = port - 1;
+
+  if ( ( i < 0 ) || ( i >= USBSIM_HUB_MAX_PORTS ) )
+  {
+    EFM_ASSERT( false );
+    return;
+  }
+
+  pthread_mutex_lock( &hwLock );
+  hub.port[ i ].attached = false;
+  if ( hub.status[ i ] & HUB_PS_CONNECTION )
+  {
+    hub.status[ i ] &= ~( HUB_PS_CONNECTION | HUB_PS_ENABLE |
+                          HUB_PS_SUSPEND    | HUB_PS_LOW_SPEED );
+    hub.change[ i ] |= HUB_PC( HUB_FEATURE_C_PORT_CONNECTION );
+  }
+  pthread_mutex_unlock( &hwLock );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Signal an overcurrent condition on a hub port, the port loses power.
+ *
+ * @param[in] port
+ *   Hub port number, 1..@ref USBSIM_HUB_MAX_PORTS.
+ ******************************************************************************/
+void USBSIM_HubPortOverCurrent( int port )
+{
+  int i = port - 1;
+
+  if ( ( i < 0 ) || ( i >= USBSIM_HUB_MAX_PORTS ) )
+  {
+    EFM_ASSERT( false );
+    return;
+  }
+
+  pthread_mutex_lock( &hwLock );
+  hub.status[ i ]  = HUB_PS_OVER_CURRENT;
+  hub.change[ i ] |= HUB_PC( HUB_FEATURE_C_PORT_OVER_CURRENT );
+  pthread_mutex_unlock( &hwLock );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the USB address assigned to the device on a hub port.
+ *
+ * @param[in] port
+ *   Hub port number, 1..@ref USBSIM_HUB_MAX_PORTS.
+ ******************************************************************************/
+uint8_t USBSIM_HubPortGetAddress( int port )
+{
+  if ( ( port < 1 ) || ( port > USBSIM_HUB_MAX_PORTS ) )
+    return 0;
+
+  return hub.port[ port - 1 ].addr;
+}
+#endif /* defined( USB_HOST ) */
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/*
+ * Interrupt lock, replaces PRIMASK, see em_int.h in this directory.
+ */
+uint32_t USBSIM_IntDisable( void )
+{
+  pthread_mutex_lock( &cpuLock );
+  return ++cpuLockCnt;
+}
+
+uint32_t USBSIM_IntEnable( void )
+{
+  uint32_t cnt = 0;
+
+  if ( cpuLockCnt )
+  {
+    cnt = --cpuLockCnt;
+    pthread_mutex_unlock( &cpuLock );
+  }
+  return cnt;
+}
+
+void USBSIM_NvicClearPendingIRQ( IRQn_Type irq )
+{
+  (void)irq;
+}
+
+void USBSIM_NvicDisableIRQ( IRQn_Type irq )
+{
+  if ( irq == USB_IRQn )
+    usbIrqEnabled = false;
+}
+
+void USBSIM_NvicEnableIRQ( IRQn_Type irq )
+{
+  if ( irq == USB_IRQn )
+    usbIrqEnabled = true;
+}
+
+/*
+ * USBTIMER API, replaces em_usbtimer.c. Time is simulated time.
+ */
+void USBTIMER_Init( void )
+{
+}
+
+void USBTIMER_DelayMs( uint32_t msec )
+{
+  SimWaitUs( (uint64_t)msec * 1000 );
+}
+
+void USBTIMER_DelayUs( uint32_t usec )
+{
+  SimWaitUs( usec );
+}
+
+#if ( NUM_QTIMERS > 0 )
+void USBTIMER_Start( uint32_t id, uint32_t timeout,
+                     USBTIMER_Callback_TypeDef callback )
+{
+  if ( id >= NUM_QTIMERS )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBTIMER_Start(), Illegal timer id" );
+    EFM_ASSERT( false );
+    return;
+  }
+
+  if ( timeout == 0 )
+  {
+    callback();
+    return;
+  }
+
+  INT_Disable();
+  timers[ id ].running  = true;
+  timers[ id ].expires  = msTicks + timeout;
+  timers[ id ].callback = callback;
+  INT_Enable();
+}
+
+void USBTIMER_Stop( uint32_t id )
+{
+  if ( id >= NUM_QTIMERS )
+    return;
+
+  INT_Disable();
+  timers[ id ].running = false;
+  INT_Enable();
+}
+#endif /* ( NUM_QTIMERS > 0 ) */
+
+/*
+ * emlib CMU and GPIO functions used by the USB stack.
+ */
+void CMU_ClockEnable( CMU_Clock_TypeDef clock, bool enable )
+{
+  (void)clock;
+  (void)enable;
+}
+
+uint32_t CMU_ClockFreqGet( CMU_Clock_TypeDef clock )
+{
+  (void)clock;
+  return 48000000;
+}
+
+CMU_Select_TypeDef CMU_ClockSelectGet( CMU_Clock_TypeDef clock )
+{
+  (void)clock;
+  return cmuSelect_HFXO;
+}
+
+void CMU_ClockSelectSet( CMU_Clock_TypeDef clock, CMU_Select_TypeDef ref )
+{
+  (void)clock;
+  (void)ref;
+}
+
+void CMU_OscillatorEnable( CMU_Osc_TypeDef osc, bool enable, bool wait )
+{
+  (void)osc;
+  (void)enable;
+  (void)wait;
+}
+
+void GPIO_PinModeSet( GPIO_Port_TypeDef port, unsigned int pin,
+                      GPIO_Mode_TypeDef mode, unsigned int out )
+{
+  (void)port;
+  (void)pin;
+  (void)mode;
+  (void)out;
+}
+
+/** @endcond */
+
+/** @} (end addtogroup USB_SIM) */
+/** @} (end addtogroup USB) */
+
+#endif /* defined( USB_DEVICE ) || defined( USB_HOST ) */
@@ -0,0 +1,165 @@
+/***************************************************************************//**
+ * @file em_usbsim.h
+ * @brief USB core simulation, model API for host side testing of the stack.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifndef __EM_USBSIM_H
+#define __EM_USBSIM_H
+
+#include "em_device.h"
+#include "em_usb.h"
+#if defined( USB_DEVICE ) || defined( USB_HOST )
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup USB
+ * @{
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup USB_SIM
+ * @brief Simulated USB OTG core, see @ref usb_sim page for documentation.
+ * @{
+ ******************************************************************************/
+
+/* Handshake codes returned by scripted device callbacks. */
+#define USBSIM_ACK            0       /**< Transaction accepted.                  */
+#define USBSIM_NAK            -1      /**< Endpoint not ready, retry later.       */
+#define USBSIM_STALL          -2      /**< Endpoint (or request) stalled.         */
+#define USBSIM_UNHANDLED      -3      /**< Setup request not handled by callback. */
+
+/* Full speed bus timing used by the frame scheduler. */
+#define USBSIM_FRAME_US       1000    /**< Length of a full speed frame.          */
+#define USBSIM_FRAME_BYTES    1500    /**< Raw bit time per frame, in bytes.      */
+#define USBSIM_XACT_OVERHEAD  13      /**< Token, handshake, CRC and SYNC bytes.  */
+
+#define USBSIM_MAX_EP_NUM     15      /**< Highest endpoint number on the bus.    */
+
+/** @brief Counters maintained by the model. */
+typedef struct
+{
+  uint32_t  frames;                   /**< Number of frames (SOF's) on the bus.           */
+  uint32_t  irqCount;                 /**< Number of USB_IRQHandler() invocations.        */
+  uint64_t  irqTimeNs;                /**< Host time spent inside USB_IRQHandler().       */
+  uint32_t  timerTicks;               /**< Number of 1 ms USBTIMER ticks serviced.        */
+  uint32_t  setupXacts;               /**< SETUP transactions.                            */
+  uint32_t  inXacts;                  /**< IN transactions carrying data (ACK'ed).        */
+  uint32_t  outXacts;                 /**< OUT transactions carrying data (ACK'ed).       */
+  uint32_t  naks;                     /**< NAK handshakes.                                */
+  uint32_t  fifoNaks;                 /**< NAK's due to FIFO occupancy.                  */
+  uint32_t  stalls;                   /**< STALL handshakes.                              */
+  uint32_t  timeouts;                 /**< Transactions with no response.                 */
+  uint32_t  isocMisses;               /**< Isochronous tokens to an unarmed endpoint.     */
+  uint64_t  epInBytes[  USBSIM_MAX_EP_NUM + 1 ];  /**< Payload bytes, IN per endpoint number.  */
+  uint64_t  epOutBytes[ USBSIM_MAX_EP_NUM + 1 ];  /**< Payload bytes, OUT per endpoint number. */
+  uint32_t  epInIrqs[   USBSIM_MAX_EP_NUM + 1 ];  /**< Transfer complete events per IN ep.     */
+  uint32_t  epOutIrqs[  USBSIM_MAX_EP_NUM + 1 ];  /**< Transfer complete events per OUT ep.    */
+} USBSIM_Stats_TypeDef;
+
+void      USBSIM_Init(       void );
+void      USBSIM_Stop(       void );
+uint64_t  USBSIM_GetTimeUs(  void );
+void      USBSIM_RunMs(      uint32_t msec );
+void      USBSIM_SetFreeRun( bool on );
+void      USBSIM_GetStats(   USBSIM_Stats_TypeDef *stats );
+void      USBSIM_ClearStats( void );
+
+#if defined( USB_DEVICE )
+/** @addtogroup USB_SIM
+ *  @{*/
+/*** -------------------- Scripted host (device mode) -------------------- ***/
+
+void  USBSIM_VbusSet(       bool on );
+void  USBSIM_SetDmaRate(    uint32_t bytesPerFrame );
+int   USBSIM_HostBusReset(  void );
+int   USBSIM_HostControl(   const USB_Setup_TypeDef *setup, void *data, int timeout );
+int   USBSIM_HostEnumerate( uint8_t devAddr, uint8_t configValue, int timeout );
+int   USBSIM_HostIn(        uint8_t epAddr, void *data, int byteCount, int timeout );
+int   USBSIM_HostOut(       uint8_t epAddr, const void *data, int byteCount, int timeout );
+uint32_t USBSIM_HostNextFrame( void );
+int   USBSIM_HostIsocIn(    uint8_t epAddr, void *data, int maxLen );
+int   USBSIM_HostIsocOut(   uint8_t epAddr, const void *data, int len );
+void  USBSIM_HostSuspend(   void );
+void  USBSIM_HostResume(    void );
+/** @} (end addtogroup USB_SIM) */
+#endif /* defined( USB_DEVICE ) */
+
+#if defined( USB_HOST )
+/** @addtogroup USB_SIM
+ *  @{*/
+/*** -------------------- Scripted device (host mode) -------------------- ***/
+
+/***************************************************************************//**
+ * @brief
+ *  Scripted device setup request callback.
+ *
+ * @details
+ *  Called when the host stack sends a SETUP packet. For IN requests, place up
+ *  to @p maxLen bytes in @p data and return the byte count. For OUT requests
+ *  the data stage payload is delivered through the out callback on endpoint 0.
+ *  Return @ref USBSIM_UNHANDLED to let the model answer standard requests from
+ *  the descriptors in @ref USBSIM_Device_TypeDef, or @ref USBSIM_STALL.
+ ******************************************************************************/
+typedef int  (*USBSIM_SetupCb_TypeDef)( const USB_Setup_TypeDef *setup, uint8_t *data, int maxLen );
+
+/***************************************************************************//**
+ * @brief
+ *  Scripted device IN token callback. Return number of bytes placed in
+ *  @p data (max @p maxLen), @ref USBSIM_NAK or @ref USBSIM_STALL.
+ ******************************************************************************/
+typedef int  (*USBSIM_InCb_TypeDef)(    uint8_t epNum, uint8_t *data, int maxLen );
+
+/***************************************************************************//**
+ * @brief
+ *  Scripted device OUT token callback. Return @ref USBSIM_ACK, @ref USBSIM_NAK
+ *  or @ref USBSIM_STALL.
+ ******************************************************************************/
+typedef int  (*USBSIM_OutCb_TypeDef)(   uint8_t epNum, const uint8_t *data, int len );
+
+/** @brief Scripted device definition, passed to @ref USBSIM_DeviceAttach(). */
+typedef struct
+{
+  bool                                        lowSpeed;          /**< Attach as a low speed device.           */
+  const USB_DeviceDescriptor_TypeDef          *deviceDescriptor; /**< Device descriptor, may be NULL.         */
+  const uint8_t                               *configDescriptor; /**< Configuration descriptor, may be NULL.  */
+  USBSIM_SetupCb_TypeDef                      setup;             /**< Setup request callback, may be NULL.    */
+  USBSIM_InCb_TypeDef                         in;                /**< IN token callback, may be NULL.         */
+  USBSIM_OutCb_TypeDef                        out;               /**< OUT token callback, may be NULL.        */
+} USBSIM_Device_TypeDef;
+
+void  USBSIM_DeviceAttach(     const USBSIM_Device_TypeDef *device );
+void  USBSIM_DeviceDetach(     void );
+uint8_t USBSIM_DeviceGetAddress( void );
+
+#define USBSIM_HUB_MAX_PORTS  7       /**< Max number of hub model ports.         */
+
+void  USBSIM_HubAttach(          int numPorts );
+void  USBSIM_HubPortAttach(      int port, const USBSIM_Device_TypeDef *device );
+void  USBSIM_HubPortDetach(      int port );
+void  USBSIM_HubPortOverCurrent( int port );
+uint8_t USBSIM_HubPortGetAddress( int port );
+/** @} (end addtogroup USB_SIM) */
+#endif /* defined( USB_HOST ) */
+
+/** @} (end addtogroup USB_SIM) */
+/** @} (end addtogroup USB) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* defined( USB_DEVICE ) || defined( USB_HOST ) */
+#endif /* __EM_USBSIM_H */
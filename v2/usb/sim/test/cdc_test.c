@@ -0,0 +1,310 @@
+/***************************************************************************//**
+ * @file cdc_test.c
+ * @brief USB core model test of the DK3750 CDC serial port example.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/*
+ * The example bridges USB and UART1 with two DMA channels. Here UART1 and
+ * the DMA controller are modelled in RAM, and the UART Tx line is looped back
+ * to its Rx line: a USBTIMER timer moves as many characters per millisecond
+ * as the baudrate set with SET_LINE_CODING allows, from the channel 0 source
+ * buffer to the channel 1 destination buffer, and calls the DMA completion
+ * callbacks as the DMA interrupt handler would. A scripted host writes blocks
+ * of data to the bulk OUT endpoint and reads the echo back from the bulk IN
+ * endpoint.
+ *
+ * Build and run from the v2 directory:
+ *
+ * gcc -O2 -no-pie -DEFM32GG990F1024 -DDEBUG_EFM_USER -DUSBSIM_TEST_DEVICE \
+ *     -DNUM_EP_USED=3 -DNUM_APP_TIMERS=2 \
+ *     -Iusb/sim -Iusb/sim/test -Iusb/inc -Iemlib/inc \
+ *     -IDevice/SiliconLabs/EFM32GG/Include -ICMSIS/Include \
+ *     -Ikits/common/bsp -Ikits/common/drivers -Ikits/EFM32GG_DK3750/config \
+ *     usb/src/em_usbd.c usb/src/em_usbdch9.c usb/src/em_usbdep.c \
+ *     usb/src/em_usbdint.c usb/src/em_usbhal.c usb/sim/em_usbsim.c \
+ *     kits/common/drivers/dmactrl.c \
+ *     usb/sim/test/usbsim_test.c usb/sim/test/cdc_test.c \
+ *     -o cdc_test -lpthread && ./cdc_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "usbsim_test.h"
+#include "em_dma.h"
+#include "em_usart.h"
+
+/* UART1 and the DMA controller registers, modelled in RAM. */
+static USART_TypeDef uart1Regs;
+static DMA_TypeDef   dmaRegs;
+
+#undef  UART1
+#define UART1 ( &uart1Regs )
+#undef  DMA
+#define DMA   ( &dmaRegs )
+
+#define main cdc_main
+#include "../../../kits/EFM32GG_DK3750/examples/usbdcdc/main.c"
+#undef main
+
+#define UART_TIMER      1         /* USBTIMER id of the UART model.         */
+#define UART_RX_DEPTH   3         /* Rx buffer and shift register, chars.   */
+#define BAUDRATE        921600
+#define ECHO_BLOCKS     256
+
+typedef struct
+{
+  DMA_CB_TypeDef  *cb;
+  uint8_t         *dst;
+  uint8_t         *src;
+  bool            dstInc;
+  bool            srcInc;
+  bool            active;
+  int             remaining;
+} DmaCh_TypeDef;
+
+static DmaCh_TypeDef  dmaCh[ 2 ];
+static uint32_t       charsPerMs;
+static uint8_t        rxFifo[ UART_RX_DEPTH ];
+static int            rxCount;
+static uint32_t       rxOverruns;
+
+STATIC_UBUF( hostTx, USB_TX_BUF_SIZ );
+STATIC_UBUF( hostRx, USB_TX_BUF_SIZ + 1 );
+
+/*
+ * Board support and emlib functions used by the example.
+ */
+int BSP_Init( uint32_t flags )
+{
+  (void)flags;
+  return BSP_STATUS_OK;
+}
+
+bool BSP_TraceProfilerSetup( void )
+{
+  return false;
+}
+
+int BSP_PeripheralAccess( BSP_Peripheral_TypeDef perf, bool enable )
+{
+  (void)perf;
+  (void)enable;
+  return BSP_STATUS_OK;
+}
+
+void USART_InitAsync( USART_TypeDef *usart, const USART_InitAsync_TypeDef *init )
+{
+  USART_BaudrateAsyncSet( usart, 0, init->baudrate, init->oversampling );
+}
+
+void USART_Enable( USART_TypeDef *usart, USART_Enable_TypeDef enable )
+{
+  (void)usart;
+  (void)enable;
+}
+
+/* Ten bit times per character with 8N1 framing. */
+void USART_BaudrateAsyncSet( USART_TypeDef *usart, uint32_t refFreq,
+                             uint32_t baudrate, USART_OVS_TypeDef ovs )
+{
+  (void)usart;
+  (void)refFreq;
+  (void)ovs;
+  charsPerMs = EFM32_MAX( baudrate / 10000, 1 );
+}
+
+void DMA_Init( DMA_Init_TypeDef *init )
+{
+  (void)init;
+  memset( dmaCh, 0, sizeof( dmaCh ) );
+}
+
+void DMA_CfgChannel( unsigned int channel, DMA_CfgChannel_TypeDef *cfg )
+{
+  dmaCh[ channel ].cb = cfg->cb;
+}
+
+void DMA_CfgDescr( unsigned int channel, bool primary, DMA_CfgDescr_TypeDef *cfg )
+{
+  (void)primary;
+  dmaCh[ channel ].dstInc = cfg->dstInc != dmaDataIncNone;
+  dmaCh[ channel ].srcInc = cfg->srcInc != dmaDataIncNone;
+}
+
+void DMA_ActivateBasic( unsigned int channel, bool primary, bool useBurst,
+                        void *dst, void *src, unsigned int nMinus1 )
+{
+  DmaCh_TypeDef *ch = &dmaCh[ channel ];
+
+  (void)primary;
+  (void)useBurst;
+  ch->dst       = dst;
+  ch->src       = src;
+  ch->remaining = nMinus1 + 1;
+  ch->active    = true;
+  dmaRegs.CHENC &= ~( 1 << channel );
+  dmaControlBlock[ channel ].CTRL = ( nMinus1 << _DMA_CTRL_N_MINUS_1_SHIFT ) |
+                                    DMA_CTRL_CYCLE_CTRL_BASIC;
+}
+
+/* A channel runs until its cycle completes or it is disabled with CHENC. */
+static bool DmaRequest( int channel )
+{
+  if ( dmaRegs.CHENC & ( 1 << channel ) )
+  {
+    dmaCh[ channel ].active = false;
+    dmaRegs.CHENC &= ~( 1 << channel );
+  }
+  return dmaCh[ channel ].active;
+}
+
+/* One element moved, update the descriptor and signal cycle completion. */
+static void DmaTransferDone( int channel )
+{
+  DmaCh_TypeDef *ch = &dmaCh[ channel ];
+
+  if ( ch->dstInc )
+    ch->dst++;
+  if ( ch->srcInc )
+    ch->src++;
+
+  if ( --ch->remaining )
+  {
+    dmaControlBlock[ channel ].CTRL =
+      ( dmaControlBlock[ channel ].CTRL & ~_DMA_CTRL_N_MINUS_1_MASK ) |
+      ( ( ch->remaining - 1 ) << _DMA_CTRL_N_MINUS_1_SHIFT );
+  }
+  else
+  {
+    ch->active = false;
+    dmaControlBlock[ channel ].CTRL = DMA_CTRL_CYCLE_CTRL_INVALID;
+    if ( ch->cb && ch->cb->cbFunc )
+      ch->cb->cbFunc( channel, true, ch->cb->userPtr );
+  }
+}
+
+/*
+ * UART1 with Tx looped back to Rx, run from a USBTIMER timer every
+ * millisecond. The timer callback holds the interrupt lock, as the DMA
+ * interrupt handler would.
+ */
+static void UartLoopback( void )
+{
+  uint32_t i;
+
+  for ( i = 0; i < charsPerMs; i++ )
+  {
+    if ( DmaRequest( 0 ) )
+    {
+      if ( rxCount < UART_RX_DEPTH )
+        rxFifo[ rxCount++ ] = *dmaCh[ 0 ].src;
+      else
+        rxOverruns++;
+      DmaTransferDone( 0 );
+    }
+
+    while ( rxCount && DmaRequest( 1 ) )
+    {
+      *dmaCh[ 1 ].dst = rxFifo[ 0 ];
+      memmove( rxFifo, rxFifo + 1, --rxCount );
+      DmaTransferDone( 1 );
+    }
+  }
+  USBTIMER_Start( UART_TIMER, 1, UartLoopback );
+}
+
+/* CDC class requests without data stage, or with the line coding. */
+static int CdcRequest( uint8_t bRequest, bool in, uint16_t wValue,
+                       void *data, uint16_t wLength )
+{
+  USB_Setup_TypeDef setup;
+
+  memset( &setup, 0, sizeof( setup ) );
+  setup.Direction = in ? USB_SETUP_DIR_IN : USB_SETUP_DIR_OUT;
+  setup.Type      = USB_SETUP_TYPE_CLASS;
+  setup.Recipient = USB_SETUP_RECIPIENT_INTERFACE;
+  setup.bRequest  = bRequest;
+  setup.wValue    = wValue;
+  setup.wLength   = wLength;
+  return USBSIM_HostControl( &setup, data, USBSIMTEST_TIMEOUT );
+}
+
+int main( void )
+{
+  int i, r, got;
+  bool echoOk = true;
+  uint8_t lineCoding[ 7 ] = { BAUDRATE & 0xFF, ( BAUDRATE >> 8 ) & 0xFF,
+                              BAUDRATE >> 16, 0, 0, 0, 8 };
+  uint8_t lineCodingIn[ 8 ];
+  USBSIMTEST_Mark_TypeDef mark;
+  USBSIM_Stats_TypeDef s;
+  uint32_t packets;
+
+  USBSIM_Init();
+  SerialPortInit();
+  DmaSetup();
+  USBD_Init( &initstruct );
+  USBTIMER_Start( UART_TIMER, 1, UartLoopback );
+  USBSIM_VbusSet( true );
+
+  USBSIMTEST_Start( &mark );
+  r = USBSIM_HostEnumerate( 1, 1, USBSIMTEST_TIMEOUT );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "enumeration" );
+  USBSIM_GetStats( &s );
+  USBSIMTEST_Report( "enumeration time", USBSIMTEST_ElapsedUs( &mark ) / 1000.0, "ms" );
+  USBSIMTEST_Report( "enumeration interrupts", s.irqCount - mark.stats.irqCount, "" );
+
+  /* The requests a CDC ACM host driver issues when the port is opened. */
+  r = CdcRequest( USB_CDC_SETLINECODING, false, 0, lineCoding, 7 );
+  USBSIMTEST_Check( r == 7, "SET_LINE_CODING" );
+  r = CdcRequest( USB_CDC_GETLINECODING, true, 0, lineCodingIn, 7 );
+  USBSIMTEST_Check( ( r == 7 ) && !memcmp( lineCodingIn, lineCoding, 7 ),
+                    "GET_LINE_CODING" );
+  r = CdcRequest( USB_CDC_SETCTRLLINESTATE, false, 3, NULL, 0 );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "SET_CONTROL_LINE_STATE" );
+
+  /* Blocks of one UART Rx DMA cycle, each echoed in one USB transfer. */
+  USBSIMTEST_Start( &mark );
+  for ( i = 0; i < ECHO_BLOCKS; i++ )
+  {
+    USBSIMTEST_Fill( hostTx, USB_TX_BUF_SIZ, i );
+    r = USBSIM_HostOut( EP_DATA_OUT, hostTx, USB_TX_BUF_SIZ, USBSIMTEST_TIMEOUT );
+    echoOk = echoOk && ( r == USB_TX_BUF_SIZ );
+
+    for ( got = 0; echoOk && ( got < USB_TX_BUF_SIZ ); got += r )
+    {
+      r = USBSIM_HostIn( EP_DATA_IN, hostRx + got, USB_TX_BUF_SIZ + 1 - got,
+                         USBSIMTEST_TIMEOUT );
+      echoOk = r > 0;
+    }
+    echoOk = echoOk && ( got == USB_TX_BUF_SIZ ) &&
+             !memcmp( hostTx, hostRx, USB_TX_BUF_SIZ );
+  }
+  USBSIM_GetStats( &s );
+  USBSIMTEST_Check( echoOk, "loopback data" );
+  USBSIMTEST_Check( rxOverruns == 0, "UART Rx overruns" );
+
+  packets = ( s.inXacts - mark.stats.inXacts ) +
+            ( s.outXacts - mark.stats.outXacts );
+  USBSIMTEST_Report( "loopback throughput",
+                     (double)ECHO_BLOCKS * USB_TX_BUF_SIZ * USBSIM_FRAME_US /
+                     USBSIMTEST_ElapsedUs( &mark ), "bytes/frame" );
+  USBSIMTEST_Report( "UART line capacity", charsPerMs, "bytes/frame" );
+  USBSIMTEST_Report( "interrupts per packet (incl. SOF)",
+                     (double)( s.irqCount - mark.stats.irqCount ) / packets, "" );
+  USBSIMTEST_Report( "NAK's per packet",
+                     (double)( s.naks - mark.stats.naks ) / packets, "" );
+
+  return USBSIMTEST_Done( "cdc_test" );
+}
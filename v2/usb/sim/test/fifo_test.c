@@ -0,0 +1,312 @@
+/***************************************************************************//**
+ * @file fifo_test.c
+ * @brief USB core model test of the device endpoint FIFO RAM accounting.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/*
+ * A composite device with four small interrupt IN endpoints and two
+ * isochronous OUT endpoints is sized to fill the FIFO RAM to the last word.
+ * Each interrupt endpoint needs two words, but gets a Tx FIFO of
+ * MIN_EP_FIFO_SIZE_INWORDS. USBD_ClassInit() must accept this configuration
+ * and reject the same one with a single word more, and the FIFOs programmed
+ * by USBDHAL_CoreInit() must end at the top of FIFO RAM.
+ *
+ * The device is then shrunk, given buffering multipliers computed by
+ * USBD_FifoLayout() from a traffic profile, and the FIFO size registers
+ * are compared with the layout USBD_FifoLayout() assumed.
+ *
+ * The rejected configuration trips an EFM_ASSERT() in USBD_ClassInit(), so
+ * this test is built without DEBUG_EFM_USER. Build and run from the v2
+ * directory:
+ *
+ * gcc -O2 -no-pie -DEFM32GG990F1024 -DUSBSIM_TEST_DEVICE \
+ *     -DNUM_EP_USED=6 -DNUM_APP_TIMERS=1 \
+ *     -Iusb/sim -Iusb/sim/test -Iusb/inc -Iemlib/inc \
+ *     -IDevice/SiliconLabs/EFM32GG/Include -ICMSIS/Include \
+ *     usb/src/em_usbd.c usb/src/em_usbdch9.c usb/src/em_usbdep.c \
+ *     usb/src/em_usbdint.c usb/src/em_usbhal.c usb/src/em_usbdclass.c \
+ *     usb/sim/em_usbsim.c \
+ *     usb/sim/test/usbsim_test.c usb/sim/test/fifo_test.c \
+ *     -o fifo_test -lpthread && ./fifo_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "usbsim_test.h"
+#include "em_usbtypes.h"
+#include "em_usbhal.h"
+#include "em_usbd.h"
+#include "em_usbdclass.h"
+
+#define INTR_EPS        4         /* Interrupt IN endpoints, 8 bytes each.  */
+#define ISOC_BIG_SIZE   1020      /* First isochronous OUT endpoint.        */
+#define ISOC_LIMIT_SIZE 532       /* Second one, FIFO RAM exactly full.     */
+#define ISOC_SMALL_SIZE 256       /* Second one, room for more buffering.   */
+
+EFM32_ALIGN(4)
+static const USB_DeviceDescriptor_TypeDef deviceDesc __attribute__ ((aligned(4)))=
+{
+  .bLength            = USB_DEVICE_DESCSIZE,
+  .bDescriptorType    = USB_DEVICE_DESCRIPTOR,
+  .bcdUSB             = 0x0200,
+  .bDeviceClass       = USB_CLASS_MISCELLANEOUS,
+  .bDeviceSubClass    = USB_CLASS_MISC_COMMON_SUBCLASS,
+  .bDeviceProtocol    = USB_CLASS_MISC_IAD_PROTOCOL,
+  .bMaxPacketSize0    = USB_EP0_SIZE,
+  .idVendor           = 0x10C4,
+  .idProduct          = 0x0008,
+  .bcdDevice          = 0x0000,
+  .iManufacturer      = 0,
+  .iProduct           = 0,
+  .iSerialNumber      = 0,
+  .bNumConfigurations = 1
+};
+
+#define INTR_IN_EP                                                            \
+  USB_ENDPOINT_DESCSIZE,  /* bLength               */                         \
+  USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */                         \
+  USB_SETUP_DIR_D2H,      /* bEndpointAddress (IN) */                         \
+  USB_EPTYPE_INTR,        /* bmAttributes          */                         \
+  8,                      /* wMaxPacketSize (LSB)  */                         \
+  0,                      /* wMaxPacketSize (MSB)  */                         \
+  1                       /* bInterval             */
+
+static const uint8_t intrDesc[] =
+{
+  USB_INTERFACE_DESCSIZE, /* bLength               */
+  USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
+  0,                      /* bInterfaceNumber      */
+  0,                      /* bAlternateSetting     */
+  INTR_EPS,               /* bNumEndpoints         */
+  0xFF,                   /* bInterfaceClass       */
+  0,                      /* bInterfaceSubClass    */
+  0,                      /* bInterfaceProtocol    */
+  0,                      /* iInterface            */
+
+  INTR_IN_EP,
+  INTR_IN_EP,
+  INTR_IN_EP,
+  INTR_IN_EP,
+};
+
+/* The wMaxPacketSize of the second endpoint is patched by the test. */
+static uint8_t isocDesc[] =
+{
+  USB_INTERFACE_DESCSIZE, /* bLength               */
+  USB_INTERFACE_DESCRIPTOR,/* bDescriptorType      */
+  0,                      /* bInterfaceNumber      */
+  0,                      /* bAlternateSetting     */
+  2,                      /* bNumEndpoints         */
+  0xFF,                   /* bInterfaceClass       */
+  0,                      /* bInterfaceSubClass    */
+  0,                      /* bInterfaceProtocol    */
+  0,                      /* iInterface            */
+
+  USB_ENDPOINT_DESCSIZE,  /* bLength               */
+  USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
+  USB_SETUP_DIR_H2D,      /* bEndpointAddress (OUT)*/
+  USB_EPTYPE_ISOC,        /* bmAttributes          */
+  ISOC_BIG_SIZE & 0xFF,   /* wMaxPacketSize (LSB)  */
+  ISOC_BIG_SIZE >> 8,     /* wMaxPacketSize (MSB)  */
+  1,                      /* bInterval             */
+
+  USB_ENDPOINT_DESCSIZE,  /* bLength               */
+  USB_ENDPOINT_DESCRIPTOR,/* bDescriptorType       */
+  USB_SETUP_DIR_H2D,      /* bEndpointAddress (OUT)*/
+  USB_EPTYPE_ISOC,        /* bmAttributes          */
+  0,                      /* wMaxPacketSize (LSB)  */
+  0,                      /* wMaxPacketSize (MSB)  */
+  1,                      /* bInterval             */
+};
+
+#define ISOC_MPS_OFFSET ( USB_INTERFACE_DESCSIZE + USB_ENDPOINT_DESCSIZE + 4 )
+
+static const USBD_ClassDriver_TypeDef nullDriver;
+
+static USBD_ClassFunction_TypeDef intrFn =
+{
+  .driver            = &nullDriver,
+  .descriptors       = intrDesc,
+  .descriptorsLength = sizeof( intrDesc ),
+};
+
+static USBD_ClassFunction_TypeDef isocFn =
+{
+  .driver            = &nullDriver,
+  .descriptors       = isocDesc,
+  .descriptorsLength = sizeof( isocDesc ),
+};
+
+static USBD_ClassFunction_TypeDef * const functions[] = { &intrFn, &isocFn };
+
+STATIC_UBUF( configBuf, 128 );
+
+static const USBD_ClassInit_TypeDef classInit =
+{
+  .deviceDescriptor = &deviceDesc,
+  .bmAttributes     = CONFIG_DESC_BM_SELFPOWERED,
+  .bMaxPower        = CONFIG_DESC_MAXPOWER_mA( 100 ),
+  .functions        = functions,
+  .numFunctions     = 2,
+  .configBuffer     = configBuf,
+  .configBufferSize = sizeof( configBuf ),
+};
+
+/* One word past the highest FIFO programmed, from the FIFO size registers. */
+static int FifoEnd( void )
+{
+  int i, end, fifo;
+
+  end = ( ( USB->GNPTXFSIZ & _USB_GNPTXFSIZ_NPTXFSTADDR_MASK )
+          >> _USB_GNPTXFSIZ_NPTXFSTADDR_SHIFT )
+        + ( ( USB->GNPTXFSIZ & _USB_GNPTXFSIZ_NPTXFINEPTXF0DEP_MASK )
+            >> _USB_GNPTXFSIZ_NPTXFINEPTXF0DEP_SHIFT );
+
+  for ( i = 1; i <= NUM_EP_USED; i++ )
+  {
+    if ( dev->ep[ i ].in )
+    {
+      fifo = USB_DIEPTXFS[ dev->ep[ i ].txFifoNum - 1 ];
+      end  = EFM32_MAX( end,
+               (int)( ( fifo & _USB_DIEPTXF1_INEPNTXFSTADDR_MASK )
+                      + ( ( fifo & _USB_DIEPTXF1_INEPNTXFDEP_MASK )
+                          >> _USB_DIEPTXF1_INEPNTXFDEP_SHIFT ) ) );
+    }
+  }
+
+  return end;
+}
+
+/* Compare the FIFO size registers with the layout of a multiplier array. */
+static void CheckLayout( const uint8_t *mult, int wordsLeft )
+{
+  int i, rx, depth, end;
+  char msg[ 80 ];
+  USBD_Ep_TypeDef *ep;
+
+  rx = USBD_Ep0FifoWords( deviceDesc.bMaxPacketSize0 )
+       - USBD_EpFifoWords( true, deviceDesc.bMaxPacketSize0, 1 );
+
+  for ( i = 1; i <= NUM_EP_USED; i++ )
+  {
+    ep = &dev->ep[ i ];
+    if ( ep->in )
+    {
+      depth = ( USB_DIEPTXFS[ ep->txFifoNum - 1 ] &
+                _USB_DIEPTXF1_INEPNTXFDEP_MASK    ) >>
+              _USB_DIEPTXF1_INEPNTXFDEP_SHIFT;
+      snprintf( msg, sizeof( msg ), "EP 0x%02X Tx FIFO depth %d, layout %d",
+                ep->addr, depth,
+                USBD_EpFifoWords( true, ep->packetSize, mult[ i ] ) );
+      USBSIMTEST_Check(
+        depth == USBD_EpFifoWords( true, ep->packetSize, mult[ i ] ), msg );
+    }
+    else
+    {
+      rx += USBD_EpFifoWords( false, ep->packetSize, mult[ i ] );
+    }
+  }
+
+  depth = ( USB->GRXFSIZ & _USB_GRXFSIZ_RXFDEP_MASK ) >>
+          _USB_GRXFSIZ_RXFDEP_SHIFT;
+  snprintf( msg, sizeof( msg ), "Rx FIFO depth %d, layout %d", depth, rx );
+  USBSIMTEST_Check( depth == rx, msg );
+
+  end = FifoEnd();
+  snprintf( msg, sizeof( msg ), "FIFOs end at %d, layout leaves %d of %d",
+            end, wordsLeft, (int)MAX_DEVICE_FIFO_SIZE_INWORDS );
+  USBSIMTEST_Check( end == (int)MAX_DEVICE_FIFO_SIZE_INWORDS - wordsLeft, msg );
+}
+
+static void SetIsocSize( int size )
+{
+  isocDesc[ ISOC_MPS_OFFSET     ] = size & 0xFF;
+  isocDesc[ ISOC_MPS_OFFSET + 1 ] = size >> 8;
+}
+
+int main( void )
+{
+  int r, i;
+  uint8_t mult[ NUM_EP_USED + 1 ];
+  char msg[ 80 ];
+  USBD_EpTraffic_TypeDef traffic[ 2 ];
+
+  USBSIM_Init();
+
+  /* One word over the limit, must be rejected before the core is set up. */
+  SetIsocSize( ISOC_LIMIT_SIZE + 4 );
+  r = USBD_ClassInit( &classInit );
+  USBSIMTEST_Check( r == USB_STATUS_ILLEGAL, "FIFO RAM + 1 word rejected" );
+  USBSIMTEST_Report( "FIFO RAM + 1 word, usage",
+                     USBD_ClassGetFifoUsage() / 4, "words" );
+
+  /* Exactly at the limit. */
+  SetIsocSize( ISOC_LIMIT_SIZE );
+  r = USBD_ClassInit( &classInit );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "FIFO RAM full accepted" );
+  USBSIMTEST_Report( "FIFO RAM full, usage",
+                     USBD_ClassGetFifoUsage() / 4, "words" );
+  USBSIMTEST_Check( USBD_ClassGetFifoUsage() ==
+                    (int)( MAX_DEVICE_FIFO_SIZE_INWORDS * 4 ),
+                    "FIFO usage is all of FIFO RAM" );
+  USBSIMTEST_Check( intrFn.fifoBytes ==
+                    INTR_EPS * MIN_EP_FIFO_SIZE_INBYTES,
+                    "interrupt IN endpoints get minimum size Tx FIFOs" );
+
+  r = FifoEnd();
+  USBSIMTEST_Report( "end of programmed FIFOs", r, "words" );
+  snprintf( msg, sizeof( msg ), "FIFOs end at %d, FIFO RAM is %d words",
+            r, (int)MAX_DEVICE_FIFO_SIZE_INWORDS );
+  USBSIMTEST_Check( r == (int)MAX_DEVICE_FIFO_SIZE_INWORDS, msg );
+
+  /* USBD_FifoLayout() finds no room for more buffering. */
+  r = USBD_FifoLayout( &deviceDesc, configBuf, NULL, 0, mult );
+  USBSIMTEST_Check( r == 0, "USBD_FifoLayout() agrees FIFO RAM is full" );
+
+  /* A smaller device, buffered as USBD_FifoLayout() suggests. Four 8 byte */
+  /* packets per frame on the first interrupt endpoint still fit in a      */
+  /* minimum size Tx FIFO, the small isochronous endpoint gets double      */
+  /* buffering and the big one does not fit twice.                         */
+  SetIsocSize( ISOC_SMALL_SIZE );
+  intrFn.bufferingMultiplier = NULL;
+  isocFn.bufferingMultiplier = NULL;
+  r = USBD_ClassInit( &classInit );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "small device accepted" );
+
+  traffic[ 0 ].epAddr        = intrFn.epAddr[ 0 ];
+  traffic[ 0 ].bytesPerFrame = 32;
+  traffic[ 1 ].epAddr        = isocFn.epAddr[ 1 ];
+  traffic[ 1 ].bytesPerFrame = ISOC_SMALL_SIZE;
+  r = USBD_FifoLayout( &deviceDesc, configBuf, traffic, 2, mult );
+  USBSIMTEST_Report( "USBD_FifoLayout() words left", r, "words" );
+  USBSIMTEST_Check( r >= 0, "USBD_FifoLayout() of small device" );
+  USBSIMTEST_Check( ( mult[ 1 ] == 4 ) && ( mult[ 2 ] == 1 ) &&
+                    ( mult[ 5 ] == 1 ) && ( mult[ 6 ] == 2 ),
+                    "USBD_FifoLayout() multipliers" );
+  for ( i = 1; i <= NUM_EP_USED; i++ )
+  {
+    snprintf( msg, sizeof( msg ), "  endpoint %d multiplier", i );
+    USBSIMTEST_Report( msg, mult[ i ], "" );
+  }
+
+  intrFn.bufferingMultiplier = mult + 1;
+  isocFn.bufferingMultiplier = mult + 1 + INTR_EPS;
+  USBD_ClassInit( &classInit );
+  USBSIMTEST_Check( USBD_ClassGetFifoUsage() ==
+                    (int)( MAX_DEVICE_FIFO_SIZE_INWORDS - r ) * 4,
+                    "FIFO usage agrees with USBD_FifoLayout()" );
+  CheckLayout( mult, r );
+
+  return USBSIMTEST_Done( "fifo_test" );
+}
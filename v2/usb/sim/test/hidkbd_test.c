@@ -0,0 +1,151 @@
+/***************************************************************************//**
+ * @file hidkbd_test.c
+ * @brief USB core model test of the DK3750 HID keyboard example.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/*
+ * The example is compiled in its bus powered variant, which reads the push
+ * button and drives the LED through GPIO, both modelled in RAM. A scripted
+ * host enumerates the keyboard, disables the idle reports like a PC does,
+ * and then polls the interrupt endpoint at its bInterval while the button
+ * is pressed and released. USB_EP_STATS enables the SOF interrupt, so the
+ * interrupt count per report includes one SOF interrupt per frame.
+ *
+ * Build and run from the v2 directory:
+ *
+ * gcc -O2 -no-pie -DEFM32GG990F1024 -DDEBUG_EFM_USER -DUSBSIM_TEST_DEVICE \
+ *     -DNUM_EP_USED=1 -DNUM_APP_TIMERS=2 \
+ *     -Iusb/sim -Iusb/sim/test -Iusb/inc -Iemlib/inc \
+ *     -IDevice/SiliconLabs/EFM32GG/Include -ICMSIS/Include \
+ *     -Ikits/common/bsp -Ikits/common/drivers -Ikits/EFM32GG_DK3750/config \
+ *     usb/src/em_usbd.c usb/src/em_usbdch9.c usb/src/em_usbdep.c \
+ *     usb/src/em_usbdint.c usb/src/em_usbhal.c usb/sim/em_usbsim.c \
+ *     usb/sim/test/usbsim_test.c usb/sim/test/hidkbd_test.c \
+ *     -o hidkbd_test -lpthread && ./hidkbd_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "usbsim_test.h"
+
+#define BUSPOWERED
+#define main hidkbd_main
+#include "../../../kits/EFM32GG_DK3750/examples/usbdhidkbd/main.c"
+#undef main
+
+#define KEY_PRESSES   40
+
+STATIC_UBUF( hostBuf, 128 );
+
+/* The push button is active low with a pull-up. */
+static void ButtonSet( bool pushed )
+{
+  volatile uint32_t *din = (volatile uint32_t*)&GPIO->P[ gpioPortE ].DIN;
+
+  INT_Disable();
+  *din = pushed ? ( *din & ~1 ) : ( *din | 1 );
+  INT_Enable();
+}
+
+/* Poll the interrupt endpoint once per bInterval, as a host does. */
+static int PollReport( uint8_t *report, int maxPolls )
+{
+  int r, polls;
+
+  for ( polls = 0; polls < maxPolls; polls++ )
+  {
+    r = USBSIM_HostIn( INTR_IN_EP_ADDR, report, USB_MAX_EP_SIZE, 0 );
+    if ( r != USB_STATUS_TIMEOUT )
+      return r;
+    USBSIM_RunMs( POLL_RATE );
+  }
+  return USB_STATUS_TIMEOUT;
+}
+
+int main( void )
+{
+  int i, r, reports = 0;
+  uint64_t latencyUs = 0;
+  USB_Setup_TypeDef setup;
+  USBSIMTEST_Mark_TypeDef mark;
+  USBSIM_Stats_TypeDef s;
+  USBD_EpStats_TypeDef epStats;
+
+  USBSIM_Init();
+  ButtonSet( false );
+  USBD_Init( &initstruct );
+  USBSIM_VbusSet( true );
+
+  /* Enumeration, then the requests a HID host driver issues. */
+  USBSIMTEST_Start( &mark );
+  r = USBSIM_HostEnumerate( 1, 1, USBSIMTEST_TIMEOUT );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "enumeration" );
+  USBSIM_GetStats( &s );
+  USBSIMTEST_Report( "enumeration time", USBSIMTEST_ElapsedUs( &mark ) / 1000.0, "ms" );
+  USBSIMTEST_Report( "enumeration interrupts", s.irqCount - mark.stats.irqCount, "" );
+
+  memset( &setup, 0, sizeof( setup ) );
+  setup.Direction = USB_SETUP_DIR_IN;
+  setup.Recipient = USB_SETUP_RECIPIENT_INTERFACE;
+  setup.bRequest  = GET_DESCRIPTOR;
+  setup.wValue    = USB_HID_REPORT_DESCRIPTOR << 8;
+  setup.wLength   = sizeof( ReportDescriptor );
+  r = USBSIM_HostControl( &setup, hostBuf, USBSIMTEST_TIMEOUT );
+  USBSIMTEST_Check( ( r == sizeof( ReportDescriptor ) ) &&
+                    !memcmp( hostBuf, ReportDescriptor, r ),
+                    "report descriptor" );
+
+  setup.Direction = USB_SETUP_DIR_OUT;
+  setup.Type      = USB_SETUP_TYPE_CLASS;
+  setup.bRequest  = USB_HID_SET_IDLE;
+  setup.wValue    = 0;
+  setup.wLength   = 0;
+  r = USBSIM_HostControl( &setup, NULL, USBSIMTEST_TIMEOUT );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "SET_IDLE" );
+
+  /* Key strokes, a report is expected on press and on release. */
+  USBD_ClearEpStats();
+  USBSIMTEST_Start( &mark );
+  for ( i = 0; i < KEY_PRESSES; i++ )
+  {
+    uint64_t t0 = USBSIM_GetTimeUs();
+
+    ButtonSet( true );
+    r = PollReport( hostBuf, 10 );
+    latencyUs += USBSIM_GetTimeUs() - t0;
+    USBSIMTEST_Check( ( r == 8 ) &&
+                      !memcmp( hostBuf, reportTable[ i % 15 ], 8 ),
+                      "key pressed report" );
+
+    ButtonSet( false );
+    r = PollReport( hostBuf, 10 );
+    USBSIMTEST_Check( ( r == 8 ) && !memcmp( hostBuf, noKeyReport, 8 ),
+                      "key released report" );
+    reports += 2;
+  }
+  USBSIM_GetStats( &s );
+  USBD_GetEpStats( INTR_IN_EP_ADDR, &epStats );
+  USBSIMTEST_Check( epStats.transfers == (uint32_t)reports, "report count" );
+
+  USBSIMTEST_Report( "key press to report latency",
+                     latencyUs / 1000.0 / KEY_PRESSES, "ms" );
+  USBSIMTEST_Report( "interrupts per report (incl. SOF)",
+                     (double)( s.irqCount - mark.stats.irqCount ) / reports, "" );
+  USBSIMTEST_Report( "NAK'ed polls per report",
+                     (double)epStats.naks / reports, "" );
+  USBSIMTEST_Report( "interrupt IN bytes per frame",
+                     (double)epStats.bytes / epStats.frames, "bytes" );
+
+  return USBSIMTEST_Done( "hidkbd_test" );
+}
@@ -0,0 +1,446 @@
+/***************************************************************************//**
+ * @file hubh_test.c
+ * @brief USB core model test of the hub class driver and the host channel
+ *        scheduler.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/*
+ * The hub model is attached to the host port with three scripted devices on
+ * its ports: a bulk loopback device, a low speed keyboard and a CDC device.
+ * The devices are enumerated on HUBH_Poll() attach events as in the usbhhub
+ * example. Four 4 KB bulk transfers to the loopback device, two OUT and two
+ * IN, are then started at once on endpoints assigned to USBH_HC_ANY and
+ * share the NUM_HC_USED pooled host channels. Finally a key stroke is read
+ * from the keyboard and the devices are detached.
+ *
+ * Build and run from the v2 directory:
+ *
+ * gcc -O2 -no-pie -DEFM32GG990F1024 -DDEBUG_EFM_USER -DUSBSIM_TEST_HOST \
+ *     -DNUM_HC_USED=2 -DNUM_APP_TIMERS=1 \
+ *     -Iusb/sim -Iusb/sim/test -Iusb/inc -Iemlib/inc \
+ *     -IDevice/SiliconLabs/EFM32GG/Include -ICMSIS/Include \
+ *     -Ikits/common/drivers \
+ *     usb/src/em_usbh.c usb/src/em_usbhep.c usb/src/em_usbhint.c \
+ *     usb/src/em_usbhal.c usb/sim/em_usbsim.c kits/common/drivers/hubh.c \
+ *     usb/sim/test/usbsim_test.c usb/sim/test/hubh_test.c \
+ *     -o hubh_test -lpthread && ./hubh_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "usbsim_test.h"
+#include "hubh.h"
+
+#define LOOPBACK_PORT   1
+#define KEYBOARD_PORT   2
+#define CDC_PORT        3
+#define NUM_DEVICES     3
+
+#define LOOPBACK_EPS    4             /* Two OUT/IN pairs.                  */
+#define XFER_SIZE       4096
+#define KEY_A           0x04          /* HID usage id of the 'a' key.       */
+
+typedef struct
+{
+  bool                  active;
+  uint8_t               speed;
+  USBH_Device_TypeDef   dev;
+  USBH_Ep_TypeDef       ep[ LOOPBACK_EPS ];
+} PortDevice_TypeDef;
+
+/*** Scripted devices. ***/
+
+static const USB_DeviceDescriptor_TypeDef loopbackDeviceDesc =
+{
+  .bLength            = USB_DEVICE_DESCSIZE,
+  .bDescriptorType    = USB_DEVICE_DESCRIPTOR,
+  .bcdUSB             = 0x0200,
+  .bMaxPacketSize0    = USB_MAX_EP_SIZE,
+  .idVendor           = 0x10C4,
+  .idProduct          = 0x0101,
+  .bNumConfigurations = 1
+};
+
+static const uint8_t loopbackConfigDesc[] =
+{
+  USB_CONFIG_DESCSIZE, USB_CONFIG_DESCRIPTOR,
+  USB_CONFIG_DESCSIZE + USB_INTERFACE_DESCSIZE + 4 * USB_ENDPOINT_DESCSIZE, 0,
+  1, 1, 0, CONFIG_DESC_BM_RESERVED_D7, 50,
+
+  USB_INTERFACE_DESCSIZE, USB_INTERFACE_DESCRIPTOR,
+  0, 0, LOOPBACK_EPS, 0xFF, 0, 0, 0,
+
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  1, USB_EPTYPE_BULK, USB_MAX_EP_SIZE, 0, 0,
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  2, USB_EPTYPE_BULK, USB_MAX_EP_SIZE, 0, 0,
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  USB_SETUP_DIR_MASK | 1, USB_EPTYPE_BULK, USB_MAX_EP_SIZE, 0, 0,
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  USB_SETUP_DIR_MASK | 2, USB_EPTYPE_BULK, USB_MAX_EP_SIZE, 0, 0
+};
+
+static const USB_DeviceDescriptor_TypeDef keyboardDeviceDesc =
+{
+  .bLength            = USB_DEVICE_DESCSIZE,
+  .bDescriptorType    = USB_DEVICE_DESCRIPTOR,
+  .bcdUSB             = 0x0110,
+  .bMaxPacketSize0    = 8,
+  .idVendor           = 0x10C4,
+  .idProduct          = 0x0102,
+  .bNumConfigurations = 1
+};
+
+static const uint8_t keyboardConfigDesc[] =
+{
+  USB_CONFIG_DESCSIZE, USB_CONFIG_DESCRIPTOR,
+  USB_CONFIG_DESCSIZE + USB_INTERFACE_DESCSIZE + USB_ENDPOINT_DESCSIZE, 0,
+  1, 1, 0, CONFIG_DESC_BM_RESERVED_D7, 50,
+
+  USB_INTERFACE_DESCSIZE, USB_INTERFACE_DESCRIPTOR,
+  0, 0, 1, USB_CLASS_HID, 1 /* Boot */,
+  USB_CLASS_HID_KEYBOARD, 0,
+
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  USB_SETUP_DIR_MASK | 1, USB_EPTYPE_INTR, 8, 0, 10
+};
+
+static const USB_DeviceDescriptor_TypeDef cdcDeviceDesc =
+{
+  .bLength            = USB_DEVICE_DESCSIZE,
+  .bDescriptorType    = USB_DEVICE_DESCRIPTOR,
+  .bcdUSB             = 0x0200,
+  .bDeviceClass       = USB_CLASS_CDC,
+  .bMaxPacketSize0    = USB_MAX_EP_SIZE,
+  .idVendor           = 0x10C4,
+  .idProduct          = 0x0103,
+  .bNumConfigurations = 1
+};
+
+static const uint8_t cdcConfigDesc[] =
+{
+  USB_CONFIG_DESCSIZE, USB_CONFIG_DESCRIPTOR,
+  USB_CONFIG_DESCSIZE + 2 * USB_INTERFACE_DESCSIZE + 3 * USB_ENDPOINT_DESCSIZE, 0,
+  2, 1, 0, CONFIG_DESC_BM_RESERVED_D7, 50,
+
+  USB_INTERFACE_DESCSIZE, USB_INTERFACE_DESCRIPTOR,
+  0, 0, 1, USB_CLASS_CDC, USB_CLASS_CDC_ACM, 0, 0,
+
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  USB_SETUP_DIR_MASK | 3, USB_EPTYPE_INTR, 16, 0, 255,
+
+  USB_INTERFACE_DESCSIZE, USB_INTERFACE_DESCRIPTOR,
+  1, 0, 2, USB_CLASS_CDC_DATA, 0, 0, 0,
+
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  1, USB_EPTYPE_BULK, USB_MAX_EP_SIZE, 0, 0,
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  USB_SETUP_DIR_MASK | 2, USB_EPTYPE_BULK, USB_MAX_EP_SIZE, 0, 0
+};
+
+/* Loopback device, OUT endpoint n data is returned on IN endpoint n. */
+static uint8_t          loopData[ 2 ][ XFER_SIZE ];
+static int              loopIn[ 2 ], loopOut[ 2 ];
+
+/* Keyboard, one report per key stroke. */
+static uint8_t          keyReport[ 8 ];
+static bool             keyPending;
+
+/* CDC device, the line coding set by the host. */
+static uint8_t          lineCoding[ 7 ];
+
+static int LoopbackIn( uint8_t epNum, uint8_t *data, int maxLen )
+{
+  int n, i = epNum - 1;
+
+  if ( ( i < 0 ) || ( i > 1 ) )
+    return USBSIM_STALL;
+
+  n = EFM32_MIN( maxLen, loopOut[ i ] - loopIn[ i ] );
+  if ( n == 0 )
+    return USBSIM_NAK;
+  memcpy( data, &loopData[ i ][ loopIn[ i ] ], n );
+  loopIn[ i ] += n;
+  return n;
+}
+
+static int LoopbackOut( uint8_t epNum, const uint8_t *data, int len )
+{
+  int i = epNum - 1;
+
+  if ( epNum == 0 )
+    return USBSIM_ACK;
+  if ( ( i < 0 ) || ( i > 1 ) )
+    return USBSIM_STALL;
+
+  if ( loopOut[ i ] + len > XFER_SIZE )
+    return USBSIM_NAK;
+  memcpy( &loopData[ i ][ loopOut[ i ] ], data, len );
+  loopOut[ i ] += len;
+  return USBSIM_ACK;
+}
+
+static int KeyboardSetup( const USB_Setup_TypeDef *setup, uint8_t *data, int maxLen )
+{
+  (void)data;
+  (void)maxLen;
+
+  if ( ( setup->Type == USB_SETUP_TYPE_CLASS ) &&
+       ( ( setup->bRequest == USB_HID_SET_PROTOCOL ) ||
+         ( setup->bRequest == USB_HID_SET_IDLE ) ) )
+  {
+    return 0;
+  }
+  return USBSIM_UNHANDLED;
+}
+
+static int KeyboardIn( uint8_t epNum, uint8_t *data, int maxLen )
+{
+  (void)maxLen;
+
+  if ( ( epNum != 1 ) || !keyPending )
+    return USBSIM_NAK;
+
+  memcpy( data, keyReport, sizeof( keyReport ) );
+  keyPending = false;
+  return sizeof( keyReport );
+}
+
+static int CdcSetup( const USB_Setup_TypeDef *setup, uint8_t *data, int maxLen )
+{
+  if ( setup->Type != USB_SETUP_TYPE_CLASS )
+    return USBSIM_UNHANDLED;
+
+  switch ( setup->bRequest )
+  {
+    case USB_CDC_GETLINECODING:
+      memcpy( data, lineCoding, EFM32_MIN( maxLen, (int)sizeof( lineCoding ) ) );
+      return sizeof( lineCoding );
+
+    case USB_CDC_SETLINECODING:
+    case USB_CDC_SETCTRLLINESTATE:
+      return 0;
+  }
+  return USBSIM_STALL;
+}
+
+/* The SET_LINE_CODING data stage. */
+static int CdcOut( uint8_t epNum, const uint8_t *data, int len )
+{
+  if ( epNum == 0 )
+    memcpy( lineCoding, data, EFM32_MIN( len, (int)sizeof( lineCoding ) ) );
+  return USBSIM_ACK;
+}
+
+static const USBSIM_Device_TypeDef loopbackDevice =
+{
+  .deviceDescriptor = &loopbackDeviceDesc,
+  .configDescriptor = loopbackConfigDesc,
+  .in               = LoopbackIn,
+  .out              = LoopbackOut
+};
+
+static const USBSIM_Device_TypeDef keyboardDevice =
+{
+  .lowSpeed         = true,
+  .deviceDescriptor = &keyboardDeviceDesc,
+  .configDescriptor = keyboardConfigDesc,
+  .setup            = KeyboardSetup,
+  .in               = KeyboardIn
+};
+
+static const USBSIM_Device_TypeDef cdcDevice =
+{
+  .deviceDescriptor = &cdcDeviceDesc,
+  .configDescriptor = cdcConfigDesc,
+  .setup            = CdcSetup,
+  .out              = CdcOut
+};
+
+/*** Host side. ***/
+
+static PortDevice_TypeDef portDevice[ HUBH_MAX_PORTS + 1 ];
+static volatile int       xfersDone;
+
+STATIC_UBUF( tmpBuf, 1024 );
+STATIC_UBUF( hostOut, 2 * XFER_SIZE );
+STATIC_UBUF( hostIn,  2 * XFER_SIZE );
+STATIC_UBUF( hostCtrl, 8 );
+
+/* Enumerate a device on a hub port, as the usbhhub example does. */
+static bool DeviceAttach( int port, uint8_t speed )
+{
+  int addr, numEp;
+  PortDevice_TypeDef *p = &portDevice[ port ];
+
+  if ( USBH_QueryDeviceB( tmpBuf, sizeof( tmpBuf ), speed ) != USB_STATUS_OK )
+    return false;
+
+  numEp = EFM32_MIN( USBH_QGetInterfaceDescriptor( tmpBuf, 0, 0 )->bNumEndpoints,
+                     LOOPBACK_EPS );
+  USBH_InitDeviceData( &p->dev, tmpBuf, p->ep, numEp, speed );
+
+  addr = USBH_AllocateAddress();
+  if ( ( addr < 0 )                                                 ||
+       ( USBH_SetAddressB( &p->dev, addr ) != USB_STATUS_OK )      ||
+       ( USBH_SetConfigurationB( &p->dev,
+                                 p->dev.confDesc.bConfigurationValue )
+         != USB_STATUS_OK ) )
+  {
+    return false;
+  }
+
+  while ( numEp-- )
+    USBH_AssignHostChannel( &p->ep[ numEp ], USBH_HC_ANY );
+
+  p->active = true;
+  p->speed  = speed;
+  return true;
+}
+
+static int XferDone( USB_Status_TypeDef status,
+                     uint32_t xferred, uint32_t remaining )
+{
+  (void)remaining;
+
+  if ( ( status == USB_STATUS_OK ) && ( xferred == XFER_SIZE ) )
+    xfersDone++;
+  else
+    xfersDone += 100;
+  return USB_STATUS_OK;
+}
+
+static int Scenario( void )
+{
+  int i, r, events = 0;
+  HUBH_Event_TypeDef event;
+  USBH_Init_TypeDef is = USBH_INIT_DEFAULT;
+  USBSIMTEST_Mark_TypeDef mark;
+  USBSIM_Stats_TypeDef s;
+  PortDevice_TypeDef *p;
+  const uint8_t setLineCoding[ 7 ] = { 0x00, 0xC2, 0x01, 0x00, 0, 0, 8 };
+
+  USBSIM_Init();
+  USBH_Init( &is );
+
+  USBSIM_HubPortAttach( LOOPBACK_PORT, &loopbackDevice );
+  USBSIM_HubPortAttach( KEYBOARD_PORT, &keyboardDevice );
+  USBSIM_HubPortAttach( CDC_PORT,      &cdcDevice );
+  USBSIM_HubAttach( 4 );
+
+  r = USBH_WaitForDeviceConnectionB( tmpBuf, 5 );
+  USBSIMTEST_Check( ( r == USB_STATUS_OK ) && HUBH_Init( tmpBuf, sizeof( tmpBuf ) ),
+                    "hub enumeration" );
+
+  /* Three attach events, each device gets an address of its own. */
+  USBSIMTEST_Start( &mark );
+  for ( i = 0; ( i < 5000 ) && ( events < NUM_DEVICES ); i++ )
+  {
+    if ( HUBH_Poll( &event ) && ( event.type == HUBH_EVENT_ATTACH ) )
+    {
+      USBSIMTEST_Check( DeviceAttach( event.port, event.speed ), "device enumeration" );
+      events++;
+    }
+    else
+    {
+      USBTIMER_DelayMs( 1 );
+    }
+  }
+  USBSIMTEST_Check( events == NUM_DEVICES, "attach events" );
+  USBSIMTEST_Report( "hub port enumeration time, 3 devices",
+                     USBSIMTEST_ElapsedUs( &mark ) / 1000.0, "ms" );
+
+  for ( i = LOOPBACK_PORT; i <= CDC_PORT; i++ )
+  {
+    USBSIMTEST_Check( portDevice[ i ].active &&
+                      ( portDevice[ i ].dev.addr == USBSIM_HubPortGetAddress( i ) ),
+                      "device address" );
+  }
+  USBSIMTEST_Check( ( portDevice[ LOOPBACK_PORT ].dev.addr !=
+                      portDevice[ KEYBOARD_PORT ].dev.addr ) &&
+                    ( portDevice[ KEYBOARD_PORT ].dev.addr !=
+                      portDevice[ CDC_PORT ].dev.addr ) &&
+                    ( portDevice[ LOOPBACK_PORT ].dev.addr !=
+                      portDevice[ CDC_PORT ].dev.addr ), "unique addresses" );
+  USBSIMTEST_Check( portDevice[ KEYBOARD_PORT ].speed == PORT_LOW_SPEED,
+                    "keyboard speed" );
+
+  /* Class requests to the CDC device. */
+  p = &portDevice[ CDC_PORT ];
+  memcpy( hostCtrl, setLineCoding, sizeof( setLineCoding ) );
+  r = USBH_ControlMsgB( &p->dev.ep0,
+                        USB_SETUP_DIR_H2D | USB_SETUP_RECIPIENT_INTERFACE |
+                        USB_SETUP_TYPE_CLASS_MASK,
+                        USB_CDC_SETLINECODING, 0, 0, 7, hostCtrl, 1000 );
+  USBSIMTEST_Check( ( r == 7 ) && !memcmp( lineCoding, setLineCoding, 7 ),
+                    "CDC SET_LINE_CODING" );
+
+  /* Four bulk transfers at once on the pooled host channels, the hub status */
+  /* change read armed by HUBH_Poll() competes for the same channels.       */
+  p = &portDevice[ LOOPBACK_PORT ];
+  USBSIMTEST_Fill( hostOut, 2 * XFER_SIZE, 28 );
+  xfersDone = 0;
+  USBSIMTEST_Start( &mark );
+  USBH_Write( &p->ep[ 0 ], hostOut,             XFER_SIZE, 1000, XferDone );
+  USBH_Write( &p->ep[ 1 ], hostOut + XFER_SIZE, XFER_SIZE, 1000, XferDone );
+  USBH_Read(  &p->ep[ 2 ], hostIn,              XFER_SIZE, 1000, XferDone );
+  USBH_Read(  &p->ep[ 3 ], hostIn + XFER_SIZE,  XFER_SIZE, 1000, XferDone );
+  for ( i = 0; ( i < 1000 ) && ( xfersDone < 4 ); i++ )
+    USBTIMER_DelayMs( 1 );
+  USBSIM_GetStats( &s );
+  USBSIMTEST_Check( ( xfersDone == 4 ) &&
+                    !memcmp( hostOut, hostIn, 2 * XFER_SIZE ),
+                    "concurrent bulk transfers" );
+  USBSIMTEST_Report( "4 x 4 KB bulk on pooled channels",
+                     4.0 * XFER_SIZE * USBSIM_FRAME_US /
+                     USBSIMTEST_ElapsedUs( &mark ), "bytes/frame" );
+  USBSIMTEST_Report( "interrupts per 4 KB transfer",
+                     ( s.irqCount - mark.stats.irqCount ) / 4.0, "" );
+  USBSIMTEST_Report( "NAK's per 4 KB transfer",
+                     ( s.naks - mark.stats.naks ) / 4.0, "" );
+
+  /* A key stroke on the low speed keyboard. */
+  p = &portDevice[ KEYBOARD_PORT ];
+  memset( keyReport, 0, sizeof( keyReport ) );
+  keyReport[ 2 ] = KEY_A;
+  keyPending = true;
+  r = USBH_ReadB( &p->ep[ 0 ], hostCtrl, 8, 100 );
+  USBSIMTEST_Check( ( r == 8 ) && ( hostCtrl[ 2 ] == KEY_A ), "keyboard report" );
+
+  /* Detach events for all devices. */
+  for ( i = LOOPBACK_PORT; i <= CDC_PORT; i++ )
+    USBSIM_HubPortDetach( i );
+  for ( i = 0, events = 0; ( i < 1000 ) && ( events < NUM_DEVICES ); i++ )
+  {
+    if ( HUBH_Poll( &event ) && ( event.type == HUBH_EVENT_DETACH ) )
+    {
+      USBH_ReleaseAddress( portDevice[ event.port ].dev.addr );
+      portDevice[ event.port ].active = false;
+      events++;
+    }
+    else
+    {
+      USBTIMER_DelayMs( 1 );
+    }
+  }
+  USBSIMTEST_Check( events == NUM_DEVICES, "detach events" );
+
+  return USBSIMTEST_Done( "hubh_test" );
+}
+
+/* hubh.c passes its control transfer buffers on the stack. */
+int main( void )
+{
+  return USBSIMTEST_RunOnStaticStack( Scenario );
+}
@@ -0,0 +1,268 @@
+/***************************************************************************//**
+ * @file msdd_test.c
+ * @brief USB core model test of the mass storage device class driver.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/*
+ * msdd.c is built with the descriptors and the internal SRAM media of the
+ * DK3750 usbdmsd example. A scripted host enumerates the device and issues
+ * Bulk Only Transport commands: INQUIRY, READ CAPACITY, then WRITE(10) and
+ * READ(10) of the whole disk, and the data read back is compared with the
+ * data written. The transfers are repeated with the DMA throttled below the
+ * bus rate, to show FIFO starvation in the NAK counts and the throughput.
+ * MSDD_Handler() runs in a thread of its own, as the main loop of the
+ * example does.
+ *
+ * Build and run from the v2 directory:
+ *
+ * gcc -O2 -no-pie -DEFM32GG990F1024 -DDEBUG_EFM_USER -DUSBSIM_TEST_DEVICE \
+ *     -DNUM_EP_USED=2 -DNUM_APP_TIMERS=1 -DMSD_MEDIA=MSD_SRAM_MEDIA \
+ *     -Iusb/sim -Iusb/sim/test -Iusb/inc -Iemlib/inc \
+ *     -IDevice/SiliconLabs/EFM32GG/Include -ICMSIS/Include \
+ *     -Ikits/common/drivers -Ikits/EFM32GG_DK3750/examples/usbdmsd \
+ *     usb/src/em_usbd.c usb/src/em_usbdch9.c usb/src/em_usbdep.c \
+ *     usb/src/em_usbdint.c usb/src/em_usbhal.c usb/sim/em_usbsim.c \
+ *     kits/common/drivers/msdd.c \
+ *     kits/EFM32GG_DK3750/examples/usbdmsd/msddmedia.c \
+ *     usb/sim/test/usbsim_test.c usb/sim/test/msdd_test.c \
+ *     -o msdd_test -lpthread && ./msdd_test
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "usbsim_test.h"
+#include "em_int.h"
+#include "msdbot.h"
+#include "msdscsi.h"
+#include "msdd.h"
+#include "msddmedia.h"
+
+#define BULK_OUT        0x01
+#define BULK_IN         0x81
+#define BURST_SECTORS   32              /* Sectors per READ(10)/WRITE(10). */
+#define SLOW_DMA_RATE   512             /* DMA bytes per frame, starvation pass. */
+
+static uint8_t          disk[ 96 * 1024 ];
+static uint8_t          readBack[ sizeof( disk ) ];
+static uint32_t         tag;
+static volatile bool    appRunning;
+
+/* The main loop of the usbdmsd example. */
+static void *AppThread( void *arg )
+{
+  bool idle;
+
+  (void)arg;
+  while ( appRunning )
+  {
+    INT_Disable();
+    idle = MSDD_Handler();
+    INT_Enable();
+    if ( idle )
+      usleep( 50 );
+  }
+  return NULL;
+}
+
+/* A stalled data stage is cleared before the CSW is read. */
+static int ClearHalt( uint8_t epAddr )
+{
+  USB_Setup_TypeDef setup;
+
+  memset( &setup, 0, sizeof( setup ) );
+  setup.Recipient = USB_SETUP_RECIPIENT_ENDPOINT;
+  setup.bRequest  = CLEAR_FEATURE;
+  setup.wValue    = USB_FEATURE_ENDPOINT_HALT;
+  setup.wIndex    = epAddr;
+  return USBSIM_HostControl( &setup, NULL, USBSIMTEST_TIMEOUT );
+}
+
+/*
+ * One Bulk Only Transport command: CBW, optional data stage and CSW.
+ * Returns the CSW status, or a negative USB_Status_TypeDef.
+ */
+static int BotCommand( const uint8_t *cdb, int cdbLen, bool in,
+                       void *data, int len )
+{
+  int r;
+  MSDBOT_CBW_TypeDef cbw;
+  MSDBOT_CSW_TypeDef *csw;
+  uint8_t cswBuf[ USB_MAX_EP_SIZE ];
+
+  memset( &cbw, 0, sizeof( cbw ) );
+  cbw.dCBWSignature          = CBW_SIGNATURE;
+  cbw.dCBWTag                = ++tag;
+  cbw.dCBWDataTransferLength = len;
+  cbw.Direction              = in ? 1 : 0;
+  cbw.CBLength               = cdbLen;
+  memcpy( cbw.CBWCB, cdb, cdbLen );
+
+  r = USBSIM_HostOut( BULK_OUT, &cbw, CBW_LEN, USBSIMTEST_TIMEOUT );
+  if ( r < 0 )
+    return r;
+
+  if ( len )
+  {
+    if ( in )
+      r = USBSIM_HostIn( BULK_IN, data, EFM32_MAX( len, USB_MAX_EP_SIZE ),
+                         USBSIMTEST_TIMEOUT );
+    else
+      r = USBSIM_HostOut( BULK_OUT, data, len, USBSIMTEST_TIMEOUT );
+    if ( r == USB_STATUS_EP_STALLED )
+      r = ClearHalt( in ? BULK_IN : BULK_OUT );
+    if ( r < 0 )
+      return r;
+  }
+
+  r = USBSIM_HostIn( BULK_IN, cswBuf, sizeof( cswBuf ), USBSIMTEST_TIMEOUT );
+  if ( r < 0 )
+    return r;
+
+  csw = (MSDBOT_CSW_TypeDef*)cswBuf;
+  if ( ( r != CSW_LEN ) || ( csw->dCSWSignature != CSW_SIGNATURE ) ||
+       ( csw->dCSWTag != tag ) )
+  {
+    return USB_STATUS_REQ_ERR;
+  }
+  return csw->bCSWStatus;
+}
+
+static int ReadWrite10( bool read, uint32_t lba, int sectors, uint8_t *data )
+{
+  uint8_t cdb[ SCSI_READ10_LEN ];
+
+  memset( cdb, 0, sizeof( cdb ) );
+  cdb[ 0 ] = read ? SCSI_READ10 : SCSI_WRITE10;
+  cdb[ 2 ] = lba >> 24;
+  cdb[ 3 ] = lba >> 16;
+  cdb[ 4 ] = lba >> 8;
+  cdb[ 5 ] = lba;
+  cdb[ 7 ] = sectors >> 8;
+  cdb[ 8 ] = sectors;
+  return BotCommand( cdb, sizeof( cdb ), read, data, sectors * 512 );
+}
+
+/* Move the whole disk in BURST_SECTORS commands, report the figures. */
+static void DiskPass( bool read, uint8_t *data, const char *what )
+{
+  int r, lba, cmds = 0;
+  bool ok = true;
+  char name[ 64 ];
+  USBSIMTEST_Mark_TypeDef mark;
+  USBSIM_Stats_TypeDef s;
+  USBD_EpStats_TypeDef epStats;
+
+  USBD_ClearEpStats();
+  USBSIMTEST_Start( &mark );
+  for ( lba = 0; lba < (int)( sizeof( disk ) / 512 ); lba += BURST_SECTORS )
+  {
+    r = ReadWrite10( read, lba, BURST_SECTORS, data + lba * 512 );
+    ok = ok && ( r == USB_CLASS_MSD_CSW_CMDPASSED );
+    cmds++;
+  }
+  USBSIM_GetStats( &s );
+  USBD_GetEpStats( read ? BULK_IN : BULK_OUT, &epStats );
+
+  snprintf( name, sizeof( name ), "%s commands", what );
+  USBSIMTEST_Check( ok, name );
+
+  snprintf( name, sizeof( name ), "%s throughput", what );
+  USBSIMTEST_Report( name, (double)sizeof( disk ) * USBSIM_FRAME_US /
+                     USBSIMTEST_ElapsedUs( &mark ), "bytes/frame" );
+  snprintf( name, sizeof( name ), "%s interrupts per command", what );
+  USBSIMTEST_Report( name, (double)( s.irqCount - mark.stats.irqCount ) / cmds, "" );
+  snprintf( name, sizeof( name ), "%s NAK's per command", what );
+  USBSIMTEST_Report( name, (double)( s.naks - mark.stats.naks ) / cmds, "" );
+  snprintf( name, sizeof( name ), "%s FIFO NAK's per command", what );
+  USBSIMTEST_Report( name, (double)( s.fifoNaks - mark.stats.fifoNaks ) / cmds, "" );
+  if ( read )
+  {
+    snprintf( name, sizeof( name ), "%s Tx FIFO empty per command", what );
+    USBSIMTEST_Report( name, (double)epStats.fifoEmpty / cmds, "" );
+  }
+
+  /* A command moves BURST_SECTORS sectors in one transfer spanning several */
+  /* frames, the peak is what the bus carried within one of them.           */
+  snprintf( name, sizeof( name ), "%s peak bytes per frame", what );
+  USBSIMTEST_Report( name, epStats.maxFrameBytes, "bytes" );
+  snprintf( name, sizeof( name ), "%s peak bytes per frame within bus rate", what );
+  USBSIMTEST_Check( ( epStats.maxFrameBytes > 0 ) &&
+                    ( epStats.maxFrameBytes <= USBSIM_FRAME_BYTES ), name );
+}
+
+int main( void )
+{
+  int r;
+  uint8_t cdb[ 16 ];
+  uint8_t buf[ USB_MAX_EP_SIZE ];
+  pthread_t app;
+  USBSIMTEST_Mark_TypeDef mark;
+  USBSIM_Stats_TypeDef s;
+
+  USBSIM_Init();
+  USBSIMTEST_Check( MSDDMEDIA_Init(), "media init" );
+  MSDD_Init( -1, 0 );
+
+  appRunning = true;
+  pthread_create( &app, NULL, AppThread, NULL );
+
+  USBSIM_VbusSet( true );
+  USBSIMTEST_Start( &mark );
+  r = USBSIM_HostEnumerate( 1, 1, USBSIMTEST_TIMEOUT );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "enumeration" );
+  USBSIM_GetStats( &s );
+  USBSIMTEST_Report( "enumeration time", USBSIMTEST_ElapsedUs( &mark ) / 1000.0, "ms" );
+  USBSIMTEST_Report( "enumeration interrupts", s.irqCount - mark.stats.irqCount, "" );
+
+  memset( cdb, 0, sizeof( cdb ) );
+  cdb[ 0 ] = SCSI_INQUIRY;
+  cdb[ 4 ] = SCSI_INQUIRYDATA_LEN;
+  r = BotCommand( cdb, 6, true, buf, SCSI_INQUIRYDATA_LEN );
+  USBSIMTEST_Check( r == USB_CLASS_MSD_CSW_CMDPASSED, "INQUIRY" );
+
+  memset( cdb, 0, sizeof( cdb ) );
+  cdb[ 0 ] = SCSI_READCAPACITY;
+  r = BotCommand( cdb, SCSI_READCAPACITY_LEN, true, buf,
+                  SCSI_READCAPACITYDATA_LEN );
+  USBSIMTEST_Check( ( r == USB_CLASS_MSD_CSW_CMDPASSED ) &&
+                    ( ( ( buf[ 2 ] << 8 ) | buf[ 3 ] ) ==
+                      sizeof( disk ) / 512 - 1 ),
+                    "READ CAPACITY" );
+
+  USBSIMTEST_Fill( disk, sizeof( disk ), 26 );
+  DiskPass( false, disk, "WRITE(10)" );
+  DiskPass( true, readBack, "READ(10)" );
+  USBSIMTEST_Check( !memcmp( disk, readBack, sizeof( disk ) ), "read back data" );
+
+  /* A DMA slower than the bus starves the FIFO's, the core NAK's the bulk */
+  /* tokens it cannot serve and the throughput drops to the DMA rate.      */
+  USBSIM_SetDmaRate( SLOW_DMA_RATE );
+  USBSIMTEST_Fill( disk, sizeof( disk ), 27 );
+  DiskPass( false, disk, "slow DMA WRITE(10)" );
+  memset( readBack, 0, sizeof( readBack ) );
+  DiskPass( true, readBack, "slow DMA READ(10)" );
+  USBSIMTEST_Check( !memcmp( disk, readBack, sizeof( disk ) ),
+                    "slow DMA read back data" );
+  USBSIM_SetDmaRate( 0 );
+
+  /* An access beyond the media stalls the data stage and fails in the CSW. */
+  r = ReadWrite10( true, sizeof( disk ) / 512, 1, readBack );
+  USBSIMTEST_Check( r == USB_CLASS_MSD_CSW_CMDFAILED, "access beyond media" );
+
+  appRunning = false;
+  pthread_join( app, NULL );
+  return USBSIMTEST_Done( "msdd_test" );
+}
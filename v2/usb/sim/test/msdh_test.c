@@ -0,0 +1,351 @@
+/***************************************************************************//**
+ * @file msdh_test.c
+ * @brief USB core model test of the mass storage host class driver.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/*
+ * The model acts as a USB stick: a scripted Bulk Only Transport device with
+ * a RAM disk answers the SCSI commands msdh.c issues. The host stack waits
+ * for the device, MSDH_Init() enumerates and qualifies it, and the whole
+ * disk is then written and read back with MSDH_WriteSectors() and
+ * MSDH_ReadSectors(), as the usbhmsdfatcon example does through FatFs.
+ *
+ * Build and run from the v2 directory:
+ *
+ * gcc -O2 -no-pie -DEFM32GG990F1024 -DDEBUG_EFM_USER -DUSBSIM_TEST_HOST \
+ *     -DNUM_HC_USED=2 -DNUM_APP_TIMERS=1 \
+ *     -Iusb/sim -Iusb/sim/test -Iusb/inc -Iemlib/inc \
+ *     -IDevice/SiliconLabs/EFM32GG/Include -ICMSIS/Include \
+ *     -Ikits/common/drivers \
+ *     usb/src/em_usbh.c usb/src/em_usbhep.c usb/src/em_usbhint.c \
+ *     usb/src/em_usbhal.c usb/sim/em_usbsim.c \
+ *     kits/common/drivers/msdh.c kits/common/drivers/msdbot.c \
+ *     kits/common/drivers/msdscsi.c \
+ *     usb/sim/test/usbsim_test.c usb/sim/test/msdh_test.c \
+ *     -o msdh_test -lpthread && ./msdh_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "usbsim_test.h"
+#include "msdbot.h"
+#include "msdscsi.h"
+#include "msdh.h"
+
+#define BULK_IN_EP      1
+#define BULK_OUT_EP     2
+#define SECTOR_SIZE     512
+#define DISK_SECTORS    192
+#define BURST_SECTORS   32              /* Sectors per READ(10)/WRITE(10). */
+
+/* Bulk Only Transport phases of the scripted device. */
+typedef enum
+{
+  BOT_CBW,
+  BOT_DATA_IN,
+  BOT_DATA_OUT,
+  BOT_CSW
+} BotState_TypeDef;
+
+static const USB_DeviceDescriptor_TypeDef deviceDesc =
+{
+  .bLength            = USB_DEVICE_DESCSIZE,
+  .bDescriptorType    = USB_DEVICE_DESCRIPTOR,
+  .bcdUSB             = 0x0200,
+  .bMaxPacketSize0    = USB_MAX_EP_SIZE,
+  .idVendor           = 0x10C4,
+  .idProduct          = 0x0008,
+  .bcdDevice          = 0x0100,
+  .bNumConfigurations = 1
+};
+
+static const uint8_t configDesc[] =
+{
+  USB_CONFIG_DESCSIZE, USB_CONFIG_DESCRIPTOR,
+  USB_CONFIG_DESCSIZE + USB_INTERFACE_DESCSIZE + 2 * USB_ENDPOINT_DESCSIZE, 0,
+  1, 1, 0, CONFIG_DESC_BM_RESERVED_D7, 50,
+
+  USB_INTERFACE_DESCSIZE, USB_INTERFACE_DESCRIPTOR,
+  0, 0, 2, USB_CLASS_MSD, USB_CLASS_MSD_SCSI_CMDSET,
+  USB_CLASS_MSD_BOT_TRANSPORT, 0,
+
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  USB_SETUP_DIR_MASK | BULK_IN_EP, USB_EPTYPE_BULK, USB_MAX_EP_SIZE, 0, 0,
+
+  USB_ENDPOINT_DESCSIZE, USB_ENDPOINT_DESCRIPTOR,
+  BULK_OUT_EP, USB_EPTYPE_BULK, USB_MAX_EP_SIZE, 0, 0
+};
+
+static uint8_t            disk[ DISK_SECTORS * SECTOR_SIZE ];
+static BotState_TypeDef   botState;
+static MSDBOT_CSW_TypeDef csw;
+static uint8_t            reply[ SCSI_INQUIRYDATA_LEN ];
+static uint8_t            *dataPtr;
+static int                dataLeft;
+static bool               inHalted, outHalted;
+
+STATIC_UBUF( tmpBuf, 1024 );
+STATIC_UBUF( hostData, sizeof( disk ) );
+
+/* Decode a CBW, set up the data phase and the CSW. */
+static void BotCommand( const MSDBOT_CBW_TypeDef *cbw )
+{
+  const uint8_t *cdb = cbw->CBWCB;
+  uint32_t lba, sectors;
+
+  csw.dCSWSignature   = CSW_SIGNATURE;
+  csw.dCSWTag         = cbw->dCBWTag;
+  csw.dCSWDataResidue = 0;
+  csw.bCSWStatus      = USB_CLASS_MSD_CSW_CMDPASSED;
+  dataPtr             = reply;
+  dataLeft            = 0;
+  memset( reply, 0, sizeof( reply ) );
+
+  switch ( cdb[ 0 ] )
+  {
+    case SCSI_INQUIRY:
+      reply[ 1 ] = 0x80;                          /* Removable medium.  */
+      reply[ 2 ] = 0x04;                          /* SPC-2.             */
+      reply[ 3 ] = 0x02;
+      reply[ 4 ] = SCSI_INQUIRYDATA_LEN - 5;
+      memcpy( &reply[ 8 ], "EFM32   USBSIM RAM disk 1.00", 28 );
+      dataLeft = SCSI_INQUIRYDATA_LEN;
+      break;
+
+    case SCSI_REQUESTSENSE:
+      reply[ 0 ] = 0x70;                          /* Current errors.    */
+      reply[ 7 ] = SCSI_REQUESTSENSEDATA_LEN - 8;
+      dataLeft   = SCSI_REQUESTSENSEDATA_LEN;
+      break;
+
+    case SCSI_READCAPACITY:
+      reply[ 2 ] = ( DISK_SECTORS - 1 ) >> 8;
+      reply[ 3 ] = ( DISK_SECTORS - 1 ) & 0xFF;
+      reply[ 6 ] = SECTOR_SIZE >> 8;
+      dataLeft   = SCSI_READCAPACITYDATA_LEN;
+      break;
+
+    case SCSI_READ10:
+    case SCSI_WRITE10:
+      lba     = ( cdb[ 2 ] << 24 ) | ( cdb[ 3 ] << 16 ) |
+                ( cdb[ 4 ] << 8  ) | cdb[ 5 ];
+      sectors = ( cdb[ 7 ] << 8 ) | cdb[ 8 ];
+      if ( lba + sectors > DISK_SECTORS )
+      {
+        /* The data phase is stalled, the host clears the halt and */
+        /* reads the CSW.                                           */
+        csw.bCSWStatus = USB_CLASS_MSD_CSW_CMDFAILED;
+        if ( cbw->Direction )
+          inHalted = true;
+        else
+          outHalted = true;
+        break;
+      }
+      dataPtr  = &disk[ lba * SECTOR_SIZE ];
+      dataLeft = sectors * SECTOR_SIZE;
+      break;
+
+    case SCSI_TESTUNIT_READY:
+      break;
+
+    default:
+      csw.bCSWStatus = USB_CLASS_MSD_CSW_CMDFAILED;
+      break;
+  }
+
+  dataLeft = EFM32_MIN( dataLeft, (int)cbw->dCBWDataTransferLength );
+  csw.dCSWDataResidue = cbw->dCBWDataTransferLength - dataLeft;
+  if ( dataLeft == 0 )
+    botState = BOT_CSW;
+  else
+    botState = cbw->Direction ? BOT_DATA_IN : BOT_DATA_OUT;
+}
+
+static int DeviceIn( uint8_t epNum, uint8_t *data, int maxLen )
+{
+  int n;
+
+  if ( ( epNum != BULK_IN_EP ) || inHalted )
+    return USBSIM_STALL;
+
+  if ( botState == BOT_DATA_IN )
+  {
+    n = EFM32_MIN( maxLen, dataLeft );
+    memcpy( data, dataPtr, n );
+    dataPtr  += n;
+    dataLeft -= n;
+    if ( dataLeft == 0 )
+      botState = BOT_CSW;
+    return n;
+  }
+
+  if ( botState == BOT_CSW )
+  {
+    memcpy( data, &csw, CSW_LEN );
+    botState = BOT_CBW;
+    return CSW_LEN;
+  }
+  return USBSIM_NAK;
+}
+
+static int DeviceOut( uint8_t epNum, const uint8_t *data, int len )
+{
+  MSDBOT_CBW_TypeDef cbw;
+
+  if ( epNum == 0 )
+    return USBSIM_ACK;
+  if ( ( epNum != BULK_OUT_EP ) || outHalted )
+    return USBSIM_STALL;
+
+  if ( botState == BOT_CBW )
+  {
+    memcpy( &cbw, data, CBW_LEN );
+    if ( ( len != CBW_LEN ) || ( cbw.dCBWSignature != CBW_SIGNATURE ) )
+      return USBSIM_STALL;
+    BotCommand( &cbw );
+    return USBSIM_ACK;
+  }
+
+  if ( botState == BOT_DATA_OUT )
+  {
+    len = EFM32_MIN( len, dataLeft );
+    memcpy( dataPtr, data, len );
+    dataPtr  += len;
+    dataLeft -= len;
+    if ( dataLeft == 0 )
+      botState = BOT_CSW;
+    return USBSIM_ACK;
+  }
+  return USBSIM_NAK;
+}
+
+/* Bulk-Only Mass Storage Reset, and the endpoint halt feature. */
+static int DeviceSetup( const USB_Setup_TypeDef *setup, uint8_t *data, int maxLen )
+{
+  (void)data;
+  (void)maxLen;
+
+  if ( ( setup->Type == USB_SETUP_TYPE_CLASS ) &&
+       ( setup->bRequest == USB_MSD_BOTRESET ) )
+  {
+    botState  = BOT_CBW;
+    inHalted  = false;
+    outHalted = false;
+    return 0;
+  }
+
+  if ( ( setup->Type == USB_SETUP_TYPE_STANDARD )             &&
+       ( setup->Recipient == USB_SETUP_RECIPIENT_ENDPOINT )   &&
+       ( setup->bRequest == CLEAR_FEATURE )                   &&
+       ( setup->wValue == USB_FEATURE_ENDPOINT_HALT ) )
+  {
+    if ( setup->wIndex == ( USB_SETUP_DIR_MASK | BULK_IN_EP ) )
+      inHalted = false;
+    else if ( setup->wIndex == BULK_OUT_EP )
+      outHalted = false;
+  }
+  return USBSIM_UNHANDLED;
+}
+
+static const USBSIM_Device_TypeDef usbStick =
+{
+  .deviceDescriptor = &deviceDesc,
+  .configDescriptor = configDesc,
+  .setup            = DeviceSetup,
+  .in               = DeviceIn,
+  .out              = DeviceOut
+};
+
+/* Move the whole disk in BURST_SECTORS commands, report the figures. */
+static void DiskPass( bool read, uint8_t *data, const char *what )
+{
+  int lba, cmds = 0;
+  bool ok = true;
+  char name[ 64 ];
+  USBSIMTEST_Mark_TypeDef mark;
+  USBSIM_Stats_TypeDef s;
+
+  USBSIMTEST_Start( &mark );
+  for ( lba = 0; lba < DISK_SECTORS; lba += BURST_SECTORS )
+  {
+    if ( read )
+      ok = ok && MSDH_ReadSectors( lba, BURST_SECTORS, data + lba * SECTOR_SIZE );
+    else
+      ok = ok && MSDH_WriteSectors( lba, BURST_SECTORS, data + lba * SECTOR_SIZE );
+    cmds++;
+  }
+  USBSIM_GetStats( &s );
+
+  snprintf( name, sizeof( name ), "%s commands", what );
+  USBSIMTEST_Check( ok, name );
+
+  snprintf( name, sizeof( name ), "%s throughput", what );
+  USBSIMTEST_Report( name, (double)sizeof( disk ) * USBSIM_FRAME_US /
+                     USBSIMTEST_ElapsedUs( &mark ), "bytes/frame" );
+  snprintf( name, sizeof( name ), "%s interrupts per command", what );
+  USBSIMTEST_Report( name, (double)( s.irqCount - mark.stats.irqCount ) / cmds, "" );
+  snprintf( name, sizeof( name ), "%s NAK's per command", what );
+  USBSIMTEST_Report( name, (double)( s.naks - mark.stats.naks ) / cmds, "" );
+}
+
+static int Scenario( void )
+{
+  int r;
+  uint32_t sectorCount;
+  USBH_Init_TypeDef is = USBH_INIT_DEFAULT;
+  USBSIMTEST_Mark_TypeDef mark;
+  USBSIM_Stats_TypeDef s;
+
+  USBSIM_Init();
+  USBH_Init( &is );
+
+  /* Plug-in to a qualified and ready mass storage device. */
+  USBSIMTEST_Start( &mark );
+  USBSIM_DeviceAttach( &usbStick );
+  r = USBH_WaitForDeviceConnectionB( tmpBuf, 5 );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "device connection" );
+  USBSIMTEST_Report( "connection time", USBSIMTEST_ElapsedUs( &mark ) / 1000.0, "ms" );
+
+  USBSIMTEST_Start( &mark );
+  USBSIMTEST_Check( MSDH_Init( tmpBuf, sizeof( tmpBuf ) ), "MSDH_Init" );
+  USBSIM_GetStats( &s );
+  USBSIMTEST_Report( "enumeration and SCSI setup time",
+                     USBSIMTEST_ElapsedUs( &mark ) / 1000.0, "ms" );
+  USBSIMTEST_Report( "enumeration and SCSI setup interrupts",
+                     s.irqCount - mark.stats.irqCount, "" );
+
+  /* MSDH_GetSectorCount() returns the last LBA, as READ CAPACITY does. */
+  USBSIMTEST_Check( MSDH_GetSectorCount( &sectorCount ) &&
+                    ( sectorCount == DISK_SECTORS - 1 ), "sector count" );
+
+  USBSIMTEST_Fill( hostData, sizeof( disk ), 1 );
+  DiskPass( false, hostData, "WRITE(10)" );
+  USBSIMTEST_Check( !memcmp( disk, hostData, sizeof( disk ) ), "written data" );
+
+  memset( hostData, 0, sizeof( disk ) );
+  DiskPass( true, hostData, "READ(10)" );
+  USBSIMTEST_Check( !memcmp( disk, hostData, sizeof( disk ) ), "read data" );
+
+  /* An access beyond the media fails in the CSW. */
+  USBSIMTEST_Check( !MSDH_ReadSectors( DISK_SECTORS, 1, hostData ),
+                    "access beyond media" );
+
+  return USBSIMTEST_Done( "msdh_test" );
+}
+
+/* msdh.c passes SCSI reply buffers on the stack to the host stack. */
+int main( void )
+{
+  return USBSIMTEST_RunOnStaticStack( Scenario );
+}
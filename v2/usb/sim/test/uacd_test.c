@@ -0,0 +1,495 @@
+/***************************************************************************//**
+ * @file uacd_test.c
+ * @brief USB core model test of the DK3750 USB audio device example.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+/*
+ * uacd.c is built with the descriptors of the DK3750 usbdaudio example.
+ * DAC0, ADC0, PRS, the sample rate timers and the DMA controller are
+ * modelled in RAM. HFPERCLK, and with it the sample clock, runs
+ * CODEC_TICKS_PER_FRAME ticks per USB frame, a little faster than the
+ * 48 MHz the driver assumes. A USBTIMER timer runs the model every
+ * millisecond: the TIMER0 and TIMER1 counters are brought up to date and the
+ * DAC and ADC ping-pong DMA callbacks are called for each 1 ms period
+ * completed. At each SOF the model is run once more before UACD_SofInt().
+ *
+ * A scripted host selects the streaming alternate settings, then plays and
+ * records one packet per frame, and reads the feedback endpoint once per
+ * refresh period. The speaker packets are sized by the feedback value, as a
+ * host audio driver does. The test checks that each endpoint moves one
+ * packet per frame, that streaming goes on after a frame the host skipped
+ * (incomplete isochronous IN and OUT transfers), and that the feedback value
+ * converges to the modelled sample rate.
+ *
+ * Build and run from the v2 directory:
+ *
+ * gcc -O2 -no-pie -DEFM32GG990F1024 -DDEBUG_EFM_USER -DUSBSIM_TEST_DEVICE \
+ *     -DNUM_EP_USED=3 -DNUM_APP_TIMERS=1 \
+ *     -Iusb/sim -Iusb/sim/test -Iusb/inc -Iemlib/inc \
+ *     -IDevice/SiliconLabs/EFM32GG/Include -ICMSIS/Include \
+ *     -Ikits/common/bsp -Ikits/common/drivers -Ikits/EFM32GG_DK3750/config \
+ *     usb/src/em_usbd.c usb/src/em_usbdch9.c usb/src/em_usbdep.c \
+ *     usb/src/em_usbdint.c usb/src/em_usbhal.c usb/sim/em_usbsim.c \
+ *     kits/common/drivers/dmactrl.c \
+ *     usb/sim/test/usbsim_test.c usb/sim/test/uacd_test.c \
+ *     -o uacd_test -lpthread && ./uacd_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "usbsim_test.h"
+
+/* DAC0, ADC0, PRS, TIMER0, TIMER1 and the DMA controller, modelled in RAM. */
+/* Defined ahead of the emlib headers, their inline functions use them.    */
+static DAC_TypeDef   dac0Regs;
+static ADC_TypeDef   adc0Regs;
+static PRS_TypeDef   prsRegs;
+static TIMER_TypeDef timer0Regs;
+static TIMER_TypeDef timer1Regs;
+static DMA_TypeDef   dmaRegs;
+
+#undef  DAC0
+#define DAC0    ( &dac0Regs )
+#undef  ADC0
+#define ADC0    ( &adc0Regs )
+#undef  PRS
+#define PRS     ( &prsRegs )
+#undef  TIMER0
+#define TIMER0  ( &timer0Regs )
+#undef  TIMER1
+#define TIMER1  ( &timer1Regs )
+#undef  DMA
+#define DMA     ( &dmaRegs )
+
+/* Interface, endpoint and entity numbers, as in the example usbconfig.h. */
+#define UACD_AC_INTERFACE_NO      ( 0 )
+#define UACD_SPEAKER_INTERFACE_NO ( 1 )
+#define UACD_MIC_INTERFACE_NO     ( 2 )
+#define NUM_INTERFACES            ( 3 )
+
+#define UACD_EP_OUT         ( 0x01 )
+#define UACD_EP_FEEDBACK    ( 0x81 )
+#define UACD_EP_IN          ( 0x82 )
+
+#define UACD_IT_SPEAKER_ID  ( 1 )
+#define UACD_FU_SPEAKER_ID  ( 2 )
+#define UACD_OT_SPEAKER_ID  ( 3 )
+#define UACD_IT_MIC_ID      ( 4 )
+#define UACD_OT_MIC_ID      ( 5 )
+
+#define main uacd_main
+#include "../../../kits/EFM32GG_DK3750/examples/usbdaudio/main.c"
+#undef main
+#include "../../../kits/common/drivers/uacd.c"
+
+#define CODEC_TIMER           0       /* USBTIMER id of the codec model.  */
+#define CODEC_TICKS_PER_FRAME 48010   /* HFPERCLK is 48.01 MHz, +208 ppm. */
+#define ADC_RIGHT             ( ADC_MIDSCALE + 0x100 )
+#define ADC_LEFT              ( ADC_MIDSCALE - 0x100 )
+#define MIC_SAMPLE            0x1000F000  /* ADC_LEFT, ADC_RIGHT as USB data. */
+
+#define FEEDBACK_PERIOD       ( 1 << UACD_FEEDBACK_REFRESH )
+#define SETTLE_FRAMES         4000    /* Feedback loop settling time.     */
+#define STREAM_FRAMES         4000    /* Frames measured.                 */
+#define RESUME_FRAMES         64      /* Frames checked after a skip.     */
+
+typedef struct
+{
+  DMA_CB_TypeDef  *cb;
+  void            *buf[ 2 ];
+  int             n;
+  bool            primary;
+} DmaCh_TypeDef;
+
+typedef struct
+{
+  uint32_t        frames;
+  uint32_t        feedbackReads;
+  uint32_t        badFeedback;
+  uint32_t        badMicPackets;
+  uint64_t        feedbackSum;
+  uint64_t        inBytes;
+} Host_TypeDef;
+
+static DmaCh_TypeDef  dmaCh[ 2 ];
+static uint32_t       codecPeriods;
+
+static Host_TypeDef   host;
+static uint32_t       hostFeedback = FEEDBACK_NOMINAL;
+static uint32_t       hostSampleAcc;
+
+STATIC_UBUF( hostOut, UACD_EP_SIZE );
+STATIC_UBUF( hostIn,  UACD_EP_SIZE );
+STATIC_UBUF( hostFb,  4 );
+
+/*
+ * Board support and emlib functions used by the example and the driver.
+ */
+int BSP_Init( uint32_t flags )
+{
+  (void)flags;
+  return BSP_STATUS_OK;
+}
+
+bool BSP_TraceProfilerSetup( void )
+{
+  return false;
+}
+
+int BSP_PeripheralAccess( BSP_Peripheral_TypeDef perf, bool enable )
+{
+  (void)perf;
+  (void)enable;
+  return BSP_STATUS_OK;
+}
+
+void TIMER_Init( TIMER_TypeDef *timer, const TIMER_Init_TypeDef *init )
+{
+  (void)init;
+  timer->CNT = 0;
+}
+
+void PRS_SourceSignalSet( unsigned int ch, uint32_t source, uint32_t signal,
+                          PRS_Edge_TypeDef edge )
+{
+  (void)ch;
+  (void)source;
+  (void)signal;
+  (void)edge;
+}
+
+void DAC_Init( DAC_TypeDef *dac, const DAC_Init_TypeDef *init )
+{
+  (void)dac;
+  (void)init;
+}
+
+void DAC_InitChannel( DAC_TypeDef *dac, const DAC_InitChannel_TypeDef *init,
+                      unsigned int ch )
+{
+  (void)dac;
+  (void)init;
+  (void)ch;
+}
+
+void ADC_Init( ADC_TypeDef *adc, const ADC_Init_TypeDef *init )
+{
+  (void)adc;
+  (void)init;
+}
+
+void ADC_InitScan( ADC_TypeDef *adc, const ADC_InitScan_TypeDef *init )
+{
+  (void)adc;
+  (void)init;
+}
+
+uint8_t ADC_TimebaseCalc( uint32_t hfperFreq )
+{
+  (void)hfperFreq;
+  return 0;
+}
+
+uint8_t ADC_PrescaleCalc( uint32_t adcFreq, uint32_t hfperFreq )
+{
+  (void)adcFreq;
+  (void)hfperFreq;
+  return 0;
+}
+
+void DMA_Init( DMA_Init_TypeDef *init )
+{
+  (void)init;
+  memset( dmaCh, 0, sizeof( dmaCh ) );
+}
+
+void DMA_CfgChannel( unsigned int channel, DMA_CfgChannel_TypeDef *cfg )
+{
+  dmaCh[ channel ].cb = cfg->cb;
+}
+
+void DMA_CfgDescr( unsigned int channel, bool primary, DMA_CfgDescr_TypeDef *cfg )
+{
+  (void)channel;
+  (void)primary;
+  (void)cfg;
+}
+
+void DMA_ActivatePingPong( unsigned int channel, bool useBurst,
+                           void *primDst, void *primSrc, unsigned int primNMinus1,
+                           void *altDst, void *altSrc, unsigned int altNMinus1 )
+{
+  DmaCh_TypeDef *ch = &dmaCh[ channel ];
+
+  (void)useBurst;
+  (void)altNMinus1;
+  ch->buf[ 0 ] = ( channel == UACD_DMA_ADC ) ? primDst : primSrc;
+  ch->buf[ 1 ] = ( channel == UACD_DMA_ADC ) ? altDst  : altSrc;
+  ch->n        = primNMinus1 + 1;
+  ch->primary  = true;
+}
+
+/* The descriptors are reused as they are, there is nothing to reload. */
+void DMA_RefreshPingPong( unsigned int channel, bool primary, bool useBurst,
+                          void *dst, void *src, unsigned int nMinus1, bool last )
+{
+  (void)channel;
+  (void)primary;
+  (void)useBurst;
+  (void)dst;
+  (void)src;
+  (void)nMinus1;
+  (void)last;
+}
+
+/* A ping-pong buffer is done, call the completion callback and switch. */
+static void DmaPeriodDone( int channel )
+{
+  DmaCh_TypeDef *ch = &dmaCh[ channel ];
+
+  if ( ch->cb && ch->cb->cbFunc )
+    ch->cb->cbFunc( channel, ch->primary, ch->cb->userPtr );
+  ch->primary = !ch->primary;
+}
+
+/*
+ * Bring the sample clock up to the start of the current frame. TIMER0
+ * counts HFPERCLK ticks up to TOP, TIMER1 counts TIMER0 overflows. Each
+ * UACD_FRAME_SAMPLES samples the DAC has played one DMA buffer and the ADC
+ * has filled one, scan order is right, left.
+ */
+static void CodecRun( void )
+{
+  int i;
+  uint16_t *adc;
+  uint64_t ticks, samples;
+  uint32_t top = timer0Regs.TOP + 1;
+
+  ticks   = ( USBSIM_GetTimeUs() / USBSIM_FRAME_US ) * CODEC_TICKS_PER_FRAME;
+  samples = ticks / top;
+
+  timer0Regs.CNT = ticks % top;
+  timer1Regs.CNT = samples & 0xFFFF;
+
+  while ( codecPeriods < samples / UACD_FRAME_SAMPLES )
+  {
+    codecPeriods++;
+    DmaPeriodDone( UACD_DMA_DAC );
+
+    adc = dmaCh[ UACD_DMA_ADC ].buf[ dmaCh[ UACD_DMA_ADC ].primary ? 0 : 1 ];
+    for ( i = 0; i < dmaCh[ UACD_DMA_ADC ].n; i += 2 )
+    {
+      adc[ i ]     = ADC_RIGHT;
+      adc[ i + 1 ] = ADC_LEFT;
+    }
+    DmaPeriodDone( UACD_DMA_ADC );
+  }
+}
+
+static void CodecTimer( void )
+{
+  CodecRun();
+  USBTIMER_Start( CODEC_TIMER, 1, CodecTimer );
+}
+
+/* The sample clock model runs ahead of the driver SOF handling. */
+static void SofInt( uint16_t sofNr )
+{
+  CodecRun();
+  UACD_SofInt( sofNr );
+}
+
+static const USBD_Callbacks_TypeDef testCallbacks =
+{
+  .usbReset        = NULL,
+  .usbStateChange  = UACD_StateChangeEvent,
+  .setupCmd        = UACD_SetupCmd,
+  .isSelfPowered   = NULL,
+  .sofInt          = SofInt
+};
+
+static const USBD_Init_TypeDef testInit =
+{
+  .deviceDescriptor    = &deviceDesc,
+  .configDescriptor    = configDesc,
+  .stringDescriptors   = strings,
+  .numberOfStrings     = sizeof(strings)/sizeof(void*),
+  .callbacks           = &testCallbacks,
+  .bufferingMultiplier = bufferingMultiplier,
+  .reserved            = 0
+};
+
+static int SetInterface( uint16_t interface, uint16_t alt )
+{
+  USB_Setup_TypeDef setup;
+
+  memset( &setup, 0, sizeof( setup ) );
+  setup.Direction = USB_SETUP_DIR_OUT;
+  setup.Type      = USB_SETUP_TYPE_STANDARD;
+  setup.Recipient = USB_SETUP_RECIPIENT_INTERFACE;
+  setup.bRequest  = SET_INTERFACE;
+  setup.wValue    = alt;
+  setup.wIndex    = interface;
+  return USBSIM_HostControl( &setup, NULL, USBSIMTEST_TIMEOUT );
+}
+
+/*
+ * One frame of host audio streaming. The speaker packet carries the number
+ * of samples the feedback value adds up to, the microphone packet must hold
+ * a whole number of samples, one more or less than nominal at most. The
+ * feedback endpoint is read once per refresh period.
+ */
+static void HostFrame( void )
+{
+  int i, r, n;
+  uint32_t *p = (uint32_t*)hostIn;
+
+  USBSIM_HostNextFrame();
+
+  hostSampleAcc += hostFeedback;
+  n = hostSampleAcc >> 14;
+  hostSampleAcc -= n << 14;
+  USBSIM_HostIsocOut( UACD_EP_OUT, hostOut, n * UACD_SAMPLE_SIZE );
+
+  r = USBSIM_HostIsocIn( UACD_EP_IN, hostIn, UACD_EP_SIZE );
+  if ( ( r < ( UACD_FRAME_SAMPLES - 1 ) * UACD_SAMPLE_SIZE ) ||
+       ( r % UACD_SAMPLE_SIZE ) )
+  {
+    host.badMicPackets++;
+  }
+  else
+  {
+    host.inBytes += r;
+    for ( i = 0; i < r / UACD_SAMPLE_SIZE; i++ )
+    {
+      if ( ( p[ i ] != MIC_SAMPLE ) && ( p[ i ] != 0 ) )
+      {
+        host.badMicPackets++;
+        break;
+      }
+    }
+  }
+
+  if ( ( host.frames++ % FEEDBACK_PERIOD ) == 0 )
+  {
+    r = USBSIM_HostIsocIn( UACD_EP_FEEDBACK, hostFb, sizeof( hostFb ) );
+    if ( r == UACD_FEEDBACK_SIZE )
+    {
+      hostFeedback = hostFb[ 0 ] | ( hostFb[ 1 ] << 8 ) | ( hostFb[ 2 ] << 16 );
+      host.feedbackReads++;
+      host.feedbackSum += hostFeedback;
+    }
+    else
+    {
+      host.badFeedback++;
+    }
+  }
+}
+
+int main( void )
+{
+  int i, r;
+  uint32_t expected;
+  double measured;
+  USBSIM_Stats_TypeDef s, s0;
+  UACD_Stats_TypeDef u, u0;
+  Host_TypeDef h0;
+
+  USBSIM_Init();
+  DMA_Init( NULL );
+  UACD_Init();
+  USBD_Init( &testInit );
+  USBTIMER_Start( CODEC_TIMER, 1, CodecTimer );
+  USBSIM_VbusSet( true );
+
+  r = USBSIM_HostEnumerate( 1, 1, USBSIMTEST_TIMEOUT );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "enumeration" );
+  r = SetInterface( UACD_SPEAKER_INTERFACE_NO, 1 );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "speaker alternate setting 1" );
+  r = SetInterface( UACD_MIC_INTERFACE_NO, 1 );
+  USBSIMTEST_Check( r == USB_STATUS_OK, "microphone alternate setting 1" );
+
+  for ( i = 0; i < UACD_EP_SIZE; i += UACD_SAMPLE_SIZE )
+    *(uint32_t*)( hostOut + i ) = MIC_SAMPLE;
+
+  /* Let the ring buffers fill and the feedback loop settle. */
+  for ( i = 0; i < SETTLE_FRAMES; i++ )
+    HostFrame();
+
+  /* Each endpoint moves one packet per frame, none is missed. */
+  USBSIM_GetStats( &s0 );
+  UACD_GetStats( &u0 );
+  h0 = host;
+  for ( i = 0; i < STREAM_FRAMES; i++ )
+    HostFrame();
+  USBSIM_GetStats( &s );
+  UACD_GetStats( &u );
+
+  USBSIMTEST_Check( u.outPackets - u0.outPackets == STREAM_FRAMES,
+                    "one speaker packet per frame" );
+  USBSIMTEST_Check( u.inPackets - u0.inPackets == STREAM_FRAMES,
+                    "one microphone packet per frame" );
+  USBSIMTEST_Check( host.feedbackReads - h0.feedbackReads ==
+                    STREAM_FRAMES / FEEDBACK_PERIOD,
+                    "one feedback packet per refresh period" );
+  USBSIMTEST_Check( s.isocMisses == s0.isocMisses, "isochronous misses" );
+  USBSIMTEST_Check( host.badMicPackets == 0, "microphone packets" );
+  USBSIMTEST_Check( ( u.dacUnderruns == u0.dacUnderruns ) &&
+                    ( u.outOverruns == 0 ) && ( u.adcOverruns == 0 ),
+                    "ring buffer under- and overruns" );
+
+  /* The feedback value averages to the sample rate in 10.14 format, */
+  /* within the trim for one sample of ring buffer fill error.         */
+  expected = ( (uint64_t)CODEC_TICKS_PER_FRAME << 14 ) / timerTicks;
+  measured = (double)( host.feedbackSum - h0.feedbackSum ) /
+             EFM32_MAX( host.feedbackReads - h0.feedbackReads, 1 );
+  USBSIMTEST_Check( ( measured > expected - ( 1 << FEEDBACK_FILL_SHIFT ) ) &&
+                    ( measured < expected + ( 1 << FEEDBACK_FILL_SHIFT ) ),
+                    "feedback rate" );
+  USBSIMTEST_Report( "feedback value", measured, "(10.14)" );
+  USBSIMTEST_Report( "modelled sample rate", expected, "(10.14)" );
+  USBSIMTEST_Report( "microphone rate",
+                     (double)( host.inBytes - h0.inBytes ) /
+                     ( STREAM_FRAMES * UACD_SAMPLE_SIZE ), "samples/frame" );
+  USBSIMTEST_Report( "interrupts per frame",
+                     (double)( s.irqCount - s0.irqCount ) / STREAM_FRAMES, "" );
+
+  /* A second packet in the same frame finds the endpoints armed for the next. */
+  USBSIM_GetStats( &s0 );
+  UACD_GetStats( &u0 );
+  r = USBSIM_HostIsocIn( UACD_EP_IN, hostIn, UACD_EP_SIZE );
+  USBSIM_HostIsocOut( UACD_EP_OUT, hostOut, UACD_FRAME_SAMPLES * UACD_SAMPLE_SIZE );
+  USBSIM_GetStats( &s );
+  UACD_GetStats( &u );
+  USBSIMTEST_Check( ( r == 0 ) && ( u.inPackets == u0.inPackets ) &&
+                    ( u.outPackets == u0.outPackets ) &&
+                    ( s.isocMisses - s0.isocMisses == 2 ),
+                    "one packet per endpoint and frame" );
+
+  /* The host skips a frame, the transfers are moved to the next one. */
+  USBSIM_HostNextFrame();
+  USBSIM_GetStats( &s0 );
+  UACD_GetStats( &u0 );
+  for ( i = 0; i < RESUME_FRAMES; i++ )
+    HostFrame();
+  USBSIM_GetStats( &s );
+  UACD_GetStats( &u );
+  USBSIMTEST_Check( ( u.outPackets - u0.outPackets == RESUME_FRAMES ) &&
+                    ( u.inPackets - u0.inPackets == RESUME_FRAMES ) &&
+                    ( s.isocMisses == s0.isocMisses ) &&
+                    ( host.badFeedback == 0 ),
+                    "streaming after a skipped frame" );
+
+  return USBSIMTEST_Done( "uacd_test" );
+}
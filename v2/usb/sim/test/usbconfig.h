@@ -0,0 +1,75 @@
+/***************************************************************************//**
+ * @file usbconfig.h
+ * @brief USB protocol stack library, configuration for the USB core model
+ *        test programs.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifndef __USBCONFIG_H
+#define __USBCONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The test programs share this file. Each one is built with either
+ * -DUSBSIM_TEST_HOST or -DUSBSIM_TEST_DEVICE, and with the endpoint, host
+ * channel and timer counts of the class driver or example under test on the
+ * command line, see the build line at the top of each test program.
+ */
+#if defined( USBSIM_TEST_HOST )
+#define USB_HOST            /* Compile stack for host mode. */
+
+#if !defined( NUM_HC_USED )
+#define NUM_HC_USED 2       /* Not counting default control ep which  */
+#endif                      /* is assigned to host channels 0 and 1   */
+
+#if !defined( HUBH_MAX_PORTS )
+#define HUBH_MAX_PORTS 4
+#endif
+
+#else
+#define USB_DEVICE          /* Compile stack for device mode. */
+
+#if !defined( NUM_EP_USED )
+#define NUM_EP_USED 1
+#endif
+
+/* Count NAK's, Tx FIFO empty events and bytes per frame per endpoint. */
+#define USB_EP_STATS
+#endif
+
+#if !defined( NUM_APP_TIMERS )
+#define NUM_APP_TIMERS 1
+#endif
+
+/* The model does not simulate energy modes, USB_PWRSAVE_MODE must be off. */
+#define USB_PWRSAVE_MODE  USB_PWRSAVE_MODE_OFF
+
+/****************************************************************************
+**                                                                         **
+** Configure serial port debug output.                                     **
+**                                                                         **
+*****************************************************************************/
+/* Define a function for transmitting a single char on the serial port. */
+extern int RETARGET_WriteChar(char c);
+#define USER_PUTCHAR  RETARGET_WriteChar
+
+/* Debug USB API functions (illegal input parameters etc.)  */
+#define DEBUG_USB_API
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBCONFIG_H */
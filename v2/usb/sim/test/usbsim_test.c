@@ -0,0 +1,139 @@
+/***************************************************************************//**
+ * @file usbsim_test.c
+ * @brief Common helpers for the USB core model test programs.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "usbsim_test.h"
+
+static int failures;
+
+/* Thread stack in static storage, see USBSIMTEST_RunOnStaticStack(). */
+static uint8_t staticStack[ 256 * 1024 ] __attribute__ ((aligned(16)));
+
+/* Debug output from the USB stack, see USER_PUTCHAR in usbconfig.h. */
+int RETARGET_WriteChar( char c )
+{
+  return fputc( c, stderr );
+}
+
+/* EFM_ASSERT() handler, em_usbhal.c provides assertEFM() itself. */
+void assertUserEFM( const char *file, const char *func, int line )
+{
+  fprintf( stderr, "\nEFM_ASSERT failed: %s:%d (%s)\n", file, line, func );
+  abort();
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Record the outcome of a check, failed checks are printed.
+ ******************************************************************************/
+void USBSIMTEST_Check( bool ok, const char *what )
+{
+  if ( !ok )
+  {
+    printf( "FAIL: %s\n", what );
+    failures++;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Print the test verdict.
+ *
+ * @return
+ *   The number of failed checks, to be used as the exit code.
+ ******************************************************************************/
+int USBSIMTEST_Done( const char *name )
+{
+  USBSIM_Stop();
+  printf( "%s: %s\n", name, failures ? "FAILED" : "ok" );
+  return failures;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Print a measured figure.
+ ******************************************************************************/
+void USBSIMTEST_Report( const char *name, double value, const char *unit )
+{
+  printf( "  %-44s %10.2f %s\n", name, value, unit );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Fill a buffer with a reproducible pseudo random pattern.
+ ******************************************************************************/
+void USBSIMTEST_Fill( uint8_t *buf, int len, uint32_t seed )
+{
+  int i;
+
+  for ( i = 0; i < len; i++ )
+  {
+    seed     = seed * 1103515245 + 12345;
+    buf[ i ] = (uint8_t)( seed >> 16 );
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Start a measurement, take a copy of the clock and of the model counters.
+ ******************************************************************************/
+void USBSIMTEST_Start( USBSIMTEST_Mark_TypeDef *mark )
+{
+  mark->startUs = USBSIM_GetTimeUs();
+  USBSIM_GetStats( &mark->stats );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Simulated time since @ref USBSIMTEST_Start().
+ ******************************************************************************/
+uint64_t USBSIMTEST_ElapsedUs( const USBSIMTEST_Mark_TypeDef *mark )
+{
+  return USBSIM_GetTimeUs() - mark->startUs;
+}
+
+static void *StaticStackThread( void *arg )
+{
+  return (void*)(intptr_t)( (int(*)( void ))arg )();
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Run a test scenario on a thread with its stack in static storage.
+ *
+ * @details
+ *   The DMAADDR registers are 32 bit wide. Class drivers which place transfer
+ *   buffers on the stack, as msdh.c does, must run on a stack which is below
+ *   4 GB in a non position independent executable.
+ *
+ * @return
+ *   The return value of @p scenario.
+ ******************************************************************************/
+int USBSIMTEST_RunOnStaticStack( int (*scenario)( void ) )
+{
+  void *ret;
+  pthread_t thread;
+  pthread_attr_t attr;
+
+  pthread_attr_init( &attr );
+  pthread_attr_setstack( &attr, staticStack, sizeof( staticStack ) );
+  pthread_create( &thread, &attr, StaticStackThread, (void*)scenario );
+  pthread_join( thread, &ret );
+  pthread_attr_destroy( &attr );
+  return (int)(intptr_t)ret;
+}
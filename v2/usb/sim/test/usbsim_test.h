@@ -0,0 +1,59 @@
+/***************************************************************************//**
+ * @file usbsim_test.h
+ * @brief Common helpers for the USB core model test programs.
+ * @version 3.20.7
+ *******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#ifndef __USBSIM_TEST_H
+#define __USBSIM_TEST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "em_device.h"
+#include "em_usb.h"
+#include "em_usbsim.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The test programs print one "name: value unit" line per figure, and one
+ * "FAIL: ..." line per failed check. The exit code is the number of failed
+ * checks, so a CI job only has to run the programs and test the exit code.
+ */
+
+/** Timeout for scripted transactions, in milliseconds. */
+#define USBSIMTEST_TIMEOUT  1000
+
+void     USBSIMTEST_Check(  bool ok, const char *what );
+int      USBSIMTEST_Done(   const char *name );
+void     USBSIMTEST_Report( const char *name, double value, const char *unit );
+void     USBSIMTEST_Fill(   uint8_t *buf, int len, uint32_t seed );
+
+/** @brief Simulated time and model counters at the start of a measurement. */
+typedef struct
+{
+  uint64_t              startUs;
+  USBSIM_Stats_TypeDef  stats;
+} USBSIMTEST_Mark_TypeDef;
+
+void     USBSIMTEST_Start(  USBSIMTEST_Mark_TypeDef *mark );
+uint64_t USBSIMTEST_ElapsedUs( const USBSIMTEST_Mark_TypeDef *mark );
+int      USBSIMTEST_RunOnStaticStack( int (*scenario)( void ) );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBSIM_TEST_H */
@@ -112,6 +112,30 @@ int USBD_AbortTransfer( int epAddr )
   return USB_STATUS_OK;
 }
 
+#if defined( USB_EP_STATS )
+/***************************************************************************//**
+ * @brief
+ *   Clear the traffic statistics of all endpoints.
+ *
+ * @details
+ *   Also restarts the frame count, see @ref USBD_GetEpStats().
+ *   Only available when @em usbconfig.h defines USB_EP_STATS.
+ ******************************************************************************/
+void USBD_ClearEpStats( void )
+{
+  int i;
+
+  INT_Disable();
+  for ( i = 0; i <= NUM_EP_USED; i++ )
+  {
+    memset( &dev->ep[ i ].stats, 0, sizeof( USBD_EpStats_TypeDef ) );
+    dev->ep[ i ].statsFrameBytes = 0;
+  }
+  dev->statsFrames = 0;
+  INT_Enable();
+}
+#endif /* defined( USB_EP_STATS ) */
+
 /***************************************************************************//**
  * @brief
  *   Start USB device operation.
@@ -169,6 +193,222 @@ bool USBD_EpIsBusy( int epAddr )
   return true;
 }
 
+/***************************************************************************//**
+ * @brief
+ *   Compute endpoint FIFO buffering multipliers from a traffic profile.
+ *
+ * @details
+ *   Parses the configuration descriptor like @ref USBD_Init() does and
+ *   fills in a bufferingMultiplier array which can be passed in the
+ *   @ref USBD_Init_TypeDef struct.
+ *
+ *   Each endpoint gets single buffering first. The remaining FIFO RAM is
+ *   then handed out one packet at a time to the endpoint with the largest
+ *   unmet demand per FIFO word, until every endpoint can hold the peak
+ *   number of packets it must move in one frame (at most
+ *   @ref USBD_FIFO_MAX_MULTIPLIER) or RAM runs out. Isochronous endpoints
+ *   ask for at least double buffering so that the next frame's packet can be
+ *   loaded while the current one is on the bus.
+ *
+ *   Use @ref USBD_GetEpStats() on a running device to verify the layout, a
+ *   growing fifoEmpty or NAK count on an endpoint with traffic suggests that
+ *   it needs more buffering.
+ *
+ * @param[in] deviceDescriptor
+ *   Pointer to the device descriptor.
+ *
+ * @param[in] configDescriptor
+ *   Pointer to the configuration descriptor.
+ *
+ * @param[in] traffic
+ *   Array of declared peak traffic per endpoint. Endpoints not listed get
+ *   single buffering.
+ *
+ * @param[in] numTraffic
+ *   Number of elements in the traffic array.
+ *
+ * @param[out] bufferingMultiplier
+ *   Array of NUM_EP_USED + 1 elements which receives the multipliers, EP0
+ *   first and then the endpoints in configuration descriptor order.
+ *
+ * @return
+ *   Number of FIFO words left unused, or USB_STATUS_ILLEGAL if the
+ *   descriptors or the traffic profile are invalid, or if the endpoints do
+ *   not fit in FIFO RAM even with single buffering.
+ ******************************************************************************/
+int USBD_FifoLayout( const USB_DeviceDescriptor_TypeDef *deviceDescriptor,
+                     const uint8_t *configDescriptor,
+                     const USBD_EpTraffic_TypeDef *traffic,
+                     int numTraffic,
+                     uint8_t *bufferingMultiplier )
+{
+  int i, j, numEps, best, used, cost, bestCost, bestNeed;
+  const uint8_t *conf, *confEnd;
+  const USB_EndpointDescriptor_TypeDef *epd;
+  uint8_t  addr[ MAX_NUM_IN_EPS + MAX_NUM_OUT_EPS ];
+  uint8_t  target[ MAX_NUM_IN_EPS + MAX_NUM_OUT_EPS ];
+  uint16_t mps[ MAX_NUM_IN_EPS + MAX_NUM_OUT_EPS ];
+  uint8_t  *mult = bufferingMultiplier + 1;
+
+  /* Parse configuration descriptor */
+  numEps  = 0;
+  conf    = configDescriptor;
+  confEnd = conf + ((const USB_ConfigurationDescriptor_TypeDef*)
+                    configDescriptor)->wTotalLength;
+
+  while ( conf < confEnd )
+  {
+    if ( *conf == 0 )
+    {
+      DEBUG_USB_API_PUTS( "\nUSBD_FifoLayout(), Illegal configuration descriptor" );
+      EFM_ASSERT( false );
+      return USB_STATUS_ILLEGAL;
+    }
+
+    if ( *(conf + 1) == USB_ENDPOINT_DESCRIPTOR )
+    {
+      if ( numEps == MAX_NUM_IN_EPS + MAX_NUM_OUT_EPS )
+      {
+        DEBUG_USB_API_PUTS( "\nUSBD_FifoLayout(), Illegal EP count" );
+        EFM_ASSERT( false );
+        return USB_STATUS_ILLEGAL;
+      }
+
+      epd = (const USB_EndpointDescriptor_TypeDef*)conf;
+      addr[ numEps ]   = epd->bEndpointAddress;
+      mps[ numEps ]    = epd->wMaxPacketSize;
+      target[ numEps ] = 1;
+      if ( ( epd->bmAttributes & CONFIG_DESC_BM_TRANSFERTYPE )
+           == USB_EPTYPE_ISOC )
+      {
+        target[ numEps ] = 2;
+      }
+      mult[ numEps ] = 1;
+      numEps++;
+    }
+
+    conf += *conf;
+  }
+
+  /* Turn the declared traffic into a packet count per frame. */
+  for ( i = 0; i < numTraffic; i++ )
+  {
+    for ( j = 0; j < numEps; j++ )
+    {
+      if ( addr[ j ] == traffic[ i ].epAddr )
+        break;
+    }
+
+    if ( j == numEps )
+    {
+      DEBUG_USB_API_PUTS( "\nUSBD_FifoLayout(), Illegal endpoint" );
+      EFM_ASSERT( false );
+      return USB_STATUS_ILLEGAL;
+    }
+
+    if ( mps[ j ] )
+    {
+      cost = ( traffic[ i ].bytesPerFrame + mps[ j ] - 1 ) / mps[ j ];
+      target[ j ] = EFM32_MAX( target[ j ],
+                               EFM32_MIN( cost, USBD_FIFO_MAX_MULTIPLIER ) );
+    }
+  }
+
+  /* FIFO RAM used with single buffering, see USBD_Init() and
+   * USBDHAL_CoreInit(). */
+  bufferingMultiplier[ 0 ] = 1;
+  used = USBD_Ep0FifoWords( deviceDescriptor->bMaxPacketSize0 );
+  for ( j = 0; j < numEps; j++ )
+  {
+    used += USBD_EpFifoWords( addr[ j ] & USB_SETUP_DIR_MASK, mps[ j ], 1 );
+  }
+
+  if ( used > (int)MAX_DEVICE_FIFO_SIZE_INWORDS )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBD_FifoLayout(), FIFO RAM exhausted" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
+  /* Hand out one more packet at a time, largest unmet demand per word first. */
+  for (;;)
+  {
+    best     = -1;
+    bestCost = 1;
+    bestNeed = 0;
+    for ( j = 0; j < numEps; j++ )
+    {
+      if ( mult[ j ] >= target[ j ] )
+        continue;
+
+      cost = USBD_EpFifoWords( addr[ j ] & USB_SETUP_DIR_MASK, mps[ j ],
+                               mult[ j ] + 1 )
+             - USBD_EpFifoWords( addr[ j ] & USB_SETUP_DIR_MASK, mps[ j ],
+                                 mult[ j ] );
+
+      if ( used + cost > (int)MAX_DEVICE_FIFO_SIZE_INWORDS )
+        continue;
+
+      /* Compare need/cost ratios without dividing. */
+      if ( ( best == -1 ) ||
+           ( ( target[ j ] - mult[ j ] ) * bestCost > bestNeed * cost ) )
+      {
+        best     = j;
+        bestCost = cost;
+        bestNeed = target[ j ] - mult[ j ];
+      }
+    }
+
+    if ( best == -1 )
+      break;
+
+    mult[ best ]++;
+    used += bestCost;
+  }
+
+  return MAX_DEVICE_FIFO_SIZE_INWORDS - used;
+}
+
+#if defined( USB_EP_STATS )
+/***************************************************************************//**
+ * @brief
+ *   Get the traffic statistics of an endpoint.
+ *
+ * @details
+ *   The statistics are collected since @ref USBD_Init() or the last call to
+ *   @ref USBD_ClearEpStats(). Counting NAK's costs one interrupt per NAK
+ *   handshake, so define USB_EP_STATS in @em usbconfig.h for tuning and
+ *   test builds only.
+ *
+ * @param[in] epAddr
+ *   Endpoint address, EP0 is not supported.
+ *
+ * @param[out] stats
+ *   Receives the statistics.
+ *
+ * @return
+ *   @ref USB_STATUS_OK, or @ref USB_STATUS_ILLEGAL on an invalid endpoint.
+ ******************************************************************************/
+int USBD_GetEpStats( int epAddr, USBD_EpStats_TypeDef *stats )
+{
+  USBD_Ep_TypeDef *ep = USBD_GetEpFromAddr( epAddr );
+
+  if ( ( ep == NULL ) || ( ep->num == 0 ) )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBD_GetEpStats(), Illegal endpoint" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
+  INT_Disable();
+  *stats        = ep->stats;
+  stats->frames = dev->statsFrames;
+  INT_Enable();
+
+  return USB_STATUS_OK;
+}
+#endif /* defined( USB_EP_STATS ) */
+
 /***************************************************************************//**
  * @brief
  *   Get current USB device state.
@@ -389,13 +629,23 @@ int USBD_Init( const USBD_Init_TypeDef *p )
     {
       id = (USB_InterfaceDescriptor_TypeDef*)conf;
 
-      if ( dev->numberOfInterfaces != id->bInterfaceNumber )
-        {
-          DEBUG_USB_API_PUTS( "\nUSBD_Init(), Illegal interface number" );
-          EFM_ASSERT( false );
-          return USB_STATUS_ILLEGAL;
-        }
-      dev->numberOfInterfaces++;
+      /* Alternate settings reuse the interface number of setting 0. */
+      if ( id->bAlternateSetting == 0 )
+      {
+        if ( dev->numberOfInterfaces != id->bInterfaceNumber )
+          {
+            DEBUG_USB_API_PUTS( "\nUSBD_Init(), Illegal interface number" );
+            EFM_ASSERT( false );
+            return USB_STATUS_ILLEGAL;
+          }
+        dev->numberOfInterfaces++;
+      }
+      else if ( id->bInterfaceNumber >= dev->numberOfInterfaces )
+      {
+        DEBUG_USB_API_PUTS( "\nUSBD_Init(), Illegal alternate setting" );
+        EFM_ASSERT( false );
+        return USB_STATUS_ILLEGAL;
+      }
     }
 
     conf += *conf;
@@ -483,6 +733,11 @@ int USBD_Init( const USBD_Init_TypeDef *p )
  *   If it is possible that the host will send more data than your device
  *   expects, round buffer size up to the next multiple of maxpacket size.
  *
+ * @note
+ *   On isochronous endpoints a transfer is one packet, it is scheduled for
+ *   the frame following the current one. Re-arm the endpoint from the
+ *   transfer complete callback to receive a packet every frame.
+ *
  * @param[in] epAddr
  *   Endpoint address.
  *
@@ -519,6 +774,13 @@ int USBD_Read( int epAddr, void *data, int byteCount,
     return USB_STATUS_ILLEGAL;
   }
 
+  if ( ( ep->type == USB_EPTYPE_ISOC ) && ( byteCount > ep->packetSize ) )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBD_Read(), Isochronous transfer larger than one packet" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
   if ( (uint32_t)data & 3 )
   {
     DEBUG_USB_API_PUTS( "\nUSBD_Read(), Misaligned data buffer" );
@@ -758,6 +1020,11 @@ int USBD_UnStallEp( int epAddr )
  * @brief
  *   Start a write (IN) transfer on an endpoint.
  *
+ * @note
+ *   On isochronous endpoints a transfer is one packet, it is sent in the
+ *   frame following the current one. If the host does not poll the endpoint
+ *   in that frame, the packet is moved to the next frame.
+ *
  * @param[in] epAddr
  *   Endpoint address.
  *
@@ -794,6 +1061,13 @@ int USBD_Write( int epAddr, void *data, int byteCount,
     return USB_STATUS_ILLEGAL;
   }
 
+  if ( ( ep->type == USB_EPTYPE_ISOC ) && ( byteCount > ep->packetSize ) )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBD_Write(), Isochronous transfer larger than one packet" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
   if ( (uint32_t)data & 3 )
   {
     DEBUG_USB_API_PUTS( "\nUSBD_Write(), Misaligned data buffer" );
@@ -965,6 +1239,14 @@ int USBD_Write( int epAddr, void *data, int byteCount,
     Check if it is ok to enter energy mode EM2. Refer to the
     @ref usb_device_powersave section for more information.
 
+  @ref USBD_FifoLayout() @n
+    Compute the bufferingMultiplier array of @ref USBD_Init_TypeDef from the
+    peak traffic each endpoint must sustain per frame.
+
+  @ref USBD_GetEpStats(), @ref USBD_ClearEpStats() @n
+    Per endpoint byte, transfer, NAK and FIFO empty counts, and the most
+    bytes moved in one frame. Only available when USB_EP_STATS is defined.
+
   @n @anchor TransferCallback <b>The transfer complete callback function:</b> @n
     @n USB_XferCompleteCb_TypeDef() is called when a transfer completes. It is
     called with three parameters, the status of the transfer, the number of
@@ -1061,6 +1343,10 @@ extern int RETARGET_WriteChar(char c);
                               // If not specified, TIMER0 is used
 
 #define USB_VBUS_SWITCH_NOT_PRESENT  // Hardware does not have a VBUS switch
+
+#define USB_EP_STATS                 // Collect endpoint traffic statistics,
+                              // see USBD_GetEpStats(). Adds one interrupt
+                              // per NAK, use for tuning and test builds.
 @endverbatim
 
   @n You are strongly encouraged to start application development with DEBUG_USB_API
@@ -0,0 +1,423 @@
+/**************************************************************************//**
+ * @file em_usbdclass.c
+ * @brief USB protocol stack library, composite device class framework.
+ * @version 3.20.7
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2014 Silicon Labs, http://www.silabs.com</b>
+ *******************************************************************************
+ *
+ * This file is licensed under the Silabs License Agreement. See the file
+ * "Silabs_License_Agreement.txt" for details. Before using this software for
+ * any purpose, you must agree to the terms of that agreement.
+ *
+ ******************************************************************************/
+
+#include "em_device.h"
+#if defined( USB_PRESENT ) && ( USB_COUNT == 1 )
+#include "em_usb.h"
+#if defined( USB_DEVICE )
+
+#include "em_usbtypes.h"
+#include "em_usbdclass.h"
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+static int  SetupCmd( const USB_Setup_TypeDef *setup );
+static void SofInt( uint16_t sofNr );
+static void StateChange( USBD_State_TypeDef oldState,
+                         USBD_State_TypeDef newState );
+
+static USBD_ClassFunction_TypeDef * const *functions;
+static uint8_t numFunctions;
+static int fifoUsage;
+static USBD_DeviceStateChangeCb_TypeDef appStateChange;
+
+/* Function index owning each interface and endpoint number. */
+static uint8_t ifFunction[ USBD_CLASS_MAX_INTERFACES ];
+static uint8_t inEpFunction[ MAX_NUM_IN_EPS + 1 ];
+static uint8_t outEpFunction[ MAX_NUM_OUT_EPS + 1 ];
+
+static uint8_t bufferingMultiplier[ NUM_EP_USED + 1 ];
+
+/* Callbacks are constant, select the set enabling SOF only when needed. */
+static const USBD_Callbacks_TypeDef callbacks =
+{
+  .usbReset        = NULL,
+  .usbStateChange  = StateChange,
+  .setupCmd        = SetupCmd,
+  .isSelfPowered   = NULL,
+  .sofInt          = NULL
+};
+
+static const USBD_Callbacks_TypeDef callbacksSof =
+{
+  .usbReset        = NULL,
+  .usbStateChange  = StateChange,
+  .setupCmd        = SetupCmd,
+  .isSelfPowered   = NULL,
+  .sofInt          = SofInt
+};
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Initialize a composite USB device from a set of class functions.
+ *
+ * @details
+ *   The descriptor templates of the class functions are copied into the
+ *   configuration descriptor buffer, and interface and endpoint numbers are
+ *   assigned in function order. IN and OUT endpoints are numbered
+ *   separately starting at 1. The endpoint FIFO buffering is taken from the
+ *   functions, and setup requests are dispatched to the function owning the
+ *   interface or endpoint addressed. Finally @ref USBD_Init() is called.
+ *
+ *   Class functions transfer data directly to and from buffers supplied by
+ *   the application, the framework itself only keeps a few bytes of
+ *   lookup tables per device.
+ *
+ * @param[in] p
+ *   Pointer to composite device initialization struct.
+ *   See @ref USBD_ClassInit_TypeDef.
+ *
+ * @return
+ *   @ref USB_STATUS_OK on success, else an appropriate error code.
+ ******************************************************************************/
+int USBD_ClassInit( const USBD_ClassInit_TypeDef *p )
+{
+  int i, len, total, numIf, numEps, numInEps, numOutEps, mps;
+  bool sof;
+  uint8_t *d, *end;
+  USBD_ClassFunction_TypeDef *fn;
+  USBD_Init_TypeDef init =
+  {
+    .deviceDescriptor    = p->deviceDescriptor,
+    .configDescriptor    = p->configBuffer,
+    .stringDescriptors   = p->stringDescriptors,
+    .numberOfStrings     = p->numberOfStrings,
+    .bufferingMultiplier = bufferingMultiplier,
+    .callbacks           = &callbacks,
+    .reserved            = 0
+  };
+
+  if ( ( p->numFunctions == 0                        ) ||
+       ( p->numFunctions > USBD_CLASS_MAX_FUNCTIONS  ) ||
+       ( (uint32_t)p->configBuffer & 3               )    )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), Illegal parameter" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
+  functions      = p->functions;
+  numFunctions   = p->numFunctions;
+  appStateChange = p->usbStateChange;
+  memset( ifFunction,    USBD_CLASS_NONE, sizeof( ifFunction ) );
+  memset( inEpFunction,  USBD_CLASS_NONE, sizeof( inEpFunction ) );
+  memset( outEpFunction, USBD_CLASS_NONE, sizeof( outEpFunction ) );
+
+  total     = USB_CONFIG_DESCSIZE;
+  numIf     = 0;
+  numEps    = 0;
+  numInEps  = 0;
+  numOutEps = 0;
+  sof       = false;
+
+  /* EP0 fifo usage, Rx-FIFO also holds SETUP packets and status info. */
+  bufferingMultiplier[ 0 ] = 1;
+  fifoUsage = USBD_Ep0FifoWords( p->deviceDescriptor->bMaxPacketSize0 ) * 4;
+
+  for ( i = 0; i < numFunctions; i++ )
+  {
+    fn  = functions[ i ];
+    len = fn->descriptorsLength;
+
+    if ( total + len > p->configBufferSize )
+    {
+      DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), Configuration buffer too small" );
+      EFM_ASSERT( false );
+      return USB_STATUS_ILLEGAL;
+    }
+
+    memcpy( p->configBuffer + total, fn->descriptors, len );
+    fn->firstInterface = numIf;
+    fn->numInterfaces  = 0;
+    fn->numEps         = 0;
+    fn->fifoBytes      = 0;
+
+    d   = p->configBuffer + total;
+    end = d + len;
+    while ( d < end )
+    {
+      if ( ( d[ 0 ] < 2 ) || ( d + d[ 0 ] > end ) )
+      {
+        DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), Illegal descriptor template" );
+        EFM_ASSERT( false );
+        return USB_STATUS_ILLEGAL;
+      }
+
+      if ( d[ 1 ] == USB_INTERFACE_ASSOCIATION_DESCRIPTOR )
+      {
+        d[ 2 ] += fn->firstInterface;               /* bFirstInterface    */
+      }
+      else if ( d[ 1 ] == USB_INTERFACE_DESCRIPTOR )
+      {
+        d[ 2 ] += fn->firstInterface;               /* bInterfaceNumber   */
+        if ( d[ 3 ] == 0 )                          /* bAlternateSetting  */
+        {
+          fn->numInterfaces++;
+          numIf++;
+        }
+
+        if ( d[ 2 ] >= USBD_CLASS_MAX_INTERFACES )
+        {
+          DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), Too many interfaces" );
+          EFM_ASSERT( false );
+          return USB_STATUS_ILLEGAL;
+        }
+        ifFunction[ d[ 2 ] ] = i;
+      }
+      else if ( d[ 1 ] == USB_ENDPOINT_DESCRIPTOR )
+      {
+        if ( ( fn->numEps == USBD_CLASS_MAX_EPS ) || ( numEps == NUM_EP_USED ) )
+        {
+          DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), Illegal EP count" );
+          EFM_ASSERT( false );
+          return USB_STATUS_ILLEGAL;
+        }
+
+        mps = d[ 4 ] | ( d[ 5 ] << 8 );             /* wMaxPacketSize     */
+        numEps++;
+        bufferingMultiplier[ numEps ] = fn->bufferingMultiplier ?
+                                fn->bufferingMultiplier[ fn->numEps ] : 1;
+
+        if ( d[ 2 ] & USB_SETUP_DIR_MASK )          /* bEndpointAddress   */
+        {
+          if ( ++numInEps > MAX_NUM_IN_EPS )
+          {
+            DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), Illegal IN EP count" );
+            EFM_ASSERT( false );
+            return USB_STATUS_ILLEGAL;
+          }
+          d[ 2 ] = USB_SETUP_DIR_MASK | numInEps;
+          inEpFunction[ numInEps ] = i;
+        }
+        else
+        {
+          if ( ++numOutEps > MAX_NUM_OUT_EPS )
+          {
+            DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), Illegal OUT EP count" );
+            EFM_ASSERT( false );
+            return USB_STATUS_ILLEGAL;
+          }
+          d[ 2 ] = numOutEps;
+          outEpFunction[ numOutEps ] = i;
+        }
+
+        /* Same layout as USBDHAL_CoreInit(), small Tx FIFOs are rounded up */
+        fn->fifoBytes += USBD_EpFifoWords( d[ 2 ] & USB_SETUP_DIR_MASK, mps,
+                                           bufferingMultiplier[ numEps ] ) * 4;
+        fn->epAddr[ fn->numEps++ ] = d[ 2 ];
+      }
+
+      d += d[ 0 ];
+    }
+
+    if ( fn->driver->patchDescriptors )
+    {
+      fn->driver->patchDescriptors( fn, p->configBuffer + total, len );
+    }
+
+    if ( fn->driver->sofInt )
+    {
+      sof = true;
+    }
+
+    fifoUsage += fn->fifoBytes;
+    total     += len;
+  }
+
+  if ( numEps != NUM_EP_USED )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), Illegal EP count" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
+  if ( fifoUsage > (int)( MAX_DEVICE_FIFO_SIZE_INWORDS * 4 ) )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBD_ClassInit(), FIFO size exceeded" );
+    EFM_ASSERT( false );
+    return USB_STATUS_ILLEGAL;
+  }
+
+  d = p->configBuffer;
+  d[ 0 ] = USB_CONFIG_DESCSIZE;                     /* bLength            */
+  d[ 1 ] = USB_CONFIG_DESCRIPTOR;                   /* bDescriptorType    */
+  d[ 2 ] = total & 0xFF;                            /* wTotalLength       */
+  d[ 3 ] = total >> 8;
+  d[ 4 ] = numIf;                                   /* bNumInterfaces     */
+  d[ 5 ] = 1;                                       /* bConfigurationValue*/
+  d[ 6 ] = 0;                                       /* iConfiguration     */
+  d[ 7 ] = p->bmAttributes | CONFIG_DESC_BM_RESERVED_D7;
+  d[ 8 ] = p->bMaxPower;
+
+  if ( sof )
+  {
+    init.callbacks = &callbacksSof;
+  }
+
+  return USBD_Init( &init );
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the class function owning an interface.
+ *
+ * @param[in] interfaceNumber
+ *   Interface number.
+ *
+ * @return
+ *   The class function, or NULL if the interface does not exist.
+ ******************************************************************************/
+USBD_ClassFunction_TypeDef *USBD_ClassGetFunction( int interfaceNumber )
+{
+  if ( ( interfaceNumber < 0                          ) ||
+       ( interfaceNumber >= USBD_CLASS_MAX_INTERFACES ) ||
+       ( ifFunction[ interfaceNumber ] == USBD_CLASS_NONE ) )
+  {
+    return NULL;
+  }
+
+  return functions[ ifFunction[ interfaceNumber ] ];
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the total endpoint FIFO space used by the device.
+ *
+ * @details
+ *   Includes EP0 and the Rx-FIFO overhead. Use the fifoBytes member of
+ *   @ref USBD_ClassFunction_TypeDef for the usage of a single function.
+ *
+ * @return
+ *   FIFO usage in bytes.
+ ******************************************************************************/
+int USBD_ClassGetFifoUsage( void )
+{
+  return fifoUsage;
+}
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/*
+ * Dispatch a setup request. Interface and endpoint requests go to the owner
+ * of the interface or endpoint, class and vendor requests to the device go
+ * to the functions accepting them. Unhandled requests are taken care of by
+ * the device stack.
+ */
+static int SetupCmd( const USB_Setup_TypeDef *setup )
+{
+  int i, index, num;
+  USBD_ClassFunction_TypeDef *fn;
+  int retVal = USB_STATUS_REQ_UNHANDLED;
+
+  index = USBD_CLASS_NONE;
+  num   = setup->wIndex & 0xFF;
+
+  switch ( setup->Recipient )
+  {
+    case USB_SETUP_RECIPIENT_INTERFACE:
+      if ( num < USBD_CLASS_MAX_INTERFACES )
+      {
+        index = ifFunction[ num ];
+      }
+      break;
+
+    case USB_SETUP_RECIPIENT_ENDPOINT:
+      if ( num & USB_SETUP_DIR_MASK )
+      {
+        num &= USB_EPNUM_MASK;
+        if ( num <= MAX_NUM_IN_EPS )
+        {
+          index = inEpFunction[ num ];
+        }
+      }
+      else if ( num <= MAX_NUM_OUT_EPS )
+      {
+        index = outEpFunction[ num ];
+      }
+      break;
+
+    default:
+      if ( setup->Type != USB_SETUP_TYPE_STANDARD )
+      {
+        for ( i = 0; i < numFunctions; i++ )
+        {
+          fn = functions[ i ];
+          if ( fn->deviceRequests && fn->driver->setupCmd )
+          {
+            retVal = fn->driver->setupCmd( fn, setup );
+            if ( retVal != USB_STATUS_REQ_UNHANDLED )
+            {
+              break;
+            }
+          }
+        }
+      }
+      return retVal;
+  }
+
+  if ( index != USBD_CLASS_NONE )
+  {
+    fn = functions[ index ];
+    if ( fn->driver->setupCmd )
+    {
+      retVal = fn->driver->setupCmd( fn, setup );
+    }
+  }
+
+  return retVal;
+}
+
+static void SofInt( uint16_t sofNr )
+{
+  int i;
+  USBD_ClassFunction_TypeDef *fn;
+
+  for ( i = 0; i < numFunctions; i++ )
+  {
+    fn = functions[ i ];
+    if ( fn->driver->sofInt )
+    {
+      fn->driver->sofInt( fn, sofNr );
+    }
+  }
+}
+
+static void StateChange( USBD_State_TypeDef oldState,
+                         USBD_State_TypeDef newState )
+{
+  int i;
+  USBD_ClassFunction_TypeDef *fn;
+
+  for ( i = 0; i < numFunctions; i++ )
+  {
+    fn = functions[ i ];
+    if ( fn->driver->stateChange )
+    {
+      fn->driver->stateChange( fn, oldState, newState );
+    }
+  }
+
+  if ( appStateChange )
+  {
+    appStateChange( oldState, newState );
+  }
+}
+
+/** @endcond */
+
+#endif /* defined( USB_DEVICE ) */
+#endif /* defined( USB_PRESENT ) && ( USB_COUNT == 1 ) */
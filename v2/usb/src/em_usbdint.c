@@ -27,14 +27,25 @@
 
 #define HANDLE_INT( x ) if ( status & x ) { Handle_##x(); status &= ~x; }
 
-static void Handle_USB_GINTSTS_ENUMDONE  ( void );
-static void Handle_USB_GINTSTS_IEPINT    ( void );
-static void Handle_USB_GINTSTS_OEPINT    ( void );
-static void Handle_USB_GINTSTS_RESETDET  ( void );
-static void Handle_USB_GINTSTS_SOF       ( void );
-static void Handle_USB_GINTSTS_USBRST    ( void );
-static void Handle_USB_GINTSTS_USBSUSP   ( void );
-static void Handle_USB_GINTSTS_WKUPINT   ( void );
+static void Handle_USB_GINTSTS_ENUMDONE   ( void );
+static void Handle_USB_GINTSTS_IEPINT     ( void );
+static void Handle_USB_GINTSTS_INCOMPISOIN( void );
+static void Handle_USB_GINTSTS_INCOMPLP   ( void );
+static void Handle_USB_GINTSTS_OEPINT     ( void );
+static void Handle_USB_GINTSTS_RESETDET   ( void );
+static void Handle_USB_GINTSTS_SOF        ( void );
+static void Handle_USB_GINTSTS_USBRST     ( void );
+static void Handle_USB_GINTSTS_USBSUSP    ( void );
+static void Handle_USB_GINTSTS_WKUPINT    ( void );
+
+#if defined( USB_EP_STATS )
+static void EpStatsFrameDone( void );
+static void EpStatsXferDone( USBD_Ep_TypeDef *ep );
+
+/* Per endpoint NAK and FIFO empty interrupts, only used for statistics. */
+#define DIEP_STATS_INTS ( USB_DIEP_INT_NAKINTRPT | USB_DIEP_INT_INTKNTXFEMP )
+#define DOEP_STATS_INTS ( USB_DOEP_INT_NAKINTRPT )
+#endif
 
 #if ( USB_PWRSAVE_MODE )
 /* Variables and prototypes for USB powerdown (suspend) functionality. */
@@ -165,6 +176,8 @@ void USB_IRQHandler( void )
   HANDLE_INT( USB_GINTSTS_USBRST     )
   HANDLE_INT( USB_GINTSTS_IEPINT     )
   HANDLE_INT( USB_GINTSTS_OEPINT     )
+  HANDLE_INT( USB_GINTSTS_INCOMPISOIN )
+  HANDLE_INT( USB_GINTSTS_INCOMPLP   )
 
   INT_Enable();
 
@@ -213,6 +226,20 @@ static void Handle_USB_GINTSTS_IEPINT( void )
       ep = USBD_GetEpFromAddr( USB_SETUP_DIR_MASK | epnum );
       status = USBDHAL_GetInEpInts( ep );
 
+#if defined( USB_EP_STATS )
+      if ( status & DIEP_STATS_INTS )
+      {
+        USB_DINEPS[ epnum ].INT = DIEP_STATS_INTS;
+        if ( epnum != 0 )
+        {
+          if ( status & USB_DIEP_INT_NAKINTRPT )
+            ep->stats.naks++;
+          if ( status & USB_DIEP_INT_INTKNTXFEMP )
+            ep->stats.fifoEmpty++;
+        }
+      }
+#endif
+
       if ( status & USB_DIEP_INT_XFERCOMPL )
       {
         USB_DINEPS[ epnum ].INT = USB_DIEP_INT_XFERCOMPL;
@@ -240,6 +267,9 @@ static void Handle_USB_GINTSTS_IEPINT( void )
                             _USB_DIEP_TSIZ_XFERSIZE_MASK    ) >>
                           _USB_DIEP_TSIZ_XFERSIZE_SHIFT          );
           ep->remaining -= ep->xferred;
+#if defined( USB_EP_STATS )
+          EpStatsXferDone( ep );
+#endif
           USBDEP_EpHandler( ep->addr );
         }
       }
@@ -269,6 +299,15 @@ static void Handle_USB_GINTSTS_OEPINT( void )
       ep = USBD_GetEpFromAddr( epnum );
       status = USBDHAL_GetOutEpInts( ep );
 
+#if defined( USB_EP_STATS )
+      if ( status & DOEP_STATS_INTS )
+      {
+        USB_DOUTEPS[ epnum ].INT = DOEP_STATS_INTS;
+        if ( epnum != 0 )
+          ep->stats.naks++;
+      }
+#endif
+
       if ( status & USB_DOEP_INT_XFERCOMPL )
       {
         USB_DOUTEPS[ epnum ].INT = USB_DOEP_INT_XFERCOMPL;
@@ -295,6 +334,9 @@ static void Handle_USB_GINTSTS_OEPINT( void )
               ( ( USB_DOUTEPS[ epnum ].TSIZ & _USB_DOEP_TSIZ_XFERSIZE_MASK ) >>
                 _USB_DOEP_TSIZ_XFERSIZE_SHIFT );
           ep->remaining -= ep->xferred;
+#if defined( USB_EP_STATS )
+          EpStatsXferDone( ep );
+#endif
           USBDEP_EpHandler( ep->addr );
         }
       }
@@ -332,6 +374,58 @@ static void Handle_USB_GINTSTS_OEPINT( void )
   }
 }
 
+/*
+ * Reschedule isochronous endpoints which missed the frame they were armed
+ * for (the host did not poll them in that frame). The transfer is kept and
+ * moved to the next frame.
+ */
+static void RescheduleIsocEps( bool in )
+{
+  int i;
+  uint32_t depctl;
+  USBD_Ep_TypeDef *ep;
+  volatile uint32_t *ctl;
+
+  for ( i = 1; i <= NUM_EP_USED; i++ )
+  {
+    ep = &dev->ep[ i ];
+
+    if ( ( ep->type != USB_EPTYPE_ISOC ) || ( ep->in != in ) ||
+         ( ep->state == D_EP_IDLE     )                          )
+    {
+      continue;
+    }
+
+    ctl = in ? &USB_DINEPS[ ep->num ].CTL : &USB_DOUTEPS[ ep->num ].CTL;
+    depctl = *ctl & ~DEPCTL_WO_BITMASK;
+
+    if ( depctl & USB_DIEP_CTL_EPENA )
+    {
+      *ctl = depctl | USBDHAL_GetIsocFrameParity();
+    }
+  }
+}
+
+/*
+ * Handle incomplete isochronous IN transfer interrupt.
+ */
+static void Handle_USB_GINTSTS_INCOMPISOIN( void )
+{
+  USB->GINTSTS = USB_GINTSTS_INCOMPISOIN;
+  DEBUG_USB_INT_LO_PUTS( "IsoI" );
+  RescheduleIsocEps( true );
+}
+
+/*
+ * Handle incomplete isochronous OUT transfer interrupt.
+ */
+static void Handle_USB_GINTSTS_INCOMPLP( void )
+{
+  USB->GINTSTS = USB_GINTSTS_INCOMPLP;
+  DEBUG_USB_INT_LO_PUTS( "IsoO" );
+  RescheduleIsocEps( false );
+}
+
 /*
  * Handle USB reset detectet interrupt in suspend mode.
  */
@@ -368,6 +462,11 @@ static void Handle_USB_GINTSTS_SOF( void )
 {
   USB->GINTSTS = USB_GINTSTS_SOF;
 
+#if defined( USB_EP_STATS )
+  EpStatsFrameDone();
+  dev->statsFrames++;
+#endif
+
   if ( dev->callbacks->sofInt )
   {
     dev->callbacks->sofInt(
@@ -402,6 +501,11 @@ static void Handle_USB_GINTSTS_USBRST( void )
   USB->DAINTMSK = USB_DAINTMSK_INEPMSK0 | USB_DAINTMSK_OUTEPMSK0;
   USB->DOEPMSK  = USB_DOEPMSK_SETUPMSK  | USB_DOEPMSK_XFERCOMPLMSK;
   USB->DIEPMSK  = USB_DIEPMSK_XFERCOMPLMSK;
+#if defined( USB_EP_STATS )
+  /* One interrupt per NAK, this is for throughput analysis only. */
+  USB->DOEPMSK |= USB_DOEPMSK_NAKMSK;
+  USB->DIEPMSK |= USB_DIEPMSK_NAKMSK | USB_DIEPMSK_INTKNTXFEMPMSK;
+#endif
 
   /* Reset Device Address */
   USB->DCFG &= ~_USB_DCFG_DEVADDR_MASK;
@@ -419,6 +523,70 @@ static void Handle_USB_GINTSTS_USBRST( void )
   USBDHAL_AbortAllTransfers( USB_STATUS_DEVICE_RESET );
 }
 
+#if defined( USB_EP_STATS )
+/*
+ * Bytes moved so far by the transfer in progress on an endpoint, read from
+ * the transfer size register like the transfer complete handlers do. On IN
+ * endpoints the count grows as the DMA loads the Tx FIFO, so it may run one
+ * FIFO ahead of the bus.
+ */
+static uint32_t EpStatsXferProgress( USBD_Ep_TypeDef *ep )
+{
+  if ( ep->state == D_EP_IDLE )
+    return ep->statsXferBytes;
+
+  if ( ep->in )
+  {
+    return ep->remaining -
+           ( ( USB_DINEPS[ ep->num ].TSIZ & _USB_DIEP_TSIZ_XFERSIZE_MASK ) >>
+             _USB_DIEP_TSIZ_XFERSIZE_SHIFT );
+  }
+
+  return ep->hwXferSize -
+         ( ( USB_DOUTEPS[ ep->num ].TSIZ & _USB_DOEP_TSIZ_XFERSIZE_MASK ) >>
+           _USB_DOEP_TSIZ_XFERSIZE_SHIFT );
+}
+
+/*
+ * Close a frame in the endpoint statistics at SOF. The bytes moved since
+ * the previous SOF, by completed transfers and by the transfer in progress,
+ * belong to the frame that ended.
+ */
+static void EpStatsFrameDone( void )
+{
+  int i;
+  uint32_t progress;
+  USBD_Ep_TypeDef *ep;
+
+  for ( i = 1; i <= NUM_EP_USED; i++ )
+  {
+    ep = &dev->ep[ i ];
+    progress = EpStatsXferProgress( ep );
+    ep->statsFrameBytes += progress - ep->statsXferBytes;
+    ep->statsXferBytes   = progress;
+
+    if ( ep->statsFrameBytes > ep->stats.maxFrameBytes )
+      ep->stats.maxFrameBytes = ep->statsFrameBytes;
+    ep->statsFrameBytes = 0;
+  }
+}
+
+/*
+ * Account a completed transfer in the endpoint statistics, the bytes not
+ * yet credited to earlier frames go to the current one.
+ */
+static void EpStatsXferDone( USBD_Ep_TypeDef *ep )
+{
+  ep->stats.bytes     += ep->xferred;
+  ep->stats.transfers += 1;
+  ep->statsFrameBytes += ep->xferred - ep->statsXferBytes;
+  ep->statsXferBytes   = 0;
+
+  if ( ep->statsFrameBytes > ep->stats.maxFrameBytes )
+    ep->stats.maxFrameBytes = ep->statsFrameBytes;
+}
+#endif /* defined( USB_EP_STATS ) */
+
 /*
  * Handle USB port suspend interrupt.
  */
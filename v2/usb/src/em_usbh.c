@@ -42,6 +42,10 @@ const USBH_AttachTiming_TypeDef   USBH_attachTiming[]=
 
 #define PORT_VBUS_DELAY       250
 #define DEFAULT_CTRL_TIMEOUT  1000
+#define FIRST_SCHED_HC        2   /* Channels 0 and 1 are used by EP0.      */
+
+static USBH_Ep_TypeDef  *hcWaitHead, *hcWaitTail; /* Waiting for a channel. */
+static uint32_t         addrInUse[ ( USB_MAX_DEVICE_ADDRESS + 32 ) / 32 ];
 
 static void Timeout( int hcnum );
 
@@ -124,8 +128,137 @@ static void Timeout( int hcnum )
   }
 }
 
+/*
+ * Host channel scheduler.
+ * Endpoints assigned to USBH_HC_ANY borrow an idle host channel for the
+ * duration of each transfer. Channels assigned to endpoints with a fixed
+ * channel number are never borrowed. When all channels are busy, transfers
+ * are queued and started in FIFO order as channels are released, so that
+ * transfers to several devices are spread over all available channels.
+ */
+static int HcAllocate( void )
+{
+  int i;
+
+  for ( i = FIRST_SCHED_HC; i < NUM_HC_USED + 2; i++ )
+  {
+    if ( hcs[ i ].idle && !hcs[ i ].reserved )
+      return i;
+  }
+  return -1;
+}
+
+/* Start a transfer prepared in ep, interrupts must be disabled. */
+static void HcStartXfer( USBH_Ep_TypeDef *ep, uint8_t hcnum )
+{
+  int timeout;
+  USBH_Hc_TypeDef *hc = &hcs[ hcnum ];
+
+  if ( ep->in )
+    ep->hcIn  = hcnum;
+  else
+    ep->hcOut = hcnum;
+
+  hc->buf       = ep->buf;
+  hc->xferred   = 0;
+  hc->remaining = ep->remaining;
+  hc->ep        = ep;
+
+  timeout = ep->timeout;
+  if ( ep->type == USB_EPTYPE_INTR )
+  {
+    if ( timeout )
+      timeout = EFM32_MIN( timeout, ep->epDesc.bInterval );
+    else
+      timeout = ep->epDesc.bInterval;
+  }
+
+  if ( timeout )
+  {
+    USBTIMER_Start( hcnum + HOSTCH_TIMER_INDEX,
+                    timeout, hcTimeoutFunc[ hcnum ] );
+  }
+
+  USBHHAL_HCInit( hcnum );
+  USBHHAL_HCStart( hcnum );
+}
+
+static void HcWait( USBH_Ep_TypeDef *ep )
+{
+  ep->nextWaiting = NULL;
+  if ( hcWaitTail )
+    hcWaitTail->nextWaiting = ep;
+  else
+    hcWaitHead = ep;
+  hcWaitTail = ep;
+}
+
+/* Complete all transfers waiting for a host channel. */
+void USBH_HcFlushWaiting( USB_Status_TypeDef reason )
+{
+  USBH_Ep_TypeDef *ep;
+
+  while ( ( ep = hcWaitHead ) != NULL )
+  {
+    hcWaitHead = ep->nextWaiting;
+    if ( hcWaitHead == NULL )
+      hcWaitTail = NULL;
+    ep->nextWaiting = NULL;
+    USBHEP_TransferDone( ep, reason );
+  }
+}
+
+/* A scheduled host channel is released, start the oldest waiting transfer. */
+void USBH_HcScheduleNext( uint8_t hcnum )
+{
+  USBH_Ep_TypeDef *ep;
+
+  if ( ( ep = hcWaitHead ) != NULL )
+  {
+    hcWaitHead = ep->nextWaiting;
+    if ( hcWaitHead == NULL )
+      hcWaitTail = NULL;
+    ep->nextWaiting = NULL;
+    HcStartXfer( ep, hcnum );
+  }
+}
+
 /** @endcond */
 
+/***************************************************************************//**
+ * @brief
+ *   Allocate a free USB device address.
+ *
+ * @details
+ *   The host stack keeps track of device addresses in use. All addresses are
+ *   released when the USB port is reinitialized by
+ *   @ref USBH_WaitForDeviceConnectionB(). Use @ref USBH_ReleaseAddress() when
+ *   a device behind a hub is removed.
+ *
+ * @return
+ *   A device address (1..127), or @ref USB_STATUS_ILLEGAL if all addresses
+ *   are in use.
+ ******************************************************************************/
+int USBH_AllocateAddress( void )
+{
+  int addr;
+
+  INT_Disable();
+  for ( addr = 1; addr <= USB_MAX_DEVICE_ADDRESS; addr++ )
+  {
+    if ( !( addrInUse[ addr >> 5 ] & ( 1UL << ( addr & 31 ) ) ) )
+    {
+      addrInUse[ addr >> 5 ] |= 1UL << ( addr & 31 );
+      INT_Enable();
+      return addr;
+    }
+  }
+  INT_Enable();
+
+  DEBUG_USB_API_PUTS( "\nUSBH_AllocateAddress(), No free device address" );
+  return USB_STATUS_ILLEGAL;
+}
+
 /***************************************************************************//**
  * @brief
  *   Assign a host channel to a given endpoint.
@@ -146,6 +279,15 @@ static void Timeout( int hcnum )
  *   transfers can only be performed on endpoints assigned to different host
  *   channels.  @n The default endpoint (EP0) is assigned to host channels 0
  *   and 1 by the host stack.
+ *   @n Use @ref USBH_HC_ANY as channel number to let the host channel
+ *   scheduler allocate an idle channel for each transfer on the endpoint,
+ *   channels with a fixed endpoint assignment are left alone. When no
+ *   channel is idle, the transfer is queued and started when a channel is
+ *   released, the transfer timeout starts counting at that point. A
+ *   channel is released when a transfer completes, transfers which the
+ *   device NAK's keep their channel, use a timeout on bulk IN endpoints
+ *   which may NAK for a long time. Control endpoints can not use
+ *   @ref USBH_HC_ANY.
  ******************************************************************************/
 int USBH_AssignHostChannel( USBH_Ep_TypeDef *ep, uint8_t hcnum )
 {
@@ -163,13 +305,30 @@ int USBH_AssignHostChannel( USBH_Ep_TypeDef *ep, uint8_t hcnum )
     return USB_STATUS_ILLEGAL;
   }
 
-  if ( hcnum >= MAX_NUM_HOSTCHANNELS )
+  if ( hcnum == USBH_HC_ANY )
+  {
+    if ( ep->type == USB_EPTYPE_CTRL )
+    {
+      DEBUG_USB_API_PUTS( "\nUSBH_AssignHostChannel(),"
+                          " Control endpoints need fixed host channels" );
+      EFM_ASSERT( false );
+      return USB_STATUS_ILLEGAL;
+    }
+    ep->hcAny = true;
+  }
+  else if ( hcnum >= MAX_NUM_HOSTCHANNELS )
   {
     DEBUG_USB_API_PUTS( "\nUSBH_AssignHostChannel(),"
                         " Illegal host channel number" );
     EFM_ASSERT( false );
     return USB_STATUS_ILLEGAL;
   }
+  else
+  {
+    ep->hcAny = false;
+    if ( hcnum < NUM_HC_USED + 2 )
+      hcs[ hcnum ].reserved = true;
+  }
 
   if ( ep->in )
   {
@@ -1662,7 +1821,7 @@ int USBH_QueryDeviceB( uint8_t *buf, size_t bufsize, uint8_t deviceSpeed )
 int USBH_Read( USBH_Ep_TypeDef *ep, void *data, int byteCount, int timeout,
                USB_XferCompleteCb_TypeDef callback )
 {
-  USBH_Hc_TypeDef *hc = &hcs[ ep->hcIn ];
+  int hcnum;
 
   if ( ep == NULL )
   {
@@ -1708,11 +1867,19 @@ int USBH_Read( USBH_Ep_TypeDef *ep, void *data, int byteCount, int timeout,
     return USB_STATUS_ILLEGAL;
   }
 
-  if ( !hc->idle )
+  if ( ep->hcAny )
   {
-    INT_Enable();
-    DEBUG_USB_API_PUTS( "\nUSBH_Read(), Host channel is busy" );
-    return USB_STATUS_HC_BUSY;
+    hcnum = HcAllocate();
+  }
+  else
+  {
+    hcnum = ep->hcIn;
+    if ( !hcs[ hcnum ].idle )
+    {
+      INT_Enable();
+      DEBUG_USB_API_PUTS( "\nUSBH_Read(), Host channel is busy" );
+      return USB_STATUS_HC_BUSY;
+    }
   }
 
   ep->xferCompleted  = false;
@@ -1723,27 +1890,10 @@ int USBH_Read( USBH_Ep_TypeDef *ep, void *data, int byteCount, int timeout,
   ep->xferred        = 0;
   ep->timeout        = timeout;
 
-  hc->buf = data;
-  hc->xferred = 0;
-  hc->remaining = byteCount;
-  hc->ep = ep;
-
-  if ( ep->type == USB_EPTYPE_INTR )
-  {
-    if ( timeout )
-      timeout = EFM32_MIN( timeout, ep->epDesc.bInterval );
-    else
-      timeout = ep->epDesc.bInterval;
-  }
-
-  if ( timeout )
-  {
-    USBTIMER_Start( ep->hcIn + HOSTCH_TIMER_INDEX,
-                    timeout, hcTimeoutFunc[ ep->hcIn ] );
-  }
-
-  USBHHAL_HCInit( ep->hcIn );
-  USBHHAL_HCStart( ep->hcIn );
+  if ( hcnum < 0 )
+    HcWait( ep );
+  else
+    HcStartXfer( ep, hcnum );
 
   INT_Enable();
 
@@ -1809,6 +1959,28 @@ int USBH_ReadB( USBH_Ep_TypeDef *ep, void *data, int byteCount, int timeout )
   return retVal;
 }
 
+/***************************************************************************//**
+ * @brief
+ *   Release a device address allocated with @ref USBH_AllocateAddress().
+ *
+ * @param[in] deviceAddress
+ *   The device address to release.
+ ******************************************************************************/
+void USBH_ReleaseAddress( uint8_t deviceAddress )
+{
+  if ( ( deviceAddress == 0                      ) ||
+       ( deviceAddress > USB_MAX_DEVICE_ADDRESS )    )
+  {
+    DEBUG_USB_API_PUTS( "\nUSBH_ReleaseAddress(), Illegal device address" );
+    EFM_ASSERT( false );
+    return;
+  }
+
+  INT_Disable();
+  addrInUse[ deviceAddress >> 5 ] &= ~( 1UL << ( deviceAddress & 31 ) );
+  INT_Enable();
+}
+
 /***************************************************************************//**
  * @brief
  *   Give a device an USB address.
@@ -2095,6 +2267,9 @@ static void InitUsb( void )
   {
     hcs[ i ].idle = true;
   }
+  hcWaitHead = NULL;
+  hcWaitTail = NULL;
+  memset( addrInUse, 0, sizeof( addrInUse ) );
 
   INT_Disable();
   USBHHAL_CoreInit( USBH_initData.rxFifoSize, USBH_initData.nptxFifoSize,
@@ -2283,7 +2458,7 @@ int USBH_WaitForDeviceConnectionB( uint8_t *buf, int timeoutInSeconds )
 int USBH_Write( USBH_Ep_TypeDef *ep, void *data, int byteCount,
                 int timeout, USB_XferCompleteCb_TypeDef callback )
 {
-  USBH_Hc_TypeDef *hc = &hcs[ ep->hcOut ];
+  int hcnum;
 
   if ( ep == NULL )
   {
@@ -2329,11 +2504,19 @@ int USBH_Write( USBH_Ep_TypeDef *ep, void *data, int byteCount,
     return USB_STATUS_ILLEGAL;
   }
 
-  if ( !hc->idle )
+  if ( ep->hcAny )
   {
-    INT_Enable();
-    DEBUG_USB_API_PUTS( "\nUSBH_Write(), Host channel is busy" );
-    return USB_STATUS_HC_BUSY;
+    hcnum = HcAllocate();
+  }
+  else
+  {
+    hcnum = ep->hcOut;
+    if ( !hcs[ hcnum ].idle )
+    {
+      INT_Enable();
+      DEBUG_USB_API_PUTS( "\nUSBH_Write(), Host channel is busy" );
+      return USB_STATUS_HC_BUSY;
+    }
   }
 
   ep->xferCompleted  = false;
@@ -2344,27 +2527,10 @@ int USBH_Write( USBH_Ep_TypeDef *ep, void *data, int byteCount,
   ep->xferred        = 0;
   ep->timeout        = timeout;
 
-  hc->buf = data;
-  hc->xferred = 0;
-  hc->remaining = byteCount;
-  hc->ep = ep;
-
-  if ( ep->type == USB_EPTYPE_INTR )
-  {
-    if ( timeout )
-      timeout = EFM32_MIN( timeout, ep->epDesc.bInterval );
-    else
-      timeout = ep->epDesc.bInterval;
-  }
-
-  if ( timeout )
-  {
-    USBTIMER_Start( ep->hcOut + HOSTCH_TIMER_INDEX,
-                    timeout, hcTimeoutFunc[ ep->hcOut ] );
-  }
-
-  USBHHAL_HCInit( ep->hcOut );
-  USBHHAL_HCStart( ep->hcOut );
+  if ( hcnum < 0 )
+    HcWait( ep );
+  else
+    HcStartXfer( ep, hcnum );
 
   INT_Enable();
 
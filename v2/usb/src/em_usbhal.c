@@ -241,7 +241,8 @@ USB_Status_TypeDef USBDHAL_CoreInit( uint32_t totalRxFifoSize,
   if ( totalRxFifoSize + totalTxFifoSize > MAX_DEVICE_FIFO_SIZE_INWORDS )
     return USB_STATUS_ILLEGAL;
 
-  if ( start > MAX_DEVICE_FIFO_SIZE_INWORDS )
+  /* The last Tx FIFO must end within FIFO RAM. */
+  if ( start + depth > MAX_DEVICE_FIFO_SIZE_INWORDS )
     return USB_STATUS_ILLEGAL;
 
   /* Flush the FIFO's */
@@ -171,12 +171,23 @@ void USBHEP_TransferDone( USBH_Ep_TypeDef *ep, USB_Status_TypeDef result )
   {
     hcnum = ep->in ? ep->hcIn : ep->hcOut;
 
-    if ( ep->timeout || ep->type == USB_EPTYPE_INTR )
-      USBTIMER_Stop( hcnum + HOSTCH_TIMER_INDEX );
+    if ( hcnum != USBH_HC_ANY )   /* Else never got a host channel. */
+    {
+      if ( ep->timeout || ep->type == USB_EPTYPE_INTR )
+        USBTIMER_Stop( hcnum + HOSTCH_TIMER_INDEX );
 
-    hcs[ hcnum ].idle = true;
-    ep->xferred   = hcs[ hcnum ].xferred;
-    ep->remaining = hcs[ hcnum ].remaining;
+      hcs[ hcnum ].idle = true;
+      ep->xferred   = hcs[ hcnum ].xferred;
+      ep->remaining = hcs[ hcnum ].remaining;
+
+      if ( ep->hcAny )
+      {
+        /* Hand the channel over before the callback queues a new transfer. */
+        ep->hcIn  = USBH_HC_ANY;
+        ep->hcOut = USBH_HC_ANY;
+        USBH_HcScheduleNext( hcnum );
+      }
+    }
   }
 
   if ( ep->xferCompleteCb )
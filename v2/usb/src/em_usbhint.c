@@ -294,6 +294,9 @@ static void Handle_USB_GINTSTS_DISCONNINT( void )
   USBTIMER_Stop( HOSTPORT_TIMER_INDEX );
   USBHHAL_PortReset( false );
 
+  /* Queued transfers first, or released channels would start them. */
+  USBH_HcFlushWaiting( USB_STATUS_DEVICE_REMOVED );
+
   for ( i=0; i< NUM_HC_USED + 2; i++ )
   {
     hcchar = USB->HC[ i ].CHAR;                 /* Halt channel             */